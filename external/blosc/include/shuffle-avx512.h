@@ -0,0 +1,48 @@
+/*********************************************************************
+  Blosc - Blocked Shuffling and Compression Library
+
+  See LICENSES/BLOSC.txt for details about copyright and rights to use.
+**********************************************************************/
+
+/* AVX512-accelerated shuffle/unshuffle routines. */
+
+#ifndef SHUFFLE_AVX512_H
+#define SHUFFLE_AVX512_H
+
+#include "blosc-common.h"
+
+/*  The AVX512 routines are compiled with per-function `target`
+    attributes so that no special compiler flags are needed; the
+    dispatcher only selects them after verifying AVX512BW support (and
+    OS ZMM state support) at run-time. Only GCC and Clang support the
+    `target` attribute, so the routines are unavailable elsewhere. */
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define SHUFFLE_AVX512_ENABLED
+#endif
+
+#ifdef SHUFFLE_AVX512_ENABLED
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+  AVX512-accelerated shuffle routine.
+*/
+BLOSC_NO_EXPORT void blosc_internal_shuffle_avx512(const size_t bytesoftype, const size_t blocksize,
+                                                   const uint8_t* const _src, uint8_t* const _dest);
+
+/**
+  AVX512-accelerated unshuffle routine.
+*/
+BLOSC_NO_EXPORT void blosc_internal_unshuffle_avx512(const size_t bytesoftype, const size_t blocksize,
+                                                     const uint8_t* const _src, uint8_t* const _dest);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHUFFLE_AVX512_ENABLED */
+
+#endif /* SHUFFLE_AVX512_H */
@@ -0,0 +1,451 @@
+/*********************************************************************
+  Blosc - Blocked Shuffling and Compression Library
+
+  See LICENSES/BLOSC.txt for details about copyright and rights to use.
+**********************************************************************/
+
+#include "shuffle-generic.h"
+#include "shuffle-avx512.h"
+
+/* Only compiled when the toolchain supports per-function `target`
+   attributes; see shuffle-avx512.h. */
+#ifdef SHUFFLE_AVX512_ENABLED
+
+#if defined(__AVX2__)
+#include "shuffle-avx2.h"
+#endif
+
+#include <immintrin.h>
+
+/* Compile each kernel for AVX512F+BW regardless of the global target,
+   so no dedicated compiler flags or source-file properties are needed.
+   The run-time dispatcher guarantees the kernels only execute on
+   processors (and operating systems) supporting them. */
+#define BLOSC_TARGET_AVX512 __attribute__((target("avx512f,avx512bw")))
+
+/* Routine optimized for shuffling a buffer for a type size of 2 bytes. */
+BLOSC_TARGET_AVX512 static void
+shuffle2_avx512(uint8_t* const dest, const uint8_t* const src,
+  const size_t vectorizable_elements, const size_t total_elements)
+{
+  static const size_t bytesoftype = 2;
+  size_t j;
+  int k;
+  __m512i zmm0[2], zmm1[2];
+
+  /* Group the even bytes and the odd bytes within each 16-byte lane. */
+  const __m512i shmask = _mm512_set_epi8(
+    0x0f, 0x0d, 0x0b, 0x09, 0x07, 0x05, 0x03, 0x01,
+    0x0e, 0x0c, 0x0a, 0x08, 0x06, 0x04, 0x02, 0x00,
+    0x0f, 0x0d, 0x0b, 0x09, 0x07, 0x05, 0x03, 0x01,
+    0x0e, 0x0c, 0x0a, 0x08, 0x06, 0x04, 0x02, 0x00,
+    0x0f, 0x0d, 0x0b, 0x09, 0x07, 0x05, 0x03, 0x01,
+    0x0e, 0x0c, 0x0a, 0x08, 0x06, 0x04, 0x02, 0x00,
+    0x0f, 0x0d, 0x0b, 0x09, 0x07, 0x05, 0x03, 0x01,
+    0x0e, 0x0c, 0x0a, 0x08, 0x06, 0x04, 0x02, 0x00);
+  /* Gather the even-byte qwords into the lower half and the odd-byte
+     qwords into the upper half of the register. */
+  const __m512i permq = _mm512_set_epi64(7, 5, 3, 1, 6, 4, 2, 0);
+
+  for (j = 0; j < vectorizable_elements; j += sizeof(__m512i)) {
+    /* Fetch 64 elements (128 bytes) then separate even and odd bytes. */
+    for (k = 0; k < 2; k++) {
+      zmm0[k] = _mm512_loadu_si512(src + (j * bytesoftype) + (k * sizeof(__m512i)));
+      zmm0[k] = _mm512_shuffle_epi8(zmm0[k], shmask);
+      zmm0[k] = _mm512_permutexvar_epi64(permq, zmm0[k]);
+    }
+
+    /* Concatenate the even halves and the odd halves of the two registers. */
+    zmm1[0] = _mm512_shuffle_i64x2(zmm0[0], zmm0[1], 0x44);
+    zmm1[1] = _mm512_shuffle_i64x2(zmm0[0], zmm0[1], 0xee);
+
+    /* Store the result vectors */
+    uint8_t* const dest_for_jth_element = dest + j;
+    for (k = 0; k < 2; k++) {
+      _mm512_storeu_si512(dest_for_jth_element + (k * total_elements), zmm1[k]);
+    }
+  }
+}
+
+/* Routine optimized for shuffling a buffer for a type size of 4 bytes. */
+BLOSC_TARGET_AVX512 static void
+shuffle4_avx512(uint8_t* const dest, const uint8_t* const src,
+  const size_t vectorizable_elements, const size_t total_elements)
+{
+  static const size_t bytesoftype = 4;
+  size_t i;
+  int j;
+  __m512i zmm0[4], zmm1[4];
+
+  /* Group the bytes of each position within each 16-byte lane
+     (a 4x4 byte transpose, which is its own inverse). */
+  const __m512i shmask = _mm512_set_epi8(
+    0x0f, 0x0b, 0x07, 0x03, 0x0e, 0x0a, 0x06, 0x02,
+    0x0d, 0x09, 0x05, 0x01, 0x0c, 0x08, 0x04, 0x00,
+    0x0f, 0x0b, 0x07, 0x03, 0x0e, 0x0a, 0x06, 0x02,
+    0x0d, 0x09, 0x05, 0x01, 0x0c, 0x08, 0x04, 0x00,
+    0x0f, 0x0b, 0x07, 0x03, 0x0e, 0x0a, 0x06, 0x02,
+    0x0d, 0x09, 0x05, 0x01, 0x0c, 0x08, 0x04, 0x00,
+    0x0f, 0x0b, 0x07, 0x03, 0x0e, 0x0a, 0x06, 0x02,
+    0x0d, 0x09, 0x05, 0x01, 0x0c, 0x08, 0x04, 0x00);
+  /* Gather the dwords of each byte position into one 16-byte lane
+     (a 4x4 dword transpose, which is its own inverse). */
+  const __m512i permd = _mm512_set_epi32(
+    15, 11, 7, 3, 14, 10, 6, 2, 13, 9, 5, 1, 12, 8, 4, 0);
+
+  for (i = 0; i < vectorizable_elements; i += sizeof(__m512i)) {
+    /* Fetch 64 elements (256 bytes); each register ends up holding the
+       bytes of one position in one of its 16-byte lanes. */
+    for (j = 0; j < 4; j++) {
+      zmm0[j] = _mm512_loadu_si512(src + (i * bytesoftype) + (j * sizeof(__m512i)));
+      zmm0[j] = _mm512_shuffle_epi8(zmm0[j], shmask);
+      zmm0[j] = _mm512_permutexvar_epi32(permd, zmm0[j]);
+    }
+
+    /* Transpose the 4x4 matrix of 16-byte lanes across the registers so
+       that each register holds the full stream of one byte position. */
+    zmm1[0] = _mm512_shuffle_i32x4(zmm0[0], zmm0[1], 0x88);
+    zmm1[1] = _mm512_shuffle_i32x4(zmm0[0], zmm0[1], 0xdd);
+    zmm1[2] = _mm512_shuffle_i32x4(zmm0[2], zmm0[3], 0x88);
+    zmm1[3] = _mm512_shuffle_i32x4(zmm0[2], zmm0[3], 0xdd);
+    zmm0[0] = _mm512_shuffle_i32x4(zmm1[0], zmm1[2], 0x88);
+    zmm0[2] = _mm512_shuffle_i32x4(zmm1[0], zmm1[2], 0xdd);
+    zmm0[1] = _mm512_shuffle_i32x4(zmm1[1], zmm1[3], 0x88);
+    zmm0[3] = _mm512_shuffle_i32x4(zmm1[1], zmm1[3], 0xdd);
+
+    /* Store the result vectors */
+    uint8_t* const dest_for_ith_element = dest + i;
+    for (j = 0; j < 4; j++) {
+      _mm512_storeu_si512(dest_for_ith_element + (j * total_elements), zmm0[j]);
+    }
+  }
+}
+
+/* Transposes the 8x8 matrix whose rows are the qwords of the eight input
+   registers, using three butterfly stages of distances 1, 2 and 4. */
+BLOSC_TARGET_AVX512 static void
+transpose8x8_qword_avx512(__m512i* const zmm)
+{
+  int d, k;
+  __m512i tmp[8];
+
+  for (d = 1; d <= 4; d *= 2) {
+    /* Stage of distance `d`: for the register pair (k, k + d), output
+       qword q of the low register comes from source register
+       (k | (q & d)) at qword (q & ~d), and of the high register from
+       the same source registers at qword ((q & ~d) | d). */
+    __m512i idx_lo, idx_hi;
+    int64_t lo[8], hi[8];
+    for (k = 0; k < 8; k++) {
+      lo[k] = ((k & d) ? 8 : 0) | (k & ~d);
+      hi[k] = ((k & d) ? 8 : 0) | (k & ~d) | d;
+    }
+    idx_lo = _mm512_set_epi64(lo[7], lo[6], lo[5], lo[4], lo[3], lo[2], lo[1], lo[0]);
+    idx_hi = _mm512_set_epi64(hi[7], hi[6], hi[5], hi[4], hi[3], hi[2], hi[1], hi[0]);
+
+    for (k = 0; k < 8; k++) {
+      if ((k & d) == 0) {
+        tmp[k] = _mm512_permutex2var_epi64(zmm[k], idx_lo, zmm[k + d]);
+        tmp[k + d] = _mm512_permutex2var_epi64(zmm[k], idx_hi, zmm[k + d]);
+      }
+    }
+    for (k = 0; k < 8; k++) {
+      zmm[k] = tmp[k];
+    }
+  }
+}
+
+/* Routine optimized for shuffling a buffer for a type size of 8 bytes. */
+BLOSC_TARGET_AVX512 static void
+shuffle8_avx512(uint8_t* const dest, const uint8_t* const src,
+  const size_t vectorizable_elements, const size_t total_elements)
+{
+  static const size_t bytesoftype = 8;
+  size_t j;
+  int k;
+  __m512i zmm0[8];
+
+  /* Pair the bytes of each position of the two elements within each
+     16-byte lane (an 8x2 byte transpose). */
+  const __m512i shmask = _mm512_set_epi8(
+    0x0f, 0x07, 0x0e, 0x06, 0x0d, 0x05, 0x0c, 0x04,
+    0x0b, 0x03, 0x0a, 0x02, 0x09, 0x01, 0x08, 0x00,
+    0x0f, 0x07, 0x0e, 0x06, 0x0d, 0x05, 0x0c, 0x04,
+    0x0b, 0x03, 0x0a, 0x02, 0x09, 0x01, 0x08, 0x00,
+    0x0f, 0x07, 0x0e, 0x06, 0x0d, 0x05, 0x0c, 0x04,
+    0x0b, 0x03, 0x0a, 0x02, 0x09, 0x01, 0x08, 0x00,
+    0x0f, 0x07, 0x0e, 0x06, 0x0d, 0x05, 0x0c, 0x04,
+    0x0b, 0x03, 0x0a, 0x02, 0x09, 0x01, 0x08, 0x00);
+  /* Gather the words of each byte position into one qword (an 8x4 word
+     transpose across the lanes). */
+  const __m512i permw = _mm512_set_epi16(
+    31, 23, 15, 7, 30, 22, 14, 6, 29, 21, 13, 5, 28, 20, 12, 4,
+    27, 19, 11, 3, 26, 18, 10, 2, 25, 17, 9, 1, 24, 16, 8, 0);
+
+  for (j = 0; j < vectorizable_elements; j += sizeof(__m512i)) {
+    /* Fetch 64 elements (512 bytes); each register ends up holding the
+       bytes of one position in one of its qwords. */
+    for (k = 0; k < 8; k++) {
+      zmm0[k] = _mm512_loadu_si512(src + (j * bytesoftype) + (k * sizeof(__m512i)));
+      zmm0[k] = _mm512_shuffle_epi8(zmm0[k], shmask);
+      zmm0[k] = _mm512_permutexvar_epi16(permw, zmm0[k]);
+    }
+
+    /* Transpose qwords across the registers so that each register holds
+       the full stream of one byte position. */
+    transpose8x8_qword_avx512(zmm0);
+
+    /* Store the result vectors */
+    uint8_t* const dest_for_jth_element = dest + j;
+    for (k = 0; k < 8; k++) {
+      _mm512_storeu_si512(dest_for_jth_element + (k * total_elements), zmm0[k]);
+    }
+  }
+}
+
+/* Routine optimized for unshuffling a buffer for a type size of 2 bytes. */
+BLOSC_TARGET_AVX512 static void
+unshuffle2_avx512(uint8_t* const dest, const uint8_t* const src,
+  const size_t vectorizable_elements, const size_t total_elements)
+{
+  static const size_t bytesoftype = 2;
+  size_t i;
+  int j;
+  __m512i zmm0[2], zmm1[2];
+
+  /* Inverses of the shuffle2_avx512 permutations, applied in reverse. */
+  const __m512i permq = _mm512_set_epi64(7, 3, 6, 2, 5, 1, 4, 0);
+  const __m512i shmask = _mm512_set_epi8(
+    0x0f, 0x07, 0x0e, 0x06, 0x0d, 0x05, 0x0c, 0x04,
+    0x0b, 0x03, 0x0a, 0x02, 0x09, 0x01, 0x08, 0x00,
+    0x0f, 0x07, 0x0e, 0x06, 0x0d, 0x05, 0x0c, 0x04,
+    0x0b, 0x03, 0x0a, 0x02, 0x09, 0x01, 0x08, 0x00,
+    0x0f, 0x07, 0x0e, 0x06, 0x0d, 0x05, 0x0c, 0x04,
+    0x0b, 0x03, 0x0a, 0x02, 0x09, 0x01, 0x08, 0x00,
+    0x0f, 0x07, 0x0e, 0x06, 0x0d, 0x05, 0x0c, 0x04,
+    0x0b, 0x03, 0x0a, 0x02, 0x09, 0x01, 0x08, 0x00);
+
+  for (i = 0; i < vectorizable_elements; i += sizeof(__m512i)) {
+    /* Load 64 elements (128 bytes) from the even and odd byte streams. */
+    const uint8_t* const src_for_ith_element = src + i;
+    for (j = 0; j < 2; j++) {
+      zmm0[j] = _mm512_loadu_si512(src_for_ith_element + (j * total_elements));
+    }
+
+    /* Split each stream back into the halves of the two destination
+       registers, then interleave the bytes within each register. */
+    zmm1[0] = _mm512_shuffle_i64x2(zmm0[0], zmm0[1], 0x44);
+    zmm1[1] = _mm512_shuffle_i64x2(zmm0[0], zmm0[1], 0xee);
+    for (j = 0; j < 2; j++) {
+      zmm1[j] = _mm512_permutexvar_epi64(permq, zmm1[j]);
+      zmm1[j] = _mm512_shuffle_epi8(zmm1[j], shmask);
+      _mm512_storeu_si512(dest + (i * bytesoftype) + (j * sizeof(__m512i)), zmm1[j]);
+    }
+  }
+}
+
+/* Routine optimized for unshuffling a buffer for a type size of 4 bytes. */
+BLOSC_TARGET_AVX512 static void
+unshuffle4_avx512(uint8_t* const dest, const uint8_t* const src,
+  const size_t vectorizable_elements, const size_t total_elements)
+{
+  static const size_t bytesoftype = 4;
+  size_t i;
+  int j;
+  __m512i zmm0[4], zmm1[4];
+
+  /* The lane and byte transposes of shuffle4_avx512 are involutions, so
+     the same masks invert them. */
+  const __m512i permd = _mm512_set_epi32(
+    15, 11, 7, 3, 14, 10, 6, 2, 13, 9, 5, 1, 12, 8, 4, 0);
+  const __m512i shmask = _mm512_set_epi8(
+    0x0f, 0x0b, 0x07, 0x03, 0x0e, 0x0a, 0x06, 0x02,
+    0x0d, 0x09, 0x05, 0x01, 0x0c, 0x08, 0x04, 0x00,
+    0x0f, 0x0b, 0x07, 0x03, 0x0e, 0x0a, 0x06, 0x02,
+    0x0d, 0x09, 0x05, 0x01, 0x0c, 0x08, 0x04, 0x00,
+    0x0f, 0x0b, 0x07, 0x03, 0x0e, 0x0a, 0x06, 0x02,
+    0x0d, 0x09, 0x05, 0x01, 0x0c, 0x08, 0x04, 0x00,
+    0x0f, 0x0b, 0x07, 0x03, 0x0e, 0x0a, 0x06, 0x02,
+    0x0d, 0x09, 0x05, 0x01, 0x0c, 0x08, 0x04, 0x00);
+
+  for (i = 0; i < vectorizable_elements; i += sizeof(__m512i)) {
+    /* Load 64 elements (256 bytes) from the four byte-position streams. */
+    const uint8_t* const src_for_ith_element = src + i;
+    for (j = 0; j < 4; j++) {
+      zmm0[j] = _mm512_loadu_si512(src_for_ith_element + (j * total_elements));
+    }
+
+    /* Invert the 4x4 lane transpose across the registers. */
+    zmm1[0] = _mm512_shuffle_i32x4(zmm0[0], zmm0[1], 0x88);
+    zmm1[1] = _mm512_shuffle_i32x4(zmm0[2], zmm0[3], 0x88);
+    zmm1[2] = _mm512_shuffle_i32x4(zmm0[0], zmm0[1], 0xdd);
+    zmm1[3] = _mm512_shuffle_i32x4(zmm0[2], zmm0[3], 0xdd);
+    zmm0[0] = _mm512_shuffle_i32x4(zmm1[0], zmm1[1], 0x88);
+    zmm0[1] = _mm512_shuffle_i32x4(zmm1[2], zmm1[3], 0x88);
+    zmm0[2] = _mm512_shuffle_i32x4(zmm1[0], zmm1[1], 0xdd);
+    zmm0[3] = _mm512_shuffle_i32x4(zmm1[2], zmm1[3], 0xdd);
+
+    /* Invert the in-register transposes and store. */
+    for (j = 0; j < 4; j++) {
+      zmm0[j] = _mm512_permutexvar_epi32(permd, zmm0[j]);
+      zmm0[j] = _mm512_shuffle_epi8(zmm0[j], shmask);
+      _mm512_storeu_si512(dest + (i * bytesoftype) + (j * sizeof(__m512i)), zmm0[j]);
+    }
+  }
+}
+
+/* Routine optimized for unshuffling a buffer for a type size of 8 bytes. */
+BLOSC_TARGET_AVX512 static void
+unshuffle8_avx512(uint8_t* const dest, const uint8_t* const src,
+  const size_t vectorizable_elements, const size_t total_elements)
+{
+  static const size_t bytesoftype = 8;
+  size_t i;
+  int j;
+  __m512i zmm0[8];
+
+  /* Inverses of the shuffle8_avx512 permutations; the qword transpose is
+     an involution. */
+  const __m512i permw = _mm512_set_epi16(
+    31, 27, 23, 19, 15, 11, 7, 3, 30, 26, 22, 18, 14, 10, 6, 2,
+    29, 25, 21, 17, 13, 9, 5, 1, 28, 24, 20, 16, 12, 8, 4, 0);
+  const __m512i shmask = _mm512_set_epi8(
+    0x0f, 0x0d, 0x0b, 0x09, 0x07, 0x05, 0x03, 0x01,
+    0x0e, 0x0c, 0x0a, 0x08, 0x06, 0x04, 0x02, 0x00,
+    0x0f, 0x0d, 0x0b, 0x09, 0x07, 0x05, 0x03, 0x01,
+    0x0e, 0x0c, 0x0a, 0x08, 0x06, 0x04, 0x02, 0x00,
+    0x0f, 0x0d, 0x0b, 0x09, 0x07, 0x05, 0x03, 0x01,
+    0x0e, 0x0c, 0x0a, 0x08, 0x06, 0x04, 0x02, 0x00,
+    0x0f, 0x0d, 0x0b, 0x09, 0x07, 0x05, 0x03, 0x01,
+    0x0e, 0x0c, 0x0a, 0x08, 0x06, 0x04, 0x02, 0x00);
+
+  for (i = 0; i < vectorizable_elements; i += sizeof(__m512i)) {
+    /* Load 64 elements (512 bytes) from the eight byte-position streams. */
+    const uint8_t* const src_for_ith_element = src + i;
+    for (j = 0; j < 8; j++) {
+      zmm0[j] = _mm512_loadu_si512(src_for_ith_element + (j * total_elements));
+    }
+
+    /* Invert the qword transpose across the registers. */
+    transpose8x8_qword_avx512(zmm0);
+
+    /* Invert the in-register transposes and store. */
+    for (j = 0; j < 8; j++) {
+      zmm0[j] = _mm512_permutexvar_epi16(permw, zmm0[j]);
+      zmm0[j] = _mm512_shuffle_epi8(zmm0[j], shmask);
+      _mm512_storeu_si512(dest + (i * bytesoftype) + (j * sizeof(__m512i)), zmm0[j]);
+    }
+  }
+}
+
+/* Shuffle a block.  This can never fail. */
+void
+blosc_internal_shuffle_avx512(const size_t bytesoftype, const size_t blocksize,
+                              const uint8_t* const _src, uint8_t* const _dest) {
+  const size_t vectorized_chunk_size = bytesoftype * sizeof(__m512i);
+
+  /* If the block size is too small to be vectorized,
+     use the generic implementation. */
+  if (blocksize < vectorized_chunk_size) {
+    blosc_internal_shuffle_generic(bytesoftype, blocksize, _src, _dest);
+    return;
+  }
+
+  /* If the blocksize is not a multiple of both the typesize and
+     the vector size, round the blocksize down to the next value
+     which is a multiple of both. The vectorized shuffle can be
+     used for that portion of the data, and the naive implementation
+     can be used for the remaining portion. */
+  const size_t vectorizable_bytes = blocksize - (blocksize % vectorized_chunk_size);
+
+  const size_t vectorizable_elements = vectorizable_bytes / bytesoftype;
+  const size_t total_elements = blocksize / bytesoftype;
+
+  /* Optimized shuffle implementations */
+  switch (bytesoftype)
+  {
+  case 2:
+    shuffle2_avx512(_dest, _src, vectorizable_elements, total_elements);
+    break;
+  case 4:
+    shuffle4_avx512(_dest, _src, vectorizable_elements, total_elements);
+    break;
+  case 8:
+    shuffle8_avx512(_dest, _src, vectorizable_elements, total_elements);
+    break;
+  default:
+    /* For other type sizes, defer to the next-best implementation. */
+#if defined(__AVX2__)
+    blosc_internal_shuffle_avx2(bytesoftype, blocksize, _src, _dest);
+#else
+    blosc_internal_shuffle_generic(bytesoftype, blocksize, _src, _dest);
+#endif
+    /* The deferred-to function covers the whole buffer,
+       so we're done processing here. */
+    return;
+  }
+
+  /* If the buffer had any bytes at the end which couldn't be handled
+     by the vectorized implementations, use the non-optimized version
+     to finish them up. */
+  if (vectorizable_bytes < blocksize) {
+    shuffle_generic_inline(bytesoftype, vectorizable_bytes, blocksize, _src, _dest);
+  }
+}
+
+/* Unshuffle a block.  This can never fail. */
+void
+blosc_internal_unshuffle_avx512(const size_t bytesoftype, const size_t blocksize,
+                                const uint8_t* const _src, uint8_t* const _dest) {
+  const size_t vectorized_chunk_size = bytesoftype * sizeof(__m512i);
+
+  /* If the block size is too small to be vectorized,
+     use the generic implementation. */
+  if (blocksize < vectorized_chunk_size) {
+    blosc_internal_unshuffle_generic(bytesoftype, blocksize, _src, _dest);
+    return;
+  }
+
+  /* If the blocksize is not a multiple of both the typesize and
+     the vector size, round the blocksize down to the next value
+     which is a multiple of both. The vectorized unshuffle can be
+     used for that portion of the data, and the naive implementation
+     can be used for the remaining portion. */
+  const size_t vectorizable_bytes = blocksize - (blocksize % vectorized_chunk_size);
+
+  const size_t vectorizable_elements = vectorizable_bytes / bytesoftype;
+  const size_t total_elements = blocksize / bytesoftype;
+
+  /* Optimized unshuffle implementations */
+  switch (bytesoftype)
+  {
+  case 2:
+    unshuffle2_avx512(_dest, _src, vectorizable_elements, total_elements);
+    break;
+  case 4:
+    unshuffle4_avx512(_dest, _src, vectorizable_elements, total_elements);
+    break;
+  case 8:
+    unshuffle8_avx512(_dest, _src, vectorizable_elements, total_elements);
+    break;
+  default:
+    /* For other type sizes, defer to the next-best implementation. */
+#if defined(__AVX2__)
+    blosc_internal_unshuffle_avx2(bytesoftype, blocksize, _src, _dest);
+#else
+    blosc_internal_unshuffle_generic(bytesoftype, blocksize, _src, _dest);
+#endif
+    /* The deferred-to function covers the whole buffer,
+       so we're done processing here. */
+    return;
+  }
+
+  /* If the buffer had any bytes at the end which couldn't be handled
+     by the vectorized implementations, use the non-optimized version
+     to finish them up. */
+  if (vectorizable_bytes < blocksize) {
+    unshuffle_generic_inline(bytesoftype, vectorizable_bytes, blocksize, _src, _dest);
+  }
+}
+
+#endif /* SHUFFLE_AVX512_ENABLED */
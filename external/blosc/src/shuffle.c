@@ -39,19 +39,37 @@ typedef unsigned char bool;
 #define HAVE_CPU_FEAT_INTRIN
 #endif
 
+/*  The SSE2/AVX2 kernels are compiled whenever the build targets those
+    instruction sets, so enable the corresponding dispatch paths from the
+    compiler's target macros. This vendored copy does not carry blosc's
+    accelerated bitshuffle kernels (TileDB uses its own bitshuffle
+    implementation), so every dispatch entry points at the scalar
+    bitshuffle stubs. */
+#if defined(__SSE2__)
+  #define SHUFFLE_SSE2_ENABLED
+#endif
+#if defined(__AVX2__)
+  #define SHUFFLE_AVX2_ENABLED
+#endif
+
 /*  Include hardware-accelerated shuffle/unshuffle routines based on
     the target architecture. Note that a target architecture may support
     more than one type of acceleration!*/
+
+/*  Defines SHUFFLE_AVX512_ENABLED when the toolchain can build the
+    AVX512 kernels; see shuffle-avx512.h. */
+#include "shuffle-avx512.h"
+
 #if defined(SHUFFLE_AVX2_ENABLED)
   #include "shuffle-avx2.h"
-  #include "bitshuffle-avx2.h"
 #endif  /* defined(SHUFFLE_AVX2_ENABLED) */
 
 #if defined(SHUFFLE_SSE2_ENABLED)
   #include "shuffle-sse2.h"
-  #include "bitshuffle-sse2.h"
 #endif  /* defined(SHUFFLE_SSE2_ENABLED) */
 
+#include "bitshuffle-generic.h"
+
 
 /*  Define function pointer types for shuffle/unshuffle routines. */
 typedef void(*shuffle_func)(const size_t, const size_t, const uint8_t*, const uint8_t*);
@@ -76,12 +94,13 @@ typedef struct shuffle_implementation {
 typedef enum {
   BLOSC_HAVE_NOTHING = 0,
   BLOSC_HAVE_SSE2 = 1,
-  BLOSC_HAVE_AVX2 = 2
+  BLOSC_HAVE_AVX2 = 2,
+  BLOSC_HAVE_AVX512 = 4
 } blosc_cpu_features;
 
 /*  Detect hardware and set function pointers to the best shuffle/unshuffle
     implementations supported by the host processor. */
-#if defined(SHUFFLE_AVX2_ENABLED) || defined(SHUFFLE_SSE2_ENABLED)    /* Intel/i686 */
+#if defined(SHUFFLE_AVX512_ENABLED) || defined(SHUFFLE_AVX2_ENABLED) || defined(SHUFFLE_SSE2_ENABLED)    /* Intel/i686 */
 
 /*  Disabled the __builtin_cpu_supports() call, as it has issues with
     new versions of gcc (like 5.3.1 in forthcoming ubuntu/xenial:
@@ -268,8 +287,9 @@ static blosc_cpu_features blosc_get_cpu_features(void) {
     ymm_state_enabled = (xcr0_contents & (1UL << 2)) != 0;
 
     /*  Require support for both the upper 256-bits of zmm0-zmm15 to be
-        restored as well as all of zmm16-zmm31 and the opmask registers. */
-    zmm_state_enabled = (xcr0_contents & 0x70) == 0x70;
+        restored as well as all of zmm16-zmm31 and the opmask registers
+        (XCR0 bits 5 through 7). */
+    zmm_state_enabled = (xcr0_contents & 0xe0) == 0xe0;
   }
 #endif /* defined(_XCR_XFEATURE_ENABLED_MASK) */
 
@@ -299,6 +319,10 @@ static blosc_cpu_features blosc_get_cpu_features(void) {
   if (xmm_state_enabled && ymm_state_enabled && avx2_available) {
     result |= BLOSC_HAVE_AVX2;
   }
+  if (xmm_state_enabled && ymm_state_enabled && zmm_state_enabled
+      && avx512bw_available) {
+    result |= BLOSC_HAVE_AVX512;
+  }
   return result;
 }
 #endif
@@ -320,14 +344,26 @@ static shuffle_implementation_t get_shuffle_implementation(void) {
   blosc_cpu_features cpu_features = blosc_get_cpu_features();
   shuffle_implementation_t impl_generic;
 
+#if defined(SHUFFLE_AVX512_ENABLED)
+  if (cpu_features & BLOSC_HAVE_AVX512) {
+    shuffle_implementation_t impl_avx512;
+    impl_avx512.name = "avx512";
+    impl_avx512.shuffle = (shuffle_func)blosc_internal_shuffle_avx512;
+    impl_avx512.unshuffle = (unshuffle_func)blosc_internal_unshuffle_avx512;
+    impl_avx512.bitshuffle = (bitshuffle_func)blosc_internal_bshuf_trans_bit_elem_scal;
+    impl_avx512.bitunshuffle = (bitunshuffle_func)blosc_internal_bshuf_untrans_bit_elem_scal;
+    return impl_avx512;
+  }
+#endif  /* defined(SHUFFLE_AVX512_ENABLED) */
+
 #if defined(SHUFFLE_AVX2_ENABLED)
   if (cpu_features & BLOSC_HAVE_AVX2) {
     shuffle_implementation_t impl_avx2;
     impl_avx2.name = "avx2";
     impl_avx2.shuffle = (shuffle_func)blosc_internal_shuffle_avx2;
     impl_avx2.unshuffle = (unshuffle_func)blosc_internal_unshuffle_avx2;
-    impl_avx2.bitshuffle = (bitshuffle_func)blosc_internal_bshuf_trans_bit_elem_avx2;
-    impl_avx2.bitunshuffle = (bitunshuffle_func)blosc_internal_bshuf_untrans_bit_elem_avx2;
+    impl_avx2.bitshuffle = (bitshuffle_func)blosc_internal_bshuf_trans_bit_elem_scal;
+    impl_avx2.bitunshuffle = (bitunshuffle_func)blosc_internal_bshuf_untrans_bit_elem_scal;
     return impl_avx2;
   }
 #endif  /* defined(SHUFFLE_AVX2_ENABLED) */
@@ -338,8 +374,8 @@ static shuffle_implementation_t get_shuffle_implementation(void) {
     impl_sse2.name = "sse2";
     impl_sse2.shuffle = (shuffle_func)blosc_internal_shuffle_sse2;
     impl_sse2.unshuffle = (unshuffle_func)blosc_internal_unshuffle_sse2;
-    impl_sse2.bitshuffle = (bitshuffle_func)blosc_internal_bshuf_trans_bit_elem_sse2;
-    impl_sse2.bitunshuffle = (bitunshuffle_func)blosc_internal_bshuf_untrans_bit_elem_sse2;
+    impl_sse2.bitshuffle = (bitshuffle_func)blosc_internal_bshuf_trans_bit_elem_scal;
+    impl_sse2.bitunshuffle = (bitunshuffle_func)blosc_internal_bshuf_untrans_bit_elem_scal;
     return impl_sse2;
   }
 #endif  /* defined(SHUFFLE_SSE2_ENABLED) */
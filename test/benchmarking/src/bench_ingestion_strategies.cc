@@ -0,0 +1,338 @@
+/**
+ * @file   bench_ingestion_strategies.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Benchmark the write path end to end across the writer strategies by
+ * replaying configurable fragment topologies: fragment count, cells per
+ * fragment, coordinate distribution and var-length value histograms.
+ * Each case is run against `mem://` (so the numbers measure the writers
+ * rather than disk I/O) and against local disk, reporting cells/sec per
+ * writer as one JSON line per case. Set TILEDB_BENCH_DUMP_STATS=1 to also
+ * print the internal stats dump after each case for per-phase breakdowns.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <random>
+
+#include <tiledb/tiledb>
+
+#include "benchmark.h"
+
+using namespace tiledb;
+
+class Benchmark : public BenchmarkBase {
+ protected:
+  virtual void setup() {
+  }
+
+  virtual void teardown() {
+    VFS vfs(ctx_);
+    if (vfs.is_dir(disk_dir_)) {
+      vfs.remove_dir(disk_dir_);
+    }
+  }
+
+  virtual void pre_run() {
+    VFS vfs(ctx_);
+    if (vfs.is_dir(disk_dir_)) {
+      vfs.remove_dir(disk_dir_);
+    }
+    vfs.create_dir(disk_dir_);
+
+    dump_stats_ = std::getenv("TILEDB_BENCH_DUMP_STATS") != nullptr;
+    if (dump_stats_) {
+      Stats::enable();
+    }
+  }
+
+  virtual void run() {
+    for (const auto& storage : storages_) {
+      for (const auto num_fragments : fragment_counts_) {
+        for (const auto& values : value_histograms_) {
+          // The global order writer requires coordinates sorted in global
+          // order; only the unordered writer replays shuffled coordinates.
+          time_sparse_write(
+              storage, num_fragments, values, "sequential", "global_order");
+          time_sparse_write(
+              storage, num_fragments, values, "sequential", "unordered");
+          time_sparse_write(
+              storage, num_fragments, values, "shuffled", "unordered");
+          time_dense_write(storage, num_fragments, values);
+        }
+      }
+    }
+  }
+
+ private:
+  std::string array_uri(const std::string& storage, const std::string& name)
+      const {
+    if (storage == "mem") {
+      return "mem://bench_ingestion_" + name;
+    }
+    return disk_dir_ + "/" + name;
+  }
+
+  /**
+   * Generates the var cell lengths for one fragment following the given
+   * histogram: "fixed" disables the var attribute, "var_uniform" draws
+   * short cells around the mean, "var_skewed" mixes short cells with an
+   * occasional long one (a genomics-style long tail).
+   */
+  std::vector<uint64_t> var_lengths(
+      const std::string& values, std::mt19937_64& rng) const {
+    std::vector<uint64_t> lengths(cells_per_fragment_);
+    if (values == "var_uniform") {
+      std::uniform_int_distribution<uint64_t> dist(4, 12);
+      for (auto& l : lengths) {
+        l = dist(rng);
+      }
+    } else if (values == "var_skewed") {
+      std::uniform_int_distribution<uint64_t> dist(4, 12);
+      std::uniform_int_distribution<uint64_t> tail(0, 99);
+      for (auto& l : lengths) {
+        l = tail(rng) == 0 ? 1024 : dist(rng);
+      }
+    }
+    return lengths;
+  }
+
+  /** Appends the var data/offsets for the given cell lengths. */
+  void fill_var_buffers(
+      const std::vector<uint64_t>& lengths,
+      std::vector<uint64_t>& offsets,
+      std::string& data) const {
+    offsets.resize(lengths.size());
+    uint64_t offset = 0;
+    for (uint64_t i = 0; i < lengths.size(); i++) {
+      offsets[i] = offset;
+      offset += lengths[i];
+    }
+    data.resize(offset);
+    std::fill(data.begin(), data.end(), 'x');
+  }
+
+  /**
+   * Writes `num_fragments` fragments of a 1D sparse array with the given
+   * coordinate distribution and value histogram, timing the whole batch
+   * and reporting cells/sec for the selected writer.
+   */
+  void time_sparse_write(
+      const std::string& storage,
+      unsigned num_fragments,
+      const std::string& values,
+      const std::string& coords,
+      const std::string& writer) {
+    const auto name = "sparse_" + writer + "_" + coords + "_" + values + "_f" +
+                      std::to_string(num_fragments);
+    const auto uri = array_uri(storage, name);
+
+    ArraySchema schema(ctx_, TILEDB_SPARSE);
+    Domain domain(ctx_);
+    domain.add_dimension(Dimension::create<uint64_t>(
+        ctx_, "d", {{1, max_coord_}}, tile_extent_));
+    schema.set_domain(domain);
+    schema.set_capacity(capacity_);
+    schema.set_allows_dups(true);
+    schema.add_attribute(Attribute::create<int32_t>(ctx_, "a"));
+    if (values != "fixed") {
+      schema.add_attribute(Attribute::create<std::string>(ctx_, "v"));
+    }
+    Array::create(uri, schema);
+
+    // Generate one fragment's buffers and replay them for every fragment;
+    // the coordinates are interleaved across fragments so the topology has
+    // overlapping non-empty domains like a real ingest.
+    std::mt19937_64 rng(0xdeadbeef);
+    std::vector<uint64_t> d(cells_per_fragment_);
+    std::vector<int32_t> a(cells_per_fragment_);
+    for (uint64_t i = 0; i < cells_per_fragment_; i++) {
+      d[i] = i * num_fragments + 1;
+      a[i] = static_cast<int32_t>(i);
+    }
+    if (coords == "shuffled") {
+      std::shuffle(d.begin(), d.end(), rng);
+    }
+    const auto lengths = var_lengths(values, rng);
+    std::vector<uint64_t> v_offsets;
+    std::string v_data;
+    if (values != "fixed") {
+      fill_var_buffers(lengths, v_offsets, v_data);
+    }
+
+    if (dump_stats_) {
+      Stats::reset();
+    }
+
+    const auto t0 = std::chrono::steady_clock::now();
+    for (unsigned f = 0; f < num_fragments; f++) {
+      Array array(ctx_, uri, TILEDB_WRITE);
+      Query query(ctx_, array);
+      query.set_layout(
+          writer == "global_order" ? TILEDB_GLOBAL_ORDER : TILEDB_UNORDERED);
+      query.set_data_buffer("d", d).set_data_buffer("a", a);
+      if (values != "fixed") {
+        query.set_data_buffer("v", v_data).set_offsets_buffer("v", v_offsets);
+      }
+      if (writer == "global_order") {
+        query.submit();
+        query.finalize();
+      } else {
+        query.submit();
+      }
+      array.close();
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+
+    report(storage, writer, coords, values, num_fragments, t0, t1);
+    remove_array(uri);
+  }
+
+  /**
+   * Writes `num_fragments` row-major slabs of a 2D dense array, timing the
+   * whole batch and reporting cells/sec for the ordered writer.
+   */
+  void time_dense_write(
+      const std::string& storage,
+      unsigned num_fragments,
+      const std::string& values) {
+    const auto name =
+        "dense_ordered_" + values + "_f" + std::to_string(num_fragments);
+    const auto uri = array_uri(storage, name);
+    const uint64_t rows_per_fragment = cells_per_fragment_ / dense_cols_;
+    const uint64_t rows = rows_per_fragment * num_fragments;
+
+    ArraySchema schema(ctx_, TILEDB_DENSE);
+    Domain domain(ctx_);
+    domain.add_dimension(
+        Dimension::create<uint64_t>(ctx_, "r", {{1, rows}}, dense_row_tile_));
+    domain.add_dimension(Dimension::create<uint64_t>(
+        ctx_, "c", {{1, dense_cols_}}, dense_cols_));
+    schema.set_domain(domain);
+    schema.add_attribute(Attribute::create<int32_t>(ctx_, "a"));
+    if (values != "fixed") {
+      schema.add_attribute(Attribute::create<std::string>(ctx_, "v"));
+    }
+    Array::create(uri, schema);
+
+    std::mt19937_64 rng(0xdeadbeef);
+    std::vector<int32_t> a(cells_per_fragment_);
+    std::iota(a.begin(), a.end(), 0);
+    const auto lengths = var_lengths(values, rng);
+    std::vector<uint64_t> v_offsets;
+    std::string v_data;
+    if (values != "fixed") {
+      fill_var_buffers(lengths, v_offsets, v_data);
+    }
+
+    if (dump_stats_) {
+      Stats::reset();
+    }
+
+    const auto t0 = std::chrono::steady_clock::now();
+    for (unsigned f = 0; f < num_fragments; f++) {
+      const std::array<uint64_t, 2> row_range = {
+          f * rows_per_fragment + 1, (f + 1) * rows_per_fragment};
+      const std::array<uint64_t, 2> col_range = {1, dense_cols_};
+
+      Array array(ctx_, uri, TILEDB_WRITE);
+      Query query(ctx_, array);
+      Subarray subarray(ctx_, array);
+      subarray.add_range(0, row_range[0], row_range[1])
+          .add_range(1, col_range[0], col_range[1]);
+      query.set_subarray(subarray)
+          .set_layout(TILEDB_ROW_MAJOR)
+          .set_data_buffer("a", a);
+      if (values != "fixed") {
+        query.set_data_buffer("v", v_data).set_offsets_buffer("v", v_offsets);
+      }
+      query.submit();
+      array.close();
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+
+    report(storage, "ordered", "row_major", values, num_fragments, t0, t1);
+    remove_array(uri);
+  }
+
+  /** Prints the JSON result line and, optionally, the stats breakdown. */
+  void report(
+      const std::string& storage,
+      const std::string& writer,
+      const std::string& coords,
+      const std::string& values,
+      unsigned num_fragments,
+      std::chrono::steady_clock::time_point t0,
+      std::chrono::steady_clock::time_point t1) {
+    const uint64_t total_cells = num_fragments * cells_per_fragment_;
+    const double sec = std::chrono::duration<double>(t1 - t0).count();
+    std::cout << "{ \"writer\": \"" << writer << "\", \"storage\": \""
+              << storage << "\", \"coords\": \"" << coords
+              << "\", \"values\": \"" << values
+              << "\", \"fragments\": " << num_fragments
+              << ", \"cells_per_fragment\": " << cells_per_fragment_
+              << ", \"cells_per_sec\": " << (total_cells / sec) << " }"
+              << std::endl;
+
+    if (dump_stats_) {
+      std::string stats;
+      Stats::dump(&stats);
+      std::cout << stats << std::endl;
+    }
+  }
+
+  void remove_array(const std::string& uri) {
+    VFS vfs(ctx_);
+    if (vfs.is_dir(uri)) {
+      vfs.remove_dir(uri);
+    }
+  }
+
+  const std::vector<std::string> storages_ = {"mem", "disk"};
+  const std::vector<unsigned> fragment_counts_ = {1, 8};
+  const std::vector<std::string> value_histograms_ = {
+      "fixed", "var_uniform", "var_skewed"};
+  const uint64_t cells_per_fragment_ = 1 << 18;
+  const uint64_t tile_extent_ = 65536;
+  const uint64_t max_coord_ = 1ULL << 40;
+  const unsigned capacity_ = 65536;
+  const uint64_t dense_cols_ = 4096;
+  const uint64_t dense_row_tile_ = 16;
+  const std::string disk_dir_ = "bench_ingestion_strategies_arrays";
+  bool dump_stats_ = false;
+
+  Context ctx_;
+};
+
+int main(int argc, char** argv) {
+  Benchmark bench;
+  return bench.main(argc, argv);
+}
@@ -0,0 +1,168 @@
+/**
+ * @file   bench_sparse_reader_strategies.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Benchmark the sparse reader strategies (global order and unordered with
+ * duplicates) in cells/sec across fragment counts, tile capacities and
+ * subarray selectivities. The arrays live on the in-memory filesystem so
+ * the numbers measure the readers rather than disk I/O. Because `mem://`
+ * arrays do not outlive the process, all arrays are created in `pre_run`
+ * and the per-configuration timings are printed from `run`.
+ */
+
+#include <array>
+#include <chrono>
+#include <iostream>
+
+#include <tiledb/tiledb>
+
+#include "benchmark.h"
+
+using namespace tiledb;
+
+class Benchmark : public BenchmarkBase {
+ protected:
+  virtual void setup() {
+  }
+
+  virtual void teardown() {
+  }
+
+  virtual void pre_run() {
+    // Create one array per (fragment count, capacity) combination. The
+    // fragments are interleaved coordinate-wise so that the global order
+    // reader has to merge across all of them.
+    for (const auto num_fragments : fragment_counts_) {
+      for (const auto capacity : capacities_) {
+        const auto uri = array_uri(num_fragments, capacity);
+
+        ArraySchema schema(ctx_, TILEDB_SPARSE);
+        Domain domain(ctx_);
+        domain.add_dimension(Dimension::create<uint64_t>(
+            ctx_, "d", {{1, max_coord_}}, tile_extent_));
+        schema.set_domain(domain);
+        schema.set_capacity(capacity);
+        schema.set_allows_dups(true);
+        schema.add_attribute(Attribute::create<int32_t>(ctx_, "a"));
+        Array::create(uri, schema);
+
+        std::vector<uint64_t> d(cells_per_fragment_);
+        std::vector<int32_t> a(cells_per_fragment_);
+        for (unsigned f = 0; f < num_fragments; f++) {
+          for (uint64_t i = 0; i < cells_per_fragment_; i++) {
+            d[i] = i * num_fragments + f + 1;
+            a[i] = static_cast<int32_t>(i);
+          }
+
+          Array array(ctx_, uri, TILEDB_WRITE);
+          Query query(ctx_, array);
+          query.set_layout(TILEDB_UNORDERED)
+              .set_data_buffer("a", a)
+              .set_data_buffer("d", d);
+          query.submit();
+          array.close();
+        }
+      }
+    }
+  }
+
+  virtual void run() {
+    for (const auto num_fragments : fragment_counts_) {
+      for (const auto capacity : capacities_) {
+        for (const auto selectivity : selectivities_) {
+          time_read(num_fragments, capacity, selectivity, TILEDB_GLOBAL_ORDER);
+          time_read(num_fragments, capacity, selectivity, TILEDB_UNORDERED);
+        }
+      }
+    }
+  }
+
+ private:
+  std::string array_uri(unsigned num_fragments, unsigned capacity) const {
+    return "mem://bench_sparse_reader_strategies_f" +
+           std::to_string(num_fragments) + "_c" + std::to_string(capacity);
+  }
+
+  /**
+   * Reads back the fraction `selectivity` of the populated domain of the
+   * given array with the reader strategy selected by `layout` and prints
+   * the achieved cells/sec.
+   */
+  void time_read(
+      unsigned num_fragments,
+      unsigned capacity,
+      double selectivity,
+      tiledb_layout_t layout) {
+    const uint64_t total_cells = num_fragments * cells_per_fragment_;
+    const auto expected_cells =
+        static_cast<uint64_t>(total_cells * selectivity);
+    std::vector<uint64_t> d(total_cells);
+    std::vector<int32_t> a(total_cells);
+    const std::array<uint64_t, 2> subarray = {
+        1, std::max<uint64_t>(1, expected_cells)};
+
+    const auto t0 = std::chrono::steady_clock::now();
+    Array array(ctx_, array_uri(num_fragments, capacity), TILEDB_READ);
+    Query query(ctx_, array);
+    query.set_subarray(Subarray(ctx_, array).set_subarray(subarray))
+        .set_layout(layout)
+        .set_data_buffer("a", a)
+        .set_data_buffer("d", d);
+    uint64_t cells_read = 0;
+    do {
+      query.submit();
+      cells_read += query.result_buffer_elements()["d"].second;
+    } while (query.query_status() == Query::Status::INCOMPLETE);
+    array.close();
+    const auto t1 = std::chrono::steady_clock::now();
+
+    const double sec = std::chrono::duration<double>(t1 - t0).count();
+    std::cout << "{ \"fragments\": " << num_fragments
+              << ", \"capacity\": " << capacity
+              << ", \"selectivity\": " << selectivity << ", \"layout\": \""
+              << (layout == TILEDB_GLOBAL_ORDER ? "global_order" :
+                                                  "unordered") << "\""
+              << ", \"cells\": " << cells_read
+              << ", \"cells_per_sec\": " << (cells_read / sec) << " }"
+              << std::endl;
+  }
+
+  const std::vector<unsigned> fragment_counts_ = {1, 4, 16};
+  const std::vector<unsigned> capacities_ = {1024, 65536};
+  const std::vector<double> selectivities_ = {0.01, 0.5, 1.0};
+  const uint64_t cells_per_fragment_ = 1 << 18;
+  const uint64_t tile_extent_ = 65536;
+  const uint64_t max_coord_ = 1u << 26;
+
+  Context ctx_;
+};
+
+int main(int argc, char** argv) {
+  Benchmark bench;
+  return bench.main(argc, argv);
+}
@@ -0,0 +1,118 @@
+/**
+ * @file   bench_synthetic_workloads.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Benchmark full reads of the standard synthetic workloads produced by
+ * the test support array generator. The same generator parameters are
+ * usable from `tiledb_unit`, so numbers measured here refer to
+ * reproducible arrays rather than hand-written fixtures.
+ */
+
+#include "test/support/src/array_generator.h"
+
+#include "benchmark.h"
+
+using namespace tiledb;
+using namespace tiledb::test;
+
+class Benchmark : public BenchmarkBase {
+ protected:
+  virtual void setup() {
+    ArrayGenerator::Params dense_params;
+    dense_params.seed = 1;
+    dense_params.dim_size = 4000000;
+    dense_params.tile_extent = 10000;
+    dense_params.fragment_num = 4;
+    dense_params.overlap = FragmentOverlap::DISJOINT;
+    dense_params.entropy = EntropyProfile::HIGH;
+    ArrayGenerator(ctx_, dense_params).generate_dense(dense_uri_);
+
+    ArrayGenerator::Params sparse_params;
+    sparse_params.seed = 2;
+    sparse_params.dim_num = 2;
+    sparse_params.dim_size = 10000;
+    sparse_params.tile_extent = 1000;
+    sparse_params.fragment_num = 8;
+    sparse_params.cells_per_fragment = 250000;
+    sparse_params.overlap = FragmentOverlap::HALF_OVERLAP;
+    sparse_params.entropy = EntropyProfile::LOW;
+    ArrayGenerator(ctx_, sparse_params).generate_sparse(sparse_uri_);
+  }
+
+  virtual void teardown() {
+    VFS vfs(ctx_);
+    for (const auto& uri : {dense_uri_, sparse_uri_}) {
+      if (vfs.is_dir(uri))
+        vfs.remove_dir(uri);
+    }
+  }
+
+  virtual void pre_run() {
+  }
+
+  virtual void run() {
+    // Full dense read.
+    {
+      Array array(ctx_, dense_uri_, TILEDB_READ);
+      std::vector<int64_t> data(4000000);
+      Subarray subarray(ctx_, array);
+      subarray.add_range(0, (int64_t)1, (int64_t)4000000);
+      Query query(ctx_, array, TILEDB_READ);
+      query.set_layout(TILEDB_ROW_MAJOR)
+          .set_subarray(subarray)
+          .set_data_buffer("a", data);
+      query.submit();
+      array.close();
+    }
+
+    // Full sparse read; the generated arrays allow duplicates, so the
+    // result size is exactly the number of generated cells.
+    {
+      Array array(ctx_, sparse_uri_, TILEDB_READ);
+      const uint64_t cells = 8 * 250000;
+      std::vector<int64_t> d0(cells), d1(cells), data(cells);
+      Query query(ctx_, array, TILEDB_READ);
+      query.set_layout(TILEDB_UNORDERED)
+          .set_data_buffer("d0", d0)
+          .set_data_buffer("d1", d1)
+          .set_data_buffer("a", data);
+      query.submit();
+      array.close();
+    }
+  }
+
+ private:
+  const std::string dense_uri_ = "bench_synthetic_dense";
+  const std::string sparse_uri_ = "bench_synthetic_sparse";
+  Context ctx_;
+};
+
+int main(int argc, char** argv) {
+  Benchmark bench;
+  return bench.main(argc, argv);
+}
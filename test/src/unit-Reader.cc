@@ -313,3 +313,101 @@ TEST_CASE_METHOD(
   CHECK(result_space_tiles[(const int32_t*)&(tile_coords[4][0])] == rst_3_0);
   CHECK(result_space_tiles[(const int32_t*)&(tile_coords[5][0])] == rst_3_2);
 }
+
+TEST_CASE_METHOD(
+    ReaderFx,
+    "Reader: Compute result space tiles, 2D, jointly covered fragment",
+    "[Reader][2d][compute_result_space_tiles]") {
+  unsigned dim_num = 2;
+  auto size = 2 * sizeof(int32_t);
+  int32_t domain_vec[] = {1, 10, 1, 15};
+  NDRange domain = {Range(&domain_vec[0], size), Range(&domain_vec[2], size)};
+  std::vector<int32_t> tile_extents_vec = {2, 5};
+  std::vector<ByteVecValue> tile_extents(2);
+  tile_extents[0].assign_as<int32_t>(tile_extents_vec[0]);
+  tile_extents[1].assign_as<int32_t>(tile_extents_vec[1]);
+  Layout layout = Layout::ROW_MAJOR;
+
+  // A single tile, covering rows 3-4 and columns 1-5
+  int32_t tile_coords_1_0[] = {1, 0};
+  std::vector<uint8_t> tile_coords_el;
+  size_t coords_size = dim_num * sizeof(int32_t);
+  tile_coords_el.resize(coords_size);
+  std::vector<std::vector<uint8_t>> tile_coords;
+  std::memcpy(&tile_coords_el[0], &tile_coords_1_0[0], coords_size);
+  tile_coords.push_back(tile_coords_el);
+
+  // Fragment #1 (oldest) writes the whole tile; fragments #2 and #3 each
+  // overwrite one row of it, so together they cover it completely even
+  // though neither does so alone.
+  std::vector<int32_t> domain_slice_1 = {3, 4, 1, 5};
+  std::vector<int32_t> domain_slice_2 = {4, 4, 1, 5};
+  std::vector<int32_t> domain_slice_3 = {3, 3, 1, 5};
+
+  NDRange ds1 = {
+      Range(&domain_slice_1[0], size), Range(&domain_slice_1[2], size)};
+  NDRange ds2 = {
+      Range(&domain_slice_2[0], size), Range(&domain_slice_2[2], size)};
+  NDRange ds3 = {
+      Range(&domain_slice_3[0], size), Range(&domain_slice_3[2], size)};
+  NDRange dsd = domain;
+
+  std::vector<TileDomain<int32_t>> frag_tile_domains;
+  frag_tile_domains.emplace_back(
+      TileDomain<int32_t>(3, domain, ds3, tile_extents, layout));
+  frag_tile_domains.emplace_back(
+      TileDomain<int32_t>(2, domain, ds2, tile_extents, layout));
+  frag_tile_domains.emplace_back(
+      TileDomain<int32_t>(1, domain, ds1, tile_extents, layout));
+  TileDomain<int32_t> array_tile_domain(
+      UINT32_MAX, domain, dsd, tile_extents, layout);
+
+  auto d1{make_shared<Dimension>(HERE(), "d1", Datatype::INT32)};
+  CHECK(d1->set_domain(domain_vec).ok());
+  CHECK(d1->set_tile_extent(&tile_extents_vec[0]).ok());
+  auto d2{make_shared<Dimension>(HERE(), "d2", Datatype::INT32)};
+  CHECK(d2->set_domain(&domain_vec[2]).ok());
+  CHECK(d2->set_tile_extent(&tile_extents_vec[1]).ok());
+  auto dom{make_shared<Domain>(HERE())};
+  CHECK(dom->add_dimension(d1).ok());
+  CHECK(dom->add_dimension(d2).ok());
+
+  auto schema = make_shared<ArraySchema>(HERE());
+  CHECK(schema->set_domain(dom).ok());
+
+  std::vector<shared_ptr<FragmentMetadata>> fragments;
+  for (uint64_t i = 0; i < frag_tile_domains.size() + 1; i++) {
+    shared_ptr<FragmentMetadata> fragment = make_shared<FragmentMetadata>(
+        HERE(),
+        nullptr,
+        nullptr,
+        schema,
+        URI(),
+        std::make_pair<uint64_t, uint64_t>(0, 0),
+        true);
+    fragments.emplace_back(std::move(fragment));
+  }
+
+  // Compute result space tiles map
+  std::map<const int32_t*, ResultSpaceTile<int32_t>> result_space_tiles;
+  Reader::compute_result_space_tiles<int32_t>(
+      fragments,
+      tile_coords,
+      array_tile_domain,
+      frag_tile_domains,
+      result_space_tiles);
+  CHECK(result_space_tiles.size() == 1);
+
+  // Fragment #1 must be excluded from the space tile, as fragments #2
+  // and #3 jointly overwrite it.
+  ResultTile result_tile_1_0_2(2, 0, *fragments[1]);
+  ResultTile result_tile_1_0_3(3, 0, *fragments[2]);
+
+  ResultSpaceTile<int32_t> rst_1_0;
+  rst_1_0.set_start_coords({3, 1});
+  rst_1_0.append_frag_domain(3, ds3);
+  rst_1_0.append_frag_domain(2, ds2);
+  rst_1_0.set_result_tile(2, result_tile_1_0_2);
+  rst_1_0.set_result_tile(3, result_tile_1_0_3);
+  CHECK(result_space_tiles[(const int32_t*)&(tile_coords[0][0])] == rst_1_0);
+}
@@ -0,0 +1,145 @@
+/**
+ * @file   unit-array-generator.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Tests the deterministic synthetic array generator.
+ */
+
+#include "test/support/src/array_generator.h"
+#include "test/support/tdb_catch.h"
+
+using namespace tiledb;
+using namespace tiledb::test;
+
+namespace {
+
+/** Reads back the full attribute data of a generated dense array. */
+std::vector<int64_t> read_dense(const Context& ctx, const std::string& uri) {
+  Array array(ctx, uri, TILEDB_READ);
+  auto dim = array.schema().domain().dimension(0);
+  auto dom = dim.domain<int64_t>();
+  std::vector<int64_t> data(dom.second - dom.first + 1);
+
+  Subarray subarray(ctx, array);
+  subarray.add_range(0, dom.first, dom.second);
+  Query query(ctx, array, TILEDB_READ);
+  query.set_layout(TILEDB_ROW_MAJOR)
+      .set_subarray(subarray)
+      .set_data_buffer("a", data);
+  query.submit();
+  REQUIRE(query.query_status() == Query::Status::COMPLETE);
+  array.close();
+
+  return data;
+}
+
+}  // namespace
+
+TEST_CASE(
+    "Array generator: dense determinism",
+    "[array-generator][dense]") {
+  Context ctx;
+  VFS vfs(ctx);
+  const std::string uri_1 = "array_generator_dense_1";
+  const std::string uri_2 = "array_generator_dense_2";
+  for (const auto& uri : {uri_1, uri_2}) {
+    if (vfs.is_dir(uri))
+      vfs.remove_dir(uri);
+  }
+
+  ArrayGenerator::Params params;
+  params.seed = 42;
+  params.dim_size = 100;
+  params.tile_extent = 10;
+  params.fragment_num = 4;
+  params.entropy = EntropyProfile::HIGH;
+
+  // Equal parameters must generate identical arrays.
+  ArrayGenerator(ctx, params).generate_dense(uri_1);
+  ArrayGenerator(ctx, params).generate_dense(uri_2);
+  auto data_1 = read_dense(ctx, uri_1);
+  auto data_2 = read_dense(ctx, uri_2);
+  CHECK(data_1 == data_2);
+
+  // A different seed must generate different data.
+  params.seed = 43;
+  vfs.remove_dir(uri_2);
+  ArrayGenerator(ctx, params).generate_dense(uri_2);
+  CHECK(data_1 != read_dense(ctx, uri_2));
+
+  for (const auto& uri : {uri_1, uri_2}) {
+    if (vfs.is_dir(uri))
+      vfs.remove_dir(uri);
+  }
+}
+
+TEST_CASE(
+    "Array generator: sparse fragments and overlap",
+    "[array-generator][sparse]") {
+  Context ctx;
+  VFS vfs(ctx);
+  const std::string uri = "array_generator_sparse";
+  if (vfs.is_dir(uri))
+    vfs.remove_dir(uri);
+
+  ArrayGenerator::Params params;
+  params.seed = 7;
+  params.dim_num = 2;
+  params.dim_size = 100;
+  params.tile_extent = 10;
+  params.fragment_num = 4;
+  params.cells_per_fragment = 50;
+  params.overlap = FragmentOverlap::DISJOINT;
+  params.entropy = EntropyProfile::LOW;
+  ArrayGenerator(ctx, params).generate_sparse(uri);
+
+  // One fragment per write.
+  FragmentInfo fragment_info(ctx, uri);
+  fragment_info.load();
+  CHECK(fragment_info.fragment_num() == 4);
+
+  // All cells are read back and the low entropy profile holds.
+  Array array(ctx, uri, TILEDB_READ);
+  std::vector<int64_t> d0(200), d1(200), a(200);
+  Query query(ctx, array, TILEDB_READ);
+  query.set_layout(TILEDB_UNORDERED)
+      .set_data_buffer("d0", d0)
+      .set_data_buffer("d1", d1)
+      .set_data_buffer("a", a);
+  query.submit();
+  REQUIRE(query.query_status() == Query::Status::COMPLETE);
+  CHECK(query.result_buffer_elements()["a"].second == 200);
+  for (auto v : a) {
+    CHECK(v >= 0);
+    CHECK(v < 16);
+  }
+  array.close();
+
+  if (vfs.is_dir(uri))
+    vfs.remove_dir(uri);
+}
@@ -48,6 +48,7 @@
 #include "tiledb/api/c_api/context/context_api_internal.h"
 #include "tiledb/common/stdx_string.h"
 #include "tiledb/sm/c_api/tiledb.h"
+#include "tiledb/sm/c_api/tiledb_experimental.h"
 #include "tiledb/sm/c_api/tiledb_serialization.h"
 #include "tiledb/sm/c_api/tiledb_struct_def.h"
 #include "tiledb/sm/cpp_api/tiledb"
@@ -476,6 +477,77 @@ TEST_CASE_METHOD(
   tiledb_array_free(&array);
 }
 
+TEST_CASE_METHOD(
+    ArrayFx, "C API: Test array prefetch", "[capi][array][prefetch]") {
+  SupportedFsLocal local_fs;
+  std::string array_name =
+      local_fs.file_prefix() + local_fs.temp_dir() + "array_prefetch";
+  create_temp_dir(local_fs.file_prefix() + local_fs.temp_dir());
+  create_dense_vector(array_name);
+
+  tiledb_array_t* array;
+  int rc = tiledb_array_alloc(ctx_, array_name.c_str(), &array);
+  REQUIRE(rc == TILEDB_OK);
+  write_fragment(array, 1);
+
+  // Prefetching a closed array must fail
+  rc = tiledb_array_prefetch(ctx_, array, nullptr, 0, 1024 * 1024);
+  CHECK(rc == TILEDB_ERR);
+
+  // Prefetching an array opened for writes must fail
+  rc = tiledb_array_open(ctx_, array, TILEDB_WRITE);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_array_prefetch(ctx_, array, nullptr, 0, 1024 * 1024);
+  CHECK(rc == TILEDB_ERR);
+  rc = tiledb_array_close(ctx_, array);
+  REQUIRE(rc == TILEDB_OK);
+
+  // Open for reads and stage the full vector
+  rc = tiledb_array_open(ctx_, array, TILEDB_READ);
+  REQUIRE(rc == TILEDB_OK);
+  tiledb_subarray_t* subarray;
+  rc = tiledb_subarray_alloc(ctx_, array, &subarray);
+  REQUIRE(rc == TILEDB_OK);
+  int64_t range[] = {1, 10};
+  rc = tiledb_subarray_set_subarray(ctx_, subarray, range);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_array_prefetch(ctx_, array, &subarray, 1, 1024 * 1024);
+  CHECK(rc == TILEDB_OK);
+
+  // A tiny budget truncates the planned regions but still succeeds
+  rc = tiledb_array_prefetch(ctx_, array, &subarray, 1, 1);
+  CHECK(rc == TILEDB_OK);
+
+  // No subarrays is a no-op; a null list with a nonzero count is an error
+  rc = tiledb_array_prefetch(ctx_, array, nullptr, 0, 1024 * 1024);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_array_prefetch(ctx_, array, nullptr, 1, 1024 * 1024);
+  CHECK(rc == TILEDB_ERR);
+
+  // Reads over the prefetched region still return the written data
+  int buffer[10] = {0};
+  uint64_t buffer_size = sizeof(buffer);
+  tiledb_query_t* query;
+  rc = tiledb_query_alloc(ctx_, array, TILEDB_READ, &query);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_set_subarray_t(ctx_, query, subarray);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_set_data_buffer(ctx_, query, "a", buffer, &buffer_size);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_submit(ctx_, query);
+  REQUIRE(rc == TILEDB_OK);
+  for (int i = 0; i < 10; i++)
+    CHECK(buffer[i] == i + 1);
+
+  // Clean up
+  rc = tiledb_array_close(ctx_, array);
+  REQUIRE(rc == TILEDB_OK);
+  tiledb_query_free(&query);
+  tiledb_subarray_free(&subarray);
+  tiledb_array_free(&array);
+  remove_temp_dir(local_fs.file_prefix() + local_fs.temp_dir());
+}
+
 TEST_CASE_METHOD(
     ArrayFx, "C API: Test array with encryption", "[capi][array][encryption]") {
   // Create array schema
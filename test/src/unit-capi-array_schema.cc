@@ -904,7 +904,9 @@ void ArraySchemaFx::load_and_check_array_schema(const std::string& path) {
       "- Allows duplicates: " +
       "false\n"
       "- Coordinates filters: 1\n" +
-      "  > ZSTD: COMPRESSION_LEVEL=-1\n" + "- Offsets filters: 1\n" +
+      "  > ZSTD: COMPRESSION_LEVEL=-1\n" + "- Offsets filters: 3\n" +
+      "  > PositiveDelta: POSITIVE_DELTA_MAX_WINDOW=1024\n" +
+      "  > BitWidthReduction: BIT_WIDTH_MAX_WINDOW=256\n" +
       "  > ZSTD: COMPRESSION_LEVEL=-1\n" + "- Validity filters: 1\n" +
       "  > RLE: COMPRESSION_LEVEL=-1\n\n" + "### Dimension ###\n" +
       "- Name: " + DIM1_NAME + "\n" + "- Type: INT64\n" +
@@ -0,0 +1,499 @@
+/**
+ * @file   unit-capi-arrow.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Tests the C API Arrow C Data Interface import/export.
+ */
+
+#include <test/support/tdb_catch.h>
+#include "test/support/src/helpers.h"
+#include "tiledb/sm/c_api/tiledb.h"
+#include "tiledb/sm/c_api/tiledb_experimental.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace tiledb::test;
+
+namespace {
+
+/*
+ * Local definitions of the Arrow C Data Interface structs; the interface
+ * is a stable ABI, so a consumer does not need the Arrow library. See
+ * https://arrow.apache.org/docs/format/CDataInterface.html.
+ */
+struct ArrowSchema {
+  const char* format;
+  const char* name;
+  const char* metadata;
+  int64_t flags;
+  int64_t n_children;
+  struct ArrowSchema** children;
+  struct ArrowSchema* dictionary;
+  void (*release)(struct ArrowSchema*);
+  void* private_data;
+};
+
+struct ArrowArray {
+  int64_t length;
+  int64_t null_count;
+  int64_t offset;
+  int64_t n_buffers;
+  int64_t n_children;
+  const void** buffers;
+  struct ArrowArray** children;
+  struct ArrowArray* dictionary;
+  void (*release)(struct ArrowArray*);
+  void* private_data;
+};
+
+/** Set by `producer_release_array` when a producer array is released. */
+bool g_producer_array_released = false;
+
+/** Set by `producer_release_schema` when a producer schema is released. */
+bool g_producer_schema_released = false;
+
+void producer_release_array(struct ArrowArray* array) {
+  g_producer_array_released = true;
+  array->release = nullptr;
+}
+
+void producer_release_schema(struct ArrowSchema* schema) {
+  g_producer_schema_released = true;
+  schema->release = nullptr;
+}
+
+}  // namespace
+
+/** Tests for the C API Arrow buffer import/export. */
+struct ArrowCApiFx {
+  // Constants
+  const char* ARRAY_NAME = "test_capi_arrow";
+  const char* ARRAY_NAME_2 = "test_capi_arrow_2";
+
+  // TileDB context
+  tiledb_ctx_t* ctx_;
+
+  // Constructors/destructors
+  ArrowCApiFx();
+  ~ArrowCApiFx();
+
+  // Functions
+  void create_array(const char* array_name);
+  void write_array(const char* array_name);
+  tiledb_config_t* alloc_extra_offset_config();
+  void remove_array(const std::string& array_name);
+};
+
+ArrowCApiFx::ArrowCApiFx() {
+  ctx_ = nullptr;
+  REQUIRE(tiledb_ctx_alloc(NULL, &ctx_) == TILEDB_OK);
+  remove_array(ARRAY_NAME);
+  remove_array(ARRAY_NAME_2);
+}
+
+ArrowCApiFx::~ArrowCApiFx() {
+  remove_array(ARRAY_NAME);
+  remove_array(ARRAY_NAME_2);
+  tiledb_ctx_free(&ctx_);
+}
+
+void ArrowCApiFx::create_array(const char* array_name) {
+  // Create dimension and domain
+  uint64_t dim_domain[] = {1, 10};
+  uint64_t tile_extent = 10;
+  tiledb_dimension_t* d;
+  int rc = tiledb_dimension_alloc(
+      ctx_, "d", TILEDB_UINT64, dim_domain, &tile_extent, &d);
+  REQUIRE(rc == TILEDB_OK);
+  tiledb_domain_t* domain;
+  rc = tiledb_domain_alloc(ctx_, &domain);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_domain_add_dimension(ctx_, domain, d);
+  REQUIRE(rc == TILEDB_OK);
+
+  // Create attributes: fixed, var-sized and nullable
+  tiledb_attribute_t* a;
+  rc = tiledb_attribute_alloc(ctx_, "a", TILEDB_INT32, &a);
+  REQUIRE(rc == TILEDB_OK);
+  tiledb_attribute_t* b;
+  rc = tiledb_attribute_alloc(ctx_, "b", TILEDB_STRING_ASCII, &b);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_attribute_set_cell_val_num(ctx_, b, TILEDB_VAR_NUM);
+  REQUIRE(rc == TILEDB_OK);
+  tiledb_attribute_t* c;
+  rc = tiledb_attribute_alloc(ctx_, "c", TILEDB_INT32, &c);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_attribute_set_nullable(ctx_, c, 1);
+  REQUIRE(rc == TILEDB_OK);
+
+  // Create array schema
+  tiledb_array_schema_t* array_schema;
+  rc = tiledb_array_schema_alloc(ctx_, TILEDB_DENSE, &array_schema);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_array_schema_set_domain(ctx_, array_schema, domain);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_array_schema_add_attribute(ctx_, array_schema, a);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_array_schema_add_attribute(ctx_, array_schema, b);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_array_schema_add_attribute(ctx_, array_schema, c);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_array_schema_check(ctx_, array_schema);
+  REQUIRE(rc == TILEDB_OK);
+
+  // Create array
+  rc = tiledb_array_create(ctx_, array_name, array_schema);
+  REQUIRE(rc == TILEDB_OK);
+
+  // Clean up
+  tiledb_attribute_free(&a);
+  tiledb_attribute_free(&b);
+  tiledb_attribute_free(&c);
+  tiledb_dimension_free(&d);
+  tiledb_domain_free(&domain);
+  tiledb_array_schema_free(&array_schema);
+}
+
+void ArrowCApiFx::write_array(const char* array_name) {
+  // Buffers
+  int32_t a[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  uint64_t a_size = sizeof(a);
+  char b_val[] = "abbcccabbcccabbcccab";
+  uint64_t b_val_size = 20;
+  uint64_t b_off[] = {0, 1, 3, 6, 7, 9, 12, 13, 15, 18};
+  uint64_t b_off_size = sizeof(b_off);
+  int32_t c[] = {100, 101, 102, 103, 104, 105, 106, 107, 108, 109};
+  uint64_t c_size = sizeof(c);
+  uint8_t c_validity[] = {1, 1, 0, 1, 1, 1, 0, 1, 1, 1};
+  uint64_t c_validity_size = sizeof(c_validity);
+
+  // Open array
+  tiledb_array_t* array;
+  int rc = tiledb_array_alloc(ctx_, array_name, &array);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_array_open(ctx_, array, TILEDB_WRITE);
+  REQUIRE(rc == TILEDB_OK);
+
+  // Write
+  tiledb_query_t* query;
+  rc = tiledb_query_alloc(ctx_, array, TILEDB_WRITE, &query);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_set_data_buffer(ctx_, query, "a", a, &a_size);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_set_data_buffer(ctx_, query, "b", b_val, &b_val_size);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_set_offsets_buffer(ctx_, query, "b", b_off, &b_off_size);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_set_data_buffer(ctx_, query, "c", c, &c_size);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_set_validity_buffer(
+      ctx_, query, "c", c_validity, &c_validity_size);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_submit(ctx_, query);
+  REQUIRE(rc == TILEDB_OK);
+
+  // Clean up
+  rc = tiledb_array_close(ctx_, array);
+  REQUIRE(rc == TILEDB_OK);
+  tiledb_query_free(&query);
+  tiledb_array_free(&array);
+}
+
+tiledb_config_t* ArrowCApiFx::alloc_extra_offset_config() {
+  // Arrow var-length layouts need `n + 1` offsets for `n` cells
+  tiledb_config_t* config;
+  tiledb_error_t* error = nullptr;
+  int rc = tiledb_config_alloc(&config, &error);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_config_set(
+      config, "sm.var_offsets.extra_element", "true", &error);
+  REQUIRE(rc == TILEDB_OK);
+  return config;
+}
+
+void ArrowCApiFx::remove_array(const std::string& array_name) {
+  tiledb_object_t type;
+  int rc = tiledb_object_type(ctx_, array_name.c_str(), &type);
+  REQUIRE(rc == TILEDB_OK);
+  if (type == TILEDB_ARRAY) {
+    rc = tiledb_object_remove(ctx_, array_name.c_str());
+    REQUIRE(rc == TILEDB_OK);
+  }
+}
+
+TEST_CASE_METHOD(
+    ArrowCApiFx,
+    "C API: Arrow buffer export/import round-trip",
+    "[capi][arrow][round-trip]") {
+  create_array(ARRAY_NAME);
+  write_array(ARRAY_NAME);
+  create_array(ARRAY_NAME_2);
+
+  // Read the first array back
+  tiledb_array_t* array;
+  int rc = tiledb_array_alloc(ctx_, ARRAY_NAME, &array);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_array_open(ctx_, array, TILEDB_READ);
+  REQUIRE(rc == TILEDB_OK);
+
+  std::vector<int32_t> a(10);
+  uint64_t a_size = a.size() * sizeof(int32_t);
+  std::vector<char> b_val(64);
+  uint64_t b_val_size = b_val.size();
+  std::vector<uint64_t> b_off(11);
+  uint64_t b_off_size = b_off.size() * sizeof(uint64_t);
+  std::vector<int32_t> c(10);
+  uint64_t c_size = c.size() * sizeof(int32_t);
+  std::vector<uint8_t> c_validity(10);
+  uint64_t c_validity_size = c_validity.size();
+  uint64_t subarray[] = {1, 10};
+
+  tiledb_config_t* config = alloc_extra_offset_config();
+  tiledb_query_t* query;
+  rc = tiledb_query_alloc(ctx_, array, TILEDB_READ, &query);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_set_config(ctx_, query, config);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_set_subarray(ctx_, query, subarray);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_set_data_buffer(ctx_, query, "a", a.data(), &a_size);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_set_data_buffer(
+      ctx_, query, "b", b_val.data(), &b_val_size);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_set_offsets_buffer(
+      ctx_, query, "b", b_off.data(), &b_off_size);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_set_data_buffer(ctx_, query, "c", c.data(), &c_size);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_set_validity_buffer(
+      ctx_, query, "c", c_validity.data(), &c_validity_size);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_submit(ctx_, query);
+  REQUIRE(rc == TILEDB_OK);
+  tiledb_query_status_t status;
+  rc = tiledb_query_get_status(ctx_, query, &status);
+  REQUIRE(rc == TILEDB_OK);
+  REQUIRE(status == TILEDB_COMPLETED);
+
+  // Export the fixed-sized field; the buffers are shared, not copied
+  ArrowArray arrow_a;
+  ArrowSchema schema_a;
+  rc = tiledb_query_export_arrow_buffer(
+      ctx_, query, "a", &arrow_a, &schema_a);
+  REQUIRE(rc == TILEDB_OK);
+  CHECK(std::string(schema_a.format) == "i");
+  CHECK(std::string(schema_a.name) == "a");
+  CHECK(arrow_a.length == 10);
+  CHECK(arrow_a.null_count == 0);
+  CHECK(arrow_a.n_buffers == 2);
+  CHECK(arrow_a.buffers[0] == nullptr);
+  CHECK(arrow_a.buffers[1] == a.data());
+
+  // Export the var-sized field
+  ArrowArray arrow_b;
+  ArrowSchema schema_b;
+  rc = tiledb_query_export_arrow_buffer(
+      ctx_, query, "b", &arrow_b, &schema_b);
+  REQUIRE(rc == TILEDB_OK);
+  CHECK(std::string(schema_b.format) == "U");
+  CHECK(std::string(schema_b.name) == "b");
+  CHECK(arrow_b.length == 10);
+  CHECK(arrow_b.n_buffers == 3);
+  CHECK(arrow_b.buffers[0] == nullptr);
+  CHECK(arrow_b.buffers[1] == b_off.data());
+  CHECK(arrow_b.buffers[2] == b_val.data());
+
+  // Nullable fields have no zero-copy Arrow representation
+  ArrowArray arrow_c;
+  ArrowSchema schema_c;
+  rc = tiledb_query_export_arrow_buffer(
+      ctx_, query, "c", &arrow_c, &schema_c);
+  CHECK(rc == TILEDB_ERR);
+
+  // Releasing an export frees only the bookkeeping and resets `release`
+  ArrowArray arrow_tmp;
+  ArrowSchema schema_tmp;
+  rc = tiledb_query_export_arrow_buffer(
+      ctx_, query, "a", &arrow_tmp, &schema_tmp);
+  REQUIRE(rc == TILEDB_OK);
+  arrow_tmp.release(&arrow_tmp);
+  schema_tmp.release(&schema_tmp);
+  CHECK(arrow_tmp.release == nullptr);
+  CHECK(schema_tmp.release == nullptr);
+  CHECK(a[0] == 1);
+
+  // Import the exported fields into a write query on the second array
+  tiledb_array_t* array_2;
+  rc = tiledb_array_alloc(ctx_, ARRAY_NAME_2, &array_2);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_array_open(ctx_, array_2, TILEDB_WRITE);
+  REQUIRE(rc == TILEDB_OK);
+  tiledb_query_t* query_2;
+  rc = tiledb_query_alloc(ctx_, array_2, TILEDB_WRITE, &query_2);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_set_config(ctx_, query_2, config);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_set_subarray(ctx_, query_2, subarray);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_import_arrow_buffer(
+      ctx_, query_2, "a", &arrow_a, &schema_a);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_import_arrow_buffer(
+      ctx_, query_2, "b", &arrow_b, &schema_b);
+  REQUIRE(rc == TILEDB_OK);
+
+  // The import takes ownership: the array is moved out and the schema
+  // is released
+  CHECK(arrow_a.release == nullptr);
+  CHECK(schema_a.release == nullptr);
+  CHECK(arrow_b.release == nullptr);
+  CHECK(schema_b.release == nullptr);
+
+  // The nullable field is written with plain buffers
+  rc = tiledb_query_set_data_buffer(ctx_, query_2, "c", c.data(), &c_size);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_set_validity_buffer(
+      ctx_, query_2, "c", c_validity.data(), &c_validity_size);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_submit(ctx_, query_2);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_array_close(ctx_, array_2);
+  REQUIRE(rc == TILEDB_OK);
+  tiledb_query_free(&query_2);
+  tiledb_array_free(&array_2);
+
+  // Read the second array back and compare with the first
+  rc = tiledb_array_alloc(ctx_, ARRAY_NAME_2, &array_2);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_array_open(ctx_, array_2, TILEDB_READ);
+  REQUIRE(rc == TILEDB_OK);
+  std::vector<int32_t> a_2(10);
+  uint64_t a_2_size = a_2.size() * sizeof(int32_t);
+  std::vector<char> b_val_2(64);
+  uint64_t b_val_2_size = b_val_2.size();
+  std::vector<uint64_t> b_off_2(10);
+  uint64_t b_off_2_size = b_off_2.size() * sizeof(uint64_t);
+  rc = tiledb_query_alloc(ctx_, array_2, TILEDB_READ, &query_2);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_set_subarray(ctx_, query_2, subarray);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_set_data_buffer(
+      ctx_, query_2, "a", a_2.data(), &a_2_size);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_set_data_buffer(
+      ctx_, query_2, "b", b_val_2.data(), &b_val_2_size);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_set_offsets_buffer(
+      ctx_, query_2, "b", b_off_2.data(), &b_off_2_size);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_submit(ctx_, query_2);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_get_status(ctx_, query_2, &status);
+  REQUIRE(rc == TILEDB_OK);
+  REQUIRE(status == TILEDB_COMPLETED);
+
+  for (int i = 0; i < 10; i++)
+    CHECK(a_2[i] == i + 1);
+  CHECK(b_val_2_size == 20);
+  CHECK(std::memcmp(b_val_2.data(), "abbcccabbcccabbcccab", 20) == 0);
+  for (int i = 0; i < 10; i++)
+    CHECK(b_off_2[i] == b_off[i]);
+
+  // Clean up
+  rc = tiledb_array_close(ctx_, array_2);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_array_close(ctx_, array);
+  REQUIRE(rc == TILEDB_OK);
+  tiledb_query_free(&query_2);
+  tiledb_query_free(&query);
+  tiledb_array_free(&array_2);
+  tiledb_array_free(&array);
+  tiledb_config_free(&config);
+}
+
+TEST_CASE_METHOD(
+    ArrowCApiFx,
+    "C API: Arrow buffer import errors and ownership",
+    "[capi][arrow][import]") {
+  create_array(ARRAY_NAME);
+
+  tiledb_array_t* array;
+  int rc = tiledb_array_alloc(ctx_, ARRAY_NAME, &array);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_array_open(ctx_, array, TILEDB_WRITE);
+  REQUIRE(rc == TILEDB_OK);
+  tiledb_query_t* query;
+  rc = tiledb_query_alloc(ctx_, array, TILEDB_WRITE, &query);
+  REQUIRE(rc == TILEDB_OK);
+
+  // A producer-built int32 array
+  static int32_t data[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  const void* buffers[] = {nullptr, data};
+  ArrowArray arrow = {};
+  arrow.length = 10;
+  arrow.n_buffers = 2;
+  arrow.buffers = buffers;
+  arrow.release = producer_release_array;
+  ArrowSchema schema = {};
+  schema.format = "i";
+  schema.name = "a";
+  schema.release = producer_release_schema;
+  g_producer_array_released = false;
+  g_producer_schema_released = false;
+
+  // The format must match the target field
+  rc = tiledb_query_import_arrow_buffer(ctx_, query, "b", &arrow, &schema);
+  CHECK(rc == TILEDB_ERR);
+
+  // Nullable fields are rejected
+  rc = tiledb_query_import_arrow_buffer(ctx_, query, "c", &arrow, &schema);
+  CHECK(rc == TILEDB_ERR);
+
+  // A successful import consumes the schema but not the producer's data
+  rc = tiledb_query_import_arrow_buffer(ctx_, query, "a", &arrow, &schema);
+  REQUIRE(rc == TILEDB_OK);
+  CHECK(arrow.release == nullptr);
+  CHECK(g_producer_schema_released);
+  CHECK(!g_producer_array_released);
+
+  // A released array cannot be imported again
+  rc = tiledb_query_import_arrow_buffer(ctx_, query, "a", &arrow, &schema);
+  CHECK(rc == TILEDB_ERR);
+
+  // Dropping the query fires the producer's release callback
+  tiledb_query_free(&query);
+  CHECK(g_producer_array_released);
+
+  // Clean up
+  rc = tiledb_array_close(ctx_, array);
+  REQUIRE(rc == TILEDB_OK);
+  tiledb_array_free(&array);
+}
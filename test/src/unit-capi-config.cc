@@ -243,15 +243,19 @@ void check_save_to_file() {
   ss << "rest.use_refactored_array_open_and_query_submit false\n";
   ss << "sm.allow_separate_attribute_writes false\n";
   ss << "sm.allow_updates_experimental false\n";
+  ss << "sm.array.prefetch_fragment_metadata false\n";
+  ss << "sm.array_schema_cache_size 10000000\n";
   ss << "sm.check_coord_dups true\n";
   ss << "sm.check_coord_oob true\n";
   ss << "sm.check_global_order true\n";
+  ss << "sm.commit_batch_size 1\n";
   ss << "sm.compute_concurrency_level " << std::thread::hardware_concurrency()
      << "\n";
   ss << "sm.consolidation.amplification 1.0\n";
   ss << "sm.consolidation.buffer_size 50000000\n";
   ss << "sm.consolidation.max_fragment_size " << std::to_string(UINT64_MAX)
      << "\n";
+  ss << "sm.consolidation.min_interleave_ratio 0.0\n";
   ss << "sm.consolidation.mode fragments\n";
   ss << "sm.consolidation.purge_deleted_cells false\n";
   ss << "sm.consolidation.step_max_frags 4294967295\n";
@@ -261,16 +265,24 @@ void check_save_to_file() {
   ss << "sm.consolidation.timestamp_end " << std::to_string(UINT64_MAX) << "\n";
   ss << "sm.consolidation.timestamp_start 0\n";
   ss << "sm.dedup_coords false\n";
+  ss << "sm.deferred_checksum_validation false\n";
+  ss << "sm.deletion_vector_cache_size 10000000\n";
   ss << "sm.enable_signal_handlers true\n";
   ss << "sm.encryption_type NO_ENCRYPTION\n";
+  ss << "sm.enumeration_cache_size 10000000\n";
   ss << "sm.enumerations_max_size 10485760\n";
   ss << "sm.enumerations_max_total_size 52428800\n";
+  ss << "sm.filter_pipeline_advisor.enable false\n";
+  ss << "sm.fragment_footer_cache_size 10000000\n";
   ss << "sm.fragment_info.preload_mbrs false\n";
   ss << "sm.group.timestamp_end 18446744073709551615\n";
   ss << "sm.group.timestamp_start 0\n";
+  ss << "sm.group_details_cache_size 10000000\n";
   ss << "sm.io_concurrency_level " << std::thread::hardware_concurrency()
      << "\n";
   ss << "sm.max_tile_overlap_size 314572800\n";
+  ss << "sm.mem.context_budget 0\n";
+  ss << "sm.mem.hugepages false\n";
   ss << "sm.mem.malloc_trim true\n";
   ss << "sm.mem.reader.sparse_global_order.ratio_array_data 0.1\n";
   ss << "sm.mem.reader.sparse_global_order.ratio_coords 0.5\n";
@@ -283,20 +295,35 @@ void check_save_to_file() {
   ss << "sm.memory_budget 5368709120\n";
   ss << "sm.memory_budget_var 10737418240\n";
   ss << "sm.merge_overlapping_ranges_experimental true\n";
+  ss << "sm.numa.pin_threads false\n";
   ss << "sm.partial_tile_offsets_loading false\n";
+  ss << "sm.query.attribute_prefetch_depth 0\n";
   ss << "sm.query.dense.qc_coords_mode false\n";
   ss << "sm.query.dense.reader refactored\n";
+  ss << "sm.query.global_order_writer.pipelined_io false\n";
+  ss << "sm.query.priority normal\n";
+  ss << "sm.query.profile_guided.enable false\n";
+  ss << "sm.query.slow_log.threshold_ms 0\n";
+  ss << "sm.query.sparse.result_budget_cells 0\n";
   ss << "sm.query.sparse_global_order.reader refactored\n";
   ss << "sm.query.sparse_unordered_with_dups.reader refactored\n";
+  ss << "sm.query.sparse_unordered_with_dups.tile_completion_order false\n";
+  ss << "sm.query_result_cache_size 0\n";
   ss << "sm.read_range_oob warn\n";
   ss << "sm.skip_checksum_validation false\n";
   ss << "sm.skip_est_size_partitioning false\n";
   ss << "sm.skip_unary_partitioning_budget_check false\n";
+  ss << "sm.stats.trace_enabled false\n";
+  ss << "sm.tile_cache_size 10000000\n";
+  ss << "sm.unfilter_min_chunks_per_task 4\n";
   ss << "sm.vacuum.mode fragments\n";
+  ss << "sm.validity.mode bytemap\n";
   ss << "sm.var_offsets.bitsize 64\n";
   ss << "sm.var_offsets.extra_element false\n";
   ss << "sm.var_offsets.mode bytes\n";
+  ss << "sm.zstd_train_dictionaries false\n";
   ss << "ssl.verify true\n";
+  ss << "vfs.adaptive_parallel_ops false\n";
   ss << "vfs.azure.block_list_block_size 5242880\n";
   ss << "vfs.azure.max_parallel_ops " << std::thread::hardware_concurrency()
      << "\n";
@@ -304,25 +331,34 @@ void check_save_to_file() {
   ss << "vfs.azure.max_retry_delay_ms 60000\n";
   ss << "vfs.azure.retry_delay_ms 800\n";
   ss << "vfs.azure.use_block_list_upload true\n";
+  ss << "vfs.azure.use_streaming_upload true\n";
+  ss << "vfs.disk_cache.enable false\n";
+  ss << "vfs.disk_cache.size 10737418240\n";
+  ss << "vfs.file.posix_direct_io false\n";
   ss << "vfs.file.posix_directory_permissions 755\n";
   ss << "vfs.file.posix_file_permissions 644\n";
+  ss << "vfs.file.posix_use_io_uring false\n";
+  ss << "vfs.file.posix_use_mmap false\n";
   ss << "vfs.gcs.max_direct_upload_size 10737418240\n";
   ss << "vfs.gcs.max_parallel_ops " << std::thread::hardware_concurrency()
      << "\n";
   ss << "vfs.gcs.multi_part_size 5242880\n";
   ss << "vfs.gcs.request_timeout_ms 3000\n";
   ss << "vfs.gcs.use_multi_part_upload true\n";
+  ss << "vfs.gcs.use_streaming_upload true\n";
   ss << "vfs.max_batch_size 104857600\n";
   ss << "vfs.min_batch_gap 512000\n";
   ss << "vfs.min_batch_size 20971520\n";
   ss << "vfs.min_parallel_size 10485760\n";
   ss << "vfs.read_ahead_cache_size 10485760\n";
+  ss << "vfs.read_ahead_max_size 4194304\n";
   ss << "vfs.read_ahead_size 102400\n";
   ss << "vfs.s3.bucket_canned_acl NOT_SET\n";
   ss << "vfs.s3.config_source auto\n";
   ss << "vfs.s3.connect_max_tries 5\n";
   ss << "vfs.s3.connect_scale_factor 25\n";
   ss << "vfs.s3.connect_timeout_ms 10800\n";
+  ss << "vfs.s3.eager_init false\n";
   ss << "vfs.s3.logging_level Off\n";
   ss << "vfs.s3.max_parallel_ops " << std::thread::hardware_concurrency()
      << "\n";
@@ -612,6 +648,7 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
   all_param_values["rest.use_refactored_array_open_and_query_submit"] = "true";
   all_param_values["sm.allow_separate_attribute_writes"] = "false";
   all_param_values["sm.allow_updates_experimental"] = "false";
+  all_param_values["sm.array.prefetch_fragment_metadata"] = "false";
   all_param_values["sm.encryption_key"] = "";
   all_param_values["sm.encryption_type"] = "NO_ENCRYPTION";
   all_param_values["sm.dedup_coords"] = "false";
@@ -624,15 +661,35 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
   all_param_values["sm.merge_overlapping_ranges_experimental"] = "true";
   all_param_values["sm.skip_est_size_partitioning"] = "false";
   all_param_values["sm.skip_unary_partitioning_budget_check"] = "false";
+  all_param_values["sm.unfilter_min_chunks_per_task"] = "4";
+  all_param_values["sm.tile_cache_size"] = "10000000";
+  all_param_values["sm.filter_pipeline_advisor.enable"] = "false";
+  all_param_values["sm.zstd_train_dictionaries"] = "false";
+  all_param_values["sm.fragment_footer_cache_size"] = "10000000";
+  all_param_values["sm.group_details_cache_size"] = "10000000";
+  all_param_values["sm.enumeration_cache_size"] = "10000000";
+  all_param_values["sm.deletion_vector_cache_size"] = "10000000";
+  all_param_values["sm.array_schema_cache_size"] = "10000000";
   all_param_values["sm.memory_budget"] = "5368709120";
   all_param_values["sm.memory_budget_var"] = "10737418240";
+  all_param_values["sm.query.attribute_prefetch_depth"] = "0";
   all_param_values["sm.query.dense.qc_coords_mode"] = "false";
   all_param_values["sm.query.dense.reader"] = "refactored";
+  all_param_values["sm.query.global_order_writer.pipelined_io"] = "false";
+  all_param_values["sm.query.priority"] = "normal";
+  all_param_values["sm.query.profile_guided.enable"] = "false";
+  all_param_values["sm.query.slow_log.file"] = "";
+  all_param_values["sm.query.slow_log.threshold_ms"] = "0";
+  all_param_values["sm.query.sparse.result_budget_cells"] = "0";
   all_param_values["sm.query.sparse_global_order.reader"] = "refactored";
   all_param_values["sm.query.sparse_unordered_with_dups.reader"] = "refactored";
+  all_param_values
+      ["sm.query.sparse_unordered_with_dups.tile_completion_order"] = "false";
+  all_param_values["sm.mem.hugepages"] = "false";
   all_param_values["sm.mem.malloc_trim"] = "true";
   all_param_values["sm.mem.tile_upper_memory_limit"] = "1073741824";
   all_param_values["sm.mem.total_budget"] = "10737418240";
+  all_param_values["sm.mem.context_budget"] = "0";
   all_param_values["sm.mem.reader.sparse_global_order.ratio_coords"] = "0.5";
   all_param_values["sm.mem.reader.sparse_global_order.ratio_tile_ranges"] =
       "0.1";
@@ -651,7 +708,11 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
       std::to_string(std::thread::hardware_concurrency());
   all_param_values["sm.io_concurrency_level"] =
       std::to_string(std::thread::hardware_concurrency());
+  all_param_values["sm.numa.pin_threads"] = "false";
   all_param_values["sm.skip_checksum_validation"] = "false";
+  all_param_values["sm.deferred_checksum_validation"] = "false";
+  all_param_values["sm.stats.trace_enabled"] = "false";
+  all_param_values["sm.commit_batch_size"] = "1";
   all_param_values["sm.consolidation.amplification"] = "1.0";
   all_param_values["sm.consolidation.steps"] = "4294967295";
   all_param_values["sm.consolidation.timestamp_start"] = "0";
@@ -664,9 +725,12 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
   all_param_values["sm.consolidation.max_fragment_size"] =
       std::to_string(UINT64_MAX);
   all_param_values["sm.consolidation.step_size_ratio"] = "0.0";
+  all_param_values["sm.consolidation.min_interleave_ratio"] = "0.0";
   all_param_values["sm.consolidation.mode"] = "fragments";
+  all_param_values["sm.query_result_cache_size"] = "0";
   all_param_values["sm.read_range_oob"] = "warn";
   all_param_values["sm.vacuum.mode"] = "fragments";
+  all_param_values["sm.validity.mode"] = "bytemap";
   all_param_values["sm.var_offsets.bitsize"] = "32";
   all_param_values["sm.var_offsets.extra_element"] = "true";
   all_param_values["sm.var_offsets.mode"] = "elements";
@@ -678,11 +742,16 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
   all_param_values["ssl.ca_path"] = "";
   all_param_values["ssl.verify"] = "true";
 
+  all_param_values["vfs.adaptive_parallel_ops"] = "false";
+  all_param_values["vfs.disk_cache.enable"] = "false";
+  all_param_values["vfs.disk_cache.dir"] = "";
+  all_param_values["vfs.disk_cache.size"] = "10737418240";
   all_param_values["vfs.max_batch_size"] = "104857600";
   all_param_values["vfs.min_batch_gap"] = "512000";
   all_param_values["vfs.min_batch_size"] = "20971520";
   all_param_values["vfs.min_parallel_size"] = "10485760";
   all_param_values["vfs.read_ahead_size"] = "102400";
+  all_param_values["vfs.read_ahead_max_size"] = "4194304";
   all_param_values["vfs.read_ahead_cache_size"] = "10485760";
   all_param_values["vfs.read_logging_mode"] = "";
   all_param_values["vfs.gcs.endpoint"] = "";
@@ -691,6 +760,7 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
       std::to_string(std::thread::hardware_concurrency());
   all_param_values["vfs.gcs.multi_part_size"] = "5242880";
   all_param_values["vfs.gcs.use_multi_part_upload"] = "true";
+  all_param_values["vfs.gcs.use_streaming_upload"] = "true";
   all_param_values["vfs.gcs.request_timeout_ms"] = "3000";
   all_param_values["vfs.gcs.max_direct_upload_size"] = "10737418240";
   all_param_values["vfs.azure.storage_account_name"] = "";
@@ -701,11 +771,15 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
   all_param_values["vfs.azure.max_parallel_ops"] =
       std::to_string(std::thread::hardware_concurrency());
   all_param_values["vfs.azure.use_block_list_upload"] = "true";
+  all_param_values["vfs.azure.use_streaming_upload"] = "true";
   all_param_values["vfs.azure.max_retries"] = "5";
   all_param_values["vfs.azure.retry_delay_ms"] = "800";
   all_param_values["vfs.azure.max_retry_delay_ms"] = "60000";
   all_param_values["vfs.file.posix_file_permissions"] = "644";
   all_param_values["vfs.file.posix_directory_permissions"] = "755";
+  all_param_values["vfs.file.posix_use_mmap"] = "false";
+  all_param_values["vfs.file.posix_use_io_uring"] = "false";
+  all_param_values["vfs.file.posix_direct_io"] = "false";
   all_param_values["vfs.s3.scheme"] = "https";
   all_param_values["vfs.s3.region"] = "us-east-1";
   all_param_values["vfs.s3.aws_access_key_id"] = "";
@@ -718,6 +792,7 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
   all_param_values["vfs.s3.endpoint_override"] = "";
   all_param_values["vfs.s3.use_virtual_addressing"] = "true";
   all_param_values["vfs.s3.skip_init"] = "false";
+  all_param_values["vfs.s3.eager_init"] = "false";
   all_param_values["vfs.s3.use_multipart_upload"] = "true";
   all_param_values["vfs.s3.max_parallel_ops"] =
       std::to_string(std::thread::hardware_concurrency());
@@ -747,11 +822,13 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
   all_param_values["vfs.s3.config_source"] = "auto";
 
   std::map<std::string, std::string> vfs_param_values;
+  vfs_param_values["adaptive_parallel_ops"] = "false";
   vfs_param_values["max_batch_size"] = "104857600";
   vfs_param_values["min_batch_gap"] = "512000";
   vfs_param_values["min_batch_size"] = "20971520";
   vfs_param_values["min_parallel_size"] = "10485760";
   vfs_param_values["read_ahead_size"] = "102400";
+  vfs_param_values["read_ahead_max_size"] = "4194304";
   vfs_param_values["read_ahead_cache_size"] = "10485760";
   vfs_param_values["read_logging_mode"] = "";
   vfs_param_values["gcs.endpoint"] = "";
@@ -775,6 +852,9 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
   vfs_param_values["azure.max_retry_delay_ms"] = "60000";
   vfs_param_values["file.posix_file_permissions"] = "644";
   vfs_param_values["file.posix_directory_permissions"] = "755";
+  vfs_param_values["file.posix_use_mmap"] = "false";
+  vfs_param_values["file.posix_use_io_uring"] = "false";
+  vfs_param_values["file.posix_direct_io"] = "false";
   vfs_param_values["s3.scheme"] = "https";
   vfs_param_values["s3.region"] = "us-east-1";
   vfs_param_values["s3.aws_access_key_id"] = "";
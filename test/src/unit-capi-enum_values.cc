@@ -81,6 +81,7 @@ TEST_CASE("C API: Test enum values", "[capi][enums]") {
   REQUIRE(TILEDB_FILTER_DEPRECATED == 17);
   REQUIRE(TILEDB_FILTER_WEBP == 18);
   REQUIRE(TILEDB_FILTER_DELTA == 19);
+  REQUIRE(TILEDB_FILTER_CHECKSUM_CRC32C == 20);
 
   /** Filter option */
   REQUIRE(TILEDB_COMPRESSION_LEVEL == 0);
@@ -232,6 +233,10 @@ TEST_CASE("C API: Test enum string conversion", "[capi][enums]") {
       (tiledb_filter_type_from_str("CHECKSUM_SHA256", &filter_type) ==
            TILEDB_OK &&
        filter_type == TILEDB_FILTER_CHECKSUM_SHA256));
+  REQUIRE(
+      (tiledb_filter_type_from_str("CHECKSUM_CRC32C", &filter_type) ==
+           TILEDB_OK &&
+       filter_type == TILEDB_FILTER_CHECKSUM_CRC32C));
   REQUIRE(
       (tiledb_filter_type_from_str("DICTIONARY_ENCODING", &filter_type) ==
            TILEDB_OK &&
@@ -0,0 +1,222 @@
+/**
+ * @file   unit-capi-query-batch.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Tests the C API batch query submission.
+ */
+
+#include <test/support/tdb_catch.h>
+#include "test/support/src/helpers.h"
+#include "tiledb/sm/c_api/tiledb.h"
+#include "tiledb/sm/c_api/tiledb_experimental.h"
+
+#include <string>
+#include <vector>
+
+using namespace tiledb::test;
+
+/** Tests for C API batch query submission. */
+struct QueryBatchFx {
+  // Constants
+  const char* ARRAY_NAME = "test_query_batch";
+
+  // TileDB context
+  tiledb_ctx_t* ctx_;
+
+  // Constructors/destructors
+  QueryBatchFx();
+  ~QueryBatchFx();
+
+  // Functions
+  void create_and_write_array();
+  void remove_array();
+};
+
+QueryBatchFx::QueryBatchFx() {
+  ctx_ = nullptr;
+  REQUIRE(tiledb_ctx_alloc(NULL, &ctx_) == TILEDB_OK);
+  remove_array();
+}
+
+QueryBatchFx::~QueryBatchFx() {
+  remove_array();
+  tiledb_ctx_free(&ctx_);
+}
+
+void QueryBatchFx::create_and_write_array() {
+  // Create a 1D dense array with a single int32 attribute
+  uint64_t dim_domain[] = {1, 10};
+  uint64_t tile_extent = 2;
+  tiledb_dimension_t* d;
+  int rc = tiledb_dimension_alloc(
+      ctx_, "d", TILEDB_UINT64, dim_domain, &tile_extent, &d);
+  REQUIRE(rc == TILEDB_OK);
+  tiledb_domain_t* domain;
+  rc = tiledb_domain_alloc(ctx_, &domain);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_domain_add_dimension(ctx_, domain, d);
+  REQUIRE(rc == TILEDB_OK);
+  tiledb_attribute_t* a;
+  rc = tiledb_attribute_alloc(ctx_, "a", TILEDB_INT32, &a);
+  REQUIRE(rc == TILEDB_OK);
+  tiledb_array_schema_t* array_schema;
+  rc = tiledb_array_schema_alloc(ctx_, TILEDB_DENSE, &array_schema);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_array_schema_set_domain(ctx_, array_schema, domain);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_array_schema_add_attribute(ctx_, array_schema, a);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_array_create(ctx_, ARRAY_NAME, array_schema);
+  REQUIRE(rc == TILEDB_OK);
+  tiledb_attribute_free(&a);
+  tiledb_dimension_free(&d);
+  tiledb_domain_free(&domain);
+  tiledb_array_schema_free(&array_schema);
+
+  // Write the full domain
+  int32_t buffer[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  uint64_t buffer_size = sizeof(buffer);
+  tiledb_array_t* array;
+  rc = tiledb_array_alloc(ctx_, ARRAY_NAME, &array);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_array_open(ctx_, array, TILEDB_WRITE);
+  REQUIRE(rc == TILEDB_OK);
+  tiledb_query_t* query;
+  rc = tiledb_query_alloc(ctx_, array, TILEDB_WRITE, &query);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_set_data_buffer(ctx_, query, "a", buffer, &buffer_size);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_submit(ctx_, query);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_array_close(ctx_, array);
+  REQUIRE(rc == TILEDB_OK);
+  tiledb_query_free(&query);
+  tiledb_array_free(&array);
+}
+
+void QueryBatchFx::remove_array() {
+  tiledb_object_t type;
+  int rc = tiledb_object_type(ctx_, ARRAY_NAME, &type);
+  REQUIRE(rc == TILEDB_OK);
+  if (type == TILEDB_ARRAY) {
+    rc = tiledb_object_remove(ctx_, ARRAY_NAME);
+    REQUIRE(rc == TILEDB_OK);
+  }
+}
+
+TEST_CASE_METHOD(
+    QueryBatchFx,
+    "C API: Test batch query submission",
+    "[capi][query][query-batch]") {
+  create_and_write_array();
+
+  tiledb_array_t* array;
+  int rc = tiledb_array_alloc(ctx_, ARRAY_NAME, &array);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_array_open(ctx_, array, TILEDB_READ);
+  REQUIRE(rc == TILEDB_OK);
+
+  // Prepare several read queries over disjoint regions
+  const unsigned num_queries = 4;
+  std::vector<tiledb_query_t*> queries(num_queries);
+  int32_t buffers[num_queries][2];
+  uint64_t buffer_sizes[num_queries];
+  for (unsigned i = 0; i < num_queries; i++) {
+    rc = tiledb_query_alloc(ctx_, array, TILEDB_READ, &queries[i]);
+    REQUIRE(rc == TILEDB_OK);
+    uint64_t subarray[] = {2 * i + 1, 2 * i + 2};
+    rc = tiledb_query_set_subarray(ctx_, queries[i], subarray);
+    REQUIRE(rc == TILEDB_OK);
+    buffer_sizes[i] = sizeof(buffers[i]);
+    rc = tiledb_query_set_data_buffer(
+        ctx_, queries[i], "a", buffers[i], &buffer_sizes[i]);
+    REQUIRE(rc == TILEDB_OK);
+  }
+
+  SECTION("all queries succeed") {
+    rc = tiledb_query_submit_batch(ctx_, queries.data(), num_queries);
+    CHECK(rc == TILEDB_OK);
+    for (unsigned i = 0; i < num_queries; i++) {
+      tiledb_query_status_t status;
+      rc = tiledb_query_get_status(ctx_, queries[i], &status);
+      REQUIRE(rc == TILEDB_OK);
+      CHECK(status == TILEDB_COMPLETED);
+      CHECK(buffers[i][0] == (int32_t)(2 * i + 1));
+      CHECK(buffers[i][1] == (int32_t)(2 * i + 2));
+    }
+  }
+
+  SECTION("empty and null batches") {
+    // An empty batch is a no-op
+    rc = tiledb_query_submit_batch(ctx_, nullptr, 0);
+    CHECK(rc == TILEDB_OK);
+
+    // A null query list with a nonzero count is an error
+    rc = tiledb_query_submit_batch(ctx_, nullptr, num_queries);
+    CHECK(rc == TILEDB_ERR);
+  }
+
+  SECTION("failed sanity check") {
+    // A null query fails the up-front checks; nothing is submitted
+    std::vector<tiledb_query_t*> bad = {queries[0], nullptr, queries[2]};
+    rc = tiledb_query_submit_batch(ctx_, bad.data(), bad.size());
+    CHECK(rc == TILEDB_ERR);
+    tiledb_query_status_t status;
+    rc = tiledb_query_get_status(ctx_, queries[0], &status);
+    REQUIRE(rc == TILEDB_OK);
+    CHECK(status == TILEDB_UNINITIALIZED);
+  }
+
+  SECTION("first error returned, all queries submitted") {
+    // A read query without buffers fails on submission; the rest of the
+    // batch is still submitted
+    tiledb_query_t* bad_query;
+    rc = tiledb_query_alloc(ctx_, array, TILEDB_READ, &bad_query);
+    REQUIRE(rc == TILEDB_OK);
+    std::vector<tiledb_query_t*> batch = {
+        queries[0], bad_query, queries[1], queries[2], queries[3]};
+    rc = tiledb_query_submit_batch(ctx_, batch.data(), batch.size());
+    CHECK(rc == TILEDB_ERR);
+    for (unsigned i = 0; i < num_queries; i++) {
+      tiledb_query_status_t status;
+      rc = tiledb_query_get_status(ctx_, queries[i], &status);
+      REQUIRE(rc == TILEDB_OK);
+      CHECK(status == TILEDB_COMPLETED);
+      CHECK(buffers[i][0] == (int32_t)(2 * i + 1));
+      CHECK(buffers[i][1] == (int32_t)(2 * i + 2));
+    }
+    tiledb_query_free(&bad_query);
+  }
+
+  // Clean up
+  rc = tiledb_array_close(ctx_, array);
+  REQUIRE(rc == TILEDB_OK);
+  for (unsigned i = 0; i < num_queries; i++)
+    tiledb_query_free(&queries[i]);
+  tiledb_array_free(&array);
+}
@@ -1266,3 +1266,74 @@ TEST_CASE_METHOD(
 
   REQUIRE(status == Query::Status::COMPLETE);
 }
+
+TEST_CASE_METHOD(
+    SerializationFx,
+    "Global write state checkpoint and resume",
+    "[query][global-order][serialization][global-write-state]") {
+  // Create a 1D dense array
+  const std::string uri =
+      current_dir() + PATH_SEPARATOR + tmpdir + "/resume_array";
+  {
+    ArraySchema schema(ctx, TILEDB_DENSE);
+    Domain domain(ctx);
+    domain.add_dimension(Dimension::create<int32_t>(ctx, "d1", {1, 20}, 2));
+    schema.set_domain(domain);
+    schema.add_attribute(Attribute::create<uint32_t>(ctx, "a1"));
+    Array::create(uri, schema);
+  }
+
+  std::vector<uint32_t> values(20);
+  for (uint32_t i = 0; i < 20; i++)
+    values[i] = i;
+
+  // Start a global order write and submit the first half
+  Array array(ctx, uri, TILEDB_WRITE);
+  Query query(ctx, array);
+  query.set_layout(TILEDB_GLOBAL_ORDER);
+  query.set_subarray(std::vector<int32_t>{1, 20});
+  std::vector<uint32_t> first_half(values.begin(), values.begin() + 10);
+  query.set_data_buffer("a1", first_half);
+  REQUIRE(query.submit() == Query::Status::COMPLETE);
+
+  // Checkpoint the write state; the query is deliberately not finalized
+  tiledb_buffer_t* buff;
+  REQUIRE(
+      tiledb_serialize_query_global_write_state(
+          ctx.ptr().get(), query.ptr().get(), TILEDB_CAPNP, &buff) ==
+      TILEDB_OK);
+
+  // Resume into a fresh query in a new context, as a new process would
+  Context ctx2;
+  Array array2(ctx2, uri, TILEDB_WRITE);
+  Query query2(ctx2, array2);
+  query2.set_layout(TILEDB_GLOBAL_ORDER);
+  query2.set_subarray(std::vector<int32_t>{1, 20});
+  std::vector<uint32_t> second_half(values.begin() + 10, values.end());
+  query2.set_data_buffer("a1", second_half);
+  REQUIRE(
+      tiledb_deserialize_query_global_write_state(
+          ctx2.ptr().get(), query2.ptr().get(), TILEDB_CAPNP, buff) ==
+      TILEDB_OK);
+  tiledb_buffer_free(&buff);
+
+  // Finish the write from the checkpoint
+  REQUIRE(query2.submit() == Query::Status::COMPLETE);
+  query2.finalize();
+  array2.close();
+
+  // The resumed fragment contains the cells of both halves
+  Array array3(ctx2, uri, TILEDB_READ);
+  FragmentInfo fragment_info(ctx2, uri);
+  fragment_info.load();
+  CHECK(fragment_info.fragment_num() == 1);
+  std::vector<uint32_t> result(20);
+  Query query3(ctx2, array3);
+  query3.set_subarray(std::vector<int32_t>{1, 20});
+  query3.set_data_buffer("a1", result);
+  REQUIRE(query3.submit() == Query::Status::COMPLETE);
+  array3.close();
+  CHECK(result == values);
+
+  array.close();
+}
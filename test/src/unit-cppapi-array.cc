@@ -667,6 +667,59 @@ TEST_CASE("C++ API: Read subarray with expanded domain", "[cppapi][dense]") {
   }
 }
 
+TEST_CASE(
+    "C++ API: Reuse completed read query with a new subarray",
+    "[cppapi][dense][query-reuse]") {
+  const std::string array_name = "cpp_unit_array";
+  Context ctx;
+  VFS vfs(ctx);
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+
+  // Create
+  Domain domain(ctx);
+  domain.add_dimension(Dimension::create<int>(ctx, "rows", {{0, 3}}, 2))
+      .add_dimension(Dimension::create<int>(ctx, "cols", {{0, 3}}, 2));
+  ArraySchema schema(ctx, TILEDB_DENSE);
+  schema.set_domain(domain);
+  schema.add_attribute(Attribute::create<int>(ctx, "a"));
+  Array::create(array_name, schema);
+
+  // Write
+  std::vector<int> data_w = {
+      1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+  Array array_w(ctx, array_name, TILEDB_WRITE);
+  Query query_w(ctx, array_w);
+  query_w.set_subarray(Subarray(ctx, array_w).set_subarray({0, 3, 0, 3}))
+      .set_layout(TILEDB_ROW_MAJOR)
+      .set_data_buffer("a", data_w);
+  query_w.submit();
+  array_w.close();
+
+  // Read one tile per submission, reusing the same query.
+  Array array(ctx, array_name, TILEDB_READ);
+  Query query(ctx, array);
+  std::vector<int> data(4);
+  query.set_subarray(Subarray(ctx, array).set_subarray({0, 1, 0, 1}))
+      .set_layout(TILEDB_ROW_MAJOR)
+      .set_data_buffer("a", data);
+  query.submit();
+  REQUIRE(query.query_status() == Query::Status::COMPLETE);
+  REQUIRE(data == std::vector<int>({1, 2, 5, 6}));
+
+  // Setting a new subarray resets the completed query for resubmission.
+  query.set_subarray(Subarray(ctx, array).set_subarray({2, 3, 2, 3}))
+      .set_data_buffer("a", data);
+  query.submit();
+  REQUIRE(query.query_status() == Query::Status::COMPLETE);
+  REQUIRE(data == std::vector<int>({11, 12, 15, 16}));
+  array.close();
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+}
+
 TEST_CASE("C++ API: Consolidation of empty arrays", "[cppapi][consolidation]") {
   Context ctx;
   VFS vfs(ctx);
@@ -204,3 +204,7 @@ TEST_CASE("C++ API: MD5 checksum on array", "[cppapi][checksum][md5]") {
 TEST_CASE("C++ API: SHA256 checksum on array", "[cppapi][checksum][sha256]") {
   run_checksum_test(TILEDB_FILTER_CHECKSUM_SHA256);
 }
+
+TEST_CASE("C++ API: CRC32C checksum on array", "[cppapi][checksum][crc32c]") {
+  run_checksum_test(TILEDB_FILTER_CHECKSUM_CRC32C);
+}
@@ -395,3 +395,59 @@ TEST_CASE(
     vfs.remove_dir(array_name);
   }
 }
+
+TEST_CASE(
+    "C++ API: Test future-based query submission",
+    "[cppapi][query][submit-future]") {
+  const std::string array_name = "cpp_unit_array";
+  Context ctx;
+  VFS vfs(ctx);
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+
+  // Create
+  Domain domain(ctx);
+  domain.add_dimension(Dimension::create<int>(ctx, "rows", {{0, 3}}, 4))
+      .add_dimension(Dimension::create<int>(ctx, "cols", {{0, 3}}, 4));
+  ArraySchema schema(ctx, TILEDB_SPARSE);
+  schema.set_domain(domain).set_order({{TILEDB_ROW_MAJOR, TILEDB_ROW_MAJOR}});
+  schema.add_attribute(Attribute::create<int>(ctx, "a"));
+  Array::create(array_name, schema);
+
+  // Write a cell
+  std::vector<int> rows = {0};
+  std::vector<int> cols = {1};
+  std::vector<int> a = {42};
+  {
+    Array array(ctx, array_name, TILEDB_WRITE);
+    Query query(ctx, array);
+    query.set_layout(TILEDB_UNORDERED)
+        .set_data_buffer("rows", rows)
+        .set_data_buffer("cols", cols)
+        .set_data_buffer("a", a);
+    std::future<Query::Status> status = query.submit_future();
+    REQUIRE(status.get() == Query::Status::COMPLETE);
+    array.close();
+  }
+
+  // Read it back; the query must stay alive until the future is ready
+  Array array(ctx, array_name, TILEDB_READ);
+  std::vector<int> rows_read(1);
+  std::vector<int> cols_read(1);
+  std::vector<int> a_read(1);
+  Query query(ctx, array);
+  query.set_layout(TILEDB_UNORDERED)
+      .set_data_buffer("rows", rows_read)
+      .set_data_buffer("cols", cols_read)
+      .set_data_buffer("a", a_read);
+  std::future<Query::Status> status = query.submit_future();
+  REQUIRE(status.get() == Query::Status::COMPLETE);
+  CHECK(rows_read[0] == 0);
+  CHECK(cols_read[0] == 1);
+  CHECK(a_read[0] == 42);
+
+  array.close();
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+}
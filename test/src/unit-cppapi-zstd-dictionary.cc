@@ -0,0 +1,206 @@
+/**
+ * @file unit-cppapi-zstd-dictionary.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2026 TileDB Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Tests writing and reading back fragments compressed with a trained zstd
+ * dictionary (config option sm.zstd_train_dictionaries).
+ */
+
+#include <test/support/tdb_catch.h>
+#include "tiledb/sm/c_api/tiledb_struct_def.h"
+#include "tiledb/sm/cpp_api/tiledb"
+#include "tiledb/sm/fragment/fragment_metadata.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace tiledb;
+
+static const std::string array_name = "cpp_unit_zstd_dictionary";
+
+/** Returns a context with zstd dictionary training enabled. */
+static Context training_context() {
+  Config config;
+  config["sm.zstd_train_dictionaries"] = "true";
+  return Context(config);
+}
+
+/** Creates a 1D dense array with a zstd-compressed char attribute. */
+static void create_array(
+    const Context& ctx, uint64_t domain_max, uint64_t extent) {
+  Domain domain(ctx);
+  domain.add_dimension(
+      Dimension::create<uint64_t>(ctx, "d", {{1, domain_max}}, extent));
+  FilterList filters(ctx);
+  filters.add_filter(Filter(ctx, TILEDB_FILTER_ZSTD));
+  auto a = Attribute::create<char>(ctx, "a");
+  a.set_filter_list(filters);
+  ArraySchema schema(ctx, TILEDB_DENSE);
+  schema.set_domain(domain);
+  schema.add_attribute(a);
+  Array::create(array_name, schema);
+}
+
+/**
+ * Returns text with a shared vocabulary, good dictionary training
+ * material: every tile sees the same words in a different order.
+ */
+static std::vector<char> make_text(uint64_t n) {
+  static const char* words[] = {
+      "tiledb", "fragment", "dictionary", "compression", "metadata", "zstd"};
+  std::vector<char> text;
+  text.reserve(n + 16);
+  uint32_t seed = 0xdeadbeef;
+  while (text.size() < n) {
+    seed = seed * 1103515245 + 12345;
+    const char* word = words[(seed >> 16) % 6];
+    text.insert(text.end(), word, word + std::strlen(word));
+    text.push_back(' ');
+  }
+  text.resize(n);
+  return text;
+}
+
+/** Returns whether a fragment persisted a dictionary for a field. */
+static bool fragment_has_dictionary(
+    Array& array, unsigned frag_idx, const std::string& name) {
+  auto sm_array = array.ptr()->array_;
+  auto meta = sm_array->fragment_metadata()[frag_idx];
+  meta->load_zstd_dictionaries(sm_array->get_encryption_key());
+  return meta->has_zstd_dictionary(name);
+}
+
+static void remove_array(const Context& ctx) {
+  VFS vfs(ctx);
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+}
+
+TEST_CASE(
+    "C++ API: Zstd dictionary round-trip",
+    "[cppapi][zstd][zstd-dictionary]") {
+  Context ctx = training_context();
+  remove_array(ctx);
+
+  // 50 tiles of 4KB; every tile is a training sample
+  const uint64_t domain_max = 200000;
+  create_array(ctx, domain_max, 4000);
+  auto data = make_text(domain_max);
+
+  // Write the first fragment in global order, in two submits
+  {
+    Array array(
+        ctx, array_name, TILEDB_WRITE, TemporalPolicy(TimeTravel, 1));
+    Query query(ctx, array, TILEDB_WRITE);
+    query.set_layout(TILEDB_GLOBAL_ORDER);
+    Subarray subarray(ctx, array);
+    subarray.add_range(0, (uint64_t)1, domain_max);
+    query.set_subarray(subarray);
+    query.set_data_buffer("a", data.data(), domain_max / 2);
+    REQUIRE(query.submit() == Query::Status::COMPLETE);
+    query.set_data_buffer(
+        "a", data.data() + domain_max / 2, domain_max / 2);
+    REQUIRE(query.submit() == Query::Status::COMPLETE);
+    query.finalize();
+    array.close();
+  }
+
+  // Overwrite one tile in a second fragment; a single tile is a single
+  // training sample, so this fragment gets no dictionary
+  std::vector<char> patch(4000, 'x');
+  {
+    Array array(
+        ctx, array_name, TILEDB_WRITE, TemporalPolicy(TimeTravel, 2));
+    Query query(ctx, array, TILEDB_WRITE);
+    query.set_layout(TILEDB_ROW_MAJOR);
+    Subarray subarray(ctx, array);
+    subarray.add_range(0, (uint64_t)52001, (uint64_t)56000);
+    query.set_subarray(subarray);
+    query.set_data_buffer("a", patch);
+    REQUIRE(query.submit() == Query::Status::COMPLETE);
+    array.close();
+  }
+
+  // The read spans a fragment with a dictionary and one without
+  Array array(ctx, array_name, TILEDB_READ);
+  CHECK(fragment_has_dictionary(array, 0, "a"));
+  CHECK(!fragment_has_dictionary(array, 1, "a"));
+
+  std::vector<char> result(domain_max);
+  Query query(ctx, array, TILEDB_READ);
+  Subarray subarray(ctx, array);
+  subarray.add_range(0, (uint64_t)1, domain_max);
+  query.set_subarray(subarray);
+  query.set_data_buffer("a", result);
+  REQUIRE(query.submit() == Query::Status::COMPLETE);
+  array.close();
+
+  std::memcpy(data.data() + 52000, patch.data(), patch.size());
+  CHECK(result == data);
+
+  remove_array(ctx);
+}
+
+TEST_CASE(
+    "C++ API: Zstd dictionary training failure falls back to plain zstd",
+    "[cppapi][zstd][zstd-dictionary]") {
+  Context ctx = training_context();
+  remove_array(ctx);
+
+  // Two 16-byte tiles: training is attempted but the samples are far too
+  // small for a dictionary, so the tiles are compressed without one
+  create_array(ctx, 32, 16);
+  std::vector<char> data(32, 'x');
+  {
+    Array array(ctx, array_name, TILEDB_WRITE);
+    Query query(ctx, array, TILEDB_WRITE);
+    query.set_layout(TILEDB_ROW_MAJOR);
+    Subarray subarray(ctx, array);
+    subarray.add_range(0, (uint64_t)1, (uint64_t)32);
+    query.set_subarray(subarray);
+    query.set_data_buffer("a", data);
+    REQUIRE(query.submit() == Query::Status::COMPLETE);
+    array.close();
+  }
+
+  Array array(ctx, array_name, TILEDB_READ);
+  CHECK(!fragment_has_dictionary(array, 0, "a"));
+
+  std::vector<char> result(32);
+  Query query(ctx, array, TILEDB_READ);
+  Subarray subarray(ctx, array);
+  subarray.add_range(0, (uint64_t)1, (uint64_t)32);
+  query.set_subarray(subarray);
+  query.set_data_buffer("a", result);
+  REQUIRE(query.submit() == Query::Status::COMPLETE);
+  array.close();
+  CHECK(result == data);
+
+  remove_array(ctx);
+}
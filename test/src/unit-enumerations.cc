@@ -1986,18 +1986,60 @@ TEST_CASE_METHOD(
 
 TEST_CASE_METHOD(
     EnumerationFx,
-    "QueryCondition - Rewrite - Inequality on Unordered Enumeration",
-    "[enumeration][query-condition][error]") {
-  // If an enumeration isn't marked as ordered, then it should throw an error
-  // when attempting to use an inequality operator on the attribute.
+    "QueryCondition - Rewrite - Inequality on Unordered String Enumeration",
+    "[enumeration][query-condition][rewrite-enumeration-value]") {
+  // Inequality operators on an unordered string enumeration are rewritten
+  // as a set membership test over the indices of the values matching the
+  // predicate.
   create_array();
   auto array = get_array(QueryType::READ);
-  auto schema = get_array_schema_latest();
+  auto schema = array->array_schema_latest_ptr();
 
   // This is normally invoked by the query class when not being tested.
   array->get_enumeration("test_enmr");
 
-  auto qc1 = create_qc("attr1", (int)2, QueryConditionOp::LT);
+  auto qc1 = create_qc("attr1", std::string("cat"), QueryConditionOp::LT);
+  qc1.rewrite_enumeration_conditions(*(schema.get()));
+
+  // Of the values {"ant", "bat", "cat", "dog", "emu"}, only "ant" and "bat"
+  // are less than "cat", so the condition becomes `attr1 IN (0, 1)`.
+  auto& tree1 = qc1.ast();
+  REQUIRE(tree1->get_op() == QueryConditionOp::IN);
+
+  std::vector<int> expect = {0, 1};
+  auto data1 = tree1->get_data();
+  REQUIRE(data1.size() == expect.size() * sizeof(int));
+  REQUIRE(memcmp(data1.data(), expect.data(), data1.size()) == 0);
+
+  // A predicate matched by no enumeration value rewrites to an empty set
+  // membership test, i.e., a condition that matches no cells.
+  auto qc2 = create_qc("attr1", std::string("emu"), QueryConditionOp::GT);
+  qc2.rewrite_enumeration_conditions(*(schema.get()));
+
+  auto& tree2 = qc2.ast();
+  REQUIRE(tree2->get_op() == QueryConditionOp::IN);
+  REQUIRE(tree2->get_data().size() == 0);
+}
+
+TEST_CASE_METHOD(
+    EnumerationFx,
+    "QueryCondition - Rewrite - Inequality on Unordered Non-String "
+    "Enumeration",
+    "[enumeration][query-condition][error]") {
+  // Inequality operators are only rewritten against an unordered enumeration
+  // when its values are strings. Any other unordered enumeration still
+  // throws an error.
+  auto schema = make_shared<ArraySchema>(HERE(), ArrayType::SPARSE);
+
+  std::vector<int> values = {1, 2, 3, 4, 5};
+  auto enmr = create_enumeration(values, false, Datatype::INT32, "int_enmr");
+  schema->add_enumeration(enmr);
+
+  auto attr = make_shared<Attribute>(HERE(), "attr4", Datatype::INT32);
+  attr->set_enumeration_name("int_enmr");
+  throw_if_not_ok(schema->add_attribute(attr));
+
+  auto qc1 = create_qc("attr4", (int)2, QueryConditionOp::LT);
   REQUIRE_THROWS(qc1.rewrite_enumeration_conditions(*(schema.get())));
 }
 
@@ -2604,6 +2646,15 @@ storage_size_t EnumerationFx::calculate_serialized_size(
   // bool - ordered
   num_bytes += sizeof(bool);
 
+  // uint32_t - base_path_name length;
+  num_bytes += sizeof(uint32_t);
+
+  // base_path_name.size() bytes
+  num_bytes += enmr->base_path_name().size();
+
+  // uint32_t - generation
+  num_bytes += sizeof(uint32_t);
+
   // uint64_t - data.size()
   // data.size() bytes
   auto dspan = enmr->data();
@@ -2617,6 +2668,11 @@ storage_size_t EnumerationFx::calculate_serialized_size(
     num_bytes += ospan.size();
   }
 
+  // uint64_t - sort order size
+  // elem_count() * sizeof(uint64_t) bytes
+  num_bytes += sizeof(uint64_t);
+  num_bytes += enmr->elem_count() * sizeof(uint64_t);
+
   return num_bytes;
 }
 
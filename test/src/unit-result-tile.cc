@@ -176,6 +176,36 @@ TEST_CASE_METHOD(
   CHECK(tile.pos_with_given_result_sum(2, 8) == 10);
 }
 
+TEST_CASE_METHOD(
+    CResultTileFx,
+    "ResultTileWithBitmap: count_cells and release_full_bitmap",
+    "[resulttilewithbitmap][count_cells][release_full_bitmap]") {
+  UnorderedWithDupsResultTile<uint8_t> tile(0, 0, *frag_md_);
+  const uint64_t cell_num = tile.cell_num();
+
+  // A bitmap with cleared cells is counted correctly and cannot be
+  // released.
+  tile.alloc_bitmap();
+  tile.bitmap()[0] = 0;
+  tile.bitmap()[cell_num - 1] = 0;
+  tile.count_cells();
+  CHECK(tile.result_num() == cell_num - 2);
+  CHECK(!tile.release_full_bitmap());
+  CHECK(tile.has_bmp());
+
+  // A bitmap where every cell survived is released, and the bitmap
+  // queries keep answering as if it was never allocated.
+  tile.bitmap()[0] = 1;
+  tile.bitmap()[cell_num - 1] = 1;
+  tile.count_cells();
+  CHECK(tile.result_num() == cell_num);
+  CHECK(tile.release_full_bitmap());
+  CHECK(!tile.has_bmp());
+  CHECK(tile.bitmap_released());
+  CHECK(tile.result_num_between_pos(2, 10) == 8);
+  CHECK(tile.pos_with_given_result_sum(2, 8) == 9);
+}
+
 TEST_CASE_METHOD(
     CResultTileFx,
     "Test compute_results_count_sparse_string non overlapping",
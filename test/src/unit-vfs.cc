@@ -32,6 +32,7 @@
 
 #include <test/support/tdb_catch.h>
 #include <atomic>
+#include <cstring>
 #include "test/support/src/helpers.h"
 #include "tiledb/sm/filesystem/vfs.h"
 #ifdef _WIN32
@@ -351,3 +352,58 @@ TEST_CASE("VFS: test ls_with_sizes", "[vfs][ls-with-sizes]") {
   // Clean up
   REQUIRE(vfs_ls.remove_dir(URI(path)).ok());
 }
+
+TEST_CASE("VFS: test multi-region read", "[vfs][multi-region-read]") {
+  ThreadPool compute_tp(4);
+  ThreadPool io_tp(4);
+  VFS vfs_mr{&g_helper_stats, &compute_tp, &io_tp, Config{}};
+
+#ifdef _WIN32
+  std::string path = tiledb::sm::Win::current_dir() + "\\vfs_mr_test\\";
+#else
+  std::string path = std::string("file://") + tiledb::sm::Posix::current_dir() +
+                     "/vfs_mr_test/";
+#endif
+
+  // Clean up
+  bool is_dir = false;
+  REQUIRE(vfs_mr.is_dir(URI(path), &is_dir).ok());
+  if (is_dir)
+    REQUIRE(vfs_mr.remove_dir(URI(path)).ok());
+
+  REQUIRE(vfs_mr.create_dir(URI(path)).ok());
+  URI testfile(path + "file");
+
+  // Write a buffer where every byte is its offset modulo 256.
+  std::vector<uint8_t> data(1024 * 1024);
+  for (uint64_t i = 0; i < data.size(); i++) {
+    data[i] = static_cast<uint8_t>(i);
+  }
+  REQUIRE(vfs_mr.write(testfile, data.data(), data.size()).ok());
+  REQUIRE(vfs_mr.close_file(testfile).ok());
+
+  // Read regions that are adjacent, gapped, overlapping and out of order.
+  const std::vector<uint64_t> offsets = {100, 612, 4, 1000, 500000, 500100};
+  const std::vector<uint64_t> sizes = {512, 100, 10, 3000, 150, 200};
+  std::vector<std::vector<uint8_t>> buffers;
+  std::vector<std::tuple<uint64_t, void*, uint64_t>> regions;
+  buffers.reserve(offsets.size());
+  for (uint64_t i = 0; i < offsets.size(); i++) {
+    buffers.emplace_back(sizes[i]);
+    regions.emplace_back(offsets[i], buffers.back().data(), sizes[i]);
+  }
+  REQUIRE(vfs_mr.read_multi_region(testfile, regions).ok());
+
+  // Check every region against the written data.
+  for (uint64_t i = 0; i < offsets.size(); i++) {
+    REQUIRE(
+        std::memcmp(buffers[i].data(), data.data() + offsets[i], sizes[i]) ==
+        0);
+  }
+
+  // An empty region list is a no-op.
+  REQUIRE(vfs_mr.read_multi_region(testfile, {}).ok());
+
+  // Clean up
+  REQUIRE(vfs_mr.remove_dir(URI(path)).ok());
+}
@@ -0,0 +1,188 @@
+/**
+ * @file   array_generator.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines the deterministic synthetic array generator.
+ */
+
+#include "test/support/src/array_generator.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace tiledb {
+namespace test {
+
+ArrayGenerator::ArrayGenerator(const Context& ctx, const Params& params)
+    : ctx_(ctx)
+    , params_(params) {
+  if (params_.dim_num == 0 || params_.fragment_num == 0) {
+    throw std::invalid_argument(
+        "ArrayGenerator; dim_num and fragment_num must be non-zero");
+  }
+  if (params_.tile_extent > params_.dim_size) {
+    throw std::invalid_argument(
+        "ArrayGenerator; tile_extent must not exceed dim_size");
+  }
+}
+
+void ArrayGenerator::generate_dense(const std::string& uri) const {
+  create_array(uri, TILEDB_DENSE);
+
+  // Cells per row of the first dimension.
+  uint64_t row_cells = 1;
+  for (unsigned d = 1; d < params_.dim_num; d++) {
+    row_cells *= (uint64_t)params_.dim_size;
+  }
+
+  Array array(ctx_, uri, TILEDB_WRITE);
+  for (unsigned f = 0; f < params_.fragment_num; f++) {
+    auto [start, end] = fragment_slab(f);
+    std::mt19937_64 rng(params_.seed + f);
+    auto data =
+        attribute_values((uint64_t)(end - start + 1) * row_cells, rng);
+
+    Subarray subarray(ctx_, array);
+    subarray.add_range(0, start, end);
+    for (unsigned d = 1; d < params_.dim_num; d++) {
+      subarray.add_range(d, (int64_t)1, params_.dim_size);
+    }
+
+    Query query(ctx_, array, TILEDB_WRITE);
+    query.set_layout(TILEDB_ROW_MAJOR)
+        .set_subarray(subarray)
+        .set_data_buffer("a", data);
+    query.submit();
+  }
+  array.close();
+}
+
+void ArrayGenerator::generate_sparse(const std::string& uri) const {
+  create_array(uri, TILEDB_SPARSE);
+
+  Array array(ctx_, uri, TILEDB_WRITE);
+  for (unsigned f = 0; f < params_.fragment_num; f++) {
+    auto [start, end] = fragment_slab(f);
+    std::mt19937_64 rng(params_.seed + f);
+
+    // Coordinates are drawn with the fragment's slab on the first
+    // dimension and the full domain on the others. Modulo on the raw
+    // engine output is used instead of a distribution so that the
+    // output is identical across standard library implementations.
+    std::vector<std::vector<int64_t>> coords(params_.dim_num);
+    for (unsigned d = 0; d < params_.dim_num; d++) {
+      auto low = (d == 0) ? start : 1;
+      auto high = (d == 0) ? end : params_.dim_size;
+      auto range = (uint64_t)(high - low + 1);
+      coords[d].reserve(params_.cells_per_fragment);
+      for (uint64_t c = 0; c < params_.cells_per_fragment; c++) {
+        coords[d].emplace_back(low + (int64_t)(rng() % range));
+      }
+    }
+    auto data = attribute_values(params_.cells_per_fragment, rng);
+
+    Query query(ctx_, array, TILEDB_WRITE);
+    query.set_layout(TILEDB_UNORDERED).set_data_buffer("a", data);
+    for (unsigned d = 0; d < params_.dim_num; d++) {
+      query.set_data_buffer("d" + std::to_string(d), coords[d]);
+    }
+    query.submit();
+  }
+  array.close();
+}
+
+void ArrayGenerator::create_array(
+    const std::string& uri, tiledb_array_type_t type) const {
+  Domain domain(ctx_);
+  for (unsigned d = 0; d < params_.dim_num; d++) {
+    domain.add_dimension(Dimension::create<int64_t>(
+        ctx_,
+        "d" + std::to_string(d),
+        {{1, params_.dim_size}},
+        params_.tile_extent));
+  }
+
+  ArraySchema schema(ctx_, type);
+  schema.set_domain(domain);
+  if (type == TILEDB_SPARSE) {
+    schema.set_allows_dups(true);
+  }
+
+  auto a = Attribute::create<int64_t>(ctx_, "a");
+  if (params_.attribute_filters.has_value()) {
+    a.set_filter_list(params_.attribute_filters.value());
+  }
+  schema.add_attribute(a);
+
+  Array::create(uri, schema);
+}
+
+std::pair<int64_t, int64_t> ArrayGenerator::fragment_slab(unsigned f) const {
+  auto rows = std::max<int64_t>(
+      1, params_.dim_size / (int64_t)params_.fragment_num);
+
+  int64_t start = 1;
+  switch (params_.overlap) {
+    case FragmentOverlap::DISJOINT:
+      start += (int64_t)f * rows;
+      break;
+    case FragmentOverlap::HALF_OVERLAP:
+      start += (int64_t)f * std::max<int64_t>(1, rows / 2);
+      break;
+    case FragmentOverlap::FULL_OVERLAP:
+      break;
+  }
+
+  start = std::min(start, params_.dim_size);
+  auto end = std::min(start + rows - 1, params_.dim_size);
+  return {start, end};
+}
+
+std::vector<int64_t> ArrayGenerator::attribute_values(
+    uint64_t n, std::mt19937_64& rng) const {
+  std::vector<int64_t> values;
+  values.reserve(n);
+  for (uint64_t c = 0; c < n; c++) {
+    switch (params_.entropy) {
+      case EntropyProfile::CONSTANT:
+        values.emplace_back(42);
+        break;
+      case EntropyProfile::LOW:
+        values.emplace_back((int64_t)(rng() % 16));
+        break;
+      case EntropyProfile::HIGH:
+        values.emplace_back((int64_t)rng());
+        break;
+    }
+  }
+
+  return values;
+}
+
+}  // namespace test
+}  // namespace tiledb
@@ -0,0 +1,175 @@
+/**
+ * @file   array_generator.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file declares a deterministic synthetic array generator for tests
+ * and benchmarks. Given a seed and a workload description (dimensions,
+ * attribute entropy profile, fragment overlap pattern), it creates an
+ * array and writes its fragments through the C++ API, producing
+ * bit-identical data for identical parameters so that performance
+ * numbers measured by different experiments are comparable.
+ */
+
+#ifndef TILEDB_TEST_ARRAY_GENERATOR_H
+#define TILEDB_TEST_ARRAY_GENERATOR_H
+
+#include "tiledb/sm/cpp_api/tiledb"
+
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace tiledb {
+namespace test {
+
+/** Entropy profile for generated attribute values. */
+enum class EntropyProfile {
+  /** Every cell holds the same value; maximally compressible. */
+  CONSTANT,
+  /** Values are drawn from a small alphabet; compresses well. */
+  LOW,
+  /** Full-width random values; effectively incompressible. */
+  HIGH
+};
+
+/** How the domains of consecutively written fragments relate. */
+enum class FragmentOverlap {
+  /** Consecutive slabs along the first dimension; no overlap. */
+  DISJOINT,
+  /** Each fragment overlaps half of the previous one. */
+  HALF_OVERLAP,
+  /** All fragments cover the same slab; full overwrites. */
+  FULL_OVERLAP
+};
+
+/**
+ * Generates synthetic arrays with deterministic, seeded content.
+ *
+ * Arrays have `dim_num` int64 dimensions, each with domain
+ * `[1, dim_size]` and tile extent `tile_extent`, and a single int64
+ * attribute `a` whose values follow the configured entropy profile.
+ * Fragments are laid out along the first dimension according to the
+ * configured overlap pattern.
+ */
+class ArrayGenerator {
+ public:
+  /* ********************************* */
+  /*         TYPE DEFINITIONS          */
+  /* ********************************* */
+
+  /** Workload description; equal parameters yield identical arrays. */
+  struct Params {
+    /** Seed for all generated coordinates and values. */
+    uint64_t seed = 0;
+
+    /** Number of int64 dimensions, each with domain `[1, dim_size]`. */
+    unsigned dim_num = 1;
+
+    /** Domain size of every dimension. */
+    int64_t dim_size = 1000;
+
+    /** Tile extent of every dimension. */
+    int64_t tile_extent = 100;
+
+    /** Number of fragments to write. */
+    unsigned fragment_num = 1;
+
+    /** Cells per sparse fragment; ignored for dense arrays. */
+    uint64_t cells_per_fragment = 1000;
+
+    /** How the domains of consecutive fragments relate. */
+    FragmentOverlap overlap = FragmentOverlap::DISJOINT;
+
+    /** Entropy profile of attribute `a`. */
+    EntropyProfile entropy = EntropyProfile::HIGH;
+
+    /** Optional filter list for attribute `a`. */
+    std::optional<FilterList> attribute_filters = std::nullopt;
+  };
+
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param ctx TileDB context.
+   * @param params Workload description.
+   */
+  ArrayGenerator(const Context& ctx, const Params& params);
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** Creates a dense array at `uri` and writes its fragments. */
+  void generate_dense(const std::string& uri) const;
+
+  /**
+   * Creates a sparse array at `uri` and writes its fragments. The array
+   * allows duplicates so that generated coordinates need no
+   * deduplication.
+   */
+  void generate_sparse(const std::string& uri) const;
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE METHODS           */
+  /* ********************************* */
+
+  /** Creates the array at `uri` with the configured schema. */
+  void create_array(const std::string& uri, tiledb_array_type_t type) const;
+
+  /**
+   * Returns the inclusive slab `[start, end]` of fragment `f` along the
+   * first dimension, following the configured overlap pattern.
+   */
+  std::pair<int64_t, int64_t> fragment_slab(unsigned f) const;
+
+  /** Returns `n` attribute values following the entropy profile. */
+  std::vector<int64_t> attribute_values(
+      uint64_t n, std::mt19937_64& rng) const;
+
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** The TileDB context. */
+  const Context& ctx_;
+
+  /** The workload description. */
+  Params params_;
+};
+
+}  // namespace test
+}  // namespace tiledb
+
+#endif  // TILEDB_TEST_ARRAY_GENERATOR_H
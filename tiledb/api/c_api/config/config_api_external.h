@@ -99,6 +99,13 @@ TILEDB_EXPORT void tiledb_config_free(tiledb_config_t** config) TILEDB_NOEXCEPT;
  *    **Experimental** <br>
  *    Allow update queries. Experimental for testing purposes, do not use.<br>
  *    **Default**: false
+ * - `sm.array.prefetch_fragment_metadata` <br>
+ *    **Experimental** <br>
+ *    If `true`, opening an array for reads loads the fragment metadata in
+ *    the background and the open call returns as soon as the array schemas
+ *    are loaded. The first access to the fragment metadata (e.g. by the
+ *    first query) joins the load. <br>
+ *    **Default**: false
  * - `sm.dedup_coords` <br>
  *    If `true`, cells with duplicate coordinates will be removed during sparse
  *    fragment writes. Note that ties during deduplication are broken
@@ -128,6 +135,12 @@ TILEDB_EXPORT void tiledb_config_free(tiledb_config_t** config) TILEDB_NOEXCEPT;
  *    will not be merged and multiplicities will be returned.
  *    Experimental for testing purposes, do not use.<br>
  *    **Default**: true
+ * - `sm.zstd_train_dictionaries` <br>
+ *    If `true`, writes of fields compressed with zstd train a shared
+ *    compression dictionary from the written tiles, compress every tile
+ *    with it and store it in the fragment metadata. Readers pick the
+ *    dictionary up from the metadata without any configuration.<br>
+ *    **Default**: false
  * - `sm.enable_signal_handlers` <br>
  *    Determines whether or not TileDB will install signal handlers. <br>
  *    **Default**: true
@@ -137,6 +150,18 @@ TILEDB_EXPORT void tiledb_config_free(tiledb_config_t** config) TILEDB_NOEXCEPT;
  * - `sm.io_concurrency_level` <br>
  *    Upper-bound on number of threads to allocate for IO-bound tasks. <br>
  *    **Default*: # cores
+ * - `sm.numa.pin_threads` <br>
+ *    If `true`, compute and IO thread pool workers are pinned to the CPUs
+ *    of a single physical package each, so tasks and the buffers they first
+ *    touch stay local to one memory node. Linux only; ignored on other
+ *    platforms. <br>
+ *    **Default**: false
+ * - `sm.stats.trace_enabled` <br>
+ *    **Experimental** <br>
+ *    If `true`, timer stats of queries submitted with this config are
+ *    recorded as timestamped trace events, dumped in the Chrome trace
+ *    event format. <br>
+ *    **Default**: false
  * - `sm.vacuum.mode` <br>
  *    The vacuuming mode, one of
  *    `commits` (remove only consolidated commit files),
@@ -154,6 +179,15 @@ TILEDB_EXPORT void tiledb_config_free(tiledb_config_t** config) TILEDB_NOEXCEPT;
  *    file), `array_meta` (consolidate array metadata only), or `group_meta`
  *    (consolidate group metadata only). <br>
  *    **Default**: "fragments"
+ * - `sm.commit_batch_size` <br>
+ *    **Experimental** <br>
+ *    The number of fragment commits to accumulate per array before making
+ *    them visible with a single consolidated commits file, reducing the
+ *    write request count for streaming ingest that creates many small
+ *    fragments. Batched fragments become visible when the batch fills or
+ *    when the array is closed. A value of one writes a commit file per
+ *    fragment. <br>
+ *    **Default**: 1
  * - `sm.consolidation.amplification` <br>
  *    The factor by which the size of the dense fragment resulting
  *    from consolidating a set of fragments (containing at least one
@@ -191,6 +225,14 @@ TILEDB_EXPORT void tiledb_config_free(tiledb_config_t** config) TILEDB_NOEXCEPT;
  *    The size ratio that two ("adjacent") fragments must satisfy to be
  *    considered for consolidation in a single step.<br>
  *    **Default**: 0.0
+ * - `sm.consolidation.min_interleave_ratio` <br>
+ *    **Experimental** <br>
+ *    The minimum ratio of tiles that must interleave with another
+ *    fragment (i.e. their R-tree MBR overlaps the non-empty domain of
+ *    another fragment in the set) for a set of sparse fragments to be
+ *    considered for consolidation in a single step. 0.0 disables the
+ *    check.<br>
+ *    **Default**: 0.0
  * - `sm.consolidation.timestamp_start` <br>
  *    **Experimental** <br>
  *    When set, an array will be consolidated between this value and
@@ -211,6 +253,41 @@ TILEDB_EXPORT void tiledb_config_free(tiledb_config_t** config) TILEDB_NOEXCEPT;
  *    The memory budget for tiles of var-sized attributes
  *    to be fetched during reads.<br>
  *    **Default**: 10GB
+ * - `sm.unfilter_min_chunks_per_task` <br>
+ *    The minimum number of tile chunks processed by one compute task when
+ *    unfiltering a tile during reads.<br>
+ *    **Default**: 4
+ * - `sm.tile_cache_size` <br>
+ *    The size (in bytes) of the cache of unfiltered tiles shared by all
+ *    queries on a context. A value of zero disables the cache.<br>
+ *    **Default**: 10,000,000
+ * - `sm.fragment_footer_cache_size` <br>
+ *    The size (in bytes) of the cache of fragment metadata footers
+ *    shared by all array opens on a context. A value of zero disables
+ *    the cache.<br>
+ *    **Default**: 10,000,000
+ * - `sm.group_details_cache_size` <br>
+ *    The size (in bytes) of the cache of group details file contents
+ *    shared by all group opens on a context. A value of zero disables
+ *    the cache.<br>
+ *    **Default**: 10,000,000
+ * - `sm.enumeration_cache_size` <br>
+ *    The size (in bytes) of the cache of loaded enumerations shared by
+ *    all array opens on a context. A value of zero disables the
+ *    cache.<br>
+ *    **Default**: 10,000,000
+ * - `sm.deletion_vector_cache_size` <br>
+ *    The size (in bytes) of the cache of materialized per-tile delete
+ *    condition verdicts shared by all queries on a context, sparing
+ *    repeated queries the re-evaluation of old delete conditions. A
+ *    value of zero disables the cache.<br>
+ *    **Default**: 10,000,000
+ * - `sm.array_schema_cache_size` <br>
+ *    The size (in bytes) of the cache of array schema file contents
+ *    shared by all array opens on a context, sparing opens of
+ *    heavily-evolved arrays one read per schema file. A value of zero
+ *    disables the cache.<br>
+ *    **Default**: 10,000,000
  * - `sm.var_offsets.bitsize` <br>
  *    The size of offsets in bits to be used for offset buffers of var-sized
  *    attributes<br>
@@ -223,9 +300,57 @@ TILEDB_EXPORT void tiledb_config_free(tiledb_config_t** config) TILEDB_NOEXCEPT;
  *    The offsets format (`bytes` or `elements`) to be used for
  *    var-sized attributes.<br>
  *    **Default**: bytes
+ * - `sm.validity.mode` <br>
+ *    The validity format (`bytemap` or `bitmap`) to be used for
+ *    nullable attributes on read queries. `bitmap` packs validity into
+ *    Arrow-style bitmaps (LSB first); combined with
+ *    `sm.var_offsets.bitsize` 64 and `sm.var_offsets.extra_element` true,
+ *    result buffers conform to the Arrow layout.<br>
+ *    **Default**: bytemap
+ * - `sm.query.attribute_prefetch_depth` <br>
+ *    Number of attribute batches the sparse readers read ahead of the
+ *    batch being copied to the user buffers, overlapping the batch I/O
+ *    with the copy CPU work. Bounded by the reader memory budget; zero
+ *    disables read ahead.<br>
+ *    **Default**: 0
  * - `sm.query.dense.reader` <br>
  *    Which reader to use for dense queries. "refactored" or "legacy".<br>
  *    **Default**: refactored
+ * - `sm.query.global_order_writer.pipelined_io` <br>
+ *    **Experimental** <br>
+ *    If `true`, global order writes overlap tile filtering with the
+ *    I/O of previously filtered tiles.<br>
+ *    **Default**: false
+ * - `sm.query.priority` <br>
+ *    **Experimental** <br>
+ *    The scheduling priority class of the query's I/O, "normal" or
+ *    "background". Background I/O yields to normal I/O on the shared
+ *    I/O thread pool, keeping a small weighted share so it cannot
+ *    starve.<br>
+ *    **Default**: normal
+ * - `sm.query.profile_guided.enable` <br>
+ *    **Experimental** <br>
+ *    If `true`, completed read queries record their execution profile,
+ *    keyed by array and subarray shape, and later reads with the same
+ *    shape consult the profile to pre-size their memory budget.<br>
+ *    **Default**: false
+ * - `sm.query.slow_log.threshold_ms` <br>
+ *    Queries whose submit takes longer than this many milliseconds have
+ *    their query plan, subarray summary, fragment count and per-phase
+ *    stats logged automatically as a JSON report. Zero disables the
+ *    slow query log.<br>
+ *    **Default**: 0
+ * - `sm.query.slow_log.file` <br>
+ *    The file slow query reports are appended to. When empty, the
+ *    reports are written to the TileDB log.<br>
+ *    **Default**: ""
+ * - `sm.query.sparse.result_budget_cells` <br>
+ *    **Experimental** <br>
+ *    An upper limit, in cells, on how many result tile cells the sparse
+ *    readers schedule for I/O ahead of what the user buffers consume.
+ *    Useful for preview or sampling queries that only look at the first
+ *    cells of a large subarray. Zero means no limit.<br>
+ *    **Default**: 0
  * - `sm.query.sparse_global_order.reader` <br>
  *    Which reader to use for sparse global order queries. "refactored"
  *    or "legacy".<br>
@@ -234,6 +359,27 @@ TILEDB_EXPORT void tiledb_config_free(tiledb_config_t** config) TILEDB_NOEXCEPT;
  *    Which reader to use for sparse unordered with dups queries.
  *    "refactored" or "legacy".<br>
  *    **Default**: refactored
+ * - `sm.query.sparse_unordered_with_dups.tile_completion_order` <br>
+ *    **Experimental** <br>
+ *    If `true`, the sparse unordered with dups reader copies each result
+ *    tile to the user buffers in a single fused pass over all fixed-size
+ *    fields, in tile completion order, instead of copying field by field.
+ *    Only kicks in for queries without var-sized output fields or
+ *    aggregates.<br>
+ *    **Default**: false
+ * - `sm.query_result_cache_size` <br>
+ *    **Experimental** <br>
+ *    The size (in bytes) of the cache of read query results shared by
+ *    all queries on a context, keyed on a fingerprint of the query and
+ *    the array snapshot it was submitted against. Repeat submissions of
+ *    an identical query on an unchanged array are served from memory. A
+ *    value of zero disables the cache.<br>
+ *    **Default**: 0
+ * - `sm.mem.hugepages` <br>
+ *    If `true`, large tile buffer allocations are advised to the kernel for
+ *    transparent huge page backing, reducing TLB pressure when filtering and
+ *    unfiltering large tiles. Process wide; Linux only. <br>
+ *    **Default**: false
  * - `sm.mem.malloc_trim` <br>
  *    Should malloc_trim be called on context and query destruction? This might
  *    reduce residual memory usage. <br>
@@ -252,6 +398,11 @@ TILEDB_EXPORT void tiledb_config_free(tiledb_config_t** config) TILEDB_NOEXCEPT;
  * - `sm.mem.total_budget` <br>
  *    Memory budget for readers and writers. <br>
  *    **Default**: 10GB
+ * - `sm.mem.context_budget` <br>
+ *    Memory budget shared by everything running on a context. Queries
+ *    throttle new tile reads when the combined usage would exceed it
+ *    instead of failing. A value of zero means no limit. <br>
+ *    **Default**: 0
  * - `sm.mem.reader.sparse_global_order.ratio_coords` <br>
  *    Ratio of the budget allocated for coordinates in the sparse global
  *    order reader. <br>
@@ -303,11 +454,32 @@ TILEDB_EXPORT void tiledb_config_free(tiledb_config_t** config) TILEDB_NOEXCEPT;
  * - `vfs.read_ahead_cache_size` <br>
  *    The the total maximum size of the read-ahead cache, which is an LRU. <br>
  *    **Default**: 10485760
+ * - `vfs.disk_cache.enable` <br>
+ *    **Experimental** <br>
+ *    If `true`, blocks read from remote backends are spilled to a
+ *    persistent local disk cache and served from it on repeated reads.
+ *    Requires `vfs.disk_cache.dir` to be set. <br>
+ *    **Default**: false
+ * - `vfs.disk_cache.dir` <br>
+ *    **Experimental** <br>
+ *    The local directory the disk cache stores its block files in. <br>
+ *    **Default**: ""
+ * - `vfs.disk_cache.size` <br>
+ *    **Experimental** <br>
+ *    The maximum total size (in bytes) of the disk cache, which is an
+ *    LRU. <br>
+ *    **Default**: 10737418240
  * - `vfs.min_parallel_size` <br>
  *    The minimum number of bytes in a parallel VFS operation
  *    (except parallel S3 writes, which are controlled by
  *    `vfs.s3.multipart_part_size`). <br>
  *    **Default**: 10MB
+ * - `vfs.adaptive_parallel_ops` <br>
+ *    If `true`, the number of parallel operations a remote-backend VFS
+ *    read is split into is tuned at runtime from observed read
+ *    throughput, per backend and request-size class, instead of always
+ *    using the configured per-backend maximum. <br>
+ *    **Default**: false
  * - `vfs.max_batch_size` <br>
  *    The maximum number of bytes in a VFS read operation<br>
  *    **Default**: UINT64_MAX
@@ -340,6 +512,21 @@ TILEDB_EXPORT void tiledb_config_free(tiledb_config_t** config) TILEDB_NOEXCEPT;
  * - `vfs.file.posix_directory_permissions` <br>
  *    Permissions to use for posix file system with directory creation.<br>
  *    **Default**: 755
+ * - `vfs.file.posix_use_mmap` <br>
+ *    If `true`, posix reads are served from cached read-only mmap regions
+ *    instead of an open/pread/close sequence per read. <br>
+ *    **Default**: false
+ * - `vfs.file.posix_use_io_uring` <br>
+ *    If `true`, batched posix reads are submitted through io_uring
+ *    instead of one blocking pread per region. Silently ignored when
+ *    the kernel has no io_uring support. <br>
+ *    **Default**: false
+ * - `vfs.file.posix_direct_io` <br>
+ *    If `true`, posix reads and writes bypass the OS page cache with
+ *    `O_DIRECT`. Useful for streaming workloads, e.g. consolidation,
+ *    that should not evict cached data needed by concurrent readers.
+ *    Silently ignored when the filesystem does not support it. <br>
+ *    **Default**: false
  * - `vfs.azure.storage_account_name` <br>
  *    Set the name of the Azure Storage account to use. <br>
  *    **Default**: ""
@@ -371,6 +558,12 @@ TILEDB_EXPORT void tiledb_config_free(tiledb_config_t** config) TILEDB_NOEXCEPT;
  * - `vfs.azure.use_block_list_upload` <br>
  *    Determines if the Azure backend can use chunked block uploads. <br>
  *    **Default**: "true"
+ * - `vfs.azure.use_streaming_upload` <br>
+ *    Determines if Azure block uploads are dispatched without waiting
+ *    for them to complete, overlapping uploads with later writes. Also
+ *    grows the staged block size as the blob grows. Ignored if
+ *    `vfs.azure.use_block_list_upload` is set to false. <br>
+ *    **Default**: "true"
  * - `vfs.azure.max_retries` <br>
  *    The maximum number of times to retry an Azure network request. <br>
  *    **Default**: 5
@@ -397,6 +590,11 @@ TILEDB_EXPORT void tiledb_config_free(tiledb_config_t** config) TILEDB_NOEXCEPT;
  * - `vfs.gcs.use_multi_part_upload` <br>
  *    Determines if the GCS backend can use chunked part uploads. <br>
  *    **Default**: "true"
+ * - `vfs.gcs.use_streaming_upload` <br>
+ *    Determines if GCS part uploads are dispatched without waiting for
+ *    them to complete, overlapping uploads with later writes. Ignored
+ *    if `vfs.gcs.use_multi_part_upload` is set to false. <br>
+ *    **Default**: "true"
  * - `vfs.gcs.request_timeout_ms` <br>
  *    The maximum amount of time to retry network requests to GCS. <br>
  *    **Default**: "3000"
@@ -446,6 +644,13 @@ TILEDB_EXPORT void tiledb_config_free(tiledb_config_t** config) TILEDB_NOEXCEPT;
  * - `vfs.s3.skip_init` <br>
  *    Skip Aws::InitAPI for the S3 layer (`true` or `false`) <br>
  *    **Default**: false
+ * - `vfs.s3.eager_init` <br>
+ *    **Experimental** <br>
+ *    Initialize the S3 client eagerly in a background task at context
+ *    creation (`true` or `false`), so that credential resolution and TLS
+ *    setup overlap user code instead of delaying the first S3
+ *    operation. <br>
+ *    **Default**: false
  * - `vfs.s3.use_multipart_upload` <br>
  *    The S3 use of multi-part upload requests (`true` or `false`), if S3 is
  *    enabled. <br>
@@ -65,6 +65,8 @@ TILEDB_FILTER_TYPE_ENUM(FILTER_NONE) = 0,
     TILEDB_FILTER_TYPE_ENUM(FILTER_WEBP) = 18,
     /** Delta filter. */
     TILEDB_FILTER_TYPE_ENUM(FILTER_DELTA) = 19,
+    /** CRC32C checksum filter. */
+    TILEDB_FILTER_TYPE_ENUM(FILTER_CHECKSUM_CRC32C) = 20,
 #endif
 
 #ifdef TILEDB_FILTER_OPTION_ENUM
@@ -0,0 +1,295 @@
+/**
+ * @file arena_allocator.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * `MemoryArena` is a chunked pool for small, uniformly-sized allocations
+ * such as linked-list nodes. `ArenaAllocator` adapts an arena to the
+ * standard allocator interface so that it can back standard containers.
+ */
+
+#ifndef TILEDB_COMMON_DYNAMIC_MEMORY_ARENA_ALLOCATOR_H
+#define TILEDB_COMMON_DYNAMIC_MEMORY_ARENA_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+#include <vector>
+
+#include "tiledb/common/macros.h"
+
+namespace tiledb::common {
+
+/**
+ * A chunked memory pool. Memory is carved out of large chunks with a bump
+ * pointer and handed back through per-size free lists, so that steady-state
+ * allocation and deallocation never touch the system allocator. All chunks
+ * are returned to the system at once when the arena is released or
+ * destroyed.
+ *
+ * The arena is thread-safe; a single mutex guards the bump pointer and the
+ * free lists. It is intended for allocations that are small relative to the
+ * chunk size, e.g. container nodes; each allocation size in use gets its
+ * own free list, so the number of distinct sizes should stay small.
+ */
+class MemoryArena {
+ public:
+  /** The default size of the chunks carved out of the system allocator. */
+  static constexpr size_t default_chunk_size = 64 * 1024;
+
+  /**
+   * Constructor.
+   *
+   * @param chunk_size The size of the chunks carved out of the system
+   *     allocator. Allocations larger than this size get a dedicated
+   *     chunk of their own.
+   */
+  explicit MemoryArena(size_t chunk_size = default_chunk_size)
+      : chunk_size_(chunk_size)
+      , position_(nullptr)
+      , remaining_(0)
+      , reserved_(0) {
+  }
+
+  /** Destructor. Releases all chunks. */
+  ~MemoryArena() = default;
+
+  DISABLE_COPY_AND_COPY_ASSIGN(MemoryArena);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(MemoryArena);
+
+  /**
+   * Allocates a block of at least `size` bytes, aligned for any
+   * non-overaligned type. The block remains valid until it is deallocated
+   * or the arena is released.
+   *
+   * @param size The allocation size, in bytes.
+   * @return A pointer to the allocated block.
+   */
+  void* allocate(size_t size) {
+    const auto rounded_size = round_size(size);
+    std::lock_guard<std::mutex> lg(mutex_);
+
+    // Reuse a previously deallocated block of the same size, if any.
+    auto it = free_lists_.find(rounded_size);
+    if (it != free_lists_.end() && it->second != nullptr) {
+      auto block = it->second;
+      it->second = block->next_;
+      return block;
+    }
+
+    // Allocations that do not fit in a chunk get a dedicated chunk,
+    // leaving the bump pointer untouched.
+    if (rounded_size > chunk_size_) {
+      return add_chunk(rounded_size);
+    }
+
+    if (remaining_ < rounded_size) {
+      position_ = static_cast<char*>(add_chunk(chunk_size_));
+      remaining_ = chunk_size_;
+    }
+
+    auto p = position_;
+    position_ += rounded_size;
+    remaining_ -= rounded_size;
+    return p;
+  }
+
+  /**
+   * Returns a block to the arena for reuse by a subsequent allocation of
+   * the same size. The block itself is not returned to the system until
+   * the arena is released.
+   *
+   * @param p The block to deallocate.
+   * @param size The size the block was allocated with, in bytes.
+   */
+  void deallocate(void* p, size_t size) {
+    const auto rounded_size = round_size(size);
+    std::lock_guard<std::mutex> lg(mutex_);
+    auto block = static_cast<FreeBlock*>(p);
+    auto& free_list = free_lists_[rounded_size];
+    block->next_ = free_list;
+    free_list = block;
+  }
+
+  /**
+   * Returns all chunks to the system at once. Outstanding allocations are
+   * invalidated; the caller is responsible for ensuring there are none.
+   */
+  void release() {
+    std::lock_guard<std::mutex> lg(mutex_);
+    chunks_.clear();
+    free_lists_.clear();
+    position_ = nullptr;
+    remaining_ = 0;
+    reserved_ = 0;
+  }
+
+  /** Returns the total number of bytes reserved from the system. */
+  uint64_t reserved() const {
+    std::lock_guard<std::mutex> lg(mutex_);
+    return reserved_;
+  }
+
+ private:
+  /** A deallocated block, linked into a per-size free list. */
+  struct FreeBlock {
+    /** The next block in the free list. */
+    FreeBlock* next_;
+  };
+
+  /**
+   * Rounds an allocation size up so that successive bump allocations stay
+   * aligned for any non-overaligned type and blocks can hold a free-list
+   * link.
+   */
+  static size_t round_size(size_t size) {
+    constexpr size_t alignment = alignof(std::max_align_t);
+    static_assert(sizeof(FreeBlock) <= alignment);
+    return (size + alignment - 1) / alignment * alignment;
+  }
+
+  /** Reserves a new chunk from the system and returns its base address. */
+  void* add_chunk(size_t size) {
+    chunks_.emplace_back(new char[size]);
+    reserved_ += size;
+    return chunks_.back().get();
+  }
+
+  /** The size of the chunks reserved from the system. */
+  size_t chunk_size_;
+
+  /** Protects all member variables. */
+  mutable std::mutex mutex_;
+
+  /** The chunks reserved from the system. */
+  std::vector<std::unique_ptr<char[]>> chunks_;
+
+  /** The bump pointer into the current chunk. */
+  char* position_;
+
+  /** The number of bytes remaining in the current chunk. */
+  size_t remaining_;
+
+  /** The total number of bytes reserved from the system. */
+  uint64_t reserved_;
+
+  /** The heads of the per-size free lists. */
+  std::unordered_map<size_t, FreeBlock*> free_lists_;
+};
+
+/**
+ * An allocator over a `MemoryArena`, suitable for standard containers. The
+ * allocator holds a non-owning pointer to its arena, which must outlive
+ * every container and block allocated through it. A default-constructed
+ * allocator has no arena and falls back to the global heap, so that
+ * default-constructed containers remain usable; such containers adopt the
+ * arena when move-assigned from an arena-backed container, as all the
+ * propagation traits are enabled.
+ *
+ * @tparam T Allocation type
+ */
+template <class T>
+class ArenaAllocator {
+ public:
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+  using is_always_equal = std::false_type;
+
+  /** Default constructor. The allocator falls back to the global heap. */
+  ArenaAllocator() noexcept
+      : arena_(nullptr) {
+  }
+
+  /**
+   * Constructor.
+   *
+   * @param arena The arena to allocate from. Must outlive the allocator
+   *     and everything allocated through it.
+   */
+  explicit ArenaAllocator(MemoryArena* arena) noexcept
+      : arena_(arena) {
+  }
+
+  /**
+   * Conversion constructor creates an allocator for T over the arena of an
+   * allocator for V.
+   *
+   * @tparam V Allocation type of the source allocator
+   */
+  template <class V>
+  ArenaAllocator(const ArenaAllocator<V>& x) noexcept
+      : arena_(x.arena()) {
+  }
+
+  /** Allocates storage for `n` objects of type T. */
+  T* allocate(std::size_t n) {
+    if (arena_ == nullptr) {
+      return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+    return static_cast<T*>(arena_->allocate(n * sizeof(T)));
+  }
+
+  /** Deallocates storage previously obtained from `allocate`. */
+  void deallocate(T* p, std::size_t n) noexcept {
+    if (arena_ == nullptr) {
+      ::operator delete(p);
+      return;
+    }
+    arena_->deallocate(p, n * sizeof(T));
+  }
+
+  /** Returns the arena, or `nullptr` for a default-constructed allocator. */
+  MemoryArena* arena() const noexcept {
+    return arena_;
+  }
+
+ private:
+  /** The arena allocated from. Non-owning. */
+  MemoryArena* arena_;
+};
+
+/** Allocators compare equal iff they allocate from the same arena. */
+template <class T, class V>
+bool operator==(
+    const ArenaAllocator<T>& a, const ArenaAllocator<V>& b) noexcept {
+  return a.arena() == b.arena();
+}
+
+template <class T, class V>
+bool operator!=(
+    const ArenaAllocator<T>& a, const ArenaAllocator<V>& b) noexcept {
+  return !(a == b);
+}
+
+}  // namespace tiledb::common
+
+#endif  // TILEDB_COMMON_DYNAMIC_MEMORY_ARENA_ALLOCATOR_H
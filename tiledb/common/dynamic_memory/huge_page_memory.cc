@@ -0,0 +1,91 @@
+/**
+ * @file   huge_page_memory.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Implements transparent huge page hints for large buffer allocations.
+ */
+
+#include "tiledb/common/dynamic_memory/huge_page_memory.h"
+
+#include <atomic>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace tiledb::common {
+
+namespace {
+std::atomic<bool> hugepage_enabled{false};
+std::atomic<uint64_t> hinted_allocations{0};
+std::atomic<uint64_t> hinted_bytes{0};
+}  // namespace
+
+void tdb_hugepage_enable(bool enable) {
+  hugepage_enabled.store(enable, std::memory_order_relaxed);
+}
+
+bool tdb_hugepage_enabled() {
+  return hugepage_enabled.load(std::memory_order_relaxed);
+}
+
+void tdb_hugepage_hint(void* p, size_t size) {
+  if (p == nullptr || size < hugepage_hint_threshold ||
+      !tdb_hugepage_enabled()) {
+    return;
+  }
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  // `madvise` requires a page aligned range; heap allocations are not, so
+  // shrink the range inward to page boundaries. The fraction of a large
+  // buffer lost to the boundary pages is negligible.
+  static const uintptr_t page_size =
+      static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+  const auto addr = reinterpret_cast<uintptr_t>(p);
+  const uintptr_t begin = (addr + page_size - 1) & ~(page_size - 1);
+  const uintptr_t end = (addr + size) & ~(page_size - 1);
+  if (end <= begin) {
+    return;
+  }
+
+  if (madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE) ==
+      0) {
+    hinted_allocations.fetch_add(1, std::memory_order_relaxed);
+    hinted_bytes.fetch_add(end - begin, std::memory_order_relaxed);
+  }
+#endif
+}
+
+HugePageStats tdb_hugepage_stats() {
+  return {
+      hinted_allocations.load(std::memory_order_relaxed),
+      hinted_bytes.load(std::memory_order_relaxed)};
+}
+
+}  // namespace tiledb::common
@@ -0,0 +1,85 @@
+/**
+ * @file   huge_page_memory.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Transparent huge page hints for large buffer allocations. Large tile
+ * buffers dominate the TLB footprint of filtering and unfiltering; advising
+ * the kernel to back them with transparent huge pages removes most of that
+ * pressure without a dedicated huge page pool.
+ */
+
+#ifndef TILEDB_COMMON_DYNAMIC_MEMORY_HUGE_PAGE_MEMORY_H
+#define TILEDB_COMMON_DYNAMIC_MEMORY_HUGE_PAGE_MEMORY_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace tiledb::common {
+
+/**
+ * Allocations at least this large get a transparent huge page hint. Smaller
+ * buffers span too few 2MiB pages for the hint to pay for the madvise call.
+ */
+constexpr size_t hugepage_hint_threshold = 4 * 1024 * 1024;
+
+/** Counters tracking transparent huge page adoption. */
+struct HugePageStats {
+  /** Number of allocations that received a huge page hint. */
+  uint64_t hinted_allocations;
+
+  /** Total bytes covered by huge page hints. */
+  uint64_t hinted_bytes;
+};
+
+/**
+ * Enables or disables huge page hints process wide. Hints are disabled by
+ * default and turned on through the `sm.mem.hugepages` config option when a
+ * context is created.
+ */
+void tdb_hugepage_enable(bool enable);
+
+/** Returns whether huge page hints are enabled. */
+bool tdb_hugepage_enabled();
+
+/**
+ * Advises the kernel to back the given allocation with transparent huge
+ * pages. No-op when hints are disabled, when the allocation is below
+ * `hugepage_hint_threshold` or on platforms without `madvise`. The hint is
+ * best effort; the buffer is valid either way.
+ *
+ * @param p The start of the allocation.
+ * @param size The allocation size, in bytes.
+ */
+void tdb_hugepage_hint(void* p, size_t size);
+
+/** Returns the huge page adoption counters. */
+HugePageStats tdb_hugepage_stats();
+
+}  // namespace tiledb::common
+
+#endif  // TILEDB_COMMON_DYNAMIC_MEMORY_HUGE_PAGE_MEMORY_H
@@ -0,0 +1,117 @@
+/**
+ * @file unit_arena_allocator.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file tests `MemoryArena` and `ArenaAllocator`.
+ */
+
+#include <list>
+
+#include <test/support/tdb_catch.h>
+
+#include "../arena_allocator.h"
+
+using namespace tiledb::common;
+
+TEST_CASE("MemoryArena - allocate reserves a chunk") {
+  MemoryArena arena;
+  REQUIRE(arena.reserved() == 0);
+  auto p = arena.allocate(32);
+  REQUIRE(p != nullptr);
+  CHECK(arena.reserved() == MemoryArena::default_chunk_size);
+}
+
+TEST_CASE("MemoryArena - allocations are distinct") {
+  MemoryArena arena;
+  auto p1 = arena.allocate(32);
+  auto p2 = arena.allocate(32);
+  CHECK(p1 != p2);
+}
+
+TEST_CASE("MemoryArena - deallocated block is reused") {
+  MemoryArena arena;
+  auto p1 = arena.allocate(32);
+  arena.deallocate(p1, 32);
+  auto p2 = arena.allocate(32);
+  CHECK(p1 == p2);
+
+  // A block of a different size does not hit the same free list.
+  arena.deallocate(p2, 32);
+  auto p3 = arena.allocate(128);
+  CHECK(p3 != p2);
+}
+
+TEST_CASE("MemoryArena - oversized allocation gets a dedicated chunk") {
+  MemoryArena arena(64);
+  auto p = arena.allocate(1024);
+  REQUIRE(p != nullptr);
+  CHECK(arena.reserved() >= 1024);
+}
+
+TEST_CASE("MemoryArena - release resets reservations") {
+  MemoryArena arena;
+  (void)arena.allocate(32);
+  arena.release();
+  CHECK(arena.reserved() == 0);
+}
+
+TEST_CASE("ArenaAllocator - default constructed falls back to the heap") {
+  ArenaAllocator<int> a;
+  REQUIRE(a.arena() == nullptr);
+  auto p = a.allocate(4);
+  REQUIRE(p != nullptr);
+  a.deallocate(p, 4);
+}
+
+TEST_CASE("ArenaAllocator - equality follows the arena") {
+  MemoryArena arena1, arena2;
+  ArenaAllocator<int> a1(&arena1), a2(&arena1);
+  ArenaAllocator<long> b(&arena2);
+  CHECK(a1 == a2);
+  CHECK(a1 != b);
+}
+
+TEST_CASE("ArenaAllocator - backs a list with node reuse") {
+  MemoryArena arena;
+  std::list<int, ArenaAllocator<int>> l{ArenaAllocator<int>(&arena)};
+  for (int i = 0; i < 100; ++i) {
+    l.push_back(i);
+  }
+  auto reserved = arena.reserved();
+  l.clear();
+  for (int i = 0; i < 100; ++i) {
+    l.push_back(i);
+  }
+  // The nodes of the second round come from the free lists.
+  CHECK(arena.reserved() == reserved);
+
+  // Move assignment propagates the allocator to a heap-backed list.
+  std::list<int, ArenaAllocator<int>> l2;
+  l2 = std::move(l);
+  CHECK(l2.get_allocator().arena() == &arena);
+}
@@ -34,6 +34,9 @@
 #ifndef TILEDB_MEMORY_TRACKER_H
 #define TILEDB_MEMORY_TRACKER_H
 
+#include <chrono>
+#include <condition_variable>
+
 #include "tiledb/common/status.h"
 
 namespace tiledb {
@@ -46,13 +49,15 @@ class MemoryTracker {
     FOOTER,
     TILE_OFFSETS,
     MIN_MAX_SUM_NULL_COUNT,
-    ENUMERATION
+    ENUMERATION,
+    TILE_DATA
   };
 
   /** Constructor. */
   MemoryTracker() {
     memory_usage_ = 0;
     memory_budget_ = std::numeric_limits<uint64_t>::max();
+    parent_ = nullptr;
   };
 
   /** Destructor. */
@@ -61,6 +66,18 @@ class MemoryTracker {
   DISABLE_COPY_AND_COPY_ASSIGN(MemoryTracker);
   DISABLE_MOVE_AND_MOVE_ASSIGN(MemoryTracker);
 
+  /**
+   * Link a parent tracker. Memory taken from this tracker is also taken
+   * from the parent, and transitively from its parents, so a higher level
+   * tracker (e.g. per-context) can cap the combined usage of the trackers
+   * below it (e.g. per-query). The parent must outlive this tracker.
+   *
+   * @param parent The parent tracker, or nullptr to unlink.
+   */
+  void set_parent(MemoryTracker* parent) {
+    parent_ = parent;
+  }
+
   /**
    * Take memory from the budget.
    *
@@ -68,25 +85,97 @@ class MemoryTracker {
    * @return true if the memory is available, false otherwise.
    */
   bool take_memory(uint64_t size, MemoryType mem_type) {
-    std::lock_guard<std::mutex> lg(mutex_);
-    if (memory_usage_ + size <= memory_budget_) {
-      memory_usage_ += size;
-      memory_usage_by_type_[mem_type] += size;
-      return true;
+    // Take from the parent chain first so that a rejection there leaves
+    // this tracker untouched.
+    if (parent_ != nullptr && !parent_->take_memory(size, mem_type)) {
+      return false;
+    }
+
+    {
+      std::lock_guard<std::mutex> lg(mutex_);
+      if (memory_usage_ + size <= memory_budget_ &&
+          memory_usage_by_type_[mem_type] + size <= budget_for_type(mem_type)) {
+        memory_usage_ += size;
+        memory_usage_by_type_[mem_type] += size;
+        return true;
+      }
+    }
+
+    if (parent_ != nullptr) {
+      parent_->release_memory(size, mem_type);
     }
 
     return false;
   }
 
+  /**
+   * Take memory from the budget, waiting for releases when over budget.
+   * This is the backpressure variant of `take_memory`: instead of failing
+   * right away when the budget is exhausted, the caller is throttled until
+   * other users of the tracker (or of its parents) release memory.
+   *
+   * @param size The memory size.
+   * @param mem_type The memory type.
+   * @param wait_ms Maximum time to wait for memory, in milliseconds.
+   * @return true if the memory was taken, false if the wait timed out or
+   * the request exceeds a budget and can never succeed.
+   */
+  bool take_memory_wait(uint64_t size, MemoryType mem_type, uint64_t wait_ms) {
+    // A request larger than a budget in the chain can never succeed.
+    if (!can_fit(size, mem_type)) {
+      return false;
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() +
+                          std::chrono::milliseconds(wait_ms);
+    while (!take_memory(size, mem_type)) {
+      std::unique_lock<std::mutex> lg(mutex_);
+      // Wait in small slices; a release on a parent tracker does not
+      // signal this tracker's condition variable.
+      cv_.wait_for(lg, std::chrono::milliseconds(10));
+      if (std::chrono::steady_clock::now() >= deadline) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  /**
+   * Checks whether a request of the input size could ever be satisfied by
+   * the budgets in the tracker chain, regardless of the current usage.
+   *
+   * @param size The memory size.
+   * @param mem_type The memory type.
+   * @return true if the request fits the budgets, false otherwise.
+   */
+  bool can_fit(uint64_t size, MemoryType mem_type) {
+    {
+      std::lock_guard<std::mutex> lg(mutex_);
+      if (size > memory_budget_ || size > budget_for_type(mem_type)) {
+        return false;
+      }
+    }
+
+    return parent_ == nullptr || parent_->can_fit(size, mem_type);
+  }
+
   /**
    * Release memory from the budget.
    *
    * @param size The memory size.
    */
   void release_memory(uint64_t size, MemoryType mem_type) {
-    std::lock_guard<std::mutex> lg(mutex_);
-    memory_usage_ -= size;
-    memory_usage_by_type_[mem_type] -= size;
+    {
+      std::lock_guard<std::mutex> lg(mutex_);
+      memory_usage_ -= size;
+      memory_usage_by_type_[mem_type] -= size;
+    }
+    cv_.notify_all();
+
+    if (parent_ != nullptr) {
+      parent_->release_memory(size, mem_type);
+    }
   }
 
   /**
@@ -96,12 +185,36 @@ class MemoryTracker {
    * @return true if the budget can be set, false otherwise.
    */
   bool set_budget(uint64_t size) {
-    std::lock_guard<std::mutex> lg(mutex_);
-    if (memory_usage_ > size) {
-      return false;
+    {
+      std::lock_guard<std::mutex> lg(mutex_);
+      if (memory_usage_ > size) {
+        return false;
+      }
+
+      memory_budget_ = size;
     }
+    cv_.notify_all();
+    return true;
+  }
+
+  /**
+   * Set the memory budget for a type. Usage of the type counts against
+   * both this budget and the overall budget.
+   *
+   * @param mem_type The memory type to limit.
+   * @param size The memory budget size.
+   * @return true if the budget can be set, false otherwise.
+   */
+  bool set_budget(MemoryType mem_type, uint64_t size) {
+    {
+      std::lock_guard<std::mutex> lg(mutex_);
+      if (memory_usage_by_type_[mem_type] > size) {
+        return false;
+      }
 
-    memory_budget_ = size;
+      memory_budget_by_type_[mem_type] = size;
+    }
+    cv_.notify_all();
     return true;
   }
 
@@ -140,17 +253,34 @@ class MemoryTracker {
   }
 
  private:
+  /** Returns the budget for a type. Must be called with `mutex_` held. */
+  uint64_t budget_for_type(MemoryType mem_type) const {
+    auto it = memory_budget_by_type_.find(mem_type);
+    return it == memory_budget_by_type_.end() ?
+               std::numeric_limits<uint64_t>::max() :
+               it->second;
+  }
+
   /** Protects all member variables. */
   std::mutex mutex_;
 
+  /** Signalled when memory is released or a budget is raised. */
+  std::condition_variable cv_;
+
   /** Memory usage for tracked structures. */
   uint64_t memory_usage_;
 
   /** Memory budget. */
   uint64_t memory_budget_;
 
+  /** Parent tracker also charged for this tracker's usage, or nullptr. */
+  MemoryTracker* parent_;
+
   /** Memory usage by type. */
   std::unordered_map<MemoryType, uint64_t> memory_usage_by_type_;
+
+  /** Memory budget by type, unlimited for absent types. */
+  std::unordered_map<MemoryType, uint64_t> memory_budget_by_type_;
 };
 
 }  // namespace sm
@@ -0,0 +1,129 @@
+/**
+ * @file   unit_trace_ring.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file tests the TraceRing class.
+ */
+
+#include <test/support/tdb_catch.h>
+#include "tiledb/common/trace_ring.h"
+
+#include <thread>
+
+using namespace tiledb::common;
+
+TEST_CASE("TraceRing: Disabled ring records nothing", "[trace_ring]") {
+  auto& ring = TraceRing::instance();
+  ring.set_enabled(false);
+  ring.record("should not appear {}", 42);
+  for (auto& entry : ring.dump()) {
+    CHECK(entry.find("should not appear") == std::string::npos);
+  }
+}
+
+TEST_CASE("TraceRing: Deferred formatting on dump", "[trace_ring]") {
+  auto& ring = TraceRing::instance();
+  ring.set_enabled(true);
+
+  ring.record("signed {}", int64_t(-7));
+  ring.record("unsigned {}", uint64_t(18446744073709551615ull));
+  ring.record("float {}", 1.5);
+  ring.record("bool {} and {}", true, false);
+  ring.record("no args");
+
+  auto entries = ring.dump();
+  REQUIRE(entries.size() >= 5);
+
+  auto find_entry = [&](const std::string& text) {
+    for (auto& entry : entries) {
+      if (entry.find(text) != std::string::npos) {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  CHECK(find_entry("signed -7"));
+  CHECK(find_entry("unsigned 18446744073709551615"));
+  CHECK(find_entry("float 1.5"));
+  CHECK(find_entry("bool true and false"));
+  CHECK(find_entry("no args"));
+
+  ring.set_enabled(false);
+}
+
+TEST_CASE(
+    "TraceRing: Dump is bounded and keeps newest entries", "[trace_ring]") {
+  auto& ring = TraceRing::instance();
+  ring.set_enabled(true);
+
+  for (uint64_t i = 0; i < TraceRing::capacity + 100; i++) {
+    ring.record("entry {}", i);
+  }
+
+  auto entries = ring.dump(10);
+  REQUIRE(entries.size() <= 10);
+
+  // The last recorded entry survives the wrap-around.
+  auto all = ring.dump();
+  REQUIRE(all.size() <= TraceRing::capacity);
+  bool found_last = false;
+  for (auto& entry : all) {
+    if (entry.find("entry " + std::to_string(TraceRing::capacity + 99)) !=
+        std::string::npos) {
+      found_last = true;
+    }
+  }
+  CHECK(found_last);
+
+  ring.set_enabled(false);
+}
+
+TEST_CASE("TraceRing: Concurrent writers do not tear entries", "[trace_ring]") {
+  auto& ring = TraceRing::instance();
+  ring.set_enabled(true);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([&ring, t]() {
+      for (int i = 0; i < 10000; i++) {
+        ring.record("writer {} iteration {}", t, i);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // Every dumped entry must be fully formed.
+  for (auto& entry : ring.dump()) {
+    CHECK(entry.find("{}") == std::string::npos);
+  }
+
+  ring.set_enabled(false);
+}
@@ -287,6 +287,73 @@ TEST_CASE(
   }
 }
 
+TEST_CASE("ThreadPool: Test task group cancellation", "[threadpool][cancel]") {
+  ThreadPool pool{2};
+  ThreadPool::TaskGroup group(pool);
+
+  // Two tasks occupy both workers, polling their cancellation token, and
+  // three more stay queued behind them.
+  std::atomic<uint64_t> started(0), observed_cancel(0), ran(0);
+  for (int i = 0; i < 2; i++) {
+    group.execute([&started, &observed_cancel]() {
+      started++;
+      while (!ThreadPool::current_task_cancelled()) {
+        std::this_thread::yield();
+      }
+      observed_cancel++;
+      return Status::Ok();
+    });
+  }
+  for (int i = 0; i < 3; i++) {
+    group.execute([&ran]() {
+      ran++;
+      return Status::Ok();
+    });
+  }
+
+  // Wait until both polling tasks are running, then cancel the group.
+  while (started != 2) {
+    std::this_thread::yield();
+  }
+  REQUIRE(!group.cancelled());
+  group.cancel();
+  REQUIRE(group.cancelled());
+
+  // The running tasks observed the cancellation at their next poll; the
+  // queued tasks short-circuited without running.
+  REQUIRE(!group.wait_all().ok());
+  REQUIRE(observed_cancel == 2);
+  REQUIRE(ran == 0);
+}
+
+TEST_CASE(
+    "ThreadPool: Test cancellation token chaining", "[threadpool][cancel]") {
+  ThreadPool pool{2};
+
+  auto outer = tdb::make_shared<ThreadPool::CancellationToken>(HERE());
+  REQUIRE(!ThreadPool::current_task_cancelled());
+
+  ThreadPool::CancellationScope scope(outer);
+  REQUIRE(ThreadPool::current_cancellation_token() == outer);
+  REQUIRE(!ThreadPool::current_task_cancelled());
+
+  // A group created under the outer token chains to it: cancelling the
+  // outer operation cancels the group without the group being cancelled
+  // itself.
+  ThreadPool::TaskGroup group(pool);
+  outer->cancel();
+  REQUIRE(ThreadPool::current_task_cancelled());
+  REQUIRE(group.cancelled());
+  group.execute([]() { return Status::Ok(); });
+  REQUIRE(!group.wait_all().ok());
+
+  // Resetting the outer token uncancels the group.
+  outer->reset();
+  REQUIRE(!group.cancelled());
+  group.execute([]() { return Status::Ok(); });
+  REQUIRE(group.wait_all().ok());
+}
+
 // Defer this test, pending final design of ThreadPool lifecycle
 // TEST_CASE("ThreadPool: Test construction of empty threadpool",
 // "[threadpool]") {
@@ -35,19 +35,68 @@
 #include <queue>
 #include <thread>
 
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+
+#include <fstream>
+#include <map>
+#endif
+
 #include "tiledb/common/logger.h"
 #include "tiledb/common/thread_pool.h"
 
 namespace tiledb::common {
 
+thread_local ThreadPool::Priority ThreadPool::submission_priority_{
+    ThreadPool::Priority::NORMAL};
+
+thread_local shared_ptr<ThreadPool::CancellationToken>
+    ThreadPool::current_cancellation_token_{nullptr};
+
+namespace {
+// Identifies the pool (if any) the current thread is a worker of, and its
+// index into that pool's worker queues.  Used to route task submission and
+// claiming without any shared state.
+thread_local ThreadPool* local_pool{nullptr};
+thread_local size_t local_worker_id{0};
+
+#if defined(__linux__)
+// Groups the CPUs of the machine by the physical package they belong to,
+// using the sysfs topology. Each group approximates a NUMA domain. Returns
+// an empty vector if the topology cannot be read.
+std::vector<std::vector<unsigned>> cpu_packages() {
+  std::map<unsigned, std::vector<unsigned>> cpus_per_package;
+  const unsigned num_cpus = std::thread::hardware_concurrency();
+  for (unsigned cpu = 0; cpu < num_cpus; cpu++) {
+    std::ifstream topology(
+        "/sys/devices/system/cpu/cpu" + std::to_string(cpu) +
+        "/topology/physical_package_id");
+    unsigned package = 0;
+    if (!(topology >> package)) {
+      return {};
+    }
+    cpus_per_package[package].emplace_back(cpu);
+  }
+
+  std::vector<std::vector<unsigned>> packages;
+  packages.reserve(cpus_per_package.size());
+  for (auto& package : cpus_per_package) {
+    packages.emplace_back(std::move(package.second));
+  }
+  return packages;
+}
+#endif
+}  // namespace
+
 // Constructor.  May throw an exception on error.  No logging is done as the
 // logger may not yet be initialized.
-ThreadPool::ThreadPool(size_t n)
+ThreadPool::ThreadPool(size_t n, bool pin_threads)
     : concurrency_level_(n) {
   // If concurrency_level_ is set to zero, construct the thread pool in shutdown
-  // state.  Explicitly shut down the task queue as well.
+  // state.
   if (concurrency_level_ == 0) {
-    task_queue_.drain();
+    closed_ = true;
     return;
   }
 
@@ -62,6 +111,10 @@ ThreadPool::ThreadPool(size_t n)
   }
 
   threads_.reserve(concurrency_level_);
+  worker_queues_.reserve(concurrency_level_);
+  for (size_t i = 0; i < concurrency_level_; ++i) {
+    worker_queues_.emplace_back(std::make_unique<WorkerQueue>());
+  }
 
   for (size_t i = 0; i < concurrency_level_; ++i) {
     std::thread tmp;
@@ -73,7 +126,7 @@ ThreadPool::ThreadPool(size_t n)
     size_t tries = 3;
     while (tries--) {
       try {
-        tmp = std::thread(&ThreadPool::worker, this);
+        tmp = std::thread(&ThreadPool::worker, this, i);
       } catch (const std::system_error& e) {
         if (e.code() != std::errc::resource_unavailable_try_again ||
             tries == 0) {
@@ -97,28 +150,195 @@ ThreadPool::ThreadPool(size_t n)
       throw;
     }
   }
+
+  if (pin_threads) {
+    this->pin_threads();
+  }
+}
+
+void ThreadPool::pin_threads() {
+#if defined(__linux__)
+  auto packages = cpu_packages();
+  if (packages.empty()) {
+    return;
+  }
+
+  for (size_t i = 0; i < threads_.size(); i++) {
+    // Workers are assigned to packages in contiguous blocks so the stealing
+    // order, which walks the sibling queues round-robin from the worker's
+    // own index, visits same-package queues before crossing a package
+    // boundary.
+    const auto& package = packages[i * packages.size() / threads_.size()];
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    for (auto cpu : package) {
+      CPU_SET(cpu, &cpuset);
+    }
+
+    // Pinning is best effort; an affinity failure leaves the thread on the
+    // default mask.
+    pthread_setaffinity_np(
+        threads_[i].native_handle(), sizeof(cpu_set_t), &cpuset);
+  }
+#endif
 }
 
-void ThreadPool::worker() {
+void ThreadPool::worker(size_t worker_id) {
+  local_pool = this;
+  local_worker_id = worker_id;
+
   while (true) {
-    auto val = task_queue_.pop();
-    if (val) {
+    if (auto val = try_pop_task()) {
       (*(*val))();
-    } else {
+      continue;
+    }
+
+    // No task is runnable anywhere; sleep until one is enqueued or the pool
+    // shuts down.  Remaining tasks are drained before exiting so shutdown
+    // preserves the invariant that every pushed task runs.
+    std::unique_lock lock{wake_mutex_};
+    if (closed_ && pending_tasks_ == 0) {
       break;
     }
+    wake_cv_.wait(lock, [this]() { return closed_ || pending_tasks_ > 0; });
+  }
+}
+
+bool ThreadPool::push_task(PackagedTask task) {
+  {
+    std::lock_guard wake_lock{wake_mutex_};
+    if (closed_) {
+      return false;
+    }
+    ++pending_tasks_;
+  }
+
+  if (local_pool == this) {
+    auto& wq = *worker_queues_[local_worker_id];
+    std::lock_guard lock{wq.mutex_};
+    wq.tasks_.push_front(std::move(task));
+  } else {
+    std::lock_guard lock{foreign_queue_mutex_};
+    foreign_queues_[static_cast<size_t>(submission_priority_)].push_front(
+        std::move(task));
+  }
+
+  wake_cv_.notify_one();
+  return true;
+}
+
+std::optional<ThreadPool::PackagedTask> ThreadPool::try_pop_task() {
+  auto claim = [this](PackagedTask task) -> std::optional<PackagedTask> {
+    std::lock_guard wake_lock{wake_mutex_};
+    --pending_tasks_;
+    return task;
+  };
+
+  // A worker of this pool favors its own deque, newest first.
+  const bool is_worker = (local_pool == this);
+  if (is_worker) {
+    auto& wq = *worker_queues_[local_worker_id];
+    std::unique_lock lock{wq.mutex_};
+    if (!wq.tasks_.empty()) {
+      auto task = std::move(wq.tasks_.front());
+      wq.tasks_.pop_front();
+      lock.unlock();
+      return claim(std::move(task));
+    }
+  }
+
+  // Next, tasks submitted from outside the pool, oldest first. Normal
+  // priority tasks are served ahead of background ones, except that every
+  // 'background_service_interval_'-th claim takes a background task even
+  // when normal tasks are pending, so bulk work keeps a weighted share of
+  // the pool and cannot be starved.
+  {
+    std::unique_lock lock{foreign_queue_mutex_};
+    auto& normal = foreign_queues_[static_cast<size_t>(Priority::NORMAL)];
+    auto& background =
+        foreign_queues_[static_cast<size_t>(Priority::BACKGROUND)];
+    if (!normal.empty() || !background.empty()) {
+      const bool service_background =
+          !background.empty() &&
+          (normal.empty() ||
+           ++foreign_pop_count_ % background_service_interval_ == 0);
+      auto& queue = service_background ? background : normal;
+      auto task = std::move(queue.back());
+      queue.pop_back();
+      lock.unlock();
+      return claim(std::move(task));
+    }
+  }
+
+  // Finally, steal the oldest task from a sibling's deque.
+  const size_t n = worker_queues_.size();
+  const size_t start = is_worker ? (local_worker_id + 1) % n : 0;
+  for (size_t i = 0; i < n; ++i) {
+    const size_t victim = (start + i) % n;
+    if (is_worker && victim == local_worker_id) {
+      continue;
+    }
+    auto& wq = *worker_queues_[victim];
+    std::unique_lock lock{wq.mutex_};
+    if (!wq.tasks_.empty()) {
+      auto task = std::move(wq.tasks_.back());
+      wq.tasks_.pop_back();
+      lock.unlock();
+      return claim(std::move(task));
+    }
   }
+
+  return std::nullopt;
 }
 
 // shutdown is private and only called by constructor and destructor (RAII), so
 // shutdown won't be called from multiple threads.
 void ThreadPool::shutdown() {
   concurrency_level_.store(0);
-  task_queue_.drain();
+  {
+    std::lock_guard lock{wake_mutex_};
+    closed_ = true;
+  }
+  wake_cv_.notify_all();
   for (auto&& t : threads_) {
     t.join();
   }
   threads_.clear();
+  worker_queues_.clear();
+}
+
+ThreadPool::TaskGroup::TaskGroup(ThreadPool& tp)
+    : tp_(tp)
+    , token_(make_shared<CancellationToken>(HERE())) {
+}
+
+void ThreadPool::TaskGroup::execute(std::function<Status()>&& fn) {
+  Task task = tp_.execute([token = token_, fn = std::move(fn)]() {
+    if (token->cancelled()) {
+      return Status_TaskError("Task cancelled before execution");
+    }
+    CancellationScope scope(token);
+    return fn();
+  });
+  std::lock_guard<std::mutex> lock(tasks_mutex_);
+  tasks_.emplace_back(std::move(task));
+}
+
+void ThreadPool::TaskGroup::cancel() {
+  token_->cancel();
+}
+
+bool ThreadPool::TaskGroup::cancelled() const {
+  return token_->cancelled();
+}
+
+Status ThreadPool::TaskGroup::wait_all() {
+  std::vector<Task> tasks;
+  {
+    std::lock_guard<std::mutex> lock(tasks_mutex_);
+    tasks.swap(tasks_);
+  }
+  return tp_.wait_all(tasks);
 }
 
 Status ThreadPool::wait_all(std::vector<Task>& tasks) {
@@ -188,7 +408,7 @@ std::vector<Status> ThreadPool::wait_all_status(std::vector<Task>& tasks) {
 
       // In the meantime, try to do something useful to make progress (and avoid
       // deadlock)
-      if (auto val = task_queue_.try_pop()) {
+      if (auto val = try_pop_task()) {
         (*(*val))();
       } else {
         // If nothing useful to do, yield so we don't burn cycles
@@ -237,7 +457,7 @@ Status ThreadPool::wait(Task& task) {
     } else {
       // In the meantime, try to do something useful to make progress (and avoid
       // deadlock)
-      if (auto val = task_queue_.try_pop()) {
+      if (auto val = try_pop_task()) {
         (*(*val))();
       } else {
         std::this_thread::yield();
@@ -33,10 +33,14 @@
 #ifndef TILEDB_THREAD_POOL_H
 #define TILEDB_THREAD_POOL_H
 
-#include "producer_consumer_queue.h"
-
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <functional>
 #include <future>
+#include <mutex>
+#include <optional>
 
 #include "tiledb/common/common.h"
 #include "tiledb/common/logger_public.h"
@@ -45,10 +49,179 @@
 
 namespace tiledb::common {
 
+/**
+ * A thread pool with a work-stealing scheduler.
+ *
+ * Each worker owns a deque of tasks. Tasks submitted from a worker thread
+ * are pushed onto that worker's deque and popped LIFO, which keeps nested
+ * task graphs (e.g. nested `parallel_for`) hot in cache and off the shared
+ * queue. Tasks submitted from outside the pool go to a shared queue per
+ * priority class: normal tasks are served ahead of background ones, with a
+ * small weighted share reserved for background tasks so bulk work cannot
+ * be starved. An idle worker first drains its own deque, then the shared
+ * queues, then steals from the tail of a sibling's deque, and only sleeps
+ * when no task is runnable anywhere.
+ */
 class ThreadPool {
  public:
   using Task = std::future<Status>;
 
+  /** Priority class a task is submitted with. */
+  enum class Priority : uint8_t { NORMAL = 0, BACKGROUND = 1 };
+
+  /**
+   * Scoped override of the priority class tasks submitted by the calling
+   * thread are enqueued with. The previous priority is restored when the
+   * scope ends. Only submissions from outside the pool are affected:
+   * tasks a worker submits go to its own deque and run as part of the
+   * task that spawned them.
+   */
+  class PriorityScope {
+   public:
+    explicit PriorityScope(Priority priority)
+        : previous_(submission_priority_) {
+      submission_priority_ = priority;
+    }
+
+    ~PriorityScope() {
+      submission_priority_ = previous_;
+    }
+
+    DISABLE_COPY_AND_COPY_ASSIGN(PriorityScope);
+    DISABLE_MOVE_AND_MOVE_ASSIGN(PriorityScope);
+
+   private:
+    /** The priority to restore when the scope ends. */
+    Priority previous_;
+  };
+
+  /**
+   * A cancellation flag shared by a group of related tasks. Tokens chain:
+   * a token created on a thread that already runs under a token links to
+   * it as its parent, so cancelling an outer operation (e.g. a query)
+   * cancels every group spawned on its behalf, including VFS read batches
+   * issued deep inside it.
+   */
+  class CancellationToken {
+   public:
+    /**
+     * Constructor. The calling thread's current token, if any, becomes
+     * the parent of the new token.
+     */
+    CancellationToken()
+        : parent_(current_cancellation_token()) {
+    }
+
+    DISABLE_COPY_AND_COPY_ASSIGN(CancellationToken);
+    DISABLE_MOVE_AND_MOVE_ASSIGN(CancellationToken);
+
+    /** Requests cancellation of the tasks sharing this token. */
+    void cancel() {
+      cancelled_.store(true, std::memory_order_release);
+    }
+
+    /** Clears a previously requested cancellation. */
+    void reset() {
+      cancelled_.store(false, std::memory_order_release);
+    }
+
+    /** @return Whether this token or any of its parents was cancelled. */
+    bool cancelled() const {
+      return cancelled_.load(std::memory_order_acquire) ||
+             (parent_ != nullptr && parent_->cancelled());
+    }
+
+   private:
+    /** Whether cancellation has been requested on this token. */
+    std::atomic<bool> cancelled_{false};
+
+    /** The token the creating thread held when this token was created. */
+    shared_ptr<CancellationToken> parent_;
+  };
+
+  /**
+   * Scoped install of a cancellation token as the calling thread's
+   * current token; the previous token is restored when the scope ends.
+   * Synchronous entry points (e.g. query submission) install their token
+   * with it so that the `parallel_for` loops and VFS reads running on
+   * their behalf observe cancellation between work items.
+   */
+  class CancellationScope {
+   public:
+    explicit CancellationScope(shared_ptr<CancellationToken> token)
+        : previous_(std::move(current_cancellation_token_)) {
+      current_cancellation_token_ = std::move(token);
+    }
+
+    ~CancellationScope() {
+      current_cancellation_token_ = std::move(previous_);
+    }
+
+    DISABLE_COPY_AND_COPY_ASSIGN(CancellationScope);
+    DISABLE_MOVE_AND_MOVE_ASSIGN(CancellationScope);
+
+   private:
+    /** The token to restore when the scope ends. */
+    shared_ptr<CancellationToken> previous_;
+  };
+
+  /**
+   * A group of related tasks that can be cancelled together. Tasks
+   * scheduled through the group short-circuit with an error status if the
+   * group was cancelled before they started, and run with the group's
+   * token installed as their thread's current token, so long-running
+   * bodies that poll `current_task_cancelled` bail out between work
+   * items. The group token links the creating thread's token as its
+   * parent: cancelling the outer operation cancels the group as well.
+   */
+  class TaskGroup {
+   public:
+    /** Constructor. */
+    explicit TaskGroup(ThreadPool& tp);
+
+    DISABLE_COPY_AND_COPY_ASSIGN(TaskGroup);
+    DISABLE_MOVE_AND_MOVE_ASSIGN(TaskGroup);
+
+    /**
+     * Schedule a task as part of this group. The task's completion and
+     * status are observed through `wait_all`.
+     *
+     * @param fn Task to execute.
+     */
+    void execute(std::function<Status()>&& fn);
+
+    /**
+     * Requests cancellation of the group. Tasks that have not started
+     * return an error status without running; running tasks observe the
+     * cancellation at their next poll.
+     */
+    void cancel();
+
+    /** @return Whether the group or any of its parents was cancelled. */
+    bool cancelled() const;
+
+    /**
+     * Waits on all tasks scheduled through the group so far.
+     *
+     * @return Status::Ok if all tasks returned Status::Ok, otherwise the
+     * first error status is returned.
+     */
+    Status wait_all();
+
+   private:
+    /** The thread pool the group's tasks are scheduled on. */
+    ThreadPool& tp_;
+
+    /** The cancellation token shared by the group's tasks. */
+    shared_ptr<CancellationToken> token_;
+
+    /** Protects `tasks_`. */
+    std::mutex tasks_mutex_;
+
+    /** The tasks scheduled through the group, not yet waited on. */
+    std::vector<Task> tasks_;
+  };
+
   /* ********************************* */
   /*     CONSTRUCTORS & DESTRUCTORS    */
   /* ********************************* */
@@ -61,8 +234,14 @@ class ThreadPool {
    * zero will construct the thread pool in its shutdown state--constructed but
    * not accepting nor executing any tasks.  A value of 256*hardware_concurrency
    * or larger is an error.
+   * @param pin_threads If `true`, workers are pinned to the CPUs of a single
+   * physical package each, assigned in contiguous blocks so that work
+   * stealing, which walks the sibling queues from the worker's own index,
+   * prefers same-package queues. Buffers a pinned worker allocates and first
+   * touches stay local to its memory node. Best effort and Linux only;
+   * ignored on other platforms or when the CPU topology cannot be read.
    */
-  explicit ThreadPool(size_t n);
+  explicit ThreadPool(size_t n, bool pin_threads = false);
 
   /** Deleted default constructor */
   ThreadPool() = delete;
@@ -81,6 +260,24 @@ class ThreadPool {
     return concurrency_level_;
   }
 
+  /**
+   * @return The calling thread's current cancellation token, or `nullptr`
+   * if the thread does not run under one.
+   */
+  static shared_ptr<CancellationToken> current_cancellation_token() {
+    return current_cancellation_token_;
+  }
+
+  /**
+   * @return Whether the calling thread's current cancellation token, or
+   * any of its parents, was cancelled. Always `false` outside a token
+   * scope. Long-running loops poll this between work items.
+   */
+  static bool current_task_cancelled() {
+    return current_cancellation_token_ != nullptr &&
+           current_cancellation_token_->cancelled();
+  }
+
   /**
    * Schedule a new task to be executed. If the returned future object
    * is valid, `f` is execute asynchronously. To avoid deadlock, `f`
@@ -110,7 +307,7 @@ class ThreadPool {
 
     std::future<R> future = task->get_future();
 
-    task_queue_.push(task);
+    push_task(task);
 
     return future;
   }
@@ -169,17 +366,88 @@ class ThreadPool {
   /* ********************************* */
 
  private:
+  /** The type of the tasks kept on the worker and shared queues. */
+  using PackagedTask = shared_ptr<std::packaged_task<Status()>>;
+
+  /** A task deque owned by a single worker, with its guarding mutex. */
+  struct WorkerQueue {
+    std::mutex mutex_;
+    std::deque<PackagedTask> tasks_;
+  };
+
   /** The worker thread routine */
-  void worker();
+  void worker(size_t worker_id);
+
+  /**
+   * Pin each worker thread to the CPUs of a single physical package. No-op
+   * when the platform or topology does not support it.
+   */
+  void pin_threads();
 
   /** Terminate threads in the thread pool */
   void shutdown();
 
-  /** Producer-consumer queue where functions to be executed are kept */
-  ProducerConsumerQueue<
-      shared_ptr<std::packaged_task<Status()>>,
-      std::deque<shared_ptr<std::packaged_task<Status()>>>>
-      task_queue_;
+  /**
+   * Enqueue a task. If the calling thread is a worker of this pool, the task
+   * goes to the front of that worker's deque, otherwise to the shared queue.
+   * Returns false if the pool has been shut down.
+   */
+  bool push_task(PackagedTask task);
+
+  /**
+   * Claim a runnable task: the calling worker's own deque first (LIFO), then
+   * the shared queue, then the tail of a sibling worker's deque. Callers that
+   * are not workers of this pool (e.g. threads blocked in `wait`) skip the
+   * first step. Returns nothing if no task is runnable.
+   */
+  std::optional<PackagedTask> try_pop_task();
+
+  /**
+   * Every `background_service_interval_`-th claim from the shared queues
+   * takes a background task even when normal tasks are pending, so
+   * background work keeps a weighted share of the pool instead of
+   * starving.
+   */
+  static constexpr size_t background_service_interval_ = 8;
+
+  /**
+   * The priority class the calling thread submits tasks with; set through
+   * `PriorityScope`.
+   */
+  static thread_local Priority submission_priority_;
+
+  /**
+   * The cancellation token the calling thread currently runs under; set
+   * through `CancellationScope`, `nullptr` outside any scope.
+   */
+  static thread_local shared_ptr<CancellationToken> current_cancellation_token_;
+
+  /** Per-worker task deques; tasks are stolen from the tail. */
+  std::vector<std::unique_ptr<WorkerQueue>> worker_queues_;
+
+  /**
+   * Queues holding tasks submitted by threads outside the pool, one per
+   * priority class, indexed by `Priority`.
+   */
+  std::array<std::deque<PackagedTask>, 2> foreign_queues_;
+
+  /** Counts claims from the shared queues; drives the background share. */
+  size_t foreign_pop_count_{0};
+
+  /** Protects `foreign_queues_` and `foreign_pop_count_`. */
+  std::mutex foreign_queue_mutex_;
+
+  /** Protects `pending_tasks_` and `closed_`; guards worker sleep/wake. */
+  std::mutex wake_mutex_;
+
+  /** Signalled when a task is enqueued or the pool shuts down. */
+  std::condition_variable wake_cv_;
+
+  /** Number of enqueued tasks not yet claimed by any thread. */
+  size_t pending_tasks_{0};
+
+  /** Whether the pool has been shut down. */
+  bool closed_{false};
 
   /** The worker threads */
   std::vector<std::thread> threads_;
@@ -0,0 +1,150 @@
+/**
+ * @file   trace_ring.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class TraceRing.
+ */
+
+#include "tiledb/common/trace_ring.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace tiledb::common {
+
+TraceRing& TraceRing::instance() {
+  static TraceRing ring;
+  return ring;
+}
+
+void TraceRing::set_enabled(bool enabled) {
+  if (enabled) {
+    std::lock_guard<std::mutex> lock(init_mtx_);
+    if (entries_ == nullptr) {
+      entries_ = std::make_unique<Entry[]>(capacity);
+    }
+    // The release store orders the allocation before the flag so that a
+    // racing 'record' observing the flag also observes the storage.
+    enabled_.store(true, std::memory_order_release);
+  } else {
+    // The storage is kept so that already published entries remain
+    // dumpable after tracing is turned off.
+    enabled_.store(false, std::memory_order_release);
+  }
+}
+
+std::vector<std::string> TraceRing::dump(uint64_t max_entries) const {
+  std::vector<std::string> out;
+  if (entries_ == nullptr) {
+    return out;
+  }
+
+  const uint64_t head = head_.load(std::memory_order_acquire);
+  const uint64_t count = std::min({max_entries, head, capacity});
+  out.reserve(count);
+  for (uint64_t ticket = head - count; ticket < head; ticket++) {
+    const Entry& entry = entries_[ticket & (capacity - 1)];
+    const uint64_t expected = (ticket + 1) << 1;
+    if (entry.sequence.load(std::memory_order_acquire) != expected) {
+      // The slot is being overwritten by a newer record or was lapped
+      // between reading the head and getting here.
+      continue;
+    }
+
+    const uint64_t timestamp_ns = entry.timestamp_ns;
+    const char* fmt = entry.fmt;
+    const auto args = entry.args;
+    const auto types = entry.types;
+
+    // Re-check the sequence after copying the payload; a mismatch means a
+    // writer raced the copy and the data above may be torn.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (entry.sequence.load(std::memory_order_relaxed) != expected) {
+      continue;
+    }
+
+    out.emplace_back(format_entry(timestamp_ns, fmt, args, types));
+  }
+
+  return out;
+}
+
+std::string TraceRing::format_entry(
+    uint64_t timestamp_ns,
+    const char* fmt,
+    const std::array<uint64_t, max_args>& args,
+    const std::array<ArgType, max_args>& types) {
+  char buf[32];
+
+  // Prefix with the steady clock timestamp in seconds so that entries can
+  // be correlated across a dump.
+  std::string out;
+  snprintf(buf, sizeof(buf), "[%.6f] ", (double)timestamp_ns / 1e9);
+  out += buf;
+
+  // Substitute each `{}` placeholder with the next rendered argument.
+  size_t arg_idx = 0;
+  for (const char* p = fmt; *p != '\0'; p++) {
+    if (p[0] == '{' && p[1] == '}' && arg_idx < max_args &&
+        types[arg_idx] != ArgType::NONE) {
+      const uint64_t bits = args[arg_idx];
+      switch (types[arg_idx]) {
+        case ArgType::INT:
+          snprintf(buf, sizeof(buf), "%lld", (long long)(int64_t)bits);
+          break;
+        case ArgType::UINT:
+          snprintf(buf, sizeof(buf), "%llu", (unsigned long long)bits);
+          break;
+        case ArgType::FLOAT: {
+          double d;
+          std::memcpy(&d, &bits, sizeof(d));
+          snprintf(buf, sizeof(buf), "%g", d);
+          break;
+        }
+        case ArgType::POINTER:
+          snprintf(buf, sizeof(buf), "0x%llx", (unsigned long long)bits);
+          break;
+        case ArgType::BOOL:
+          snprintf(buf, sizeof(buf), "%s", bits != 0 ? "true" : "false");
+          break;
+        default:
+          buf[0] = '\0';
+          break;
+      }
+      out += buf;
+      arg_idx++;
+      p++;
+      continue;
+    }
+    out += *p;
+  }
+
+  return out;
+}
+
+}  // namespace tiledb::common
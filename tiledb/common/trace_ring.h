@@ -0,0 +1,265 @@
+/**
+ * @file   trace_ring.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class TraceRing, a lock-free in-memory ring buffer for
+ * hot-path tracing with deferred formatting.
+ */
+
+#ifndef TILEDB_TRACE_RING_H
+#define TILEDB_TRACE_RING_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace tiledb {
+namespace common {
+
+/**
+ * A fixed capacity, lock-free ring buffer for hot-path tracing.
+ *
+ * Formatting a trace statement costs orders of magnitude more than most of
+ * the code being traced, so enabling trace logging in the readers changes
+ * the very timing it is meant to observe. The ring defers all formatting:
+ * 'record' stores the format string pointer and the raw argument bits in a
+ * preallocated slot, and the entries are only rendered to text by 'dump',
+ * which runs off the hot path (e.g. on slow query detection).
+ *
+ * A record claims its slot with a single atomic increment and publishes it
+ * with a per-slot sequence number following the seqlock protocol, so
+ * concurrent writers never block each other and a concurrent dump drops
+ * entries that are being overwritten instead of returning torn ones.
+ *
+ * Restrictions that keep the record path allocation and formatting free:
+ * - The format string must have static storage duration (in practice a
+ *   string literal); only its pointer is stored.
+ * - Arguments must be arithmetic types, bools, enums or pointers; they are
+ *   stored as raw 64-bit values. Strings are not supported.
+ * - Placeholders must be plain `{}`; format specs are not interpreted.
+ */
+class TraceRing {
+ public:
+  /* ********************************* */
+  /*            CONSTANTS              */
+  /* ********************************* */
+
+  /** Maximum number of arguments stored per entry. */
+  static constexpr size_t max_args = 4;
+
+  /** Number of entries in the ring, a power of two. */
+  static constexpr uint64_t capacity = 16384;
+
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  TraceRing() = default;
+
+  TraceRing(const TraceRing&) = delete;
+  TraceRing& operator=(const TraceRing&) = delete;
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** Returns the process-wide trace ring. */
+  static TraceRing& instance();
+
+  /** Returns whether recording is enabled. */
+  inline bool enabled() const {
+    return enabled_.load(std::memory_order_acquire);
+  }
+
+  /**
+   * Enables or disables recording. The ring storage is allocated on the
+   * first enable so that a disabled ring costs nothing but the flag check.
+   */
+  void set_enabled(bool enabled);
+
+  /**
+   * Records a trace entry. A no-op when the ring is disabled; costs one
+   * atomic increment and a handful of stores when enabled.
+   *
+   * @param fmt Format string with `{}` placeholders; must be a literal.
+   * @param args Scalar arguments, at most `max_args`.
+   */
+  template <typename... Args>
+  void record(const char* fmt, Args... args) {
+    static_assert(sizeof...(Args) <= max_args, "Too many trace arguments");
+    if (!enabled()) {
+      return;
+    }
+
+    const uint64_t ticket = head_.fetch_add(1, std::memory_order_relaxed);
+    Entry& entry = entries_[ticket & (capacity - 1)];
+
+    // Mark the slot as in progress (odd sequence), fill it, then publish it
+    // with the even sequence derived from the ticket. See 'dump' for the
+    // read side of the protocol.
+    entry.sequence.store(((ticket + 1) << 1) | 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    entry.timestamp_ns = now_ns();
+    entry.fmt = fmt;
+    size_t i = 0;
+    ((entry.args[i] = encode(args),
+      entry.types[i] = arg_type<Args>(),
+      ++i),
+     ...);
+    for (; i < max_args; i++) {
+      entry.types[i] = ArgType::NONE;
+    }
+    entry.sequence.store((ticket + 1) << 1, std::memory_order_release);
+  }
+
+  /**
+   * Renders the most recent entries to text, oldest first. Entries
+   * concurrently overwritten while dumping are skipped.
+   *
+   * @param max_entries Maximum number of entries to return.
+   * @return Formatted entries.
+   */
+  std::vector<std::string> dump(uint64_t max_entries = capacity) const;
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE DATATYPES         */
+  /* ********************************* */
+
+  /** Type tag stored per argument so that 'dump' can render it. */
+  enum class ArgType : uint8_t { NONE = 0, INT, UINT, FLOAT, POINTER, BOOL };
+
+  /** A single ring slot, padded to a cache line to limit false sharing. */
+  struct alignas(64) Entry {
+    /**
+     * Seqlock sequence: 0 when never written, odd while a writer owns the
+     * slot, `(ticket + 1) << 1` once the entry for `ticket` is published.
+     */
+    std::atomic<uint64_t> sequence{0};
+
+    /** Steady clock timestamp of the record, in nanoseconds. */
+    uint64_t timestamp_ns;
+
+    /** The format string; points to static storage. */
+    const char* fmt;
+
+    /** Raw argument bits. */
+    std::array<uint64_t, max_args> args;
+
+    /** Argument type tags. */
+    std::array<ArgType, max_args> types;
+  };
+
+  /* ********************************* */
+  /*          PRIVATE METHODS          */
+  /* ********************************* */
+
+  /** Returns the current steady clock time in nanoseconds. */
+  static inline uint64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+  }
+
+  /** Encodes a scalar argument into its raw 64-bit representation. */
+  template <typename T>
+  static uint64_t encode(T value) {
+    static_assert(
+        std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>,
+        "Trace arguments must be scalar");
+    if constexpr (std::is_floating_point_v<T>) {
+      const double d = static_cast<double>(value);
+      uint64_t bits;
+      std::memcpy(&bits, &d, sizeof(bits));
+      return bits;
+    } else if constexpr (std::is_pointer_v<T>) {
+      return reinterpret_cast<uint64_t>(value);
+    } else if constexpr (std::is_enum_v<T>) {
+      return static_cast<uint64_t>(
+          static_cast<std::underlying_type_t<T>>(value));
+    } else if constexpr (std::is_signed_v<T>) {
+      return static_cast<uint64_t>(static_cast<int64_t>(value));
+    } else {
+      return static_cast<uint64_t>(value);
+    }
+  }
+
+  /** Returns the type tag for a scalar argument type. */
+  template <typename T>
+  static constexpr ArgType arg_type() {
+    if constexpr (std::is_same_v<T, bool>) {
+      return ArgType::BOOL;
+    } else if constexpr (std::is_floating_point_v<T>) {
+      return ArgType::FLOAT;
+    } else if constexpr (std::is_pointer_v<T>) {
+      return ArgType::POINTER;
+    } else if constexpr (std::is_enum_v<T>) {
+      return std::is_signed_v<std::underlying_type_t<T>> ? ArgType::INT :
+                                                           ArgType::UINT;
+    } else if constexpr (std::is_signed_v<T>) {
+      return ArgType::INT;
+    } else {
+      return ArgType::UINT;
+    }
+  }
+
+  /** Renders a copied-out entry to text. */
+  static std::string format_entry(
+      uint64_t timestamp_ns,
+      const char* fmt,
+      const std::array<uint64_t, max_args>& args,
+      const std::array<ArgType, max_args>& types);
+
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** Whether recording is enabled. */
+  std::atomic<bool> enabled_{false};
+
+  /** Next ticket to claim; the ticket modulo the capacity is the slot. */
+  std::atomic<uint64_t> head_{0};
+
+  /** The ring slots, allocated on the first enable. */
+  std::unique_ptr<Entry[]> entries_;
+
+  /** Protects the lazy allocation of `entries_`. */
+  std::mutex init_mtx_;
+};
+
+}  // namespace common
+}  // namespace tiledb
+
+#endif  // TILEDB_TRACE_RING_H
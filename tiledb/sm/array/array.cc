@@ -34,6 +34,7 @@
 
 #include "tiledb/common/logger.h"
 #include "tiledb/sm/array/array.h"
+#include "tiledb/sm/array/fragment_interval_index.h"
 #include "tiledb/sm/array_schema/array_schema.h"
 #include "tiledb/sm/array_schema/array_schema_evolution.h"
 #include "tiledb/sm/array_schema/attribute.h"
@@ -51,11 +52,13 @@
 #include "tiledb/sm/misc/utils.h"
 #include "tiledb/sm/rest/rest_client.h"
 #include "tiledb/sm/storage_manager/storage_manager.h"
+#include "tiledb/sm/subarray/subarray.h"
 #include "tiledb/sm/tile/generic_tile_io.h"
 
 #include <cassert>
 #include <cmath>
 #include <iostream>
+#include <set>
 
 using namespace tiledb::common;
 
@@ -104,6 +107,14 @@ Array::Array(
     , non_empty_domain_computed_(false)
     , consistency_controller_(cc)
     , consistency_sentry_(nullopt) {
+  // Charge this array's memory to the context budget as well.
+  memory_tracker_.set_parent(storage_manager_->memory_tracker());
+}
+
+Array::~Array() {
+  // A background fragment metadata load references array members; make sure
+  // it has finished before they are destroyed. Its status is irrelevant.
+  (void)join_fragment_metadata_load();
 }
 
 /* ********************************* */
@@ -228,7 +239,8 @@ void Array::load_fragments(
   auto timer_se = resources_.stats().start_timer("sm_array_load_fragments");
 
   // Load the fragment metadata
-  std::unordered_map<std::string, std::pair<Tile*, uint64_t>> offsets;
+  std::unordered_map<std::string, std::pair<shared_ptr<Tile>, uint64_t>>
+      offsets;
   fragment_metadata_ = FragmentMetadata::load(
       resources_,
       memory_tracker(),
@@ -237,6 +249,12 @@ void Array::load_fragments(
       *encryption_key(),
       fragments_to_load,
       offsets);
+
+  // The fragment interval index is built from the fragment metadata.
+  std::atomic_store_explicit(
+      &fragment_interval_index_,
+      shared_ptr<FragmentIntervalIndex>(nullptr),
+      std::memory_order_release);
 }
 
 Status Array::open(
@@ -368,8 +386,35 @@ Status Array::open(
             array_dir_timestamp_start_,
             array_dir_timestamp_end_);
       }
-      std::tie(array_schema_latest_, array_schemas_all_, fragment_metadata_) =
-          open_for_reads();
+      bool found = false;
+      bool prefetch = false;
+      throw_if_not_ok(config_.get<bool>(
+          "sm.array.prefetch_fragment_metadata", &prefetch, &found));
+      assert(found);
+
+      if (prefetch) {
+        // Return as soon as the schemas are loaded; the fragment metadata
+        // loads in the background and its first access joins the load.
+        std::tie(array_schema_latest_, array_schemas_all_) =
+            open_for_reads_without_fragments();
+        fragment_metadata_load_task_ = resources_.io_tp().execute([this]() {
+          fragment_metadata_ = FragmentInfo::load_fragment_metadata(
+              resources_,
+              array_directory(),
+              memory_tracker(),
+              *encryption_key_,
+              array_schema_latest_,
+              array_schemas_all_);
+          std::atomic_store_explicit(
+              &fragment_interval_index_,
+              shared_ptr<FragmentIntervalIndex>(nullptr),
+              std::memory_order_release);
+          return Status::Ok();
+        });
+      } else {
+        std::tie(array_schema_latest_, array_schemas_all_, fragment_metadata_) =
+            open_for_reads();
+      }
     } else if (
         query_type == QueryType::WRITE ||
         query_type == QueryType::MODIFY_EXCLUSIVE) {
@@ -455,10 +500,18 @@ Status Array::close() {
     return Status::Ok();
   }
 
+  // Join a pending background fragment metadata load; the metadata is
+  // discarded below so its status is irrelevant.
+  (void)join_fragment_metadata_load();
+
   non_empty_domain_.clear();
   non_empty_domain_computed_ = false;
   clear_last_max_buffer_sizes();
   fragment_metadata_.clear();
+  std::atomic_store_explicit(
+      &fragment_interval_index_,
+      shared_ptr<FragmentIntervalIndex>(nullptr),
+      std::memory_order_release);
 
   try {
     set_array_closed();
@@ -495,6 +548,10 @@ Status Array::close() {
         if (!st.ok()) {
           throw StatusException(st);
         }
+
+        // Make any fragment commits batched by `sm.commit_batch_size`
+        // visible.
+        storage_manager_->flush_fragment_commits(array_uri_);
       } else if (
           query_type_ != QueryType::READ && query_type_ != QueryType::DELETE &&
           query_type_ != QueryType::UPDATE) {
@@ -651,12 +708,147 @@ void Array::load_all_enumerations() {
   get_enumerations(array_schema_latest_->get_enumeration_names());
 }
 
+void Array::prefetch(
+    const std::vector<Subarray>& subarrays, const uint64_t budget) {
+  auto timer_se = resources_.stats().start_timer("array_prefetch");
+
+  if (!is_open_) {
+    throw ArrayException("Cannot prefetch; Array is not open.");
+  }
+  if (query_type_ != QueryType::READ) {
+    throw ArrayException("Cannot prefetch; Array was not opened for reads.");
+  }
+  if (remote_) {
+    throw ArrayException("Cannot prefetch; Not supported on remote arrays.");
+  }
+
+  // A contiguous region of a fragment file to stage.
+  struct Region {
+    URI uri_;
+    uint64_t offset_;
+    uint64_t size_;
+  };
+  std::vector<Region> regions;
+  uint64_t planned = 0;
+  bool budget_exhausted = false;
+
+  // Plans a region, merging it with the previous one when contiguous in
+  // the same file and accounting it against the budget.
+  auto plan = [&](const URI& uri, uint64_t offset, uint64_t size) {
+    if (size == 0) {
+      return;
+    }
+    if (planned + size > budget) {
+      budget_exhausted = true;
+      return;
+    }
+    planned += size;
+    if (!regions.empty() && regions.back().uri_ == uri &&
+        regions.back().offset_ + regions.back().size_ == offset) {
+      regions.back().size_ += size;
+      return;
+    }
+    regions.push_back({uri, offset, size});
+  };
+
+  auto& metadata = fragment_metadata();
+
+  // Plan the tile regions in hint order, so that when the budget runs out
+  // the latest hints are the ones dropped.
+  for (auto subarray : subarrays) {
+    if (budget_exhausted) {
+      break;
+    }
+    throw_if_not_ok(subarray.precompute_tile_overlap(
+        0,
+        subarray.range_num() - 1,
+        &resources_.config(),
+        &resources_.compute_tp(),
+        true));
+
+    const auto* overlap = subarray.subarray_tile_overlap();
+    const auto& relevant_fragments = subarray.relevant_fragments();
+    for (size_t i = 0; i < relevant_fragments.size() && !budget_exhausted;
+         i++) {
+      auto f = relevant_fragments[i];
+      auto& fragment = metadata[f];
+      const auto& schema = fragment->array_schema();
+
+      // Collect the overlapping tile indexes of the fragment, deduped and
+      // ordered across ranges so that neighboring tiles merge into one
+      // region below.
+      std::set<uint64_t> tile_idxs;
+      for (uint64_t r = 0; r < overlap->range_num(); r++) {
+        const auto* tile_overlap = subarray.tile_overlap(f, r);
+        for (const auto& t : tile_overlap->tiles_) {
+          tile_idxs.insert(t.first);
+        }
+        for (const auto& tr : tile_overlap->tile_ranges_) {
+          for (uint64_t t = tr.first; t <= tr.second; t++) {
+            tile_idxs.insert(t);
+          }
+        }
+      }
+      if (tile_idxs.empty()) {
+        continue;
+      }
+
+      // Load the tile offsets of the fragment's attribute files.
+      std::vector<std::string> names;
+      names.reserve(schema->attributes().size());
+      for (const auto& attr : schema->attributes()) {
+        names.emplace_back(attr->name());
+      }
+      fragment->load_tile_offsets(*encryption_key(), names);
+
+      for (const auto& name : names) {
+        const auto var_size = schema->var_size(name);
+        const auto nullable = schema->is_nullable(name);
+        for (auto t : tile_idxs) {
+          plan(
+              fragment->uri(name),
+              fragment->file_offset(name, t),
+              fragment->persisted_tile_size(name, t));
+          if (var_size) {
+            plan(
+                fragment->var_uri(name),
+                fragment->file_var_offset(name, t),
+                fragment->persisted_tile_var_size(name, t));
+          }
+          if (nullable) {
+            plan(
+                fragment->validity_uri(name),
+                fragment->file_validity_offset(name, t),
+                fragment->persisted_tile_validity_size(name, t));
+          }
+        }
+      }
+    }
+  }
+
+  resources_.stats().add_counter("prefetch_byte_num", planned);
+
+  // Stage the regions on the I/O thread pool. The reads prime the VFS
+  // caches (and the OS page cache for local files); their contents are
+  // discarded.
+  auto& vfs = resources_.vfs();
+  throw_if_not_ok(parallel_for(
+      &resources_.io_tp(), 0, regions.size(), [&](const size_t i) {
+        const auto& region = regions[i];
+        std::vector<char> scratch(region.size_);
+        return vfs.read(
+            region.uri_, region.offset_, scratch.data(), region.size_, false);
+      }));
+}
+
 bool Array::is_empty() const {
+  throw_if_not_ok(join_fragment_metadata_load());
   return fragment_metadata_.empty();
 }
 
 bool Array::is_open() {
-  std::lock_guard<std::mutex> lock(mtx_);
+  // The flag is atomic; the rest of the class already reads it without
+  // taking `mtx_`, so query threads do not contend on a lock here.
   return is_open_;
 }
 
@@ -665,9 +857,39 @@ bool Array::is_remote() const {
 }
 
 std::vector<shared_ptr<FragmentMetadata>> Array::fragment_metadata() const {
+  throw_if_not_ok(join_fragment_metadata_load());
   return fragment_metadata_;
 }
 
+std::vector<shared_ptr<FragmentMetadata>>& Array::fragment_metadata() {
+  throw_if_not_ok(join_fragment_metadata_load());
+  return fragment_metadata_;
+}
+
+shared_ptr<const FragmentIntervalIndex> Array::fragment_interval_index() const {
+  // Fast path: lock free snapshot load once the index has been built.
+  auto index = std::atomic_load_explicit(
+      &fragment_interval_index_, std::memory_order_acquire);
+  if (index != nullptr) {
+    return index;
+  }
+
+  // Build the index once; concurrent callers wait for and reuse it. The
+  // fragment metadata may still be loading in the background.
+  std::lock_guard<std::mutex> lock(fragment_interval_index_mtx_);
+  throw_if_not_ok(join_fragment_metadata_load());
+  index = std::atomic_load_explicit(
+      &fragment_interval_index_, std::memory_order_acquire);
+  if (index == nullptr) {
+    index = make_shared<FragmentIntervalIndex>(
+        HERE(), array_schema_latest(), fragment_metadata_);
+    std::atomic_store_explicit(
+        &fragment_interval_index_, index, std::memory_order_release);
+  }
+
+  return index;
+}
+
 tuple<Status, optional<shared_ptr<ArraySchema>>> Array::get_array_schema()
     const {
   // Error if the array is not open
@@ -856,8 +1078,26 @@ Status Array::reopen(uint64_t timestamp_start, uint64_t timestamp_end) {
   // Reset the last max buffer sizes.
   clear_last_max_buffer_sizes();
 
+  // Join a pending background fragment metadata load so its result can be
+  // reused below; if it failed, the metadata is simply loaded again.
+  (void)join_fragment_metadata_load();
+
+  // Retain the already loaded fragment metadata so that fragments still
+  // present after the reopen are attached to instead of reloaded. The
+  // metadata is immutable once loaded and was loaded with this array's
+  // memory tracker, so it can be shared across the reopen.
+  std::unordered_map<std::string, shared_ptr<FragmentMetadata>>
+      preloaded_fragment_metadata;
+  for (const auto& meta : fragment_metadata_) {
+    preloaded_fragment_metadata.emplace(meta->fragment_uri().to_string(), meta);
+  }
+
   // Reopen metadata.
   fragment_metadata_.clear();
+  std::atomic_store_explicit(
+      &fragment_interval_index_,
+      shared_ptr<FragmentIntervalIndex>(nullptr),
+      std::memory_order_release);
   metadata_.clear();
   metadata_loaded_ = false;
 
@@ -900,7 +1140,7 @@ Status Array::reopen(uint64_t timestamp_start, uint64_t timestamp_end) {
 
   // Reopen the array and update private variables.
   std::tie(array_schema_latest_, array_schemas_all_, fragment_metadata_) =
-      open_for_reads();
+      open_for_reads(preloaded_fragment_metadata);
 
   return Status::Ok();
 }
@@ -1192,6 +1432,8 @@ bool Array::use_refactored_query_submit() const {
 
 std::unordered_map<std::string, uint64_t> Array::get_average_var_cell_sizes()
     const {
+  throw_if_not_ok(join_fragment_metadata_load());
+
   std::unordered_map<std::string, uint64_t> ret;
 
   // Find the names of the var-sized dimensions or attributes.
@@ -1274,11 +1516,17 @@ tuple<
     shared_ptr<ArraySchema>,
     std::unordered_map<std::string, shared_ptr<ArraySchema>>,
     std::vector<shared_ptr<FragmentMetadata>>>
-Array::open_for_reads() {
+Array::open_for_reads(
+    const std::unordered_map<std::string, shared_ptr<FragmentMetadata>>&
+        preloaded_fragment_metadata) {
   auto timer_se = resources_.stats().start_timer(
       "array_open_read_load_schemas_and_fragment_meta");
   auto result = FragmentInfo::load_array_schemas_and_fragment_metadata(
-      resources_, array_directory(), memory_tracker(), *encryption_key());
+      resources_,
+      array_directory(),
+      memory_tracker(),
+      *encryption_key(),
+      preloaded_fragment_metadata);
 
   auto version = std::get<0>(result)->version();
   ensure_supported_schema_version_for_read(version);
@@ -1355,6 +1603,15 @@ Array::open_for_writes() {
   return {Status::Ok(), array_schema_latest, array_schemas_all};
 }
 
+Status Array::join_fragment_metadata_load() const {
+  std::lock_guard<std::mutex> lock(fragment_metadata_load_mtx_);
+  if (!fragment_metadata_load_task_.valid()) {
+    return Status::Ok();
+  }
+
+  return resources_.io_tp().wait(fragment_metadata_load_task_);
+}
+
 void Array::clear_last_max_buffer_sizes() {
   last_max_buffer_sizes_.clear();
   last_max_buffer_sizes_subarray_.clear();
@@ -1419,6 +1676,8 @@ Status Array::compute_max_buffer_sizes(
         array_uri_, *(array_schema_latest_.get()), subarray, buffer_sizes);
   }
 
+  RETURN_NOT_OK(join_fragment_metadata_load());
+
   // Return if there are no metadata
   if (fragment_metadata_.empty()) {
     return Status::Ok();
@@ -1584,11 +1843,27 @@ ArrayDirectory& Array::load_array_directory() {
 Status Array::compute_non_empty_domain() {
   if (remote_) {
     RETURN_NOT_OK(load_remote_non_empty_domain());
-  } else if (!fragment_metadata_.empty()) {
+    non_empty_domain_computed_ = true;
+    return Status::Ok();
+  }
+
+  RETURN_NOT_OK(join_fragment_metadata_load());
+  if (!fragment_metadata_.empty()) {
+    auto metadata_num = fragment_metadata_.size();
+
+    // Decode the fragment footers in parallel: `non_empty_domain` decodes
+    // a lazily loaded footer on first access, which dominates the cost on
+    // arrays with many fragments. The union pass below then only expands
+    // already decoded ranges.
+    RETURN_NOT_OK(parallel_for(
+        &resources_.compute_tp(), 0, metadata_num, [&](const size_t j) {
+          fragment_metadata_[j]->non_empty_domain();
+          return Status::Ok();
+        }));
+
     const auto& frag0_dom = fragment_metadata_[0]->non_empty_domain();
     non_empty_domain_.assign(frag0_dom.begin(), frag0_dom.end());
 
-    auto metadata_num = fragment_metadata_.size();
     for (size_t j = 1; j < metadata_num; ++j) {
       const auto& meta_dom = fragment_metadata_[j]->non_empty_domain();
       // Validate that this fragment's non-empty domain is set
@@ -40,6 +40,7 @@
 #include "tiledb/common/common.h"
 #include "tiledb/common/memory_tracker.h"
 #include "tiledb/common/status.h"
+#include "tiledb/common/thread_pool/thread_pool.h"
 #include "tiledb/sm/array/array_directory.h"
 #include "tiledb/sm/array/consistency.h"
 #include "tiledb/sm/array_schema/array_schema.h"
@@ -55,7 +56,9 @@ namespace sm {
 
 class ArraySchema;
 class SchemaEvolution;
+class FragmentIntervalIndex;
 class FragmentMetadata;
+class Subarray;
 enum class QueryType : uint8_t;
 
 /**
@@ -94,7 +97,7 @@ class Array {
       ConsistencyController& cc = controller());
 
   /** Destructor. */
-  ~Array() = default;
+  ~Array();
 
   DISABLE_COPY_AND_COPY_ASSIGN(Array);
   DISABLE_MOVE_AND_MOVE_ASSIGN(Array);
@@ -243,16 +246,22 @@ class Array {
 
   /**
    * Returns the fragment metadata of the array. If the array is not open,
-   * an empty vector is returned.
+   * an empty vector is returned. Joins a pending background load of the
+   * metadata first.
    */
   std::vector<shared_ptr<FragmentMetadata>> fragment_metadata() const;
 
   /**
-   * Accessor to the fragment metadata of the array.
+   * Accessor to the fragment metadata of the array. Joins a pending
+   * background load of the metadata first.
    */
-  inline std::vector<shared_ptr<FragmentMetadata>>& fragment_metadata() {
-    return fragment_metadata_;
-  }
+  std::vector<shared_ptr<FragmentMetadata>>& fragment_metadata();
+
+  /**
+   * Returns the interval index over the fragment non-empty domains,
+   * building it on first use after the array is opened.
+   */
+  shared_ptr<const FragmentIntervalIndex> fragment_interval_index() const;
 
   /**
    * Get the enumeration for the given name.
@@ -283,6 +292,27 @@ class Array {
   /** Load all enumerations for the array. */
   void load_all_enumerations();
 
+  /**
+   * Pre-stages the persisted attribute tiles overlapping the input
+   * subarrays into the VFS caches, ahead of the queries an application
+   * plans to submit. Applications that know their access sequence in
+   * advance (e.g. ML training loops) call this instead of warming caches
+   * externally.
+   *
+   * The subarrays are honored in order until `budget` bytes of filtered
+   * tile data have been staged; later subarrays are dropped first when
+   * the budget runs out. The call blocks until staging completes, with
+   * the reads parallelized on the I/O thread pool; callers that want the
+   * staging overlapped with other work invoke it from their own thread.
+   *
+   * @param subarrays The subarrays to stage, in priority order.
+   * @param budget Maximum number of bytes to stage.
+   *
+   * @pre The array must be open for reads. Not supported on remote
+   * arrays.
+   */
+  void prefetch(const std::vector<Subarray>& subarrays, uint64_t budget);
+
   /**
    * Returns `true` if the array is empty at the time it is opened.
    * The funciton returns `false` if the array is not open.
@@ -660,6 +690,29 @@ class Array {
   /** The metadata of the fragments the array was opened with. */
   std::vector<shared_ptr<FragmentMetadata>> fragment_metadata_;
 
+  /**
+   * Interval index over the fragment non-empty domains, built lazily on the
+   * first use and reset whenever the fragment metadata changes. Accessed
+   * through the `std::atomic_load`/`std::atomic_store` free functions so
+   * query threads snapshot it without taking a lock; the C++20
+   * `std::atomic<shared_ptr>` specialization is not available on all the
+   * standard libraries we build against.
+   */
+  mutable shared_ptr<FragmentIntervalIndex> fragment_interval_index_;
+
+  /** Mutex serializing construction of `fragment_interval_index_`. */
+  mutable std::mutex fragment_interval_index_mtx_;
+
+  /**
+   * Background load of the fragment metadata over the I/O thread pool,
+   * started by `open` when `sm.array.prefetch_fragment_metadata` is
+   * enabled. Joined before `fragment_metadata_` is accessed.
+   */
+  mutable ThreadPool::Task fragment_metadata_load_task_;
+
+  /** Mutex serializing the join of `fragment_metadata_load_task_`. */
+  mutable std::mutex fragment_metadata_load_mtx_;
+
   /** `True` if the array has been opened. */
   std::atomic<bool> is_open_;
 
@@ -766,6 +819,10 @@ class Array {
    * `timestamp_start` and `timestamp_end`.
    *
    * @param array The array to be opened.
+   * @param preloaded_fragment_metadata A map from a fragment URI to
+   *     already loaded metadata for that fragment, e.g. retained across
+   *     a reopen. Fragments found in the map are reused as-is instead of
+   *     being loaded again.
    * @return tuple latest ArraySchema, map of all array schemas and
    * vector of FragmentMetadata
    *        ArraySchema The array schema to be retrieved after the
@@ -778,7 +835,9 @@ class Array {
       shared_ptr<ArraySchema>,
       std::unordered_map<std::string, shared_ptr<ArraySchema>>,
       std::vector<shared_ptr<FragmentMetadata>>>
-  open_for_reads();
+  open_for_reads(
+      const std::unordered_map<std::string, shared_ptr<FragmentMetadata>>&
+          preloaded_fragment_metadata = {});
 
   /**
    * Opens an array for reads without fragments.
@@ -837,6 +896,15 @@ class Array {
       std::unordered_map<std::string, std::pair<uint64_t, uint64_t>>*
           max_buffer_sizes_) const;
 
+  /**
+   * Joins the background fragment metadata load started by `open`, if one
+   * is still pending.
+   *
+   * @return The status the load completed with, `Status::Ok()` if no load
+   *     was pending.
+   */
+  Status join_fragment_metadata_load() const;
+
   /**
    * Load non-remote array metadata.
    */
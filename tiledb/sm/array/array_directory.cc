@@ -43,7 +43,9 @@
 #include "tiledb/sm/tile/tile.h"
 #include "tiledb/storage_format/uri/generate_uri.h"
 
+#include <algorithm>
 #include <numeric>
+#include <unordered_set>
 
 using namespace tiledb::common;
 
@@ -91,19 +93,60 @@ ArrayDirectory::ArrayDirectory(
 
 shared_ptr<ArraySchema> ArrayDirectory::load_array_schema_from_uri(
     ContextResources& resources,
+    const URI& array_uri,
     const URI& schema_uri,
     const EncryptionKey& encryption_key) {
   auto timer_se =
       resources.stats().start_timer("sm_load_array_schema_from_uri");
 
-  auto&& tile = GenericTileIO::load(resources, schema_uri, 0, encryption_key);
+  // Schema files are immutable and carry unique names, so neither the
+  // context registry of interned schemas nor the context cache of
+  // unfiltered file contents can ever serve stale data.
+  auto& registry = resources.array_schema_registry();
+  const std::string key = schema_uri.to_string();
+  if (registry.enabled()) {
+    if (auto schema = registry.find(key)) {
+      return schema;
+    }
+  }
+
+  shared_ptr<ArraySchema> schema = nullptr;
+  auto& cache = resources.array_schema_cache();
+  if (cache.enabled()) {
+    shared_ptr<std::vector<char>> buffer;
+    if (cache.lookup(key, &buffer)) {
+      Deserializer deserializer(buffer->data(), buffer->size());
+      schema = make_shared<ArraySchema>(
+          HERE(), ArraySchema::deserialize(deserializer, schema_uri));
+    }
+  }
+
+  if (schema == nullptr) {
+    auto&& tile = GenericTileIO::load(resources, schema_uri, 0, encryption_key);
+
+    resources.stats().add_counter("read_array_schema_size", tile.size());
 
-  resources.stats().add_counter("read_array_schema_size", tile.size());
+    if (cache.enabled()) {
+      auto buffer = make_shared<std::vector<char>>(HERE(), tile.size());
+      std::memcpy(buffer->data(), tile.data(), tile.size());
+      cache.insert_entry(key, std::move(buffer));
+    }
+
+    // Deserialize
+    Deserializer deserializer(tile.data(), tile.size());
+    schema = make_shared<ArraySchema>(
+        HERE(), ArraySchema::deserialize(deserializer, schema_uri));
+  }
+
+  // The array URI must be set before the schema is published so that
+  // sharing opens never mutate it.
+  schema->set_array_uri(array_uri);
+
+  if (registry.enabled()) {
+    return registry.put_if_absent(key, std::move(schema));
+  }
 
-  // Deserialize
-  Deserializer deserializer(tile.data(), tile.size());
-  return make_shared<ArraySchema>(
-      HERE(), ArraySchema::deserialize(deserializer, schema_uri));
+  return schema;
 }
 
 shared_ptr<ArraySchema> ArrayDirectory::load_array_schema_latest(
@@ -118,10 +161,8 @@ shared_ptr<ArraySchema> ArrayDirectory::load_array_schema_latest(
 
   // Load schema from URI
   const URI& schema_uri = latest_array_schema_uri();
-  auto&& array_schema =
-      load_array_schema_from_uri(resources_.get(), schema_uri, encryption_key);
-
-  array_schema->set_array_uri(uri_);
+  auto&& array_schema = load_array_schema_from_uri(
+      resources_.get(), uri_, schema_uri, encryption_key);
 
   return std::move(array_schema);
 }
@@ -168,8 +209,7 @@ ArrayDirectory::load_all_array_schemas(
         auto& schema_uri = schema_uris[schema_ith];
         try {
           auto&& array_schema = load_array_schema_from_uri(
-              resources_.get(), schema_uri, encryption_key);
-          array_schema->set_array_uri(uri_);
+              resources_.get(), uri_, schema_uri, encryption_key);
           schema_vector[schema_ith] = array_schema;
         } catch (std::exception& e) {
           return Status_ArrayDirectoryError(e.what());
@@ -583,40 +623,49 @@ const std::set<std::string>& ArrayDirectory::dir_names() {
 }
 
 std::vector<URI> ArrayDirectory::ls(const URI& uri) const {
-  auto&& [st, opt_dir_entries] = resources_.get().vfs().ls_with_sizes(uri);
-  throw_if_not_ok(st);
-  auto dir_entries = opt_dir_entries.value();
-  auto dirs = dir_names();
   std::vector<URI> uris;
+  ls_cb(uri, [&uris](const URI& entry_uri) {
+    uris.emplace_back(entry_uri);
+    return true;
+  });
 
-  for (auto entry : dir_entries) {
-    auto entry_uri = URI(entry.path().native());
+  // Streaming backends may deliver the entries unsorted.
+  std::sort(uris.begin(), uris.end(), [](const URI& l, const URI& r) {
+    return l.to_string() < r.to_string();
+  });
 
-    // Always list directories
-    if (entry.is_directory()) {
-      uris.emplace_back(entry_uri);
-      continue;
-    }
+  return uris;
+}
 
-    // Filter out empty files of the same name as the directory
-    if (entry_uri.remove_trailing_slash() == uri.remove_trailing_slash() &&
-        entry.file_size() == 0) {
-      continue;
-    }
+void ArrayDirectory::ls_cb(
+    const URI& uri, const std::function<bool(const URI&)>& cb) const {
+  auto dirs = dir_names();
+  throw_if_not_ok(resources_.get().vfs().ls_cb(
+      uri, [&](const tiledb::common::filesystem::directory_entry& entry) {
+        auto entry_uri = URI(entry.path().native());
 
-    // List non-known (user-added) directory names and non-empty files
-    auto iter = dirs.find(entry_uri.last_path_part());
-    if (iter == dirs.end() || entry.file_size() > 0) {
-      uris.emplace_back(entry_uri);
-    } else {
-      // Handle MinIO-based s3 implementation limitation
-      throw ArrayDirectoryException(
-          "Cannot list given uri; File '" + entry_uri.to_string() +
-          "' may be masking a non-empty directory by the same name.");
-    }
-  }
+        // Always list directories
+        if (entry.is_directory()) {
+          return cb(entry_uri);
+        }
 
-  return uris;
+        // Filter out empty files of the same name as the directory
+        if (entry_uri.remove_trailing_slash() == uri.remove_trailing_slash() &&
+            entry.file_size() == 0) {
+          return true;
+        }
+
+        // List non-known (user-added) directory names and non-empty files
+        auto iter = dirs.find(entry_uri.last_path_part());
+        if (iter == dirs.end() || entry.file_size() > 0) {
+          return cb(entry_uri);
+        } else {
+          // Handle MinIO-based s3 implementation limitation
+          throw ArrayDirectoryException(
+              "Cannot list given uri; File '" + entry_uri.to_string() +
+              "' may be masking a non-empty directory by the same name.");
+        }
+      }));
 }
 
 std::vector<URI> ArrayDirectory::list_root_dir_uris() {
@@ -747,6 +796,22 @@ ArrayDirectory::load_consolidated_commit_uris(
     auto& uri = commits_dir_uris[i];
     if (stdx::string::ends_with(
             uri.to_string(), constants::con_commits_file_suffix)) {
+      // The consolidated commits file name covers the timestamp range of the
+      // first and last commit it contains, so it acts as a manifest index
+      // over its contents. When reading at a narrow timestamp range, skip
+      // fetching files that cannot contain any overlapping commit. Only done
+      // for reads as consolidation and vacuuming need the full commit set.
+      if (mode_ == ArrayDirectoryMode::READ) {
+        std::pair<uint64_t, uint64_t> timestamp_range;
+        RETURN_NOT_OK_TUPLE(
+            utils::parse::get_timestamp_range(uri, &timestamp_range),
+            nullopt,
+            nullopt);
+        if (!timestamps_overlap(timestamp_range, true)) {
+          continue;
+        }
+      }
+
       uint64_t size = 0;
       RETURN_NOT_OK_TUPLE(
           resources_.get().vfs().file_size(uri, &size), nullopt, nullopt);
@@ -1293,24 +1358,82 @@ shared_ptr<const Enumeration> ArrayDirectory::load_enumeration(
     MemoryTracker& memory_tracker) const {
   auto timer_se = resources_.get().stats().start_timer("sm_load_enumeration");
 
-  auto enmr_uri = uri_.join_path(constants::array_schema_dir_name)
-                      .join_path(constants::array_enumerations_dir_name)
-                      .join_path(enumeration_path);
+  auto& cache = resources_.get().enumeration_cache();
+
+  // Extended enumerations are persisted as deltas holding only the values
+  // appended to a base enumeration, each naming the file of its base.
+  // Walk the chain iteratively down to a cached generation or the
+  // original enumeration, collecting the delta tiles along the way. The
+  // chain can be as long as the number of extensions, so recursion is not
+  // an option, and the visited set rejects corrupted files whose base
+  // paths form a cycle.
+  shared_ptr<const Enumeration> enmr;
+  std::vector<std::pair<std::string, Tile>> chain;
+  std::unordered_set<std::string> visited;
+  std::string current_path = enumeration_path;
+  while (true) {
+    auto enmr_uri = uri_.join_path(constants::array_schema_dir_name)
+                        .join_path(constants::array_enumerations_dir_name)
+                        .join_path(current_path);
+    auto key = enmr_uri.to_string();
+    if (!visited.insert(key).second) {
+      throw ArrayDirectoryException(
+          "Error loading enumeration; Cycle detected in the extension chain "
+          "of enumeration '" + enumeration_path + "'");
+    }
+
+    // Enumeration files are immutable and carry unique, generated path
+    // names, so cached entries never go stale. The memory budget is still
+    // charged on a hit because the array keeps a reference to the
+    // enumeration for as long as it is open.
+    if (cache.enabled() && cache.lookup(key, &enmr)) {
+      const uint64_t size = enmr->data().size() + enmr->offsets().size();
+      if (!memory_tracker.take_memory(
+              size, MemoryTracker::MemoryType::ENUMERATION)) {
+        throw ArrayDirectoryException(
+            "Error loading enumeration; Insufficient memory budget; Needed " +
+            std::to_string(size) + " but only had " +
+            std::to_string(memory_tracker.get_memory_available()) +
+            " from budget " +
+            std::to_string(memory_tracker.get_memory_budget()));
+      }
+      break;
+    }
 
-  auto&& tile = GenericTileIO::load(resources_, enmr_uri, 0, encryption_key);
-  resources_.get().stats().add_counter("read_enumeration_size", tile.size());
+    auto&& tile = GenericTileIO::load(resources_, enmr_uri, 0, encryption_key);
+    resources_.get().stats().add_counter("read_enumeration_size", tile.size());
 
-  if (!memory_tracker.take_memory(
-          tile.size(), MemoryTracker::MemoryType::ENUMERATION)) {
-    throw ArrayDirectoryException(
-        "Error loading enumeration; Insufficient memory budget; Needed " +
-        std::to_string(tile.size()) + " but only had " +
-        std::to_string(memory_tracker.get_memory_available()) +
-        " from budget " + std::to_string(memory_tracker.get_memory_budget()));
+    if (!memory_tracker.take_memory(
+            tile.size(), MemoryTracker::MemoryType::ENUMERATION)) {
+      throw ArrayDirectoryException(
+          "Error loading enumeration; Insufficient memory budget; Needed " +
+          std::to_string(tile.size()) + " but only had " +
+          std::to_string(memory_tracker.get_memory_available()) +
+          " from budget " + std::to_string(memory_tracker.get_memory_budget()));
+    }
+
+    Deserializer base_path_deserializer(tile.data(), tile.size());
+    const auto base_path =
+        Enumeration::deserialize_base_path(base_path_deserializer);
+    chain.emplace_back(std::move(key), std::move(tile));
+    if (base_path.empty()) {
+      // The bottom of the chain has no base; `enmr` stays nullptr.
+      break;
+    }
+    current_path = base_path;
+  }
+
+  // Reconstruct the full value list base first, caching every intermediate
+  // generation so later loads resolve it without walking the chain again.
+  for (auto it = chain.rbegin(); it != chain.rend(); it++) {
+    Deserializer deserializer(it->second.data(), it->second.size());
+    enmr = Enumeration::deserialize(deserializer, enmr);
+    if (cache.enabled()) {
+      cache.insert_entry(it->first, enmr);
+    }
   }
 
-  Deserializer deserializer(tile.data(), tile.size());
-  return Enumeration::deserialize(deserializer);
+  return enmr;
 }
 
 }  // namespace tiledb::sm
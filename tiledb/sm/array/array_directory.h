@@ -325,12 +325,18 @@ class ArrayDirectory {
   /**
    * Loads the schema of a schema uri from persistent storage into memory.
    *
+   * If the context schema registry is enabled, the returned schema is
+   * interned: concurrent opens of the same array share one instance
+   * instead of each deserializing a private copy.
+   *
+   * @param array_uri The URI path of the array.
    * @param array_schema_uri The URI path of the array schema.
    * @param encryption_key The encryption key to use.
    * @return Status, the loaded array schema
    */
   static shared_ptr<ArraySchema> load_array_schema_from_uri(
       ContextResources& resources,
+      const URI& array_uri,
       const URI& array_schema_uri,
       const EncryptionKey& encryption_key);
 
@@ -651,6 +657,17 @@ class ArrayDirectory {
    */
   std::vector<URI> ls(const URI& uri) const;
 
+  /**
+   * Lists the given URI, filtering and classifying the entries as the
+   * listing is paginated from the backend, without materializing the full
+   * directory entry vector. The callback returns `false` to stop the
+   * listing early.
+   *
+   * @param uri The URI to list
+   * @param cb The callback to invoke on every filtered URI
+   */
+  void ls_cb(const URI& uri, const std::function<bool(const URI&)>& cb) const;
+
   /**
    * List the root directory uris for v1 to v11.
    *
@@ -0,0 +1,188 @@
+/**
+ * @file   fragment_interval_index.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class FragmentIntervalIndex.
+ */
+
+#include "tiledb/sm/array/fragment_interval_index.h"
+#include "tiledb/sm/array_schema/array_schema.h"
+#include "tiledb/sm/array_schema/dimension.h"
+#include "tiledb/sm/fragment/fragment_metadata.h"
+#include "tiledb/type/apply_with_type.h"
+
+#include <algorithm>
+#include <numeric>
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/* ****************************** */
+/*          CONSTRUCTORS          */
+/* ****************************** */
+
+FragmentIntervalIndex::FragmentIntervalIndex(
+    const ArraySchema& array_schema,
+    const std::vector<shared_ptr<FragmentMetadata>>& fragment_metadata) {
+  const auto dim_num = array_schema.dim_num();
+  dim_indexes_.resize(dim_num);
+  dim_types_.resize(dim_num);
+
+  for (unsigned d = 0; d < dim_num; d++) {
+    auto dim{array_schema.dimension_ptr(d)};
+    dim_types_[d] = dim->type();
+
+    // Variable-sized dimensions are not indexed.
+    if (dim->var_size()) {
+      continue;
+    }
+
+    auto g = [&](auto T) {
+      if constexpr (!std::is_same_v<decltype(T), char>) {
+        build_dim_index<decltype(T)>(d, fragment_metadata);
+      }
+    };
+    apply_with_type(g, dim->type());
+  }
+}
+
+/* ****************************** */
+/*         PUBLIC METHODS         */
+/* ****************************** */
+
+void FragmentIntervalIndex::overlapping_fragments(
+    unsigned dim_idx,
+    const std::vector<type::Range>& ranges,
+    uint64_t r_start,
+    uint64_t r_end,
+    std::vector<unsigned>& candidates) const {
+  assert(has_dim(dim_idx));
+
+  auto g = [&](auto T) {
+    if constexpr (!std::is_same_v<decltype(T), char>) {
+      overlapping_fragments_impl<decltype(T)>(
+          dim_idx, ranges, r_start, r_end, candidates);
+    }
+  };
+  apply_with_type(g, dim_types_[dim_idx]);
+}
+
+/* ****************************** */
+/*         PRIVATE METHODS        */
+/* ****************************** */
+
+template <class T>
+void FragmentIntervalIndex::build_dim_index(
+    unsigned dim_idx,
+    const std::vector<shared_ptr<FragmentMetadata>>& fragment_metadata) {
+  auto& index = dim_indexes_[dim_idx];
+  const auto fragment_num = fragment_metadata.size();
+
+  // Sort the fragments by non-empty domain start.
+  index.order_.resize(fragment_num);
+  std::iota(index.order_.begin(), index.order_.end(), 0);
+  std::sort(
+      index.order_.begin(), index.order_.end(), [&](unsigned a, unsigned b) {
+        const auto a_data = static_cast<const T*>(
+            fragment_metadata[a]->non_empty_domain()[dim_idx].start_fixed());
+        const auto b_data = static_cast<const T*>(
+            fragment_metadata[b]->non_empty_domain()[dim_idx].start_fixed());
+        return a_data[0] < b_data[0];
+      });
+
+  // Copy the non-empty domain bounds in sorted order and compute the
+  // running maximum of the ends.
+  index.starts_.resize(fragment_num * sizeof(T));
+  index.ends_.resize(fragment_num * sizeof(T));
+  index.prefix_max_ends_.resize(fragment_num * sizeof(T));
+  auto starts = reinterpret_cast<T*>(index.starts_.data());
+  auto ends = reinterpret_cast<T*>(index.ends_.data());
+  auto prefix_max_ends = reinterpret_cast<T*>(index.prefix_max_ends_.data());
+  for (uint64_t f = 0; f < fragment_num; f++) {
+    const auto data = static_cast<const T*>(
+        fragment_metadata[index.order_[f]]
+            ->non_empty_domain()[dim_idx]
+            .start_fixed());
+    starts[f] = data[0];
+    ends[f] = data[1];
+    prefix_max_ends[f] =
+        f == 0 ? data[1] : std::max(prefix_max_ends[f - 1], data[1]);
+  }
+
+  index.built_ = true;
+}
+
+template <class T>
+void FragmentIntervalIndex::overlapping_fragments_impl(
+    unsigned dim_idx,
+    const std::vector<type::Range>& ranges,
+    uint64_t r_start,
+    uint64_t r_end,
+    std::vector<unsigned>& candidates) const {
+  const auto& index = dim_indexes_[dim_idx];
+  const auto fragment_num = index.order_.size();
+  if (fragment_num == 0) {
+    return;
+  }
+
+  // Compute the bounding interval of the query ranges.
+  auto range_data = static_cast<const T*>(ranges[r_start].start_fixed());
+  T query_start = range_data[0];
+  T query_end = range_data[1];
+  for (uint64_t r = r_start + 1; r <= r_end; r++) {
+    range_data = static_cast<const T*>(ranges[r].start_fixed());
+    query_start = std::min(query_start, range_data[0]);
+    query_end = std::max(query_end, range_data[1]);
+  }
+
+  // Binary search for the fragments starting at or before the query end.
+  const auto starts = reinterpret_cast<const T*>(index.starts_.data());
+  const auto ends = reinterpret_cast<const T*>(index.ends_.data());
+  const auto prefix_max_ends =
+      reinterpret_cast<const T*>(index.prefix_max_ends_.data());
+  const uint64_t hi = std::distance(
+      starts, std::upper_bound(starts, starts + fragment_num, query_end));
+
+  // Scan backwards through the candidates. The running maximum of the
+  // non-empty domain ends is monotonic, so once it drops below the query
+  // start every earlier fragment ends before the query as well.
+  for (uint64_t f = hi; f > 0; f--) {
+    if (prefix_max_ends[f - 1] < query_start) {
+      break;
+    }
+
+    if (ends[f - 1] >= query_start) {
+      candidates.emplace_back(index.order_[f - 1]);
+    }
+  }
+}
+
+}  // namespace sm
+}  // namespace tiledb
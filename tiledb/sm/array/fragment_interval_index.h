@@ -0,0 +1,184 @@
+/**
+ * @file   fragment_interval_index.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class FragmentIntervalIndex.
+ */
+
+#ifndef TILEDB_FRAGMENT_INTERVAL_INDEX_H
+#define TILEDB_FRAGMENT_INTERVAL_INDEX_H
+
+#include "tiledb/common/common.h"
+#include "tiledb/sm/enums/datatype.h"
+#include "tiledb/type/range/range.h"
+
+#include <vector>
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+class ArraySchema;
+class FragmentMetadata;
+
+/**
+ * A coarse, per-dimension interval index over the fragment non-empty
+ * domains. For each fixed-sized dimension, the fragments are sorted by the
+ * start of their non-empty domain and a running maximum of the non-empty
+ * domain ends is kept, so that the fragments possibly intersecting a query
+ * interval can be found with a binary search and an early-terminating scan
+ * instead of checking every fragment.
+ *
+ * The index is built once from the fragment metadata of an open array and is
+ * immutable afterwards. Variable-sized dimensions are not indexed; lookups
+ * for them have to fall back to checking every fragment.
+ */
+class FragmentIntervalIndex {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  FragmentIntervalIndex() = delete;
+
+  /**
+   * Constructor.
+   *
+   * @param array_schema The latest array schema.
+   * @param fragment_metadata The metadata of the fragments to index.
+   */
+  FragmentIntervalIndex(
+      const ArraySchema& array_schema,
+      const std::vector<shared_ptr<FragmentMetadata>>& fragment_metadata);
+
+  /** Destructor. */
+  ~FragmentIntervalIndex() = default;
+
+  DISABLE_COPY_AND_COPY_ASSIGN(FragmentIntervalIndex);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(FragmentIntervalIndex);
+
+  /* ********************************* */
+  /*          PUBLIC METHODS           */
+  /* ********************************* */
+
+  /**
+   * Returns if an index was built for the given dimension.
+   *
+   * @param dim_idx Dimension index.
+   */
+  inline bool has_dim(unsigned dim_idx) const {
+    return dim_indexes_[dim_idx].built_;
+  }
+
+  /**
+   * Appends to `candidates` the fragments whose non-empty domain on the
+   * given dimension may intersect the bounding interval of the query ranges
+   * in `[r_start, r_end]`. Fragments not appended are guaranteed to not
+   * intersect any of the ranges; appended fragments still require an exact
+   * per-range check.
+   *
+   * @param dim_idx Dimension index. Must have an index built.
+   * @param ranges Query ranges for the dimension.
+   * @param r_start First range index to consider.
+   * @param r_end Last range index to consider.
+   * @param candidates Output vector of candidate fragment indexes.
+   */
+  void overlapping_fragments(
+      unsigned dim_idx,
+      const std::vector<type::Range>& ranges,
+      uint64_t r_start,
+      uint64_t r_end,
+      std::vector<unsigned>& candidates) const;
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** The index data for one dimension. */
+  struct DimIndex {
+    /** Was the index built for this dimension. */
+    bool built_ = false;
+
+    /** Fragment indexes sorted by non-empty domain start. */
+    std::vector<unsigned> order_;
+
+    /** Non-empty domain starts, in sorted order. */
+    std::vector<uint8_t> starts_;
+
+    /** Non-empty domain ends, in start-sorted order. */
+    std::vector<uint8_t> ends_;
+
+    /** Running maximum of `ends_`. */
+    std::vector<uint8_t> prefix_max_ends_;
+  };
+
+  /** Per-dimension index data. */
+  std::vector<DimIndex> dim_indexes_;
+
+  /** Per-dimension datatype, for typed lookups. */
+  std::vector<Datatype> dim_types_;
+
+  /* ********************************* */
+  /*          PRIVATE METHODS          */
+  /* ********************************* */
+
+  /**
+   * Builds the index for one dimension.
+   *
+   * @param dim_idx Dimension index.
+   * @param fragment_metadata The metadata of the fragments to index.
+   */
+  template <class T>
+  void build_dim_index(
+      unsigned dim_idx,
+      const std::vector<shared_ptr<FragmentMetadata>>& fragment_metadata);
+
+  /**
+   * Typed implementation of `overlapping_fragments`.
+   *
+   * @param dim_idx Dimension index.
+   * @param ranges Query ranges for the dimension.
+   * @param r_start First range index to consider.
+   * @param r_end Last range index to consider.
+   * @param candidates Output vector of candidate fragment indexes.
+   */
+  template <class T>
+  void overlapping_fragments_impl(
+      unsigned dim_idx,
+      const std::vector<type::Range>& ranges,
+      uint64_t r_start,
+      uint64_t r_end,
+      std::vector<unsigned>& candidates) const;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_FRAGMENT_INTERVAL_INDEX_H
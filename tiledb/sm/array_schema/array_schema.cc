@@ -47,7 +47,9 @@
 #include "tiledb/sm/enums/datatype.h"
 #include "tiledb/sm/enums/filter_type.h"
 #include "tiledb/sm/enums/layout.h"
+#include "tiledb/sm/filter/bit_width_reduction_filter.h"
 #include "tiledb/sm/filter/compression_filter.h"
+#include "tiledb/sm/filter/positive_delta_filter.h"
 #include "tiledb/sm/filter/webp_filter.h"
 #include "tiledb/sm/misc/hilbert.h"
 #include "tiledb/sm/misc/integral_type_casts.h"
@@ -102,6 +104,12 @@ ArraySchema::ArraySchema(ArrayType array_type)
       constants::coords_compression,
       constants::coords_compression_level,
       Datatype::ANY));
+  // Offsets are monotone within a tile, so delta followed by bit-width
+  // reduction packs them down to a few bits per cell before the generic
+  // compressor runs.
+  cell_var_offsets_filters_.add_filter(PositiveDeltaFilter(Datatype::UINT64));
+  cell_var_offsets_filters_.add_filter(
+      BitWidthReductionFilter(Datatype::UINT64));
   cell_var_offsets_filters_.add_filter(CompressionFilter(
       constants::cell_var_offsets_compression,
       constants::cell_var_offsets_compression_level,
@@ -1121,6 +1129,8 @@ void ArraySchema::store_enumeration(shared_ptr<const Enumeration> enmr) {
         "Error storing enumeration. Enumeration must not be nullptr.");
   }
 
+  std::lock_guard<std::mutex> lock(mtx_);
+
   auto name_iter = enumeration_map_.find(enmr->name());
   if (name_iter == enumeration_map_.end()) {
     throw ArraySchemaException(
@@ -1128,12 +1138,6 @@ void ArraySchema::store_enumeration(shared_ptr<const Enumeration> enmr) {
         "'.");
   }
 
-  if (name_iter->second != nullptr) {
-    throw ArraySchemaException(
-        "Error storing enumeration. Enumeration named '" + enmr->name() +
-        "' has already been stored.");
-  }
-
   auto path_iter = enumeration_path_map_.find(enmr->name());
   if (path_iter == enumeration_path_map_.end()) {
     throw ArraySchemaException(
@@ -1147,6 +1151,12 @@ void ArraySchema::store_enumeration(shared_ptr<const Enumeration> enmr) {
         enmr->name() + "'.");
   }
 
+  // Storing is idempotent: schemas may be shared between array opens, so
+  // another open may have already attached the same loaded enumeration.
+  if (name_iter->second != nullptr) {
+    return;
+  }
+
   name_iter->second = enmr;
 }
 
@@ -1163,6 +1173,7 @@ std::vector<std::string> ArraySchema::get_enumeration_names() const {
 }
 
 std::vector<std::string> ArraySchema::get_loaded_enumeration_names() const {
+  std::lock_guard<std::mutex> lock(mtx_);
   std::vector<std::string> enmr_names;
   for (auto& entry : enumeration_map_) {
     if (entry.second != nullptr) {
@@ -1174,6 +1185,7 @@ std::vector<std::string> ArraySchema::get_loaded_enumeration_names() const {
 
 bool ArraySchema::is_enumeration_loaded(
     const std::string& enumeration_name) const {
+  std::lock_guard<std::mutex> lock(mtx_);
   auto iter = enumeration_map_.find(enumeration_name);
 
   if (iter == enumeration_map_.end()) {
@@ -1188,6 +1200,7 @@ bool ArraySchema::is_enumeration_loaded(
 
 shared_ptr<const Enumeration> ArraySchema::get_enumeration(
     const std::string& enmr_name) const {
+  std::lock_guard<std::mutex> lock(mtx_);
   auto iter = enumeration_map_.find(enmr_name);
   if (iter == enumeration_map_.end()) {
     throw ArraySchemaException(
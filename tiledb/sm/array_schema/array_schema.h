@@ -411,6 +411,10 @@ class ArraySchema {
    * enumeration when it is needed. An exception is thrown if the
    * Enumeration is unknown to this ArraySchema.
    *
+   * Storing is idempotent and thread-safe, because loaded schemas may be
+   * shared between array opens on a context and each open may attach the
+   * same loaded enumeration.
+   *
    * @param enmr The Enumeration to store.
    */
   void store_enumeration(shared_ptr<const Enumeration> enmr);
@@ -0,0 +1,161 @@
+/**
+ * @file   array_schema_registry.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class ArraySchemaRegistry.
+ */
+
+#ifndef TILEDB_ARRAY_SCHEMA_REGISTRY_H
+#define TILEDB_ARRAY_SCHEMA_REGISTRY_H
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "tiledb/common/common.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+class ArraySchema;
+
+/**
+ * A registry of deserialized `ArraySchema` instances shared by all array
+ * opens on a context, keyed on schema URI.
+ *
+ * Schema files are immutable once written and carry timestamped, unique
+ * names (schema evolution writes a new file), so entries never go stale.
+ * Interning the deserialized schemas lets concurrent opens of the same
+ * array share one instance rather than each holding a private copy, and
+ * skips the repeated deserialization that the serialized-bytes cache
+ * still incurs; for wide schemas opened from many threads the savings
+ * are substantial.
+ *
+ * Shared schemas may still have loaded enumerations attached after
+ * publication; `ArraySchema::store_enumeration` is idempotent and
+ * internally synchronized for this purpose. All other mutations happen
+ * on schemas that are never registered (user-built schemas) or on
+ * private copies (`ArraySchemaEvolution::evolve_schema` copies before
+ * evolving and registers the result under its new URI).
+ *
+ * The registry holds weak references, so schemas of closed arrays are
+ * freed normally and simply drop out; no size bound is needed.
+ */
+class ArraySchemaRegistry {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param enabled Whether interning is enabled.
+   */
+  explicit ArraySchemaRegistry(const bool enabled)
+      : enabled_(enabled) {
+  }
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** @return Whether the registry is enabled. */
+  inline bool enabled() const {
+    return enabled_;
+  }
+
+  /**
+   * Looks up a live interned schema.
+   *
+   * @param key Schema URI string.
+   * @return The interned schema, or `nullptr` if none is live.
+   */
+  shared_ptr<ArraySchema> find(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = registry_.find(key);
+    if (it == registry_.end()) {
+      return nullptr;
+    }
+    auto schema = it->second.lock();
+    if (schema == nullptr) {
+      registry_.erase(it);
+    }
+    return schema;
+  }
+
+  /**
+   * Interns a schema, keeping the already-interned instance if another
+   * thread registered one concurrently.
+   *
+   * @param key Schema URI string.
+   * @param schema Schema to intern.
+   * @return The interned schema to use in place of the input.
+   */
+  shared_ptr<ArraySchema> put_if_absent(
+      const std::string& key, shared_ptr<ArraySchema> schema) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = registry_.find(key);
+    if (it != registry_.end()) {
+      if (auto existing = it->second.lock()) {
+        return existing;
+      }
+    }
+
+    // Drop entries whose schemas have been freed so the map tracks only
+    // live instances.
+    for (auto e = registry_.begin(); e != registry_.end();) {
+      e = e->second.expired() ? registry_.erase(e) : std::next(e);
+    }
+
+    registry_[key] = schema;
+    return schema;
+  }
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** Whether the registry is enabled. */
+  bool enabled_;
+
+  /** Mutex protecting the registry. */
+  std::mutex mutex_;
+
+  /** The interned schemas, keyed on schema URI. */
+  std::unordered_map<std::string, std::weak_ptr<ArraySchema>> registry_;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_ARRAY_SCHEMA_REGISTRY_H
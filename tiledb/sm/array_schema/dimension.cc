@@ -81,11 +81,13 @@ Dimension::Dimension(const std::string& name, Datatype type)
   set_covered_func();
   set_overlap_func();
   set_overlap_ratio_func();
+  set_overlap_ratio_vec_func();
   set_relevant_ranges_func();
   set_covered_vec_func();
   set_split_range_func();
   set_splitting_value_func();
   set_tile_num_func();
+  set_tiles_overlap_func();
   set_map_to_uint64_2_func();
   set_map_from_uint64_func();
   set_smaller_than_func();
@@ -117,11 +119,13 @@ Dimension::Dimension(
   set_covered_func();
   set_overlap_func();
   set_overlap_ratio_func();
+  set_overlap_ratio_vec_func();
   set_relevant_ranges_func();
   set_covered_vec_func();
   set_split_range_func();
   set_splitting_value_func();
   set_tile_num_func();
+  set_tiles_overlap_func();
   set_map_to_uint64_2_func();
   set_map_from_uint64_func();
   set_smaller_than_func();
@@ -618,10 +622,12 @@ double Dimension::overlap_ratio(const Range& r1, const Range& r2) {
   assert(!r2.empty());
   auto d1 = (const T*)r1.data();
   auto d2 = (const T*)r2.data();
-  const auto r1_low = d1[0];
-  const auto r1_high = d1[1];
-  auto r2_low = d2[0];
-  auto r2_high = d2[1];
+  return overlap_ratio_impl(d1[0], d1[1], d2[0], d2[1]);
+}
+
+template <class T>
+double Dimension::overlap_ratio_impl(
+    const T r1_low, const T r1_high, T r2_low, T r2_high) {
   assert(r1_low <= r1_high);
   assert(r2_low <= r2_high);
 
@@ -712,6 +718,28 @@ double Dimension::overlap_ratio(const Range& r1, const Range& r2) const {
   return overlap_ratio_func_(r1, r2);
 }
 
+template <class T>
+void Dimension::overlap_ratio_vec(
+    const Range& r1, const uint8_t* mbrs, uint64_t mbr_num, double* ratios) {
+  assert(!r1.empty());
+  auto d1 = (const T*)r1.data();
+  auto d2 = (const T*)mbrs;
+  const auto r1_low = d1[0];
+  const auto r1_high = d1[1];
+  for (uint64_t i = 0; i < mbr_num; ++i) {
+    ratios[i] = overlap_ratio_impl(r1_low, r1_high, d2[2 * i], d2[2 * i + 1]);
+  }
+}
+
+void Dimension::overlap_ratio_vec(
+    const Range& r1,
+    const uint8_t* mbrs,
+    uint64_t mbr_num,
+    double* ratios) const {
+  assert(overlap_ratio_vec_func_ != nullptr);
+  overlap_ratio_vec_func_(r1, mbrs, mbr_num, ratios);
+}
+
 void Dimension::relevant_ranges(
     const NDRange& ranges,
     const Range& mbr,
@@ -1108,6 +1136,40 @@ uint64_t Dimension::tile_num(const Range& range) const {
   return tile_num_func_(this, range);
 }
 
+template <>
+bool Dimension::tiles_overlap<char>(
+    const Dimension*, const Range&, const Range&) {
+  return true;
+}
+
+template <class T>
+bool Dimension::tiles_overlap(
+    const Dimension* dim, const Range& r1, const Range& r2) {
+  assert(dim != nullptr);
+  assert(!r1.empty());
+  assert(!r2.empty());
+
+  // Trivial case, the whole domain is a single tile
+  if (!dim->tile_extent())
+    return true;
+
+  auto tile_extent = *(const T*)dim->tile_extent().data();
+  auto dim_dom = (const T*)dim->domain().data();
+  auto d1 = (const T*)r1.data();
+  auto d2 = (const T*)r2.data();
+
+  uint64_t start_1 = tile_idx(d1[0], dim_dom[0], tile_extent);
+  uint64_t end_1 = tile_idx(d1[1], dim_dom[0], tile_extent);
+  uint64_t start_2 = tile_idx(d2[0], dim_dom[0], tile_extent);
+  uint64_t end_2 = tile_idx(d2[1], dim_dom[0], tile_extent);
+  return std::max(start_1, start_2) <= std::min(end_1, end_2);
+}
+
+bool Dimension::tiles_overlap(const Range& r1, const Range& r2) const {
+  assert(tiles_overlap_func_ != nullptr);
+  return tiles_overlap_func_(this, r1, r2);
+}
+
 uint64_t Dimension::map_to_uint64(
     const void* coord,
     uint64_t coord_size,
@@ -1714,6 +1776,16 @@ void Dimension::set_overlap_ratio_func() {
   apply_with_type(g, type_);
 }
 
+void Dimension::set_overlap_ratio_vec_func() {
+  overlap_ratio_vec_func_ = nullptr;
+  auto g = [&](auto T) {
+    if constexpr (tiledb::type::TileDBNumeric<decltype(T)>) {
+      overlap_ratio_vec_func_ = overlap_ratio_vec<decltype(T)>;
+    }
+  };
+  apply_with_type(g, type_);
+}
+
 void Dimension::set_relevant_ranges_func() {
   auto g = [&](auto T) {
     if constexpr (std::is_same_v<decltype(T), char>) {
@@ -1768,6 +1840,15 @@ void Dimension::set_tile_num_func() {
   apply_with_type(g, type_);
 }
 
+void Dimension::set_tiles_overlap_func() {
+  auto g = [&](auto T) {
+    if constexpr (tiledb::type::TileDBFundamental<decltype(T)>) {
+      tiles_overlap_func_ = tiles_overlap<decltype(T)>;
+    }
+  };
+  apply_with_type(g, type_);
+}
+
 void Dimension::set_map_to_uint64_2_func() {
   auto g = [&](auto T) {
     if constexpr (tiledb::type::TileDBFundamental<decltype(T)>) {
@@ -594,6 +594,33 @@ class Dimension {
   template <class T>
   static double overlap_ratio(const Range& r1, const Range& r2);
 
+  /**
+   * Return ratio of the overlap of the 1D ranges `[r1_low, r1_high]` and
+   * `[r2_low, r2_high]` over the latter.
+   */
+  template <class T>
+  static double overlap_ratio_impl(T r1_low, T r1_high, T r2_low, T r2_high);
+
+  /**
+   * Computes the overlap ratio of `r1` over each range in a flattened array
+   * of 1D ranges. The ranges are stored contiguously in `mbrs` as
+   * `[low, high]` pairs of the dimension coordinate type. The ratio for each
+   * range is written to `ratios`. Applicable to fixed-sized dimensions only.
+   */
+  void overlap_ratio_vec(
+      const Range& r1,
+      const uint8_t* mbrs,
+      uint64_t mbr_num,
+      double* ratios) const;
+
+  /**
+   * Computes the overlap ratio of `r1` over each range in a flattened array
+   * of 1D ranges stored contiguously as `[low, high]` pairs.
+   */
+  template <class T>
+  static void overlap_ratio_vec(
+      const Range& r1, const uint8_t* mbrs, uint64_t mbr_num, double* ratios);
+
   /** Compute relevant ranges for a set of ranges. */
   void relevant_ranges(
       const NDRange& ranges,
@@ -651,6 +678,14 @@ class Dimension {
   template <class T>
   static uint64_t tile_num(const Dimension* dim, const Range& range);
 
+  /** Return true if the two input ranges intersect a common tile. */
+  bool tiles_overlap(const Range& r1, const Range& r2) const;
+
+  /** Return true if the two input ranges intersect a common tile. */
+  template <class T>
+  static bool tiles_overlap(
+      const Dimension* dim, const Range& r1, const Range& r2);
+
   /**
    * Maps the input coordinate to a uint64 value,
    * based on discretizing the domain from 0 to `max_bucket_val`.
@@ -786,149 +821,160 @@ class Dimension {
 
   /**
    * Stores the appropriate templated ceil_to_tile() function based on the
-   * dimension datatype.
+   * dimension datatype. The dispatch functions are plain function pointers,
+   * not `std::function` objects, as they are invoked per cell in hot loops.
    */
-  std::function<void(const Dimension*, const Range&, uint64_t, ByteVecValue*)>
-      ceil_to_tile_func_;
+  void (*ceil_to_tile_func_)(
+      const Dimension*, const Range&, uint64_t, ByteVecValue*) = nullptr;
 
   /**
    * Stores the appropriate templated check_range() function based on the
    * dimension datatype.
    */
-  std::function<bool(const Dimension*, const Range&, std::string*)>
-      check_range_func_;
+  bool (*check_range_func_)(
+      const Dimension*, const Range&, std::string*) = nullptr;
 
   /**
    * Stores the appropriate templated coincides_with_tiles() function based on
    * the dimension datatype.
    */
-  std::function<bool(const Dimension*, const Range&)>
-      coincides_with_tiles_func_;
+  bool (*coincides_with_tiles_func_)(const Dimension*, const Range&) = nullptr;
 
   /**
    * Stores the appropriate templated compute_mbr() function based on the
    * dimension datatype.
    */
-  std::function<Range(const WriterTile&)> compute_mbr_func_;
+  Range (*compute_mbr_func_)(const WriterTile&) = nullptr;
 
   /**
    * Stores the appropriate templated compute_mbr_var() function based on the
    * dimension datatype.
    */
-  std::function<Range(const WriterTile&, const WriterTile&)>
-      compute_mbr_var_func_;
+  Range (*compute_mbr_var_func_)(const WriterTile&, const WriterTile&) =
+      nullptr;
 
   /**
    * Stores the appropriate templated crop_range() function based on the
    * dimension datatype.
    */
-  std::function<void(const Dimension* dim, Range*)> crop_range_func_;
+  void (*crop_range_func_)(const Dimension* dim, Range*) = nullptr;
 
   /**
    * Stores the appropriate templated crop_range() function based on the
    * dimension datatype.
    */
-  std::function<uint64_t(const Range&)> domain_range_func_;
+  uint64_t (*domain_range_func_)(const Range&) = nullptr;
 
   /**
    * Stores the appropriate templated expand_range() function based on the
    * dimension datatype.
    */
-  std::function<void(const void*, Range*)> expand_range_v_func_;
+  void (*expand_range_v_func_)(const void*, Range*) = nullptr;
 
   /**
    * Stores the appropriate templated expand_range() function based on the
    * dimension datatype.
    */
-  std::function<void(const Range&, Range*)> expand_range_func_;
+  void (*expand_range_func_)(const Range&, Range*) = nullptr;
 
   /**
    * Stores the appropriate templated expand_to_tile() function based on the
    * dimension datatype.
    */
-  std::function<void(const Dimension* dim, Range*)> expand_to_tile_func_;
+  void (*expand_to_tile_func_)(const Dimension* dim, Range*) = nullptr;
 
   /**
    * Stores the appropriate templated oob() function based on the
    * dimension datatype.
    */
-  std::function<bool(const Dimension* dim, const void*, std::string*)>
-      oob_func_;
+  bool (*oob_func_)(const Dimension* dim, const void*, std::string*) = nullptr;
 
   /**
    * Stores the appropriate templated covered() function based on the
    * dimension datatype.
    */
-  std::function<bool(const Range&, const Range&)> covered_func_;
+  bool (*covered_func_)(const Range&, const Range&) = nullptr;
 
   /**
    * Stores the appropriate templated overlap() function based on the
    * dimension datatype.
    */
-  std::function<bool(const Range&, const Range&)> overlap_func_;
+  bool (*overlap_func_)(const Range&, const Range&) = nullptr;
 
   /**
    * Stores the appropriate templated overlap_ratio() function based on the
    * dimension datatype.
    */
-  std::function<double(const Range&, const Range&)> overlap_ratio_func_;
+  double (*overlap_ratio_func_)(const Range&, const Range&) = nullptr;
+
+  /**
+   * Stores the appropriate templated overlap_ratio_vec() function based on
+   * the dimension datatype. Unset for var-sized dimensions.
+   */
+  void (*overlap_ratio_vec_func_)(
+      const Range&, const uint8_t*, uint64_t, double*) = nullptr;
 
   /**
    * Stores the appropriate templated relevant_ranges() function based
    * on the dimension datatype.
    */
-  std::function<void(const NDRange&, const Range&, std::vector<uint64_t>&)>
-      relevant_ranges_func_;
+  void (*relevant_ranges_func_)(
+      const NDRange&, const Range&, std::vector<uint64_t>&) = nullptr;
 
   /**
    * Stores the appropriate templated covered_vec() function based on the
    * dimension datatype.
    */
-  std::function<std::vector<bool>(
-      const NDRange&, const Range&, const std::vector<uint64_t>&)>
-      covered_vec_func_;
+  std::vector<bool> (*covered_vec_func_)(
+      const NDRange&, const Range&, const std::vector<uint64_t>&) = nullptr;
 
   /**
    * Stores the appropriate templated split_range() function based on the
    * dimension datatype.
    */
-  std::function<void(const Range&, const ByteVecValue&, Range*, Range*)>
-      split_range_func_;
+  void (*split_range_func_)(
+      const Range&, const ByteVecValue&, Range*, Range*) = nullptr;
 
   /**
    * Stores the appropriate templated splitting_value() function based on the
    * dimension datatype.
    */
-  std::function<void(const Range&, ByteVecValue*, bool* unsplittable)>
-      splitting_value_func_;
+  void (*splitting_value_func_)(
+      const Range&, ByteVecValue*, bool* unsplittable) = nullptr;
 
   /**
    * Stores the appropriate templated tile_num() function based on the
    * dimension datatype.
    */
-  std::function<uint64_t(const Dimension* dim, const Range&)> tile_num_func_;
+  uint64_t (*tile_num_func_)(const Dimension* dim, const Range&) = nullptr;
+
+  /**
+   * Stores the appropriate templated tiles_overlap() function based on the
+   * dimension datatype.
+   */
+  bool (*tiles_overlap_func_)(
+      const Dimension* dim, const Range&, const Range&) = nullptr;
 
   /**
    * Stores the appropriate templated map_to_uint64_2() function based on
    * the dimension datatype.
    */
-  std::function<uint64_t(
-      const Dimension*, const void*, uint64_t, int, uint64_t)>
-      map_to_uint64_2_func_;
+  uint64_t (*map_to_uint64_2_func_)(
+      const Dimension*, const void*, uint64_t, int, uint64_t) = nullptr;
 
   /**
    * Stores the appropriate templated map_from_uint64() function based on
    * the dimension datatype.
    */
-  std::function<ByteVecValue(const Dimension*, uint64_t, int, uint64_t)>
-      map_from_uint64_func_;
+  ByteVecValue (*map_from_uint64_func_)(
+      const Dimension*, uint64_t, int, uint64_t) = nullptr;
 
   /**
    * Stores the appropriate templated smaller_than() function based on
    * the dimension datatype.
    */
-  std::function<bool(const Dimension*, const ByteVecValue&, const Range&)>
-      smaller_than_func_;
+  bool (*smaller_than_func_)(
+      const Dimension*, const ByteVecValue&, const Range&) = nullptr;
 
   /* ********************************* */
   /*          PRIVATE METHODS          */
@@ -1060,6 +1106,9 @@ class Dimension {
   /** Sets the templated overlap_ratio() function. */
   void set_overlap_ratio_func();
 
+  /** Sets the templated overlap_ratio_vec() function. */
+  void set_overlap_ratio_vec_func();
+
   /** Sets the templated relevant_ranges() function. */
   void set_relevant_ranges_func();
 
@@ -1075,6 +1124,9 @@ class Dimension {
   /** Sets the templated tile_num() function. */
   void set_tile_num_func();
 
+  /** Sets the templated tiles_overlap() function. */
+  void set_tiles_overlap_func();
+
   /** Sets the templated map_to_uint64_2() function. */
   void set_map_to_uint64_2_func();
 
@@ -30,7 +30,9 @@
  * This file implements class Enumeration.
  */
 
+#include <algorithm>
 #include <iostream>
+#include <numeric>
 #include <sstream>
 
 #include "tiledb/sm/misc/uuid.h"
@@ -56,12 +58,22 @@ Enumeration::Enumeration(
     const void* data,
     uint64_t data_size,
     const void* offsets,
-    uint64_t offsets_size)
+    uint64_t offsets_size,
+    const void* sort_order,
+    uint64_t sort_order_size,
+    const std::string& base_path_name,
+    uint32_t generation,
+    uint64_t base_data_size,
+    uint64_t base_offsets_size)
     : name_(name)
     , path_name_(path_name)
     , type_(type)
     , cell_val_num_(cell_val_num)
     , ordered_(ordered)
+    , base_path_name_(base_path_name)
+    , generation_(generation)
+    , base_data_size_(base_data_size)
+    , base_offsets_size_(base_offsets_size)
     , data_(data_size)
     , offsets_(offsets_size) {
   ensure_datatype_is_valid(type);
@@ -70,6 +82,18 @@ Enumeration::Enumeration(
     throw EnumerationException("Enumeration name must not be empty");
   }
 
+  if (base_path_name_.empty()) {
+    if (base_data_size_ != 0 || base_offsets_size_ != 0) {
+      throw EnumerationException(
+          "Invalid base sizes; must be zero without a base path name");
+    }
+  } else {
+    if (base_data_size_ > data_size || base_offsets_size_ > offsets_size) {
+      throw EnumerationException(
+          "Invalid base sizes; must not exceed the buffer sizes");
+    }
+  }
+
   if (path_name_.empty()) {
     std::string tmp_uuid;
     throw_if_not_ok(uuid::generate_uuid(&tmp_uuid, false));
@@ -174,11 +198,20 @@ Enumeration::Enumeration(
 
   throw_if_not_ok(data_.write(data, 0, data_size));
   throw_if_not_ok(offsets_.write(offsets, 0, offsets_size));
-  generate_value_map();
+  if (sort_order != nullptr) {
+    load_sort_order(sort_order, sort_order_size);
+  } else {
+    if (sort_order_size != 0) {
+      throw EnumerationException(
+          "Invalid sort order size; must be zero when no sort order is "
+          "provided.");
+    }
+    generate_sort_order();
+  }
 }
 
 shared_ptr<const Enumeration> Enumeration::deserialize(
-    Deserializer& deserializer) {
+    Deserializer& deserializer, shared_ptr<const Enumeration> base) {
   auto disk_version = deserializer.read<uint32_t>();
   if (disk_version > constants::enumerations_version) {
     throw EnumerationException(
@@ -198,6 +231,22 @@ shared_ptr<const Enumeration> Enumeration::deserialize(
   auto cell_val_num = deserializer.read<uint32_t>();
   auto ordered = deserializer.read<bool>();
 
+  // Version 2 and newer persist extensions as deltas holding only the
+  // appended values, along with the path name of the base enumeration and
+  // a generation counter.
+  std::string base_path_name;
+  uint32_t generation = 0;
+
+  if (disk_version >= 2) {
+    auto base_path_name_size = deserializer.read<uint32_t>();
+    if (base_path_name_size > 0) {
+      base_path_name = std::string(
+          deserializer.get_ptr<char>(base_path_name_size),
+          base_path_name_size);
+    }
+    generation = deserializer.read<uint32_t>();
+  }
+
   auto data_size = deserializer.read<uint64_t>();
   const void* data = nullptr;
 
@@ -215,16 +264,108 @@ shared_ptr<const Enumeration> Enumeration::deserialize(
     }
   }
 
+  // Version 1 and newer persist the sort order computed at write time so
+  // that no lookup structure has to be built when opening the array. For
+  // version 0 the sort order is recomputed from the values. Delta files
+  // never carry a sort order as it spans the full value list; it is
+  // recomputed after the reconstruction below.
+  uint64_t sort_order_size = 0;
+  const void* sort_order = nullptr;
+
+  if (disk_version >= 1) {
+    sort_order_size = deserializer.read<uint64_t>();
+    if (sort_order_size > 0) {
+      sort_order = deserializer.get_ptr<void>(sort_order_size);
+    }
+  }
+
+  if (base_path_name.empty()) {
+    return create(
+        name,
+        path_name,
+        static_cast<Datatype>(type),
+        cell_val_num,
+        ordered,
+        data,
+        data_size,
+        offsets,
+        offsets_size,
+        sort_order,
+        sort_order_size);
+  }
+
+  // Reconstruct the full value list from the base enumeration and the
+  // delta. The delta offsets were rewritten relative to the full data at
+  // extension time, so they are concatenated verbatim.
+  if (base == nullptr) {
+    throw EnumerationException(
+        "Unable to deserialize enumeration delta '" + path_name +
+        "'; no base enumeration provided for base path '" + base_path_name +
+        "'");
+  }
+
+  if (base->path_name() != base_path_name || base->name() != name) {
+    throw EnumerationException(
+        "Unable to deserialize enumeration delta '" + path_name +
+        "'; the provided base enumeration does not match");
+  }
+
+  auto base_data = base->data();
+  auto base_offsets = base->offsets();
+
+  Buffer full_data(base_data.size() + data_size);
+  throw_if_not_ok(full_data.write(base_data.data(), base_data.size()));
+  if (data_size > 0) {
+    throw_if_not_ok(full_data.write(data, data_size));
+  }
+
+  Buffer full_offsets(base_offsets.size() + offsets_size);
+  throw_if_not_ok(full_offsets.write(base_offsets.data(), base_offsets.size()));
+  if (offsets_size > 0) {
+    throw_if_not_ok(full_offsets.write(offsets, offsets_size));
+  }
+
   return create(
       name,
       path_name,
       static_cast<Datatype>(type),
       cell_val_num,
       ordered,
-      data,
-      data_size,
-      offsets,
-      offsets_size);
+      full_data.data(),
+      full_data.size(),
+      full_offsets.size() > 0 ? full_offsets.data() : nullptr,
+      full_offsets.size(),
+      nullptr,
+      0,
+      base_path_name,
+      generation,
+      base_data.size(),
+      base_offsets.size());
+}
+
+std::string Enumeration::deserialize_base_path(Deserializer& deserializer) {
+  auto disk_version = deserializer.read<uint32_t>();
+  if (disk_version < 2) {
+    return "";
+  }
+
+  auto name_size = deserializer.read<uint32_t>();
+  deserializer.get_ptr<char>(name_size);
+
+  auto path_name_size = deserializer.read<uint32_t>();
+  deserializer.get_ptr<char>(path_name_size);
+
+  deserializer.read<uint8_t>();
+  deserializer.read<uint32_t>();
+  deserializer.read<bool>();
+
+  auto base_path_name_size = deserializer.read<uint32_t>();
+  if (base_path_name_size == 0) {
+    return "";
+  }
+
+  return std::string(
+      deserializer.get_ptr<char>(base_path_name_size), base_path_name_size);
 }
 
 shared_ptr<const Enumeration> Enumeration::extend(
@@ -295,6 +436,8 @@ shared_ptr<const Enumeration> Enumeration::extend(
     new_offsets_size = new_offsets.size();
   }
 
+  // The extension only references this enumeration as its base and is
+  // persisted as a delta holding the appended values.
   return create(
       name_,
       "",
@@ -304,7 +447,13 @@ shared_ptr<const Enumeration> Enumeration::extend(
       new_data.data(),
       new_data.size(),
       new_offsets_ptr,
-      new_offsets_size);
+      new_offsets_size,
+      nullptr,
+      0,
+      path_name_,
+      generation_ + 1,
+      data_.size(),
+      offsets_.size());
 }
 
 bool Enumeration::is_extension_of(shared_ptr<const Enumeration> other) const {
@@ -362,31 +511,65 @@ void Enumeration::serialize(Serializer& serializer) const {
   serializer.write<uint8_t>(static_cast<uint8_t>(type_));
   serializer.write<uint32_t>(cell_val_num_);
   serializer.write<bool>(ordered_);
-  serializer.write<uint64_t>(data_.size());
-  if (data_.size() > 0) {
-    serializer.write(data_.data(), data_.size());
+
+  // Extensions are persisted as deltas: only the values appended to the
+  // base enumeration are written, so clients that already hold the base
+  // fetch only the appended segment.
+  auto base_path_name_size = static_cast<uint32_t>(base_path_name_.size());
+  serializer.write<uint32_t>(base_path_name_size);
+  if (base_path_name_size > 0) {
+    serializer.write(base_path_name_.data(), base_path_name_size);
+  }
+  serializer.write<uint32_t>(generation_);
+
+  const uint64_t data_size = data_.size() - base_data_size_;
+  serializer.write<uint64_t>(data_size);
+  if (data_size > 0) {
+    serializer.write(data_.data_as<uint8_t>() + base_data_size_, data_size);
   }
 
   if (var_size()) {
-    serializer.write<uint64_t>(offsets_.size());
-    if (offsets_.size() > 0) {
-      serializer.write(offsets_.data(), offsets_.size());
+    const uint64_t offsets_size = offsets_.size() - base_offsets_size_;
+    serializer.write<uint64_t>(offsets_size);
+    if (offsets_size > 0) {
+      serializer.write(
+          offsets_.data_as<uint8_t>() + base_offsets_size_, offsets_size);
     }
   } else {
     assert(cell_val_num_ < constants::var_num);
     assert(offsets_.size() == 0);
   }
+
+  // Persist the sort order so that readers can binary search the values
+  // without building any lookup structure at array open. The sort order
+  // spans the full value list, so deltas never carry one; it is
+  // recomputed when the delta is loaded.
+  if (base_path_name_.empty()) {
+    uint64_t sort_order_size = sort_order_.size() * sizeof(uint64_t);
+    serializer.write<uint64_t>(sort_order_size);
+    if (sort_order_size > 0) {
+      serializer.write(sort_order_.data(), sort_order_size);
+    }
+  } else {
+    serializer.write<uint64_t>(0);
+  }
 }
 
 uint64_t Enumeration::index_of(const void* data, uint64_t size) const {
   std::string_view value_view(static_cast<const char*>(data), size);
 
-  auto iter = value_map_.find(value_view);
-  if (iter == value_map_.end()) {
+  auto iter = std::lower_bound(
+      sort_order_.begin(),
+      sort_order_.end(),
+      value_view,
+      [&](uint64_t index, std::string_view value) {
+        return value_at(index) < value;
+      });
+  if (iter == sort_order_.end() || value_at(*iter) != value_view) {
     return constants::enumeration_missing_value;
   }
 
-  return iter->second;
+  return *iter;
 }
 
 void Enumeration::dump(FILE* out) const {
@@ -399,49 +582,64 @@ void Enumeration::dump(FILE* out) const {
   ss << "- Type: " << datatype_str(type_) << std::endl;
   ss << "- Cell Val Num: " << cell_val_num_ << std::endl;
   ss << "- Ordered: " << (ordered_ ? "true" : "false") << std::endl;
-  ss << "- Element Count: " << value_map_.size() << std::endl;
+  ss << "- Element Count: " << elem_count() << std::endl;
   fprintf(out, "%s", ss.str().c_str());
 }
 
-void Enumeration::generate_value_map() {
-  // If we've got no data, there are no values to generate.
-  if (data_.size() == 0) {
-    return;
-  }
-
+std::string_view Enumeration::value_at(uint64_t index) const {
   auto char_data = data_.data_as<char>();
   if (var_size()) {
     auto offsets = offsets_.data_as<uint64_t>();
     uint64_t num_offsets = offsets_.size() / sizeof(uint64_t);
-
-    for (uint64_t i = 0; i < num_offsets; i++) {
-      uint64_t length = 0;
-      if (i < num_offsets - 1) {
-        length = offsets[i + 1] - offsets[i];
-      } else {
-        length = data_.size() - offsets[i];
-      }
-
-      auto sv = std::string_view(char_data + offsets[i], length);
-      add_value_to_map(sv, i);
+    uint64_t length = 0;
+    if (index < num_offsets - 1) {
+      length = offsets[index + 1] - offsets[index];
+    } else {
+      length = data_.size() - offsets[index];
     }
+
+    return {char_data + offsets[index], length};
   } else {
-    uint64_t i = 0;
     auto stride = cell_size();
-    while (i * stride < data_.size()) {
-      auto sv = std::string_view(char_data + i * stride, stride);
-      add_value_to_map(sv, i);
-      i += 1;
+    return {char_data + index * stride, stride};
+  }
+}
+
+void Enumeration::generate_sort_order() {
+  // If we've got no data, there are no values to sort.
+  if (data_.size() == 0) {
+    return;
+  }
+
+  sort_order_.resize(elem_count());
+  std::iota(sort_order_.begin(), sort_order_.end(), 0);
+  std::sort(
+      sort_order_.begin(), sort_order_.end(), [&](uint64_t a, uint64_t b) {
+        return value_at(a) < value_at(b);
+      });
+
+  // Duplicated values sort adjacently.
+  for (uint64_t i = 1; i < sort_order_.size(); i++) {
+    auto sv = value_at(sort_order_[i]);
+    if (value_at(sort_order_[i - 1]) == sv) {
+      throw EnumerationException(
+          "Invalid duplicated value in enumeration '" + std::string(sv) + "'");
     }
   }
 }
 
-void Enumeration::add_value_to_map(std::string_view& sv, uint64_t index) {
-  if (value_map_.find(sv) != value_map_.end()) {
+void Enumeration::load_sort_order(
+    const void* sort_order, uint64_t sort_order_size) {
+  if (sort_order_size != elem_count() * sizeof(uint64_t)) {
     throw EnumerationException(
-        "Invalid duplicated value in enumeration '" + std::string(sv) + "'");
+        "Invalid sort order size; expected " +
+        std::to_string(elem_count() * sizeof(uint64_t)) + " bytes, got " +
+        std::to_string(sort_order_size) + " bytes.");
   }
-  value_map_[sv] = index;
+
+  auto sort_order_values = static_cast<const uint64_t*>(sort_order);
+  sort_order_.assign(
+      sort_order_values, sort_order_values + elem_count());
 }
 
 }  // namespace tiledb::sm
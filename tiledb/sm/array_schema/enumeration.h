@@ -122,6 +122,19 @@ class Enumeration {
    *        offsets buffer. Must be null if cell_var_num is not var_num.
    * @param offsets_size The size of the buffer pointed to by offsets. Must be
    *        zero of cell_var_num is not var_num.
+   * @param sort_order A pointer to a persisted sort order for the values,
+   *        or nullptr to compute the sort order from the values.
+   * @param sort_order_size The size of the buffer pointed to by sort_order.
+   *        Must be zero if sort_order is nullptr.
+   * @param base_path_name The path name of the enumeration this one
+   *        extends, or the empty string if it is not an extension.
+   * @param generation The number of extensions this enumeration is away
+   *        from the originally created one.
+   * @param base_data_size The size of the prefix of data that belongs to
+   *        the base enumeration. Must be zero if base_path_name is empty.
+   * @param base_offsets_size The size of the prefix of offsets that
+   *        belongs to the base enumeration. Must be zero if base_path_name
+   *        is empty.
    * @return shared_ptr<Enumeration> The created enumeration.
    */
   static shared_ptr<const Enumeration> create(
@@ -133,7 +146,13 @@ class Enumeration {
       const void* data,
       uint64_t data_size,
       const void* offsets,
-      uint64_t offsets_size) {
+      uint64_t offsets_size,
+      const void* sort_order = nullptr,
+      uint64_t sort_order_size = 0,
+      const std::string& base_path_name = "",
+      uint32_t generation = 0,
+      uint64_t base_data_size = 0,
+      uint64_t base_offsets_size = 0) {
     struct EnableMakeShared : public Enumeration {
       EnableMakeShared(
           const std::string& name,
@@ -144,7 +163,13 @@ class Enumeration {
           const void* data,
           uint64_t data_size,
           const void* offsets,
-          uint64_t offsets_size)
+          uint64_t offsets_size,
+          const void* sort_order,
+          uint64_t sort_order_size,
+          const std::string& base_path_name,
+          uint32_t generation,
+          uint64_t base_data_size,
+          uint64_t base_offsets_size)
           : Enumeration(
                 name,
                 path_name,
@@ -154,7 +179,13 @@ class Enumeration {
                 data,
                 data_size,
                 offsets,
-                offsets_size) {
+                offsets_size,
+                sort_order,
+                sort_order_size,
+                base_path_name,
+                generation,
+                base_data_size,
+                base_offsets_size) {
       }
     };
     return make_shared<EnableMakeShared>(
@@ -167,16 +198,42 @@ class Enumeration {
         data,
         data_size,
         offsets,
-        offsets_size);
+        offsets_size,
+        sort_order,
+        sort_order_size,
+        base_path_name,
+        generation,
+        base_data_size,
+        base_offsets_size);
   }
 
   /**
    * Deserialize an enumeration
    *
+   * Extended enumerations are persisted as deltas: their file only holds
+   * the values appended to a base enumeration. For such files the caller
+   * must resolve the base, discovered with `deserialize_base_path`, and
+   * provide it so the full value list can be reconstructed.
+   *
    * @param deserializer The deserializer to deserialize from.
+   * @param base The base enumeration a delta file extends, or nullptr for
+   *        files holding a full enumeration.
    * @return A new Enumeration.
    */
-  static shared_ptr<const Enumeration> deserialize(Deserializer& deserializer);
+  static shared_ptr<const Enumeration> deserialize(
+      Deserializer& deserializer,
+      shared_ptr<const Enumeration> base = nullptr);
+
+  /**
+   * Return the path name of the base enumeration a serialized enumeration
+   * extends. Returns an empty string for files holding a full
+   * enumeration.
+   *
+   * @param deserializer A throwaway deserializer positioned at the start
+   *        of the serialized enumeration; it is advanced into the header.
+   * @return The base path name, empty if the file is not a delta.
+   */
+  static std::string deserialize_base_path(Deserializer& deserializer);
 
   /**
    * Create a new enumeration by extending an existing enumeration's
@@ -231,6 +288,26 @@ class Enumeration {
     return path_name_;
   }
 
+  /**
+   * The path name of the enumeration this one extends, empty if this
+   * enumeration is not an extension.
+   *
+   * @return The base path name of this Enumeration.
+   */
+  const std::string& base_path_name() const {
+    return base_path_name_;
+  }
+
+  /**
+   * The number of extensions this enumeration is away from the originally
+   * created one.
+   *
+   * @return The generation of this Enumeration.
+   */
+  uint32_t generation() const {
+    return generation_;
+  }
+
   /**
    * The type of the enumeration values
    *
@@ -356,6 +433,18 @@ class Enumeration {
    *        offsets buffer. Must be null if cell_var_num is not var_num.
    * @param offsets_size The size of the buffer pointed to by offsets. Must be
    *        zero of cell_var_num is not var_num.
+   * @param sort_order A pointer to a persisted sort order for the values,
+   *        or nullptr to compute the sort order from the values.
+   * @param sort_order_size The size of the buffer pointed to by sort_order.
+   *        Must be zero if sort_order is nullptr.
+   * @param base_path_name The path name of the enumeration this one
+   *        extends, or the empty string if it is not an extension.
+   * @param generation The number of extensions this enumeration is away
+   *        from the originally created one.
+   * @param base_data_size The size of the prefix of data that belongs to
+   *        the base enumeration.
+   * @param base_offsets_size The size of the prefix of offsets that
+   *        belongs to the base enumeration.
    */
   Enumeration(
       const std::string& name,
@@ -366,7 +455,13 @@ class Enumeration {
       const void* data,
       uint64_t data_size,
       const void* offsets,
-      uint64_t offsets_size);
+      uint64_t offsets_size,
+      const void* sort_order,
+      uint64_t sort_order_size,
+      const std::string& base_path_name = "",
+      uint32_t generation = 0,
+      uint64_t base_data_size = 0,
+      uint64_t base_offsets_size = 0);
 
   /* ********************************* */
   /*         PRIVATE ATTRIBUTES        */
@@ -387,29 +482,57 @@ class Enumeration {
   /** A flag which enables or disables inequality comparisons */
   bool ordered_;
 
+  /**
+   * The path name of the enumeration this one extends. Extensions are
+   * persisted as deltas holding only the appended values, so clients that
+   * already have the base enumeration cached fetch only the small
+   * appended segment instead of re-downloading the whole value list.
+   */
+  std::string base_path_name_;
+
+  /**
+   * The number of extensions this enumeration is away from the originally
+   * created one.
+   */
+  uint32_t generation_;
+
+  /** The size of the prefix of `data_` owned by the base enumeration. */
+  uint64_t base_data_size_;
+
+  /** The size of the prefix of `offsets_` owned by the base enumeration. */
+  uint64_t base_offsets_size_;
+
   /** The list of enumeration values */
   Buffer data_;
 
   /** The offsets of each enumeration value if var sized. */
   Buffer offsets_;
 
-  /** Map of values to indices */
-  std::unordered_map<std::string_view, uint64_t> value_map_;
+  /**
+   * Indices of the enumeration values sorted by their byte representation.
+   * Built once at write time and persisted with the enumeration, so
+   * `index_of` binary searches directly over the loaded buffers without
+   * any per-open map construction.
+   */
+  std::vector<uint64_t> sort_order_;
 
   /* ********************************* */
   /*          PRIVATE METHODS          */
   /* ********************************* */
 
-  /** Populate the value_map_ */
-  void generate_value_map();
+  /** Returns the value at the given index as a string view. */
+  std::string_view value_at(uint64_t index) const;
+
+  /** Populate sort_order_ by sorting the value indices. */
+  void generate_sort_order();
 
   /**
-   * Add a value to value_map_
+   * Validate and adopt a persisted sort order.
    *
-   * @param sv A string view of the data to add.
-   * @param index The index of the data in the Enumeration.
+   * @param sort_order A pointer to the persisted sort order.
+   * @param sort_order_size The size of the buffer pointed to by sort_order.
    */
-  void add_value_to_map(std::string_view& sv, uint64_t index);
+  void load_sort_order(const void* sort_order, uint64_t sort_order_size);
 };
 
 }  // namespace tiledb::sm
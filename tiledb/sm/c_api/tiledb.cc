@@ -69,6 +69,7 @@
 #include "tiledb/sm/enums/query_type.h"
 #include "tiledb/sm/enums/serialization_type.h"
 #include "tiledb/sm/filter/filter_pipeline.h"
+#include "tiledb/sm/misc/parallel_functions.h"
 #include "tiledb/sm/misc/tdb_time.h"
 #include "tiledb/sm/query/query.h"
 #include "tiledb/sm/query/query_condition.h"
@@ -87,8 +88,11 @@
 #include "tiledb/sm/subarray/subarray.h"
 #include "tiledb/sm/subarray/subarray_partitioner.h"
 
+#include <chrono>
+#include <condition_variable>
 #include <memory>
 #include <sstream>
+#include <thread>
 
 /**
  * Helper class to aid shimming access from _query... routines in this module to
@@ -1240,6 +1244,30 @@ int32_t tiledb_query_submit(tiledb_ctx_t* ctx, tiledb_query_t* query) {
   return TILEDB_OK;
 }
 
+capi_return_t tiledb_query_submit_batch(
+    tiledb_ctx_t* ctx, tiledb_query_t* const* queries, uint64_t num_queries) {
+  // Trivial case
+  if (num_queries == 0)
+    return TILEDB_OK;
+
+  // Sanity checks
+  if (queries == nullptr)
+    return TILEDB_ERR;
+  for (uint64_t i = 0; i < num_queries; i++) {
+    if (sanity_check(ctx, queries[i]) == TILEDB_ERR)
+      return TILEDB_ERR;
+  }
+
+  // Submit the queries concurrently on the compute thread pool. All queries
+  // are submitted even if one fails; the first error is returned.
+  throw_if_not_ok(tiledb::sm::parallel_for(
+      ctx->storage_manager()->compute_tp(), 0, num_queries, [&](uint64_t i) {
+        return queries[i]->query_->submit();
+      }));
+
+  return TILEDB_OK;
+}
+
 int32_t tiledb_query_submit_async(
     tiledb_ctx_t* ctx,
     tiledb_query_t* query,
@@ -2471,6 +2499,30 @@ int32_t tiledb_array_reopen(tiledb_ctx_t* ctx, tiledb_array_t* array) {
   return TILEDB_OK;
 }
 
+capi_return_t tiledb_array_prefetch(
+    tiledb_ctx_t* ctx,
+    tiledb_array_t* array,
+    tiledb_subarray_t* const* subarrays,
+    uint64_t num_subarrays,
+    uint64_t budget) {
+  if (sanity_check(ctx, array) == TILEDB_ERR)
+    return TILEDB_ERR;
+  if (num_subarrays > 0 && subarrays == nullptr)
+    return TILEDB_ERR;
+
+  std::vector<tiledb::sm::Subarray> sm_subarrays;
+  sm_subarrays.reserve(num_subarrays);
+  for (uint64_t i = 0; i < num_subarrays; i++) {
+    if (sanity_check(ctx, subarrays[i]) == TILEDB_ERR)
+      return TILEDB_ERR;
+    sm_subarrays.emplace_back(*subarrays[i]->subarray_);
+  }
+
+  array->array_->prefetch(sm_subarrays, budget);
+
+  return TILEDB_OK;
+}
+
 int32_t tiledb_array_set_config(
     tiledb_ctx_t* ctx, tiledb_array_t* array, tiledb_config_t* config) {
   // Sanity check
@@ -3318,6 +3370,28 @@ int32_t tiledb_stats_raw_dump(FILE* out) {
   return TILEDB_OK;
 }
 
+int32_t tiledb_stats_trace_dump(FILE* out) {
+  tiledb::sm::stats::all_stats.dump_trace(out);
+  return TILEDB_OK;
+}
+
+int32_t tiledb_stats_trace_dump_str(char** out) {
+  if (out == nullptr)
+    return TILEDB_ERR;
+
+  std::string str;
+  tiledb::sm::stats::all_stats.dump_trace(&str);
+
+  *out = static_cast<char*>(std::malloc(str.size() + 1));
+  if (*out == nullptr)
+    return TILEDB_ERR;
+
+  std::memcpy(*out, str.data(), str.size());
+  (*out)[str.size()] = '\0';
+
+  return TILEDB_OK;
+}
+
 int32_t tiledb_stats_raw_dump_str(char** out) {
   if (out == nullptr)
     return TILEDB_ERR;
@@ -3360,6 +3434,682 @@ int32_t tiledb_heap_profiler_enable(
   return TILEDB_OK;
 }
 
+/* ****************************** */
+/*          Context Pool          */
+/* ****************************** */
+
+namespace {
+
+/**
+ * A process-wide pool of pre-warmed contexts with background metadata
+ * refresh. See `tiledb_ctx_pool_init`.
+ */
+class ContextPool {
+ public:
+  ~ContextPool() {
+    shutdown();
+  }
+
+  /** Pre-creates the pooled contexts and starts the refresh thread. */
+  void init(
+      const tiledb::sm::Config& config,
+      uint32_t num_contexts,
+      uint64_t refresh_interval_ms) {
+    std::unique_lock<std::mutex> lk(mtx_);
+    if (!entries_.empty()) {
+      throw CAPIStatusException("Context pool is already initialized");
+    }
+    if (num_contexts == 0) {
+      throw CAPIStatusException(
+          "Context pool size must be greater than zero");
+    }
+
+    config_ = config;
+    for (uint32_t i = 0; i < num_contexts; i++) {
+      entries_.emplace_back();
+      entries_.back().ctx = tiledb_ctx_handle_t::make_handle(config_);
+    }
+
+    refresh_interval_ms_ = refresh_interval_ms;
+    if (refresh_interval_ms_ > 0) {
+      running_ = true;
+      refresh_thread_ = std::thread([this]() { refresh_loop(); });
+    }
+  }
+
+  /**
+   * Opens the array for reads on every pooled context and registers it
+   * for background refresh.
+   */
+  void keep_open(const std::string& array_uri) {
+    std::unique_lock<std::mutex> lk(mtx_);
+    ensure_initialized();
+    for (auto& entry : entries_) {
+      open_array_on_entry(entry, array_uri);
+    }
+    array_uris_.push_back(array_uri);
+  }
+
+  /** Hands out a free pooled context, growing the pool if all are busy. */
+  tiledb_ctx_handle_t* acquire() {
+    std::unique_lock<std::mutex> lk(mtx_);
+    ensure_initialized();
+    for (auto& entry : entries_) {
+      if (!entry.in_use) {
+        entry.in_use = true;
+        return entry.ctx;
+      }
+    }
+
+    // All pooled contexts are busy; grow the pool by one cold entry.
+    entries_.emplace_back();
+    auto& entry = entries_.back();
+    entry.ctx = tiledb_ctx_handle_t::make_handle(config_);
+    entry.in_use = true;
+    for (const auto& array_uri : array_uris_) {
+      open_array_on_entry(entry, array_uri);
+    }
+    return entry.ctx;
+  }
+
+  /** Returns a shared handle to a kept-open array of a pooled context. */
+  shared_ptr<tiledb::sm::Array> get_array(
+      tiledb_ctx_handle_t* ctx, const std::string& array_uri) {
+    std::unique_lock<std::mutex> lk(mtx_);
+    ensure_initialized();
+    auto* entry = find_entry(ctx);
+    if (entry == nullptr) {
+      throw CAPIStatusException("Context does not belong to the pool");
+    }
+    auto it = entry->arrays.find(array_uri);
+    if (it == entry->arrays.end()) {
+      throw CAPIStatusException(
+          "Array '" + array_uri + "' is not kept open by the pool");
+    }
+    return it->second;
+  }
+
+  /** Returns a context to the pool. */
+  void release(tiledb_ctx_handle_t* ctx) {
+    std::unique_lock<std::mutex> lk(mtx_);
+    auto* entry = find_entry(ctx);
+    if (entry == nullptr) {
+      throw CAPIStatusException("Context does not belong to the pool");
+    }
+    if (!entry->in_use) {
+      throw CAPIStatusException("Context was already released to the pool");
+    }
+    entry->in_use = false;
+  }
+
+  /** Stops the refresh thread and destroys all pooled contexts. */
+  void shutdown() {
+    {
+      std::unique_lock<std::mutex> lk(mtx_);
+      if (!running_ && entries_.empty()) {
+        return;
+      }
+      running_ = false;
+    }
+    cv_.notify_all();
+    if (refresh_thread_.joinable()) {
+      refresh_thread_.join();
+    }
+
+    std::unique_lock<std::mutex> lk(mtx_);
+    for (auto& entry : entries_) {
+      for (auto& array : entry.arrays) {
+        throw_if_not_ok(array.second->close());
+      }
+      entry.arrays.clear();
+      tiledb_ctx_handle_t::break_handle(entry.ctx);
+    }
+    entries_.clear();
+    array_uris_.clear();
+  }
+
+ private:
+  /** A pooled context together with its kept-open arrays. */
+  struct Entry {
+    tiledb_ctx_handle_t* ctx = nullptr;
+    std::map<std::string, shared_ptr<tiledb::sm::Array>> arrays;
+    bool in_use = false;
+  };
+
+  /** Throws if the pool has not been initialized. */
+  void ensure_initialized() const {
+    if (entries_.empty()) {
+      throw CAPIStatusException("Context pool is not initialized");
+    }
+  }
+
+  /** Returns the entry owning `ctx`, or `nullptr`. */
+  Entry* find_entry(tiledb_ctx_handle_t* ctx) {
+    for (auto& entry : entries_) {
+      if (entry.ctx == ctx) {
+        return &entry;
+      }
+    }
+    return nullptr;
+  }
+
+  /** Opens `array_uri` for reads on `entry`. Must hold `mtx_`. */
+  void open_array_on_entry(Entry& entry, const std::string& array_uri) {
+    auto array = make_shared<tiledb::sm::Array>(
+        HERE(), tiledb::sm::URI(array_uri), entry.ctx->storage_manager());
+    throw_if_not_ok(array->open(
+        tiledb::sm::QueryType::READ,
+        tiledb::sm::EncryptionType::NO_ENCRYPTION,
+        nullptr,
+        0));
+    entry.arrays[array_uri] = array;
+  }
+
+  /**
+   * Periodically re-validates the `ArrayDirectory` snapshots of the
+   * kept-open arrays of all free pooled contexts, so that an acquired
+   * context serves current metadata without paying for the listing on
+   * the request path. Entries are marked busy while refreshing so the
+   * I/O happens outside the pool lock.
+   */
+  void refresh_loop() {
+    std::unique_lock<std::mutex> lk(mtx_);
+    while (running_) {
+      cv_.wait_for(
+          lk, std::chrono::milliseconds(refresh_interval_ms_), [this]() {
+            return !running_;
+          });
+      if (!running_) {
+        break;
+      }
+
+      for (size_t i = 0; i < entries_.size(); i++) {
+        if (entries_[i].in_use) {
+          continue;
+        }
+        entries_[i].in_use = true;
+        auto arrays = entries_[i].arrays;
+        lk.unlock();
+        for (auto& array : arrays) {
+          auto st = array.second->reopen();
+          if (!st.ok()) {
+            LOG_STATUS_NO_RETURN_VALUE(st);
+          }
+        }
+        lk.lock();
+        entries_[i].in_use = false;
+      }
+    }
+  }
+
+  /** The pooled contexts. */
+  std::vector<Entry> entries_;
+
+  /** The config the pooled contexts are created with. */
+  tiledb::sm::Config config_;
+
+  /** The URIs of the arrays kept open on every pooled context. */
+  std::vector<std::string> array_uris_;
+
+  /** Protects all pool state. */
+  std::mutex mtx_;
+
+  /** Wakes up the refresh thread for shutdown. */
+  std::condition_variable cv_;
+
+  /** The background metadata refresh thread. */
+  std::thread refresh_thread_;
+
+  /** The interval between two metadata refreshes. Zero disables refresh. */
+  uint64_t refresh_interval_ms_ = 0;
+
+  /** Whether the refresh thread is running. */
+  bool running_ = false;
+};
+
+/** The process-wide context pool. */
+ContextPool context_pool;
+
+}  // namespace
+
+capi_return_t tiledb_ctx_pool_init(
+    tiledb_config_t* config,
+    uint32_t num_contexts,
+    uint64_t refresh_interval_ms) {
+  if (config == nullptr) {
+    context_pool.init(
+        tiledb::sm::Config{}, num_contexts, refresh_interval_ms);
+  } else {
+    ensure_config_is_valid(config);
+    context_pool.init(config->config(), num_contexts, refresh_interval_ms);
+  }
+  return TILEDB_OK;
+}
+
+capi_return_t tiledb_ctx_pool_keep_open(const char* array_uri) {
+  if (array_uri == nullptr) {
+    throw CAPIStatusException(
+        "tiledb_ctx_pool_keep_open: array_uri may not be null");
+  }
+  context_pool.keep_open(array_uri);
+  return TILEDB_OK;
+}
+
+capi_return_t tiledb_ctx_pool_acquire(tiledb_ctx_t** ctx) {
+  ensure_output_pointer_is_valid(ctx);
+  *ctx = context_pool.acquire();
+  return TILEDB_OK;
+}
+
+capi_return_t tiledb_ctx_pool_get_array(
+    tiledb_ctx_t* ctx, const char* array_uri, tiledb_array_t** array) {
+  ensure_context_is_valid(ctx);
+  ensure_output_pointer_is_valid(array);
+  if (array_uri == nullptr) {
+    throw CAPIStatusException(
+        "tiledb_ctx_pool_get_array: array_uri may not be null");
+  }
+
+  *array = new (std::nothrow) tiledb_array_t;
+  if (*array == nullptr) {
+    return TILEDB_OOM;
+  }
+  try {
+    (*array)->array_ = context_pool.get_array(ctx, array_uri);
+  } catch (...) {
+    delete *array;
+    *array = nullptr;
+    throw;
+  }
+  return TILEDB_OK;
+}
+
+capi_return_t tiledb_ctx_pool_release(tiledb_ctx_t* ctx) {
+  ensure_context_is_valid(ctx);
+  context_pool.release(ctx);
+  return TILEDB_OK;
+}
+
+capi_return_t tiledb_ctx_pool_shutdown() {
+  context_pool.shutdown();
+  return TILEDB_OK;
+}
+
+/* ****************************** */
+/*     Arrow C Data Interface     */
+/* ****************************** */
+
+namespace {
+
+/*
+ * Definitions of the Arrow C Data Interface structs, which are a stable
+ * ABI shared by all Arrow implementations; see
+ * https://arrow.apache.org/docs/format/CDataInterface.html. The structs
+ * are passed through the C API as `void*` so that the public header does
+ * not have to define them, matching `tiledb::arrow::ArrowAdapter` in the
+ * C++ API.
+ */
+struct ArrowSchema {
+  const char* format;
+  const char* name;
+  const char* metadata;
+  int64_t flags;
+  int64_t n_children;
+  struct ArrowSchema** children;
+  struct ArrowSchema* dictionary;
+  void (*release)(struct ArrowSchema*);
+  void* private_data;
+};
+
+struct ArrowArray {
+  int64_t length;
+  int64_t null_count;
+  int64_t offset;
+  int64_t n_buffers;
+  int64_t n_children;
+  const void** buffers;
+  struct ArrowArray** children;
+  struct ArrowArray* dictionary;
+  void (*release)(struct ArrowArray*);
+  void* private_data;
+};
+
+/** Exporter-owned storage referenced by an exported `ArrowSchema`. */
+struct ArrowSchemaHolder {
+  /** Storage for `ArrowSchema::format`. */
+  std::string format;
+  /** Storage for `ArrowSchema::name`. */
+  std::string name;
+};
+
+/** Exporter-owned storage referenced by an exported `ArrowArray`. */
+struct ArrowArrayHolder {
+  /** Storage for `ArrowArray::buffers`. */
+  const void* buffers[3];
+};
+
+void release_exported_arrow_schema(struct ArrowSchema* schema) {
+  delete static_cast<ArrowSchemaHolder*>(schema->private_data);
+  schema->private_data = nullptr;
+  schema->release = nullptr;
+}
+
+void release_exported_arrow_array(struct ArrowArray* array) {
+  delete static_cast<ArrowArrayHolder*>(array->private_data);
+  array->private_data = nullptr;
+  array->release = nullptr;
+}
+
+/**
+ * Query-owned state for buffers imported from an `ArrowArray`. The
+ * producer's release callback is invoked when the query drops the
+ * holder; the buffer sizes live here because the query keeps pointers
+ * to them.
+ */
+struct ArrowImportHolder {
+  ArrowImportHolder()
+      : array{}
+      , data_size(0)
+      , offsets_size(0) {
+  }
+
+  ~ArrowImportHolder() {
+    if (array.release != nullptr) {
+      array.release(&array);
+    }
+  }
+
+  /** The imported array, released on destruction. */
+  struct ArrowArray array;
+  /** Size in bytes of the data buffer. */
+  uint64_t data_size;
+  /** Size in bytes of the offsets buffer. */
+  uint64_t offsets_size;
+};
+
+/**
+ * Returns the Arrow format string for a query field, or throws if the
+ * field has no zero-copy Arrow representation. The mapping matches
+ * `tiledb::arrow::ArrowAdapter` in the C++ API.
+ */
+std::string arrow_format_for_field(
+    tiledb::sm::Datatype type,
+    bool var_size,
+    unsigned cell_val_num,
+    bool offsets_32bit) {
+  using tiledb::sm::Datatype;
+
+  if (var_size) {
+    switch (type) {
+      case Datatype::STRING_ASCII:
+      case Datatype::STRING_UTF8:
+        return offsets_32bit ? "u" : "U";
+      case Datatype::CHAR:
+      case Datatype::BLOB:
+        return offsets_32bit ? "z" : "Z";
+      default:
+        throw CAPIStatusException(
+            "Arrow interop is not supported for var-sized fields of "
+            "datatype '" +
+            datatype_str(type) + "'");
+    }
+  }
+
+  if (cell_val_num != 1) {
+    throw CAPIStatusException(
+        "Arrow interop is not supported for fixed-sized fields with more "
+        "than one value per cell");
+  }
+
+  switch (type) {
+    case Datatype::INT8:
+      return "c";
+    case Datatype::UINT8:
+      return "C";
+    case Datatype::INT16:
+      return "s";
+    case Datatype::UINT16:
+      return "S";
+    case Datatype::INT32:
+      return "i";
+    case Datatype::UINT32:
+      return "I";
+    case Datatype::INT64:
+      return "l";
+    case Datatype::UINT64:
+      return "L";
+    case Datatype::FLOAT32:
+      return "f";
+    case Datatype::FLOAT64:
+      return "g";
+    case Datatype::BLOB:
+      return "B";
+    case Datatype::TIME_SEC:
+      return "tts";
+    case Datatype::TIME_MS:
+      return "ttm";
+    case Datatype::TIME_US:
+      return "ttu";
+    case Datatype::TIME_NS:
+      return "ttn";
+    case Datatype::DATETIME_SEC:
+      return "tss:";
+    case Datatype::DATETIME_MS:
+      return "tsm:";
+    case Datatype::DATETIME_US:
+      return "tsu:";
+    case Datatype::DATETIME_NS:
+      return "tsn:";
+    default:
+      throw CAPIStatusException(
+          "Arrow interop is not supported for datatype '" +
+          datatype_str(type) + "'");
+  }
+}
+
+}  // namespace
+
+capi_return_t tiledb_query_export_arrow_buffer(
+    tiledb_ctx_t* ctx,
+    tiledb_query_t* query,
+    const char* name,
+    void* arrow_array,
+    void* arrow_schema) {
+  if (sanity_check(ctx, query) == TILEDB_ERR) {
+    return TILEDB_ERR;
+  }
+  if (name == nullptr || arrow_array == nullptr || arrow_schema == nullptr) {
+    throw CAPIStatusException(
+        "tiledb_query_export_arrow_buffer: null argument");
+  }
+
+  auto* q = query->query_;
+  const auto& array_schema = q->array_schema();
+  const bool var_size = array_schema.var_size(name);
+  if (array_schema.is_nullable(name)) {
+    throw CAPIStatusException(
+        "Arrow export is not supported for nullable fields; TileDB "
+        "validity bytemaps have no zero-copy Arrow representation");
+  }
+
+  // Arrow var-length layouts require `n + 1` offsets for `n` cells.
+  const auto& config = q->config();
+  const bool extra_offset = config.get<bool>(
+      "sm.var_offsets.extra_element", tiledb::sm::Config::must_find);
+  if (var_size && !extra_offset) {
+    throw CAPIStatusException(
+        "Arrow export of var-sized fields requires config option "
+        "'sm.var_offsets.extra_element' to be 'true'");
+  }
+  const uint32_t offsets_bitsize = config.get<uint32_t>(
+      "sm.var_offsets.bitsize", tiledb::sm::Config::must_find);
+
+  const std::string format = arrow_format_for_field(
+      array_schema.type(name),
+      var_size,
+      array_schema.cell_val_num(name),
+      offsets_bitsize == 32);
+
+  // The buffer sizes reflect the result size after submission.
+  const tiledb::sm::QueryBuffer query_buffer = q->buffer(name);
+  if (query_buffer.buffer_ == nullptr ||
+      (var_size && query_buffer.buffer_var_ == nullptr)) {
+    throw CAPIStatusException(
+        "Cannot export Arrow buffer; no buffer set for field '" +
+        std::string(name) + "'");
+  }
+
+  int64_t length;
+  auto array_holder = std::make_unique<ArrowArrayHolder>();
+  int64_t n_buffers;
+  if (var_size) {
+    const uint64_t offsets_elem_size = offsets_bitsize == 32 ? 4 : 8;
+    const uint64_t offsets_num =
+        *query_buffer.buffer_size_ / offsets_elem_size;
+    length = offsets_num == 0 ? 0 : static_cast<int64_t>(offsets_num) - 1;
+    array_holder->buffers[0] = nullptr;
+    array_holder->buffers[1] = query_buffer.buffer_;
+    array_holder->buffers[2] = query_buffer.buffer_var_;
+    n_buffers = 3;
+  } else {
+    length = static_cast<int64_t>(
+        *query_buffer.buffer_size_ /
+        datatype_size(array_schema.type(name)));
+    array_holder->buffers[0] = nullptr;
+    array_holder->buffers[1] = query_buffer.buffer_;
+    n_buffers = 2;
+  }
+
+  auto* schema_holder = new ArrowSchemaHolder{format, std::string(name)};
+
+  auto* out_schema = static_cast<struct ArrowSchema*>(arrow_schema);
+  out_schema->format = schema_holder->format.c_str();
+  out_schema->name = schema_holder->name.c_str();
+  out_schema->metadata = nullptr;
+  out_schema->flags = 0;
+  out_schema->n_children = 0;
+  out_schema->children = nullptr;
+  out_schema->dictionary = nullptr;
+  out_schema->release = release_exported_arrow_schema;
+  out_schema->private_data = schema_holder;
+
+  auto* out_array = static_cast<struct ArrowArray*>(arrow_array);
+  out_array->length = length;
+  out_array->null_count = 0;
+  out_array->offset = 0;
+  out_array->n_buffers = n_buffers;
+  out_array->n_children = 0;
+  out_array->buffers = array_holder->buffers;
+  out_array->children = nullptr;
+  out_array->dictionary = nullptr;
+  out_array->release = release_exported_arrow_array;
+  out_array->private_data = array_holder.release();
+
+  return TILEDB_OK;
+}
+
+capi_return_t tiledb_query_import_arrow_buffer(
+    tiledb_ctx_t* ctx,
+    tiledb_query_t* query,
+    const char* name,
+    void* arrow_array,
+    void* arrow_schema) {
+  if (sanity_check(ctx, query) == TILEDB_ERR) {
+    return TILEDB_ERR;
+  }
+  if (name == nullptr || arrow_array == nullptr || arrow_schema == nullptr) {
+    throw CAPIStatusException(
+        "tiledb_query_import_arrow_buffer: null argument");
+  }
+
+  auto* in_array = static_cast<struct ArrowArray*>(arrow_array);
+  auto* in_schema = static_cast<struct ArrowSchema*>(arrow_schema);
+  if (in_array->release == nullptr || in_schema->release == nullptr) {
+    throw CAPIStatusException(
+        "Cannot import Arrow buffer; array or schema was already released");
+  }
+  if (in_array->offset != 0) {
+    throw CAPIStatusException(
+        "Cannot import Arrow buffer; sliced arrays (non-zero offset) are "
+        "not supported");
+  }
+  if (in_array->null_count > 0) {
+    throw CAPIStatusException(
+        "Cannot import Arrow buffer; Arrow validity bitmaps have no "
+        "zero-copy TileDB representation");
+  }
+  if (in_array->n_children != 0 || in_array->dictionary != nullptr) {
+    throw CAPIStatusException(
+        "Cannot import Arrow buffer; nested and dictionary types are not "
+        "supported");
+  }
+
+  auto* q = query->query_;
+  const auto& array_schema = q->array_schema();
+  const bool var_size = array_schema.var_size(name);
+  if (array_schema.is_nullable(name)) {
+    throw CAPIStatusException(
+        "Arrow import is not supported for nullable fields");
+  }
+
+  // TileDB consumes 64-bit offsets only; the 32-bit formats would
+  // require an offsets conversion copy.
+  const std::string expected_format = arrow_format_for_field(
+      array_schema.type(name), var_size, array_schema.cell_val_num(name),
+      false);
+  if (in_schema->format == nullptr ||
+      expected_format != std::string(in_schema->format)) {
+    throw CAPIStatusException(
+        "Cannot import Arrow buffer; format '" +
+        std::string(in_schema->format == nullptr ? "" : in_schema->format) +
+        "' does not match field '" + std::string(name) + "' (expected '" +
+        expected_format + "')");
+  }
+
+  // Register the holder on the query up front so that the size pointers
+  // below stay valid even if setting a buffer fails.
+  auto holder = tiledb::common::make_shared<ArrowImportHolder>(HERE());
+  q->set_imported_buffer_handle(name, holder);
+
+  if (var_size) {
+    if (in_array->n_buffers != 3) {
+      throw CAPIStatusException(
+          "Cannot import Arrow buffer; expected 3 buffers for a var-sized "
+          "field");
+    }
+    // All supported var-sized datatypes have single-byte elements, so the
+    // Arrow byte offsets can be consumed directly.
+    const auto* offsets = static_cast<const uint64_t*>(in_array->buffers[1]);
+    holder->offsets_size =
+        (static_cast<uint64_t>(in_array->length) + 1) * sizeof(uint64_t);
+    holder->data_size = offsets[in_array->length];
+    throw_if_not_ok(q->set_offsets_buffer(
+        name, const_cast<uint64_t*>(offsets), &holder->offsets_size));
+    throw_if_not_ok(q->set_data_buffer(
+        name, const_cast<void*>(in_array->buffers[2]), &holder->data_size));
+  } else {
+    if (in_array->n_buffers != 2) {
+      throw CAPIStatusException(
+          "Cannot import Arrow buffer; expected 2 buffers for a "
+          "fixed-sized field");
+    }
+    holder->data_size = static_cast<uint64_t>(in_array->length) *
+                        datatype_size(array_schema.type(name));
+    throw_if_not_ok(q->set_data_buffer(
+        name, const_cast<void*>(in_array->buffers[1]), &holder->data_size));
+  }
+
+  // Take ownership: move the array into the holder (the producer's
+  // release callback fires when the query drops it) and release the
+  // schema, which is no longer needed.
+  holder->array = *in_array;
+  in_array->release = nullptr;
+  in_array->private_data = nullptr;
+  in_schema->release(in_schema);
+
+  return TILEDB_OK;
+}
+
 /* ****************************** */
 /*          Serialization         */
 /* ****************************** */
@@ -4095,6 +4845,51 @@ int32_t tiledb_deserialize_query_est_result_sizes(
   return TILEDB_OK;
 }
 
+int32_t tiledb_serialize_query_global_write_state(
+    tiledb_ctx_t* ctx,
+    const tiledb_query_t* query,
+    tiledb_serialization_type_t serialize_type,
+    tiledb_buffer_t** buffer) {
+  // Sanity check
+  if (sanity_check(ctx, query) == TILEDB_ERR)
+    return TILEDB_ERR;
+
+  auto buf = tiledb_buffer_handle_t::make_handle();
+
+  if (SAVE_ERROR_CATCH(
+          ctx,
+          tiledb::sm::serialization::global_write_state_serialize(
+              query->query_,
+              (tiledb::sm::SerializationType)serialize_type,
+              &(buf->buffer())))) {
+    tiledb_buffer_handle_t::break_handle(buf);
+    return TILEDB_ERR;
+  }
+
+  *buffer = buf;
+
+  return TILEDB_OK;
+}
+
+int32_t tiledb_deserialize_query_global_write_state(
+    tiledb_ctx_t* ctx,
+    tiledb_query_t* query,
+    tiledb_serialization_type_t serialize_type,
+    const tiledb_buffer_t* buffer) {
+  // Sanity check
+  if (sanity_check(ctx, query) == TILEDB_ERR)
+    return TILEDB_ERR;
+
+  api::ensure_buffer_is_valid(buffer);
+
+  throw_if_not_ok(tiledb::sm::serialization::global_write_state_deserialize(
+      query->query_,
+      (tiledb::sm::SerializationType)serialize_type,
+      buffer->buffer()));
+
+  return TILEDB_OK;
+}
+
 int32_t tiledb_serialize_config(
     tiledb_ctx_t* ctx,
     const tiledb_config_t* config,
@@ -4560,6 +5355,38 @@ int32_t tiledb_fragment_info_get_fragment_size(
   return TILEDB_OK;
 }
 
+int32_t tiledb_fragment_info_get_attribute_sizes(
+    tiledb_ctx_t* ctx,
+    tiledb_fragment_info_t* fragment_info,
+    uint32_t fid,
+    const char* name,
+    uint64_t* persisted_size,
+    uint64_t* in_memory_size) {
+  if (sanity_check(ctx, fragment_info) == TILEDB_ERR)
+    return TILEDB_ERR;
+
+  throw_if_not_ok(fragment_info->fragment_info_->get_attribute_sizes(
+      fid, name, persisted_size, in_memory_size));
+
+  return TILEDB_OK;
+}
+
+int32_t tiledb_fragment_info_get_tile_size_histogram(
+    tiledb_ctx_t* ctx,
+    tiledb_fragment_info_t* fragment_info,
+    uint32_t fid,
+    const char* name,
+    uint64_t* histogram,
+    uint32_t bucket_num) {
+  if (sanity_check(ctx, fragment_info) == TILEDB_ERR)
+    return TILEDB_ERR;
+
+  throw_if_not_ok(fragment_info->fragment_info_->get_tile_size_histogram(
+      fid, name, histogram, bucket_num));
+
+  return TILEDB_OK;
+}
+
 int32_t tiledb_fragment_info_get_dense(
     tiledb_ctx_t* ctx,
     tiledb_fragment_info_t* fragment_info,
@@ -5071,6 +5898,29 @@ int32_t tiledb_consolidation_plan_get_fragment_uri(
   return TILEDB_OK;
 }
 
+int32_t tiledb_consolidation_plan_get_node_shard(
+    tiledb_ctx_t* ctx,
+    tiledb_consolidation_plan_t* consolidation_plan,
+    uint64_t num_shards,
+    uint64_t node_index,
+    uint64_t* shard_index) {
+  if (sanity_check(ctx, consolidation_plan) == TILEDB_ERR) {
+    return TILEDB_ERR;
+  }
+
+  try {
+    *shard_index = consolidation_plan->consolidation_plan_->get_node_shard(
+        num_shards, node_index);
+  } catch (StatusException& e) {
+    auto st = Status_Error(e.what());
+    LOG_STATUS_NO_RETURN_VALUE(st);
+    save_error(ctx, st);
+    return TILEDB_ERR;
+  }
+
+  return TILEDB_OK;
+}
+
 int32_t tiledb_consolidation_plan_dump_json_str(
     tiledb_ctx_t* ctx,
     const tiledb_consolidation_plan_t* consolidation_plan,
@@ -5774,6 +6624,15 @@ CAPI_INTERFACE(query_submit, tiledb_ctx_t* ctx, tiledb_query_t* query) {
   return api_entry<tiledb::api::tiledb_query_submit>(ctx, query);
 }
 
+CAPI_INTERFACE(
+    query_submit_batch,
+    tiledb_ctx_t* ctx,
+    tiledb_query_t* const* queries,
+    uint64_t num_queries) {
+  return api_entry<tiledb::api::tiledb_query_submit_batch>(
+      ctx, queries, num_queries);
+}
+
 CAPI_INTERFACE(
     query_submit_async,
     tiledb_ctx_t* ctx,
@@ -6464,6 +7323,17 @@ CAPI_INTERFACE(array_reopen, tiledb_ctx_t* ctx, tiledb_array_t* array) {
   return api_entry<tiledb::api::tiledb_array_reopen>(ctx, array);
 }
 
+CAPI_INTERFACE(
+    array_prefetch,
+    tiledb_ctx_t* ctx,
+    tiledb_array_t* array,
+    tiledb_subarray_t* const* subarrays,
+    uint64_t num_subarrays,
+    uint64_t budget) {
+  return api_entry<tiledb::api::tiledb_array_prefetch>(
+      ctx, array, subarrays, num_subarrays, budget);
+}
+
 CAPI_INTERFACE(
     array_set_config,
     tiledb_ctx_t* ctx,
@@ -6860,6 +7730,14 @@ CAPI_INTERFACE(stats_raw_dump_str, char** out) {
   return api_entry_plain<tiledb::api::tiledb_stats_raw_dump_str>(out);
 }
 
+CAPI_INTERFACE(stats_trace_dump, FILE* out) {
+  return api_entry_plain<tiledb::api::tiledb_stats_trace_dump>(out);
+}
+
+CAPI_INTERFACE(stats_trace_dump_str, char** out) {
+  return api_entry_plain<tiledb::api::tiledb_stats_trace_dump_str>(out);
+}
+
 CAPI_INTERFACE(stats_free_str, char** out) {
   return api_entry_plain<tiledb::api::tiledb_stats_free_str>(out);
 }
@@ -6881,6 +7759,70 @@ CAPI_INTERFACE(
       dump_threshold_bytes);
 }
 
+/* ****************************** */
+/*          Context Pool          */
+/* ****************************** */
+
+CAPI_INTERFACE(
+    ctx_pool_init,
+    tiledb_config_t* config,
+    uint32_t num_contexts,
+    uint64_t refresh_interval_ms) {
+  return api_entry_plain<tiledb::api::tiledb_ctx_pool_init>(
+      config, num_contexts, refresh_interval_ms);
+}
+
+CAPI_INTERFACE(ctx_pool_keep_open, const char* array_uri) {
+  return api_entry_plain<tiledb::api::tiledb_ctx_pool_keep_open>(array_uri);
+}
+
+CAPI_INTERFACE(ctx_pool_acquire, tiledb_ctx_t** ctx) {
+  return api_entry_plain<tiledb::api::tiledb_ctx_pool_acquire>(ctx);
+}
+
+CAPI_INTERFACE(
+    ctx_pool_get_array,
+    tiledb_ctx_t* ctx,
+    const char* array_uri,
+    tiledb_array_t** array) {
+  return api_entry_plain<tiledb::api::tiledb_ctx_pool_get_array>(
+      ctx, array_uri, array);
+}
+
+CAPI_INTERFACE(ctx_pool_release, tiledb_ctx_t* ctx) {
+  return api_entry_plain<tiledb::api::tiledb_ctx_pool_release>(ctx);
+}
+
+CAPI_INTERFACE(ctx_pool_shutdown) {
+  return api_entry_plain<tiledb::api::tiledb_ctx_pool_shutdown>();
+}
+
+/* ****************************** */
+/*     Arrow C Data Interface     */
+/* ****************************** */
+
+CAPI_INTERFACE(
+    query_export_arrow_buffer,
+    tiledb_ctx_t* ctx,
+    tiledb_query_t* query,
+    const char* name,
+    void* arrow_array,
+    void* arrow_schema) {
+  return api_entry<tiledb::api::tiledb_query_export_arrow_buffer>(
+      ctx, query, name, arrow_array, arrow_schema);
+}
+
+CAPI_INTERFACE(
+    query_import_arrow_buffer,
+    tiledb_ctx_t* ctx,
+    tiledb_query_t* query,
+    const char* name,
+    void* arrow_array,
+    void* arrow_schema) {
+  return api_entry<tiledb::api::tiledb_query_import_arrow_buffer>(
+      ctx, query, name, arrow_array, arrow_schema);
+}
+
 /* ****************************** */
 /*          Serialization         */
 /* ****************************** */
@@ -7145,6 +8087,26 @@ CAPI_INTERFACE(
       ctx, query, serialize_type, client_side, buffer);
 }
 
+CAPI_INTERFACE(
+    serialize_query_global_write_state,
+    tiledb_ctx_t* ctx,
+    const tiledb_query_t* query,
+    tiledb_serialization_type_t serialize_type,
+    tiledb_buffer_t** buffer) {
+  return api_entry<tiledb::api::tiledb_serialize_query_global_write_state>(
+      ctx, query, serialize_type, buffer);
+}
+
+CAPI_INTERFACE(
+    deserialize_query_global_write_state,
+    tiledb_ctx_t* ctx,
+    tiledb_query_t* query,
+    tiledb_serialization_type_t serialize_type,
+    const tiledb_buffer_t* buffer) {
+  return api_entry<tiledb::api::tiledb_deserialize_query_global_write_state>(
+      ctx, query, serialize_type, buffer);
+}
+
 CAPI_INTERFACE(
     serialize_config,
     tiledb_ctx_t* ctx,
@@ -7349,6 +8311,30 @@ CAPI_INTERFACE(
       ctx, fragment_info, fid, size);
 }
 
+CAPI_INTERFACE(
+    fragment_info_get_attribute_sizes,
+    tiledb_ctx_t* ctx,
+    tiledb_fragment_info_t* fragment_info,
+    uint32_t fid,
+    const char* name,
+    uint64_t* persisted_size,
+    uint64_t* in_memory_size) {
+  return api_entry<tiledb::api::tiledb_fragment_info_get_attribute_sizes>(
+      ctx, fragment_info, fid, name, persisted_size, in_memory_size);
+}
+
+CAPI_INTERFACE(
+    fragment_info_get_tile_size_histogram,
+    tiledb_ctx_t* ctx,
+    tiledb_fragment_info_t* fragment_info,
+    uint32_t fid,
+    const char* name,
+    uint64_t* histogram,
+    uint32_t bucket_num) {
+  return api_entry<tiledb::api::tiledb_fragment_info_get_tile_size_histogram>(
+      ctx, fragment_info, fid, name, histogram, bucket_num);
+}
+
 CAPI_INTERFACE(
     fragment_info_get_dense,
     tiledb_ctx_t* ctx,
@@ -7702,6 +8688,17 @@ CAPI_INTERFACE(
       ctx, consolidation_plan, node_index, fragment_index, uri);
 }
 
+CAPI_INTERFACE(
+    consolidation_plan_get_node_shard,
+    tiledb_ctx_t* ctx,
+    tiledb_consolidation_plan_t* consolidation_plan,
+    uint64_t num_shards,
+    uint64_t node_index,
+    uint64_t* shard_index) {
+  return api_entry<tiledb::api::tiledb_consolidation_plan_get_node_shard>(
+      ctx, consolidation_plan, num_shards, node_index, shard_index);
+}
+
 CAPI_INTERFACE(
     consolidation_plan_dump_json_str,
     tiledb_ctx_t* ctx,
@@ -4234,6 +4234,65 @@ TILEDB_EXPORT int32_t tiledb_fragment_info_get_fragment_size(
     uint32_t fid,
     uint64_t* size) TILEDB_NOEXCEPT;
 
+/**
+ * Gets the persisted (on-disk, filtered) and in-memory (unfiltered) sizes
+ * in bytes of an attribute or dimension in a fragment. The sizes cover the
+ * data, var-sized data and validity tiles of the attribute or dimension.
+ *
+ * **Example:**
+ *
+ * @code{.c}
+ * uint64_t persisted_size, in_memory_size;
+ * tiledb_fragment_info_get_attribute_sizes(
+ *     ctx, fragment_info, 1, "a", &persisted_size, &in_memory_size);
+ * @endcode
+ *
+ * @param ctx The TileDB context.
+ * @param fragment_info The fragment info object.
+ * @param fid The index of the fragment of interest.
+ * @param name The attribute or dimension name.
+ * @param persisted_size The persisted size in bytes to be retrieved.
+ * @param in_memory_size The in-memory size in bytes to be retrieved.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT int32_t tiledb_fragment_info_get_attribute_sizes(
+    tiledb_ctx_t* ctx,
+    tiledb_fragment_info_t* fragment_info,
+    uint32_t fid,
+    const char* name,
+    uint64_t* persisted_size,
+    uint64_t* in_memory_size) TILEDB_NOEXCEPT;
+
+/**
+ * Gets a histogram of the persisted (on-disk, filtered) tile sizes of an
+ * attribute or dimension in a fragment. Bucket `i` counts the tiles with
+ * persisted size in `[2^i, 2^(i+1))` bytes; the last bucket also counts
+ * all larger tiles.
+ *
+ * **Example:**
+ *
+ * @code{.c}
+ * uint64_t histogram[32];
+ * tiledb_fragment_info_get_tile_size_histogram(
+ *     ctx, fragment_info, 1, "a", histogram, 32);
+ * @endcode
+ *
+ * @param ctx The TileDB context.
+ * @param fragment_info The fragment info object.
+ * @param fid The index of the fragment of interest.
+ * @param name The attribute or dimension name.
+ * @param histogram The histogram buckets to be populated.
+ * @param bucket_num The number of histogram buckets.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT int32_t tiledb_fragment_info_get_tile_size_histogram(
+    tiledb_ctx_t* ctx,
+    tiledb_fragment_info_t* fragment_info,
+    uint32_t fid,
+    const char* name,
+    uint64_t* histogram,
+    uint32_t bucket_num) TILEDB_NOEXCEPT;
+
 /**
  * Checks if a fragment is dense.
  *
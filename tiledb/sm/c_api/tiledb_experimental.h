@@ -478,6 +478,42 @@ TILEDB_EXPORT int32_t tiledb_array_upgrade_version(
     const char* array_uri,
     tiledb_config_t* config) TILEDB_NOEXCEPT;
 
+/**
+ * Prefetches the tiles overlapping the given subarrays into the VFS read
+ * cache, staging up to `budget` bytes of attribute and dimension data
+ * before any query is submitted. Subsequent reads over the same regions
+ * are served from the cache instead of issuing cold storage requests.
+ *
+ * Prefetching is best-effort: when the planned regions exceed `budget`,
+ * the regions for the last subarrays are dropped first, and I/O failures
+ * while staging do not fail the call.
+ *
+ * **Example:**
+ *
+ * @code{.c}
+ * tiledb_subarray_t* subarray;
+ * tiledb_subarray_alloc(ctx, array, &subarray);
+ * tiledb_subarray_set_subarray(ctx, subarray, range);
+ * tiledb_array_prefetch(ctx, array, &subarray, 1, 64 * 1024 * 1024);
+ * @endcode
+ *
+ * @param ctx The TileDB context.
+ * @param array The array to prefetch from, opened for reads.
+ * @param subarrays The subarrays whose overlapping tiles to stage.
+ * @param num_subarrays The number of subarrays.
+ * @param budget The maximum number of bytes to stage.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ *
+ * @note The array must be open for reads. Prefetching is not supported
+ *     on remote arrays.
+ */
+TILEDB_EXPORT capi_return_t tiledb_array_prefetch(
+    tiledb_ctx_t* ctx,
+    tiledb_array_t* array,
+    tiledb_subarray_t* const* subarrays,
+    uint64_t num_subarrays,
+    uint64_t budget) TILEDB_NOEXCEPT;
+
 /* ********************************* */
 /*               QUERY               */
 /* ********************************* */
@@ -566,6 +602,34 @@ TILEDB_EXPORT int32_t tiledb_query_get_relevant_fragment_num(
     const tiledb_query_t* query,
     uint64_t* relevant_fragment_num) TILEDB_NOEXCEPT;
 
+/**
+ * Submits a batch of TileDB queries in a single call.
+ *
+ * The queries are submitted concurrently on the context's compute thread
+ * pool, amortizing the per-call overhead of many small (e.g. point lookup)
+ * queries. Each query behaves exactly as if it had been submitted with
+ * `tiledb_query_submit`; statuses are checked per query afterwards.
+ *
+ * **Example:**
+ *
+ * @code{.c}
+ * tiledb_query_submit_batch(ctx, queries, num_queries);
+ * @endcode
+ *
+ * @param ctx The TileDB context.
+ * @param queries The queries to submit.
+ * @param num_queries The number of queries in `queries`.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ *
+ * @note All queries must target arrays opened on the given context. If any
+ *     query fails, the first error encountered is returned, but the
+ *     remaining queries are still submitted.
+ */
+TILEDB_EXPORT capi_return_t tiledb_query_submit_batch(
+    tiledb_ctx_t* ctx,
+    tiledb_query_t* const* queries,
+    uint64_t num_queries) TILEDB_NOEXCEPT;
+
 /* ********************************* */
 /*          QUERY CONDITION          */
 /* ********************************* */
@@ -1061,6 +1125,38 @@ TILEDB_EXPORT int32_t tiledb_consolidation_plan_get_fragment_uri(
     uint64_t fragment_index,
     const char** uri) TILEDB_NOEXCEPT;
 
+/**
+ * Get the shard a specific node of a consolidation plan belongs to, when
+ * the plan is partitioned into `num_shards` shards. Nodes of a plan never
+ * share fragments, so separate processes can concurrently consolidate the
+ * nodes of different shards against the same array, each one calling
+ * tiledb_array_consolidate_fragments with the fragment uris of one node.
+ * The assignment balances the total fragment size of the shards and is
+ * deterministic, so every process computes the same partitioning from the
+ * same plan.
+ *
+ * **Example:**
+ *
+ * @code{.c}
+ * uint64_t shard_index;
+ * tiledb_consolidation_plan_get_node_shard(ctx, consolidation_plan, 4, 0,
+ * &shard_index);
+ * @endcode
+ *
+ * @param ctx TileDB context.
+ * @param consolidation_plan The consolidation plan.
+ * @param num_shards The number of shards to partition the plan into.
+ * @param node_index The node index.
+ * @param shard_index The shard index to be retrieved.
+ * @return `TILEDB_OK` for success and `TILEDB_OOM` or `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT int32_t tiledb_consolidation_plan_get_node_shard(
+    tiledb_ctx_t* ctx,
+    tiledb_consolidation_plan_t* consolidation_plan,
+    uint64_t num_shards,
+    uint64_t node_index,
+    uint64_t* shard_index) TILEDB_NOEXCEPT;
+
 /**
  * Dumps the consolidation plan in JSON format to a null terminated string. The
  * string needs to be freed with tiledb_consolidation_plan_free_json_str.
@@ -1100,6 +1196,213 @@ TILEDB_EXPORT int32_t tiledb_consolidation_plan_dump_json_str(
 TILEDB_EXPORT int32_t tiledb_consolidation_plan_free_json_str(char** str)
     TILEDB_NOEXCEPT;
 
+/* ********************************* */
+/*               STATS               */
+/* ********************************* */
+
+/**
+ * Dumps the trace events recorded so far to the given file in the Chrome
+ * trace event format, loadable by chrome://tracing and Perfetto. Trace
+ * events are recorded for queries submitted with a config that sets
+ * `sm.stats.trace_enabled` to `true`.
+ *
+ * **Example:**
+ *
+ * @code{.c}
+ * FILE* file = fopen("trace.json", "w");
+ * tiledb_stats_trace_dump(file);
+ * @endcode
+ *
+ * @param out The output file, or `stdout` if `NULL` is passed.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT int32_t tiledb_stats_trace_dump(FILE* out) TILEDB_NOEXCEPT;
+
+/**
+ * Dumps the trace events recorded so far to a string in the Chrome trace
+ * event format.
+ *
+ * **Example:**
+ *
+ * @code{.c}
+ * char* str;
+ * tiledb_stats_trace_dump_str(&str);
+ * // ...
+ * tiledb_stats_free_str(&str);
+ * @endcode
+ *
+ * @param out Will be set to point to an allocated string containing the
+ *     trace. It should be freed with `tiledb_stats_free_str`.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT int32_t tiledb_stats_trace_dump_str(char** out) TILEDB_NOEXCEPT;
+
+/* ********************************* */
+/*            CONTEXT POOL           */
+/* ********************************* */
+
+/**
+ * Initializes the process-wide context pool.
+ *
+ * The pool pre-creates `num_contexts` contexts up front, so that
+ * `tiledb_ctx_pool_acquire` hands out a warm context (thread pools
+ * started, config parsed) at zero cost on the request path. When
+ * `refresh_interval_ms` is non-zero, a background thread re-validates
+ * the directory snapshots of the arrays registered with
+ * `tiledb_ctx_pool_keep_open` at that interval, so acquired contexts
+ * serve current metadata without listing on the request path.
+ *
+ * **Example:**
+ *
+ * @code{.c}
+ * tiledb_ctx_pool_init(config, 4, 5000);
+ * tiledb_ctx_pool_keep_open("s3://bucket/my_array");
+ * @endcode
+ *
+ * @param config The configuration the pooled contexts are created with,
+ *     or `NULL` for the default configuration.
+ * @param num_contexts The number of contexts to pre-create. The pool
+ *     grows beyond this size when all contexts are busy.
+ * @param refresh_interval_ms The interval between two background
+ *     metadata refreshes, in milliseconds. Zero disables the refresh.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT capi_return_t tiledb_ctx_pool_init(
+    tiledb_config_t* config,
+    uint32_t num_contexts,
+    uint64_t refresh_interval_ms) TILEDB_NOEXCEPT;
+
+/**
+ * Opens the given array for reads on every pooled context and registers
+ * it for background metadata refresh. Only unencrypted arrays are
+ * supported.
+ *
+ * @param array_uri The URI of the array to keep open.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT capi_return_t tiledb_ctx_pool_keep_open(const char* array_uri)
+    TILEDB_NOEXCEPT;
+
+/**
+ * Hands out a free pooled context. The context must be returned with
+ * `tiledb_ctx_pool_release` and must not be freed with
+ * `tiledb_ctx_free`. If all pooled contexts are busy, the pool grows by
+ * one (cold) context.
+ *
+ * @param ctx Will be set to the acquired context.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT capi_return_t tiledb_ctx_pool_acquire(tiledb_ctx_t** ctx)
+    TILEDB_NOEXCEPT;
+
+/**
+ * Retrieves the kept-open array of an acquired pooled context. The
+ * array is already open for reads with refreshed metadata; it should be
+ * freed with `tiledb_array_free` (which does not close it) before the
+ * context is released, and must not be closed by the caller.
+ *
+ * @param ctx A context acquired with `tiledb_ctx_pool_acquire`.
+ * @param array_uri The URI of an array registered with
+ *     `tiledb_ctx_pool_keep_open`.
+ * @param array Will be set to the open array.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT capi_return_t tiledb_ctx_pool_get_array(
+    tiledb_ctx_t* ctx,
+    const char* array_uri,
+    tiledb_array_t** array) TILEDB_NOEXCEPT;
+
+/**
+ * Returns an acquired context to the pool.
+ *
+ * @param ctx The context to return.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT capi_return_t tiledb_ctx_pool_release(tiledb_ctx_t* ctx)
+    TILEDB_NOEXCEPT;
+
+/**
+ * Stops the background refresh thread, closes the kept-open arrays and
+ * destroys all pooled contexts. No pooled context may be in use when
+ * this is called. The pool may be initialized again afterwards.
+ *
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT capi_return_t tiledb_ctx_pool_shutdown(void) TILEDB_NOEXCEPT;
+
+/* ********************************* */
+/*      ARROW C DATA INTERFACE       */
+/* ********************************* */
+
+/**
+ * Exports a query field's buffers as an Arrow array without copying.
+ *
+ * The `arrow_array` and `arrow_schema` arguments must point to
+ * caller-allocated `ArrowArray` and `ArrowSchema` structs as defined by
+ * the Arrow C Data Interface; they are taken as `void*` so that this
+ * header does not depend on the Arrow definitions. The exported buffers
+ * remain owned by their current owner (TileDB or the user); the structs'
+ * release callbacks free only the export bookkeeping, so the structs
+ * must be released before the buffers are freed or re-set.
+ *
+ * Var-sized fields require the config option
+ * `sm.var_offsets.extra_element` to be `"true"` so that the offsets
+ * follow the Arrow layout. Nullable fields are not supported, as TileDB
+ * validity bytemaps have no zero-copy Arrow representation.
+ *
+ * **Example:**
+ *
+ * @code{.c}
+ * struct ArrowArray array;
+ * struct ArrowSchema schema;
+ * tiledb_query_export_arrow_buffer(ctx, query, "a1", &array, &schema);
+ * @endcode
+ *
+ * @param ctx The TileDB context.
+ * @param query The query.
+ * @param name The name of the field to export.
+ * @param arrow_array Pointer to a caller-allocated `ArrowArray`.
+ * @param arrow_schema Pointer to a caller-allocated `ArrowSchema`.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT capi_return_t tiledb_query_export_arrow_buffer(
+    tiledb_ctx_t* ctx,
+    tiledb_query_t* query,
+    const char* name,
+    void* arrow_array,
+    void* arrow_schema) TILEDB_NOEXCEPT;
+
+/**
+ * Sets a query field's buffers from an Arrow array without copying,
+ * taking ownership per the Arrow C Data Interface: on success the array
+ * is moved into the query, which invokes its release callback once the
+ * buffers are no longer referenced, and the schema is released
+ * immediately. On error the caller retains ownership of both.
+ *
+ * The array's format must match the field exactly, with 64-bit offsets
+ * for var-sized fields (`U`/`Z`). Sliced arrays, validity bitmaps,
+ * nested and dictionary types are not supported.
+ *
+ * **Example:**
+ *
+ * @code{.c}
+ * tiledb_query_import_arrow_buffer(ctx, query, "a1", &array, &schema);
+ * @endcode
+ *
+ * @param ctx The TileDB context.
+ * @param query The query.
+ * @param name The name of the field to set.
+ * @param arrow_array Pointer to the `ArrowArray` to import.
+ * @param arrow_schema Pointer to the `ArrowSchema` describing it.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT capi_return_t tiledb_query_import_arrow_buffer(
+    tiledb_ctx_t* ctx,
+    tiledb_query_t* query,
+    const char* name,
+    void* arrow_array,
+    void* arrow_schema) TILEDB_NOEXCEPT;
+
 #ifdef __cplusplus
 }
 #endif
@@ -273,6 +273,7 @@ int32_t tiledb_filestore_uri_import(
   tiledb::sm::Query query(context.storage_manager(), array);
   throw_if_not_ok(query.set_layout(tiledb::sm::Layout::GLOBAL_ORDER));
   std::vector<std::byte> buffer(buffer_size);
+  std::vector<std::byte> prefetch_buffer(buffer_size);
 
   tiledb::sm::Subarray subarray(
       array.get(),
@@ -319,45 +320,74 @@ int32_t tiledb_filestore_uri_import(
     throw_if_not_ok(query.submit());
   };
 
-  auto read_wrapper =
-      [&file_size, &vfs, &file_uri, &buffer](uint64_t start) -> uint64_t {
+  auto read_wrapper = [&file_size, &vfs, &file_uri](
+                          uint64_t start,
+                          std::vector<std::byte>& read_buffer) -> uint64_t {
     if (start >= file_size)
       return 0;
 
-    uint64_t readlen = buffer.size();
-    if (start + buffer.size() > file_size) {
+    uint64_t readlen = read_buffer.size();
+    if (start + read_buffer.size() > file_size) {
       readlen = file_size - start;
     }
-    throw_if_not_ok(
-        vfs.read(tiledb::sm::URI(file_uri), start, buffer.data(), readlen));
+    throw_if_not_ok(vfs.read(
+        tiledb::sm::URI(file_uri), start, read_buffer.data(), readlen));
     return readlen;
   };
 
+  // Pipeline the source reads with the query submissions through a
+  // double buffer: while the query for the current batch executes, the
+  // next batch is read from the source file on the IO thread pool. The
+  // tile filtering itself is parallelized within the query submission.
   uint64_t start_range = 0;
   uint64_t end_range = buffer_size - 1;
-  uint64_t readlen = 0;
-  while ((readlen = read_wrapper(start_range)) > 0) {
-    uint64_t end_cloud_fix = end_range;
-    uint64_t query_buffer_len = buffer_size;
-    if (readlen < buffer_size) {
-      end_cloud_fix = start_range + readlen;
-      query_buffer_len = last_space_tile_boundary -
-                         file_size / (buffer_size) * (buffer_size) + 1;
-      std::memset(buffer.data() + readlen, 0, buffer_size - readlen);
-    }
+  uint64_t readlen = read_wrapper(start_range, buffer);
+  while (readlen > 0) {
+    uint64_t prefetch_readlen = 0;
+    ThreadPool::Task prefetch_task = context.io_tp()->execute(
+        [&read_wrapper,
+         &prefetch_buffer,
+         &prefetch_readlen,
+         start = start_range + readlen]() -> Status {
+          try {
+            prefetch_readlen = read_wrapper(start, prefetch_buffer);
+          } catch (const std::exception& e) {
+            return Status_Error(e.what());
+          }
+          return Status::Ok();
+        });
 
-    if (is_tiledb_uri) {
-      tiledb_cloud_fix(start_range, end_cloud_fix);
-    } else {
-      throw_if_not_ok(query.set_data_buffer(
-          tiledb::sm::constants::filestore_attribute_name,
-          buffer.data(),
-          &query_buffer_len));
-      throw_if_not_ok(query.submit());
+    try {
+      uint64_t end_cloud_fix = end_range;
+      uint64_t query_buffer_len = buffer_size;
+      if (readlen < buffer_size) {
+        end_cloud_fix = start_range + readlen;
+        query_buffer_len = last_space_tile_boundary -
+                           file_size / (buffer_size) * (buffer_size) + 1;
+        std::memset(buffer.data() + readlen, 0, buffer_size - readlen);
+      }
+
+      if (is_tiledb_uri) {
+        tiledb_cloud_fix(start_range, end_cloud_fix);
+      } else {
+        throw_if_not_ok(query.set_data_buffer(
+            tiledb::sm::constants::filestore_attribute_name,
+            buffer.data(),
+            &query_buffer_len));
+        throw_if_not_ok(query.submit());
+      }
+    } catch (...) {
+      // The prefetch task must not outlive 'prefetch_buffer'.
+      const Status st = context.io_tp()->wait(prefetch_task);
+      (void)st;
+      throw;
     }
 
+    throw_if_not_ok(context.io_tp()->wait(prefetch_task));
     start_range += readlen;
     end_range += readlen;
+    std::swap(buffer, prefetch_buffer);
+    readlen = prefetch_readlen;
   }
 
   if (start_range < file_size) {
@@ -422,10 +452,19 @@ int32_t tiledb_filestore_uri_export(
   auto buffer_size = get_buffer_size_from_config(
       context.storage_manager()->config(), tile_extent);
 
-  std::vector<std::byte> data(buffer_size);
-  uint64_t start_range = 0;
-  uint64_t end_range = std::min(file_size, buffer_size) - 1;
-  do {
+  // Cloud compatibility hack. Currently stored tiledb file arrays have a
+  // TILEDB_UINT8 attribute. We should pass the right datatype here to
+  // support reads from existing tiledb file arrays.
+  auto&& [st, schema] = array->get_array_schema();
+  throw_if_not_ok(st);
+  auto attr_type =
+      schema.value()
+          ->attribute(tiledb::sm::constants::filestore_attribute_name)
+          ->type();
+
+  auto read_array_batch = [&](uint64_t start_range,
+                              uint64_t end_range,
+                              std::vector<std::byte>& data) -> uint64_t {
     uint64_t write_size = end_range - start_range + 1;
     tiledb::sm::Subarray subarray(
         array.get(),
@@ -442,15 +481,6 @@ int32_t tiledb_filestore_uri_export(
     throw_if_not_ok(query.set_layout(tiledb::sm::Layout::ROW_MAJOR));
     query.set_subarray(subarray);
 
-    // Cloud compatibility hack. Currently stored tiledb file arrays have a
-    // TILEDB_UINT8 attribute. We should pass the right datatype here to
-    // support reads from existing tiledb file arrays.
-    auto&& [st, schema] = array->get_array_schema();
-    throw_if_not_ok(st);
-    auto attr_type =
-        schema.value()
-            ->attribute(tiledb::sm::constants::filestore_attribute_name)
-            ->type();
     if (attr_type == tiledb::sm::Datatype::UINT8) {
       throw_if_not_ok(query.set_data_buffer(
           tiledb::sm::constants::filestore_attribute_name,
@@ -463,15 +493,67 @@ int32_t tiledb_filestore_uri_export(
           &write_size));
     }
     throw_if_not_ok(query.submit());
+    return write_size;
+  };
 
-    throw_if_not_ok(vfs.write(
-        tiledb::sm::URI(file_uri),
-        reinterpret_cast<char*>(data.data()),
-        write_size));
+  // Pipeline the array reads with the file writes through a double
+  // buffer: while the current batch is written to the destination
+  // file, the query for the next batch executes on the compute
+  // thread pool.
+  std::vector<std::byte> data(buffer_size);
+  std::vector<std::byte> prefetch_data(buffer_size);
+  uint64_t start_range = 0;
+  uint64_t end_range = std::min(file_size, buffer_size) - 1;
+  uint64_t write_size = read_array_batch(start_range, end_range, data);
+  while (true) {
+    const uint64_t next_start_range = end_range + 1;
+    const uint64_t next_end_range =
+        std::min(file_size - 1, end_range + buffer_size);
+    const bool has_next = next_start_range <= next_end_range;
+
+    uint64_t prefetch_write_size = 0;
+    ThreadPool::Task prefetch_task;
+    if (has_next) {
+      prefetch_task = context.compute_tp()->execute(
+          [&read_array_batch,
+           &prefetch_data,
+           &prefetch_write_size,
+           next_start_range,
+           next_end_range]() -> Status {
+            try {
+              prefetch_write_size = read_array_batch(
+                  next_start_range, next_end_range, prefetch_data);
+            } catch (const std::exception& e) {
+              return Status_Error(e.what());
+            }
+            return Status::Ok();
+          });
+    }
+
+    try {
+      throw_if_not_ok(vfs.write(
+          tiledb::sm::URI(file_uri),
+          reinterpret_cast<char*>(data.data()),
+          write_size));
+    } catch (...) {
+      // The prefetch task must not outlive 'prefetch_data'.
+      if (has_next) {
+        const Status wait_st = context.compute_tp()->wait(prefetch_task);
+        (void)wait_st;
+      }
+      throw;
+    }
 
-    start_range = end_range + 1;
-    end_range = std::min(file_size - 1, end_range + buffer_size);
-  } while (start_range <= end_range);
+    if (!has_next) {
+      break;
+    }
+
+    throw_if_not_ok(context.compute_tp()->wait(prefetch_task));
+    start_range = next_start_range;
+    end_range = next_end_range;
+    std::swap(data, prefetch_data);
+    write_size = prefetch_write_size;
+  }
 
   throw_if_not_ok(vfs.close_file(tiledb::sm::URI(file_uri)));
 
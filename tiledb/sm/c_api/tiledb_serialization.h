@@ -541,6 +541,46 @@ TILEDB_EXPORT int32_t tiledb_deserialize_query_est_result_sizes(
     int32_t client_side,
     const tiledb_buffer_t* buffer) TILEDB_NOEXCEPT;
 
+/**
+ * Serializes the global write state of an in-progress global order write
+ * query, including fragment metadata progress and any cloud multipart upload
+ * state. The buffer can be persisted as a checkpoint and restored with
+ * `tiledb_deserialize_query_global_write_state` to resume appending to the
+ * same fragment from a new process.
+ *
+ * @note The caller must free the returned `tiledb_buffer_t`.
+ *
+ * @param ctx The TileDB context.
+ * @param query The global order write query to checkpoint.
+ * @param serialization_type Type of serialization to use
+ * @param buffer Will be set to a newly allocated buffer containing the
+ *      serialized global write state.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT int32_t tiledb_serialize_query_global_write_state(
+    tiledb_ctx_t* ctx,
+    const tiledb_query_t* query,
+    tiledb_serialization_type_t serialize_type,
+    tiledb_buffer_t** buffer) TILEDB_NOEXCEPT;
+
+/**
+ * Deserializes a global write state checkpoint into an existing query,
+ * resuming the fragment the state was captured from. The query must be a
+ * global order write on the same array and must not have submitted any
+ * data yet.
+ *
+ * @param ctx The TileDB context.
+ * @param query The query object to deserialize into (must be pre-allocated).
+ * @param serialization_type Type of deserialization to use
+ * @param buffer Buffer to deserialize from
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT int32_t tiledb_deserialize_query_global_write_state(
+    tiledb_ctx_t* ctx,
+    tiledb_query_t* query,
+    tiledb_serialization_type_t serialize_type,
+    const tiledb_buffer_t* buffer) TILEDB_NOEXCEPT;
+
 /**
  * Serializes the given config.
  *
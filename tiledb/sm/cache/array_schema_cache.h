@@ -0,0 +1,140 @@
+/**
+ * @file   array_schema_cache.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class ArraySchemaCache.
+ */
+
+#ifndef TILEDB_ARRAY_SCHEMA_CACHE_H
+#define TILEDB_ARRAY_SCHEMA_CACHE_H
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "tiledb/common/common.h"
+#include "tiledb/common/exception/exception.h"
+#include "tiledb/sm/cache/lru_cache.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * A size-bounded LRU cache of unfiltered array schema file contents
+ * shared by all array opens on a context, keyed on schema URI.
+ *
+ * Schema files are immutable once written and carry timestamped, unique
+ * names (schema evolution writes a new file), so entries never go stale:
+ * files vacuumed away simply stop being requested and age out of the
+ * cache. Heavily-evolved arrays accumulate hundreds of schema files that
+ * are all read back on every open; with a warm cache an open
+ * deserializes the schemas from memory instead of issuing one generic
+ * tile read per file.
+ *
+ * The cache stores the serialized bytes rather than the deserialized
+ * `ArraySchema` objects because schemas are mutated after load (loaded
+ * enumerations are attached to them) and so cannot be shared between
+ * array opens.
+ */
+class ArraySchemaCache
+    : public LRUCache<std::string, shared_ptr<std::vector<char>>> {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param max_size Maximum cache size, in bytes. A value of zero
+   * disables the cache.
+   */
+  explicit ArraySchemaCache(const uint64_t max_size)
+      : LRUCache<std::string, shared_ptr<std::vector<char>>>(max_size)
+      , enabled_(max_size > 0) {
+  }
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** @return Whether the cache is enabled. */
+  inline bool enabled() const {
+    return enabled_;
+  }
+
+  /**
+   * Looks up a schema file entry, marking it most recently used on a
+   * hit.
+   *
+   * @param key Schema URI string.
+   * @param buffer Set to the cached file contents on a hit.
+   * @return Whether the entry was found in the cache.
+   */
+  bool lookup(const std::string& key, shared_ptr<std::vector<char>>* buffer) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!has_item(key)) {
+      return false;
+    }
+    *buffer = *get_item(key);
+    touch_item(key);
+    return true;
+  }
+
+  /**
+   * Inserts a schema file entry into the cache, evicting older entries
+   * as needed to respect the size bound.
+   *
+   * @param key Schema URI string.
+   * @param buffer Unfiltered file contents to insert.
+   */
+  void insert_entry(
+      const std::string& key, shared_ptr<std::vector<char>> buffer) {
+    const uint64_t size = buffer->size();
+    std::lock_guard<std::mutex> lock(mutex_);
+    throw_if_not_ok(insert(key, std::move(buffer), size));
+  }
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** Whether the cache is enabled. */
+  bool enabled_;
+
+  /** Mutex protecting the cache. */
+  std::mutex mutex_;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_ARRAY_SCHEMA_CACHE_H
@@ -0,0 +1,141 @@
+/**
+ * @file   deletion_vector_cache.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class DeletionVectorCache.
+ */
+
+#ifndef TILEDB_DELETION_VECTOR_CACHE_H
+#define TILEDB_DELETION_VECTOR_CACHE_H
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "tiledb/common/common.h"
+#include "tiledb/common/exception/exception.h"
+#include "tiledb/sm/cache/lru_cache.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * A size-bounded LRU cache of materialized per-tile delete condition
+ * verdicts shared by all queries on a context.
+ *
+ * Delete conditions are persisted as predicates that readers re-evaluate
+ * against every tile of every fragment written before the delete. For a
+ * given tile the verdicts are fully determined by the fragment, the tile
+ * index and the ordered set of applied conditions — all immutable, with
+ * unique timestamped names — so they are materialized once and keyed on
+ * that combination. Queries that see a new delete get a new key and fall
+ * back to evaluation; delete-heavy workloads stop paying for years-old
+ * deletes on every query.
+ *
+ * An entry stores one verdict byte per cell (zero for deleted cells),
+ * which readers combine into their tile bitmaps with a multiply.
+ */
+class DeletionVectorCache
+    : public LRUCache<std::string, shared_ptr<const std::vector<uint8_t>>> {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param max_size Maximum cache size, in bytes. A value of zero
+   * disables the cache.
+   */
+  explicit DeletionVectorCache(const uint64_t max_size)
+      : LRUCache<std::string, shared_ptr<const std::vector<uint8_t>>>(max_size)
+      , enabled_(max_size > 0) {
+  }
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** @return Whether the cache is enabled. */
+  inline bool enabled() const {
+    return enabled_;
+  }
+
+  /**
+   * Looks up a verdict vector, marking it most recently used on a hit.
+   *
+   * @param key Fragment URI, tile index and applied condition markers.
+   * @param verdicts Set to the cached verdict vector on a hit.
+   * @return Whether the entry was found in the cache.
+   */
+  bool lookup(
+      const std::string& key,
+      shared_ptr<const std::vector<uint8_t>>* verdicts) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!has_item(key)) {
+      return false;
+    }
+    *verdicts = *get_item(key);
+    touch_item(key);
+    return true;
+  }
+
+  /**
+   * Inserts a verdict vector into the cache, evicting older entries as
+   * needed to respect the size bound.
+   *
+   * @param key Fragment URI, tile index and applied condition markers.
+   * @param verdicts Verdict vector to insert.
+   */
+  void insert_entry(
+      const std::string& key,
+      shared_ptr<const std::vector<uint8_t>> verdicts) {
+    const uint64_t size = verdicts->size();
+    std::lock_guard<std::mutex> lock(mutex_);
+    throw_if_not_ok(insert(key, std::move(verdicts), size));
+  }
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** Whether the cache is enabled. */
+  bool enabled_;
+
+  /** Protects the underlying LRU state. */
+  std::mutex mutex_;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_DELETION_VECTOR_CACHE_H
@@ -0,0 +1,407 @@
+/**
+ * @file   disk_block_cache.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class DiskBlockCache.
+ */
+
+#ifndef TILEDB_DISK_BLOCK_CACHE_H
+#define TILEDB_DISK_BLOCK_CACHE_H
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "tiledb/common/common.h"
+#include "tiledb/common/logger.h"
+#include "tiledb/sm/buffer/buffer.h"
+#include "tiledb/sm/cache/lru_cache.h"
+#include "tiledb/sm/crypto/crypto.h"
+#include "tiledb/sm/filesystem/uri.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * A block file backing a cache entry. Destroying the value, which the
+ * `LRUCache` does on eviction, invalidation and clearing, removes the
+ * file from disk, so the on-disk footprint tracks the LRU state.
+ */
+struct DiskBlockFile {
+  /** Default constructor. */
+  DiskBlockFile() = default;
+
+  /** Value Constructor. */
+  explicit DiskBlockFile(std::filesystem::path path)
+      : path_(std::move(path)) {
+  }
+
+  /** Move Constructor. */
+  DiskBlockFile(DiskBlockFile&& other) noexcept
+      : path_(std::move(other.path_)) {
+    other.path_.clear();
+  }
+
+  /** Move-Assign Operator. */
+  DiskBlockFile& operator=(DiskBlockFile&& other) noexcept {
+    // An overwrite of the same key reuses the path of the replaced entry;
+    // the replaced value must not remove the rewritten file then.
+    if (path_ != other.path_) {
+      remove_file();
+    }
+    path_ = std::move(other.path_);
+    other.path_.clear();
+    return *this;
+  }
+
+  DISABLE_COPY_AND_COPY_ASSIGN(DiskBlockFile);
+
+  /** Destructor. Removes the block file, if any. */
+  ~DiskBlockFile() {
+    remove_file();
+  }
+
+  /** Removes the block file from disk, ignoring errors. */
+  void remove_file() {
+    if (!path_.empty()) {
+      std::error_code ec;
+      std::filesystem::remove(path_, ec);
+      path_.clear();
+    }
+  }
+
+  /** Path of the block file. */
+  std::filesystem::path path_;
+};
+
+/**
+ * A persistent, size-bounded LRU cache of read blocks spilled to a local
+ * directory, typically on SSD. Blocks are addressed by URI, offset and
+ * length and validated against a stored content hash on every hit, so a
+ * truncated or corrupted block file degrades to a miss instead of serving
+ * bad data.
+ *
+ * The block files survive process restarts: the cache directory is
+ * rescanned on construction and the surviving blocks are re-inserted into
+ * the LRU index, ordered by their last modification time.
+ */
+class DiskBlockCache : public LRUCache<std::string, DiskBlockFile> {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor. Creates the cache directory if it does not exist and
+   * rebuilds the LRU index from the block files already in it. Throws if
+   * the directory cannot be created or scanned.
+   *
+   * @param dir The directory the block files are stored in.
+   * @param max_size Maximum total byte size of the cached blocks.
+   */
+  DiskBlockCache(const std::string& dir, const uint64_t max_size)
+      : LRUCache<std::string, DiskBlockFile>(max_size)
+      , dir_(dir) {
+    std::filesystem::create_directories(dir_);
+
+    // Rebuild the LRU index from the surviving block files, oldest first
+    // so that the eviction order survives the restart as well. Files whose
+    // header cannot be read back are discarded.
+    std::vector<std::pair<std::filesystem::file_time_type, std::filesystem::path>>
+        blocks;
+    for (const auto& entry : std::filesystem::directory_iterator(dir_)) {
+      if (entry.is_regular_file() && entry.path().extension() == ".blk") {
+        blocks.emplace_back(entry.last_write_time(), entry.path());
+      }
+    }
+    std::sort(blocks.begin(), blocks.end());
+    for (auto& [mtime, path] : blocks) {
+      std::string key;
+      uint64_t nbytes;
+      if (read_header(path, &key, &nbytes)) {
+        throw_if_not_ok(LRUCache<std::string, DiskBlockFile>::insert(
+            key, DiskBlockFile(path), nbytes));
+      } else {
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+      }
+    }
+  }
+
+  /** Destructor. Leaves the block files behind for the next process. */
+  virtual ~DiskBlockCache() {
+    // Prevent the value destructors from removing the files.
+    std::lock_guard<std::mutex> lg(mutex_);
+    for (auto it = item_iter_begin(); it != item_iter_end(); ++it) {
+      const_cast<DiskBlockFile&>(it->object_).path_.clear();
+    }
+  }
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /**
+   * Attempts to read a block from the cache.
+   *
+   * @param uri The URI the block was read from.
+   * @param offset The offset of the block within the URI.
+   * @param buffer The buffer to read the block into.
+   * @param nbytes The byte size of the block.
+   * @param success Set to `true` if `buffer` was filled from the cache.
+   * @return Status
+   */
+  Status read(
+      const URI& uri,
+      const uint64_t offset,
+      void* const buffer,
+      const uint64_t nbytes,
+      bool* const success) {
+    assert(success);
+    *success = false;
+
+    const std::string key = block_key(uri, offset, nbytes);
+
+    std::lock_guard<std::mutex> lg(mutex_);
+    if (!has_item(key)) {
+      return Status::Ok();
+    }
+
+    // Read the block back and validate it against the stored content
+    // hash. Any mismatch, e.g. a truncated file after a crash, discards
+    // the block and degrades to a cache miss.
+    const auto path = get_item(key)->path_;
+    if (!read_block(path, key, buffer, nbytes)) {
+      bool dropped;
+      RETURN_NOT_OK(invalidate(key, &dropped));
+      return Status::Ok();
+    }
+
+    touch_item(key);
+    *success = true;
+    return Status::Ok();
+  }
+
+  /**
+   * Writes a block to the cache, evicting least recently used blocks,
+   * and with them their files, to stay within the size budget.
+   *
+   * @param uri The URI the block was read from.
+   * @param offset The offset of the block within the URI.
+   * @param buffer The block data.
+   * @param nbytes The byte size of the block.
+   * @return Status
+   */
+  Status insert(
+      const URI& uri,
+      const uint64_t offset,
+      const void* const buffer,
+      const uint64_t nbytes) {
+    const std::string key = block_key(uri, offset, nbytes);
+    const auto path = block_path(key);
+
+    std::lock_guard<std::mutex> lg(mutex_);
+    if (!write_block(path, key, buffer, nbytes)) {
+      std::error_code ec;
+      std::filesystem::remove(path, ec);
+      return LOG_STATUS(Status_VFSError(
+          "Disk cache error; Cannot write block file '" + path.string() +
+          "'"));
+    }
+
+    return LRUCache<std::string, DiskBlockFile>::insert(
+        key, DiskBlockFile(path), nbytes);
+  }
+
+ private:
+  /* ********************************* */
+  /*       PRIVATE CONSTANTS           */
+  /* ********************************* */
+
+  /** Version tag of the block file format. */
+  static constexpr uint32_t block_format_version_ = 1;
+
+  /** An upper bound on stored key sizes, to reject corrupt headers. */
+  static constexpr uint64_t max_key_size_ = 64 * 1024;
+
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** The directory the block files are stored in. */
+  std::filesystem::path dir_;
+
+  /** Protects the LRU state and the block files. */
+  std::mutex mutex_;
+
+  /* ********************************* */
+  /*          PRIVATE METHODS          */
+  /* ********************************* */
+
+  /** Returns the cache key of a block. */
+  static std::string block_key(
+      const URI& uri, const uint64_t offset, const uint64_t nbytes) {
+    return uri.to_string() + ":" + std::to_string(offset) + ":" +
+           std::to_string(nbytes);
+  }
+
+  /** Returns the path of the block file of `key`. */
+  std::filesystem::path block_path(const std::string& key) const {
+    Buffer digest;
+    throw_if_not_ok(digest.realloc(Crypto::SHA256_DIGEST_BYTES));
+    throw_if_not_ok(Crypto::sha256(key.data(), key.size(), &digest));
+
+    static constexpr char hex[] = "0123456789abcdef";
+    std::string name;
+    name.reserve(2 * Crypto::SHA256_DIGEST_BYTES + 4);
+    const auto bytes = static_cast<const uint8_t*>(digest.data());
+    for (unsigned i = 0; i < Crypto::SHA256_DIGEST_BYTES; i++) {
+      name += hex[bytes[i] >> 4];
+      name += hex[bytes[i] & 0xf];
+    }
+    name += ".blk";
+
+    return dir_ / name;
+  }
+
+  /**
+   * Writes a block file: the format version, the block key, the byte size
+   * of the data, the sha256 digest of the data and the data itself.
+   * Returns `false` on any I/O error.
+   */
+  static bool write_block(
+      const std::filesystem::path& path,
+      const std::string& key,
+      const void* const buffer,
+      const uint64_t nbytes) {
+    Buffer digest;
+    throw_if_not_ok(digest.realloc(Crypto::SHA256_DIGEST_BYTES));
+    throw_if_not_ok(Crypto::sha256(buffer, nbytes, &digest));
+
+    std::FILE* const fp = std::fopen(path.string().c_str(), "wb");
+    if (fp == nullptr) {
+      return false;
+    }
+
+    const uint32_t version = block_format_version_;
+    const uint64_t key_size = key.size();
+    const bool ok =
+        std::fwrite(&version, sizeof(version), 1, fp) == 1 &&
+        std::fwrite(&key_size, sizeof(key_size), 1, fp) == 1 &&
+        std::fwrite(key.data(), 1, key_size, fp) == key_size &&
+        std::fwrite(&nbytes, sizeof(nbytes), 1, fp) == 1 &&
+        std::fwrite(digest.data(), 1, Crypto::SHA256_DIGEST_BYTES, fp) ==
+            Crypto::SHA256_DIGEST_BYTES &&
+        std::fwrite(buffer, 1, nbytes, fp) == nbytes;
+    return std::fclose(fp) == 0 && ok;
+  }
+
+  /**
+   * Reads the header of a block file, returning the block key and data
+   * size. Returns `false` if the header cannot be read or has an
+   * unexpected format version.
+   */
+  static bool read_header(
+      const std::filesystem::path& path,
+      std::string* const key,
+      uint64_t* const nbytes) {
+    std::FILE* const fp = std::fopen(path.string().c_str(), "rb");
+    if (fp == nullptr) {
+      return false;
+    }
+
+    uint32_t version;
+    uint64_t key_size;
+    bool ok = std::fread(&version, sizeof(version), 1, fp) == 1 &&
+              version == block_format_version_ &&
+              std::fread(&key_size, sizeof(key_size), 1, fp) == 1 &&
+              key_size <= max_key_size_;
+    if (ok) {
+      key->resize(key_size);
+      ok = std::fread(key->data(), 1, key_size, fp) == key_size &&
+           std::fread(nbytes, sizeof(*nbytes), 1, fp) == 1;
+    }
+    std::fclose(fp);
+    return ok;
+  }
+
+  /**
+   * Reads the data of a block file into `buffer`, validating the stored
+   * key, size and content hash. Returns `false` on any mismatch.
+   */
+  static bool read_block(
+      const std::filesystem::path& path,
+      const std::string& key,
+      void* const buffer,
+      const uint64_t nbytes) {
+    std::FILE* const fp = std::fopen(path.string().c_str(), "rb");
+    if (fp == nullptr) {
+      return false;
+    }
+
+    uint32_t version;
+    uint64_t key_size, stored_nbytes;
+    std::string stored_key;
+    uint8_t stored_digest[Crypto::SHA256_DIGEST_BYTES];
+    bool ok = std::fread(&version, sizeof(version), 1, fp) == 1 &&
+              version == block_format_version_ &&
+              std::fread(&key_size, sizeof(key_size), 1, fp) == 1 &&
+              key_size == key.size();
+    if (ok) {
+      stored_key.resize(key_size);
+      ok = std::fread(stored_key.data(), 1, key_size, fp) == key_size &&
+           stored_key == key &&
+           std::fread(&stored_nbytes, sizeof(stored_nbytes), 1, fp) == 1 &&
+           stored_nbytes == nbytes &&
+           std::fread(stored_digest, 1, Crypto::SHA256_DIGEST_BYTES, fp) ==
+               Crypto::SHA256_DIGEST_BYTES &&
+           std::fread(buffer, 1, nbytes, fp) == nbytes;
+    }
+    std::fclose(fp);
+    if (!ok) {
+      return false;
+    }
+
+    // Validate the content hash.
+    Buffer digest;
+    throw_if_not_ok(digest.realloc(Crypto::SHA256_DIGEST_BYTES));
+    throw_if_not_ok(Crypto::sha256(buffer, nbytes, &digest));
+    return std::memcmp(
+               stored_digest, digest.data(), Crypto::SHA256_DIGEST_BYTES) == 0;
+  }
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_DISK_BLOCK_CACHE_H
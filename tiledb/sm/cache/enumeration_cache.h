@@ -0,0 +1,136 @@
+/**
+ * @file   enumeration_cache.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class EnumerationCache.
+ */
+
+#ifndef TILEDB_ENUMERATION_CACHE_H
+#define TILEDB_ENUMERATION_CACHE_H
+
+#include <mutex>
+#include <string>
+
+#include "tiledb/common/common.h"
+#include "tiledb/common/exception/exception.h"
+#include "tiledb/sm/array_schema/enumeration.h"
+#include "tiledb/sm/cache/lru_cache.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * A size-bounded LRU cache of loaded enumerations shared by all array
+ * opens on a context, keyed on enumeration file URI.
+ *
+ * Enumeration files are immutable once written and carry unique,
+ * generated path names (altering an enumeration writes a new file), so
+ * entries never go stale: files dropped or superseded by a schema
+ * evolution simply stop being requested and age out of the cache. Arrays
+ * over the same data — e.g. the members of a group sharing dictionary
+ * dimensions — thus load each enumeration from storage only once per
+ * context.
+ */
+class EnumerationCache
+    : public LRUCache<std::string, shared_ptr<const Enumeration>> {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param max_size Maximum cache size, in bytes. A value of zero
+   * disables the cache.
+   */
+  explicit EnumerationCache(const uint64_t max_size)
+      : LRUCache<std::string, shared_ptr<const Enumeration>>(max_size)
+      , enabled_(max_size > 0) {
+  }
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** @return Whether the cache is enabled. */
+  inline bool enabled() const {
+    return enabled_;
+  }
+
+  /**
+   * Looks up an enumeration, marking it most recently used on a hit.
+   *
+   * @param key Enumeration file URI string.
+   * @param enumeration Set to the cached enumeration on a hit.
+   * @return Whether the entry was found in the cache.
+   */
+  bool lookup(
+      const std::string& key, shared_ptr<const Enumeration>* enumeration) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!has_item(key)) {
+      return false;
+    }
+    *enumeration = *get_item(key);
+    touch_item(key);
+    return true;
+  }
+
+  /**
+   * Inserts an enumeration into the cache, evicting older entries as
+   * needed to respect the size bound.
+   *
+   * @param key Enumeration file URI string.
+   * @param enumeration Enumeration to insert.
+   */
+  void insert_entry(
+      const std::string& key, shared_ptr<const Enumeration> enumeration) {
+    const uint64_t size =
+        enumeration->data().size() + enumeration->offsets().size();
+    std::lock_guard<std::mutex> lock(mutex_);
+    throw_if_not_ok(insert(key, std::move(enumeration), size));
+  }
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** Whether the cache is enabled. */
+  bool enabled_;
+
+  /** Protects the underlying LRU state. */
+  std::mutex mutex_;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_ENUMERATION_CACHE_H
@@ -0,0 +1,157 @@
+/**
+ * @file   fragment_footer_cache.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class FragmentFooterCache.
+ */
+
+#ifndef TILEDB_FRAGMENT_FOOTER_CACHE_H
+#define TILEDB_FRAGMENT_FOOTER_CACHE_H
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "tiledb/common/common.h"
+#include "tiledb/common/exception/exception.h"
+#include "tiledb/sm/cache/lru_cache.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * The cached footer of a fragment metadata file: the serialized footer
+ * bytes, their location in the metadata file and the metadata file size,
+ * i.e. everything an array open reads from storage before deserializing
+ * the footer.
+ */
+struct FragmentFooterEntry {
+  /** Serialized footer bytes. */
+  std::vector<char> footer_;
+
+  /** Offset of the footer in the fragment metadata file. */
+  uint64_t footer_offset_;
+
+  /** Size of the footer, in bytes. */
+  uint64_t footer_size_;
+
+  /** Size of the fragment metadata file, in bytes. */
+  uint64_t meta_file_size_;
+
+  /** @return Total entry size, in bytes. */
+  uint64_t size() const {
+    return footer_.size() + 3 * sizeof(uint64_t);
+  }
+};
+
+/**
+ * A size-bounded LRU cache of fragment metadata footers shared by all
+ * array opens on a context, keyed on fragment URI.
+ *
+ * Fragment metadata files are immutable once written and fragment URIs
+ * are unique (rewrites of the same data, e.g. by consolidation, produce
+ * fragments with new URIs), so entries never go stale: fragments removed
+ * from an `ArrayDirectory` listing simply stop being requested and age
+ * out of the cache.
+ */
+class FragmentFooterCache
+    : public LRUCache<std::string, shared_ptr<FragmentFooterEntry>> {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param max_size Maximum cache size, in bytes. A value of zero
+   * disables the cache.
+   */
+  explicit FragmentFooterCache(const uint64_t max_size)
+      : LRUCache<std::string, shared_ptr<FragmentFooterEntry>>(max_size)
+      , enabled_(max_size > 0) {
+  }
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** @return Whether the cache is enabled. */
+  inline bool enabled() const {
+    return enabled_;
+  }
+
+  /**
+   * Looks up a footer entry, marking it most recently used on a hit.
+   *
+   * @param key Fragment URI string.
+   * @param entry Set to the cached entry on a hit.
+   * @return Whether the entry was found in the cache.
+   */
+  bool lookup(const std::string& key, shared_ptr<FragmentFooterEntry>* entry) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!has_item(key)) {
+      return false;
+    }
+    *entry = *get_item(key);
+    touch_item(key);
+    return true;
+  }
+
+  /**
+   * Inserts a footer entry into the cache, evicting older entries as
+   * needed to respect the size bound.
+   *
+   * @param key Fragment URI string.
+   * @param entry Entry to insert.
+   */
+  void insert_entry(
+      const std::string& key, shared_ptr<FragmentFooterEntry> entry) {
+    const uint64_t size = entry->size();
+    std::lock_guard<std::mutex> lock(mutex_);
+    throw_if_not_ok(insert(key, std::move(entry), size));
+  }
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** Whether the cache is enabled. */
+  bool enabled_;
+
+  /** Protects the underlying LRU state. */
+  std::mutex mutex_;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_FRAGMENT_FOOTER_CACHE_H
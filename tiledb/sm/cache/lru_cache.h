@@ -276,6 +276,16 @@ class LRUCache {
     return item_ll_.cend();
   }
 
+  /** Returns the current logical size of all cached items. */
+  uint64_t size() const {
+    return size_;
+  }
+
+  /** Returns the maximum logical cache size. */
+  uint64_t max_size() const {
+    return max_size_;
+  }
+
  private:
   /* ********************************* */
   /*         PRIVATE OPERATORS         */
@@ -0,0 +1,183 @@
+/**
+ * @file   query_result_cache.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class QueryResultCache.
+ */
+
+#ifndef TILEDB_QUERY_RESULT_CACHE_H
+#define TILEDB_QUERY_RESULT_CACHE_H
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "tiledb/common/common.h"
+#include "tiledb/common/exception/exception.h"
+#include "tiledb/sm/cache/lru_cache.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * The cached output of a single query field: the bytes the query wrote
+ * into the user's fixed buffer (the offsets buffer for var-sized fields),
+ * var data buffer and validity buffer.
+ */
+struct QueryResultCacheField {
+  /** The attribute or dimension name. */
+  std::string name_;
+
+  /** The fixed buffer bytes (offsets, for var-sized fields). */
+  std::vector<uint8_t> fixed_;
+
+  /** The var data buffer bytes. Empty for fixed-size fields. */
+  std::vector<uint8_t> var_;
+
+  /** The validity buffer bytes. Empty for non-nullable fields. */
+  std::vector<uint8_t> validity_;
+
+  /** Whether the field was queried with a var data buffer. */
+  bool has_var_ = false;
+
+  /** Whether the field was queried with a validity buffer. */
+  bool has_validity_ = false;
+
+  /** @return Total field size, in bytes. */
+  uint64_t size() const {
+    return name_.size() + fixed_.size() + var_.size() + validity_.size();
+  }
+};
+
+/**
+ * The cached result of a completed read query: the emitted buffers of
+ * every queried field.
+ */
+struct QueryResultEntry {
+  /** The emitted buffers, one per queried field. */
+  std::vector<QueryResultCacheField> fields_;
+
+  /** @return Total entry size, in bytes. */
+  uint64_t size() const {
+    uint64_t size = sizeof(QueryResultEntry);
+    for (const auto& field : fields_) {
+      size += field.size();
+    }
+    return size;
+  }
+};
+
+/**
+ * A size-bounded LRU cache of read query results shared by all queries on
+ * a context, keyed on a fingerprint of the query: the array URI, the open
+ * timestamps, the fragment listing of the `ArrayDirectory` snapshot the
+ * array was opened with, the subarray ranges, the query condition AST and
+ * the queried field list. Repeat submissions of a byte-identical query
+ * against an unchanged array, e.g. from a periodically refreshing
+ * dashboard, are served with plain memcpys into the user buffers.
+ *
+ * The fragment listing in the key makes entries self-invalidating: any
+ * write, consolidation or vacuum changes the listing of subsequent array
+ * opens, so stale results stop being requested and age out of the cache.
+ */
+class QueryResultCache
+    : public LRUCache<std::string, shared_ptr<QueryResultEntry>> {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param max_size Maximum cache size, in bytes. A value of zero
+   * disables the cache.
+   */
+  explicit QueryResultCache(const uint64_t max_size)
+      : LRUCache<std::string, shared_ptr<QueryResultEntry>>(max_size)
+      , enabled_(max_size > 0) {
+  }
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** @return Whether the cache is enabled. */
+  inline bool enabled() const {
+    return enabled_;
+  }
+
+  /**
+   * Looks up a result entry, marking it most recently used on a hit.
+   *
+   * @param key Query fingerprint.
+   * @param entry Set to the cached entry on a hit.
+   * @return Whether the entry was found in the cache.
+   */
+  bool lookup(const std::string& key, shared_ptr<QueryResultEntry>* entry) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!has_item(key)) {
+      return false;
+    }
+    *entry = *get_item(key);
+    touch_item(key);
+    return true;
+  }
+
+  /**
+   * Inserts a result entry into the cache, evicting older entries as
+   * needed to respect the size bound.
+   *
+   * @param key Query fingerprint.
+   * @param entry Entry to insert.
+   */
+  void insert_entry(
+      const std::string& key, shared_ptr<QueryResultEntry> entry) {
+    const uint64_t size = entry->size();
+    std::lock_guard<std::mutex> lock(mutex_);
+    throw_if_not_ok(insert(key, std::move(entry), size));
+  }
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** Whether the cache is enabled. */
+  bool enabled_;
+
+  /** Protects the underlying LRU structures. */
+  std::mutex mutex_;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_QUERY_RESULT_CACHE_H
@@ -0,0 +1,254 @@
+/**
+ * @file   unfiltered_tile_cache.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class UnfilteredTileCache.
+ */
+
+#ifndef TILEDB_UNFILTERED_TILE_CACHE_H
+#define TILEDB_UNFILTERED_TILE_CACHE_H
+
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "tiledb/common/common.h"
+#include "tiledb/common/exception/exception.h"
+#include "tiledb/sm/cache/lru_cache.h"
+#include "tiledb/sm/filesystem/uri.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * The unfiltered payload of a single result tile: the fixed, var and
+ * validity data exactly as they appear after unfiltering and
+ * post-processing. Parts that do not apply to the field (e.g. var data for
+ * a fixed-sized attribute) are left empty.
+ */
+struct UnfilteredTilePayload {
+  /** Fixed (or offsets) tile data. */
+  std::vector<char> fixed_;
+
+  /** Var tile data. */
+  std::vector<char> var_;
+
+  /** Validity tile data. */
+  std::vector<char> validity_;
+
+  /**
+   * Measured time, in nanoseconds, it took to read this payload from
+   * storage and unfilter it. Used by the eviction policy to keep payloads
+   * that are expensive to refetch (e.g. from a high latency remote
+   * backend or through a costly filter pipeline) resident longer than
+   * cheap ones.
+   */
+  uint64_t cost_ns_ = 0;
+
+  /** @return Total payload size, in bytes. */
+  uint64_t size() const {
+    return fixed_.size() + var_.size() + validity_.size();
+  }
+};
+
+/**
+ * A size-bounded cache of unfiltered tile payloads shared by all queries
+ * on a context, keyed on fragment URI, field name and tile index.
+ *
+ * Fragment files are immutable and fragment URIs are unique (rewrites of
+ * the same data, e.g. by consolidation, produce fragments with new URIs),
+ * so entries never go stale: data removed from an `ArrayDirectory`
+ * snapshot simply stops being requested and ages out of the cache.
+ *
+ * Replacement is cost-aware rather than pure LRU: each payload carries the
+ * measured time it took to read and unfilter, and eviction picks, among a
+ * window of the least recently used entries, the one with the lowest cost
+ * per byte. Tiles that are expensive to refetch (remote backends, heavy
+ * filter pipelines) thus stay resident across incomplete-query iterations
+ * while cached-local tiles make room first. Entries passed over by an
+ * eviction have their cost halved so that an expensive payload that stops
+ * being requested cannot stay resident forever.
+ */
+class UnfilteredTileCache
+    : public LRUCache<std::string, shared_ptr<UnfilteredTilePayload>> {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param max_size Maximum cache size, in bytes. A value of zero
+   * disables the cache.
+   */
+  explicit UnfilteredTileCache(const uint64_t max_size)
+      : LRUCache<std::string, shared_ptr<UnfilteredTilePayload>>(max_size)
+      , enabled_(max_size > 0) {
+  }
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** @return Whether the cache is enabled. */
+  inline bool enabled() const {
+    return enabled_;
+  }
+
+  /**
+   * Builds the cache key for a tile.
+   *
+   * @param fragment_uri URI of the fragment the tile belongs to.
+   * @param field_name Name of the field.
+   * @param tile_idx Tile index within the fragment.
+   * @param validity_only Was the tile read for validity only?
+   * @return Cache key.
+   */
+  static std::string key(
+      const URI& fragment_uri,
+      const std::string& field_name,
+      const uint64_t tile_idx,
+      const bool validity_only) {
+    return fragment_uri.to_string() + ":" + field_name + ":" +
+           std::to_string(tile_idx) + (validity_only ? ":v" : "");
+  }
+
+  /**
+   * Looks up a tile payload, marking it most recently used on a hit.
+   *
+   * @param key Cache key for the tile.
+   * @param payload Set to the cached payload on a hit.
+   * @return Whether the payload was found in the cache.
+   */
+  bool lookup(const std::string& key, shared_ptr<UnfilteredTilePayload>* payload) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!has_item(key)) {
+      return false;
+    }
+    *payload = *get_item(key);
+    touch_item(key);
+    return true;
+  }
+
+  /**
+   * Inserts a tile payload into the cache, evicting the cheapest to
+   * refetch of the least recently used entries as needed to respect the
+   * size bound.
+   *
+   * @param key Cache key for the tile.
+   * @param payload Payload to insert.
+   */
+  void insert_payload(
+      const std::string& key, shared_ptr<UnfilteredTilePayload> payload) {
+    const uint64_t size = payload->size();
+    std::lock_guard<std::mutex> lock(mutex_);
+    make_room(size);
+    throw_if_not_ok(insert(key, std::move(payload), size));
+  }
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /**
+   * Number of least recently used entries considered as victims for each
+   * eviction.
+   */
+  static constexpr uint64_t eviction_window_ = 8;
+
+  /** Whether the cache is enabled. */
+  bool enabled_;
+
+  /** Protects the underlying LRU state. */
+  std::mutex mutex_;
+
+  /* ********************************* */
+  /*          PRIVATE METHODS          */
+  /* ********************************* */
+
+  /** @return Refetch cost per byte of a cached item. */
+  static double cost_density(const LRUCacheItem& item) {
+    return static_cast<double>(item.object_->cost_ns_) /
+           static_cast<double>(std::max<uint64_t>(item.size_, 1));
+  }
+
+  /**
+   * Evicts entries until a payload of `size` bytes fits in the size
+   * bound. Each round scans the `eviction_window_` least recently used
+   * entries, evicts the one that is the cheapest to refetch per byte and
+   * halves the cost of the entries that survived the scan.
+   *
+   * @param size Size of the payload about to be inserted, in bytes.
+   */
+  void make_room(const uint64_t size) {
+    // Oversized payloads are ignored by 'insert', nothing to make room
+    // for.
+    if (size > max_size()) {
+      return;
+    }
+
+    while (this->size() + size > max_size()) {
+      auto it = item_iter_begin();
+      auto victim = it;
+      double victim_density = cost_density(*it);
+      ++it;
+      for (uint64_t i = 1; i < eviction_window_ && it != item_iter_end();
+           i++, ++it) {
+        const double density = cost_density(*it);
+        if (density < victim_density) {
+          victim = it;
+          victim_density = density;
+        }
+      }
+
+      // Decay the cost of the entries that were passed over so an
+      // expensive entry that is no longer requested ages out instead of
+      // staying resident forever.
+      it = item_iter_begin();
+      for (uint64_t i = 0; i < eviction_window_ && it != item_iter_end();
+           i++, ++it) {
+        if (it != victim) {
+          it->object_->cost_ns_ /= 2;
+        }
+      }
+
+      bool success;
+      throw_if_not_ok(invalidate(victim->key_, &success));
+    }
+  }
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_UNFILTERED_TILE_CACHE_H
@@ -35,6 +35,8 @@
 #include "tiledb/sm/buffer/buffer.h"
 #include "tiledb/sm/enums/datatype.h"
 
+#include <cstring>
+
 /* ****************************** */
 /*             MACROS             */
 /* ****************************** */
@@ -303,6 +305,18 @@ Status DoubleDelta::decompress(
     return Status::Ok();
   }
 
+  // The header comes from the untrusted compressed stream: make sure the
+  // advertised number of values fits in the output buffer before writing
+  // through the raw pointer below.
+  if (num > output_buffer->free_space() / value_size) {
+    return LOG_STATUS(
+        Status_CompressionError("Cannot decompress with DoubleDelta; Invalid "
+                                "number of values"));
+  }
+
+  if (num == 0)
+    return Status::Ok();
+
   // Read first value
   T value;
   RETURN_NOT_OK(input_buffer->read(&value, value_size));
@@ -316,67 +330,53 @@ Status DoubleDelta::decompress(
   if (num == 2)
     return Status::Ok();
 
-  // Read first chunk
-  uint64_t chunk;
-  RETURN_NOT_OK(input_buffer->read(&chunk, sizeof(uint64_t)));
-  int bit_in_chunk = 63;  // Leftmost bit (MSB)
-
-  // Decompress rest of the values
-  int64_t dd;
-  for (uint64_t i = 2; i < num; ++i) {
-    RETURN_NOT_OK(
-        read_double_delta(input_buffer, &dd, bitsize, &chunk, &bit_in_chunk));
-    value = (T)(dd + 2 * (int64_t)out[i - 1] - (int64_t)out[i - 2]);
-    RETURN_NOT_OK(output_buffer->write(&value, value_size));
-  }
-
-  return Status::Ok();
-}
-
-Status DoubleDelta::read_double_delta(
-    ConstBuffer* buff,
-    int64_t* double_delta,
-    int bitsize,
-    uint64_t* chunk,
-    int* bit_in_chunk) {
-  // Read sign
-  uint64_t to_and = 1;
-  to_and <<= (*bit_in_chunk);
-  int sign = (((*chunk) & to_and) == 0) ? 1 : -1;
-  --(*bit_in_chunk);
-
-  // Read chunk and reset
-  if (*bit_in_chunk < 0) {
-    RETURN_NOT_OK(buff->read(chunk, sizeof(uint64_t)));
-    *bit_in_chunk = 63;
+  // Access the remaining packed stream as whole 64-bit chunks.
+  const auto* chunks = static_cast<const char*>(input_buffer->cur_data());
+  const uint64_t num_chunks =
+      input_buffer->nbytes_left_to_read() / sizeof(uint64_t);
+
+  // Every encoded value occupies a fixed number of bits: one sign bit
+  // followed by `bitsize` magnitude bits, packed MSB-first. The constant
+  // width allows decoding with plain shifts on a two-chunk window instead
+  // of a branching bit reader.
+  const unsigned int width = bitsize + 1;
+
+  // Reject truncated streams: the compressor flushes complete chunks, so
+  // all remaining values must be packed in the whole chunks left in the
+  // input buffer. This also makes the unconditional chunk load below safe.
+  if (num - 2 > num_chunks * 64 / width) {
+    return LOG_STATUS(
+        Status_CompressionError("Cannot decompress with DoubleDelta; Input "
+                                "buffer overflow"));
   }
-
-  // Read double delta
-  int bits_left_to_read = bitsize;
-  int bits_to_read_from_chunk = std::min(*bit_in_chunk + 1, bits_left_to_read);
-  uint64_t tmp_chunk;
-  int bit_in_dd = bitsize - 1;
-  *double_delta = 0;
-  while (bits_left_to_read > 0) {
-    // Read from chunk
-    if (bits_to_read_from_chunk > 0) {
-      tmp_chunk = (((*chunk) << (63 - *bit_in_chunk)) >> (63 - bit_in_dd));
-      (*double_delta) |= tmp_chunk;
-      bit_in_dd -= bits_to_read_from_chunk;
-      (*bit_in_chunk) -= bits_to_read_from_chunk;
-      bits_left_to_read -= bits_to_read_from_chunk;
+  const uint64_t mask = (uint64_t(1) << bitsize) - 1;
+  uint64_t bit_pos = 0;
+  for (uint64_t i = 2; i < num; ++i, bit_pos += width) {
+    const uint64_t chunk_idx = bit_pos >> 6;
+    const unsigned int bit_in_chunk = bit_pos & 63;
+
+    // Load the chunk holding the first bit of the value and the one after
+    // it, if any, as the value may straddle the two.
+    uint64_t hi, lo = 0;
+    std::memcpy(
+        &hi, chunks + chunk_idx * sizeof(uint64_t), sizeof(uint64_t));
+    if (chunk_idx + 1 < num_chunks) {
+      std::memcpy(
+          &lo, chunks + (chunk_idx + 1) * sizeof(uint64_t), sizeof(uint64_t));
     }
 
-    // Read chunk and reset
-    if (*bit_in_chunk < 0 && buff->offset() != buff->size()) {
-      RETURN_NOT_OK(buff->read(chunk, sizeof(uint64_t)));
-      *bit_in_chunk = 63;
-      bits_to_read_from_chunk = std::min(*bit_in_chunk + 1, bits_left_to_read);
-    }
-  }
+    // Left-align bits [bit_pos, bit_pos + width) in a 64-bit window. The
+    // double shift on `lo` avoids an undefined shift by 64 when the value
+    // starts on a chunk boundary.
+    uint64_t window = hi << bit_in_chunk;
+    window |= (lo >> 1) >> (63 - bit_in_chunk);
+    const uint64_t bits = window >> (64 - width);
 
-  // Set sign
-  (*double_delta) *= sign;
+    const auto magnitude = (int64_t)(bits & mask);
+    const int64_t dd = (bits >> bitsize) ? -magnitude : magnitude;
+    out[i] = (T)(dd + 2 * (int64_t)out[i - 1] - (int64_t)out[i - 2]);
+  }
+  output_buffer->advance_offset((num - 2) * value_size);
 
   return Status::Ok();
 }
@@ -154,25 +154,6 @@ class DoubleDelta {
   static Status decompress(
       ConstBuffer* input_buffer, PreallocatedBuffer* output_buffer);
 
-  /**
-   * Reads/reconstructs a double delta value from a compressed buffer.
-   *
-   * @param buff The input buffer.
-   * @param double_delta The double delta value to be retrieved.
-   * @param bitsize The bitsize of the double delta compression.
-   * @param chunk The function reads from the buffer in whole 64-bit chunks.
-   *     This parameters represents some state about the current chunk.
-   * @param bit_in_chunk Part of the chunk state. Stores the current bit
-   *     in the chunk the next read will start from.
-   * @return Status
-   */
-  static Status read_double_delta(
-      ConstBuffer* buff,
-      int64_t* double_delta,
-      int bitsize,
-      uint64_t* chunk,
-      int* bit_in_chunk);
-
   /**
    * Writes a double delta value to a buffer, after reducing its bitsize
    * to match the input one.
@@ -37,6 +37,7 @@
 #include "tiledb/common/logger.h"
 #include "tiledb/sm/misc/endian.h"
 
+#include <algorithm>
 #include <map>
 #include <unordered_map>
 #include <vector>
@@ -196,11 +197,28 @@ class DictEncoding {
       in_index += sizeof(T);
       assert(word_id < dict.size());
       const auto& word = dict[word_id];
+      // Count how many consecutive cells repeat this word id, so that the
+      // payload can be expanded by doubling instead of per-cell dictionary
+      // lookups and copies
+      uint64_t run_length = 1;
+      while (in_index < input.size() &&
+             utils::endianness::decode_be<T>(&input[in_index]) == word_id) {
+        in_index += sizeof(T);
+        run_length++;
+      }
       if (word.size() > 0) {
         memcpy(&output[out_index], word.data(), word.size());
+        const uint64_t run_bytes = run_length * word.size();
+        for (uint64_t copied = word.size(); copied < run_bytes;) {
+          const uint64_t n = std::min(copied, run_bytes - copied);
+          memcpy(&output[out_index + copied], &output[out_index], n);
+          copied += n;
+        }
+      }
+      for (uint64_t j = 0; j < run_length; j++) {
+        output_offsets[offset_index++] = out_index;
+        out_index += word.size();
       }
-      output_offsets[offset_index++] = out_index;
-      out_index += word.size();
     }
   }
 
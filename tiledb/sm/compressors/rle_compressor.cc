@@ -128,9 +128,22 @@ Status RLE::decompress(
     std::memcpy(&byte, input_cur + value_size + sizeof(char), sizeof(char));
     run_len += (uint64_t)byte;
 
-    // Copy to output buffer
-    for (uint64_t j = 0; j < run_len; ++j)
-      RETURN_NOT_OK(output_buffer->write(input_cur, value_size));
+    // Copy the value once to the output buffer, then double the expanded
+    // region in place until the run is complete
+    uint64_t run_bytes = run_len * value_size;
+    if (run_bytes > output_buffer->free_space())
+      return LOG_STATUS(Status_CompressionError(
+          "Failed decompressing with RLE; output buffer overflow"));
+    if (run_len > 0) {
+      auto output_cur = static_cast<unsigned char*>(output_buffer->cur_data());
+      std::memcpy(output_cur, input_cur, value_size);
+      for (uint64_t copied = value_size; copied < run_bytes;) {
+        uint64_t n = std::min(copied, run_bytes - copied);
+        std::memcpy(output_cur + copied, output_cur, n);
+        copied += n;
+      }
+      output_buffer->advance_offset(run_bytes);
+    }
 
     // Update input/output tracking info
     input_cur += run_size;
@@ -38,6 +38,7 @@
 #include "tiledb/sm/misc/constants.h"
 #include "tiledb/sm/misc/endian.h"
 
+#include <algorithm>
 #include <limits>
 #include <vector>
 
@@ -167,10 +168,18 @@ class RLE {
       in_index += run_size;
       string_length = utils::endianness::decode_be<P>(&input[in_index]);
       in_index += str_len_size;
-      for (uint64_t j = 0; j < run_length; j++) {
-        if (string_length > 0) {
-          memcpy(&output[out_offset], &input[in_index], string_length);
+      // Expand the run by copying the string once and then doubling the
+      // already expanded region in place, instead of one memcpy per cell
+      if (string_length > 0) {
+        memcpy(&output[out_offset], &input[in_index], string_length);
+        const uint64_t run_bytes = (uint64_t)run_length * string_length;
+        for (uint64_t copied = string_length; copied < run_bytes;) {
+          const uint64_t n = std::min(copied, run_bytes - copied);
+          memcpy(&output[out_offset + copied], &output[out_offset], n);
+          copied += n;
         }
+      }
+      for (uint64_t j = 0; j < run_length; j++) {
         output_offsets[offset_index++] = out_offset;
         out_offset += string_length;
       }
@@ -283,9 +292,8 @@ class RLE {
     while (in_index < input.size()) {
       run_length = input[in_index++];
       auto value = input[in_index++];
-      for (uint64_t j = 0; j < run_length; j++) {
-        output[out_index++] = value;
-      }
+      std::fill_n(output.begin() + out_index, run_length, value);
+      out_index += run_length;
     }
   }
 };
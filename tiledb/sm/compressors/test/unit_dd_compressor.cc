@@ -0,0 +1,126 @@
+/**
+ * @file   unit_dd_compressor.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Tests for the double delta compressor.
+ */
+
+#include <test/support/tdb_catch.h>
+
+#include "tiledb/sm/buffer/buffer.h"
+#include "tiledb/sm/compressors/dd_compressor.h"
+#include "tiledb/sm/enums/datatype.h"
+
+#include <limits>
+#include <random>
+
+using namespace tiledb::common;
+using namespace tiledb::sm;
+
+namespace {
+
+/** Compresses and decompresses `uncompressed`, returning the result. */
+template <class T>
+std::vector<T> roundtrip(Datatype type, const std::vector<T>& uncompressed) {
+  ConstBuffer uncompressed_buff(
+      uncompressed.data(), uncompressed.size() * sizeof(T));
+  Buffer compressed_buff{};
+  REQUIRE(DoubleDelta::compress(type, &uncompressed_buff, &compressed_buff)
+              .ok());
+
+  std::vector<T> decompressed(uncompressed.size());
+  ConstBuffer compressed_const_buff(
+      compressed_buff.data(), compressed_buff.size());
+  PreallocatedBuffer decompressed_buff(
+      decompressed.data(), decompressed.size() * sizeof(T));
+  REQUIRE(DoubleDelta::decompress(
+              type, &compressed_const_buff, &decompressed_buff)
+              .ok());
+
+  return decompressed;
+}
+
+}  // namespace
+
+TEST_CASE(
+    "Test double delta compression of timestamps",
+    "[compression][double-delta]") {
+  // Monotonic int64 timestamps with a small jitter produce small double
+  // deltas and exercise the packed bit decode path.
+  std::vector<int64_t> uncompressed;
+  int64_t ts = 1672531200000;
+  std::mt19937_64 rng(1234);
+  for (uint64_t i = 0; i < 10000; i++) {
+    uncompressed.emplace_back(ts);
+    ts += 1000 + static_cast<int64_t>(rng() % 32) - 16;
+  }
+
+  CHECK(roundtrip(Datatype::DATETIME_MS, uncompressed) == uncompressed);
+}
+
+TEST_CASE(
+    "Test double delta compression of random vectors",
+    "[compression][double-delta]") {
+  std::mt19937_64 rng(5678);
+
+  // Draw double deltas of varying magnitudes to cover all bit widths,
+  // including values straddling 64-bit chunk boundaries.
+  for (unsigned int bits = 1; bits <= 30; bits++) {
+    std::vector<int64_t> uncompressed{0, 100};
+    const auto max_dd = (int64_t(1) << bits) - 1;
+    for (uint64_t i = 2; i < 1000; i++) {
+      auto dd = static_cast<int64_t>(rng() % (max_dd + 1));
+      dd = (rng() & 1) ? -dd : dd;
+      const auto prev_delta = uncompressed[i - 1] - uncompressed[i - 2];
+      uncompressed.emplace_back(uncompressed[i - 1] + prev_delta + dd);
+    }
+
+    CHECK(roundtrip(Datatype::INT64, uncompressed) == uncompressed);
+  }
+}
+
+TEST_CASE(
+    "Test double delta compression edge cases",
+    "[compression][double-delta]") {
+  // Single value.
+  std::vector<int32_t> single{42};
+  CHECK(roundtrip(Datatype::INT32, single) == single);
+
+  // Two values.
+  std::vector<int32_t> two{42, -7};
+  CHECK(roundtrip(Datatype::INT32, two) == two);
+
+  // Constant values compress to zero-sized double deltas.
+  std::vector<uint16_t> constant(100, 1234);
+  CHECK(roundtrip(Datatype::UINT16, constant) == constant);
+
+  // Large double deltas fall back to the uncompressed path.
+  std::vector<int64_t> large{
+      0, std::numeric_limits<int64_t>::max() / 2, 0, 1, -1};
+  CHECK(roundtrip(Datatype::INT64, large) == large);
+}
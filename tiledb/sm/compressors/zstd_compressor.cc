@@ -35,6 +35,9 @@
 #include "tiledb/common/logger.h"
 #include "tiledb/sm/buffer/buffer.h"
 
+#include <zdict.h>
+
+#include <cmath>
 #include <iostream>
 
 using namespace tiledb::common;
@@ -46,7 +49,8 @@ Status ZStd::compress(
     int level,
     shared_ptr<BlockingResourcePool<ZSTD_Compress_Context>> compress_ctx_pool,
     ConstBuffer* input_buffer,
-    Buffer* output_buffer) {
+    Buffer* output_buffer,
+    const std::vector<uint8_t>* dictionary) {
   // Sanity check
   if (input_buffer->data() == nullptr || output_buffer->data() == nullptr)
     return LOG_STATUS(Status_CompressionError(
@@ -61,13 +65,28 @@ Status ZStd::compress(
   auto& context = context_guard.get();
 
   // Compress
-  uint64_t zstd_ret = ZSTD_compressCCtx(
-      context.ptr(),
-      output_buffer->cur_data(),
-      output_buffer->free_space(),
-      input_buffer->data(),
-      input_buffer->size(),
-      level < level_limit_ ? ZStd::default_level() : level);
+  const int used_level = select_level(
+      level < level_limit_ ? ZStd::default_level() : level, input_buffer);
+  uint64_t zstd_ret;
+  if (dictionary != nullptr && !dictionary->empty()) {
+    zstd_ret = ZSTD_compress_usingDict(
+        context.ptr(),
+        output_buffer->cur_data(),
+        output_buffer->free_space(),
+        input_buffer->data(),
+        input_buffer->size(),
+        dictionary->data(),
+        dictionary->size(),
+        used_level);
+  } else {
+    zstd_ret = ZSTD_compressCCtx(
+        context.ptr(),
+        output_buffer->cur_data(),
+        output_buffer->free_space(),
+        input_buffer->data(),
+        input_buffer->size(),
+        used_level);
+  }
 
   // Handle error
   if (ZSTD_isError(zstd_ret) != 0) {
@@ -83,11 +102,40 @@ Status ZStd::compress(
   return Status::Ok();
 }
 
+int ZStd::select_level(int level, ConstBuffer* input_buffer) {
+  // Nothing to gain on levels at or below the fast level and on inputs too
+  // small for the sample to be meaningful.
+  if (level <= fast_level_ || input_buffer->size() < probe_sample_size_)
+    return level;
+
+  // Build a byte histogram from samples spread over the whole input.
+  const auto* data = static_cast<const uint8_t*>(input_buffer->data());
+  const uint64_t size = input_buffer->size();
+  const uint64_t stride = size / probe_sample_size_;
+  uint64_t counts[256] = {0};
+  uint64_t num_samples = 0;
+  for (uint64_t i = 0; i < size && num_samples < probe_sample_size_;
+       i += stride, num_samples++)
+    counts[data[i]]++;
+
+  // Compute the entropy of the sampled bytes, in bits per byte.
+  double entropy = 0.0;
+  for (unsigned c = 0; c < 256; c++) {
+    if (counts[c] != 0) {
+      double p = (double)counts[c] / (double)num_samples;
+      entropy -= p * std::log2(p);
+    }
+  }
+
+  return entropy < probe_entropy_limit_ ? level : fast_level_;
+}
+
 Status ZStd::decompress(
     shared_ptr<BlockingResourcePool<ZSTD_Decompress_Context>>
         decompress_ctx_pool,
     ConstBuffer* input_buffer,
-    PreallocatedBuffer* output_buffer) {
+    PreallocatedBuffer* output_buffer,
+    const std::vector<uint8_t>* dictionary) {
   // Sanity check
   if (input_buffer->data() == nullptr || output_buffer->data() == nullptr)
     return LOG_STATUS(Status_CompressionError(
@@ -102,12 +150,24 @@ Status ZStd::decompress(
   auto& context = context_guard.get();
 
   // Decompress
-  uint64_t zstd_ret = ZSTD_decompressDCtx(
-      context.ptr(),
-      output_buffer->cur_data(),
-      output_buffer->free_space(),
-      input_buffer->data(),
-      input_buffer->size());
+  uint64_t zstd_ret;
+  if (dictionary != nullptr && !dictionary->empty()) {
+    zstd_ret = ZSTD_decompress_usingDict(
+        context.ptr(),
+        output_buffer->cur_data(),
+        output_buffer->free_space(),
+        input_buffer->data(),
+        input_buffer->size(),
+        dictionary->data(),
+        dictionary->size());
+  } else {
+    zstd_ret = ZSTD_decompressDCtx(
+        context.ptr(),
+        output_buffer->cur_data(),
+        output_buffer->free_space(),
+        input_buffer->data(),
+        input_buffer->size());
+  }
 
   // Check error
   if (ZSTD_isError(zstd_ret) != 0) {
@@ -122,6 +182,27 @@ Status ZStd::decompress(
   return Status::Ok();
 }
 
+std::vector<uint8_t> ZStd::train_dictionary(
+    const std::vector<uint8_t>& samples,
+    const std::vector<size_t>& sample_sizes) {
+  std::vector<uint8_t> dictionary(dictionary_max_size);
+  uint64_t zstd_ret = ZDICT_trainFromBuffer(
+      dictionary.data(),
+      dictionary.size(),
+      samples.data(),
+      sample_sizes.data(),
+      static_cast<unsigned>(sample_sizes.size()));
+
+  // Training fails on purpose for samples without enough shared content,
+  // return an empty dictionary so callers fall back to plain compression.
+  if (ZDICT_isError(zstd_ret) != 0) {
+    return {};
+  }
+
+  dictionary.resize(zstd_ret);
+  return dictionary;
+}
+
 uint64_t ZStd::overhead(uint64_t nbytes) {
   return ZSTD_compressBound(nbytes) - nbytes;
 }
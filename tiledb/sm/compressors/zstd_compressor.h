@@ -91,13 +91,16 @@ class ZStd {
    * @param compress_ctx_pool Resource pool to manage compression context reuse
    * @param input_buffer Input buffer to read from.
    * @param output_buffer Output buffer to write to the compressed data.
+   * @param dictionary Optional trained dictionary to compress with. The same
+   * dictionary must be provided to decompress the data.
    * @return Status
    */
   static Status compress(
       int level,
       shared_ptr<BlockingResourcePool<ZSTD_Compress_Context>> compress_ctx_pool,
       ConstBuffer* input_buffer,
-      Buffer* output_buffer);
+      Buffer* output_buffer,
+      const std::vector<uint8_t>* dictionary = nullptr);
 
   /**
    * Overloaded compression function with default compression level.
@@ -115,13 +118,32 @@ class ZStd {
    * reuse
    * @param input_buffer Input buffer to read from.
    * @param output_buffer Output buffer to write the decompressed data to.
+   * @param dictionary Optional trained dictionary the data was compressed
+   * with.
    * @return Status
    */
   static Status decompress(
       shared_ptr<BlockingResourcePool<ZSTD_Decompress_Context>>
           decompress_ctx_pool,
       ConstBuffer* input_buffer,
-      PreallocatedBuffer* output_buffer);
+      PreallocatedBuffer* output_buffer,
+      const std::vector<uint8_t>* dictionary = nullptr);
+
+  /**
+   * Trains a compression dictionary from a set of samples.
+   *
+   * @param samples Buffer with all the training samples, concatenated.
+   * @param sample_sizes Size of each sample in the samples buffer.
+   * @return The trained dictionary, empty if training did not succeed.
+   * Training fails on purpose when the samples don't have enough shared
+   * content for a dictionary to help.
+   */
+  static std::vector<uint8_t> train_dictionary(
+      const std::vector<uint8_t>& samples,
+      const std::vector<size_t>& sample_sizes);
+
+  /** Maximum size of a trained dictionary, in bytes. */
+  static constexpr uint64_t dictionary_max_size = 110 * 1024;
 
   /** Returns the default compression level. */
   static int default_level() {
@@ -137,6 +159,35 @@ class ZStd {
 
   /** The default filter compression level. */
   static constexpr int default_level_ = 3;
+
+  /** The level used for inputs the entropy probe deems incompressible. */
+  static constexpr int fast_level_ = 1;
+
+  /** Number of bytes sampled by the entropy probe. */
+  static constexpr uint64_t probe_sample_size_ = 4096;
+
+  /**
+   * Entropy in bits per byte above which an input is considered
+   * incompressible. Already compressed or encrypted data sits near 8.
+   */
+  static constexpr double probe_entropy_limit_ = 7.8;
+
+  /**
+   * Selects the compression level to use for the given input.
+   *
+   * High levels spend their extra search effort for nothing on inputs
+   * that are already compressed or otherwise near-random, which commonly
+   * sit next to compressible tiles in the same array. This probes the
+   * byte entropy of a small sample of the input and downgrades such
+   * inputs to a fast level; zstd itself falls back to raw blocks when
+   * even that cannot shrink the data. The frame records how each block
+   * was emitted, so decompression is unaffected by the selection.
+   *
+   * @param level The requested compression level.
+   * @param input_buffer Input buffer that will be compressed.
+   * @return The level to compress with.
+   */
+  static int select_level(int level, ConstBuffer* input_buffer);
 };
 
 }  // namespace sm
@@ -98,6 +98,7 @@ const std::string Config::REST_USE_REFACTORED_ARRAY_OPEN = "false";
 const std::string Config::REST_USE_REFACTORED_QUERY_SUBMIT = "false";
 const std::string Config::SM_ALLOW_SEPARATE_ATTRIBUTE_WRITES = "false";
 const std::string Config::SM_ALLOW_UPDATES_EXPERIMENTAL = "false";
+const std::string Config::SM_ARRAY_PREFETCH_FRAGMENT_METADATA = "false";
 const std::string Config::SM_ENCRYPTION_KEY = "";
 const std::string Config::SM_ENCRYPTION_TYPE = "NO_ENCRYPTION";
 const std::string Config::SM_DEDUP_COORDS = "false";
@@ -106,18 +107,42 @@ const std::string Config::SM_CHECK_COORD_OOB = "true";
 const std::string Config::SM_READ_RANGE_OOB = "warn";
 const std::string Config::SM_CHECK_GLOBAL_ORDER = "true";
 const std::string Config::SM_MERGE_OVERLAPPING_RANGES_EXPERIMENTAL = "true";
+const std::string Config::SM_FILTER_PIPELINE_ADVISOR_ENABLE = "false";
+const std::string Config::SM_ZSTD_TRAIN_DICTIONARIES = "false";
 const std::string Config::SM_SKIP_EST_SIZE_PARTITIONING = "false";
 const std::string Config::SM_SKIP_UNARY_PARTITIONING_BUDGET_CHECK = "false";
+const std::string Config::SM_UNFILTER_MIN_CHUNKS_PER_TASK = "4";
+const std::string Config::SM_TILE_CACHE_SIZE = "10000000";             // 10MB
+const std::string Config::SM_FRAGMENT_FOOTER_CACHE_SIZE = "10000000";  // 10MB
+const std::string Config::SM_GROUP_DETAILS_CACHE_SIZE = "10000000";    // 10MB
+const std::string Config::SM_ENUMERATION_CACHE_SIZE = "10000000";      // 10MB
+const std::string Config::SM_DELETION_VECTOR_CACHE_SIZE = "10000000";  // 10MB
+const std::string Config::SM_ARRAY_SCHEMA_CACHE_SIZE = "10000000";     // 10MB
+const std::string Config::SM_ARRAY_SCHEMA_REGISTRY_ENABLE = "true";
+const std::string Config::SM_QUERY_RESULT_CACHE_SIZE = "0";
 const std::string Config::SM_MEMORY_BUDGET = "5368709120";       // 5GB
 const std::string Config::SM_MEMORY_BUDGET_VAR = "10737418240";  // 10GB
+const std::string Config::SM_QUERY_ATTRIBUTE_PREFETCH_DEPTH = "0";
 const std::string Config::SM_QUERY_DENSE_QC_COORDS_MODE = "false";
 const std::string Config::SM_QUERY_DENSE_READER = "refactored";
+const std::string Config::SM_QUERY_GLOBAL_ORDER_WRITER_PIPELINED_IO = "false";
+const std::string Config::SM_QUERY_PRIORITY = "normal";
+const std::string Config::SM_QUERY_PROFILE_GUIDED_ENABLE = "false";
+const std::string Config::SM_QUERY_SLOW_LOG_THRESHOLD_MS = "0";
+const std::string Config::SM_QUERY_SLOW_LOG_FILE = "";
+const std::string Config::SM_QUERY_SPARSE_RESULT_BUDGET_CELLS = "0";
 const std::string Config::SM_QUERY_SPARSE_GLOBAL_ORDER_READER = "refactored";
 const std::string Config::SM_QUERY_SPARSE_UNORDERED_WITH_DUPS_READER =
     "refactored";
+const std::string
+    Config::SM_QUERY_SPARSE_UNORDERED_WITH_DUPS_TILE_COMPLETION_ORDER = "false";
+const std::string
+    Config::SM_QUERY_SPARSE_UNORDERED_WITH_DUPS_STREAMING_EMISSION = "false";
 const std::string Config::SM_MEM_MALLOC_TRIM = "true";
+const std::string Config::SM_MEM_HUGEPAGES = "false";
 const std::string Config::SM_UPPER_MEMORY_LIMIT = "1073741824";  // 1GB
 const std::string Config::SM_MEM_TOTAL_BUDGET = "10737418240";   // 10GB
+const std::string Config::SM_MEM_CONTEXT_BUDGET = "0";  // No limit
 const std::string Config::SM_MEM_SPARSE_GLOBAL_ORDER_RATIO_COORDS = "0.5";
 const std::string Config::SM_MEM_SPARSE_GLOBAL_ORDER_RATIO_TILE_RANGES = "0.1";
 const std::string Config::SM_MEM_SPARSE_GLOBAL_ORDER_RATIO_ARRAY_DATA = "0.1";
@@ -132,7 +157,12 @@ const std::string Config::SM_COMPUTE_CONCURRENCY_LEVEL =
     utils::parse::to_str(std::thread::hardware_concurrency());
 const std::string Config::SM_IO_CONCURRENCY_LEVEL =
     utils::parse::to_str(std::thread::hardware_concurrency());
+const std::string Config::SM_NUMA_PIN_THREADS = "false";
 const std::string Config::SM_SKIP_CHECKSUM_VALIDATION = "false";
+const std::string Config::SM_DEFERRED_CHECKSUM_VALIDATION = "false";
+const std::string Config::SM_STATS_TRACE_ENABLED = "false";
+const std::string Config::SM_TRACE_RING_ENABLED = "false";
+const std::string Config::SM_COMMIT_BATCH_SIZE = "1";
 const std::string Config::SM_CONSOLIDATION_AMPLIFICATION = "1.0";
 const std::string Config::SM_CONSOLIDATION_BUFFER_SIZE = "50000000";
 const std::string Config::SM_CONSOLIDATION_MAX_FRAGMENT_SIZE =
@@ -142,6 +172,7 @@ const std::string Config::SM_CONSOLIDATION_STEPS = "4294967295";
 const std::string Config::SM_CONSOLIDATION_STEP_MIN_FRAGS = "4294967295";
 const std::string Config::SM_CONSOLIDATION_STEP_MAX_FRAGS = "4294967295";
 const std::string Config::SM_CONSOLIDATION_STEP_SIZE_RATIO = "0.0";
+const std::string Config::SM_CONSOLIDATION_MIN_INTERLEAVE_RATIO = "0.0";
 const std::string Config::SM_CONSOLIDATION_MODE = "fragments";
 const std::string Config::SM_CONSOLIDATION_TIMESTAMP_START = "0";
 const std::string Config::SM_CONSOLIDATION_TIMESTAMP_END =
@@ -152,6 +183,7 @@ const std::string Config::SM_VACUUM_TIMESTAMP_END = std::to_string(UINT64_MAX);
 const std::string Config::SM_OFFSETS_BITSIZE = "64";
 const std::string Config::SM_OFFSETS_EXTRA_ELEMENT = "false";
 const std::string Config::SM_OFFSETS_FORMAT_MODE = "bytes";
+const std::string Config::SM_VALIDITY_FORMAT_MODE = "bytemap";
 const std::string Config::SM_MAX_TILE_OVERLAP_SIZE = "314572800";  // 300MiB
 const std::string Config::SM_GROUP_TIMESTAMP_START = "0";
 const std::string Config::SM_GROUP_TIMESTAMP_END = std::to_string(UINT64_MAX);
@@ -163,13 +195,21 @@ const std::string Config::SSL_CA_FILE = "";
 const std::string Config::SSL_CA_PATH = "";
 const std::string Config::SSL_VERIFY = "true";
 const std::string Config::VFS_MIN_PARALLEL_SIZE = "10485760";
+const std::string Config::VFS_ADAPTIVE_PARALLEL_OPS = "false";
 const std::string Config::VFS_MAX_BATCH_SIZE = "104857600";
 const std::string Config::VFS_MIN_BATCH_GAP = "512000";
 const std::string Config::VFS_MIN_BATCH_SIZE = "20971520";
 const std::string Config::VFS_FILE_POSIX_FILE_PERMISSIONS = "644";
 const std::string Config::VFS_FILE_POSIX_DIRECTORY_PERMISSIONS = "755";
+const std::string Config::VFS_FILE_POSIX_USE_MMAP = "false";
+const std::string Config::VFS_FILE_POSIX_USE_IO_URING = "false";
+const std::string Config::VFS_FILE_POSIX_DIRECT_IO = "false";
 const std::string Config::VFS_READ_AHEAD_SIZE = "102400";          // 100KiB
+const std::string Config::VFS_READ_AHEAD_MAX_SIZE = "4194304";     // 4MiB
 const std::string Config::VFS_READ_AHEAD_CACHE_SIZE = "10485760";  // 10MiB;
+const std::string Config::VFS_DISK_CACHE_ENABLE = "false";
+const std::string Config::VFS_DISK_CACHE_DIR = "";
+const std::string Config::VFS_DISK_CACHE_SIZE = "10737418240";  // 10GiB;
 const std::string Config::VFS_READ_LOGGING_MODE = "";
 const std::string Config::VFS_AZURE_STORAGE_ACCOUNT_NAME = "";
 const std::string Config::VFS_AZURE_STORAGE_ACCOUNT_KEY = "";
@@ -179,6 +219,7 @@ const std::string Config::VFS_AZURE_MAX_PARALLEL_OPS =
     Config::SM_IO_CONCURRENCY_LEVEL;
 const std::string Config::VFS_AZURE_BLOCK_LIST_BLOCK_SIZE = "5242880";
 const std::string Config::VFS_AZURE_USE_BLOCK_LIST_UPLOAD = "true";
+const std::string Config::VFS_AZURE_USE_STREAMING_UPLOAD = "true";
 const std::string Config::VFS_AZURE_MAX_RETRIES = "5";
 const std::string Config::VFS_AZURE_RETRY_DELAY_MS = "800";
 const std::string Config::VFS_AZURE_MAX_RETRY_DELAY_MS = "60000";
@@ -188,6 +229,7 @@ const std::string Config::VFS_GCS_MAX_PARALLEL_OPS =
     Config::SM_IO_CONCURRENCY_LEVEL;
 const std::string Config::VFS_GCS_MULTI_PART_SIZE = "5242880";
 const std::string Config::VFS_GCS_USE_MULTI_PART_UPLOAD = "true";
+const std::string Config::VFS_GCS_USE_STREAMING_UPLOAD = "true";
 const std::string Config::VFS_GCS_REQUEST_TIMEOUT_MS = "3000";
 const std::string Config::VFS_GCS_MAX_DIRECT_UPLOAD_SIZE = "10737418240";
 const std::string Config::VFS_S3_REGION = "us-east-1";
@@ -202,6 +244,7 @@ const std::string Config::VFS_S3_SCHEME = "https";
 const std::string Config::VFS_S3_ENDPOINT_OVERRIDE = "";
 const std::string Config::VFS_S3_USE_VIRTUAL_ADDRESSING = "true";
 const std::string Config::VFS_S3_SKIP_INIT = "false";
+const std::string Config::VFS_S3_EAGER_INIT = "false";
 const std::string Config::VFS_S3_USE_MULTIPART_UPLOAD = "true";
 const std::string Config::VFS_S3_MAX_PARALLEL_OPS =
     Config::SM_IO_CONCURRENCY_LEVEL;
@@ -272,6 +315,9 @@ const std::map<std::string, std::string> default_config_values = {
         Config::SM_ALLOW_SEPARATE_ATTRIBUTE_WRITES),
     std::make_pair(
         "sm.allow_updates_experimental", Config::SM_ALLOW_UPDATES_EXPERIMENTAL),
+    std::make_pair(
+        "sm.array.prefetch_fragment_metadata",
+        Config::SM_ARRAY_PREFETCH_FRAGMENT_METADATA),
     std::make_pair("sm.encryption_key", Config::SM_ENCRYPTION_KEY),
     std::make_pair("sm.encryption_type", Config::SM_ENCRYPTION_TYPE),
     std::make_pair("sm.dedup_coords", Config::SM_DEDUP_COORDS),
@@ -282,26 +328,76 @@ const std::map<std::string, std::string> default_config_values = {
     std::make_pair(
         "sm.merge_overlapping_ranges_experimental",
         Config::SM_MERGE_OVERLAPPING_RANGES_EXPERIMENTAL),
+    std::make_pair(
+        "sm.filter_pipeline_advisor.enable",
+        Config::SM_FILTER_PIPELINE_ADVISOR_ENABLE),
+    std::make_pair(
+        "sm.zstd_train_dictionaries", Config::SM_ZSTD_TRAIN_DICTIONARIES),
     std::make_pair(
         "sm.skip_est_size_partitioning", Config::SM_SKIP_EST_SIZE_PARTITIONING),
     std::make_pair(
         "sm.skip_unary_partitioning_budget_check",
         Config::SM_SKIP_UNARY_PARTITIONING_BUDGET_CHECK),
+    std::make_pair(
+        "sm.unfilter_min_chunks_per_task",
+        Config::SM_UNFILTER_MIN_CHUNKS_PER_TASK),
+    std::make_pair("sm.tile_cache_size", Config::SM_TILE_CACHE_SIZE),
+    std::make_pair(
+        "sm.fragment_footer_cache_size", Config::SM_FRAGMENT_FOOTER_CACHE_SIZE),
+    std::make_pair(
+        "sm.group_details_cache_size", Config::SM_GROUP_DETAILS_CACHE_SIZE),
+    std::make_pair(
+        "sm.enumeration_cache_size", Config::SM_ENUMERATION_CACHE_SIZE),
+    std::make_pair(
+        "sm.deletion_vector_cache_size", Config::SM_DELETION_VECTOR_CACHE_SIZE),
+    std::make_pair(
+        "sm.array_schema_cache_size", Config::SM_ARRAY_SCHEMA_CACHE_SIZE),
+    std::make_pair(
+        "sm.array_schema_registry.enable",
+        Config::SM_ARRAY_SCHEMA_REGISTRY_ENABLE),
+    std::make_pair(
+        "sm.query_result_cache_size", Config::SM_QUERY_RESULT_CACHE_SIZE),
     std::make_pair("sm.memory_budget", Config::SM_MEMORY_BUDGET),
     std::make_pair("sm.memory_budget_var", Config::SM_MEMORY_BUDGET_VAR),
+    std::make_pair(
+        "sm.query.attribute_prefetch_depth",
+        Config::SM_QUERY_ATTRIBUTE_PREFETCH_DEPTH),
     std::make_pair(
         "sm.query.dense.qc_coords_mode", Config::SM_QUERY_DENSE_QC_COORDS_MODE),
     std::make_pair("sm.query.dense.reader", Config::SM_QUERY_DENSE_READER),
+    std::make_pair(
+        "sm.query.global_order_writer.pipelined_io",
+        Config::SM_QUERY_GLOBAL_ORDER_WRITER_PIPELINED_IO),
+    std::make_pair("sm.query.priority", Config::SM_QUERY_PRIORITY),
+    std::make_pair(
+        "sm.query.profile_guided.enable",
+        Config::SM_QUERY_PROFILE_GUIDED_ENABLE),
+    std::make_pair(
+        "sm.query.slow_log.file", Config::SM_QUERY_SLOW_LOG_FILE),
+    std::make_pair(
+        "sm.query.slow_log.threshold_ms",
+        Config::SM_QUERY_SLOW_LOG_THRESHOLD_MS),
+    std::make_pair(
+        "sm.query.sparse.result_budget_cells",
+        Config::SM_QUERY_SPARSE_RESULT_BUDGET_CELLS),
     std::make_pair(
         "sm.query.sparse_global_order.reader",
         Config::SM_QUERY_SPARSE_GLOBAL_ORDER_READER),
     std::make_pair(
         "sm.query.sparse_unordered_with_dups.reader",
         Config::SM_QUERY_SPARSE_UNORDERED_WITH_DUPS_READER),
+    std::make_pair(
+        "sm.query.sparse_unordered_with_dups.tile_completion_order",
+        Config::SM_QUERY_SPARSE_UNORDERED_WITH_DUPS_TILE_COMPLETION_ORDER),
+    std::make_pair(
+        "sm.query.sparse_unordered_with_dups.streaming_emission",
+        Config::SM_QUERY_SPARSE_UNORDERED_WITH_DUPS_STREAMING_EMISSION),
+    std::make_pair("sm.mem.hugepages", Config::SM_MEM_HUGEPAGES),
     std::make_pair("sm.mem.malloc_trim", Config::SM_MEM_MALLOC_TRIM),
     std::make_pair(
         "sm.mem.tile_upper_memory_limit", Config::SM_UPPER_MEMORY_LIMIT),
     std::make_pair("sm.mem.total_budget", Config::SM_MEM_TOTAL_BUDGET),
+    std::make_pair("sm.mem.context_budget", Config::SM_MEM_CONTEXT_BUDGET),
     std::make_pair(
         "sm.mem.reader.sparse_global_order.ratio_coords",
         Config::SM_MEM_SPARSE_GLOBAL_ORDER_RATIO_COORDS),
@@ -325,8 +421,15 @@ const std::map<std::string, std::string> default_config_values = {
     std::make_pair(
         "sm.compute_concurrency_level", Config::SM_COMPUTE_CONCURRENCY_LEVEL),
     std::make_pair("sm.io_concurrency_level", Config::SM_IO_CONCURRENCY_LEVEL),
+    std::make_pair("sm.numa.pin_threads", Config::SM_NUMA_PIN_THREADS),
     std::make_pair(
         "sm.skip_checksum_validation", Config::SM_SKIP_CHECKSUM_VALIDATION),
+    std::make_pair(
+        "sm.deferred_checksum_validation",
+        Config::SM_DEFERRED_CHECKSUM_VALIDATION),
+    std::make_pair("sm.stats.trace_enabled", Config::SM_STATS_TRACE_ENABLED),
+    std::make_pair("sm.trace_ring.enabled", Config::SM_TRACE_RING_ENABLED),
+    std::make_pair("sm.commit_batch_size", Config::SM_COMMIT_BATCH_SIZE),
     std::make_pair(
         "sm.consolidation.amplification",
         Config::SM_CONSOLIDATION_AMPLIFICATION),
@@ -347,6 +450,9 @@ const std::map<std::string, std::string> default_config_values = {
     std::make_pair(
         "sm.consolidation.step_size_ratio",
         Config::SM_CONSOLIDATION_STEP_SIZE_RATIO),
+    std::make_pair(
+        "sm.consolidation.min_interleave_ratio",
+        Config::SM_CONSOLIDATION_MIN_INTERLEAVE_RATIO),
     std::make_pair("sm.consolidation.steps", Config::SM_CONSOLIDATION_STEPS),
     std::make_pair("sm.consolidation.mode", Config::SM_CONSOLIDATION_MODE),
     std::make_pair(
@@ -359,6 +465,7 @@ const std::map<std::string, std::string> default_config_values = {
     std::make_pair("sm.var_offsets.bitsize", Config::SM_OFFSETS_BITSIZE),
     std::make_pair(
         "sm.var_offsets.extra_element", Config::SM_OFFSETS_EXTRA_ELEMENT),
+    std::make_pair("sm.validity.mode", Config::SM_VALIDITY_FORMAT_MODE),
     std::make_pair("sm.var_offsets.mode", Config::SM_OFFSETS_FORMAT_MODE),
     std::make_pair(
         "sm.max_tile_overlap_size", Config::SM_MAX_TILE_OVERLAP_SIZE),
@@ -379,18 +486,31 @@ const std::map<std::string, std::string> default_config_values = {
     std::make_pair("ssl.ca_path", Config::SSL_CA_PATH),
     std::make_pair("ssl.verify", Config::SSL_VERIFY),
     std::make_pair("vfs.min_parallel_size", Config::VFS_MIN_PARALLEL_SIZE),
+    std::make_pair(
+        "vfs.adaptive_parallel_ops", Config::VFS_ADAPTIVE_PARALLEL_OPS),
     std::make_pair("vfs.max_batch_size", Config::VFS_MAX_BATCH_SIZE),
     std::make_pair("vfs.min_batch_gap", Config::VFS_MIN_BATCH_GAP),
     std::make_pair("vfs.min_batch_size", Config::VFS_MIN_BATCH_SIZE),
     std::make_pair("vfs.read_ahead_size", Config::VFS_READ_AHEAD_SIZE),
+    std::make_pair(
+        "vfs.read_ahead_max_size", Config::VFS_READ_AHEAD_MAX_SIZE),
     std::make_pair(
         "vfs.read_ahead_cache_size", Config::VFS_READ_AHEAD_CACHE_SIZE),
+    std::make_pair("vfs.disk_cache.enable", Config::VFS_DISK_CACHE_ENABLE),
+    std::make_pair("vfs.disk_cache.dir", Config::VFS_DISK_CACHE_DIR),
+    std::make_pair("vfs.disk_cache.size", Config::VFS_DISK_CACHE_SIZE),
     std::make_pair(
         "vfs.file.posix_file_permissions",
         Config::VFS_FILE_POSIX_FILE_PERMISSIONS),
     std::make_pair(
         "vfs.file.posix_directory_permissions",
         Config::VFS_FILE_POSIX_DIRECTORY_PERMISSIONS),
+    std::make_pair(
+        "vfs.file.posix_use_mmap", Config::VFS_FILE_POSIX_USE_MMAP),
+    std::make_pair(
+        "vfs.file.posix_use_io_uring", Config::VFS_FILE_POSIX_USE_IO_URING),
+    std::make_pair(
+        "vfs.file.posix_direct_io", Config::VFS_FILE_POSIX_DIRECT_IO),
     std::make_pair("vfs.read_logging_mode", Config::VFS_READ_LOGGING_MODE),
     std::make_pair(
         "vfs.azure.storage_account_name",
@@ -408,6 +528,9 @@ const std::map<std::string, std::string> default_config_values = {
     std::make_pair(
         "vfs.azure.use_block_list_upload",
         Config::VFS_AZURE_USE_BLOCK_LIST_UPLOAD),
+    std::make_pair(
+        "vfs.azure.use_streaming_upload",
+        Config::VFS_AZURE_USE_STREAMING_UPLOAD),
     std::make_pair("vfs.azure.max_retries", Config::VFS_AZURE_MAX_RETRIES),
     std::make_pair(
         "vfs.azure.retry_delay_ms", Config::VFS_AZURE_RETRY_DELAY_MS),
@@ -420,6 +543,8 @@ const std::map<std::string, std::string> default_config_values = {
     std::make_pair("vfs.gcs.multi_part_size", Config::VFS_GCS_MULTI_PART_SIZE),
     std::make_pair(
         "vfs.gcs.use_multi_part_upload", Config::VFS_GCS_USE_MULTI_PART_UPLOAD),
+    std::make_pair(
+        "vfs.gcs.use_streaming_upload", Config::VFS_GCS_USE_STREAMING_UPLOAD),
     std::make_pair(
         "vfs.gcs.request_timeout_ms", Config::VFS_GCS_REQUEST_TIMEOUT_MS),
     std::make_pair(
@@ -443,6 +568,7 @@ const std::map<std::string, std::string> default_config_values = {
     std::make_pair(
         "vfs.s3.use_virtual_addressing", Config::VFS_S3_USE_VIRTUAL_ADDRESSING),
     std::make_pair("vfs.s3.skip_init", Config::VFS_S3_SKIP_INIT),
+    std::make_pair("vfs.s3.eager_init", Config::VFS_S3_EAGER_INIT),
     std::make_pair(
         "vfs.s3.use_multipart_upload", Config::VFS_S3_USE_MULTIPART_UPLOAD),
     std::make_pair("vfs.s3.max_parallel_ops", Config::VFS_S3_MAX_PARALLEL_OPS),
@@ -515,8 +641,30 @@ Config::Config() {
   param_values_ = default_config_values;
 }
 
+Config::Config(const Config& config)
+    : param_values_(config.param_values_)
+    , set_params_(config.set_params_) {
+  // Carry over the resolved values so that copies (e.g. one per query)
+  // do not re-resolve every parameter.
+  std::lock_guard<std::mutex> lock(config.resolved_values_mtx_);
+  resolved_values_ = config.resolved_values_;
+}
+
 Config::~Config() = default;
 
+Config& Config::operator=(const Config& config) {
+  if (this == &config) {
+    return *this;
+  }
+
+  param_values_ = config.param_values_;
+  set_params_ = config.set_params_;
+  std::scoped_lock lock(resolved_values_mtx_, config.resolved_values_mtx_);
+  resolved_values_ = config.resolved_values_;
+
+  return *this;
+}
+
 /* ****************************** */
 /*                API             */
 /* ****************************** */
@@ -569,6 +717,9 @@ Status Config::load_from_file(const std::string& filename) {
 
     linenum += 1;
   }
+
+  invalidate_resolved_values();
+
   return Status::Ok();
 }
 
@@ -597,6 +748,7 @@ Status Config::set(const std::string& param, const std::string& value) {
   RETURN_NOT_OK(sanity_check(param, value));
   param_values_[param] = value;
   set_params_.insert(param);
+  invalidate_resolved_values();
 
   return Status::Ok();
 }
@@ -663,6 +815,7 @@ Status Config::unset(const std::string& param) {
   } else {
     param_values_.erase(param);
   }
+  invalidate_resolved_values();
 
   return Status::Ok();
 }
@@ -727,6 +880,8 @@ Status Config::sanity_check(
     RETURN_NOT_OK(utils::parse::convert(value, &v));
   } else if (param == "sm.merge_overlapping_ranges_experimental") {
     RETURN_NOT_OK(utils::parse::convert(value, &v));
+  } else if (param == "sm.zstd_train_dictionaries") {
+    RETURN_NOT_OK(utils::parse::convert(value, &v));
   } else if (param == "sm.memory_budget") {
     RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
   } else if (param == "sm.memory_budget_var") {
@@ -737,6 +892,8 @@ Status Config::sanity_check(
     RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
   } else if (param == "sm.io_concurrency_level") {
     RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
+  } else if (param == "sm.numa.pin_threads") {
+    RETURN_NOT_OK(utils::parse::convert(value, &v));
   } else if (param == "sm.consolidation.amplification") {
     RETURN_NOT_OK(utils::parse::convert(value, &vf));
   } else if (param == "sm.consolidation.buffer_size") {
@@ -753,6 +910,8 @@ Status Config::sanity_check(
     RETURN_NOT_OK(utils::parse::convert(value, &v32));
   } else if (param == "sm.consolidation.step_size_ratio") {
     RETURN_NOT_OK(utils::parse::convert(value, &vf));
+  } else if (param == "sm.consolidation.min_interleave_ratio") {
+    RETURN_NOT_OK(utils::parse::convert(value, &vf));
   } else if (param == "sm.var_offsets.bitsize") {
     RETURN_NOT_OK(utils::parse::convert(value, &v32));
   } else if (param == "sm.var_offsets.extra_element") {
@@ -761,12 +920,18 @@ Status Config::sanity_check(
     if (value != "bytes" && value != "elements")
       return LOG_STATUS(
           Status_ConfigError("Invalid offsets format parameter value"));
+  } else if (param == "sm.validity.mode") {
+    if (value != "bytemap" && value != "bitmap")
+      return LOG_STATUS(
+          Status_ConfigError("Invalid validity format parameter value"));
   } else if (param == "sm.fragment_info.preload_mbrs") {
     RETURN_NOT_OK(utils::parse::convert(value, &v));
   } else if (param == "ssl.verify") {
     RETURN_NOT_OK(utils::parse::convert(value, &v));
   } else if (param == "vfs.min_parallel_size") {
     RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
+  } else if (param == "vfs.adaptive_parallel_ops") {
+    RETURN_NOT_OK(utils::parse::convert(value, &v));
   } else if (param == "vfs.max_batch_size") {
     RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
   } else if (param == "vfs.min_batch_gap") {
@@ -775,6 +940,8 @@ Status Config::sanity_check(
     RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
   } else if (param == "vfs.read_ahead_size") {
     RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
+  } else if (param == "vfs.read_ahead_max_size") {
+    RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
   } else if (param == "vfs.read_ahead_cache_size") {
     RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
   } else if (param == "vfs.file.posix_file_permissions") {
@@ -874,6 +1041,26 @@ const char* Config::get_from_config(
 
 const char* Config::get_from_config_or_env(
     const std::string& param, bool* found) const {
+  {
+    std::lock_guard<std::mutex> lock(resolved_values_mtx_);
+    auto it = resolved_values_.find(param);
+    if (it != resolved_values_.end()) {
+      *found = true;
+      return it->second.c_str();
+    }
+  }
+
+  const char* value = resolve_from_config_or_env(param, found);
+  if (!*found) {
+    return "";
+  }
+
+  std::lock_guard<std::mutex> lock(resolved_values_mtx_);
+  return resolved_values_.emplace(param, value).first->second.c_str();
+}
+
+const char* Config::resolve_from_config_or_env(
+    const std::string& param, bool* found) const {
   // First let's see if the User has set the parameter
   // If it is not a user set parameter it might be a default value if found in
   // the config
@@ -908,6 +1095,11 @@ const char* Config::get_from_config_or_env(
   return *found ? value_config : "";
 }
 
+void Config::invalidate_resolved_values() {
+  std::lock_guard<std::mutex> lock(resolved_values_mtx_);
+  resolved_values_.clear();
+}
+
 template <class T, bool must_find_>
 optional<T> Config::get_internal(const std::string& key) const {
   auto value = get_internal_string<must_find_>(key);
@@ -34,8 +34,10 @@
 #define TILEDB_CONFIG_H
 
 #include <map>
+#include <mutex>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "tiledb/common/status.h"
@@ -136,6 +138,14 @@ class Config {
   /** Allow updates or not. */
   static const std::string SM_ALLOW_UPDATES_EXPERIMENTAL;
 
+  /**
+   * If `true`, opening an array for reads loads the fragment metadata in
+   * the background over the I/O thread pool, and the open call returns as
+   * soon as the array schemas are loaded. The first access to the fragment
+   * metadata joins the load.
+   */
+  static const std::string SM_ARRAY_PREFETCH_FRAGMENT_METADATA;
+
   /**
    * The key for encrypted arrays.
    *  */
@@ -180,12 +190,86 @@ class Config {
    */
   static const std::string SM_MERGE_OVERLAPPING_RANGES_EXPERIMENTAL;
 
+  /**
+   * If `true`, writers sample written tiles, trial candidate filter
+   * pipelines on the samples and record the best pipeline per attribute in
+   * the array metadata. Advisory only; the pipelines used for the write are
+   * unaffected.
+   */
+  static const std::string SM_FILTER_PIPELINE_ADVISOR_ENABLE;
+
+  /**
+   * If `true`, writers of fields compressed with zstd train a shared
+   * compression dictionary from the written tiles, compress every tile
+   * with it and store it in the fragment metadata. Readers pick the
+   * dictionary up from the metadata without any configuration.
+   */
+  static const std::string SM_ZSTD_TRAIN_DICTIONARIES;
+
   /** If `true`, bypass partitioning on estimated result sizes. */
   static const std::string SM_SKIP_EST_SIZE_PARTITIONING;
 
   /** If `true`, bypass partitioning budget check for unary ranges. */
   static const std::string SM_SKIP_UNARY_PARTITIONING_BUDGET_CHECK;
 
+  /**
+   * The minimum number of tile chunks processed by one compute task when
+   * unfiltering a tile. Prevents over-splitting a tile's chunks across
+   * threads when the per-chunk work is small.
+   */
+  static const std::string SM_UNFILTER_MIN_CHUNKS_PER_TASK;
+
+  /**
+   * The size (in bytes) of the cache of unfiltered tiles shared by all
+   * queries on a context. A value of zero disables the cache.
+   */
+  static const std::string SM_TILE_CACHE_SIZE;
+
+  /**
+   * The size (in bytes) of the cache of fragment metadata footers shared
+   * by all array opens on a context. A value of zero disables the cache.
+   */
+  static const std::string SM_FRAGMENT_FOOTER_CACHE_SIZE;
+
+  /**
+   * The size (in bytes) of the cache of group details file contents
+   * shared by all group opens on a context. A value of zero disables the
+   * cache.
+   */
+  static const std::string SM_GROUP_DETAILS_CACHE_SIZE;
+
+  /**
+   * The size (in bytes) of the cache of loaded enumerations shared by
+   * all array opens on a context. A value of zero disables the cache.
+   */
+  static const std::string SM_ENUMERATION_CACHE_SIZE;
+
+  /**
+   * The size (in bytes) of the cache of materialized per-tile delete
+   * condition verdicts shared by all queries on a context. A value of
+   * zero disables the cache.
+   */
+  static const std::string SM_DELETION_VECTOR_CACHE_SIZE;
+
+  /**
+   * The size (in bytes) of the cache of array schema file contents
+   * shared by all array opens on a context. A value of zero disables
+   * the cache.
+   */
+  static const std::string SM_ARRAY_SCHEMA_CACHE_SIZE;
+
+  /**
+   * Share one deserialized `ArraySchema` instance between all opens of
+   * the same array on a context instead of a private copy per open.
+   */
+  static const std::string SM_ARRAY_SCHEMA_REGISTRY_ENABLE;
+
+  /**
+   * The size (in bytes) of the cache of read query results shared by all
+   * queries on a context. A value of zero disables the cache.
+   */
+  static const std::string SM_QUERY_RESULT_CACHE_SIZE;
+
   /**
    * The maximum memory budget for producing the result (in bytes)
    * for a fixed-sized attribute or the offsets of a var-sized attribute.
@@ -198,27 +282,106 @@ class Config {
    */
   static const std::string SM_MEMORY_BUDGET_VAR;
 
+  /**
+   * Number of attribute batches the sparse readers read ahead of the batch
+   * being copied to the user buffers, overlapping the batch I/O with the
+   * copy CPU work. Bounded by the reader memory budget; zero disables
+   * read ahead.
+   */
+  static const std::string SM_QUERY_ATTRIBUTE_PREFETCH_DEPTH;
+
   /** Set the dense reader in qc coords mode. */
   static const std::string SM_QUERY_DENSE_QC_COORDS_MODE;
 
   /** Which reader to use for dense queries. */
   static const std::string SM_QUERY_DENSE_READER;
 
+  /** Overlap tile filtering with I/O in global order writes. */
+  static const std::string SM_QUERY_GLOBAL_ORDER_WRITER_PIPELINED_IO;
+
+  /**
+   * The scheduling priority class of the query's I/O, "normal" or
+   * "background". Background I/O yields to normal I/O on the shared I/O
+   * thread pool, keeping a small weighted share so it cannot starve.
+   */
+  static const std::string SM_QUERY_PRIORITY;
+
+  /**
+   * Record execution profiles of completed read queries, keyed by array
+   * and subarray shape, and use them to pre-size the memory budget of
+   * later reads with the same shape.
+   */
+  static const std::string SM_QUERY_PROFILE_GUIDED_ENABLE;
+
+  /**
+   * Queries that take longer than this many milliseconds to submit have
+   * their query plan, subarray summary, fragment count and per-phase
+   * stats logged automatically. Zero disables the slow query log.
+   */
+  static const std::string SM_QUERY_SLOW_LOG_THRESHOLD_MS;
+
+  /**
+   * The file that slow query reports are appended to. When empty, the
+   * reports are written to the TileDB log.
+   */
+  static const std::string SM_QUERY_SLOW_LOG_FILE;
+
+  /**
+   * An upper limit, in cells, on how many result tile cells the sparse
+   * readers schedule for I/O ahead of what the user buffers can consume.
+   * Zero means no limit, in which case tile scheduling is bounded by the
+   * memory budget alone.
+   */
+  static const std::string SM_QUERY_SPARSE_RESULT_BUDGET_CELLS;
+
   /** Which reader to use for sparse global order queries. */
   static const std::string SM_QUERY_SPARSE_GLOBAL_ORDER_READER;
 
   /** Which reader to use for sparse unordered with dups queries. */
   static const std::string SM_QUERY_SPARSE_UNORDERED_WITH_DUPS_READER;
 
+  /**
+   * If `true`, the sparse unordered with dups reader copies each result tile
+   * to the user buffers in a single fused pass over all fixed-size fields, in
+   * tile completion order, instead of copying field by field. Only kicks in
+   * for queries without var-sized output fields or aggregates.
+   */
+  static const std::string
+      SM_QUERY_SPARSE_UNORDERED_WITH_DUPS_TILE_COMPLETION_ORDER;
+
+  /**
+   * If `true`, the sparse unordered with dups reader creates result tiles
+   * in small waves and copies each wave to the user buffers, releasing its
+   * memory, before reading the next one, instead of reading every tile the
+   * memory budget allows before any copy. Lowers peak memory and the time
+   * to the first cells for large scans.
+   */
+  static const std::string
+      SM_QUERY_SPARSE_UNORDERED_WITH_DUPS_STREAMING_EMISSION;
+
   /** Should malloc_trim be called on query/ctx destructors. */
   static const std::string SM_MEM_MALLOC_TRIM;
 
+  /**
+   * If `true`, large tile buffer allocations are advised to the kernel for
+   * transparent huge page backing, reducing TLB pressure in filtering and
+   * unfiltering. Process wide; Linux only.
+   */
+  static const std::string SM_MEM_HUGEPAGES;
+
   /** Maximum tile memory budget for readers. */
   static const std::string SM_UPPER_MEMORY_LIMIT;
 
   /** Maximum memory budget for readers and writers. */
   static const std::string SM_MEM_TOTAL_BUDGET;
 
+  /**
+   * Memory budget shared by everything running on a context. Queries
+   * throttle new tile reads when the combined usage would exceed it
+   * instead of failing. A value of zero means no limit.
+   */
+  static const std::string SM_MEM_CONTEXT_BUDGET;
+
   /** Ratio of the sparse global order reader budget used for coords. */
   static const std::string SM_MEM_SPARSE_GLOBAL_ORDER_RATIO_COORDS;
 
@@ -252,9 +415,44 @@ class Config {
   /** The maximum concurrency level for io-bound operations. */
   static const std::string SM_IO_CONCURRENCY_LEVEL;
 
+  /**
+   * If `true`, the compute and io thread pool workers are pinned to the CPUs
+   * of a single physical package each, so that tasks and the buffers they
+   * first touch stay local to one memory node. Linux only; ignored on other
+   * platforms.
+   */
+  static const std::string SM_NUMA_PIN_THREADS;
+
   /** If `true`, checksum validation will be skipped on reads. */
   static const std::string SM_SKIP_CHECKSUM_VALIDATION;
 
+  /**
+   * If `true`, checksum validation on reads is handed off to background
+   * tasks instead of running synchronously while unfiltering. A mismatch
+   * still fails the query before results are returned.
+   */
+  static const std::string SM_DEFERRED_CHECKSUM_VALIDATION;
+
+  /**
+   * If `true`, timer stats of queries submitted with this config are
+   * recorded as timestamped trace events.
+   */
+  static const std::string SM_STATS_TRACE_ENABLED;
+
+  /**
+   * If `true`, hot-path trace points record into an in-memory lock-free
+   * ring buffer with deferred formatting. The ring is dumped with slow
+   * query reports.
+   */
+  static const std::string SM_TRACE_RING_ENABLED;
+
+  /**
+   * The number of fragment commits to accumulate per array before making
+   * them visible with a single consolidated commits file. A value of one
+   * writes a commit file per fragment.
+   */
+  static const std::string SM_COMMIT_BATCH_SIZE;
+
   /**
    * The factor by which the size of the dense fragment resulting
    * from consolidating a set of fragments (containing at least one
@@ -291,6 +489,16 @@ class Config {
    */
   static const std::string SM_CONSOLIDATION_STEP_SIZE_RATIO;
 
+  /**
+   * **Experimental** <br>
+   * Minimum ratio of tiles that must interleave with another fragment for a
+   * set of sparse fragments to be considered for consolidation in a step.
+   * A tile interleaves if its R-tree MBR overlaps the non-empty domain of
+   * another fragment in the set. This should be a value in [0.0, 1.0].
+   * 0.0 (the default) disables the check.
+   */
+  static const std::string SM_CONSOLIDATION_MIN_INTERLEAVE_RATIO;
+
   /**
    * The consolidation mode. It can be one of:
    *     - "fragments": only the fragments will be consolidated
@@ -349,6 +557,15 @@ class Config {
    */
   static const std::string SM_OFFSETS_FORMAT_MODE;
 
+  /**
+   * The format mode used to return validity buffers of nullable attributes
+   * for read queries. It can be one of:
+   *    - "bytemap": one byte per cell, non-zero meaning valid
+   *    - "bitmap": packed bits, LSB first, matching the Arrow validity
+   *      bitmap layout
+   */
+  static const std::string SM_VALIDITY_FORMAT_MODE;
+
   /**
    * The maximum estimated size of the internal tile overlap structure.
    */
@@ -392,6 +609,13 @@ class Config {
   /** The default minimum number of bytes in a parallel VFS operation. */
   static const std::string VFS_MIN_PARALLEL_SIZE;
 
+  /**
+   * If `true`, the number of parallel operations a remote-backend VFS read
+   * is split into is tuned at runtime from observed read throughput,
+   * instead of always using the configured per-backend maximum.
+   */
+  static const std::string VFS_ADAPTIVE_PARALLEL_OPS;
+
   /** The default maximum number of bytes in a batched VFS read operation. */
   static const std::string VFS_MAX_BATCH_SIZE;
 
@@ -409,12 +633,50 @@ class Config {
   /** The default posix permissions for directory creations */
   static const std::string VFS_FILE_POSIX_DIRECTORY_PERMISSIONS;
 
+  /**
+   * If `true`, posix reads are served from cached read-only mmap regions
+   * instead of issuing an open/pread/close per read.
+   */
+  static const std::string VFS_FILE_POSIX_USE_MMAP;
+
+  /**
+   * If `true`, batched posix reads are submitted through io_uring instead
+   * of one blocking pread per region. Silently ignored when the kernel
+   * has no io_uring support.
+   */
+  static const std::string VFS_FILE_POSIX_USE_IO_URING;
+
+  /**
+   * If `true`, posix reads and writes bypass the OS page cache with
+   * `O_DIRECT`. Unaligned leading and trailing portions of an I/O are
+   * transferred through the page cache as usual.
+   */
+  static const std::string VFS_FILE_POSIX_DIRECT_IO;
+
   /** The maximum size (in bytes) to read-ahead in the VFS. */
   static const std::string VFS_READ_AHEAD_SIZE;
 
+  /**
+   * The maximum size (in bytes) the adaptive read-ahead window may grow to
+   * for sequentially accessed files.
+   */
+  static const std::string VFS_READ_AHEAD_MAX_SIZE;
+
   /** The maximum size (in bytes) of the VFS read-ahead cache . */
   static const std::string VFS_READ_AHEAD_CACHE_SIZE;
 
+  /**
+   * If `true`, blocks read from remote backends are spilled to a
+   * persistent local disk cache and served from it on repeated reads.
+   */
+  static const std::string VFS_DISK_CACHE_ENABLE;
+
+  /** The local directory the disk cache stores its block files in. */
+  static const std::string VFS_DISK_CACHE_DIR;
+
+  /** The maximum size (in bytes) of the VFS disk cache. */
+  static const std::string VFS_DISK_CACHE_SIZE;
+
   /** The type of read logging to perform in the VFS. */
   static const std::string VFS_READ_LOGGING_MODE;
 
@@ -439,6 +701,9 @@ class Config {
   /** Azure use block list upload. */
   static const std::string VFS_AZURE_USE_BLOCK_LIST_UPLOAD;
 
+  /** Azure use streaming upload. */
+  static const std::string VFS_AZURE_USE_STREAMING_UPLOAD;
+
   /** Azure max retries. */
   static const std::string VFS_AZURE_MAX_RETRIES;
 
@@ -463,6 +728,9 @@ class Config {
   /** GCS use multi part upload. */
   static const std::string VFS_GCS_USE_MULTI_PART_UPLOAD;
 
+  /** GCS use streaming upload. */
+  static const std::string VFS_GCS_USE_STREAMING_UPLOAD;
+
   /** GCS request timeout in milliseconds. */
   static const std::string VFS_GCS_REQUEST_TIMEOUT_MS;
 
@@ -505,6 +773,9 @@ class Config {
   /** S3 skip init. */
   static const std::string VFS_S3_SKIP_INIT;
 
+  /** S3 eager client initialization at context creation. */
+  static const std::string VFS_S3_EAGER_INIT;
+
   /** Use virtual addressing (true). */
   static const std::string VFS_S3_USE_MULTIPART_UPLOAD;
 
@@ -613,9 +884,15 @@ class Config {
   /** Constructor. */
   Config();
 
+  /** Copy constructor. */
+  Config(const Config& config);
+
   /** Destructor. */
   ~Config();
 
+  /** Copy-assignment operator. */
+  Config& operator=(const Config& config);
+
   /* ********************************* */
   /*                API                */
   /* ********************************* */
@@ -708,6 +985,20 @@ class Config {
   /** Stores the parameters set by the user. */
   std::set<std::string> set_params_;
 
+  /**
+   * Caches fully resolved parameter values, i.e. the result of looking
+   * through user-set values, environment variables and defaults. Resolving
+   * a parameter builds an environment variable name and calls `getenv`,
+   * which is costly when parameters are fetched on every query; a cached
+   * parameter costs a single hash lookup. The cache is invalidated by any
+   * mutation of the config, so changes to environment variables take
+   * effect only until a parameter is first resolved.
+   */
+  mutable std::unordered_map<std::string, std::string> resolved_values_;
+
+  /** Protects `resolved_values_`. */
+  mutable std::mutex resolved_values_mtx_;
+
   /* ********************************* */
   /*          PRIVATE CONSTANTS        */
   /* ********************************* */
@@ -761,6 +1052,9 @@ class Config {
    * 2. env variables
    * 3. default config value
    *
+   * Found values are cached in `resolved_values_`, so only the first
+   * lookup of a parameter pays for the environment variable resolution.
+   *
    * @param param parameter to fetch
    * @param found pointer to bool to set if parameter was found or not
    * @return parameter value if found or empty string if not
@@ -768,6 +1062,21 @@ class Config {
   const char* get_from_config_or_env(
       const std::string& param, bool* found) const;
 
+  /**
+   * Resolves a parameter from the config object or environmental
+   * variables, bypassing `resolved_values_`. Used by
+   * `get_from_config_or_env` to fill the cache on a miss.
+   *
+   * @param param parameter to fetch
+   * @param found pointer to bool to set if parameter was found or not
+   * @return parameter value if found or empty string if not
+   */
+  const char* resolve_from_config_or_env(
+      const std::string& param, bool* found) const;
+
+  /** Empties `resolved_values_`. Called on every mutation of the config. */
+  void invalidate_resolved_values();
+
   template <class T, bool must_find_>
   optional<T> get_internal(const std::string& key) const;
 
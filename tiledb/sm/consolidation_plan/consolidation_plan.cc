@@ -33,6 +33,10 @@
 #include "tiledb/sm/consolidation_plan/consolidation_plan.h"
 #include "tiledb/common/common.h"
 #include "tiledb/common/logger.h"
+#include "tiledb/common/unreachable.h"
+
+#include <algorithm>
+#include <numeric>
 
 using namespace tiledb::sm;
 using namespace tiledb::common;
@@ -53,6 +57,45 @@ ConsolidationPlan::~ConsolidationPlan() = default;
 /*                API                */
 /* ********************************* */
 
+uint64_t ConsolidationPlan::get_node_shard(
+    uint64_t num_shards, uint64_t node_idx) const {
+  if (num_shards == 0) {
+    throw ConsolidationPlanStatusException(
+        "Number of shards must be greater than zero");
+  }
+
+  if (node_idx == std::numeric_limits<uint64_t>::max() ||
+      node_idx + 1 > num_nodes_) {
+    throw ConsolidationPlanStatusException(
+        "Trying to access a node that doesn't exists");
+  }
+
+  // Assign nodes to shards with a longest-processing-time heuristic:
+  // process nodes from largest to smallest, always assigning to the least
+  // loaded shard. Ties are broken on the node index so that the
+  // assignment is deterministic across processes.
+  std::vector<uint64_t> nodes(num_nodes_);
+  std::iota(nodes.begin(), nodes.end(), 0);
+  std::sort(nodes.begin(), nodes.end(), [&](uint64_t a, uint64_t b) {
+    return node_sizes_[a] != node_sizes_[b] ? node_sizes_[a] > node_sizes_[b] :
+                                              a < b;
+  });
+
+  std::vector<storage_size_t> shard_sizes(num_shards, 0);
+  for (auto n : nodes) {
+    auto shard = std::distance(
+        shard_sizes.begin(),
+        std::min_element(shard_sizes.begin(), shard_sizes.end()));
+    if (n == node_idx) {
+      return shard;
+    }
+
+    shard_sizes[shard] += node_sizes_[n];
+  }
+
+  stdx::unreachable();
+}
+
 std::string ConsolidationPlan::dump() const {
   std::string ret = "{\n  \"nodes\": [\n";
   for (uint64_t n = 0; n < fragment_uris_per_node_.size(); n++) {
@@ -193,7 +236,10 @@ void ConsolidationPlan::generate(shared_ptr<Array> array) {
   num_nodes_ = plan.size();
   fragment_uris_per_node_.reserve(num_nodes_);
 
+  node_sizes_.reserve(num_nodes_);
+
   for (auto& node : plan) {
     fragment_uris_per_node_.emplace_back(node.uris());
+    node_sizes_.emplace_back(node.size());
   }
 }
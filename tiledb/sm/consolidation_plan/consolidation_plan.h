@@ -117,6 +117,20 @@ class ConsolidationPlan {
     return fragment_uris_per_node_[node_idx][fragment_idx].c_str();
   }
 
+  /**
+   * Get the shard a node belongs to, when the plan is partitioned into
+   * `num_shards` shards. Nodes never share fragments, so the nodes of
+   * different shards can be consolidated concurrently by separate
+   * processes. The assignment is deterministic, so every process computes
+   * the same partitioning from the same plan.
+   *
+   * @param num_shards Number of shards the plan is partitioned into.
+   * @param node_idx Index of the node.
+   * @return Index of the shard the node belongs to, in
+   *     `[0, num_shards - 1]`.
+   */
+  uint64_t get_node_shard(uint64_t num_shards, uint64_t node_idx) const;
+
   /** @return the consolidation plan in JSON format. */
   std::string dump() const;
 
@@ -229,6 +243,9 @@ class ConsolidationPlan {
   /** Fragment uris, per node. */
   std::vector<std::vector<std::string>> fragment_uris_per_node_;
 
+  /** Sum of fragment sizes, per node, used to balance shards. */
+  std::vector<storage_size_t> node_sizes_;
+
   /** Desired fragment size, in bytes. */
   storage_size_t desired_fragment_size_;
 
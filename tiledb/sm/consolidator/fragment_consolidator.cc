@@ -36,6 +36,7 @@
 #include "tiledb/sm/enums/datatype.h"
 #include "tiledb/sm/enums/query_status.h"
 #include "tiledb/sm/enums/query_type.h"
+#include "tiledb/sm/fragment/fragment_metadata.h"
 #include "tiledb/sm/misc/tdb_time.h"
 #include "tiledb/sm/query/query.h"
 #include "tiledb/sm/stats/global_stats.h"
@@ -43,6 +44,7 @@
 #include "tiledb/storage_format/uri/generate_uri.h"
 #include "tiledb/storage_format/uri/parse_uri.h"
 
+#include <algorithm>
 #include <iostream>
 #include <numeric>
 #include <sstream>
@@ -133,6 +135,7 @@ Status FragmentConsolidator::consolidate(
     NDRange union_non_empty_domains;
     st = compute_next_to_consolidate(
         array_for_reads->array_schema_latest(),
+        array_for_reads->get_encryption_key(),
         fragment_info,
         &to_consolidate,
         &union_non_empty_domains);
@@ -364,6 +367,37 @@ bool FragmentConsolidator::are_consolidatable(
   return (double(union_cell_num) / sum_cell_num) <= config_.amplification_;
 }
 
+double FragmentConsolidator::compute_interleave_ratio(
+    const Domain& domain,
+    const EncryptionKey& encryption_key,
+    const FragmentInfo& fragment_info,
+    size_t start,
+    size_t end) const {
+  const auto& fragments = fragment_info.single_fragment_info_vec();
+
+  uint64_t tile_num = 0;
+  uint64_t interleaved_tile_num = 0;
+  for (size_t f = start; f <= end; ++f) {
+    if (!fragments[f].sparse()) {
+      continue;
+    }
+
+    auto meta = fragments[f].meta();
+    meta->load_rtree(encryption_key);
+    for (const auto& mbr : meta->mbrs()) {
+      tile_num++;
+      for (size_t f2 = start; f2 <= end; ++f2) {
+        if (f2 != f && domain.overlap(mbr, fragments[f2].non_empty_domain())) {
+          interleaved_tile_num++;
+          break;
+        }
+      }
+    }
+  }
+
+  return tile_num == 0 ? 1.0 : double(interleaved_tile_num) / tile_num;
+}
+
 Status FragmentConsolidator::consolidate_internal(
     shared_ptr<Array> array_for_reads,
     shared_ptr<Array> array_for_writes,
@@ -410,6 +444,14 @@ Status FragmentConsolidator::consolidate_internal(
     }
   }
 
+  // Fragments that do not interleave can be consolidated by
+  // concatenating their tiles and merging their metadata, without
+  // round-tripping every cell through a read/write query pair.
+  if (can_consolidate_passthrough(array_for_reads)) {
+    return consolidate_passthrough(
+        array_for_reads, to_consolidate, new_fragment_uri);
+  }
+
   // Prepare buffers
   auto average_var_cell_sizes = array_for_reads->get_average_var_cell_sizes();
   auto&& [buffers, buffer_sizes] =
@@ -488,6 +530,353 @@ Status FragmentConsolidator::consolidate_internal(
   return st;
 }
 
+/**
+ * Copies the per-tile metadata of a source fragment into the merged
+ * metadata buffers of a consolidated fragment. The buffers hold a
+ * fixed number of entries per tile, so the copy offset follows from
+ * the destination tile count. Buffers that are inapplicable to a
+ * dimension/attribute are left empty by `set_num_tiles` and skipped.
+ */
+template <class T>
+static void append_tile_metadata(
+    const std::vector<std::vector<T>>& src,
+    std::vector<std::vector<T>>& dest,
+    uint64_t dest_tile_num,
+    uint64_t tile_base) {
+  for (size_t i = 0; i < dest.size(); ++i) {
+    if (src[i].empty() || dest[i].empty()) {
+      continue;
+    }
+
+    auto per_tile = dest[i].size() / dest_tile_num;
+    std::copy(
+        src[i].begin(), src[i].end(), dest[i].begin() + tile_base * per_tile);
+  }
+}
+
+bool FragmentConsolidator::can_consolidate_passthrough(
+    shared_ptr<Array> array_for_reads) const {
+  const auto& array_schema = array_for_reads->array_schema_latest();
+  auto& domain{array_schema.domain()};
+  auto dim_num = array_schema.dim_num();
+
+  // Dense consolidation fills in empty cells, it always needs queries.
+  if (array_schema.dense()) {
+    return false;
+  }
+
+  // Without duplicates the global order reader deduplicates overlapping
+  // cells, which a byte copy cannot do.
+  if (!array_schema.allows_dups()) {
+    return false;
+  }
+
+  // The MBR-based global order check below is inapplicable to the
+  // Hilbert cell order.
+  if (array_schema.cell_order() == Layout::HILBERT) {
+    return false;
+  }
+
+  // Delete conditions must either be applied or be recorded as delete
+  // metadata, both of which require queries.
+  if (config_.with_delete_meta_ || !array_for_reads->array_directory()
+                                        .delete_and_update_tiles_location()
+                                        .empty()) {
+    return false;
+  }
+
+  // Rebasing the tile metadata requires fixed-sized dimensions and
+  // attributes.
+  for (unsigned d = 0; d < dim_num; ++d) {
+    if (domain.dimension_ptr(d)->var_size()) {
+      return false;
+    }
+  }
+  for (const auto& attr : array_schema.attributes()) {
+    if (attr->var_size()) {
+      return false;
+    }
+  }
+
+  auto frag_md = array_for_reads->fragment_metadata();
+  const auto write_version = array_schema.write_version();
+  const auto capacity = array_schema.capacity();
+  for (uint64_t f = 0; f < frag_md.size(); ++f) {
+    // The tile and metadata formats must match the fragment to be
+    // written exactly.
+    if (frag_md[f]->format_version() != write_version ||
+        frag_md[f]->array_schema_name() != array_schema.name() ||
+        frag_md[f]->has_timestamps() != config_.with_timestamps_ ||
+        frag_md[f]->has_delete_meta()) {
+      return false;
+    }
+
+    // Readers assume that all tiles but the very last one contain
+    // exactly `capacity` cells.
+    if (f != frag_md.size() - 1 &&
+        frag_md[f]->last_tile_cell_num() != capacity) {
+      return false;
+    }
+  }
+
+  // Trained compression dictionaries are per fragment; concatenated
+  // tiles would decompress with the wrong dictionary.
+  const auto& encryption_key = array_for_reads->get_encryption_key();
+  for (auto& f : frag_md) {
+    f->load_zstd_dictionaries(encryption_key);
+    for (unsigned d = 0; d < dim_num; ++d) {
+      if (f->has_zstd_dictionary(domain.dimension_ptr(d)->name())) {
+        return false;
+      }
+    }
+    for (const auto& attr : array_schema.attributes()) {
+      if (f->has_zstd_dictionary(attr->name())) {
+        return false;
+      }
+    }
+  }
+
+  // Every tile of a fragment must precede every tile of the next
+  // fragment in the global order. Tiles within a sparse fragment are
+  // already in global order, so it suffices to compare the last MBR of
+  // each fragment with the first MBR of the next one on the tile order.
+  auto tile_order = array_schema.tile_order();
+  for (uint64_t f = 0; f + 1 < frag_md.size(); ++f) {
+    frag_md[f]->load_rtree(encryption_key);
+    frag_md[f + 1]->load_rtree(encryption_key);
+    const auto& last_mbr = frag_md[f]->mbrs().back();
+    const auto& first_mbr = frag_md[f + 1]->mbrs().front();
+    int cmp = 0;
+    for (unsigned i = 0; i < dim_num && cmp == 0; ++i) {
+      auto d = (tile_order == Layout::COL_MAJOR) ? dim_num - i - 1 : i;
+      cmp = domain.tile_order_cmp(
+          d, last_mbr[d].end_fixed(), first_mbr[d].start_fixed());
+    }
+
+    // `cmp == 0` means the two tiles may share a space tile, in which
+    // case their cells can interleave in the cell order.
+    if (cmp >= 0) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+Status FragmentConsolidator::consolidate_passthrough(
+    shared_ptr<Array> array_for_reads,
+    const std::vector<TimestampedURI>& to_consolidate,
+    URI* new_fragment_uri) {
+  auto timer_se = stats_->start_timer("consolidate_passthrough");
+
+  const auto& array_schema = array_for_reads->array_schema_latest();
+  auto& domain{array_schema.domain()};
+  auto dim_num = array_schema.dim_num();
+  auto frag_md = array_for_reads->fragment_metadata();
+  const auto& encryption_key = array_for_reads->get_encryption_key();
+  const auto& array_dir = array_for_reads->array_directory();
+  auto vfs = storage_manager_->vfs();
+  auto write_version = array_schema.write_version();
+
+  // The new fragment is named after the first and last fragments to
+  // consolidate, as in `create_queries`.
+  auto fragment_name = storage_format::generate_consolidated_fragment_name(
+      frag_md.front()->fragment_uri(),
+      frag_md.back()->fragment_uri(),
+      write_version);
+  auto frag_dir_uri = array_dir.get_fragments_dir(write_version);
+  *new_fragment_uri = frag_dir_uri.join_path(fragment_name);
+
+  // Get the vacuum URI
+  URI vac_uri;
+  try {
+    vac_uri = array_dir.get_vacuum_uri(*new_fragment_uri);
+  } catch (std::exception& e) {
+    std::throw_with_nested(
+        std::logic_error("[FragmentConsolidator::consolidate_passthrough] "));
+  }
+
+  // The names of the dimensions/attributes whose files will be
+  // concatenated and whose tile metadata will be merged.
+  std::vector<std::string> names;
+  names.reserve(dim_num + array_schema.attribute_num() + 1);
+  for (unsigned d = 0; d < dim_num; ++d) {
+    names.emplace_back(domain.dimension_ptr(d)->name());
+  }
+  for (const auto& attr : array_schema.attributes()) {
+    names.emplace_back(attr->name());
+  }
+  if (config_.with_timestamps_) {
+    names.emplace_back(constants::timestamps);
+  }
+
+  // Load the tile metadata of the fragments to consolidate.
+  uint64_t total_tile_num = 0;
+  for (auto& f : frag_md) {
+    f->load_rtree(encryption_key);
+    f->load_tile_offsets(encryption_key, names);
+    f->load_tile_min_values(encryption_key, names);
+    f->load_tile_max_values(encryption_key, names);
+    f->load_tile_sum_values(encryption_key, names);
+    f->load_tile_null_count_values(encryption_key, names);
+    f->load_tile_bloom_filter_values(encryption_key, names);
+    total_tile_num += f->tile_num();
+  }
+
+  // Create the directories of the new fragment.
+  RETURN_NOT_OK(vfs->create_dir(frag_dir_uri));
+  RETURN_NOT_OK(vfs->create_dir(*new_fragment_uri));
+  RETURN_NOT_OK(vfs->create_dir(array_dir.get_commits_dir(write_version)));
+
+  // Create the metadata of the new fragment. The source fragments have
+  // the same array schema and fragment flags as the new fragment, so
+  // all the tile metadata buffer indices below coincide.
+  std::pair<uint64_t, uint64_t> timestamp_range{
+      frag_md.front()->timestamp_range().first,
+      frag_md.back()->timestamp_range().second};
+  auto new_meta = make_shared<FragmentMetadata>(
+      HERE(),
+      &storage_manager_->resources(),
+      nullptr,
+      array_for_reads->array_schema_latest_ptr(),
+      *new_fragment_uri,
+      timestamp_range,
+      false,
+      config_.with_timestamps_,
+      false);
+  new_meta->init(domain.domain());
+  new_meta->set_num_tiles(total_tile_num);
+
+  // Merge the tile metadata, rebasing the tile offsets to the
+  // concatenated files.
+  uint64_t tile_base = 0;
+  for (auto& f : frag_md) {
+    auto tile_num = f->tile_num();
+
+    // Setting the MBRs also expands the new non-empty domain.
+    const auto& mbrs = f->mbrs();
+    for (uint64_t t = 0; t < tile_num; ++t) {
+      new_meta->set_mbr(tile_base + t, mbrs[t]);
+    }
+
+    // The tiles of a fragment are laid out contiguously in its files,
+    // so setting the offsets through the persisted tile sizes yields
+    // the source offsets shifted by the preceding file sizes.
+    for (const auto& name : names) {
+      for (uint64_t t = 0; t < tile_num; ++t) {
+        new_meta->set_tile_offset(
+            name, tile_base + t, f->persisted_tile_size(name, t));
+      }
+      if (array_schema.is_nullable(name)) {
+        for (uint64_t t = 0; t < tile_num; ++t) {
+          new_meta->set_tile_validity_offset(
+              name, tile_base + t, f->persisted_tile_validity_size(name, t));
+        }
+      }
+    }
+
+    append_tile_metadata(
+        f->tile_min_buffer(),
+        new_meta->tile_min_buffer(),
+        total_tile_num,
+        tile_base);
+    append_tile_metadata(
+        f->tile_max_buffer(),
+        new_meta->tile_max_buffer(),
+        total_tile_num,
+        tile_base);
+    append_tile_metadata(
+        f->tile_sums(), new_meta->tile_sums(), total_tile_num, tile_base);
+    append_tile_metadata(
+        f->tile_null_counts(),
+        new_meta->tile_null_counts(),
+        total_tile_num,
+        tile_base);
+    append_tile_metadata(
+        f->tile_bloom_filters(),
+        new_meta->tile_bloom_filters(),
+        total_tile_num,
+        tile_base);
+
+    tile_base += tile_num;
+  }
+  new_meta->set_last_tile_cell_num(frag_md.back()->last_tile_cell_num());
+
+  // Concatenate the tile data files. Remote objects cannot be appended
+  // to, so the bytes are streamed through a bounded buffer.
+  std::vector<std::pair<URI, std::vector<URI>>> files;
+  files.reserve(2 * names.size());
+  for (const auto& name : names) {
+    std::vector<URI> src_uris;
+    src_uris.reserve(frag_md.size());
+    for (auto& f : frag_md) {
+      src_uris.emplace_back(f->uri(name));
+    }
+    files.emplace_back(new_meta->uri(name), std::move(src_uris));
+
+    if (array_schema.is_nullable(name)) {
+      std::vector<URI> src_validity_uris;
+      src_validity_uris.reserve(frag_md.size());
+      for (auto& f : frag_md) {
+        src_validity_uris.emplace_back(f->validity_uri(name));
+      }
+      files.emplace_back(
+          new_meta->validity_uri(name), std::move(src_validity_uris));
+    }
+  }
+
+  auto st = parallel_for(
+      storage_manager_->compute_tp(), 0, files.size(), [&](size_t i) {
+        const auto& [dest_uri, src_uris] = files[i];
+        std::vector<uint8_t> buffer(config_.buffer_size_);
+        for (const auto& src_uri : src_uris) {
+          uint64_t src_size = 0;
+          RETURN_NOT_OK(vfs->file_size(src_uri, &src_size));
+          uint64_t offset = 0;
+          while (offset < src_size) {
+            auto nbytes = std::min<uint64_t>(buffer.size(), src_size - offset);
+            RETURN_NOT_OK(vfs->read(src_uri, offset, buffer.data(), nbytes));
+            RETURN_NOT_OK(vfs->write(dest_uri, buffer.data(), nbytes));
+            offset += nbytes;
+          }
+        }
+        RETURN_NOT_OK(vfs->close_file(dest_uri));
+        return Status::Ok();
+      });
+  if (!st.ok()) {
+    bool is_dir = false;
+    throw_if_not_ok(vfs->is_dir(*new_fragment_uri, &is_dir));
+    if (is_dir) {
+      throw_if_not_ok(vfs->remove_dir(*new_fragment_uri));
+    }
+    return st;
+  }
+
+  // Compute the fragment min/max/sum/null count from the merged tile
+  // metadata and store the metadata of the new fragment.
+  new_meta->compute_fragment_min_max_sum_null_count();
+  new_meta->store(encryption_key);
+
+  // The following will make the new fragment visible.
+  RETURN_NOT_OK(vfs->touch(array_dir.get_commit_uri(*new_fragment_uri)));
+
+  // Write vacuum file
+  st = write_vacuum_file(
+      write_version, array_for_reads->array_uri(), vac_uri, to_consolidate);
+  if (!st.ok()) {
+    bool is_dir = false;
+    throw_if_not_ok(vfs->is_dir(*new_fragment_uri, &is_dir));
+    if (is_dir) {
+      throw_if_not_ok(vfs->remove_dir(*new_fragment_uri));
+    }
+    return st;
+  }
+
+  stats_->add_counter("consolidate_passthrough_num", 1);
+
+  return Status::Ok();
+}
+
 Status FragmentConsolidator::copy_array(
     Query* query_r,
     Query* query_w,
@@ -682,6 +1071,7 @@ Status FragmentConsolidator::create_queries(
 
 Status FragmentConsolidator::compute_next_to_consolidate(
     const ArraySchema& array_schema,
+    const EncryptionKey& encryption_key,
     const FragmentInfo& fragment_info,
     std::vector<TimestampedURI>* to_consolidate,
     NDRange* union_non_empty_domains) const {
@@ -751,6 +1141,17 @@ Status FragmentConsolidator::compute_next_to_consolidate(
             m_union[i][j].clear();
             m_union[i][j].shrink_to_fit();
           }
+          if (sparse && config_.min_interleave_ratio_ > 0.0f &&
+              m_sizes[i][j] != UINT64_MAX &&
+              compute_interleave_ratio(
+                  domain, encryption_key, fragment_info, j, j + i) <
+                  config_.min_interleave_ratio_) {
+            // Mark this entry as invalid, the fragments barely interleave
+            // and consolidating them would mostly rewrite tiles in place.
+            m_sizes[i][j] = UINT64_MAX;
+            m_union[i][j].clear();
+            m_union[i][j].shrink_to_fit();
+          }
         } else {
           // Mark this entry as invalid
           m_sizes[i][j] = UINT64_MAX;
@@ -909,6 +1310,12 @@ Status FragmentConsolidator::set_config(const Config& config) {
   RETURN_NOT_OK(merged_config.get<float>(
       "sm.consolidation.step_size_ratio", &config_.size_ratio_, &found));
   assert(found);
+  config_.min_interleave_ratio_ = 0.0f;
+  RETURN_NOT_OK(merged_config.get<float>(
+      "sm.consolidation.min_interleave_ratio",
+      &config_.min_interleave_ratio_,
+      &found));
+  assert(found);
   config_.purge_deleted_cells_ = false;
   RETURN_NOT_OK(merged_config.get<bool>(
       "sm.consolidation.purge_deleted_cells",
@@ -945,6 +1352,11 @@ Status FragmentConsolidator::set_config(const Config& config) {
     return logger_->status(Status_ConsolidatorError(
         "Invalid configuration; Step size ratio config parameter must be in "
         "[0.0, 1.0]"));
+  if (config_.min_interleave_ratio_ > 1.0f ||
+      config_.min_interleave_ratio_ < 0.0f)
+    return logger_->status(Status_ConsolidatorError(
+        "Invalid configuration; Minimum interleave ratio config parameter "
+        "must be in [0.0, 1.0]"));
   if (config_.amplification_ < 0)
     return logger_->status(
         Status_ConsolidatorError("Invalid configuration; Amplification config "
@@ -170,6 +170,12 @@ class FragmentConsolidator : public Consolidator {
      * consolidation.
      */
     float size_ratio_;
+    /**
+     * Minimum ratio of tiles that must interleave with another fragment
+     * for a set of sparse fragments to be considered for consolidation.
+     * 0.0 disables the check.
+     */
+    float min_interleave_ratio_;
     /** Is the refactored reader in use or not */
     bool use_refactored_reader_;
     /** Purge deleted cells or not. */
@@ -208,6 +214,30 @@ class FragmentConsolidator : public Consolidator {
       size_t end,
       const NDRange& union_non_empty_domains) const;
 
+  /**
+   * Computes the ratio of tiles of the sparse fragments between `start`
+   * and `end` (inclusive) that interleave with another fragment in the
+   * set. A tile interleaves if its R-tree MBR overlaps the non-empty
+   * domain of another fragment, i.e. consolidating the set will actually
+   * merge that tile with data from other fragments rather than just
+   * rewrite it.
+   *
+   * @param domain The array domain.
+   * @param encryption_key The encryption key to load the R-trees with.
+   * @param fragment_info The input fragment info.
+   * @param start The function will focus on fragments between
+   *     positions `start` and `end`.
+   * @param end The function will focus on fragments between
+   *     positions `start` and `end`.
+   * @return Ratio of interleaving tiles, in [0.0, 1.0].
+   */
+  double compute_interleave_ratio(
+      const Domain& domain,
+      const EncryptionKey& encryption_key,
+      const FragmentInfo& fragment_info,
+      size_t start,
+      size_t end) const;
+
   /**
    * Consolidates the input fragments of the input array. This function
    * implements a single consolidation step.
@@ -230,6 +260,42 @@ class FragmentConsolidator : public Consolidator {
       const NDRange& union_non_empty_domains,
       URI* new_fragment_uri);
 
+  /**
+   * Returns `true` if the fragments loaded in `array_for_reads` can be
+   * consolidated by concatenating their tiles as-is and merging only
+   * their fragment metadata, without reading back any cells. This is
+   * the case for sparse fragments with duplicates allowed, fixed-sized
+   * dimensions and attributes, no delete metadata and no trained
+   * compression dictionaries, whose tiles are full (except the last
+   * one) and follow each other in the global order, i.e. the typical
+   * time-partitioned append-only workload.
+   *
+   * @param array_for_reads Array opened with the fragments to
+   *     consolidate loaded.
+   * @return `True` if the fragments can be consolidated with
+   *     `consolidate_passthrough`.
+   */
+  bool can_consolidate_passthrough(shared_ptr<Array> array_for_reads) const;
+
+  /**
+   * Consolidates the fragments loaded in `array_for_reads` by copying
+   * their filtered tile bytes directly between VFS files and merging
+   * their fragment metadata. The tiles are neither unfiltered nor
+   * re-sorted, so consolidation proceeds at I/O speed. Applicable only
+   * when `can_consolidate_passthrough` returns `true`.
+   *
+   * @param array_for_reads Array opened with the fragments to
+   *     consolidate loaded.
+   * @param to_consolidate The fragments to consolidate.
+   * @param new_fragment_uri The URI of the fragment created after
+   *     consolidating the `to_consolidate` fragments.
+   * @return Status
+   */
+  Status consolidate_passthrough(
+      shared_ptr<Array> array_for_reads,
+      const std::vector<TimestampedURI>& to_consolidate,
+      URI* new_fragment_uri);
+
   /**
    * Copies the array by reading from the fragments to be consolidated
    * with `query_r` and writing to the new fragment with `query_w`.
@@ -291,6 +357,7 @@ class FragmentConsolidator : public Consolidator {
    * of fragments to be consolidated in the next consolidation step.
    *
    * @param array_schema The array schema.
+   * @param encryption_key The encryption key of the array.
    * @param fragment_info Information about all the fragments.
    * @param to_consolidate The fragments to consolidate in the next step.
    * @param union_non_empty_domains The function will return here the
@@ -299,6 +366,7 @@ class FragmentConsolidator : public Consolidator {
    */
   Status compute_next_to_consolidate(
       const ArraySchema& array_schema,
+      const EncryptionKey& encryption_key,
       const FragmentInfo& fragment_info,
       std::vector<TimestampedURI>* to_consolidate,
       NDRange* union_non_empty_domains) const;
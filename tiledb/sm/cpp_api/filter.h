@@ -294,6 +294,8 @@ class Filter {
         return "CHECKSUM_MD5";
       case TILEDB_FILTER_CHECKSUM_SHA256:
         return "CHECKSUM_SHA256";
+      case TILEDB_FILTER_CHECKSUM_CRC32C:
+        return "CHECKSUM_CRC32C";
       case TILEDB_FILTER_DICTIONARY:
         return "DICTIONARY_ENCODING";
       case TILEDB_FILTER_SCALE_FLOAT:
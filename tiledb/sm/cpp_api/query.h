@@ -51,6 +51,7 @@
 #include <algorithm>
 #include <cassert>
 #include <functional>
+#include <future>
 #include <iterator>
 #include <memory>
 #include <set>
@@ -317,7 +318,9 @@ class Query {
    */
   template <typename Fn>
   void submit_async(const Fn& callback) {
-    std::function<void(void*)> wrapper = [&](void*) { callback(); };
+    // Capture the callback by value: it is invoked after this call has
+    // returned, when a reference to the caller's callable may dangle.
+    std::function<void(void*)> wrapper = [callback](void*) { callback(); };
     auto& ctx = ctx_.get();
     ctx.handle_error(tiledb::impl::tiledb_query_submit_async_func(
         ctx.ptr().get(), query_.get(), &wrapper, nullptr));
@@ -340,6 +343,48 @@ class Query {
     submit_async([]() {});
   }
 
+  /**
+   * Submits the query asynchronously and returns a `std::future` that
+   * becomes ready with the final query status once the submission
+   * completes. The call returns as soon as the query is scheduled, so a
+   * single thread can keep many queries in flight and compose their
+   * completions. An error during the asynchronous submission is delivered
+   * through the future as an exception.
+   *
+   * The completion callback reads this query's state, so the `Query`
+   * object must outlive the returned future becoming ready; destroying
+   * the query while the submission is in flight is undefined behavior.
+   *
+   * @note Same notes apply as `Query::submit()`.
+   *
+   * **Example:**
+   * @code{.cpp}
+   * // Create query
+   * tiledb::Query query(...);
+   * // Submit and wait for completion elsewhere
+   * std::future<Query::Status> status = query.submit_future();
+   * // ...
+   * if (status.get() == Query::Status::COMPLETE) { ... }
+   * @endcode
+   *
+   * @return A future holding the query status after completion.
+   */
+  std::future<Status> submit_future() {
+    auto promise = std::make_shared<std::promise<Status>>();
+    auto future = promise->get_future();
+    std::function<void(void*)> wrapper = [this, promise](void*) {
+      try {
+        promise->set_value(query_status());
+      } catch (...) {
+        promise->set_exception(std::current_exception());
+      }
+    };
+    auto& ctx = ctx_.get();
+    ctx.handle_error(tiledb::impl::tiledb_query_submit_async_func(
+        ctx.ptr().get(), query_.get(), &wrapper, nullptr));
+    return future;
+  }
+
   /**
    * Flushes all internal state of a query object and finalizes the query.
    * This is applicable only to global layout writes. It has no effect for
@@ -1123,6 +1168,21 @@ class Query {
   /**
    * Prepare a query with the contents of a subarray.
    *
+   * A completed read query may be given a new subarray and submitted
+   * again. The query is reset and reuses the state it has already
+   * allocated, which makes repeated reads on the same array cheaper
+   * than creating a new query per read:
+   *
+   * **Example:**
+   * @code{.cpp}
+   * Query query(ctx, array);
+   * query.set_data_buffer("a", data);
+   * for (const auto& s : subarrays) {
+   *   query.set_subarray(s);
+   *   query.submit();
+   * }
+   * @endcode
+   *
    * @param subarray The subarray to be used to prepare the query.
    */
   Query& set_subarray(const Subarray& subarray) {
@@ -34,6 +34,9 @@
 #include "tiledb/common/logger.h"
 #include "tiledb/sm/buffer/buffer.h"
 
+#include <array>
+#include <cstring>
+
 #ifdef _WIN32
 #include "tiledb/sm/crypto/crypto_win32.h"
 #else
@@ -45,13 +48,41 @@ using namespace tiledb::common;
 namespace tiledb {
 namespace sm {
 
+Crypto::AES256GCM_Context::AES256GCM_Context()
+    : ctx_(nullptr)
+    , key_set_(false) {
+#ifndef _WIN32
+  ctx_ = OpenSSL::new_cipher_ctx();
+#endif
+}
+
+Crypto::AES256GCM_Context::~AES256GCM_Context() {
+#ifndef _WIN32
+  OpenSSL::free_cipher_ctx(ctx_);
+#endif
+}
+
+bool Crypto::AES256GCM_Context::key_cached(const void* key) const {
+  return key_set_ && std::memcmp(key_, key, AES256GCM_KEY_BYTES) == 0;
+}
+
+void Crypto::AES256GCM_Context::cache_key(const void* key) {
+  std::memcpy(key_, key, AES256GCM_KEY_BYTES);
+  key_set_ = true;
+}
+
+void Crypto::AES256GCM_Context::clear_key() {
+  key_set_ = false;
+}
+
 Status Crypto::encrypt_aes256gcm(
     ConstBuffer* key,
     ConstBuffer* iv,
     ConstBuffer* input,
     Buffer* output,
     PreallocatedBuffer* output_iv,
-    PreallocatedBuffer* output_tag) {
+    PreallocatedBuffer* output_tag,
+    AES256GCM_Context* cipher_ctx) {
   if (key->size() != AES256GCM_KEY_BYTES)
     return LOG_STATUS(
         Status_EncryptionError("AES-256-GCM error; unexpected key length."));
@@ -66,11 +97,13 @@ Status Crypto::encrypt_aes256gcm(
         "AES-256-GCM error; invalid output tag buffer."));
 
 #ifdef _WIN32
+  // The Win32 CNG interface manages its own algorithm handles per call.
+  (void)cipher_ctx;
   return Win32CNG::encrypt_aes256gcm(
       key, iv, input, output, output_iv, output_tag);
 #else
   return OpenSSL::encrypt_aes256gcm(
-      key, iv, input, output, output_iv, output_tag);
+      key, iv, input, output, output_iv, output_tag, cipher_ctx);
 #endif
 }
 
@@ -79,7 +112,8 @@ Status Crypto::decrypt_aes256gcm(
     ConstBuffer* iv,
     ConstBuffer* tag,
     ConstBuffer* input,
-    Buffer* output) {
+    Buffer* output,
+    AES256GCM_Context* cipher_ctx) {
   if (key == nullptr || key->size() != AES256GCM_KEY_BYTES)
     return LOG_STATUS(
         Status_EncryptionError("AES-256-GCM error; invalid key."));
@@ -90,9 +124,11 @@ Status Crypto::decrypt_aes256gcm(
         Status_EncryptionError("AES-256-GCM error; invalid tag."));
 
 #ifdef _WIN32
+  // The Win32 CNG interface manages its own algorithm handles per call.
+  (void)cipher_ctx;
   return Win32CNG::decrypt_aes256gcm(key, iv, tag, input, output);
 #else
-  return OpenSSL::decrypt_aes256gcm(key, iv, tag, input, output);
+  return OpenSSL::decrypt_aes256gcm(key, iv, tag, input, output, cipher_ctx);
 #endif
 }
 
@@ -132,5 +168,97 @@ Status Crypto::sha256(
 #endif
 }
 
+namespace {
+
+/*
+ * CRC32C (Castagnoli) is not provided by the platform crypto libraries, so
+ * it is implemented here. The hardware path uses the SSE4.2 CRC32
+ * instructions through a per-function `target` attribute, which only GCC
+ * and Clang support; other toolchains use the table-driven path.
+ */
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define CRC32C_SSE42_DISPATCH
+#endif
+
+/** The CRC32C (Castagnoli) polynomial, reflected. */
+constexpr uint32_t crc32c_polynomial = 0x82f63b78;
+
+/** Table-driven CRC32C, processing one byte per step. */
+uint32_t crc32c_software(uint32_t crc, const void* data, uint64_t nbytes) {
+  static const std::array<uint32_t, 256> table = []() {
+    std::array<uint32_t, 256> t{};
+    for (uint32_t i = 0; i < 256; i++) {
+      uint32_t c = i;
+      for (int j = 0; j < 8; j++)
+        c = (c >> 1) ^ ((c & 1) ? crc32c_polynomial : 0);
+      t[i] = c;
+    }
+    return t;
+  }();
+
+  auto bytes = static_cast<const unsigned char*>(data);
+  for (uint64_t i = 0; i < nbytes; i++)
+    crc = (crc >> 8) ^ table[(crc ^ bytes[i]) & 0xff];
+  return crc;
+}
+
+#ifdef CRC32C_SSE42_DISPATCH
+/** Hardware CRC32C, processing eight bytes per instruction. */
+__attribute__((target("sse4.2"))) uint32_t crc32c_hardware(
+    uint32_t crc, const void* data, uint64_t nbytes) {
+  auto bytes = static_cast<const unsigned char*>(data);
+  uint64_t crc64 = crc;
+  while (nbytes >= sizeof(uint64_t)) {
+    uint64_t chunk;
+    std::memcpy(&chunk, bytes, sizeof(uint64_t));
+    crc64 = __builtin_ia32_crc32di(crc64, chunk);
+    bytes += sizeof(uint64_t);
+    nbytes -= sizeof(uint64_t);
+  }
+  crc = static_cast<uint32_t>(crc64);
+  while (nbytes-- > 0)
+    crc = __builtin_ia32_crc32qi(crc, *bytes++);
+  return crc;
+}
+#endif
+
+/** Computes the CRC32C of the input, using the CRC32 instructions when the
+ * CPU supports them. */
+uint32_t crc32c_checksum(const void* data, uint64_t nbytes) {
+#ifdef CRC32C_SSE42_DISPATCH
+  static const bool have_sse42 = __builtin_cpu_supports("sse4.2");
+  if (have_sse42)
+    return ~crc32c_hardware(0xffffffff, data, nbytes);
+#endif
+  return ~crc32c_software(0xffffffff, data, nbytes);
+}
+
+}  // namespace
+
+Status Crypto::crc32c(ConstBuffer* input, Buffer* output) {
+  return crc32c(input, input->size(), output);
+}
+
+Status Crypto::crc32c(
+    ConstBuffer* input, uint64_t input_read_size, Buffer* output) {
+  return crc32c(input->data(), input_read_size, output);
+}
+
+Status Crypto::crc32c(
+    const void* input, uint64_t input_read_size, Buffer* output) {
+  // Ensure sufficient space in output buffer.
+  uint64_t required_space = CRC32C_DIGEST_BYTES;
+  if (output->owns_data()) {
+    if (output->free_space() < required_space)
+      RETURN_NOT_OK(output->realloc(output->alloced_size() + required_space));
+  } else if (output->size() < required_space) {
+    return LOG_STATUS(Status_ChecksumError(
+        "CRC32C error; cannot checksum: output buffer too small."));
+  }
+  uint32_t crc = crc32c_checksum(input, input_read_size);
+  std::memcpy(output->data(), &crc, sizeof(uint32_t));
+  return Status::Ok();
+}
+
 }  // namespace sm
 }  // namespace tiledb
@@ -33,6 +33,7 @@
 #ifndef TILEDB_CRYPTO_H
 #define TILEDB_CRYPTO_H
 
+#include "tiledb/common/macros.h"
 #include "tiledb/common/status.h"
 
 using namespace tiledb::common;
@@ -59,6 +60,49 @@ class Crypto {
   static const unsigned MD5_DIGEST_BYTES = 16;
   /** Size of an SHA256 Digest */
   static const unsigned SHA256_DIGEST_BYTES = 32;
+  /** Size of a CRC32C Digest */
+  static const unsigned CRC32C_DIGEST_BYTES = 4;
+
+  /**
+   * Wrapper around a reusable platform cipher context so that it can be
+   * used in a resource pool. Reusing a context across parts processed
+   * with the same key skips the per-part context allocation and AES key
+   * schedule derivation, which otherwise dominate the cost of encrypting
+   * small chunks. A context must not be shared between encryption and
+   * decryption, as the underlying cipher is initialized for one mode.
+   */
+  class AES256GCM_Context {
+   public:
+    AES256GCM_Context();
+    ~AES256GCM_Context();
+
+    DISABLE_COPY_AND_COPY_ASSIGN(AES256GCM_Context);
+    DISABLE_MOVE_AND_MOVE_ASSIGN(AES256GCM_Context);
+
+    /** Returns the platform cipher context. */
+    inline void* ptr() const {
+      return ctx_;
+    }
+
+    /** Returns true if the context holds the key schedule of `key`. */
+    bool key_cached(const void* key) const;
+
+    /** Records the key whose schedule the context now holds. */
+    void cache_key(const void* key);
+
+    /** Forgets the cached key, forcing a full cipher re-initialization. */
+    void clear_key();
+
+   private:
+    /** The platform cipher context. */
+    void* ctx_;
+
+    /** The key the cipher was last initialized with. */
+    uint8_t key_[AES256GCM_KEY_BYTES];
+
+    /** Whether the cipher holds a valid key schedule. */
+    bool key_set_;
+  };
 
   /**
    * Encrypt the given data using AES-256-GCM.
@@ -70,6 +114,8 @@ class Crypto {
    * @param output Buffer to store encrypted bytes.
    * @param output_iv Buffer to store the IV that was used.
    * @param output_tag Buffer to store the GCM tag that was computed.
+   * @param cipher_ctx If non-null, a reusable cipher context to encrypt
+   *    with, instead of allocating and initializing one for this call.
    * @return Status
    */
   static Status encrypt_aes256gcm(
@@ -78,7 +124,8 @@ class Crypto {
       ConstBuffer* input,
       Buffer* output,
       PreallocatedBuffer* output_iv,
-      PreallocatedBuffer* output_tag);
+      PreallocatedBuffer* output_tag,
+      AES256GCM_Context* cipher_ctx = nullptr);
 
   /**
    * Decrypt the given data using AES-256-GCM.
@@ -88,6 +135,8 @@ class Crypto {
    * @param tag The GCM tag to use.
    * @param input Ciphertext to decrypt.
    * @param output Buffer to store decrypted bytes.
+   * @param cipher_ctx If non-null, a reusable cipher context to decrypt
+   *    with, instead of allocating and initializing one for this call.
    * @return Status
    */
   static Status decrypt_aes256gcm(
@@ -95,7 +144,8 @@ class Crypto {
       ConstBuffer* iv,
       ConstBuffer* tag,
       ConstBuffer* input,
-      Buffer* output);
+      Buffer* output,
+      AES256GCM_Context* cipher_ctx = nullptr);
 
   /**
    * Compute md5 checksum of data
@@ -158,6 +208,37 @@ class Crypto {
    */
   static Status sha256(
       const void* input, uint64_t input_read_size, Buffer* output);
+
+  /**
+   * Compute crc32c checksum of data
+   *
+   * @param input Plaintext to compute checksum of
+   * @param output Buffer to store store checksum bytes.
+   * @return Status
+   */
+  static Status crc32c(ConstBuffer* input, Buffer* output);
+
+  /**
+   * Compute crc32c checksum of data
+   *
+   * @param input Plaintext to compute checksum of
+   * @param input_read_size size of input to compute checksum over
+   * @param output Buffer to store store checksum bytes.
+   * @return Status
+   */
+  static Status crc32c(
+      ConstBuffer* input, uint64_t input_read_size, Buffer* output);
+
+  /**
+   * Compute crc32c checksum of data
+   *
+   * @param input Plaintext to compute checksum of
+   * @param input_read_size size of input to compute checksum over
+   * @param output Buffer to store store checksum bytes.
+   * @return Status
+   */
+  static Status crc32c(
+      const void* input, uint64_t input_read_size, Buffer* output);
 };
 
 }  // namespace sm
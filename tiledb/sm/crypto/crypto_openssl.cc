@@ -48,6 +48,15 @@ using namespace tiledb::common;
 namespace tiledb {
 namespace sm {
 
+void* OpenSSL::new_cipher_ctx() {
+  return EVP_CIPHER_CTX_new();
+}
+
+void OpenSSL::free_cipher_ctx(void* ctx) {
+  if (ctx != nullptr)
+    EVP_CIPHER_CTX_free((EVP_CIPHER_CTX*)ctx);
+}
+
 Status OpenSSL::get_random_bytes(unsigned num_bytes, Buffer* output) {
   if (output->free_space() < num_bytes)
     RETURN_NOT_OK(output->realloc(output->alloced_size() + num_bytes));
@@ -71,7 +80,8 @@ Status OpenSSL::encrypt_aes256gcm(
     ConstBuffer* input,
     Buffer* output,
     PreallocatedBuffer* output_iv,
-    PreallocatedBuffer* output_tag) {
+    PreallocatedBuffer* output_tag,
+    Crypto::AES256GCM_Context* cipher_ctx) {
   // Check input size for int datatype used by OpenSSL.
   if (input->size() > static_cast<uint64_t>(std::numeric_limits<int>::max()))
     return LOG_STATUS(Status_EncryptionError(
@@ -97,21 +107,41 @@ Status OpenSSL::encrypt_aes256gcm(
   // Copy IV to output arg.
   std::memcpy(output_iv->cur_data(), iv_buf, iv_len);
 
-  EVP_CIPHER_CTX* ctx = EVP_CIPHER_CTX_new();
+  // Take the cipher context: either the reusable one passed by the caller,
+  // or a fresh one allocated for this call only.
+  EVP_CIPHER_CTX* ctx = cipher_ctx != nullptr ?
+                            (EVP_CIPHER_CTX*)cipher_ctx->ptr() :
+                            EVP_CIPHER_CTX_new();
   if (ctx == nullptr)
     return LOG_STATUS(Status_EncryptionError(
         "OpenSSL error; cannot encrypt: context allocation failed."));
+  if (cipher_ctx == nullptr)
+    EVP_CIPHER_CTX_init(ctx);
+
+  // On error, a reusable context stays allocated but its cached key is
+  // cleared, forcing a full cipher re-initialization on its next use.
+  auto cleanup_ctx = [&]() {
+    if (cipher_ctx != nullptr)
+      cipher_ctx->clear_key();
+    else
+      EVP_CIPHER_CTX_free(ctx);
+  };
 
   // Initialize the cipher. We use the default parameter lengths for the IV and
-  // tag, so no further configuration is needed for the cipher.
-  EVP_CIPHER_CTX_init(ctx);
-  if (EVP_EncryptInit_ex(
-          ctx,
-          EVP_aes_256_gcm(),
-          nullptr,
-          (unsigned char*)key->data(),
-          iv_buf) == 0) {
-    EVP_CIPHER_CTX_free(ctx);
+  // tag, so no further configuration is needed for the cipher. A reusable
+  // context that was last initialized with the same key retains its AES key
+  // schedule and only resets the IV.
+  int rc;
+  if (cipher_ctx != nullptr && cipher_ctx->key_cached(key->data())) {
+    rc = EVP_EncryptInit_ex(ctx, nullptr, nullptr, nullptr, iv_buf);
+  } else {
+    rc = EVP_EncryptInit_ex(
+        ctx, EVP_aes_256_gcm(), nullptr, (unsigned char*)key->data(), iv_buf);
+    if (rc != 0 && cipher_ctx != nullptr)
+      cipher_ctx->cache_key(key->data());
+  }
+  if (rc == 0) {
+    cleanup_ctx();
     return LOG_STATUS(
         Status_EncryptionError("OpenSSL error; error initializing cipher."));
   }
@@ -124,7 +154,7 @@ Status OpenSSL::encrypt_aes256gcm(
           &output_len,
           (const unsigned char*)input->data(),
           (int)input->size()) == 0) {
-    EVP_CIPHER_CTX_free(ctx);
+    cleanup_ctx();
     return LOG_STATUS(
         Status_EncryptionError("OpenSSL error; error encrypting data."));
   }
@@ -134,7 +164,7 @@ Status OpenSSL::encrypt_aes256gcm(
   // Finalize encryption.
   if (EVP_EncryptFinal_ex(
           ctx, (unsigned char*)output->cur_data(), &output_len) == 0) {
-    EVP_CIPHER_CTX_free(ctx);
+    cleanup_ctx();
     return LOG_STATUS(
         Status_EncryptionError("OpenSSL error; error finalizing encryption."));
   }
@@ -147,13 +177,14 @@ Status OpenSSL::encrypt_aes256gcm(
           EVP_CTRL_GCM_GET_TAG,
           Crypto::AES256GCM_TAG_BYTES,
           (char*)output_tag->data()) == 0) {
-    EVP_CIPHER_CTX_free(ctx);
+    cleanup_ctx();
     return LOG_STATUS(
         Status_EncryptionError("OpenSSL error; error getting tag."));
   }
 
   // Clean up.
-  EVP_CIPHER_CTX_free(ctx);
+  if (cipher_ctx == nullptr)
+    EVP_CIPHER_CTX_free(ctx);
 
   return Status::Ok();
 }
@@ -163,7 +194,8 @@ Status OpenSSL::decrypt_aes256gcm(
     ConstBuffer* iv,
     ConstBuffer* tag,
     ConstBuffer* input,
-    Buffer* output) {
+    Buffer* output,
+    Crypto::AES256GCM_Context* cipher_ctx) {
   // Check input size for int datatype used by OpenSSL.
   if (input->size() > static_cast<uint64_t>(std::numeric_limits<int>::max()))
     return LOG_STATUS(Status_EncryptionError(
@@ -179,21 +211,46 @@ Status OpenSSL::decrypt_aes256gcm(
         "OpenSSL error; cannot decrypt: output buffer too small."));
   }
 
-  EVP_CIPHER_CTX* ctx = EVP_CIPHER_CTX_new();
+  // Take the cipher context: either the reusable one passed by the caller,
+  // or a fresh one allocated for this call only.
+  EVP_CIPHER_CTX* ctx = cipher_ctx != nullptr ?
+                            (EVP_CIPHER_CTX*)cipher_ctx->ptr() :
+                            EVP_CIPHER_CTX_new();
   if (ctx == nullptr)
     return LOG_STATUS(Status_EncryptionError(
         "OpenSSL error; cannot decrypt: context allocation failed."));
+  if (cipher_ctx == nullptr)
+    EVP_CIPHER_CTX_init(ctx);
+
+  // On error, a reusable context stays allocated but its cached key is
+  // cleared, forcing a full cipher re-initialization on its next use.
+  auto cleanup_ctx = [&]() {
+    if (cipher_ctx != nullptr)
+      cipher_ctx->clear_key();
+    else
+      EVP_CIPHER_CTX_free(ctx);
+  };
 
   // Initialize the cipher. We use the default parameter lengths for the IV and
-  // tag, so no further configuration is needed for the cipher.
-  EVP_CIPHER_CTX_init(ctx);
-  if (EVP_DecryptInit_ex(
-          ctx,
-          EVP_aes_256_gcm(),
-          nullptr,
-          (unsigned char*)key->data(),
-          (unsigned char*)iv->data()) == 0) {
-    EVP_CIPHER_CTX_free(ctx);
+  // tag, so no further configuration is needed for the cipher. A reusable
+  // context that was last initialized with the same key retains its AES key
+  // schedule and only resets the IV.
+  int rc;
+  if (cipher_ctx != nullptr && cipher_ctx->key_cached(key->data())) {
+    rc = EVP_DecryptInit_ex(
+        ctx, nullptr, nullptr, nullptr, (unsigned char*)iv->data());
+  } else {
+    rc = EVP_DecryptInit_ex(
+        ctx,
+        EVP_aes_256_gcm(),
+        nullptr,
+        (unsigned char*)key->data(),
+        (unsigned char*)iv->data());
+    if (rc != 0 && cipher_ctx != nullptr)
+      cipher_ctx->cache_key(key->data());
+  }
+  if (rc == 0) {
+    cleanup_ctx();
     return LOG_STATUS(
         Status_EncryptionError("OpenSSL error; error initializing cipher."));
   }
@@ -206,7 +263,7 @@ Status OpenSSL::decrypt_aes256gcm(
           &output_len,
           (const unsigned char*)input->data(),
           (int)input->size()) == 0) {
-    EVP_CIPHER_CTX_free(ctx);
+    cleanup_ctx();
     return LOG_STATUS(
         Status_EncryptionError("OpenSSL error; error decrypting data."));
   }
@@ -220,7 +277,7 @@ Status OpenSSL::decrypt_aes256gcm(
           EVP_CTRL_GCM_SET_TAG,
           Crypto::AES256GCM_TAG_BYTES,
           (char*)tag->data()) == 0) {
-    EVP_CIPHER_CTX_free(ctx);
+    cleanup_ctx();
     return LOG_STATUS(
         Status_EncryptionError("OpenSSL error; error setting tag."));
   }
@@ -228,7 +285,7 @@ Status OpenSSL::decrypt_aes256gcm(
   // Finalize decryption.
   if (EVP_DecryptFinal_ex(
           ctx, (unsigned char*)output->cur_data(), &output_len) == 0) {
-    EVP_CIPHER_CTX_free(ctx);
+    cleanup_ctx();
     return LOG_STATUS(
         Status_EncryptionError("OpenSSL error; error finalizing decryption."));
   }
@@ -237,7 +294,8 @@ Status OpenSSL::decrypt_aes256gcm(
   output->advance_offset((uint64_t)output_len);
 
   // Clean up.
-  EVP_CIPHER_CTX_free(ctx);
+  if (cipher_ctx == nullptr)
+    EVP_CIPHER_CTX_free(ctx);
 
   return Status::Ok();
 }
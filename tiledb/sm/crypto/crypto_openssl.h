@@ -36,6 +36,7 @@
 #ifndef _WIN32
 
 #include "tiledb/common/status.h"
+#include "tiledb/sm/crypto/crypto.h"
 
 using namespace tiledb::common;
 
@@ -49,6 +50,12 @@ class PreallocatedBuffer;
 /** Class encapsulating encryption/decryption using the OpenSSL library. */
 class OpenSSL {
  public:
+  /** Allocates a cipher context for reuse across calls. */
+  static void* new_cipher_ctx();
+
+  /** Frees a cipher context allocated with `new_cipher_ctx`. */
+  static void free_cipher_ctx(void* ctx);
+
   /**
    * Encrypt the given data using AES-256-GCM.
    *
@@ -59,6 +66,7 @@ class OpenSSL {
    * @param output Buffer to store encrypted bytes.
    * @param output_iv Buffer to store the IV that was used.
    * @param output_tag Buffer to store the GCM tag that was computed.
+   * @param cipher_ctx If non-null, a reusable cipher context to encrypt with.
    * @return Status
    */
   static Status encrypt_aes256gcm(
@@ -67,7 +75,8 @@ class OpenSSL {
       ConstBuffer* input,
       Buffer* output,
       PreallocatedBuffer* output_iv,
-      PreallocatedBuffer* output_tag);
+      PreallocatedBuffer* output_tag,
+      Crypto::AES256GCM_Context* cipher_ctx = nullptr);
 
   /**
    * Decrypt the given data using AES-256-GCM.
@@ -77,6 +86,7 @@ class OpenSSL {
    * @param tag The GCM tag to use.
    * @param input Ciphertext to decrypt.
    * @param output Buffer to store decrypted bytes.
+   * @param cipher_ctx If non-null, a reusable cipher context to decrypt with.
    * @return Status
    */
   static Status decrypt_aes256gcm(
@@ -84,7 +94,8 @@ class OpenSSL {
       ConstBuffer* iv,
       ConstBuffer* tag,
       ConstBuffer* input,
-      Buffer* output);
+      Buffer* output,
+      Crypto::AES256GCM_Context* cipher_ctx = nullptr);
 
   /**
    * Compute md5 checksum of data
@@ -0,0 +1,92 @@
+/**
+ * @file curl_share.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines a wrapper around a libcurl share handle.
+ */
+
+#include "curl_share.h"
+
+#ifdef TILEDB_SERIALIZATION
+#include <curl/curl.h>
+#endif
+
+namespace tiledb::sm::curl {
+
+#ifdef TILEDB_SERIALIZATION
+
+/** Locks the share's mutex before libcurl touches the shared data. */
+static void share_lock_cb(
+    CURL*, curl_lock_data, curl_lock_access, void* userptr) {
+  static_cast<std::mutex*>(userptr)->lock();
+}
+
+/** Unlocks the share's mutex after libcurl is done with the shared data. */
+static void share_unlock_cb(CURL*, curl_lock_data, void* userptr) {
+  static_cast<std::mutex*>(userptr)->unlock();
+}
+
+CurlShare::CurlShare()
+    : share_(nullptr) {
+  CURLSH* share = curl_share_init();
+  if (share == nullptr) {
+    // Requests simply run unshared when the handle cannot be created.
+    return;
+  }
+
+  // A single mutex guards all shared data; the share is consulted only
+  // at connection setup and teardown, so contention is negligible
+  // compared to the saved handshakes.
+  curl_share_setopt(share, CURLSHOPT_LOCKFUNC, share_lock_cb);
+  curl_share_setopt(share, CURLSHOPT_UNLOCKFUNC, share_unlock_cb);
+  curl_share_setopt(share, CURLSHOPT_USERDATA, &mtx_);
+
+  curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+  curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+  curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+
+  share_ = share;
+}
+
+CurlShare::~CurlShare() {
+  if (share_ != nullptr) {
+    curl_share_cleanup(static_cast<CURLSH*>(share_));
+  }
+}
+
+#else
+
+CurlShare::CurlShare()
+    : share_(nullptr) {
+}
+
+CurlShare::~CurlShare() = default;
+
+#endif  // TILEDB_SERIALIZATION
+
+}  // namespace tiledb::sm::curl
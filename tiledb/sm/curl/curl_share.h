@@ -0,0 +1,93 @@
+/**
+ * @file curl_share.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file declares a wrapper around a libcurl share handle.
+ */
+
+#ifndef TILEDB_CURL_SHARE_H
+#define TILEDB_CURL_SHARE_H
+
+#include <mutex>
+
+#include "tiledb/common/macros.h"
+
+namespace tiledb::sm::curl {
+
+/**
+ * Owns a libcurl share handle (`CURLSH*`) that pools connections, TLS
+ * sessions and resolved DNS entries across the easy handles of a REST
+ * client.
+ *
+ * Each REST call creates a short-lived easy handle; without sharing,
+ * every call pays a fresh TCP connect, TLS handshake and DNS lookup.
+ * Easy handles attached to this share instead reuse the pooled
+ * connections (multiplexing concurrent requests onto them when the
+ * server speaks HTTP/2), resume pooled TLS sessions and hit the pooled
+ * DNS cache. The share serializes access to the pooled data with an
+ * internal mutex, so easy handles on different threads may attach to the
+ * same share.
+ *
+ * When serialization support is compiled out, the handle is null and
+ * attaching is a no-op.
+ */
+class CurlShare {
+ public:
+  /** Constructor. Creates and configures the share handle. */
+  CurlShare();
+
+  /** Destructor. Cleans up the share handle. */
+  ~CurlShare();
+
+  DISABLE_COPY_AND_COPY_ASSIGN(CurlShare);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(CurlShare);
+
+  /**
+   * Returns the underlying `CURLSH*` as an opaque pointer, keeping this
+   * header free of libcurl types. Null when the share could not be
+   * created or serialization support is compiled out.
+   */
+  inline void* share() const {
+    return share_;
+  }
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** The share handle (`CURLSH*`), or null. */
+  void* share_;
+
+  /** Mutex serializing libcurl's access to the shared data. */
+  std::mutex mtx_;
+};
+
+}  // namespace tiledb::sm::curl
+
+#endif  // TILEDB_CURL_SHARE_H
@@ -86,6 +86,8 @@ inline const std::string& filter_type_str(FilterType filter_type) {
       return constants::filter_checksum_md5_str;
     case FilterType::FILTER_CHECKSUM_SHA256:
       return constants::filter_checksum_sha256_str;
+    case FilterType::FILTER_CHECKSUM_CRC32C:
+      return constants::filter_checksum_crc32c_str;
     case FilterType::FILTER_DICTIONARY:
       return constants::filter_dictionary_str;
     case FilterType::FILTER_SCALE_FLOAT:
@@ -140,6 +142,8 @@ inline Status filter_type_enum(
     *filter_type = FilterType::FILTER_WEBP;
   else if (filter_type_str == constants::delta_str)
     *filter_type = FilterType::FILTER_DELTA;
+  else if (filter_type_str == constants::filter_checksum_crc32c_str)
+    *filter_type = FilterType::FILTER_CHECKSUM_CRC32C;
   else {
     return Status_Error("Invalid FilterType " + filter_type_str);
   }
@@ -148,7 +152,7 @@ inline Status filter_type_enum(
 
 /** Throws error if the input Filtertype enum is not between 0 and 16. */
 inline void ensure_filtertype_is_valid(uint8_t type) {
-  if (type > 18) {
+  if (type > 20) {
     throw std::runtime_error(
         "Invalid FilterType (" + std::to_string(type) + ")");
   }
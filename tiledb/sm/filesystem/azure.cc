@@ -65,7 +65,8 @@ Azure::Azure()
     : write_cache_max_size_(0)
     , max_parallel_ops_(1)
     , block_list_block_size_(0)
-    , use_block_list_upload_(false) {
+    , use_block_list_upload_(false)
+    , use_streaming_upload_(false) {
 }
 
 Azure::~Azure() {
@@ -147,6 +148,9 @@ Status Azure::init(const Config& config, ThreadPool* const thread_pool) {
   RETURN_NOT_OK(config.get<bool>(
       "vfs.azure.use_block_list_upload", &use_block_list_upload_, &found));
   assert(found);
+  RETURN_NOT_OK(config.get<bool>(
+      "vfs.azure.use_streaming_upload", &use_streaming_upload_, &found));
+  assert(found);
 
   int max_retries =
       config.get<int32_t>("vfs.azure.max_retries", Config::must_find);
@@ -271,6 +275,11 @@ Status Azure::flush_blob(const URI& uri) {
     state = &block_list_upload_states_.at(uri.to_string());
   }
 
+  // Wait for all outstanding block uploads to complete. This is a
+  // no-op when streaming uploads are disabled because all uploads are
+  // awaited within `write_blocks`.
+  state->update_st(state->await_all_in_flight(thread_pool_));
+
   std::string container_name;
   std::string blob_path;
   RETURN_NOT_OK(parse_azure_uri(uri, &container_name, &blob_path));
@@ -979,6 +988,53 @@ Status Azure::write_blocks(
   std::string blob_path;
   RETURN_NOT_OK(parse_azure_uri(uri, &container_name, &blob_path));
 
+  if (use_streaming_upload_) {
+    // The staged block size grows as the blob grows so that large
+    // blobs do not exhaust Azure's limit of 50,000 committed blocks.
+    // Blocks within a blob may have heterogeneous sizes, so the last
+    // block of each batch may be short.
+    const uint64_t block_size =
+        state->block_size_multiplier() * block_list_block_size_;
+
+    // Dispatch the block uploads without waiting for them to complete.
+    // Each block takes a copy of its data so that the caller's buffer
+    // (typically the write cache) can be reused immediately.
+    for (uint64_t offset = 0; offset < length; offset += block_size) {
+      const uint64_t block_length = std::min(block_size, length - offset);
+      const std::string block_id = state->next_block_id();
+
+      Buffer block_buffer;
+      RETURN_NOT_OK(block_buffer.write(
+          static_cast<const char*>(buffer) + offset, block_length));
+      BlockListUploadState::InFlightBlock& block =
+          state->add_in_flight_block(std::move(block_buffer));
+
+      std::function<Status()> upload_block_fn = std::bind(
+          &Azure::upload_block,
+          this,
+          container_name,
+          blob_path,
+          block.buffer_.data(),
+          block.buffer_.size(),
+          block_id);
+      block.task_ = thread_pool_->execute(std::move(upload_block_fn));
+    }
+
+    state->maybe_grow_block_size(block_list_block_size_);
+
+    // Bound the number of outstanding uploads (and the memory retained
+    // by their block copies) by waiting for the oldest uploads once
+    // more than 'max_parallel_ops_' are in flight.
+    Status st = Status::Ok();
+    while (state->in_flight_count() > max_parallel_ops_) {
+      const Status block_st = state->await_oldest_in_flight_block(thread_pool_);
+      if (!block_st.ok() && st.ok()) {
+        st = block_st;
+      }
+    }
+    return st;
+  }
+
   if (num_ops == 1) {
     const std::string block_id = state->next_block_id();
 
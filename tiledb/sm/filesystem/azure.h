@@ -45,6 +45,8 @@
 #if !defined(NOMINMAX)
 #define NOMINMAX  // avoid min/max macros from windows headers
 #endif
+#include <cassert>
+#include <deque>
 #include <list>
 #include <unordered_map>
 
@@ -327,8 +329,29 @@ class Azure {
   /** Contains all state associated with a block list upload transaction. */
   class BlockListUploadState {
    public:
+    /**
+     * A block upload that has been dispatched to the thread pool but
+     * not yet awaited. The block data is copied into `buffer_` so that
+     * the caller's buffer (typically the write cache) can be reused
+     * before the upload completes.
+     */
+    struct InFlightBlock {
+      InFlightBlock(Buffer&& buffer)
+          : buffer_(std::move(buffer)) {
+      }
+
+      /** Owns the block data for the duration of the upload. */
+      Buffer buffer_;
+
+      /** The outstanding upload task. */
+      ThreadPool::Task task_;
+    };
+
     BlockListUploadState()
         : next_block_id_(0)
+        , block_size_multiplier_(1)
+        , next_autoscale_block_count_(
+              constants::azure_block_autoscale_num_blocks)
         , st_(Status::Ok()) {
     }
 
@@ -340,6 +363,67 @@ class Azure {
       return block_ids_;
     }
 
+    /* Returns the current block size multiplier. */
+    uint64_t block_size_multiplier() const {
+      return block_size_multiplier_;
+    }
+
+    /*
+     * Doubles the staged block size once enough blocks have been
+     * generated. Azure caps a block blob at 50,000 committed blocks;
+     * growing the block size as the blob grows keeps large blobs
+     * within the block budget while small blobs use small blocks.
+     */
+    void maybe_grow_block_size(const uint64_t base_block_size) {
+      if (next_block_id_ < next_autoscale_block_count_) {
+        return;
+      }
+      const uint64_t grown_block_size =
+          2 * block_size_multiplier_ * base_block_size;
+      if (grown_block_size <= constants::azure_max_block_size) {
+        block_size_multiplier_ *= 2;
+      }
+      next_autoscale_block_count_ +=
+          constants::azure_block_autoscale_num_blocks;
+    }
+
+    /*
+     * Records a dispatched block upload. The returned reference is
+     * stable until the block is awaited.
+     */
+    InFlightBlock& add_in_flight_block(Buffer&& buffer) {
+      return in_flight_blocks_.emplace_back(std::move(buffer));
+    }
+
+    /* Returns the number of unawaited block uploads. */
+    uint64_t in_flight_count() const {
+      return in_flight_blocks_.size();
+    }
+
+    /*
+     * Waits for the oldest in-flight block upload to complete and
+     * releases its buffer.
+     */
+    Status await_oldest_in_flight_block(ThreadPool* const thread_pool) {
+      assert(!in_flight_blocks_.empty());
+      const Status st = thread_pool->wait(in_flight_blocks_.front().task_);
+      in_flight_blocks_.pop_front();
+      update_st(st);
+      return st;
+    }
+
+    /* Waits for all in-flight block uploads to complete. */
+    Status await_all_in_flight(ThreadPool* const thread_pool) {
+      Status st = Status::Ok();
+      while (!in_flight_blocks_.empty()) {
+        const Status block_st = await_oldest_in_flight_block(thread_pool);
+        if (!block_st.ok() && st.ok()) {
+          st = block_st;
+        }
+      }
+      return st;
+    }
+
     /* Returns the aggregate status. */
     Status st() const {
       return st_;
@@ -359,6 +443,17 @@ class Azure {
     // A list of all generated block ids.
     std::list<std::string> block_ids_;
 
+    // The staged block size is 'block_size_multiplier_' times the
+    // configured 'vfs.azure.block_list_block_size'.
+    uint64_t block_size_multiplier_;
+
+    // The block count at which the block size doubles next.
+    uint64_t next_autoscale_block_count_;
+
+    // Block uploads that have been dispatched but not awaited,
+    // in dispatch order.
+    std::deque<InFlightBlock> in_flight_blocks_;
+
     // The aggregate status. If any individual block
     // upload fails, this will be in a non-OK status.
     Status st_;
@@ -395,6 +490,13 @@ class Azure {
   /** Whether or not to use block list upload. */
   bool use_block_list_upload_;
 
+  /**
+   * Whether to dispatch block uploads without waiting for them to
+   * complete. When enabled, at most 'max_parallel_ops_' block uploads
+   * remain in flight between writes.
+   */
+  bool use_streaming_upload_;
+
   /** Maps a blob URI to its block list upload state. */
   std::unordered_map<std::string, BlockListUploadState>
       block_list_upload_states_;
@@ -61,6 +61,7 @@ GCS::GCS()
     , max_parallel_ops_(1)
     , multi_part_part_size_(0)
     , use_multi_part_upload_(true)
+    , use_streaming_upload_(true)
     , request_timeout_ms_(0) {
 }
 
@@ -97,6 +98,9 @@ Status GCS::init(const Config& config, ThreadPool* const thread_pool) {
   RETURN_NOT_OK(config.get<bool>(
       "vfs.gcs.use_multi_part_upload", &use_multi_part_upload_, &found));
   assert(found);
+  RETURN_NOT_OK(config.get<bool>(
+      "vfs.gcs.use_streaming_upload", &use_streaming_upload_, &found));
+  assert(found);
   RETURN_NOT_OK(config.get<uint64_t>(
       "vfs.gcs.multi_part_size", &multi_part_part_size_, &found));
   assert(found);
@@ -889,6 +893,63 @@ Status GCS::write_parts(
     unique_rl.unlock();
   }
 
+  if (use_streaming_upload_) {
+    // Dispatch the part uploads without waiting for them to complete.
+    // Each part takes a copy of its data so that the caller's buffer
+    // (typically the write cache) can be reused immediately.
+    for (uint64_t i = 0; i < num_ops; i++) {
+      const uint64_t begin = i * multi_part_part_size_;
+      const uint64_t end =
+          std::min((i + 1) * multi_part_part_size_ - 1, length - 1);
+      const char* const thread_buffer =
+          reinterpret_cast<const char*>(buffer) + begin;
+      const uint64_t thread_buffer_len = end - begin + 1;
+      const std::string object_part_path = state->next_part_path();
+
+      Buffer part_buffer;
+      RETURN_NOT_OK(part_buffer.write(thread_buffer, thread_buffer_len));
+      MultiPartUploadState::InFlightPart& part =
+          state->add_in_flight_part(std::move(part_buffer));
+
+      std::function<Status()> upload_part_fn = std::bind(
+          &GCS::upload_part,
+          this,
+          bucket_name,
+          object_part_path,
+          part.buffer_.data(),
+          part.buffer_.size());
+      part.task_ = thread_pool_->execute(std::move(upload_part_fn));
+    }
+
+    // Bound the number of outstanding uploads (and the memory retained
+    // by their part copies) by waiting for the oldest uploads once more
+    // than 'max_parallel_ops_' are in flight.
+    Status st = Status::Ok();
+    while (state->in_flight_count() > max_parallel_ops_) {
+      const Status part_st = state->await_oldest_in_flight_part(thread_pool_);
+      if (!part_st.ok() && st.ok()) {
+        st = part_st;
+      }
+    }
+
+    // Compose completed parts into intermediate objects in the
+    // background while later parts are still uploading. This keeps the
+    // final composition at flush time small.
+    while (st.ok() && state->num_completed_parts() >=
+                          constants::gcs_max_parts_per_compose) {
+      const std::vector<std::string> batch =
+          state->take_front_parts(constants::gcs_max_parts_per_compose);
+      const std::string composed_path = state->next_composed_path();
+
+      std::function<Status()> compose_fn = std::bind(
+          &GCS::compose_parts, this, bucket_name, batch, composed_path);
+      state->add_compose_task(thread_pool_->execute(std::move(compose_fn)));
+    }
+
+    state_lck.unlock();
+    return st;
+  }
+
   if (num_ops == 1) {
     const std::string object_part_path = state->next_part_path();
 
@@ -929,17 +990,43 @@ Status GCS::write_parts(
   return Status::Ok();
 }
 
+/** Returns true if a failed GCS request may succeed when retried. */
+static bool status_is_transient(const google::cloud::Status& status) {
+  switch (status.code()) {
+    case google::cloud::StatusCode::kAborted:
+    case google::cloud::StatusCode::kDeadlineExceeded:
+    case google::cloud::StatusCode::kInternal:
+    case google::cloud::StatusCode::kResourceExhausted:
+    case google::cloud::StatusCode::kUnavailable:
+      return true;
+    default:
+      return false;
+  }
+}
+
 Status GCS::upload_part(
     const std::string& bucket_name,
     const std::string& object_part_path,
     const void* const buffer,
     const uint64_t length) {
-  absl::string_view write_buffer(
-      static_cast<const char*>(buffer), static_cast<size_t>(length));
-
+  // Retry the upload on transient errors so that a single slow or
+  // unavailable part does not fail the entire object write.
   google::cloud::StatusOr<google::cloud::storage::ObjectMetadata>
-      object_metadata = client_->InsertObject(
-          bucket_name, object_part_path, std::move(write_buffer));
+      object_metadata;
+  unsigned int attempts = 0;
+  do {
+    if (attempts++ > 0) {
+      std::this_thread::sleep_for(
+          std::chrono::milliseconds(constants::gcs_attempt_sleep_ms));
+    }
+
+    absl::string_view write_buffer(
+        static_cast<const char*>(buffer), static_cast<size_t>(length));
+    object_metadata = client_->InsertObject(
+        bucket_name, object_part_path, std::move(write_buffer));
+  } while (!object_metadata.ok() &&
+           status_is_transient(object_metadata.status()) &&
+           attempts < constants::gcs_max_part_upload_attempts);
 
   if (!object_metadata.ok()) {
     const google::cloud::Status status = object_metadata.status();
@@ -952,6 +1039,44 @@ Status GCS::upload_part(
   return Status::Ok();
 }
 
+Status GCS::compose_parts(
+    const std::string& bucket_name,
+    const std::vector<std::string>& part_paths,
+    const std::string& composed_path) {
+  // Wait for the last part of the batch to propagate to ensure all
+  // parts are available for composition.
+  RETURN_NOT_OK(
+      wait_for_object_to_propagate(bucket_name, part_paths.back()));
+
+  // Build a list of objects to compose.
+  std::vector<google::cloud::storage::ComposeSourceObject> source_objects;
+  source_objects.reserve(part_paths.size());
+  for (const auto& part_path : part_paths) {
+    google::cloud::storage::ComposeSourceObject source_object;
+    source_object.object_name = part_path;
+    source_objects.emplace_back(std::move(source_object));
+  }
+
+  google::cloud::StatusOr<google::cloud::storage::ObjectMetadata>
+      object_metadata =
+          client_->ComposeObject(bucket_name, source_objects, composed_path);
+
+  // The parts are no longer needed, whether or not the composition
+  // succeeded. Deleting them here caps the number of outstanding part
+  // objects while uploads are still in progress.
+  delete_parts(bucket_name, part_paths);
+
+  if (!object_metadata.ok()) {
+    const google::cloud::Status status = object_metadata.status();
+
+    return LOG_STATUS(Status_GCSError(std::string(
+        "Compose parts failed on: " + composed_path + " (" + status.message() +
+        ")")));
+  }
+
+  return Status::Ok();
+}
+
 Status GCS::flush_object(const URI& uri) {
   RETURN_NOT_OK(init_client());
 
@@ -983,7 +1108,12 @@ Status GCS::flush_object(const URI& uri) {
   std::unique_lock<std::mutex> state_lck(state->mtx_);
   unique_rl.unlock();
 
-  const std::vector<std::string> part_paths = state->get_part_paths();
+  // Wait for all outstanding part uploads and intermediate compose
+  // tasks to complete. This is a no-op when streaming uploads are
+  // disabled because all uploads are awaited within `write_parts`.
+  Status st = state->await_all_in_flight(thread_pool_);
+
+  const std::vector<std::string> source_paths = state->get_source_paths();
 
   std::string bucket_name;
   std::string object_path;
@@ -991,28 +1121,29 @@ Status GCS::flush_object(const URI& uri) {
 
   // Wait for the last written part to propogate to ensure all parts
   // are available for composition into a single object.
-  std::string last_part_path = part_paths.back();
-  const Status st = wait_for_object_to_propagate(bucket_name, last_part_path);
+  if (st.ok() && !source_paths.empty()) {
+    st = wait_for_object_to_propagate(bucket_name, source_paths.back());
+  }
   state->update_st(st);
   state_lck.unlock();
 
   if (!st.ok()) {
-    // Delete all outstanding part objects.
-    delete_parts(bucket_name, part_paths);
+    // Delete all outstanding part and intermediate objects.
+    delete_parts(bucket_name, source_paths);
 
     // Release all instance state associated with this part list
     // transactions.
     finish_multi_part_upload(uri);
 
-    return Status::Ok();
+    return st;
   }
 
   // Build a list of objects to compose.
   std::vector<google::cloud::storage::ComposeSourceObject> source_objects;
-  source_objects.reserve(part_paths.size());
-  for (const auto& part_path : part_paths) {
+  source_objects.reserve(source_paths.size());
+  for (const auto& source_path : source_paths) {
     google::cloud::storage::ComposeSourceObject source_object;
-    source_object.object_name = part_path;
+    source_object.object_name = source_path;
     source_objects.emplace_back(std::move(source_object));
   }
 
@@ -1032,8 +1163,8 @@ Status GCS::flush_object(const URI& uri) {
           object_path,
           ignore_cleanup_failures);
 
-  // Delete all outstanding part objects.
-  delete_parts(bucket_name, part_paths);
+  // Delete all outstanding part and intermediate objects.
+  delete_parts(bucket_name, source_paths);
 
   // Release all instance state associated with this multi part
   // transactions so that we can safely return if the following
@@ -46,6 +46,9 @@
 #pragma warning(pop)
 #endif
 
+#include <cassert>
+#include <deque>
+
 #include "tiledb/common/rwlock.h"
 #include "tiledb/common/status.h"
 #include "tiledb/common/thread_pool.h"
@@ -325,34 +328,47 @@ class GCS {
   /** Contains all state associated with a part list upload transaction. */
   class MultiPartUploadState {
    public:
+    /**
+     * A part upload that has been dispatched to the thread pool but
+     * not yet awaited. The part data is copied into `buffer_` so that
+     * the caller's buffer (typically the write cache) can be reused
+     * before the upload completes.
+     */
+    struct InFlightPart {
+      InFlightPart(Buffer&& buffer)
+          : buffer_(std::move(buffer)) {
+      }
+
+      /** Owns the part data for the duration of the upload. */
+      Buffer buffer_;
+
+      /** The outstanding upload task. */
+      ThreadPool::Task task_;
+    };
+
     MultiPartUploadState(const std::string& object_path)
         : object_path_(remove_trailing_slash(object_path))
         , next_part_id_(0)
+        , next_composed_id_(0)
+        , num_completed_parts_(0)
         , st_(Status::Ok()) {
     }
 
     MultiPartUploadState(MultiPartUploadState&& other) noexcept {
       this->object_path_ = std::move(other.object_path_);
       this->next_part_id_ = other.next_part_id_;
+      this->next_composed_id_ = other.next_composed_id_;
       this->part_paths_ = std::move(other.part_paths_);
+      this->composed_part_paths_ = std::move(other.composed_part_paths_);
+      this->in_flight_parts_ = std::move(other.in_flight_parts_);
+      this->compose_tasks_ = std::move(other.compose_tasks_);
+      this->num_completed_parts_ = other.num_completed_parts_;
       this->st_ = other.st_;
     }
 
-    // Copy initialization
-    MultiPartUploadState(const MultiPartUploadState& other) {
-      this->object_path_ = other.object_path_;
-      this->next_part_id_ = other.next_part_id_;
-      this->part_paths_ = other.part_paths_;
-      this->st_ = other.st_;
-    }
-
-    MultiPartUploadState& operator=(const MultiPartUploadState& other) {
-      this->object_path_ = other.object_path_;
-      this->next_part_id_ = other.next_part_id_;
-      this->part_paths_ = other.part_paths_;
-      this->st_ = other.st_;
-      return *this;
-    }
+    // The in-flight upload tasks are not copyable.
+    MultiPartUploadState(const MultiPartUploadState& other) = delete;
+    MultiPartUploadState& operator=(const MultiPartUploadState& other) = delete;
 
     /* Generates the next part path. */
     std::string next_part_path() {
@@ -363,9 +379,98 @@ class GCS {
       return part_path;
     }
 
-    /* Returns all generated part paths. */
-    std::vector<std::string> get_part_paths() const {
-      return part_paths_;
+    /* Generates the next intermediate composed object path. */
+    std::string next_composed_path() {
+      const uint64_t composed_id = next_composed_id_++;
+      const std::string composed_path =
+          object_path_ + "__tiledb_composed_" + std::to_string(composed_id);
+      composed_part_paths_.emplace_back(composed_path);
+      return composed_path;
+    }
+
+    /*
+     * Records a dispatched part upload. The returned reference is
+     * stable until the part is awaited.
+     */
+    InFlightPart& add_in_flight_part(Buffer&& buffer) {
+      return in_flight_parts_.emplace_back(std::move(buffer));
+    }
+
+    /* Returns the number of unawaited part uploads. */
+    uint64_t in_flight_count() const {
+      return in_flight_parts_.size();
+    }
+
+    /*
+     * Waits for the oldest in-flight part upload to complete and
+     * releases its buffer. Part uploads are awaited in dispatch order
+     * so that `num_completed_parts_` always counts a prefix of
+     * 'part_paths_'.
+     */
+    Status await_oldest_in_flight_part(ThreadPool* const thread_pool) {
+      assert(!in_flight_parts_.empty());
+      const Status st = thread_pool->wait(in_flight_parts_.front().task_);
+      in_flight_parts_.pop_front();
+      if (st.ok()) {
+        ++num_completed_parts_;
+      }
+      update_st(st);
+      return st;
+    }
+
+    /* Waits for all in-flight part uploads and compose tasks. */
+    Status await_all_in_flight(ThreadPool* const thread_pool) {
+      Status st = Status::Ok();
+      while (!in_flight_parts_.empty()) {
+        const Status part_st = await_oldest_in_flight_part(thread_pool);
+        if (!part_st.ok() && st.ok()) {
+          st = part_st;
+        }
+      }
+      const Status compose_st = thread_pool->wait_all(compose_tasks_);
+      compose_tasks_.clear();
+      if (!compose_st.ok() && st.ok()) {
+        st = compose_st;
+      }
+      update_st(st);
+      return st;
+    }
+
+    /* Records a dispatched intermediate compose task. */
+    void add_compose_task(ThreadPool::Task&& task) {
+      compose_tasks_.emplace_back(std::move(task));
+    }
+
+    /* Returns the number of completed parts not yet composed. */
+    uint64_t num_completed_parts() const {
+      return num_completed_parts_;
+    }
+
+    /* Removes and returns the oldest 'num' completed part paths. */
+    std::vector<std::string> take_front_parts(const uint64_t num) {
+      assert(num <= num_completed_parts_);
+      std::vector<std::string> parts(
+          part_paths_.begin(), part_paths_.begin() + num);
+      part_paths_.erase(part_paths_.begin(), part_paths_.begin() + num);
+      num_completed_parts_ -= num;
+      return parts;
+    }
+
+    /*
+     * Returns the paths that compose the final object, in order. This
+     * contains the intermediate composed objects followed by the part
+     * paths that have not been composed into an intermediate object.
+     */
+    std::vector<std::string> get_source_paths() const {
+      std::vector<std::string> source_paths;
+      source_paths.reserve(composed_part_paths_.size() + part_paths_.size());
+      source_paths.insert(
+          source_paths.end(),
+          composed_part_paths_.begin(),
+          composed_part_paths_.end());
+      source_paths.insert(
+          source_paths.end(), part_paths_.begin(), part_paths_.end());
+      return source_paths;
     }
 
     /* Returns the aggregate status. */
@@ -390,9 +495,29 @@ class GCS {
     // The next part id to generate.
     uint64_t next_part_id_;
 
-    // A list of all generated part ids.
+    // The next intermediate composed object id to generate.
+    uint64_t next_composed_id_;
+
+    // A list of all part paths that have not yet been composed
+    // into an intermediate object.
     std::vector<std::string> part_paths_;
 
+    // A list of all intermediate composed object paths. Parts are
+    // composed in order, so these always precede 'part_paths_' in
+    // the final object.
+    std::vector<std::string> composed_part_paths_;
+
+    // Part uploads that have been dispatched but not awaited,
+    // in dispatch order.
+    std::deque<InFlightPart> in_flight_parts_;
+
+    // Outstanding intermediate compose tasks.
+    std::vector<ThreadPool::Task> compose_tasks_;
+
+    // The number of leading entries in 'part_paths_' whose uploads
+    // have completed successfully.
+    uint64_t num_completed_parts_;
+
     // The aggregate status. If any individual part
     // upload fails, this will be in a non-OK status.
     Status st_;
@@ -450,6 +575,14 @@ class GCS {
   /** Whether or not to use part list upload. */
   bool use_multi_part_upload_;
 
+  /**
+   * Whether to dispatch part uploads without waiting for them to
+   * complete. When enabled, at most 'max_parallel_ops_' part uploads
+   * remain in flight between writes and completed parts are composed
+   * into intermediate objects in the background.
+   */
+  bool use_streaming_upload_;
+
   /** The timeout for network requests. */
   uint64_t request_timeout_ms_;
 
@@ -645,6 +778,22 @@ class GCS {
       const void* const buffer,
       const uint64_t length);
 
+  /**
+   * Composes uploaded parts into an intermediate object and deletes
+   * the source parts. This runs in the background while later parts
+   * are still uploading, keeping the final composition at flush
+   * time small.
+   *
+   * @param bucket_name The object's bucket name.
+   * @param part_paths The uploaded part paths to compose, in order.
+   * @param composed_path The path of the intermediate composed object.
+   * @return Status
+   */
+  Status compose_parts(
+      const std::string& bucket_name,
+      const std::vector<std::string>& part_paths,
+      const std::string& composed_path);
+
   /**
    * Performs a best-effort to delete all objects in 'part_paths'.
    *
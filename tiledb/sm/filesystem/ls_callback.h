@@ -0,0 +1,54 @@
+/**
+ * @file   ls_callback.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines the callback type for streaming directory listings.
+ */
+
+#ifndef TILEDB_LS_CALLBACK_H
+#define TILEDB_LS_CALLBACK_H
+
+#include <functional>
+
+#include "tiledb/common/filesystem/directory_entry.h"
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * Callback invoked for every entry of a streaming directory listing, as the
+ * results arrive from the backend. Returning `false` stops the listing
+ * early.
+ */
+using LsCallback =
+    std::function<bool(const tiledb::common::filesystem::directory_entry&)>;
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_LS_CALLBACK_H
@@ -35,7 +35,10 @@
 #include "tiledb/sm/filesystem/posix.h"
 #include "tiledb/common/filesystem/directory_entry.h"
 #include "tiledb/common/logger.h"
+#include "tiledb/common/macros.h"
 #include "tiledb/common/stdx_string.h"
+#include "tiledb/sm/buffer/buffer.h"
+#include "tiledb/sm/buffer/buffer_list.h"
 #include "tiledb/sm/misc/constants.h"
 #include "tiledb/sm/misc/tdb_math.h"
 #include "tiledb/sm/misc/utils.h"
@@ -44,9 +47,18 @@
 #include <dirent.h>
 #include <fcntl.h>
 #include <limits.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define TILEDB_POSIX_IO_URING
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#endif
+
+#include <cstring>
 #include <fstream>
 #include <future>
 #include <iostream>
@@ -59,6 +71,254 @@ using tiledb::common::filesystem::directory_entry;
 namespace tiledb {
 namespace sm {
 
+namespace {
+
+/** Alignment required for `O_DIRECT` offsets, addresses and lengths. */
+constexpr uint64_t directio_alignment = 4096;
+
+/** Size of the aligned bounce buffer used for `O_DIRECT` transfers. */
+constexpr uint64_t directio_buffer_size = 4 * 1024 * 1024;
+
+}  // namespace
+
+#ifdef TILEDB_POSIX_IO_URING
+
+/**
+ * A minimal io_uring wrapper implemented directly on top of the raw
+ * syscalls, so that no liburing dependency is needed. Only the
+ * functionality required for batched reads is provided. Submissions must
+ * be externally serialized.
+ */
+class Posix::IoUring {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor. Sets up a ring with the given submission queue depth.
+   * On failure (e.g. a kernel without io_uring support) the instance is
+   * left in a disabled state, see `ok()`.
+   */
+  explicit IoUring(const unsigned entries) {
+    struct io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    ring_fd_ =
+        static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    if (ring_fd_ < 0) {
+      return;
+    }
+
+    // Require the single-mmap ring layout (kernel 5.4+); older kernels
+    // also predate the non-vectored read opcode used below.
+    if (!(params.features & IORING_FEAT_SINGLE_MMAP)) {
+      close(ring_fd_);
+      ring_fd_ = -1;
+      return;
+    }
+
+    sq_entries_ = params.sq_entries;
+    ring_size_ = std::max<size_t>(
+        params.sq_off.array + params.sq_entries * sizeof(unsigned),
+        params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe));
+    ring_ptr_ = mmap(
+        nullptr,
+        ring_size_,
+        PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE,
+        ring_fd_,
+        IORING_OFF_SQ_RING);
+    if (ring_ptr_ == MAP_FAILED) {
+      close(ring_fd_);
+      ring_fd_ = -1;
+      return;
+    }
+
+    sqes_size_ = params.sq_entries * sizeof(struct io_uring_sqe);
+    sqes_ = static_cast<struct io_uring_sqe*>(mmap(
+        nullptr,
+        sqes_size_,
+        PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE,
+        ring_fd_,
+        IORING_OFF_SQES));
+    if (sqes_ == MAP_FAILED) {
+      munmap(ring_ptr_, ring_size_);
+      close(ring_fd_);
+      ring_fd_ = -1;
+      return;
+    }
+
+    auto base = static_cast<char*>(ring_ptr_);
+    sq_tail_ = reinterpret_cast<unsigned*>(base + params.sq_off.tail);
+    sq_mask_ = *reinterpret_cast<unsigned*>(base + params.sq_off.ring_mask);
+    sq_array_ = reinterpret_cast<unsigned*>(base + params.sq_off.array);
+    cq_head_ = reinterpret_cast<unsigned*>(base + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<unsigned*>(base + params.cq_off.tail);
+    cq_mask_ = *reinterpret_cast<unsigned*>(base + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<struct io_uring_cqe*>(base + params.cq_off.cqes);
+  }
+
+  /** Destructor. */
+  ~IoUring() {
+    if (ring_fd_ < 0) {
+      return;
+    }
+    munmap(sqes_, sqes_size_);
+    munmap(ring_ptr_, ring_size_);
+    close(ring_fd_);
+  }
+
+  DISABLE_COPY_AND_COPY_ASSIGN(IoUring);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(IoUring);
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** @return Whether the ring was set up successfully. */
+  bool ok() const {
+    return ring_fd_ >= 0;
+  }
+
+  /**
+   * Reads all regions from an open file descriptor, submitting them to
+   * the kernel in batches of up to the submission queue depth.
+   *
+   * @param fd Open file descriptor to read from.
+   * @param regions Regions to read, as (offset, destination buffer,
+   *     nbytes) tuples.
+   * @return Status.
+   */
+  Status read_regions(
+      const int fd,
+      const std::vector<std::tuple<uint64_t, void*, uint64_t>>& regions) {
+    size_t next = 0;
+    while (next < regions.size()) {
+      const unsigned batch = static_cast<unsigned>(
+          std::min<size_t>(sq_entries_, regions.size() - next));
+
+      // Fill and publish the submission queue entries.
+      unsigned tail = __atomic_load_n(sq_tail_, __ATOMIC_RELAXED);
+      for (unsigned i = 0; i < batch; i++, tail++) {
+        const unsigned idx = tail & sq_mask_;
+        auto& sqe = sqes_[idx];
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = IORING_OP_READ;
+        sqe.fd = fd;
+        sqe.off = std::get<0>(regions[next + i]);
+        sqe.addr = reinterpret_cast<uint64_t>(std::get<1>(regions[next + i]));
+        sqe.len = static_cast<uint32_t>(std::get<2>(regions[next + i]));
+        sqe.user_data = next + i;
+        sq_array_[idx] = idx;
+      }
+      __atomic_store_n(sq_tail_, tail, __ATOMIC_RELEASE);
+
+      // Submit the batch and wait for all of its completions.
+      if (syscall(
+              __NR_io_uring_enter,
+              ring_fd_,
+              batch,
+              batch,
+              IORING_ENTER_GETEVENTS,
+              nullptr,
+              0) < 0) {
+        return LOG_STATUS(Status_IOError(
+            std::string("Cannot read from file; io_uring_enter: ") +
+            strerror(errno)));
+      }
+
+      // Reap the completions for this batch.
+      Status st = Status::Ok();
+      for (unsigned reaped = 0; reaped < batch;) {
+        unsigned head = __atomic_load_n(cq_head_, __ATOMIC_RELAXED);
+        const unsigned cq_tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+        if (head == cq_tail) {
+          // All submissions have completed but the completions were not
+          // yet visible; wait for at least one more.
+          if (syscall(
+                  __NR_io_uring_enter,
+                  ring_fd_,
+                  0,
+                  1,
+                  IORING_ENTER_GETEVENTS,
+                  nullptr,
+                  0) < 0) {
+            return LOG_STATUS(Status_IOError(
+                std::string("Cannot read from file; io_uring_enter: ") +
+                strerror(errno)));
+          }
+          continue;
+        }
+
+        for (; head != cq_tail; head++, reaped++) {
+          const auto& cqe = cqes_[head & cq_mask_];
+          const auto& region = regions[cqe.user_data];
+          const auto nbytes = std::get<2>(region);
+          if (cqe.res < 0) {
+            st = LOG_STATUS(Status_IOError(
+                std::string("POSIX io_uring read error: ") +
+                strerror(-cqe.res)));
+          } else if (static_cast<uint64_t>(cqe.res) != nbytes) {
+            // Short read; finish the remainder synchronously.
+            const Status st2 = read_all(
+                fd,
+                static_cast<char*>(std::get<1>(region)) + cqe.res,
+                nbytes - cqe.res,
+                std::get<0>(region) + cqe.res);
+            if (!st2.ok()) {
+              st = st2;
+            }
+          }
+        }
+        __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+      }
+      RETURN_NOT_OK(st);
+
+      next += batch;
+    }
+
+    return Status::Ok();
+  }
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** The ring file descriptor, or -1 if setup failed. */
+  int ring_fd_ = -1;
+
+  /** The submission queue depth. */
+  unsigned sq_entries_ = 0;
+
+  /** The mmapped submission/completion ring and its size. */
+  void* ring_ptr_ = nullptr;
+  size_t ring_size_ = 0;
+
+  /** The mmapped submission queue entries and their size. */
+  struct io_uring_sqe* sqes_ = nullptr;
+  size_t sqes_size_ = 0;
+
+  /** Submission queue tail, mask and index array. */
+  unsigned* sq_tail_ = nullptr;
+  unsigned sq_mask_ = 0;
+  unsigned* sq_array_ = nullptr;
+
+  /** Completion queue head, tail, mask and entries. */
+  unsigned* cq_head_ = nullptr;
+  unsigned* cq_tail_ = nullptr;
+  unsigned cq_mask_ = 0;
+  struct io_uring_cqe* cqes_ = nullptr;
+};
+
+#else
+
+/** Empty definition so that `io_uring_` can be destroyed. */
+class Posix::IoUring {};
+
+#endif  // TILEDB_POSIX_IO_URING
+
 Posix::Posix(const Config& config) {
   // Initialize member variables with posix config parameters.
 
@@ -69,6 +329,33 @@ Posix::Posix(const Config& config) {
   permissions = config.get<std::string>(
       "vfs.file.posix_directory_permissions", Config::must_find);
   directory_permissions_ = std::strtol(permissions.c_str(), nullptr, 8);
+
+  use_mmap_read_ =
+      config.get<bool>("vfs.file.posix_use_mmap", Config::must_find);
+
+  use_direct_io_ =
+      config.get<bool>("vfs.file.posix_direct_io", Config::must_find);
+
+  [[maybe_unused]] const bool use_io_uring =
+      config.get<bool>("vfs.file.posix_use_io_uring", Config::must_find);
+#ifdef TILEDB_POSIX_IO_URING
+  if (use_io_uring) {
+    auto ring = std::make_unique<IoUring>(128);
+    if (ring->ok()) {
+      io_uring_ = std::move(ring);
+    }
+    // Otherwise silently fall back to pread, e.g. on kernels without
+    // io_uring support.
+  }
+#endif
+}
+
+Posix::~Posix() {
+  std::lock_guard<std::mutex> lock(mmap_cache_mutex_);
+  for (auto& entry : mmap_cache_) {
+    munmap(entry.second.addr_, entry.second.size_);
+  }
+  mmap_cache_.clear();
 }
 
 bool Posix::both_slashes(char a, char b) {
@@ -216,6 +503,7 @@ Status Posix::remove_dir(const URI& uri) const {
 
 Status Posix::remove_file(const URI& uri) const {
   auto path = uri.to_path();
+  evict_mmap(path);
   if (remove(path.c_str()) != 0) {
     return LOG_STATUS(Status_IOError(
         std::string("Cannot delete file '") + path + "'; " + strerror(errno)));
@@ -302,6 +590,8 @@ tuple<Status, optional<std::vector<directory_entry>>> Posix::ls_with_sizes(
 }
 
 Status Posix::move_file(const URI& old_path, const URI& new_path) const {
+  evict_mmap(old_path.to_path());
+  evict_mmap(new_path.to_path());
   if (rename(old_path.to_path().c_str(), new_path.to_path().c_str()) != 0) {
     return LOG_STATUS(
         Status_IOError(std::string("Cannot move path: ") + strerror(errno)));
@@ -432,6 +722,27 @@ Status Posix::read(
         std::string("Cannot read from file ' ") + path +
         "'; nbytes > SSIZE_MAX"));
   }
+
+  // Bypass the page cache with O_DIRECT if enabled; the descriptor opened
+  // above is not needed in that case.
+  if (use_direct_io_) {
+    if (close(fd)) {
+      LOG_STATUS_NO_RETURN_VALUE(
+          Status_IOError(std::string("Cannot close file; ") + strerror(errno)));
+    }
+    return read_direct(path, offset, buffer, nbytes);
+  }
+
+  // Serve the read from the mmap cache if enabled; the descriptor opened
+  // above is not needed in that case.
+  if (use_mmap_read_) {
+    if (close(fd)) {
+      LOG_STATUS_NO_RETURN_VALUE(
+          Status_IOError(std::string("Cannot close file; ") + strerror(errno)));
+    }
+    return read_mmap(path, offset, buffer, nbytes, file_size);
+  }
+
   Status st = read_all(fd, buffer, nbytes, offset);
   // Close file
   if (close(fd)) {
@@ -441,6 +752,163 @@ Status Posix::read(
   return st;
 }
 
+Status Posix::read_regions(
+    const std::string& path,
+    const std::vector<std::tuple<uint64_t, void*, uint64_t>>& regions) const {
+  if (regions.empty()) {
+    return Status::Ok();
+  }
+
+  // Open file
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd == -1) {
+    return LOG_STATUS(Status_IOError(
+        std::string("Cannot read from file; ") + strerror(errno)));
+  }
+
+  Status st = Status::Ok();
+#ifdef TILEDB_POSIX_IO_URING
+  if (io_uring_ != nullptr) {
+    std::lock_guard<std::mutex> lock(io_uring_mutex_);
+    st = io_uring_->read_regions(fd, regions);
+  } else
+#endif
+  {
+    // Fall back to one blocking pread per region.
+    for (const auto& [offset, buffer, nbytes] : regions) {
+      st = read_all(fd, buffer, nbytes, offset);
+      if (!st.ok()) {
+        break;
+      }
+    }
+  }
+
+  // Close file
+  if (close(fd)) {
+    LOG_STATUS_NO_RETURN_VALUE(
+        Status_IOError(std::string("Cannot close file; ") + strerror(errno)));
+  }
+  return st;
+}
+
+Status Posix::read_mmap(
+    const std::string& path,
+    uint64_t offset,
+    void* buffer,
+    uint64_t nbytes,
+    uint64_t file_size) const {
+  if (nbytes == 0) {
+    return Status::Ok();
+  }
+
+  std::lock_guard<std::mutex> lock(mmap_cache_mutex_);
+
+  // Remap if the file has grown past a previously cached mapping.
+  auto it = mmap_cache_.find(path);
+  if (it != mmap_cache_.end() && offset + nbytes > it->second.size_) {
+    munmap(it->second.addr_, it->second.size_);
+    mmap_cache_.erase(it);
+    it = mmap_cache_.end();
+  }
+
+  if (it == mmap_cache_.end()) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1) {
+      return LOG_STATUS(Status_IOError(
+          std::string("Cannot map file for reading; ") + strerror(errno)));
+    }
+    void* addr = mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (close(fd)) {
+      LOG_STATUS_NO_RETURN_VALUE(
+          Status_IOError(std::string("Cannot close file; ") + strerror(errno)));
+    }
+    if (addr == MAP_FAILED) {
+      return LOG_STATUS(Status_IOError(
+          std::string("Cannot map file for reading; ") + strerror(errno)));
+    }
+    madvise(addr, file_size, MADV_WILLNEED);
+    it = mmap_cache_.emplace(path, MappedRegion{addr, file_size}).first;
+  }
+
+  std::memcpy(
+      buffer, static_cast<char*>(it->second.addr_) + offset, nbytes);
+  return Status::Ok();
+}
+
+void Posix::evict_mmap(const std::string& path) const {
+  std::lock_guard<std::mutex> lock(mmap_cache_mutex_);
+  auto it = mmap_cache_.find(path);
+  if (it != mmap_cache_.end()) {
+    munmap(it->second.addr_, it->second.size_);
+    mmap_cache_.erase(it);
+  }
+}
+
+Status Posix::read_direct(
+    const std::string& path,
+    uint64_t offset,
+    void* buffer,
+    uint64_t nbytes) const {
+#ifdef O_DIRECT
+  int fd = open(path.c_str(), O_RDONLY | O_DIRECT);
+#else
+  int fd = -1;
+#endif
+  if (fd == -1) {
+    // Not all filesystems support O_DIRECT; fall back to a buffered read.
+    fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1) {
+      return LOG_STATUS(Status_IOError(
+          std::string("Cannot read from file; ") + strerror(errno)));
+    }
+    Status st = read_all(fd, buffer, nbytes, offset);
+    if (close(fd)) {
+      LOG_STATUS_NO_RETURN_VALUE(
+          Status_IOError(std::string("Cannot close file; ") + strerror(errno)));
+    }
+    return st;
+  }
+
+  // O_DIRECT requires the file offset, buffer address and length to be
+  // block aligned, so the data is transferred through an aligned bounce
+  // buffer and the requested range is copied out.
+  void* bounce = nullptr;
+  if (posix_memalign(&bounce, directio_alignment, directio_buffer_size) != 0) {
+    close(fd);
+    return LOG_STATUS(Status_IOError(
+        "Cannot read from file; aligned buffer allocation failed"));
+  }
+
+  Status st = Status::Ok();
+  auto bytes = static_cast<char*>(buffer);
+  while (nbytes > 0) {
+    const uint64_t skip = offset % directio_alignment;
+    const uint64_t aligned_offset = offset - skip;
+    uint64_t length = std::min(skip + nbytes, directio_buffer_size);
+    length = utils::math::ceil(length, directio_alignment) * directio_alignment;
+    const ssize_t actual = ::pread(fd, bounce, length, aligned_offset);
+    if (actual <= static_cast<ssize_t>(skip)) {
+      st = LOG_STATUS(Status_IOError(
+          std::string("POSIX direct read error: ") + strerror(errno)));
+      break;
+    }
+
+    const uint64_t copy_nbytes =
+        std::min(static_cast<uint64_t>(actual) - skip, nbytes);
+    std::memcpy(bytes, static_cast<char*>(bounce) + skip, copy_nbytes);
+    bytes += copy_nbytes;
+    offset += copy_nbytes;
+    nbytes -= copy_nbytes;
+  }
+
+  std::free(bounce);
+  if (close(fd)) {
+    LOG_STATUS_NO_RETURN_VALUE(
+        Status_IOError(std::string("Cannot close file; ") + strerror(errno)));
+  }
+  return st;
+}
+
 Status Posix::sync(const URI& uri) {
   auto path = uri.to_path();
 
@@ -483,6 +951,7 @@ Status Posix::write(
     uint64_t buffer_size,
     [[maybe_unused]] bool remote_global_order_write) {
   auto path = uri.to_path();
+  evict_mmap(path);
   // Check for valid inputs before attempting the actual
   // write system call. This is to avoid a bug on macOS
   // Ventura 13.0 on Apple's M1 processors.
@@ -516,7 +985,67 @@ Status Posix::write(
         std::string("Cannot open file '") + path + "'; " + strerror(errno)));
   }
 
-  st = write_at(fd, file_offset, buffer, buffer_size);
+  st = use_direct_io_ ? write_direct(fd, file_offset, buffer, buffer_size) :
+                        write_at(fd, file_offset, buffer, buffer_size);
+  if (!st.ok()) {
+    close(fd);
+    std::stringstream errmsg;
+    errmsg << "Cannot write to file '" << path << "'; " << st.message();
+    return LOG_STATUS(Status_IOError(errmsg.str()));
+  }
+  if (close(fd) != 0) {
+    return LOG_STATUS(Status_IOError(
+        std::string("Cannot close file '") + path + "'; " + strerror(errno)));
+  }
+  return st;
+}
+
+Status Posix::write(const URI& uri, const BufferList& buffers) {
+  auto path = uri.to_path();
+  evict_mmap(path);
+  const uint64_t total_size = buffers.total_size();
+  if constexpr (SSIZE_MAX < UINT64_MAX) {
+    if (total_size > SSIZE_MAX) {
+      throw std::invalid_argument(
+          "invalid write with more than " + std::to_string(SSIZE_MAX) +
+          " bytes");
+    }
+  }
+
+  // Get file offset (equal to file size)
+  Status st;
+  uint64_t file_offset = 0;
+  if (is_file(URI(path))) {
+    st = file_size(URI(path), &file_offset);
+    if (!st.ok()) {
+      std::stringstream errmsg;
+      errmsg << "Cannot write to file '" << path << "'; " << st.message();
+      return LOG_STATUS(Status_IOError(errmsg.str()));
+    }
+  }
+
+  // Open or create file.
+  int fd = open(path.c_str(), O_WRONLY | O_CREAT, file_permissions_);
+  if (fd == -1) {
+    return LOG_STATUS(Status_IOError(
+        std::string("Cannot open file '") + path + "'; " + strerror(errno)));
+  }
+
+  if (use_direct_io_) {
+    // `write_direct` stages the data through an aligned bounce buffer, so
+    // gathering brings no benefit; write the buffers back to back.
+    st = Status::Ok();
+    for (uint64_t idx = 0; idx < buffers.num_buffers() && st.ok(); idx++) {
+      const Buffer* b = nullptr;
+      st = buffers.get_buffer(idx, &b);
+      if (st.ok()) {
+        st = write_direct(fd, file_offset, b->data(), b->size());
+        file_offset += b->size();
+      }
+    }
+  } else {
+    st = write_at_v(fd, file_offset, buffers);
+  }
   if (!st.ok()) {
     close(fd);
     std::stringstream errmsg;
@@ -547,6 +1076,108 @@ Status Posix::write_at(
   return Status::Ok();
 }
 
+Status Posix::write_at_v(
+    int fd, uint64_t file_offset, const BufferList& buffers) {
+  const uint64_t num_buffers = buffers.num_buffers();
+  std::vector<struct iovec> iov;
+  iov.reserve(std::min<uint64_t>(num_buffers, IOV_MAX));
+
+  for (uint64_t idx = 0; idx < num_buffers;) {
+    // Gather the next batch of at most IOV_MAX buffers.
+    iov.clear();
+    uint64_t batch_size = 0;
+    for (; idx < num_buffers && iov.size() < IOV_MAX; idx++) {
+      const Buffer* b = nullptr;
+      RETURN_NOT_OK(buffers.get_buffer(idx, &b));
+      if (b->size() == 0)
+        continue;
+      iov.push_back({b->data(), b->size()});
+      batch_size += b->size();
+    }
+
+    // Write the batch, resuming after partial writes.
+    size_t iov_offset = 0;
+    while (batch_size > 0) {
+      ssize_t actual_written = ::pwritev(
+          fd, iov.data() + iov_offset, iov.size() - iov_offset, file_offset);
+      if (actual_written == -1) {
+        return LOG_STATUS(Status_IOError(
+            std::string("POSIX write error:") + strerror(errno)));
+      }
+      file_offset += actual_written;
+      batch_size -= actual_written;
+      uint64_t consumed = actual_written;
+      while (consumed > 0 && consumed >= iov[iov_offset].iov_len) {
+        consumed -= iov[iov_offset].iov_len;
+        iov_offset++;
+      }
+      if (consumed > 0) {
+        iov[iov_offset].iov_base =
+            static_cast<char*>(iov[iov_offset].iov_base) + consumed;
+        iov[iov_offset].iov_len -= consumed;
+      }
+    }
+  }
+
+  return Status::Ok();
+}
+
+Status Posix::write_direct(
+    int fd, uint64_t file_offset, const void* buffer, uint64_t buffer_size) {
+#ifdef O_DIRECT
+  auto bytes = static_cast<const char*>(buffer);
+
+  // Write the unaligned head buffered so that the direct portion starts on
+  // a block boundary.
+  const uint64_t head = std::min(
+      buffer_size,
+      (directio_alignment - file_offset % directio_alignment) %
+          directio_alignment);
+  RETURN_NOT_OK(write_at(fd, file_offset, bytes, head));
+  bytes += head;
+  file_offset += head;
+  buffer_size -= head;
+
+  // Stage full blocks through an aligned bounce buffer written with
+  // O_DIRECT. If O_DIRECT cannot be enabled on the descriptor (e.g. the
+  // filesystem does not support it), everything is written buffered below.
+  uint64_t direct_size = buffer_size - (buffer_size % directio_alignment);
+  const int flags = fcntl(fd, F_GETFL);
+  if (direct_size != 0 && flags != -1 &&
+      fcntl(fd, F_SETFL, flags | O_DIRECT) != -1) {
+    void* bounce = nullptr;
+    if (posix_memalign(&bounce, directio_alignment, directio_buffer_size) !=
+        0) {
+      return LOG_STATUS(Status_IOError(
+          "Cannot write to file; aligned buffer allocation failed"));
+    }
+
+    Status st = Status::Ok();
+    while (direct_size > 0 && st.ok()) {
+      const uint64_t length = std::min(direct_size, directio_buffer_size);
+      std::memcpy(bounce, bytes, length);
+      st = write_at(fd, file_offset, bounce, length);
+      bytes += length;
+      file_offset += length;
+      buffer_size -= length;
+      direct_size -= length;
+    }
+
+    std::free(bounce);
+    if (fcntl(fd, F_SETFL, flags) == -1) {
+      return LOG_STATUS(Status_IOError(
+          std::string("POSIX write error: ") + strerror(errno)));
+    }
+    RETURN_NOT_OK(st);
+  }
+
+  // Write the unaligned tail buffered.
+  return write_at(fd, file_offset, bytes, buffer_size);
+#else
+  return write_at(fd, file_offset, buffer, buffer_size);
+#endif
+}
+
 }  // namespace sm
 }  // namespace tiledb
 
@@ -39,7 +39,11 @@
 #include <sys/types.h>
 
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <tuple>
+#include <unordered_map>
 #include <vector>
 
 #include "tiledb/common/status.h"
@@ -56,6 +60,7 @@ class directory_entry;
 
 namespace sm {
 
+class BufferList;
 class URI;
 
 /**
@@ -72,7 +77,7 @@ class Posix : public FilesystemBase {
   explicit Posix(const Config& config);
 
   /** Destructor. */
-  ~Posix() override = default;
+  ~Posix() override;
 
   /**
    * Returns the absolute posix (string) path of the input in the
@@ -199,6 +204,10 @@ class Posix : public FilesystemBase {
   /**
    * Reads data from a file into a buffer.
    *
+   * If `vfs.file.posix_use_mmap` is set, the read is served from a cached
+   * read-only memory mapping of the file instead of an open/pread/close
+   * sequence per call.
+   *
    * @param path The name of the file.
    * @param offset The offset in the file from which the read will start.
    * @param buffer The buffer into which the data will be written.
@@ -212,6 +221,28 @@ class Posix : public FilesystemBase {
       uint64_t nbytes,
       bool use_read_ahead = true) override;
 
+  /**
+   * Reads multiple regions from a file.
+   *
+   * If `vfs.file.posix_use_io_uring` is set and the kernel supports it,
+   * all regions are submitted to the kernel as one io_uring batch, which
+   * issues them concurrently without dedicating a thread to each read.
+   * Otherwise the regions are read sequentially with `pread`.
+   *
+   * @param path The name of the file.
+   * @param regions Regions to read, as (offset, destination buffer,
+   *     nbytes) tuples.
+   * @return Status.
+   */
+  Status read_regions(
+      const std::string& path,
+      const std::vector<std::tuple<uint64_t, void*, uint64_t>>& regions) const;
+
+  /** @return Whether batched reads are submitted through io_uring. */
+  inline bool use_io_uring() const {
+    return io_uring_ != nullptr;
+  }
+
   /**
    * Syncs a file or directory.
    *
@@ -237,6 +268,20 @@ class Posix : public FilesystemBase {
       uint64_t buffer_size,
       bool remote_global_order_write = false) override;
 
+  /**
+   * Writes the buffers of a buffer list to a file with a single
+   * scatter-gather (`pwritev`) system call per `IOV_MAX` buffers,
+   * without concatenating them in memory first.
+   *
+   * If the file exists than it is created.
+   * If the file does not exist than it is appended to.
+   *
+   * @param uri The name of the file.
+   * @param buffers The buffers to write.
+   * @return Status
+   */
+  Status write(const URI& uri, const BufferList& buffers);
+
  private:
   static void adjacent_slashes_dedup(std::string* path);
 
@@ -289,8 +334,112 @@ class Posix : public FilesystemBase {
   static Status write_at(
       int fd, uint64_t file_offset, const void* buffer, uint64_t buffer_size);
 
+  /**
+   * Write the buffers of a buffer list to the file descriptor, beginning at
+   * the given offset. The buffers are gathered with `pwritev`, batching
+   * `IOV_MAX` buffers per system call.
+   *
+   * @param fd Open file descriptor to write to
+   * @param file_offset Offset in the file at which to start writing
+   * @param buffers The buffers to write
+   * @return Status
+   */
+  static Status write_at_v(
+      int fd, uint64_t file_offset, const BufferList& buffers);
+
+  /** A cached read-only memory mapping of an entire file. */
+  struct MappedRegion {
+    void* addr_ = nullptr;
+    uint64_t size_ = 0;
+  };
+
+  /**
+   * Serves a read from the mmap cache, mapping (or remapping, if the file
+   * has grown) the file if needed.
+   *
+   * @param path The name of the file.
+   * @param offset The offset in the file from which the read will start.
+   * @param buffer The buffer into which the data will be written.
+   * @param nbytes Number of bytes to read.
+   * @param file_size The current size of the file.
+   * @return Status
+   */
+  Status read_mmap(
+      const std::string& path,
+      uint64_t offset,
+      void* buffer,
+      uint64_t nbytes,
+      uint64_t file_size) const;
+
+  /** Drops the cached mapping of `path`, if any. */
+  void evict_mmap(const std::string& path) const;
+
+  /**
+   * Serves a read with `O_DIRECT`, bypassing the OS page cache. The data is
+   * transferred through an internal aligned bounce buffer as `O_DIRECT`
+   * requires the file offset, buffer address and length to be block
+   * aligned. Falls back to a buffered read when the filesystem does not
+   * support `O_DIRECT`.
+   *
+   * @param path The name of the file.
+   * @param offset The offset in the file from which the read will start.
+   * @param buffer The buffer into which the data will be written.
+   * @param nbytes Number of bytes to read.
+   * @return Status
+   */
+  Status read_direct(
+      const std::string& path,
+      uint64_t offset,
+      void* buffer,
+      uint64_t nbytes) const;
+
+  /**
+   * Writes with `O_DIRECT`, bypassing the OS page cache. Aligned full
+   * blocks are staged through an internal aligned bounce buffer and written
+   * with `O_DIRECT`; unaligned leading and trailing portions are written
+   * buffered. Falls back entirely to a buffered write when the filesystem
+   * does not support `O_DIRECT`.
+   *
+   * @param fd Open (buffered) file descriptor to write to.
+   * @param file_offset Offset in the file at which to start writing.
+   * @param buffer Buffer of data to write.
+   * @param buffer_size Number of bytes to write.
+   * @return Status
+   */
+  static Status write_direct(
+      int fd, uint64_t file_offset, const void* buffer, uint64_t buffer_size);
+
+  /**
+   * A minimal io_uring wrapper, implemented directly on top of the raw
+   * syscalls so that no liburing dependency is needed. Defined in the
+   * translation unit, on Linux kernels with io_uring headers only.
+   */
+  class IoUring;
+
  private:
   uint32_t file_permissions_, directory_permissions_;
+
+  /**
+   * The io_uring instance used for batched reads, or `nullptr` if
+   * `vfs.file.posix_use_io_uring` is unset or the kernel does not
+   * support io_uring.
+   */
+  std::unique_ptr<IoUring> io_uring_;
+
+  /** Serializes submissions on `io_uring_`. */
+  mutable std::mutex io_uring_mutex_;
+
+  /** Whether reads are served through the mmap cache. */
+  bool use_mmap_read_ = false;
+
+  /** Whether reads and writes bypass the OS page cache with `O_DIRECT`. */
+  bool use_direct_io_ = false;
+
+  /** Protects `mmap_cache_`. */
+  mutable std::mutex mmap_cache_mutex_;
+
+  /** Cached read-only file mappings, keyed on file path. */
+  mutable std::unordered_map<std::string, MappedRegion> mmap_cache_;
 };
 
 }  // namespace sm
@@ -54,6 +54,7 @@
 #include <boost/interprocess/streams/bufferstream.hpp>
 #include <fstream>
 #include <iostream>
+#include <unordered_map>
 
 #include "tiledb/common/logger.h"
 #include "tiledb/common/unique_rwlock.h"
@@ -367,9 +368,30 @@ S3::S3(
   }
 
   state_ = State::INITIALIZED;
+
+  // Optionally initialize the client eagerly in the background, so that
+  // credential resolution and TLS setup overlap the caller's own work
+  // instead of delaying the first S3 operation.
+  if (s3_params_.eager_init_) {
+    ThreadPool::PriorityScope scope(ThreadPool::Priority::BACKGROUND);
+    preload_task_ = vfs_thread_pool_->execute([this]() {
+      try {
+        throw_if_not_ok(init_client());
+      } catch (...) {
+        // Client initialization errors are surfaced by the first S3
+        // operation instead.
+      }
+      return Status::Ok();
+    });
+  }
 }
 
 S3::~S3() {
+  // Wait for a pending eager client initialization before tearing down.
+  if (preload_task_.valid()) {
+    (void)vfs_thread_pool_->wait(preload_task_);
+  }
+
   /**
    * Note: if s3 fails to disconnect, the Status must be logged.
    * Right now, there aren't means to adjust s3 issues that may cause
@@ -921,6 +943,79 @@ tuple<Status, optional<std::vector<directory_entry>>> S3::ls_with_sizes(
   return {Status::Ok(), entries};
 }
 
+Status S3::ls_cb(
+    const URI& prefix, const LsCallback& cb, const std::string& delimiter)
+    const {
+  RETURN_NOT_OK(init_client());
+
+  const auto prefix_dir = prefix.add_trailing_slash();
+
+  auto prefix_str = prefix_dir.to_string();
+  if (!prefix_dir.is_s3()) {
+    return LOG_STATUS(
+        Status_S3Error(std::string("URI is not an S3 URI: " + prefix_str)));
+  }
+
+  Aws::Http::URI aws_uri = prefix_str.c_str();
+  auto aws_prefix = remove_front_slash(aws_uri.GetPath().c_str());
+  std::string aws_auth = aws_uri.GetAuthority().c_str();
+  Aws::S3::Model::ListObjectsV2Request list_objects_request;
+  list_objects_request.SetBucket(aws_uri.GetAuthority());
+  list_objects_request.SetPrefix(aws_prefix.c_str());
+  list_objects_request.SetDelimiter(delimiter.c_str());
+  if (request_payer_ != Aws::S3::Model::RequestPayer::NOT_SET) {
+    list_objects_request.SetRequestPayer(request_payer_);
+  }
+
+  bool is_done = false;
+  while (!is_done) {
+    auto list_objects_outcome = client_->ListObjectsV2(list_objects_request);
+
+    if (!list_objects_outcome.IsSuccess()) {
+      return LOG_STATUS(Status_S3Error(
+          std::string("Error while listing with prefix '") + prefix_str +
+          "' and delimiter '" + delimiter + "'" +
+          outcome_error_message(list_objects_outcome)));
+    }
+
+    for (const auto& object : list_objects_outcome.GetResult().GetContents()) {
+      std::string file(object.GetKey().c_str());
+      uint64_t size = object.GetSize();
+      if (!cb(directory_entry(
+              "s3://" + aws_auth + add_front_slash(file), size, false))) {
+        return Status::Ok();
+      }
+    }
+
+    for (const auto& object :
+         list_objects_outcome.GetResult().GetCommonPrefixes()) {
+      std::string file(object.GetPrefix().c_str());
+      // For "directories" it doesn't seem possible to get a shallow size in
+      // S3, so the size of such an entry will be 0 in S3.
+      if (!cb(directory_entry(
+              "s3://" + aws_auth + add_front_slash(remove_trailing_slash(file)),
+              0,
+              true))) {
+        return Status::Ok();
+      }
+    }
+
+    is_done = !list_objects_outcome.GetResult().GetIsTruncated();
+    if (!is_done) {
+      Aws::String next_marker =
+          list_objects_outcome.GetResult().GetNextContinuationToken();
+      if (next_marker.empty()) {
+        return LOG_STATUS(
+            Status_S3Error("Failed to retrieve next continuation "
+                           "token for ListObjectsV2 request."));
+      }
+      list_objects_request.SetContinuationToken(std::move(next_marker));
+    }
+  }
+
+  return Status::Ok();
+}
+
 Status S3::move_object(const URI& old_uri, const URI& new_uri) {
   RETURN_NOT_OK(init_client());
 
@@ -1020,21 +1115,68 @@ Status S3::read(
         std::string("URI is not an S3 URI: " + uri.to_string())));
   }
 
+  const uint64_t total_length = length + read_ahead_length;
+
+  // Split large reads into parallel ranged GET requests, mirroring the
+  // multipart upload strategy of `write_multipart`. A single GET is
+  // bound by per-connection throughput, so reads spanning multiple
+  // parts are fetched concurrently and reassembled into `buffer`.
+  uint64_t num_ops =
+      utils::math::ceil(total_length, s3_params_.multipart_part_size_);
+  num_ops =
+      std::min(std::max(num_ops, uint64_t(1)), s3_params_.max_parallel_ops_);
+
+  if (num_ops == 1) {
+    RETURN_NOT_OK(
+        read_impl(uri, offset, buffer, total_length, length_returned));
+  } else {
+    const uint64_t bytes_per_op = total_length / num_ops;
+    std::vector<uint64_t> lengths_returned(num_ops, 0);
+    auto status = parallel_for(vfs_thread_pool_, 0, num_ops, [&](uint64_t i) {
+      const uint64_t op_offset = i * bytes_per_op;
+      const uint64_t op_length =
+          (i == num_ops - 1) ? total_length - op_offset : bytes_per_op;
+      return read_impl(
+          uri,
+          offset + static_cast<off_t>(op_offset),
+          static_cast<char*>(buffer) + op_offset,
+          op_length,
+          &lengths_returned[i]);
+    });
+    RETURN_NOT_OK(status);
+
+    *length_returned = 0;
+    for (const auto nbytes : lengths_returned)
+      *length_returned += nbytes;
+  }
+
+  if (*length_returned < length) {
+    return LOG_STATUS(Status_S3Error(
+        std::string("Read operation returned different size of bytes ") +
+        std::to_string(*length_returned) + " vs " + std::to_string(length)));
+  }
+
+  return Status::Ok();
+}
+
+Status S3::read_impl(
+    const URI& uri,
+    const off_t offset,
+    void* const buffer,
+    const uint64_t length,
+    uint64_t* const length_returned) const {
   Aws::Http::URI aws_uri = uri.c_str();
   Aws::S3::Model::GetObjectRequest get_object_request;
   get_object_request.WithBucket(aws_uri.GetAuthority())
       .WithKey(aws_uri.GetPath());
   get_object_request.SetRange(
       ("bytes=" + std::to_string(offset) + "-" +
-       std::to_string(offset + length + read_ahead_length - 1))
+       std::to_string(offset + length - 1))
           .c_str());
-  get_object_request.SetResponseStreamFactory(
-      [buffer, length, read_ahead_length]() {
-        return Aws::New<PreallocatedIOStream>(
-            constants::s3_allocation_tag.c_str(),
-            buffer,
-            length + read_ahead_length);
-      });
+  get_object_request.SetResponseStreamFactory([buffer, length]() {
+    return Aws::New<PreallocatedIOStream>(
+        constants::s3_allocation_tag.c_str(), buffer, length);
+  });
 
   if (request_payer_ != Aws::S3::Model::RequestPayer::NOT_SET)
     get_object_request.SetRequestPayer(request_payer_);
@@ -1048,11 +1190,6 @@ Status S3::read(
 
   *length_returned =
       static_cast<uint64_t>(get_object_outcome.GetResult().GetContentLength());
-  if (*length_returned < length) {
-    return LOG_STATUS(Status_S3Error(
-        std::string("Read operation returned different size of bytes ") +
-        std::to_string(*length_returned) + " vs " + std::to_string(length)));
-  }
 
   return Status::Ok();
 }
@@ -1084,6 +1221,80 @@ Status S3::remove_object(const URI& uri) const {
   return Status::Ok();
 }
 
+Status S3::remove_objects(const std::vector<URI>& uris) const {
+  RETURN_NOT_OK(init_client());
+
+  // A DeleteObjects request addresses a single bucket, so group the keys by
+  // bucket first.
+  std::unordered_map<std::string, Aws::Vector<Aws::S3::Model::ObjectIdentifier>>
+      keys_per_bucket;
+  for (const auto& uri : uris) {
+    if (!uri.is_s3()) {
+      return LOG_STATUS(Status_S3Error(
+          std::string("URI is not an S3 URI: " + uri.to_string())));
+    }
+
+    Aws::Http::URI aws_uri = uri.to_string().c_str();
+    keys_per_bucket[std::string(aws_uri.GetAuthority().c_str())].emplace_back(
+        Aws::S3::Model::ObjectIdentifier().WithKey(aws_uri.GetPath()));
+  }
+
+  // Split the keys of each bucket into batches of at most 1000 keys, the
+  // maximum DeleteObjects accepts per request.
+  constexpr size_t max_keys_per_request = 1000;
+  struct Batch {
+    std::string bucket_;
+    Aws::Vector<Aws::S3::Model::ObjectIdentifier> objects_;
+  };
+  std::vector<Batch> batches;
+  for (auto& keys : keys_per_bucket) {
+    for (size_t start = 0; start < keys.second.size();
+         start += max_keys_per_request) {
+      const size_t end =
+          std::min(start + max_keys_per_request, keys.second.size());
+      batches.emplace_back(Batch{
+          keys.first,
+          {keys.second.begin() + start, keys.second.begin() + end}});
+    }
+  }
+
+  // Delete the batches in parallel.
+  auto status =
+      parallel_for(vfs_thread_pool_, 0, batches.size(), [&](size_t i) {
+        Aws::S3::Model::Delete to_delete;
+        to_delete.SetObjects(std::move(batches[i].objects_));
+        to_delete.SetQuiet(true);
+
+        Aws::S3::Model::DeleteObjectsRequest delete_objects_request;
+        delete_objects_request.SetBucket(batches[i].bucket_.c_str());
+        delete_objects_request.SetDelete(std::move(to_delete));
+        if (request_payer_ != Aws::S3::Model::RequestPayer::NOT_SET)
+          delete_objects_request.SetRequestPayer(request_payer_);
+
+        auto delete_objects_outcome =
+            client_->DeleteObjects(delete_objects_request);
+        if (!delete_objects_outcome.IsSuccess()) {
+          return LOG_STATUS(Status_S3Error(
+              std::string("Failed to delete S3 objects: ") +
+              outcome_error_message(delete_objects_outcome)));
+        }
+
+        // In quiet mode, the result only lists the keys that failed.
+        const auto& errors = delete_objects_outcome.GetResult().GetErrors();
+        if (!errors.empty()) {
+          return LOG_STATUS(Status_S3Error(
+              std::string("Failed to delete S3 object '") +
+              errors[0].GetKey().c_str() + "': " +
+              errors[0].GetMessage().c_str()));
+        }
+
+        return Status::Ok();
+      });
+  RETURN_NOT_OK(status);
+
+  return Status::Ok();
+}
+
 Status S3::remove_dir(const URI& uri) const {
   RETURN_NOT_OK(init_client());
 
@@ -1460,19 +1671,50 @@ Status S3::init_client() const {
       s3_params_.connect_max_tries_,
       s3_params_.connect_scale_factor_);
 
+  // Process-wide cache of credentials providers, keyed on the
+  // authentication portion of the config. A new S3 instance with the same
+  // credentials config reuses the already resolved provider (e.g. an
+  // instance-profile credential chain) instead of resolving it from
+  // scratch, which dominates the cold-start cost of short-lived contexts.
+  static std::mutex credentials_cache_mtx;
+  static std::unordered_map<
+      std::string,
+      shared_ptr<Aws::Auth::AWSCredentialsProvider>>
+      credentials_cache;
+
+  const std::string credentials_key =
+      s3_config_source + '\0' + s3_params_.aws_access_key_id_ + '\0' +
+      s3_params_.aws_secret_access_key_ + '\0' + s3_params_.aws_session_token_ +
+      '\0' + s3_params_.aws_role_arn_ + '\0' + s3_params_.aws_external_id_ +
+      '\0' + s3_params_.aws_load_frequency_ + '\0' +
+      s3_params_.aws_session_name_ + '\0' +
+      (s3_params_.no_sign_request_ ? "1" : "0");
+  {
+    std::lock_guard<std::mutex> cache_lck(credentials_cache_mtx);
+    auto it = credentials_cache.find(credentials_key);
+    if (it != credentials_cache.end()) {
+      credentials_provider_ = it->second;
+    }
+  }
+
   // If the user says not to sign a request, use the
   // AnonymousAWSCredentialsProvider This is equivalent to --no-sign-request on
   // the aws cli
-  if (s3_params_.no_sign_request_) {
+  if (credentials_provider_ == nullptr && s3_params_.no_sign_request_) {
     credentials_provider_ =
         make_shared<Aws::Auth::AnonymousAWSCredentialsProvider>(HERE());
-  } else {  // Check other authentication methods
+  } else if (credentials_provider_ == nullptr) {
+    // Check other authentication methods
     switch ((!s3_params_.aws_access_key_id_.empty() ? 1 : 0) +
             (!s3_params_.aws_secret_access_key_.empty() ? 2 : 0) +
             (!s3_params_.aws_role_arn_.empty() ? 4 : 0) +
             (s3_config_source == "config_files" ? 8 : 0) +
             (s3_config_source == "sts_profile_with_web_identity" ? 16 : 0)) {
       case 0:
+        // Create the default provider chain explicitly, so that the
+        // resolved chain can be cached and shared across instances.
+        credentials_provider_ =
+            make_shared<Aws::Auth::DefaultAWSCredentialsProviderChain>(HERE());
         break;
       case 1:
       case 2:
@@ -1548,6 +1790,13 @@ Status S3::init_client() const {
     }
   }
 
+  // Cache the provider for reuse by future S3 instances with the same
+  // credentials config.
+  if (credentials_provider_ != nullptr) {
+    std::lock_guard<std::mutex> cache_lck(credentials_cache_mtx);
+    credentials_cache[credentials_key] = credentials_provider_;
+  }
+
   // The `Aws::S3::S3Client` constructor is not thread-safe. Although we
   // currently hold `client_init_mtx_` that protects this routine from threads
   // on this instance of `S3`, it is not sufficient protection from threads on
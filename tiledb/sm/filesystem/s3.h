@@ -41,6 +41,7 @@
 #include "tiledb/sm/buffer/buffer.h"
 #include "tiledb/sm/config/config.h"
 #include "tiledb/sm/curl/curl_init.h"
+#include "tiledb/sm/filesystem/ls_callback.h"
 #include "tiledb/sm/filesystem/s3_thread_pool_executor.h"
 #include "tiledb/sm/filesystem/ssl_config.h"
 #include "tiledb/sm/misc/constants.h"
@@ -69,6 +70,7 @@
 #include <aws/s3/model/CreateBucketRequest.h>
 #include <aws/s3/model/DeleteBucketRequest.h>
 #include <aws/s3/model/DeleteObjectRequest.h>
+#include <aws/s3/model/DeleteObjectsRequest.h>
 #include <aws/s3/model/GetBucketLocationRequest.h>
 #include <aws/s3/model/GetObjectRequest.h>
 #include <aws/s3/model/HeadBucketRequest.h>
@@ -123,6 +125,7 @@ struct S3Parameters {
       , use_virtual_addressing_(config.get<bool>(
             "vfs.s3.use_virtual_addressing", Config::must_find))
       , skip_init_(config.get<bool>("vfs.s3.skip_init", Config::must_find))
+      , eager_init_(config.get<bool>("vfs.s3.eager_init", Config::must_find))
       , use_multipart_upload_(
             config.get<bool>("vfs.s3.use_multipart_upload", Config::must_find))
       , max_parallel_ops_(
@@ -207,6 +210,9 @@ struct S3Parameters {
   /** Skip Aws::InitAPI for the S3 layer. */
   bool skip_init_;
 
+  /** Initialize the client eagerly in a background task at creation. */
+  bool eager_init_;
+
   /** Whether or not to use multipart upload. */
   bool use_multipart_upload_;
 
@@ -425,6 +431,22 @@ class S3 {
       const std::string& delimiter = "/",
       int max_paths = -1) const;
 
+  /**
+   * Lists objects and object information that start with `prefix`, invoking
+   * the callback on every entry as the listing pages arrive instead of
+   * materializing the full result. The callback returns `false` to stop the
+   * listing early.
+   *
+   * @param prefix The parent path to list sub-paths.
+   * @param cb The callback to invoke on every entry.
+   * @param delimiter The uri is truncated to the first delimiter.
+   * @return Status
+   */
+  Status ls_cb(
+      const URI& prefix,
+      const LsCallback& cb,
+      const std::string& delimiter = "/") const;
+
   /**
    * Renames an object.
    *
@@ -508,6 +530,17 @@ class S3 {
    */
   Status remove_object(const URI& uri) const;
 
+  /**
+   * Deletes the objects with the given URIs in bulk, sending DeleteObjects
+   * requests of up to 1000 keys per bucket in parallel. Unlike
+   * `remove_object`, this does not wait for each object to become invisible,
+   * as that would require one request per key again.
+   *
+   * @param uris The URIs of the objects to be deleted.
+   * @return Status
+   */
+  Status remove_objects(const std::vector<URI>& uris) const;
+
   /**
    * Deletes all objects with prefix `prefix/` (if the ending `/` does not
    * exist in `prefix`, it is added by the function.
@@ -910,6 +943,12 @@ class S3 {
   /** Pointer to thread pool owned by parent VFS instance. */
   ThreadPool* vfs_thread_pool_;
 
+  /**
+   * The background task eagerly initializing the client when
+   * `vfs.s3.eager_init` is set; waited on before destruction.
+   */
+  ThreadPool::Task preload_task_;
+
   /** Set the request payer for a s3 request. */
   Aws::S3::Model::RequestPayer request_payer_;
 
@@ -956,6 +995,25 @@ class S3 {
    */
   Status copy_object(const URI& old_uri, const URI& new_uri);
 
+  /**
+   * Reads a range of an object with a single ranged GET request.
+   * `S3::read` splits large reads across parallel invocations of
+   * this function.
+   *
+   * @param uri The URI of the object to be read.
+   * @param offset The offset in the object from which the read will start.
+   * @param buffer The buffer into which the data will be written.
+   * @param length The size of the data to be read from the object.
+   * @param length_returned Returns the total length read into `buffer`.
+   * @return Status
+   */
+  Status read_impl(
+      const URI& uri,
+      off_t offset,
+      void* buffer,
+      uint64_t length,
+      uint64_t* length_returned) const;
+
   /**
    * Fills the file buffer (given as an input `Buffer` object) from the
    * input binary `buffer`, up until the size of the file buffer becomes
@@ -34,6 +34,7 @@
 #include "path_win.h"
 #include "tiledb/common/logger_public.h"
 #include "tiledb/sm/buffer/buffer.h"
+#include "tiledb/sm/buffer/buffer_list.h"
 #include "tiledb/sm/enums/filesystem.h"
 #include "tiledb/sm/enums/vfs_mode.h"
 #include "tiledb/sm/filesystem/hdfs_filesystem.h"
@@ -43,8 +44,12 @@
 #include "tiledb/sm/stats/global_stats.h"
 #include "tiledb/sm/tile/tile.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <iostream>
 #include <list>
+#include <numeric>
 #include <sstream>
 #include <unordered_map>
 
@@ -64,6 +69,9 @@ VFS::VFS(
     const Config& config)
     : VFSBase(parent_stats)
     , S3_within_VFS(stats_, io_tp, config)
+#ifndef _WIN32
+    , posix_(config)
+#endif
     , config_(config)
     , compute_tp_(compute_tp)
     , io_tp_(io_tp)
@@ -73,8 +81,27 @@ VFS::VFS(
   assert(io_tp);
 
   // Construct the read-ahead cache.
-  read_ahead_cache_ = tdb_unique_ptr<ReadAheadCache>(
-      tdb_new(ReadAheadCache, vfs_params_.read_ahead_cache_size_));
+  read_ahead_cache_ = tdb_unique_ptr<ReadAheadCache>(tdb_new(
+      ReadAheadCache,
+      vfs_params_.read_ahead_cache_size_,
+      vfs_params_.read_ahead_size_,
+      vfs_params_.read_ahead_max_size_));
+
+  // Construct the persistent disk block cache, if enabled. A cache that
+  // cannot be constructed, e.g. because its directory cannot be created,
+  // only disables the caching.
+  if (vfs_params_.disk_cache_enable_ && !vfs_params_.disk_cache_dir_.empty()) {
+    try {
+      disk_cache_ = tdb_unique_ptr<DiskBlockCache>(tdb_new(
+          DiskBlockCache,
+          vfs_params_.disk_cache_dir_,
+          vfs_params_.disk_cache_size_));
+    } catch (const std::exception& e) {
+      LOG_WARN(
+          "Disk cache disabled; Cannot initialize directory '" +
+          vfs_params_.disk_cache_dir_ + "': " + e.what());
+    }
+  }
 
 #ifdef HAVE_HDFS
   supported_fs_.insert(Filesystem::HDFS);
@@ -107,8 +134,6 @@ VFS::VFS(
 
 #ifdef _WIN32
   throw_if_not_ok(win_.init(config_));
-#else
-  posix_ = Posix(config_);
 #endif
 
   supported_fs_.insert(Filesystem::MEMFS);
@@ -493,18 +518,44 @@ Status VFS::remove_file(const URI& uri) const {
 
 void VFS::remove_files(
     ThreadPool* compute_tp, const std::vector<URI>& uris) const {
-  throw_if_not_ok(parallel_for(compute_tp, 0, uris.size(), [&](size_t i) {
-    RETURN_NOT_OK(remove_file(uris[i]));
-    return Status::Ok();
-  }));
+#ifdef HAVE_S3
+  // S3 URIs are deleted through bulk DeleteObjects requests. The other
+  // backends have no native bulk delete, so they fall back to one delete
+  // per task below.
+  std::vector<URI> single_uris;
+  single_uris.reserve(uris.size());
+  std::vector<URI> s3_uris;
+  for (const auto& uri : uris) {
+    if (uri.is_s3()) {
+      s3_uris.emplace_back(uri);
+    } else {
+      single_uris.emplace_back(uri);
+    }
+  }
+
+  if (!s3_uris.empty()) {
+    throw_if_not_ok(s3_.remove_objects(s3_uris));
+  }
+#else
+  const std::vector<URI>& single_uris = uris;
+#endif
+
+  throw_if_not_ok(
+      parallel_for(compute_tp, 0, single_uris.size(), [&](size_t i) {
+        RETURN_NOT_OK(remove_file(single_uris[i]));
+        return Status::Ok();
+      }));
 }
 
 void VFS::remove_files(
     ThreadPool* compute_tp, const std::vector<TimestampedURI>& uris) const {
-  throw_if_not_ok(parallel_for(compute_tp, 0, uris.size(), [&](size_t i) {
-    RETURN_NOT_OK(remove_file(uris[i].uri_));
-    return Status::Ok();
-  }));
+  std::vector<URI> plain_uris;
+  plain_uris.reserve(uris.size());
+  for (const auto& uri : uris) {
+    plain_uris.emplace_back(uri.uri_);
+  }
+
+  remove_files(compute_tp, plain_uris);
 }
 
 Status VFS::max_parallel_ops(const URI& uri, uint64_t* ops) const {
@@ -807,6 +858,155 @@ tuple<Status, optional<std::vector<directory_entry>>> VFS::ls_with_sizes(
   return {Status::Ok(), entries};
 }
 
+Status VFS::ls_cb(const URI& parent, const LsCallback& cb) const {
+  stats_->add_counter("ls_num", 1);
+
+  // S3 supports streaming the listing callback natively through its
+  // paginated listing requests.
+  if (parent.is_s3()) {
+#ifdef HAVE_S3
+    return s3_.ls_cb(parent, cb);
+#else
+    return LOG_STATUS(Status_VFSError("TileDB was built without S3 support"));
+#endif
+  }
+
+  // The other backends fall back to a full listing.
+  auto&& [st, entries] = ls_with_sizes(parent);
+  RETURN_NOT_OK(st);
+
+  for (const auto& entry : *entries) {
+    if (!cb(entry)) {
+      break;
+    }
+  }
+
+  return Status::Ok();
+}
+
+Status VFS::ls_recursive(
+    const URI& parent, const LsCallback& cb, const std::string& suffix) const {
+  stats_->add_counter("ls_num", 1);
+
+  auto accept = [&suffix](const directory_entry& entry) {
+    if (suffix.empty()) {
+      return true;
+    }
+    const auto& path = entry.path().native();
+    return path.size() >= suffix.size() &&
+           path.compare(path.size() - suffix.size(), suffix.size(), suffix) ==
+               0;
+  };
+
+  // Object-store backends stream the whole subtree from a single flat
+  // (delimiter-less) paginated listing over the prefix, so the backend
+  // evaluates the prefix filter and no per-directory requests are issued.
+  if (parent.is_s3()) {
+#ifdef HAVE_S3
+    return s3_.ls_cb(
+        parent,
+        [&](const directory_entry& entry) {
+          return accept(entry) ? cb(entry) : true;
+        },
+        "");
+#else
+    return LOG_STATUS(Status_VFSError("TileDB was built without S3 support"));
+#endif
+  }
+
+  if (parent.is_azure() || parent.is_gcs()) {
+    Status st;
+    optional<std::vector<directory_entry>> entries;
+    if (parent.is_azure()) {
+#ifdef HAVE_AZURE
+      std::tie(st, entries) = azure_.ls_with_sizes(parent, "", -1);
+#else
+      st = LOG_STATUS(
+          Status_VFSError("TileDB was built without Azure support"));
+#endif
+    } else {
+#ifdef HAVE_GCS
+      std::tie(st, entries) = gcs_.ls_with_sizes(parent, "", -1);
+#else
+      st =
+          LOG_STATUS(Status_VFSError("TileDB was built without GCS support"));
+#endif
+    }
+    RETURN_NOT_OK(st);
+
+    for (const auto& entry : *entries) {
+      if (accept(entry) && !cb(entry)) {
+        break;
+      }
+    }
+
+    return Status::Ok();
+  }
+
+  // Hierarchical backends walk the tree, fanning the per-directory listings
+  // out over the I/O thread pool.
+  std::mutex tasks_mtx;
+  std::vector<ThreadPool::Task> tasks;
+  std::atomic<bool> stop(false);
+  std::function<Status(const URI&)> walk = [&](const URI& dir) -> Status {
+    if (stop) {
+      return Status::Ok();
+    }
+
+    auto&& [st, entries] = ls_with_sizes(dir);
+    RETURN_NOT_OK(st);
+
+    for (const auto& entry : *entries) {
+      if (stop) {
+        return Status::Ok();
+      }
+
+      if (entry.is_directory()) {
+        URI uri(entry.path().native());
+        std::lock_guard<std::mutex> lock(tasks_mtx);
+        tasks.push_back(io_tp_->execute([&walk, uri]() { return walk(uri); }));
+      } else if (accept(entry)) {
+        if (!cb(entry)) {
+          stop = true;
+          return Status::Ok();
+        }
+      }
+    }
+
+    return Status::Ok();
+  };
+
+  auto st = walk(parent);
+  if (!st.ok()) {
+    stop = true;
+  }
+
+  // The spawned tasks reference state on this stack, so always drain the
+  // pool fully before returning, preserving the first error. Tasks keep
+  // spawning tasks for nested directories, hence the loop.
+  while (true) {
+    std::vector<ThreadPool::Task> batch;
+    {
+      std::lock_guard<std::mutex> lock(tasks_mtx);
+      std::swap(batch, tasks);
+    }
+
+    if (batch.empty()) {
+      break;
+    }
+
+    auto batch_st = io_tp_->wait_all(batch);
+    if (!batch_st.ok()) {
+      stop = true;
+      if (st.ok()) {
+        st = batch_st;
+      }
+    }
+  }
+
+  return st;
+}
+
 Status VFS::move_file(const URI& old_uri, const URI& new_uri) {
   // If new_uri exists, delete it or raise an error based on `force`
   bool is_file;
@@ -1148,11 +1348,23 @@ Status VFS::read(
   uint64_t num_ops =
       std::min(std::max(nbytes / min_parallel_size, uint64_t(1)), max_ops);
 
+  // On remote backends, let the feedback controller tighten the split
+  // further based on the throughput observed for this backend and
+  // request-size class.
+  const bool adapt_ops = vfs_params_.adaptive_parallel_ops_ && num_ops > 1 &&
+                         (uri.is_s3() || uri.is_azure() || uri.is_gcs());
+  std::string adaptive_key;
+  if (adapt_ops) {
+    adaptive_key = AdaptiveMaxOps::key(uri, nbytes);
+    num_ops = std::min(num_ops, adaptive_max_ops_.depth(adaptive_key, max_ops));
+  }
+
   if (num_ops == 1) {
     return read_impl(uri, offset, buffer, nbytes, use_read_ahead);
   } else {
     // we don't want read-ahead when performing random access reads
     use_read_ahead = false;
+    const auto start = std::chrono::steady_clock::now();
     std::vector<ThreadPool::Task> results;
     uint64_t thread_read_nbytes = utils::math::ceil(nbytes, num_ops);
 
@@ -1186,19 +1398,170 @@ Status VFS::read(
              << st.message();
       return LOG_STATUS(Status_VFSError(errmsg.str()));
     }
+
+    // Feed the observed throughput back to the controller.
+    if (adapt_ops) {
+      const std::chrono::duration<double> elapsed =
+          std::chrono::steady_clock::now() - start;
+      adaptive_max_ops_.observe(
+          adaptive_key, nbytes, elapsed.count(), max_ops, stats_);
+    }
+
     return st;
   }
 }
 
+Status VFS::read_multi_region(
+    const URI& uri,
+    const std::vector<std::tuple<uint64_t, void*, uint64_t>>& regions) {
+  if (regions.empty()) {
+    return Status::Ok();
+  }
+
+#ifndef _WIN32
+  // On local files with io_uring enabled, submit all regions to the kernel
+  // in one batch instead of coalescing: the kernel issues them concurrently
+  // without dedicating a thread to each read.
+  if (uri.is_file() && posix_.use_io_uring()) {
+    stats_->add_counter("read_ops_num", regions.size());
+    return posix_.read_regions(uri.to_path(), regions);
+  }
+#endif
+
+  // Get the batching parameters.
+  bool found = false;
+  uint64_t min_batch_size = 0, min_batch_gap = 0, max_batch_size = 0;
+  RETURN_NOT_OK(
+      config_.get<uint64_t>("vfs.min_batch_size", &min_batch_size, &found));
+  assert(found);
+  RETURN_NOT_OK(
+      config_.get<uint64_t>("vfs.min_batch_gap", &min_batch_gap, &found));
+  assert(found);
+  RETURN_NOT_OK(
+      config_.get<uint64_t>("vfs.max_batch_size", &max_batch_size, &found));
+  assert(found);
+
+  // Sort the region indices on offset so that adjacent regions can be
+  // coalesced into batches.
+  std::vector<size_t> idx(regions.size());
+  std::iota(idx.begin(), idx.end(), 0);
+  std::sort(idx.begin(), idx.end(), [&regions](size_t a, size_t b) {
+    return std::get<0>(regions[a]) < std::get<0>(regions[b]);
+  });
+
+  // Coalesce the regions into batches, following the same batching rules
+  // as the reader data blocks: extend the current batch while it is below
+  // the minimum batch size or the gap to the next region is small enough,
+  // and never exceed the maximum batch size.
+  struct Batch {
+    uint64_t offset_;
+    uint64_t size_;
+    std::vector<size_t> regions_;
+  };
+  std::vector<Batch> batches;
+  for (auto i : idx) {
+    const uint64_t offset = std::get<0>(regions[i]);
+    const uint64_t nbytes = std::get<2>(regions[i]);
+    if (!batches.empty()) {
+      auto& b = batches.back();
+      const uint64_t batch_end = b.offset_ + b.size_;
+      const uint64_t new_size =
+          std::max(b.size_, offset + nbytes - b.offset_);
+      const uint64_t gap = offset > batch_end ? offset - batch_end : 0;
+      if (new_size <= max_batch_size &&
+          (new_size <= min_batch_size || gap <= min_batch_gap)) {
+        // Extend the current batch.
+        b.size_ = new_size;
+        b.regions_.emplace_back(i);
+        continue;
+      }
+    }
+    batches.push_back({offset, nbytes, {i}});
+  }
+
+  stats_->add_counter("read_multi_region_batch_num", batches.size());
+
+  // Read all batches in parallel.
+  std::vector<ThreadPool::Task> tasks;
+  tasks.reserve(batches.size());
+  for (auto& b : batches) {
+    auto task = cancelable_tasks_.execute(io_tp_, [this, &uri, &regions, &b]() {
+      // A batch with a single region can be read directly into the
+      // caller's buffer.
+      if (b.regions_.size() == 1) {
+        const auto& [offset, buffer, nbytes] = regions[b.regions_.front()];
+        return read(uri, offset, buffer, nbytes, false);
+      }
+
+      // Otherwise read the whole batch once and scatter the regions back
+      // into the caller's buffers.
+      Buffer batch_buffer;
+      RETURN_NOT_OK(batch_buffer.realloc(b.size_));
+      RETURN_NOT_OK(read(uri, b.offset_, batch_buffer.data(), b.size_, false));
+      for (auto r : b.regions_) {
+        const auto& [offset, buffer, nbytes] = regions[r];
+        std::memcpy(
+            buffer,
+            static_cast<char*>(batch_buffer.data()) + (offset - b.offset_),
+            nbytes);
+      }
+      return Status::Ok();
+    });
+    tasks.push_back(std::move(task));
+  }
+
+  Status st = io_tp_->wait_all(tasks);
+  if (!st.ok()) {
+    std::stringstream errmsg;
+    errmsg << "VFS multi-region read error '" << uri.to_string() << "'; "
+           << st.message();
+    return LOG_STATUS(Status_VFSError(errmsg.str()));
+  }
+  return st;
+}
+
 Status VFS::read_impl(
     const URI& uri,
     const uint64_t offset,
     void* const buffer,
     const uint64_t nbytes,
-    [[maybe_unused]] const bool use_read_ahead) {
+    const bool use_read_ahead) {
   stats_->add_counter("read_ops_num", 1);
   log_read(uri, offset, nbytes);
 
+  // Try the persistent local disk block cache for remote backends.
+  const bool use_disk_cache = disk_cache_ != nullptr &&
+                              (uri.is_s3() || uri.is_azure() || uri.is_gcs());
+  if (use_disk_cache) {
+    bool success = false;
+    RETURN_NOT_OK(disk_cache_->read(uri, offset, buffer, nbytes, &success));
+    if (success) {
+      stats_->add_counter("disk_cache_hit_" + uri.backend_name(), 1);
+      return Status::Ok();
+    }
+    stats_->add_counter("disk_cache_miss_" + uri.backend_name(), 1);
+  }
+
+  RETURN_NOT_OK(read_backend(uri, offset, buffer, nbytes, use_read_ahead));
+
+  // Spill the block to the disk cache; a failed spill only loses the
+  // caching.
+  if (use_disk_cache) {
+    Status st = disk_cache_->insert(uri, offset, buffer, nbytes);
+    if (!st.ok()) {
+      LOG_WARN("Disk cache error; Cannot cache block: " + st.message());
+    }
+  }
+
+  return Status::Ok();
+}
+
+Status VFS::read_backend(
+    const URI& uri,
+    const uint64_t offset,
+    void* const buffer,
+    const uint64_t nbytes,
+    [[maybe_unused]] const bool use_read_ahead) {
   // We only check to use the read-ahead cache for cloud-storage
   // backends.
 
@@ -1291,16 +1654,21 @@ Status VFS::read_ahead_impl(
   if (!use_read_ahead)
     return read_fn(uri, offset, buffer, nbytes, 0, &nbytes_read);
 
+  // Record the access and fetch the adaptive read-ahead window for this
+  // file. Sequential runs grow the window; random accesses keep it at
+  // the configured base size.
+  const uint64_t window = read_ahead_cache_->access_window(uri, offset, nbytes);
+
   // Only perform a read-ahead if the requested read size
-  // is smaller than the size of the buffers in the read-ahead
-  // cache. This is because:
+  // is smaller than the read-ahead window for this file.
+  // This is because:
   // 1. The read-ahead is primarily beneficial for IO patterns
   //    that consist of numerous small reads.
   // 2. Large reads may evict cached buffers that would be useful
   //    to a future small read.
   // 3. It saves us a copy. We must make a copy of the buffer at
   //    some point (one for the user, one for the cache).
-  if (nbytes >= vfs_params_.read_ahead_size_)
+  if (nbytes >= window)
     return read_fn(uri, offset, buffer, nbytes, 0, &nbytes_read);
 
   // Avoid a read if the requested buffer can be read from the
@@ -1310,18 +1678,21 @@ Status VFS::read_ahead_impl(
   // Additionally, we do not perform readahead with HDFS.
   bool success;
   RETURN_NOT_OK(read_ahead_cache_->read(uri, offset, buffer, nbytes, &success));
-  if (success)
+  if (success) {
+    stats_->add_counter("read_ahead_hit_" + uri.backend_name(), 1);
     return Status::Ok();
+  }
+  stats_->add_counter("read_ahead_miss_" + uri.backend_name(), 1);
 
   // We will read directly into the read-ahead buffer and then copy
   // the subrange of this buffer back to the user to satisfy the
   // read request.
   Buffer ra_buffer;
-  RETURN_NOT_OK(ra_buffer.realloc(vfs_params_.read_ahead_size_));
+  RETURN_NOT_OK(ra_buffer.realloc(window));
 
   // Calculate the exact number of bytes to populate `ra_buffer`
-  // with `vfs_params_.read_ahead_size_` bytes.
-  const uint64_t ra_nbytes = vfs_params_.read_ahead_size_ - nbytes;
+  // with `window` bytes.
+  const uint64_t ra_nbytes = window - nbytes;
 
   // Read into `ra_buffer`.
   RETURN_NOT_OK(
@@ -1564,6 +1935,32 @@ Status VFS::write(
       Status_VFSError("Unsupported URI schemes: " + uri.to_string()));
 }
 
+Status VFS::write(
+    const URI& uri,
+    const BufferList& buffers,
+    bool remote_global_order_write) {
+  // Gather the buffers with a single vectored write where the backend
+  // supports it.
+  if (uri.is_file()) {
+#ifndef _WIN32
+    stats_->add_counter("write_byte_num", buffers.total_size());
+    stats_->add_counter("write_ops_num", 1);
+    return posix_.write(uri, buffers);
+#endif
+  }
+
+  // The remaining backends buffer appends internally (e.g. into multipart
+  // upload parts on S3), so writing the buffers one by one does not incur
+  // extra copies.
+  for (uint64_t idx = 0; idx < buffers.num_buffers(); idx++) {
+    const Buffer* b = nullptr;
+    RETURN_NOT_OK(buffers.get_buffer(idx, &b));
+    RETURN_NOT_OK(write(uri, b->data(), b->size(), remote_global_order_write));
+  }
+
+  return Status::Ok();
+}
+
 std::pair<Status, std::optional<VFS::MultiPartUploadState>>
 VFS::multipart_upload_state(const URI& uri) {
   if (uri.is_file()) {
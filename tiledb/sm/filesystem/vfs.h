@@ -37,6 +37,7 @@
 #include <list>
 #include <set>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include "filesystem_base.h"
@@ -45,8 +46,10 @@
 #include "tiledb/common/macros.h"
 #include "tiledb/common/status.h"
 #include "tiledb/sm/buffer/buffer.h"
+#include "tiledb/sm/cache/disk_block_cache.h"
 #include "tiledb/sm/cache/lru_cache.h"
 #include "tiledb/sm/config/config.h"
+#include "tiledb/sm/filesystem/ls_callback.h"
 #include "tiledb/sm/filesystem/mem_filesystem.h"
 #include "tiledb/sm/misc/cancelable_tasks.h"
 #include "tiledb/sm/stats/stats.h"
@@ -78,6 +81,7 @@ using namespace tiledb::common;
 
 namespace tiledb::sm {
 
+class BufferList;
 class Tile;
 
 enum class Filesystem : uint8_t;
@@ -103,9 +107,16 @@ struct VFSParameters {
   VFSParameters(const Config& config)
       : min_parallel_size_(
             config.get<uint64_t>("vfs.min_parallel_size").value())
+      , adaptive_parallel_ops_(
+            config.get<bool>("vfs.adaptive_parallel_ops").value())
       , read_ahead_cache_size_(
             config.get<uint64_t>("vfs.read_ahead_cache_size").value())
       , read_ahead_size_(config.get<uint64_t>("vfs.read_ahead_size").value())
+      , read_ahead_max_size_(
+            config.get<uint64_t>("vfs.read_ahead_max_size").value())
+      , disk_cache_enable_(config.get<bool>("vfs.disk_cache.enable").value())
+      , disk_cache_dir_(config.get<std::string>("vfs.disk_cache.dir").value())
+      , disk_cache_size_(config.get<uint64_t>("vfs.disk_cache.size").value())
       , read_logging_mode_(ReadLoggingMode::DISABLED) {
     auto log_mode = config.get<std::string>("vfs.read_logging_mode").value();
     if (log_mode == "") {
@@ -135,12 +146,33 @@ struct VFSParameters {
   /** The minimum number of bytes in a parallel operation. */
   uint64_t min_parallel_size_;
 
+  /**
+   * Whether the number of parallel operations a remote-backend read is
+   * split into is tuned at runtime from observed read throughput.
+   */
+  bool adaptive_parallel_ops_;
+
   /** The byte size of the read-ahead cache. */
   uint64_t read_ahead_cache_size_;
 
   /** The byte size to read-ahead for each read. */
   uint64_t read_ahead_size_;
 
+  /**
+   * The maximum byte size the adaptive read-ahead window may grow to for
+   * sequentially accessed files.
+   */
+  uint64_t read_ahead_max_size_;
+
+  /** Whether the persistent local disk block cache is enabled. */
+  bool disk_cache_enable_;
+
+  /** The directory the disk cache stores its block files in. */
+  std::string disk_cache_dir_;
+
+  /** The maximum byte size of the disk cache. */
+  uint64_t disk_cache_size_;
+
   /** The read logging mode to use. */
   ReadLoggingMode read_logging_mode_;
 };
@@ -428,6 +460,45 @@ class VFS : private VFSBase, S3_within_VFS {
   tuple<Status, optional<std::vector<filesystem::directory_entry>>>
   ls_with_sizes(const URI& parent) const;
 
+  /**
+   * Retrieves all the entries contained in the parent, invoking the callback
+   * on each entry as the results arrive from the backend instead of
+   * materializing the full listing. The callback returns `false` to stop the
+   * listing early. Backends without native paginated listing fall back to a
+   * full listing.
+   *
+   * @param parent The target directory to list.
+   * @param cb The callback to invoke on every entry.
+   * @return Status
+   */
+  Status ls_cb(const URI& parent, const LsCallback& cb) const;
+
+  /**
+   * Recursively lists all file entries under `parent`, invoking the
+   * callback on every entry as the results arrive. Object-store backends
+   * are listed with a single flat, paginated listing over the prefix, so
+   * the whole subtree streams from one request pipeline instead of one
+   * listing per directory level; hierarchical backends walk the directory
+   * tree, fanning the per-directory listings out over the I/O thread pool.
+   *
+   * Entries can be filtered by a path suffix, e.g. a file extension. The
+   * prefix filtering is the listing prefix itself and is evaluated by the
+   * backend where supported.
+   *
+   * The callback may be invoked concurrently on hierarchical backends and
+   * must be thread-safe. Returning `false` stops the listing early.
+   *
+   * @param parent The target directory to list.
+   * @param cb The callback to invoke on every file entry.
+   * @param suffix A path suffix the listed entries must end with. An empty
+   *     suffix lists all entries.
+   * @return Status
+   */
+  Status ls_recursive(
+      const URI& parent,
+      const LsCallback& cb,
+      const std::string& suffix = "") const;
+
   /**
    * Renames a file.
    *
@@ -481,6 +552,24 @@ class VFS : private VFSBase, S3_within_VFS {
       uint64_t nbytes,
       bool use_read_ahead = true);
 
+  /**
+   * Reads multiple regions from a single file. Regions are coalesced into
+   * batches following the same rules as the reader data blocks (see
+   * `vfs.min_batch_size`, `vfs.min_batch_gap` and `vfs.max_batch_size`)
+   * and the batches are read in parallel on the IO thread pool. This
+   * matters most for object stores such as S3, where every ranged GET
+   * carries a fixed request cost and latency, so fewer larger requests
+   * beat many small ones.
+   *
+   * @param uri The URI of the file.
+   * @param regions Regions to read, as (offset, destination buffer,
+   *     nbytes) tuples.
+   * @return Status
+   */
+  Status read_multi_region(
+      const URI& uri,
+      const std::vector<std::tuple<uint64_t, void*, uint64_t>>& regions);
+
   /** Checks if a given filesystem is supported. */
   bool supports_fs(Filesystem fs) const;
 
@@ -548,6 +637,25 @@ class VFS : private VFSBase, S3_within_VFS {
       uint64_t buffer_size,
       bool remote_global_order_write = false);
 
+  /**
+   * Writes the contents of a buffer list into a file, without first
+   * concatenating the buffers in memory.
+   *
+   * On posix filesystems the buffers are gathered with a vectored
+   * (`writev`-style) write. The object store backends append the buffers
+   * one by one into their internal write caches, which assemble the
+   * multipart upload parts.
+   *
+   * @param uri The URI of the file.
+   * @param buffers The buffers to write from.
+   * @param remote_global_order_write Remote global order write
+   * @return Status
+   */
+  Status write(
+      const URI& uri,
+      const BufferList& buffers,
+      bool remote_global_order_write = false);
+
   /**
    * Used in serialization to share the multipart upload state
    * among cloud executors during global order writes
@@ -642,14 +750,72 @@ class VFS : private VFSBase, S3_within_VFS {
     /*     CONSTRUCTORS & DESTRUCTORS    */
     /* ********************************* */
 
-    /** Constructor. */
-    ReadAheadCache(const uint64_t max_cached_buffers)
-        : LRUCache(max_cached_buffers) {
+    /**
+     * Constructor.
+     *
+     * @param max_cached_buffers The maximum total byte size of the cached
+     *     buffers.
+     * @param base_window The read-ahead window for files without a
+     *     detected sequential access pattern.
+     * @param max_window The maximum read-ahead window a sequential run
+     *     may grow the window to.
+     */
+    ReadAheadCache(
+        const uint64_t max_cached_buffers,
+        const uint64_t base_window,
+        const uint64_t max_window)
+        : LRUCache(max_cached_buffers)
+        , base_window_(base_window)
+        , max_window_(max_window) {
     }
 
     /** Destructor. */
     virtual ~ReadAheadCache() = default;
 
+    /**
+     * Records a read access on the input URI and returns the read-ahead
+     * window to use for it. The window starts at the base window and
+     * doubles, up to the maximum window, for every access that continues a
+     * sequential or fixed-stride run on the same file; any other access
+     * resets the window to the base window, so random reads never grow
+     * the read-ahead.
+     *
+     * @param uri The URI being read.
+     * @param offset The offset of the read.
+     * @param nbytes The number of bytes requested.
+     * @return The read-ahead window, in bytes.
+     */
+    uint64_t access_window(
+        const URI& uri, const uint64_t offset, const uint64_t nbytes) {
+      std::lock_guard<std::mutex> lg(patterns_mtx_);
+
+      // Bound the bookkeeping; patterns are cheap to re-learn.
+      if (patterns_.size() > max_patterns_) {
+        patterns_.clear();
+      }
+
+      auto& pattern = patterns_[uri.to_string()];
+      const int64_t stride = offset - pattern.last_offset_;
+      const bool sequential =
+          pattern.run_length_ > 0 &&
+          (offset == pattern.expected_offset_ ||
+           (stride > 0 && stride == pattern.last_stride_));
+
+      if (sequential) {
+        pattern.run_length_++;
+        pattern.window_ = std::min(pattern.window_ * 2, max_window_);
+      } else {
+        pattern.run_length_ = 1;
+        pattern.window_ = base_window_;
+      }
+
+      pattern.last_offset_ = offset;
+      pattern.last_stride_ = stride;
+      pattern.expected_offset_ = offset + nbytes;
+
+      return pattern.window_;
+    }
+
     /* ********************************* */
     /*                API                */
     /* ********************************* */
@@ -733,12 +899,182 @@ class VFS : private VFSBase, S3_within_VFS {
     }
 
    private:
+    /* ********************************* */
+    /*      PRIVATE TYPE DEFINITIONS     */
+    /* ********************************* */
+
+    /** The detected access pattern of a single URI. */
+    struct AccessPattern {
+      /** The offset of the last access. */
+      uint64_t last_offset_ = 0;
+
+      /** The offset one past the end of the last access. */
+      uint64_t expected_offset_ = 0;
+
+      /** The stride between the last two accesses. */
+      int64_t last_stride_ = 0;
+
+      /** The number of accesses in the current sequential run. */
+      uint64_t run_length_ = 0;
+
+      /** The current read-ahead window, in bytes. */
+      uint64_t window_ = 0;
+    };
+
     /* ********************************* */
     /*         PRIVATE ATTRIBUTES        */
     /* ********************************* */
 
+    /** The maximum number of tracked access patterns. */
+    static constexpr size_t max_patterns_ = 4096;
+
     // Protects LRUCache routines.
     std::mutex lru_mtx_;
+
+    /** The read-ahead window for files without a sequential pattern. */
+    uint64_t base_window_;
+
+    /** The maximum read-ahead window. */
+    uint64_t max_window_;
+
+    // Protects `patterns_`.
+    std::mutex patterns_mtx_;
+
+    /** The access pattern of each URI, keyed by its string. */
+    std::unordered_map<std::string, AccessPattern> patterns_;
+  };
+
+  /**
+   * A feedback controller that tunes the number of parallel operations a
+   * remote-backend read is split into. The controller keeps one depth per
+   * backend and request-size class, seeded with the configured per-backend
+   * maximum, and adjusts it from the throughput observed on completed
+   * reads: additive increase while throughput keeps improving,
+   * multiplicative decrease when it regresses (TCP-style AIMD). The depth
+   * each class has settled on is visible in the stats dump through the
+   * `adaptive_ops_depth_sum.<class>` and `adaptive_ops_batch_num.<class>`
+   * counters.
+   */
+  class AdaptiveMaxOps {
+   public:
+    /* ********************************* */
+    /*                API                */
+    /* ********************************* */
+
+    /**
+     * Returns the controller key of a read: the URI scheme plus the
+     * request-size class, e.g. `s3_small` or `gcs_large`.
+     *
+     * @param uri The URI being read.
+     * @param nbytes The number of bytes requested.
+     * @return The controller key.
+     */
+    static std::string key(const URI& uri, const uint64_t nbytes) {
+      auto scheme_end = uri.to_string().find(':');
+      return uri.to_string().substr(0, scheme_end) +
+             (nbytes < large_request_size_ ? "_small" : "_large");
+    }
+
+    /**
+     * Returns the current depth for the input key, clamped to the
+     * configured per-backend maximum. The depth of a key seen for the
+     * first time is the maximum, preserving the static behavior until
+     * feedback arrives.
+     *
+     * @param key The controller key of the read.
+     * @param max_ops The configured per-backend maximum.
+     * @return The number of parallel operations to use.
+     */
+    uint64_t depth(const std::string& key, const uint64_t max_ops) {
+      std::lock_guard<std::mutex> lg(mtx_);
+      auto& state = states_[key];
+      if (state.depth_ == 0) {
+        state.depth_ = max_ops;
+      }
+      return std::min(std::max(state.depth_, uint64_t(2)), max_ops);
+    }
+
+    /**
+     * Feeds the outcome of a completed read back to the controller and
+     * adjusts the depth of its class.
+     *
+     * @param key The controller key of the read.
+     * @param nbytes The number of bytes read.
+     * @param seconds The wall time the read took.
+     * @param max_ops The configured per-backend maximum.
+     * @param stats The stats to report the adjustments to.
+     */
+    void observe(
+        const std::string& key,
+        const uint64_t nbytes,
+        const double seconds,
+        const uint64_t max_ops,
+        stats::Stats* const stats) {
+      if (seconds <= 0.0) {
+        return;
+      }
+      const double throughput = static_cast<double>(nbytes) / seconds;
+
+      std::lock_guard<std::mutex> lg(mtx_);
+      auto& state = states_[key];
+      if (state.ewma_throughput_ == 0.0) {
+        // First observation; nothing to compare against yet.
+        state.ewma_throughput_ = throughput;
+      } else if (throughput >= state.ewma_throughput_ * (1.0 + increase_at_)) {
+        // Throughput is improving at the current depth; probe one deeper.
+        state.depth_ = std::min(state.depth_ + 1, max_ops);
+        stats->add_counter("adaptive_ops_increase_num", 1);
+      } else if (throughput <= state.ewma_throughput_ * (1.0 - decrease_at_)) {
+        // Throughput regressed; treat it as a congestion signal and back
+        // off sharply. The depth never drops below 2 so that batched
+        // reads, and with them the feedback loop, keep running.
+        state.depth_ = std::max(state.depth_ / 2, uint64_t(2));
+        stats->add_counter("adaptive_ops_decrease_num", 1);
+      }
+      state.ewma_throughput_ = ewma_alpha_ * throughput +
+                               (1.0 - ewma_alpha_) * state.ewma_throughput_;
+
+      // Expose the settled depth: the dump-time ratio of these counters is
+      // the average depth the class has been running at.
+      stats->add_counter("adaptive_ops_depth_sum." + key, state.depth_);
+      stats->add_counter("adaptive_ops_batch_num." + key, 1);
+    }
+
+   private:
+    /* ********************************* */
+    /*      PRIVATE TYPE DEFINITIONS     */
+    /* ********************************* */
+
+    /** The controller state of a single backend and size class. */
+    struct State {
+      /** The current number of parallel operations. */
+      uint64_t depth_ = 0;
+
+      /** The exponential moving average of the observed throughput. */
+      double ewma_throughput_ = 0.0;
+    };
+
+    /* ********************************* */
+    /*         PRIVATE ATTRIBUTES        */
+    /* ********************************* */
+
+    /** The request size, in bytes, where the large class begins. */
+    static constexpr uint64_t large_request_size_ = 64 * 1024 * 1024;
+
+    /** The relative throughput improvement that triggers an increase. */
+    static constexpr double increase_at_ = 0.10;
+
+    /** The relative throughput regression that triggers a decrease. */
+    static constexpr double decrease_at_ = 0.25;
+
+    /** The smoothing factor of the throughput moving average. */
+    static constexpr double ewma_alpha_ = 0.25;
+
+    /** Protects `states_`. */
+    std::mutex mtx_;
+
+    /** The controller state of each backend and size class. */
+    std::unordered_map<std::string, State> states_;
   };
 
   /* ********************************* */
@@ -790,6 +1126,15 @@ class VFS : private VFSBase, S3_within_VFS {
   /** The read-ahead cache. */
   tdb_unique_ptr<ReadAheadCache> read_ahead_cache_;
 
+  /**
+   * The persistent local disk block cache for remote backends, or
+   * `nullptr` when disabled.
+   */
+  tdb_unique_ptr<DiskBlockCache> disk_cache_;
+
+  /** The parallel-operations feedback controller for remote reads. */
+  AdaptiveMaxOps adaptive_max_ops_;
+
   /** The VFS configuration parameters. */
   VFSParameters vfs_params_;
 
@@ -817,6 +1162,23 @@ class VFS : private VFSBase, S3_within_VFS {
       uint64_t nbytes,
       bool use_read_ahead);
 
+  /**
+   * Dispatches a read to the backend of the URI scheme.
+   *
+   * @param uri The URI of the file.
+   * @param offset The offset where the read begins.
+   * @param buffer The buffer to read into.
+   * @param nbytes Number of bytes to read.
+   * @param use_read_ahead Whether to use the read-ahead cache.
+   * @return Status
+   */
+  Status read_backend(
+      const URI& uri,
+      uint64_t offset,
+      void* buffer,
+      uint64_t nbytes,
+      bool use_read_ahead);
+
   /**
    * Executes a read, using the read-ahead cache as necessary.
    *
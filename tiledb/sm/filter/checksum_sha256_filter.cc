@@ -45,6 +45,9 @@ using namespace tiledb::common;
 namespace tiledb {
 namespace sm {
 
+thread_local ThreadPool::TaskGroup*
+    ChecksumSHA256Filter::DeferredValidationScope::task_group_ = nullptr;
+
 ChecksumSHA256Filter::ChecksumSHA256Filter(Datatype filter_data_type)
     : Filter(FilterType::FILTER_CHECKSUM_SHA256, filter_data_type) {
 }
@@ -110,6 +113,13 @@ Status ChecksumSHA256Filter::run_reverse(
       "sm.skip_checksum_validation", &skip_validation, &found));
   assert(found);
 
+  // Fetch the deferred validation configuration parameter.
+  bool deferred_validation;
+  RETURN_NOT_OK(config.get<bool>(
+      "sm.deferred_checksum_validation", &deferred_validation, &found));
+  assert(found);
+  auto task_group = DeferredValidationScope::current_group();
+
   // Set output buffer to input buffer
   RETURN_NOT_OK(output->append_view(input));
 
@@ -164,12 +174,26 @@ Status ChecksumSHA256Filter::run_reverse(
     // against the real metadata and data Need to save the metadata offset
     // before we loop through to check it
     uint64_t offset_before_checksum = input_metadata->offset();
-    for (uint32_t i = 0; i < num_metadata_parts; i++) {
-      auto& checksum_details = metadata_checksums[i];
-      RETURN_NOT_OK(compare_checksum_part(
-          input_metadata,
-          checksum_details.first,
-          checksum_details.second.data()));
+    if (deferred_validation && task_group != nullptr) {
+      // Hand the comparisons off to the installed task group, advancing the
+      // offsets exactly as the synchronous path does so the trailing
+      // metadata view below is unchanged.
+      for (uint32_t i = 0; i < num_metadata_parts; i++) {
+        auto& checksum_details = metadata_checksums[i];
+        RETURN_NOT_OK(defer_checksum_part(
+            task_group,
+            input_metadata,
+            checksum_details.first,
+            std::move(checksum_details.second)));
+      }
+    } else {
+      for (uint32_t i = 0; i < num_metadata_parts; i++) {
+        auto& checksum_details = metadata_checksums[i];
+        RETURN_NOT_OK(compare_checksum_part(
+            input_metadata,
+            checksum_details.first,
+            checksum_details.second.data()));
+      }
     }
     // Reset input metadata back to offset only if there was metadata that we
     // read We check this to avoid the edge case where there was not metadata to
@@ -178,10 +202,21 @@ Status ChecksumSHA256Filter::run_reverse(
       input_metadata->set_offset(offset_before_checksum);
     }
 
-    for (uint32_t i = 0; i < num_data_parts; i++) {
-      auto& checksum_details = data_checksums[i];
-      RETURN_NOT_OK(compare_checksum_part(
-          input, checksum_details.first, checksum_details.second.data()));
+    if (deferred_validation && task_group != nullptr) {
+      for (uint32_t i = 0; i < num_data_parts; i++) {
+        auto& checksum_details = data_checksums[i];
+        RETURN_NOT_OK(defer_checksum_part(
+            task_group,
+            input,
+            checksum_details.first,
+            std::move(checksum_details.second)));
+      }
+    } else {
+      for (uint32_t i = 0; i < num_data_parts; i++) {
+        auto& checksum_details = data_checksums[i];
+        RETURN_NOT_OK(compare_checksum_part(
+            input, checksum_details.first, checksum_details.second.data()));
+      }
     }
   }
 
@@ -235,13 +270,38 @@ Status ChecksumSHA256Filter::compare_checksum_part(
     part->advance_offset(bytes_to_compare);
   }
 
+  return compare_checksum(
+      buffer_to_compare->data(), bytes_to_compare, checksum);
+}
+
+Status ChecksumSHA256Filter::defer_checksum_part(
+    ThreadPool::TaskGroup* task_group,
+    FilterBuffer* part,
+    uint64_t bytes_to_compare,
+    Buffer&& checksum) const {
+  // Copy out the bytes to compare; the part refers to chunk buffers that do
+  // not outlive unfiltering.
+  auto data = make_shared<Buffer>(HERE());
+  throw_if_not_ok(data->realloc(bytes_to_compare));
+  RETURN_NOT_OK(part->read(data->data(), bytes_to_compare));
+
+  task_group->execute(
+      [data, bytes_to_compare, checksum = std::move(checksum)]() {
+        return compare_checksum(
+            data->data(), bytes_to_compare, checksum.data());
+      });
+
+  return Status::Ok();
+}
+
+Status ChecksumSHA256Filter::compare_checksum(
+    const void* data, uint64_t nbytes, const void* checksum) {
   // Buffer to store the newly computed hash value for comparison
   tdb_unique_ptr<Buffer> computed_hash =
       tdb_unique_ptr<Buffer>(tdb_new(Buffer));
   throw_if_not_ok(computed_hash->realloc(Crypto::SHA256_DIGEST_BYTES));
 
-  RETURN_NOT_OK(Crypto::sha256(
-      buffer_to_compare->data(), bytes_to_compare, computed_hash.get()));
+  RETURN_NOT_OK(Crypto::sha256(data, nbytes, computed_hash.get()));
 
   if (std::memcmp(
           checksum, computed_hash->data(), Crypto::SHA256_DIGEST_BYTES) != 0) {
@@ -253,7 +313,8 @@ Status ChecksumSHA256Filter::compare_checksum_part(
       snprintf(&shastring[i * 2], 3, "%02x", (unsigned int)digest[i]);
     }
 
-    unsigned char* existing_digest = reinterpret_cast<unsigned char*>(checksum);
+    const unsigned char* existing_digest =
+        reinterpret_cast<const unsigned char*>(checksum);
     char shastring_existing[65];
     for (uint64_t i = 0; i < Crypto::SHA256_DIGEST_BYTES; ++i) {
       snprintf(
@@ -33,7 +33,9 @@
 #ifndef TILEDB_CHECKSUM_SHA256_FILTER_H
 #define TILEDB_CHECKSUM_SHA256_FILTER_H
 
+#include "tiledb/common/macros.h"
 #include "tiledb/common/status.h"
+#include "tiledb/common/thread_pool/thread_pool.h"
 #include "tiledb/sm/filter/filter.h"
 
 using namespace tiledb::common;
@@ -72,6 +74,49 @@ namespace sm {
  */
 class ChecksumSHA256Filter : public Filter {
  public:
+  /**
+   * Installs, for its lifetime, the task group that the checksum comparisons
+   * of the calling thread are handed off to when
+   * `sm.deferred_checksum_validation` is enabled. Readers install a scope
+   * around unfiltering and drain the group before returning results, so that
+   * a mismatch still fails the query while the comparisons themselves run
+   * off the unfiltering critical path.
+   */
+  class DeferredValidationScope {
+   public:
+    /**
+     * Constructor. Installs `task_group` as the calling thread's deferred
+     * validation group. `nullptr` leaves validation synchronous.
+     */
+    explicit DeferredValidationScope(ThreadPool::TaskGroup* task_group)
+        : previous_(task_group_) {
+      task_group_ = task_group;
+    }
+
+    /** Destructor. Restores the previously installed group. */
+    ~DeferredValidationScope() {
+      task_group_ = previous_;
+    }
+
+    DISABLE_COPY_AND_COPY_ASSIGN(DeferredValidationScope);
+    DISABLE_MOVE_AND_MOVE_ASSIGN(DeferredValidationScope);
+
+    /**
+     * Returns the task group installed on the calling thread, or `nullptr`
+     * if none is installed.
+     */
+    static ThreadPool::TaskGroup* current_group() {
+      return task_group_;
+    }
+
+   private:
+    /** The task group installed on the calling thread. */
+    static thread_local ThreadPool::TaskGroup* task_group_;
+
+    /** The previously installed group, restored on destruction. */
+    ThreadPool::TaskGroup* previous_;
+  };
+
   /**
    * Constructor.
    *
@@ -120,6 +165,37 @@ class ChecksumSHA256Filter : public Filter {
   Status compare_checksum_part(
       FilterBuffer* part, uint64_t bytes_to_compared, void* checksum) const;
 
+  /**
+   * Copies the next `bytes_to_compare` bytes of the part out of `part` and
+   * schedules the checksum comparison on `task_group`, advancing the part
+   * offset exactly as `compare_checksum_part` does. The copy is required
+   * because the part refers to chunk buffers that do not outlive
+   * unfiltering.
+   *
+   * @param task_group Task group to schedule the comparison on
+   * @param part Plaintext to checksum
+   * @param bytes_to_compare Size of bytes to checksum
+   * @param checksum Checksum to compare against
+   * @return Status
+   */
+  Status defer_checksum_part(
+      ThreadPool::TaskGroup* task_group,
+      FilterBuffer* part,
+      uint64_t bytes_to_compare,
+      Buffer&& checksum) const;
+
+  /**
+   * Computes the sha256 checksum of `data` and compares it against
+   * `checksum`, returning an error status on a mismatch.
+   *
+   * @param data Plaintext to checksum
+   * @param nbytes Size of bytes to checksum
+   * @param checksum Checksum to compare against
+   * @return Status
+   */
+  static Status compare_checksum(
+      const void* data, uint64_t nbytes, const void* checksum);
+
   /**
    * Compute and store the checksum
    *
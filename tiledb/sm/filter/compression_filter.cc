@@ -133,13 +133,15 @@ void CompressionFilter::dump(FILE* out) const {
 }
 
 CompressionFilter* CompressionFilter::clone_impl() const {
-  return tdb_new(
+  auto clone = tdb_new(
       CompressionFilter,
       compressor_,
       level_,
       filter_data_type_,
       reinterpret_datatype_,
       version_);
+  clone->zstd_dictionary_ = zstd_dictionary_;
+  return clone;
 }
 
 void CompressionFilter::set_compressor(Compressor compressor) {
@@ -147,6 +149,11 @@ void CompressionFilter::set_compressor(Compressor compressor) {
   type_ = compressor_to_filter(compressor);
 }
 
+void CompressionFilter::set_zstd_dictionary(
+    const std::vector<uint8_t>* dictionary) {
+  zstd_dictionary_ = dictionary;
+}
+
 void CompressionFilter::set_compression_level(int compressor_level) {
   level_ = compressor_level;
 }
@@ -340,6 +347,31 @@ Status CompressionFilter::run_reverse(
           *input, *input_metadata, offsets_tile, *output);
   }
 
+  // The part headers contain the exact uncompressed size of every part. Sum
+  // them up front so each owned output buffer is allocated exactly once
+  // instead of being reallocated part by part.
+  const uint64_t part_headers_offset = input_metadata->offset();
+  uint64_t total_metadata_size = 0;
+  uint64_t total_data_size = 0;
+  for (uint32_t i = 0; i < num_metadata_parts + num_data_parts; i++) {
+    uint32_t uncompressed_size, compressed_size;
+    RETURN_NOT_OK(input_metadata->read(&uncompressed_size, sizeof(uint32_t)));
+    RETURN_NOT_OK(input_metadata->read(&compressed_size, sizeof(uint32_t)));
+    if (i < num_metadata_parts) {
+      total_metadata_size += uncompressed_size;
+    } else {
+      total_data_size += uncompressed_size;
+    }
+  }
+  input_metadata->set_offset(part_headers_offset);
+
+  if (metadata_buffer->owns_data() && total_metadata_size != 0) {
+    RETURN_NOT_OK(metadata_buffer->realloc(total_metadata_size));
+  }
+  if (data_buffer->owns_data() && total_data_size != 0) {
+    RETURN_NOT_OK(data_buffer->realloc(total_data_size));
+  }
+
   for (uint32_t i = 0; i < num_metadata_parts; i++)
     RETURN_NOT_OK(
         decompress_part(tile, input, metadata_buffer, input_metadata));
@@ -367,7 +399,11 @@ Status CompressionFilter::compress_part(
       break;
     case Compressor::ZSTD:
       RETURN_NOT_OK(ZStd::compress(
-          level_, zstd_compress_ctx_pool_, &input_buffer, output));
+          level_,
+          zstd_compress_ctx_pool_,
+          &input_buffer,
+          output,
+          zstd_dictionary_));
       break;
     case Compressor::LZ4:
       RETURN_NOT_OK(LZ4::compress(level_, &input_buffer, output));
@@ -426,9 +462,13 @@ Status CompressionFilter::decompress_part(
   RETURN_NOT_OK(input_metadata->read(&uncompressed_size, sizeof(uint32_t)));
   RETURN_NOT_OK(input_metadata->read(&compressed_size, sizeof(uint32_t)));
 
-  // Ensure space in the output buffer if possible.
+  // Ensure space in the output buffer if possible. The caller allocates the
+  // total uncompressed size up front, so this only grows the buffer if the
+  // part headers were inconsistent.
   if (output->owns_data()) {
-    RETURN_NOT_OK(output->realloc(output->alloced_size() + uncompressed_size));
+    if (output->alloced_size() < output->offset() + uncompressed_size) {
+      RETURN_NOT_OK(output->realloc(output->offset() + uncompressed_size));
+    }
   } else if (output->offset() + uncompressed_size > output->size()) {
     return LOG_STATUS(Status_FilterError(
         "CompressionFilter error; output buffer too small."));
@@ -450,7 +490,10 @@ Status CompressionFilter::decompress_part(
       break;
     case Compressor::ZSTD:
       st = ZStd::decompress(
-          zstd_decompress_ctx_pool_, &input_buffer, &output_buffer);
+          zstd_decompress_ctx_pool_,
+          &input_buffer,
+          &output_buffer,
+          zstd_dictionary_);
       break;
     case Compressor::LZ4:
       st = LZ4::decompress(&input_buffer, &output_buffer);
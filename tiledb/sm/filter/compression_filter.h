@@ -152,10 +152,24 @@ class CompressionFilter : public Filter {
   /** Set the compression level used by this filter instance. */
   void set_compression_level(int compressor_level);
 
+  /**
+   * Set the trained zstd dictionary to compress or decompress with. The
+   * dictionary must outlive this filter instance. Only used when the
+   * compressor is zstd.
+   */
+  void set_zstd_dictionary(const std::vector<uint8_t>* dictionary);
+
  private:
   /** The compressor. */
   Compressor compressor_;
 
+  /**
+   * Optional trained zstd dictionary. Owned by the fragment metadata on
+   * reads and by the writer on writes, both of which outlive the filter
+   * pipeline copies that run on the tiles.
+   */
+  const std::vector<uint8_t>* zstd_dictionary_ = nullptr;
+
   /** The compression level. */
   int level_;
 
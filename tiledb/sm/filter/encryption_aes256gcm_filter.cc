@@ -99,17 +99,32 @@ Status EncryptionAES256GCMFilter::run_forward(
   RETURN_NOT_OK(output_metadata->write(&num_metadata_parts, sizeof(uint32_t)));
   RETURN_NOT_OK(output_metadata->write(&num_data_parts, sizeof(uint32_t)));
 
+  // Take a cipher context for this task, if the pool has been initialized.
+  // All parts of this input are encrypted with the same context, retaining
+  // the AES key schedule across parts.
+  Crypto::AES256GCM_Context* cipher_ctx = nullptr;
+  std::optional<
+      ResourceGuard<Crypto::AES256GCM_Context, BlockingResourcePool>>
+      ctx_guard;
+  if (encrypt_ctx_pool_ != nullptr) {
+    ctx_guard.emplace(*encrypt_ctx_pool_);
+    cipher_ctx = &ctx_guard->get();
+  }
+
   // Encrypt all parts
   for (auto& part : metadata_parts)
-    RETURN_NOT_OK(encrypt_part(&part, output_buf, output_metadata));
+    RETURN_NOT_OK(encrypt_part(&part, output_buf, output_metadata, cipher_ctx));
   for (auto& part : data_parts)
-    RETURN_NOT_OK(encrypt_part(&part, output_buf, output_metadata));
+    RETURN_NOT_OK(encrypt_part(&part, output_buf, output_metadata, cipher_ctx));
 
   return Status::Ok();
 }
 
 Status EncryptionAES256GCMFilter::encrypt_part(
-    ConstBuffer* part, Buffer* output, FilterBuffer* output_metadata) const {
+    ConstBuffer* part,
+    Buffer* output,
+    FilterBuffer* output_metadata,
+    Crypto::AES256GCM_Context* cipher_ctx) const {
   // Set up the key buffer.
   ConstBuffer key(key_bytes_, Crypto::AES256GCM_KEY_BYTES);
 
@@ -122,7 +137,7 @@ Status EncryptionAES256GCMFilter::encrypt_part(
   auto orig_size = (uint32_t)output->size();
 
   RETURN_NOT_OK(Crypto::encrypt_aes256gcm(
-      &key, nullptr, part, output, &output_iv, &output_tag));
+      &key, nullptr, part, output, &output_iv, &output_tag, cipher_ctx));
 
   if (output->size() > std::numeric_limits<uint32_t>::max())
     return LOG_STATUS(
@@ -163,17 +178,60 @@ Status EncryptionAES256GCMFilter::run_reverse(
   Buffer* metadata_buffer = output_metadata->buffer_ptr(0);
   assert(metadata_buffer != nullptr);
 
+  // The part headers contain the exact plaintext size of every part. Sum
+  // them up front so each owned output buffer is allocated exactly once
+  // instead of being reallocated part by part.
+  const uint64_t part_headers_offset = input_metadata->offset();
+  uint64_t total_metadata_size = 0;
+  uint64_t total_data_size = 0;
+  for (uint32_t i = 0; i < num_metadata_parts + num_data_parts; i++) {
+    uint32_t plaintext_size, encrypted_size;
+    RETURN_NOT_OK(input_metadata->read(&plaintext_size, sizeof(uint32_t)));
+    RETURN_NOT_OK(input_metadata->read(&encrypted_size, sizeof(uint32_t)));
+    input_metadata->advance_offset(
+        Crypto::AES256GCM_IV_BYTES + Crypto::AES256GCM_TAG_BYTES);
+    if (i < num_metadata_parts) {
+      total_metadata_size += plaintext_size;
+    } else {
+      total_data_size += plaintext_size;
+    }
+  }
+  input_metadata->set_offset(part_headers_offset);
+
+  if (metadata_buffer->owns_data() && total_metadata_size != 0) {
+    RETURN_NOT_OK(metadata_buffer->realloc(total_metadata_size));
+  }
+  if (data_buffer->owns_data() && total_data_size != 0) {
+    RETURN_NOT_OK(data_buffer->realloc(total_data_size));
+  }
+
+  // Take a cipher context for this task, if the pool has been initialized.
+  // All parts of this input are decrypted with the same context, retaining
+  // the AES key schedule across parts.
+  Crypto::AES256GCM_Context* cipher_ctx = nullptr;
+  std::optional<
+      ResourceGuard<Crypto::AES256GCM_Context, BlockingResourcePool>>
+      ctx_guard;
+  if (decrypt_ctx_pool_ != nullptr) {
+    ctx_guard.emplace(*decrypt_ctx_pool_);
+    cipher_ctx = &ctx_guard->get();
+  }
+
   // Decrypt all parts
   for (uint32_t i = 0; i < num_metadata_parts; i++)
-    RETURN_NOT_OK(decrypt_part(input, metadata_buffer, input_metadata));
+    RETURN_NOT_OK(
+        decrypt_part(input, metadata_buffer, input_metadata, cipher_ctx));
   for (uint32_t i = 0; i < num_data_parts; i++)
-    RETURN_NOT_OK(decrypt_part(input, data_buffer, input_metadata));
+    RETURN_NOT_OK(decrypt_part(input, data_buffer, input_metadata, cipher_ctx));
 
   return Status::Ok();
 }
 
 Status EncryptionAES256GCMFilter::decrypt_part(
-    FilterBuffer* input, Buffer* output, FilterBuffer* input_metadata) const {
+    FilterBuffer* input,
+    Buffer* output,
+    FilterBuffer* input_metadata,
+    Crypto::AES256GCM_Context* cipher_ctx) const {
   // Get original (plaintext) and encrypted sizes.
   uint32_t encrypted_size, plaintext_size;
   RETURN_NOT_OK(input_metadata->read(&plaintext_size, sizeof(uint32_t)));
@@ -190,9 +248,13 @@ Status EncryptionAES256GCMFilter::decrypt_part(
   ConstBuffer iv(iv_bytes, Crypto::AES256GCM_IV_BYTES),
       tag(tag_bytes, Crypto::AES256GCM_TAG_BYTES);
 
-  // Ensure space in the output buffer if possible.
+  // Ensure space in the output buffer if possible. The caller allocates the
+  // total plaintext size up front, so this only grows the buffer if the
+  // part headers were inconsistent.
   if (output->owns_data()) {
-    RETURN_NOT_OK(output->realloc(output->alloced_size() + plaintext_size));
+    if (output->alloced_size() < output->offset() + plaintext_size) {
+      RETURN_NOT_OK(output->realloc(output->offset() + plaintext_size));
+    }
   } else if (output->offset() + plaintext_size > output->size()) {
     return LOG_STATUS(
         Status_FilterError("Encryption error; output buffer too small."));
@@ -203,8 +265,8 @@ Status EncryptionAES256GCMFilter::decrypt_part(
   RETURN_NOT_OK(input->get_const_buffer(encrypted_size, &input_buffer));
 
   // Decrypt.
-  RETURN_NOT_OK(
-      Crypto::decrypt_aes256gcm(&key, &iv, &tag, &input_buffer, output));
+  RETURN_NOT_OK(Crypto::decrypt_aes256gcm(
+      &key, &iv, &tag, &input_buffer, output, cipher_ctx));
 
   input->advance_offset(encrypted_size);
 
@@ -239,5 +301,24 @@ Status EncryptionAES256GCMFilter::get_key(const void** key_bytes) const {
   return Status::Ok();
 }
 
+void EncryptionAES256GCMFilter::init_compression_resource_pool(uint64_t size) {
+  std::lock_guard g(encrypt_ctx_pool_mtx_);
+  if (encrypt_ctx_pool_ == nullptr) {
+    encrypt_ctx_pool_ =
+        make_shared<BlockingResourcePool<Crypto::AES256GCM_Context>>(
+            HERE(), size);
+  }
+}
+
+void EncryptionAES256GCMFilter::init_decompression_resource_pool(
+    uint64_t size) {
+  std::lock_guard g(decrypt_ctx_pool_mtx_);
+  if (decrypt_ctx_pool_ == nullptr) {
+    decrypt_ctx_pool_ =
+        make_shared<BlockingResourcePool<Crypto::AES256GCM_Context>>(
+            HERE(), size);
+  }
+}
+
 }  // namespace sm
 }  // namespace tiledb
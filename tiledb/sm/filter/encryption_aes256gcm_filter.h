@@ -34,7 +34,9 @@
 #define TILEDB_ENCRYPTION_AES256GCM_FILTER_H
 
 #include "tiledb/common/status.h"
+#include "tiledb/sm/crypto/crypto.h"
 #include "tiledb/sm/filter/filter.h"
+#include "tiledb/sm/misc/resource_pool.h"
 
 using namespace tiledb::common;
 
@@ -142,10 +144,38 @@ class EncryptionAES256GCMFilter : public Filter {
    */
   void set_key(const void* key_bytes);
 
+  /**
+   * Initializes the pool of reusable cipher contexts used by the forward
+   * (encryption) direction. Invoked by the filter pipeline before
+   * filtering chunks in parallel.
+   */
+  void init_compression_resource_pool(uint64_t size) override;
+
+  /**
+   * Initializes the pool of reusable cipher contexts used by the reverse
+   * (decryption) direction. Invoked by the filter pipeline before
+   * unfiltering chunks in parallel.
+   */
+  void init_decompression_resource_pool(uint64_t size) override;
+
  private:
   /** Pointer to a buffer storing the secret key. */
   const void* key_bytes_;
 
+  /** Mutex guarding encrypt_ctx_pool_. */
+  std::mutex encrypt_ctx_pool_mtx_;
+
+  /** Mutex guarding decrypt_ctx_pool_. */
+  std::mutex decrypt_ctx_pool_mtx_;
+
+  /** A pool of reusable cipher contexts for encryption. */
+  shared_ptr<BlockingResourcePool<Crypto::AES256GCM_Context>>
+      encrypt_ctx_pool_;
+
+  /** A pool of reusable cipher contexts for decryption. */
+  shared_ptr<BlockingResourcePool<Crypto::AES256GCM_Context>>
+      decrypt_ctx_pool_;
+
   /** Returns a new clone of this filter. */
   EncryptionAES256GCMFilter* clone_impl() const override;
 
@@ -155,10 +185,14 @@ class EncryptionAES256GCMFilter : public Filter {
    * @param input Ciphertext to decrypt
    * @param output Buffer to hold decrypted bytes
    * @param input_metadata Metadata about ciphertext
+   * @param cipher_ctx Reusable cipher context, or nullptr
    * @return Status
    */
   Status decrypt_part(
-      FilterBuffer* input, Buffer* output, FilterBuffer* input_metadata) const;
+      FilterBuffer* input,
+      Buffer* output,
+      FilterBuffer* input_metadata,
+      Crypto::AES256GCM_Context* cipher_ctx) const;
 
   /**
    * Encrypt the given input into the given output buffer.
@@ -166,10 +200,14 @@ class EncryptionAES256GCMFilter : public Filter {
    * @param input Plaintext to encrypt
    * @param output Buffer to hold encrypted bytes
    * @param output_metadata Metadata about ciphertext
+   * @param cipher_ctx Reusable cipher context, or nullptr
    * @return Status
    */
   Status encrypt_part(
-      ConstBuffer* part, Buffer* output, FilterBuffer* output_metadata) const;
+      ConstBuffer* part,
+      Buffer* output,
+      FilterBuffer* output_metadata,
+      Crypto::AES256GCM_Context* cipher_ctx) const;
 };
 
 }  // namespace sm
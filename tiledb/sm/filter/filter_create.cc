@@ -35,6 +35,7 @@
 #include "bit_width_reduction_filter.h"
 #include "bitshuffle_filter.h"
 #include "byteshuffle_filter.h"
+#include "checksum_crc32c_filter.h"
 #include "checksum_md5_filter.h"
 #include "checksum_sha256_filter.h"
 #include "compression_filter.h"
@@ -79,6 +80,8 @@ tiledb::sm::Filter* tiledb::sm::FilterCreate::make(FilterType type) {
       return tdb_new(tiledb::sm::ChecksumMD5Filter, Datatype::ANY);
     case tiledb::sm::FilterType::FILTER_CHECKSUM_SHA256:
       return tdb_new(tiledb::sm::ChecksumSHA256Filter, Datatype::ANY);
+    case tiledb::sm::FilterType::FILTER_CHECKSUM_CRC32C:
+      return tdb_new(tiledb::sm::ChecksumCRC32CFilter, Datatype::ANY);
     case tiledb::sm::FilterType::FILTER_SCALE_FLOAT:
       return tdb_new(tiledb::sm::FloatScalingFilter, Datatype::ANY);
     case tiledb::sm::FilterType::FILTER_XOR:
@@ -166,6 +169,8 @@ shared_ptr<tiledb::sm::Filter> tiledb::sm::FilterCreate::deserialize(
       return make_shared<ChecksumMD5Filter>(HERE(), datatype);
     case FilterType::FILTER_CHECKSUM_SHA256:
       return make_shared<ChecksumSHA256Filter>(HERE(), datatype);
+    case FilterType::FILTER_CHECKSUM_CRC32C:
+      return make_shared<ChecksumCRC32CFilter>(HERE(), datatype);
     case FilterType::FILTER_SCALE_FLOAT: {
       auto filter_config =
           deserializer.read<FloatScalingFilter::FilterConfig>();
@@ -377,6 +377,18 @@ Filter* FilterPipeline::get_filter(unsigned index) const {
   return filters_[index].get();
 }
 
+bool FilterPipeline::set_zstd_dictionary(
+    const std::vector<uint8_t>* dictionary) {
+  auto compression = get_filter<CompressionFilter>();
+  if (compression == nullptr ||
+      compression->compressor() != Compressor::ZSTD) {
+    return false;
+  }
+
+  compression->set_zstd_dictionary(dictionary);
+  return true;
+}
+
 uint32_t FilterPipeline::max_chunk_size() const {
   return max_chunk_size_;
 }
@@ -425,13 +437,18 @@ Status FilterPipeline::run_forward(
 }
 
 void FilterPipeline::run_reverse_generic_tile(
-    stats::Stats* stats, Tile& tile, const Config& config) const {
+    stats::Stats* stats,
+    Tile& tile,
+    ThreadPool* const compute_tp,
+    const Config& config) const {
   ChunkData chunk_data;
   tile.load_chunk_data(chunk_data);
-  for (unsigned c = 0; c < chunk_data.filtered_chunks_.size(); c++) {
-    throw_if_not_ok(
-        run_reverse(stats, &tile, nullptr, chunk_data, c, c + 1, 1, config));
-  }
+  const auto nchunks = chunk_data.filtered_chunks_.size();
+  const auto concurrency_level = compute_tp->concurrency_level();
+  throw_if_not_ok(parallel_for(compute_tp, 0, nchunks, [&](uint64_t c) {
+    return run_reverse(
+        stats, &tile, nullptr, chunk_data, c, c + 1, concurrency_level, config);
+  }));
   tile.clear_filtered_buffer();
 }
 
@@ -444,6 +461,12 @@ Status FilterPipeline::run_reverse(
     const uint64_t max_chunk_index,
     uint64_t concurrency_level,
     const Config& config) const {
+  // Initialize the decompression resource pools once per chunk range,
+  // rather than taking the pool lock once per chunk and filter.
+  for (const auto& f : filters_) {
+    f->init_decompression_resource_pool(concurrency_level);
+  }
+
   // Run each chunk through the entire pipeline.
   for (size_t i = min_chunk_index; i < max_chunk_index; i++) {
     auto& chunk = chunk_data.filtered_chunks_[i];
@@ -490,8 +513,6 @@ Status FilterPipeline::run_reverse(
             "read_unfiltered_byte_num", chunk.unfiltered_data_size_);
       }
 
-      f->init_decompression_resource_pool(concurrency_level);
-
       RETURN_NOT_OK(f->run_reverse(
           *tile,
           offsets_tile,
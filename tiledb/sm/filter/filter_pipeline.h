@@ -181,6 +181,16 @@ class FilterPipeline {
   /** Returns the maximum tile chunk size. */
   uint32_t max_chunk_size() const;
 
+  /**
+   * Sets a trained zstd dictionary on the zstd compression filter of this
+   * pipeline, if there is one. The dictionary must outlive the pipeline and
+   * any of its copies.
+   *
+   * @param dictionary The dictionary, or nullptr to unset.
+   * @return True if the pipeline has a zstd compression filter.
+   */
+  bool set_zstd_dictionary(const std::vector<uint8_t>* dictionary);
+
   /**
    * Runs the full pipeline on the given tile in the "forward" direction. The
    * forward direction is used during writes, and processes unfiltered (e.g.
@@ -232,14 +242,19 @@ class FilterPipeline {
       bool chunking = true) const;
 
   /**
-   * Runs the pipeline in reverse on the given generic tile.
+   * Runs the pipeline in reverse on the given generic tile. The chunks of
+   * the tile are processed in parallel on the input thread pool.
    *
    * @param reader_stats Stats to record in the function.
    * @param tile Current tile on which the filter pipeline is being run.
+   * @param compute_tp The thread pool for compute-bound tasks.
    * @param config Global config.
    */
   void run_reverse_generic_tile(
-      stats::Stats* stats, Tile& tile, const Config& config) const;
+      stats::Stats* stats,
+      Tile& tile,
+      ThreadPool* compute_tp,
+      const Config& config) const;
 
   /**
    * Run the given chunk range in reverse through the pipeline.
@@ -0,0 +1,185 @@
+/**
+ * @file   filter_pipeline_advisor.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class FilterPipelineAdvisor.
+ */
+
+#include "tiledb/sm/filter/filter_pipeline_advisor.h"
+#include "tiledb/sm/array_schema/array_schema.h"
+#include "tiledb/sm/enums/datatype.h"
+#include "tiledb/sm/filter/bit_width_reduction_filter.h"
+#include "tiledb/sm/filter/byteshuffle_filter.h"
+#include "tiledb/sm/filter/compression_filter.h"
+#include "tiledb/sm/misc/constants.h"
+#include "tiledb/sm/tile/tile.h"
+
+#include <cstring>
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/* ****************************** */
+/*            CONSTANTS           */
+/* ****************************** */
+
+const std::string FilterPipelineAdvisor::metadata_key_prefix =
+    "__tiledb_recommended_filters.";
+
+const uint64_t FilterPipelineAdvisor::max_sample_size = 4 * 1024 * 1024;
+
+/* ****************************** */
+/*          CONSTRUCTORS          */
+/* ****************************** */
+
+FilterPipelineAdvisor::FilterPipelineAdvisor(const ArraySchema& array_schema)
+    : array_schema_(array_schema) {
+}
+
+/* ****************************** */
+/*         PUBLIC METHODS         */
+/* ****************************** */
+
+void FilterPipelineAdvisor::sample_tile(
+    const std::string& name, const WriterTile& tile) {
+  // Only sample unfiltered data tiles of fixed-sized attributes. Var-sized
+  // attributes are skipped as trialing their pipelines also requires the
+  // offsets tile.
+  if (!array_schema_.is_attr(name) || array_schema_.var_size(name) ||
+      tile.filtered() || tile.size() == 0) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(mtx_);
+  if (samples_.count(name) != 0) {
+    return;
+  }
+
+  // Copy the sample, truncated to whole cells.
+  const auto cell_size = array_schema_.cell_size(name);
+  const auto sample_size =
+      (std::min(tile.size(), max_sample_size) / cell_size) * cell_size;
+  if (sample_size == 0) {
+    return;
+  }
+
+  auto& sample = samples_[name];
+  sample.type_ = array_schema_.type(name);
+  sample.cell_size_ = cell_size;
+  sample.data_.resize(sample_size);
+  std::memcpy(sample.data_.data(), tile.data(), sample_size);
+}
+
+bool FilterPipelineAdvisor::has_samples() const {
+  std::lock_guard<std::mutex> lock(mtx_);
+  return !samples_.empty();
+}
+
+std::vector<std::pair<std::string, std::string>>
+FilterPipelineAdvisor::compute_recommendations(
+    stats::Stats* stats, ThreadPool* compute_tp) const {
+  std::lock_guard<std::mutex> lock(mtx_);
+  std::vector<std::pair<std::string, std::string>> recommendations;
+
+  // Runs a pipeline on a copy of the sample and returns the filtered size,
+  // or nullopt if the pipeline cannot process the sample.
+  auto trial = [&](const Sample& sample,
+                   const FilterPipeline& pipeline) -> optional<uint64_t> {
+    WriterTile tile(
+        constants::format_version,
+        sample.type_,
+        sample.cell_size_,
+        sample.data_.size());
+    tile.write(sample.data_.data(), 0, sample.data_.size());
+    if (!pipeline.run_forward(stats, &tile, nullptr, compute_tp).ok()) {
+      return nullopt;
+    }
+    return tile.filtered_buffer().size();
+  };
+
+  for (const auto& [name, sample] : samples_) {
+    // The pipeline configured in the schema sets the size to beat.
+    auto best_size = trial(sample, array_schema_.filters(name));
+    std::string best_description;
+    for (const auto& candidate : candidate_pipelines(sample.type_)) {
+      const auto size = trial(sample, candidate.pipeline_);
+      if (size.has_value() &&
+          (!best_size.has_value() || *size < *best_size)) {
+        best_size = size;
+        best_description = candidate.description_;
+      }
+    }
+
+    if (!best_description.empty()) {
+      recommendations.emplace_back(name, best_description);
+    }
+  }
+
+  return recommendations;
+}
+
+std::vector<FilterPipelineAdvisor::Candidate>
+FilterPipelineAdvisor::candidate_pipelines(Datatype type) {
+  std::vector<Candidate> candidates;
+
+  auto add = [&](const std::string& description,
+                 std::initializer_list<const Filter*> filters) {
+    FilterPipeline pipeline;
+    for (const auto* filter : filters) {
+      pipeline.add_filter(*filter);
+    }
+    candidates.push_back({description, std::move(pipeline)});
+  };
+
+  const CompressionFilter gzip(Compressor::GZIP, -1, type);
+  const CompressionFilter zstd(Compressor::ZSTD, -1, type);
+  const CompressionFilter lz4(Compressor::LZ4, -1, type);
+  const CompressionFilter bzip2(Compressor::BZIP2, -1, type);
+  add("gzip", {&gzip});
+  add("zstd", {&zstd});
+  add("lz4", {&lz4});
+  add("bzip2", {&bzip2});
+
+  const ByteshuffleFilter byteshuffle(type);
+  add("byteshuffle+zstd", {&byteshuffle, &zstd});
+
+  if (datatype_is_integer(type)) {
+    const CompressionFilter double_delta(Compressor::DOUBLE_DELTA, -1, type);
+    add("double-delta", {&double_delta});
+
+    const BitWidthReductionFilter bit_width_reduction(type);
+    add("bit-width-reduction+zstd", {&bit_width_reduction, &zstd});
+  }
+
+  return candidates;
+}
+
+}  // namespace sm
+}  // namespace tiledb
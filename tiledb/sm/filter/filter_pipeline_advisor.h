@@ -0,0 +1,178 @@
+/**
+ * @file   filter_pipeline_advisor.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class FilterPipelineAdvisor.
+ */
+
+#ifndef TILEDB_FILTER_PIPELINE_ADVISOR_H
+#define TILEDB_FILTER_PIPELINE_ADVISOR_H
+
+#include "tiledb/common/common.h"
+#include "tiledb/sm/filter/filter_pipeline.h"
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+class ArraySchema;
+class WriterTile;
+
+namespace stats {
+class Stats;
+}
+
+/**
+ * Advises better filter pipelines for the attributes of an array, from data
+ * sampled during writes.
+ *
+ * The advisor is purely advisory: it never changes the pipelines used for
+ * the write. It keeps one sampled tile per fixed-sized attribute, trials a
+ * set of candidate pipelines on the samples and reports, per attribute, the
+ * candidate that filtered the sample to the smallest size. The writers
+ * record the recommendations in the array metadata, where users or tooling
+ * can pick them up to evolve the schema.
+ */
+class FilterPipelineAdvisor {
+ public:
+  /* ********************************* */
+  /*       PUBLIC TYPE DEFINITIONS     */
+  /* ********************************* */
+
+  /** A candidate pipeline together with its description. */
+  struct Candidate {
+    /** Human readable description, e.g. `byteshuffle+zstd`. */
+    std::string description_;
+
+    /** The pipeline to trial. */
+    FilterPipeline pipeline_;
+  };
+
+  /* ********************************* */
+  /*          PUBLIC CONSTANTS         */
+  /* ********************************* */
+
+  /**
+   * Prefix of the array metadata keys the recommendations are recorded
+   * under. The attribute name is appended to the prefix.
+   */
+  static const std::string metadata_key_prefix;
+
+  /** Maximum number of bytes sampled per attribute. */
+  static const uint64_t max_sample_size;
+
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param array_schema The schema of the array being written.
+   */
+  explicit FilterPipelineAdvisor(const ArraySchema& array_schema);
+
+  FilterPipelineAdvisor() = delete;
+
+  DISABLE_COPY_AND_COPY_ASSIGN(FilterPipelineAdvisor);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(FilterPipelineAdvisor);
+
+  /* ********************************* */
+  /*          PUBLIC METHODS           */
+  /* ********************************* */
+
+  /**
+   * Samples a tile for the given attribute, if no tile was sampled for it
+   * yet. Var-sized attributes and non-attribute fields are ignored. Safe to
+   * call from multiple threads.
+   *
+   * @param name Name of the attribute the tile belongs to.
+   * @param tile The unfiltered data tile to sample.
+   */
+  void sample_tile(const std::string& name, const WriterTile& tile);
+
+  /** Returns if any tiles were sampled. */
+  bool has_samples() const;
+
+  /**
+   * Trials the candidate pipelines on the sampled tiles and returns, per
+   * sampled attribute, the description of the candidate that filtered the
+   * sample to the smallest size. Attributes for which no candidate beats
+   * the pipeline configured in the schema are omitted.
+   *
+   * @param stats Stats to record filtering work in.
+   * @param compute_tp The thread pool for compute-bound tasks.
+   *
+   * @return Pairs of attribute name and recommended pipeline description.
+   */
+  std::vector<std::pair<std::string, std::string>> compute_recommendations(
+      stats::Stats* stats, ThreadPool* compute_tp) const;
+
+  /**
+   * Returns the candidate pipelines to trial for the given datatype.
+   *
+   * @param type Datatype of the attribute.
+   */
+  static std::vector<Candidate> candidate_pipelines(Datatype type);
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** A sampled tile. */
+  struct Sample {
+    /** Datatype of the sampled attribute. */
+    Datatype type_;
+
+    /** Cell size of the sampled attribute. */
+    uint64_t cell_size_;
+
+    /** Copy of the sampled tile data, truncated to whole cells. */
+    std::vector<uint8_t> data_;
+  };
+
+  /** The schema of the array being written. */
+  const ArraySchema& array_schema_;
+
+  /** Protects the samples. */
+  mutable std::mutex mtx_;
+
+  /** One sample per attribute. */
+  std::unordered_map<std::string, Sample> samples_;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_FILTER_PIPELINE_ADVISOR_H
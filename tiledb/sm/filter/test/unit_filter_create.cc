@@ -153,6 +153,23 @@ TEST_CASE(
   CHECK(filter1->type() == filtertype0);
 }
 
+TEST_CASE(
+    "Filter: Test checksum crc32c filter deserialization",
+    "[filter][checksum-crc32c]") {
+  FilterType filtertype0 = FilterType::FILTER_CHECKSUM_CRC32C;
+  char serialized_buffer[5];
+  char* p = &serialized_buffer[0];
+  buffer_offset<uint8_t, 0>(p) = static_cast<uint8_t>(filtertype0);
+  buffer_offset<uint32_t, 1>(p) = 0;  // metadata_length
+
+  Deserializer deserializer(&serialized_buffer, sizeof(serialized_buffer));
+  auto filter1{FilterCreate::deserialize(
+      deserializer, constants::format_version, Datatype::ANY)};
+
+  // Check type
+  CHECK(filter1->type() == filtertype0);
+}
+
 TEST_CASE(
     "Filter: Test encryption aes256gcm filter deserialization",
     "[filter][encryption-aes256gcm]") {
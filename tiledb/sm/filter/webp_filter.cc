@@ -125,74 +125,62 @@ Status WebpFilter::run_forward(
 
   int extent_y = extents_.first, extent_x = extents_.second,
       pixel_depth = format_ < WebpInputFormat::WEBP_RGBA ? 3 : 4;
+
+  // Encode through libwebp's advanced API rather than the one-shot
+  // helpers: it exposes multi-threaded segment encoding within a tile and
+  // imports the input colorspace with libwebp's SIMD-accelerated
+  // converters. The produced bitstream is unchanged, so data written
+  // either way reads back identically.
+  WebPConfig config;
+  if (!WebPConfigInit(&config)) {
+    throw StatusException(
+        Status_FilterError("Error initializing WebP encoder configuration"));
+  }
+  config.quality = quality_;
+  config.lossless = lossless_ ? 1 : 0;
+  config.thread_level = 1;
+  if (!WebPValidateConfig(&config)) {
+    throw StatusException(
+        Status_FilterError("Invalid WebP encoder configuration"));
+  }
+
   for (const auto& i : input_parts) {
     auto data = static_cast<const uint8_t*>(i.data());
-    // Number of bytes encoded; Encoded result data buffer.
-    size_t enc_size = 0;
-    uint8_t* result = nullptr;
+    WebPPicture picture;
+    if (!WebPPictureInit(&picture)) {
+      throw StatusException(
+          Status_FilterError("Error initializing WebP picture"));
+    }
+    // We divide extent_x by colorspace value count to get pixel-width of image,
+    // extent_x currently represents row stride.
+    picture.width = extent_x / pixel_depth;
+    picture.height = extent_y;
+    picture.use_argb = lossless_ ? 1 : 0;
+
+    WebPMemoryWriter writer;
+    WebPMemoryWriterInit(&writer);
+    picture.writer = WebPMemoryWrite;
+    picture.custom_ptr = &writer;
+
     // Cleanup allocated data when we leave scope.
     ScopedExecutor cleanup([&]() {
-      if (enc_size > 0 && result != nullptr)
-        WebPFree(result);
+      WebPPictureFree(&picture);
+      WebPMemoryWriterClear(&writer);
     });
-    // We divide extent_x by colorspace value count to get pixel-width of image,
-    // extent_x currently represents row stride.
+
+    int import_ok = 0;
     switch (format_) {
       case WebpInputFormat::WEBP_RGB:
-        if (lossless_) {
-          enc_size = WebPEncodeLosslessRGB(
-              data, extent_x / pixel_depth, extent_y, extent_x, &result);
-        } else {
-          enc_size = WebPEncodeRGB(
-              data,
-              extent_x / pixel_depth,
-              extent_y,
-              extent_x,
-              quality_,
-              &result);
-        }
+        import_ok = WebPPictureImportRGB(&picture, data, extent_x);
         break;
       case WebpInputFormat::WEBP_RGBA:
-        if (lossless_) {
-          enc_size = WebPEncodeLosslessRGBA(
-              data, extent_x / pixel_depth, extent_y, extent_x, &result);
-        } else {
-          enc_size = WebPEncodeRGBA(
-              data,
-              extent_x / pixel_depth,
-              extent_y,
-              extent_x,
-              quality_,
-              &result);
-        }
+        import_ok = WebPPictureImportRGBA(&picture, data, extent_x);
         break;
       case WebpInputFormat::WEBP_BGR:
-        if (lossless_) {
-          enc_size = WebPEncodeLosslessBGR(
-              data, extent_x / pixel_depth, extent_y, extent_x, &result);
-        } else {
-          enc_size = WebPEncodeBGR(
-              data,
-              extent_x / pixel_depth,
-              extent_y,
-              extent_x,
-              quality_,
-              &result);
-        }
+        import_ok = WebPPictureImportBGR(&picture, data, extent_x);
         break;
       case WebpInputFormat::WEBP_BGRA:
-        if (lossless_) {
-          enc_size = WebPEncodeLosslessBGRA(
-              data, extent_x / pixel_depth, extent_y, extent_x, &result);
-        } else {
-          enc_size = WebPEncodeBGRA(
-              data,
-              extent_x / pixel_depth,
-              extent_y,
-              extent_x,
-              quality_,
-              &result);
-        }
+        import_ok = WebPPictureImportBGRA(&picture, data, extent_x);
         break;
       case WebpInputFormat::WEBP_NONE:
         throw StatusException(Status_FilterError(
@@ -202,15 +190,21 @@ Status WebpFilter::run_forward(
             "Filter option TILEDB_FILTER_WEBP_FORMAT is invalid"));
     }
 
+    // Check if importing failed.
+    if (import_ok == 0) {
+      throw StatusException(Status_FilterError("Error importing image data"));
+    }
+
     // Check if encoding failed.
-    if (enc_size == 0) {
+    if (WebPEncode(&config, &picture) == 0) {
       throw StatusException(Status_FilterError("Error encoding image data"));
     }
 
     // Write encoded data to output buffer.
+    size_t enc_size = writer.size;
     throw_if_not_ok(output_metadata->write(&enc_size, sizeof(uint32_t)));
     throw_if_not_ok(output->prepend_buffer(enc_size));
-    throw_if_not_ok(output->write(result, enc_size));
+    throw_if_not_ok(output->write(writer.mem, enc_size));
   }
 
   return Status::Ok();
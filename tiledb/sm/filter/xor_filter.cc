@@ -157,19 +157,21 @@ Status XORFilter::xor_part(const ConstBuffer* part, Buffer* output) const {
     return Status::Ok();
   }
 
-  // Write starting element.
+  // Write the deltas directly into the output buffer. Each output element
+  // depends only on the input, so the loop carries no dependency and
+  // vectorizes, instead of paying for a bounds-checked 'Buffer::write'
+  // per element.
   const T* part_array = static_cast<const T*>(part->data());
-  RETURN_NOT_OK(output->write(part_array, sizeof(T)));
-  output->advance_offset(sizeof(T));
-
+  T* output_array = static_cast<T*>(output->cur_data());
+  output_array[0] = part_array[0];
   for (uint32_t j = 1; j < num_elems_in_part; ++j) {
-    T value = part_array[j] ^ part_array[j - 1];
-    RETURN_NOT_OK(output->write(&value, sizeof(T)));
+    output_array[j] = part_array[j] ^ part_array[j - 1];
+  }
 
-    if (j != num_elems_in_part - 1) {
-      output->advance_offset(sizeof(T));
-    }
+  if (output->owns_data()) {
+    output->advance_size(s);
   }
+  output->advance_offset(s);
 
   return Status::Ok();
 }
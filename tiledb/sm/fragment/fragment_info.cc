@@ -229,6 +229,134 @@ Status FragmentInfo::get_fragment_size(uint32_t fid, uint64_t* size) const {
   return Status::Ok();
 }
 
+Status FragmentInfo::get_attribute_sizes(
+    uint32_t fid,
+    const char* name,
+    uint64_t* persisted_size,
+    uint64_t* in_memory_size) {
+  ensure_loaded();
+  if (name == nullptr)
+    return LOG_STATUS(Status_FragmentInfoError(
+        "Cannot get attribute sizes; Name argument cannot be null"));
+
+  if (persisted_size == nullptr || in_memory_size == nullptr)
+    return LOG_STATUS(Status_FragmentInfoError(
+        "Cannot get attribute sizes; Size arguments cannot be null"));
+
+  if (fid >= fragment_num())
+    return LOG_STATUS(Status_FragmentInfoError(
+        "Cannot get attribute sizes; Invalid fragment index"));
+
+  auto meta = single_fragment_info_vec_[fid].meta();
+  const auto& schema = meta->array_schema();
+  if (!schema->is_field(name)) {
+    auto msg =
+        std::string(
+            "Cannot get attribute sizes; There is no attribute or dimension '") +
+        name + "'";
+    return LOG_STATUS(Status_FragmentInfoError(msg));
+  }
+
+  if (schema->is_dim(name) && !single_fragment_info_vec_[fid].sparse())
+    return LOG_STATUS(Status_FragmentInfoError(
+        "Cannot get attribute sizes; Dense fragments do not materialize "
+        "dimension tiles"));
+
+  if (meta->format_version() <= 2)
+    return LOG_STATUS(Status_FragmentInfoError(
+        "Cannot get attribute sizes; Unsupported fragment format version"));
+
+  auto var_size = schema->var_size(name);
+  auto nullable = schema->is_nullable(name);
+  std::vector<std::string> names = {name};
+  meta->load_tile_offsets(enc_key_, names);
+  if (var_size)
+    meta->load_tile_var_sizes(enc_key_, name);
+
+  uint64_t persisted = 0, in_memory = 0;
+  auto tile_num = meta->tile_num();
+  for (uint64_t t = 0; t < tile_num; t++) {
+    persisted += meta->persisted_tile_size(name, t);
+    in_memory += meta->tile_size(name, t);
+    if (var_size) {
+      persisted += meta->persisted_tile_var_size(name, t);
+      in_memory += meta->tile_var_size(name, t);
+    }
+    if (nullable) {
+      persisted += meta->persisted_tile_validity_size(name, t);
+      in_memory += meta->cell_num(t) * constants::cell_validity_size;
+    }
+  }
+
+  *persisted_size = persisted;
+  *in_memory_size = in_memory;
+
+  return Status::Ok();
+}
+
+Status FragmentInfo::get_tile_size_histogram(
+    uint32_t fid, const char* name, uint64_t* histogram, uint32_t bucket_num) {
+  ensure_loaded();
+  if (name == nullptr)
+    return LOG_STATUS(Status_FragmentInfoError(
+        "Cannot get tile size histogram; Name argument cannot be null"));
+
+  if (histogram == nullptr)
+    return LOG_STATUS(Status_FragmentInfoError(
+        "Cannot get tile size histogram; Histogram argument cannot be null"));
+
+  if (bucket_num == 0)
+    return LOG_STATUS(Status_FragmentInfoError(
+        "Cannot get tile size histogram; Bucket number cannot be zero"));
+
+  if (fid >= fragment_num())
+    return LOG_STATUS(Status_FragmentInfoError(
+        "Cannot get tile size histogram; Invalid fragment index"));
+
+  auto meta = single_fragment_info_vec_[fid].meta();
+  const auto& schema = meta->array_schema();
+  if (!schema->is_field(name)) {
+    auto msg = std::string(
+                   "Cannot get tile size histogram; There is no attribute or "
+                   "dimension '") +
+               name + "'";
+    return LOG_STATUS(Status_FragmentInfoError(msg));
+  }
+
+  if (schema->is_dim(name) && !single_fragment_info_vec_[fid].sparse())
+    return LOG_STATUS(Status_FragmentInfoError(
+        "Cannot get tile size histogram; Dense fragments do not materialize "
+        "dimension tiles"));
+
+  if (meta->format_version() <= 2)
+    return LOG_STATUS(Status_FragmentInfoError(
+        "Cannot get tile size histogram; Unsupported fragment format version"));
+
+  auto var_size = schema->var_size(name);
+  auto nullable = schema->is_nullable(name);
+  std::vector<std::string> names = {name};
+  meta->load_tile_offsets(enc_key_, names);
+
+  std::fill(histogram, histogram + bucket_num, 0);
+  auto tile_num = meta->tile_num();
+  for (uint64_t t = 0; t < tile_num; t++) {
+    auto tile_size = meta->persisted_tile_size(name, t);
+    if (var_size)
+      tile_size += meta->persisted_tile_var_size(name, t);
+    if (nullable)
+      tile_size += meta->persisted_tile_validity_size(name, t);
+
+    // Find b such that tile_size is in [2^b, 2^(b+1)), clamping to the
+    // last bucket.
+    uint32_t b = 0;
+    while (b + 1 < bucket_num && (tile_size >> (b + 1)) != 0)
+      b++;
+    histogram[b]++;
+  }
+
+  return Status::Ok();
+}
+
 Status FragmentInfo::get_fragment_uri(uint32_t fid, const char** uri) const {
   ensure_loaded();
   if (uri == nullptr)
@@ -743,6 +871,90 @@ Status FragmentInfo::get_mbr_var(
   return get_mbr_var(fid, mid, did, start, end);
 }
 
+Status FragmentInfo::get_min(
+    uint32_t fid, const char* name, const void** min, uint64_t* size) {
+  ensure_loaded();
+  if (min == nullptr || size == nullptr)
+    return LOG_STATUS(Status_FragmentInfoError(
+        "Cannot get fragment min; Output arguments cannot be null"));
+  if (name == nullptr)
+    return LOG_STATUS(Status_FragmentInfoError(
+        "Cannot get fragment min; Name argument cannot be null"));
+  if (fid >= fragment_num())
+    return LOG_STATUS(Status_FragmentInfoError(
+        "Cannot get fragment min; Invalid fragment index"));
+
+  auto meta = single_fragment_info_vec_[fid].meta();
+  meta->load_fragment_min_max_sum_null_count(enc_key_);
+  const auto& value = meta->get_min(name);
+  *min = value.data();
+  *size = value.size();
+
+  return Status::Ok();
+}
+
+Status FragmentInfo::get_max(
+    uint32_t fid, const char* name, const void** max, uint64_t* size) {
+  ensure_loaded();
+  if (max == nullptr || size == nullptr)
+    return LOG_STATUS(Status_FragmentInfoError(
+        "Cannot get fragment max; Output arguments cannot be null"));
+  if (name == nullptr)
+    return LOG_STATUS(Status_FragmentInfoError(
+        "Cannot get fragment max; Name argument cannot be null"));
+  if (fid >= fragment_num())
+    return LOG_STATUS(Status_FragmentInfoError(
+        "Cannot get fragment max; Invalid fragment index"));
+
+  auto meta = single_fragment_info_vec_[fid].meta();
+  meta->load_fragment_min_max_sum_null_count(enc_key_);
+  const auto& value = meta->get_max(name);
+  *max = value.data();
+  *size = value.size();
+
+  return Status::Ok();
+}
+
+Status FragmentInfo::get_sum(
+    uint32_t fid, const char* name, const void** sum) {
+  ensure_loaded();
+  if (sum == nullptr)
+    return LOG_STATUS(Status_FragmentInfoError(
+        "Cannot get fragment sum; Sum argument cannot be null"));
+  if (name == nullptr)
+    return LOG_STATUS(Status_FragmentInfoError(
+        "Cannot get fragment sum; Name argument cannot be null"));
+  if (fid >= fragment_num())
+    return LOG_STATUS(Status_FragmentInfoError(
+        "Cannot get fragment sum; Invalid fragment index"));
+
+  auto meta = single_fragment_info_vec_[fid].meta();
+  meta->load_fragment_min_max_sum_null_count(enc_key_);
+  *sum = meta->get_sum(name);
+
+  return Status::Ok();
+}
+
+Status FragmentInfo::get_null_count(
+    uint32_t fid, const char* name, uint64_t* null_count) {
+  ensure_loaded();
+  if (null_count == nullptr)
+    return LOG_STATUS(Status_FragmentInfoError(
+        "Cannot get fragment null count; Count argument cannot be null"));
+  if (name == nullptr)
+    return LOG_STATUS(Status_FragmentInfoError(
+        "Cannot get fragment null count; Name argument cannot be null"));
+  if (fid >= fragment_num())
+    return LOG_STATUS(Status_FragmentInfoError(
+        "Cannot get fragment null count; Invalid fragment index"));
+
+  auto meta = single_fragment_info_vec_[fid].meta();
+  meta->load_fragment_min_max_sum_null_count(enc_key_);
+  *null_count = meta->get_null_count(name);
+
+  return Status::Ok();
+}
+
 Status FragmentInfo::get_version(uint32_t fid, uint32_t* version) const {
   ensure_loaded();
   if (version == nullptr)
@@ -778,7 +990,7 @@ shared_ptr<ArraySchema> FragmentInfo::get_array_schema(uint32_t fid) {
 
   EncryptionKey encryption_key;
   return ArrayDirectory::load_array_schema_from_uri(
-      *resources_, schema_uri, encryption_key);
+      *resources_, array_uri_, schema_uri, encryption_key);
 }
 
 Status FragmentInfo::get_array_schema_name(
@@ -1020,7 +1232,9 @@ FragmentInfo::load_array_schemas_and_fragment_metadata(
     ContextResources& resources,
     const ArrayDirectory& array_dir,
     MemoryTracker* memory_tracker,
-    const EncryptionKey& enc_key) {
+    const EncryptionKey& enc_key,
+    const std::unordered_map<std::string, shared_ptr<FragmentMetadata>>&
+        preloaded_fragment_metadata) {
   auto timer_se = resources.stats().start_timer(
       "sm_load_array_schemas_and_fragment_metadata");
 
@@ -1031,6 +1245,28 @@ FragmentInfo::load_array_schemas_and_fragment_metadata(
   std::tie(array_schema_latest, array_schemas_all) =
       array_dir.load_array_schemas(enc_key);
 
+  auto&& fragment_metadata = load_fragment_metadata(
+      resources,
+      array_dir,
+      memory_tracker,
+      enc_key,
+      array_schema_latest,
+      array_schemas_all,
+      preloaded_fragment_metadata);
+
+  return {array_schema_latest, array_schemas_all, fragment_metadata};
+}
+
+std::vector<shared_ptr<FragmentMetadata>> FragmentInfo::load_fragment_metadata(
+    ContextResources& resources,
+    const ArrayDirectory& array_dir,
+    MemoryTracker* memory_tracker,
+    const EncryptionKey& enc_key,
+    const shared_ptr<ArraySchema>& array_schema_latest,
+    const std::unordered_map<std::string, shared_ptr<ArraySchema>>&
+        array_schemas_all,
+    const std::unordered_map<std::string, shared_ptr<FragmentMetadata>>&
+        preloaded_fragment_metadata) {
   const auto filtered_fragment_uris = [&]() {
     auto timer_se =
         resources.stats().start_timer("sm_load_filtered_fragment_uris");
@@ -1054,28 +1290,28 @@ FragmentInfo::load_array_schemas_and_fragment_metadata(
       }));
 
   // Get the unique fragment metadatas into a map.
-  std::unordered_map<std::string, std::pair<Tile*, uint64_t>> offsets;
+  std::unordered_map<std::string, std::pair<shared_ptr<Tile>, uint64_t>>
+      offsets;
   for (uint64_t i = 0; i < offsets_vectors.size(); i++) {
     for (auto& offset : offsets_vectors[i]) {
       if (offsets.count(offset.first) == 0) {
         offsets.emplace(
             offset.first,
-            std::make_pair(fragment_metadata_tiles[i].get(), offset.second));
+            std::make_pair(fragment_metadata_tiles[i], offset.second));
       }
     }
   }
 
   // Load the fragment metadata
-  auto&& fragment_metadata = FragmentMetadata::load(
+  return FragmentMetadata::load(
       resources,
       memory_tracker,
       array_schema_latest,
       array_schemas_all,
       enc_key,
       fragments_to_load,
-      offsets);
-
-  return {array_schema_latest, array_schemas_all, fragment_metadata};
+      offsets,
+      preloaded_fragment_metadata);
 }
 
 const std::vector<SingleFragmentInfo>& FragmentInfo::single_fragment_info_vec()
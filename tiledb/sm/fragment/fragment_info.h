@@ -113,6 +113,27 @@ class FragmentInfo {
   /** Retrieves the size of the fragment with the given index. */
   Status get_fragment_size(uint32_t fid, uint64_t* size) const;
 
+  /**
+   * Retrieves the persisted (on-disk, filtered) and in-memory (unfiltered)
+   * sizes in bytes of the given attribute or dimension in the fragment with
+   * the given index. The sizes cover the data, var-sized data and validity
+   * tiles of the attribute or dimension.
+   */
+  Status get_attribute_sizes(
+      uint32_t fid,
+      const char* name,
+      uint64_t* persisted_size,
+      uint64_t* in_memory_size);
+
+  /**
+   * Retrieves a histogram of the persisted (on-disk, filtered) tile sizes
+   * of the given attribute or dimension in the fragment with the given
+   * index. Bucket `i` counts the tiles with persisted size in
+   * `[2^i, 2^(i+1))` bytes; the last bucket also counts all larger tiles.
+   */
+  Status get_tile_size_histogram(
+      uint32_t fid, const char* name, uint64_t* histogram, uint32_t bucket_num);
+
   /** Retrieves the URI of the fragment with the given index. */
   Status get_fragment_uri(uint32_t fid, const char** uri) const;
 
@@ -225,6 +246,65 @@ class FragmentInfo {
   Status get_mbr_var(
       uint32_t fid, uint32_t mid, const char* dim_name, void* start, void* end);
 
+  /**
+   * Retrieves the fragment-level min value of the given attribute or
+   * dimension in the fragment with the given index. The value is the
+   * rollup of the per-tile min values written with the fragment
+   * metadata, so no tile data is read. Applicable only to fields that
+   * carry min/max metadata (fixed-size, single-value, non-UTF-8 types
+   * and var-sized strings).
+   *
+   * @param fid The fragment index.
+   * @param name The attribute/dimension name.
+   * @param min Set to the min value buffer.
+   * @param size Set to the size of the min value, in bytes.
+   */
+  Status get_min(
+      uint32_t fid, const char* name, const void** min, uint64_t* size);
+
+  /**
+   * Retrieves the fragment-level max value of the given attribute or
+   * dimension in the fragment with the given index. The value is the
+   * rollup of the per-tile max values written with the fragment
+   * metadata, so no tile data is read. Applicable only to fields that
+   * carry min/max metadata (fixed-size, single-value, non-UTF-8 types
+   * and var-sized strings).
+   *
+   * @param fid The fragment index.
+   * @param name The attribute/dimension name.
+   * @param max Set to the max value buffer.
+   * @param size Set to the size of the max value, in bytes.
+   */
+  Status get_max(
+      uint32_t fid, const char* name, const void** max, uint64_t* size);
+
+  /**
+   * Retrieves the fragment-level sum of the given attribute or dimension
+   * in the fragment with the given index. The sum is the rollup of the
+   * per-tile sums written with the fragment metadata, so no tile data is
+   * read. Applicable only to fields that carry sum metadata (fixed-size,
+   * single-value numeric types).
+   *
+   * @param fid The fragment index.
+   * @param name The attribute/dimension name.
+   * @param sum Set to the sum value; an int64, uint64 or double
+   *     depending on the field type.
+   */
+  Status get_sum(uint32_t fid, const char* name, const void** sum);
+
+  /**
+   * Retrieves the fragment-level null count of the given attribute or
+   * dimension in the fragment with the given index. The count is the
+   * rollup of the per-tile null counts written with the fragment
+   * metadata, so no tile data is read. Applicable only to nullable
+   * fields.
+   *
+   * @param fid The fragment index.
+   * @param name The attribute/dimension name.
+   * @param null_count Set to the null count.
+   */
+  Status get_null_count(uint32_t fid, const char* name, uint64_t* null_count);
+
   /** Retrieves the version of the fragment with the given index. */
   Status get_version(uint32_t fid, uint32_t* version) const;
 
@@ -308,6 +388,10 @@ class FragmentInfo {
    * @param memory_tracker The memory tracker of the array
    *     for which the fragment metadata is loaded.
    * @param enc_key The encryption key to use.
+   * @param preloaded_fragment_metadata A map from a fragment URI to
+   *     already loaded metadata for that fragment, e.g. retained from a
+   *     previous open of the same array. Fragments found in the map are
+   *     reused as-is instead of being loaded again.
    * @return tuple latest ArraySchema, map of all array schemas and
    * vector of FragmentMetadata
    *        ArraySchema The array schema to be retrieved after the
@@ -324,7 +408,39 @@ class FragmentInfo {
       ContextResources& resources,
       const ArrayDirectory& array_dir,
       MemoryTracker* memory_tracker,
-      const EncryptionKey& enc_key);
+      const EncryptionKey& enc_key,
+      const std::unordered_map<std::string, shared_ptr<FragmentMetadata>>&
+          preloaded_fragment_metadata = {});
+
+  /**
+   * Returns the fragment metadata for the given array, with the array
+   * schemas already loaded. Used when the schemas and the fragment metadata
+   * are loaded separately, e.g. when the metadata is loaded in the
+   * background after the array is opened.
+   *
+   * @param array_dir The ArrayDirectory object used to retrieve the
+   *     various URIs in the array directory.
+   * @param memory_tracker The memory tracker of the array
+   *     for which the fragment metadata is loaded.
+   * @param enc_key The encryption key to use.
+   * @param array_schema_latest The latest array schema.
+   * @param array_schemas_all Map of all array schemas found keyed by name.
+   * @param preloaded_fragment_metadata A map from a fragment URI to
+   *     already loaded metadata for that fragment, e.g. retained from a
+   *     previous open of the same array. Fragments found in the map are
+   *     reused as-is instead of being loaded again.
+   * @return vector of FragmentMetadata sorted on timestamp.
+   */
+  static std::vector<shared_ptr<FragmentMetadata>> load_fragment_metadata(
+      ContextResources& resources,
+      const ArrayDirectory& array_dir,
+      MemoryTracker* memory_tracker,
+      const EncryptionKey& enc_key,
+      const shared_ptr<ArraySchema>& array_schema_latest,
+      const std::unordered_map<std::string, shared_ptr<ArraySchema>>&
+          array_schemas_all,
+      const std::unordered_map<std::string, shared_ptr<FragmentMetadata>>&
+          preloaded_fragment_metadata = {});
 
   /** Returns the vector with the info about individual fragments. */
   const std::vector<SingleFragmentInfo>& single_fragment_info_vec() const;
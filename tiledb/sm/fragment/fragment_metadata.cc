@@ -41,6 +41,7 @@
 #include "tiledb/sm/array_schema/dimension.h"
 #include "tiledb/sm/array_schema/domain.h"
 #include "tiledb/sm/buffer/buffer.h"
+#include "tiledb/sm/cache/fragment_footer_cache.h"
 #include "tiledb/sm/filesystem/vfs.h"
 #include "tiledb/sm/fragment/fragment_metadata.h"
 #include "tiledb/sm/misc/constants.h"
@@ -52,11 +53,13 @@
 #include "tiledb/sm/tile/generic_tile_io.h"
 #include "tiledb/sm/tile/tile.h"
 #include "tiledb/sm/tile/tile_metadata_generator.h"
+#include "tiledb/storage_format/offsets/bitpack_offsets.h"
 #include "tiledb/storage_format/serialization/serializers.h"
 #include "tiledb/storage_format/uri/parse_uri.h"
 #include "tiledb/type/range/range.h"
 
 #include <cassert>
+#include <cstring>
 #include <iostream>
 #include <numeric>
 #include <string>
@@ -131,6 +134,9 @@ FragmentMetadata::FragmentMetadata(const FragmentMetadata& other) {
   sparse_tile_num_ = other.sparse_tile_num_;
   footer_size_ = other.footer_size_;
   footer_offset_ = other.footer_offset_;
+  lazy_footer_tile_ = other.lazy_footer_tile_;
+  lazy_footer_offset_ = other.lazy_footer_offset_;
+  lazy_footer_schemas_ = other.lazy_footer_schemas_;
   idx_map_ = other.idx_map_;
   array_schema_name_ = other.array_schema_name_;
   array_uri_ = other.array_uri_;
@@ -152,6 +158,9 @@ FragmentMetadata& FragmentMetadata::operator=(const FragmentMetadata& other) {
   sparse_tile_num_ = other.sparse_tile_num_;
   footer_size_ = other.footer_size_;
   footer_offset_ = other.footer_offset_;
+  lazy_footer_tile_ = other.lazy_footer_tile_;
+  lazy_footer_offset_ = other.lazy_footer_offset_;
+  lazy_footer_schemas_ = other.lazy_footer_schemas_;
   idx_map_ = other.idx_map_;
   array_schema_name_ = other.array_schema_name_;
   array_uri_ = other.array_uri_;
@@ -365,6 +374,21 @@ void FragmentMetadata::set_tile_null_count(
   tile_null_counts_[idx][tid] = null_count;
 }
 
+void FragmentMetadata::set_tile_bloom_filter(
+    const std::string& name, uint64_t tid, const ByteVec& bloom_filter) {
+  auto it = idx_map_.find(name);
+  assert(it != idx_map_.end());
+  auto idx = it->second;
+  tid += tile_index_base_;
+  const auto filter_size = constants::tile_bloom_filter_size;
+  assert(bloom_filter.size() == filter_size);
+  assert(tid * filter_size < tile_bloom_filters_[idx].size());
+  memcpy(
+      &tile_bloom_filters_[idx][tid * filter_size],
+      bloom_filter.data(),
+      filter_size);
+}
+
 template <>
 void FragmentMetadata::compute_fragment_min_max_sum<char>(
     const std::string& name);
@@ -474,6 +498,7 @@ void FragmentMetadata::set_array_schema(
 }
 
 uint64_t FragmentMetadata::cell_num() const {
+  ensure_footer_loaded();
   auto tile_num = this->tile_num();
   assert(tile_num != 0);
   if (dense_) {  // Dense fragment
@@ -484,6 +509,7 @@ uint64_t FragmentMetadata::cell_num() const {
 }
 
 uint64_t FragmentMetadata::cell_num(uint64_t tile_pos) const {
+  ensure_footer_loaded();
   if (dense_)
     return array_schema_->domain().cell_num_per_tile();
 
@@ -661,6 +687,8 @@ void FragmentMetadata::add_max_buffer_sizes_sparse(
 }
 
 uint64_t FragmentMetadata::fragment_size() const {
+  ensure_footer_loaded();
+
   // Add file sizes
   uint64_t size = 0;
   for (const auto& file_size : file_sizes_)
@@ -766,12 +794,16 @@ void FragmentMetadata::init(const NDRange& non_empty_domain) {
   tile_max_var_buffer_.resize(num);
   tile_sums_.resize(num);
   tile_null_counts_.resize(num);
+  tile_bloom_filters_.resize(num);
 
   // Initialize fragment min/max/sum/null count
   fragment_mins_.resize(num);
   fragment_maxs_.resize(num);
   fragment_sums_.resize(num);
   fragment_null_counts_.resize(num);
+
+  // Initialize zstd dictionaries
+  zstd_dictionaries_.resize(num);
 }
 
 std::vector<shared_ptr<FragmentMetadata>> FragmentMetadata::load(
@@ -782,18 +814,40 @@ std::vector<shared_ptr<FragmentMetadata>> FragmentMetadata::load(
         array_schemas_all,
     const EncryptionKey& encryption_key,
     const std::vector<TimestampedURI>& fragments_to_load,
-    const std::unordered_map<std::string, std::pair<Tile*, uint64_t>>&
-        offsets) {
+    const std::unordered_map<
+        std::string,
+        std::pair<shared_ptr<Tile>, uint64_t>>& offsets,
+    const std::unordered_map<std::string, shared_ptr<FragmentMetadata>>&
+        preloaded) {
   auto timer_se = resources.stats().start_timer("sm_load_fragment_metadata");
 
   // Load the metadata for each fragment
   auto fragment_num = fragments_to_load.size();
   std::vector<shared_ptr<FragmentMetadata>> fragment_metadata;
   fragment_metadata.resize(fragment_num);
+
+  // Consolidated metadata tile and offset for each fragment, if any.
+  std::vector<shared_ptr<Tile>> metadata_tiles(fragment_num, nullptr);
+  std::vector<uint64_t> metadata_offsets(fragment_num, 0);
+
+  // Fragments whose metadata is reused from `preloaded` and needs no
+  // footer fetch or deserialization below.
+  std::vector<uint8_t> reused(fragment_num, 0);
+
+  // Create the metadata objects and resolve which fragments can be loaded
+  // from the consolidated metadata buffer.
   auto status =
       parallel_for(&resources.compute_tp(), 0, fragment_num, [&](size_t f) {
         const auto& sf = fragments_to_load[f];
 
+        // Reuse metadata that is already loaded for this fragment.
+        auto preloaded_it = preloaded.find(sf.uri_.to_string());
+        if (preloaded_it != preloaded.end()) {
+          fragment_metadata[f] = preloaded_it->second;
+          reused[f] = 1;
+          return Status::Ok();
+        }
+
         URI coords_uri =
             sf.uri_.join_path(constants::coords + constants::file_suffix);
 
@@ -828,9 +882,6 @@ std::vector<shared_ptr<FragmentMetadata>> FragmentMetadata::load(
 
         // Potentially find the basic fragment metadata in the consolidated
         // metadata buffer
-        Tile* fragment_metadata_tile = nullptr;
-        uint64_t offset = 0;
-
         auto it = offsets.end();
         if (metadata->format_version() >= 9) {
           it = offsets.find(name);
@@ -838,32 +889,57 @@ std::vector<shared_ptr<FragmentMetadata>> FragmentMetadata::load(
           it = offsets.find(sf.uri_.to_string());
         }
         if (it != offsets.end()) {
-          fragment_metadata_tile = it->second.first;
-          offset = it->second.second;
+          metadata_tiles[f] = it->second.first;
+          metadata_offsets[f] = it->second.second;
         }
 
-        // Load fragment metadata
-        metadata->load(
-            encryption_key, fragment_metadata_tile, offset, array_schemas_all);
-
         fragment_metadata[f] = metadata;
         return Status::Ok();
       });
   throw_if_not_ok(status);
 
+  // Prefetch all uncached footers in one bulk pass on the IO pool. The
+  // bytes land in the fragment footer cache when it is enabled, or are
+  // stashed on the metadata objects otherwise, and `load` consumes them
+  // below. This batches the footer round trips of all fragments together
+  // instead of issuing them one by one from the compute threads
+  // deserializing the metadata.
+  status = parallel_for(&resources.io_tp(), 0, fragment_num, [&](size_t f) {
+    if (metadata_tiles[f] == nullptr && !reused[f]) {
+      fragment_metadata[f]->prefetch_footer();
+    }
+    return Status::Ok();
+  });
+  throw_if_not_ok(status);
+
+  // Deserialize the metadata in parallel on the compute pool.
+  status =
+      parallel_for(&resources.compute_tp(), 0, fragment_num, [&](size_t f) {
+        if (reused[f]) {
+          return Status::Ok();
+        }
+        fragment_metadata[f]->load(
+            encryption_key,
+            metadata_tiles[f],
+            metadata_offsets[f],
+            array_schemas_all);
+        return Status::Ok();
+      });
+  throw_if_not_ok(status);
+
   return fragment_metadata;
 }
 
 void FragmentMetadata::load(
     const EncryptionKey& encryption_key,
-    Tile* fragment_metadata_tile,
+    shared_ptr<Tile> fragment_metadata_tile,
     uint64_t offset,
     std::unordered_map<std::string, shared_ptr<ArraySchema>> array_schemas) {
   auto meta_uri = fragment_uri_.join_path(
       std::string(constants::fragment_metadata_filename));
   // Load the metadata file size when we are not reading from consolidated
   // buffer
-  if (fragment_metadata_tile == nullptr) {
+  if (fragment_metadata_tile == nullptr && !meta_file_size_from_cache()) {
     throw_if_not_ok(resources_->vfs().file_size(meta_uri, &meta_file_size_));
   }
 
@@ -1206,6 +1282,16 @@ void FragmentMetadata::store_v15_or_higher(
     offset += nbytes;
   }
 
+  // Store bloom filters
+  if (version_ >= constants::tile_bloom_filter_min_version) {
+    gt_offsets_.tile_bloom_filter_offsets_.resize(num);
+    for (unsigned int i = 0; i < num; ++i) {
+      gt_offsets_.tile_bloom_filter_offsets_[i] = offset;
+      store_tile_bloom_filters(i, encryption_key, &nbytes);
+      offset += nbytes;
+    }
+  }
+
   // Store fragment min, max, sum and null count
   gt_offsets_.fragment_min_max_sum_null_count_offset_ = offset;
   store_fragment_min_max_sum_null_count(num, encryption_key, &nbytes);
@@ -1216,6 +1302,13 @@ void FragmentMetadata::store_v15_or_higher(
   store_processed_conditions(encryption_key, &nbytes);
   offset += nbytes;
 
+  // Store zstd dictionaries
+  if (version_ >= constants::zstd_dictionary_min_version) {
+    gt_offsets_.zstd_dictionaries_offset_ = offset;
+    store_zstd_dictionaries(encryption_key, &nbytes);
+    offset += nbytes;
+  }
+
   // Store footer
   store_footer(encryption_key);
 
@@ -1256,6 +1349,13 @@ void FragmentMetadata::set_num_tiles(uint64_t num_tiles) {
           tile_sums_[i].resize(num_tiles * sizeof(uint64_t), 0);
       }
 
+      if (version_ >= constants::tile_bloom_filter_min_version &&
+          TileMetadataGenerator::has_bloom_filter_metadata(
+              type, is_dim, var_size, cell_val_num)) {
+        tile_bloom_filters_[i].resize(
+            num_tiles * constants::tile_bloom_filter_size, 0);
+      }
+
       if (array_schema_->is_nullable(it.first))
         tile_null_counts_[i].resize(num_tiles, 0);
     }
@@ -1272,6 +1372,7 @@ void FragmentMetadata::set_last_tile_cell_num(uint64_t cell_num) {
 }
 
 uint64_t FragmentMetadata::tile_num() const {
+  ensure_footer_loaded();
   if (dense_) {
     return array_schema_->domain().tile_num(domain_);
   }
@@ -1386,11 +1487,14 @@ URI FragmentMetadata::validity_uri(const std::string& name) const {
 }
 
 const std::string& FragmentMetadata::array_schema_name() {
+  ensure_footer_loaded();
   return array_schema_name_;
 }
 
 void FragmentMetadata::load_tile_offsets(
     const EncryptionKey& encryption_key, std::vector<std::string>& names) {
+  ensure_footer_loaded();
+
   // Sort 'names' in ascending order of their index. The
   // motivation is to load the offsets in order of their
   // layout for sequential reads to the file.
@@ -1403,6 +1507,28 @@ void FragmentMetadata::load_tile_offsets(
         return idx_map_[lhs] < idx_map_[rhs];
       });
 
+  // Gather the generic tiles of all the sections that are not loaded yet
+  // and fetch them with a single vectored read, so that the per-name loads
+  // below are served from memory.
+  if (version_ > 2) {
+    std::vector<uint64_t> to_prefetch;
+    for (const auto& name : names) {
+      const auto idx = idx_map_[name];
+      if (!loaded_metadata_.tile_offsets_[idx]) {
+        to_prefetch.emplace_back(gt_offsets_.tile_offsets_[idx]);
+      }
+      if (array_schema_->var_size(name) &&
+          !loaded_metadata_.tile_var_offsets_[idx]) {
+        to_prefetch.emplace_back(gt_offsets_.tile_var_offsets_[idx]);
+      }
+      if (version_ > 6 && array_schema_->is_nullable(name) &&
+          !loaded_metadata_.tile_validity_offsets_[idx]) {
+        to_prefetch.emplace_back(gt_offsets_.tile_validity_offsets_[idx]);
+      }
+    }
+    prefetch_generic_tiles(encryption_key, to_prefetch);
+  }
+
   // The fixed offsets are located before the
   // var offsets. Load all of the fixed offsets
   // first.
@@ -1427,6 +1553,8 @@ void FragmentMetadata::load_tile_offsets(
 
 void FragmentMetadata::load_tile_min_values(
     const EncryptionKey& encryption_key, std::vector<std::string>& names) {
+  ensure_footer_loaded();
+
   // Sort 'names' in ascending order of their index. The
   // motivation is to load the offsets in order of their
   // layout for sequential reads to the file.
@@ -1447,6 +1575,8 @@ void FragmentMetadata::load_tile_min_values(
 
 void FragmentMetadata::load_tile_max_values(
     const EncryptionKey& encryption_key, std::vector<std::string>& names) {
+  ensure_footer_loaded();
+
   // Sort 'names' in ascending order of their index. The
   // motivation is to load the offsets in order of their
   // layout for sequential reads to the file.
@@ -1467,6 +1597,8 @@ void FragmentMetadata::load_tile_max_values(
 
 void FragmentMetadata::load_tile_sum_values(
     const EncryptionKey& encryption_key, std::vector<std::string>& names) {
+  ensure_footer_loaded();
+
   // Sort 'names' in ascending order of their index. The
   // motivation is to load the offsets in order of their
   // layout for sequential reads to the file.
@@ -1487,6 +1619,8 @@ void FragmentMetadata::load_tile_sum_values(
 
 void FragmentMetadata::load_tile_null_count_values(
     const EncryptionKey& encryption_key, std::vector<std::string>& names) {
+  ensure_footer_loaded();
+
   // Sort 'names' in ascending order of their index. The
   // motivation is to load the offsets in order of their
   // layout for sequential reads to the file.
@@ -1505,8 +1639,91 @@ void FragmentMetadata::load_tile_null_count_values(
   }
 }
 
+void FragmentMetadata::load_tile_bloom_filter_values(
+    const EncryptionKey& encryption_key, std::vector<std::string>& names) {
+  ensure_footer_loaded();
+
+  // Sort 'names' in ascending order of their index. The
+  // motivation is to load the offsets in order of their
+  // layout for sequential reads to the file.
+  std::sort(
+      names.begin(),
+      names.end(),
+      [&](const std::string& lhs, const std::string& rhs) {
+        assert(idx_map_.count(lhs) > 0);
+        assert(idx_map_.count(rhs) > 0);
+        return idx_map_[lhs] < idx_map_[rhs];
+      });
+
+  // Load all the bloom filter values.
+  for (const auto& name : names) {
+    load_tile_bloom_filter_values(encryption_key, idx_map_[name]);
+  }
+}
+
+void FragmentMetadata::prefetch_tile_metadata(
+    const EncryptionKey& encryption_key,
+    const std::vector<std::string>& min_max_names,
+    const std::vector<std::string>& sum_names,
+    const std::vector<std::string>& null_count_names,
+    const std::vector<std::string>& bloom_filter_names) {
+  ensure_footer_loaded();
+
+  std::vector<uint64_t> to_prefetch;
+
+  if (version_ >= constants::tile_metadata_min_version) {
+    for (const auto& name : min_max_names) {
+      auto it = idx_map_.find(name);
+      if (it == idx_map_.end()) {
+        continue;
+      }
+      if (!loaded_metadata_.tile_min_[it->second]) {
+        to_prefetch.emplace_back(gt_offsets_.tile_min_offsets_[it->second]);
+      }
+      if (!loaded_metadata_.tile_max_[it->second]) {
+        to_prefetch.emplace_back(gt_offsets_.tile_max_offsets_[it->second]);
+      }
+    }
+    for (const auto& name : sum_names) {
+      auto it = idx_map_.find(name);
+      if (it == idx_map_.end()) {
+        continue;
+      }
+      if (!loaded_metadata_.tile_sum_[it->second]) {
+        to_prefetch.emplace_back(gt_offsets_.tile_sum_offsets_[it->second]);
+      }
+    }
+    for (const auto& name : null_count_names) {
+      auto it = idx_map_.find(name);
+      if (it == idx_map_.end()) {
+        continue;
+      }
+      if (!loaded_metadata_.tile_null_count_[it->second]) {
+        to_prefetch.emplace_back(
+            gt_offsets_.tile_null_count_offsets_[it->second]);
+      }
+    }
+  }
+
+  if (version_ >= constants::tile_bloom_filter_min_version) {
+    for (const auto& name : bloom_filter_names) {
+      auto it = idx_map_.find(name);
+      if (it == idx_map_.end()) {
+        continue;
+      }
+      if (!loaded_metadata_.tile_bloom_filter_[it->second]) {
+        to_prefetch.emplace_back(
+            gt_offsets_.tile_bloom_filter_offsets_[it->second]);
+      }
+    }
+  }
+
+  prefetch_generic_tiles(encryption_key, to_prefetch);
+}
+
 void FragmentMetadata::load_fragment_min_max_sum_null_count(
     const EncryptionKey& encryption_key) {
+  ensure_footer_loaded();
   if (loaded_metadata_.fragment_min_max_sum_null_count_) {
     return;
   }
@@ -1530,6 +1747,7 @@ void FragmentMetadata::load_fragment_min_max_sum_null_count(
 
 void FragmentMetadata::load_processed_conditions(
     const EncryptionKey& encryption_key) {
+  ensure_footer_loaded();
   if (loaded_metadata_.processed_conditions_) {
     return;
   }
@@ -1551,6 +1769,29 @@ void FragmentMetadata::load_processed_conditions(
   loaded_metadata_.processed_conditions_ = true;
 }
 
+void FragmentMetadata::load_zstd_dictionaries(
+    const EncryptionKey& encryption_key) {
+  ensure_footer_loaded();
+  if (loaded_metadata_.zstd_dictionaries_) {
+    return;
+  }
+
+  if (version_ < constants::zstd_dictionary_min_version) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(mtx_);
+
+  auto tile = read_generic_tile_from_file(
+      encryption_key, gt_offsets_.zstd_dictionaries_offset_);
+  resources_->stats().add_counter("read_zstd_dictionaries_size", tile.size());
+
+  Deserializer deserializer(tile.data(), tile.size());
+  load_zstd_dictionaries(deserializer);
+
+  loaded_metadata_.zstd_dictionaries_ = true;
+}
+
 uint64_t FragmentMetadata::file_offset(
     const std::string& name, uint64_t tile_idx) const {
   auto it = idx_map_.find(name);
@@ -1590,6 +1831,52 @@ uint64_t FragmentMetadata::file_validity_offset(
   return tile_validity_offsets_[idx][tile_idx];
 }
 
+FragmentMetadata::OffsetsView FragmentMetadata::tile_offsets_view(
+    const std::string& name) const {
+  auto it = idx_map_.find(name);
+  assert(it != idx_map_.end());
+  auto idx = it->second;
+  if (!loaded_metadata_.tile_offsets_[idx]) {
+    throw std::logic_error(
+        "Trying to access tile offsets metadata that's not loaded");
+  }
+
+  return OffsetsView(
+      tile_offsets_[idx].data(), tile_offsets_[idx].size(), file_sizes_[idx]);
+}
+
+FragmentMetadata::OffsetsView FragmentMetadata::tile_var_offsets_view(
+    const std::string& name) const {
+  auto it = idx_map_.find(name);
+  assert(it != idx_map_.end());
+  auto idx = it->second;
+  if (!loaded_metadata_.tile_var_offsets_[idx]) {
+    throw std::logic_error(
+        "Trying to access tile var offsets metadata that's not loaded");
+  }
+
+  return OffsetsView(
+      tile_var_offsets_[idx].data(),
+      tile_var_offsets_[idx].size(),
+      file_var_sizes_[idx]);
+}
+
+FragmentMetadata::OffsetsView FragmentMetadata::tile_validity_offsets_view(
+    const std::string& name) const {
+  auto it = idx_map_.find(name);
+  assert(it != idx_map_.end());
+  auto idx = it->second;
+  if (!loaded_metadata_.tile_validity_offsets_[idx]) {
+    throw std::logic_error(
+        "Trying to access tile validity offsets metadata that's not loaded");
+  }
+
+  return OffsetsView(
+      tile_validity_offsets_[idx].data(),
+      tile_validity_offsets_[idx].size(),
+      file_validity_sizes_[idx]);
+}
+
 const NDRange& FragmentMetadata::mbr(uint64_t tile_idx) const {
   return rtree_.leaf(tile_idx);
 }
@@ -1661,6 +1948,7 @@ uint64_t FragmentMetadata::persisted_tile_validity_size(
 
 uint64_t FragmentMetadata::tile_size(
     const std::string& name, uint64_t tile_idx) const {
+  ensure_footer_loaded();
   auto var_size = array_schema_->var_size(name);
   auto cell_num = this->cell_num(tile_idx);
   return (var_size) ? (cell_num + 1) * constants::cell_var_offset_size :
@@ -1848,6 +2136,16 @@ std::string_view FragmentMetadata::get_tile_max_as<std::string_view>(
   }
 }
 
+bool FragmentMetadata::tile_min_max_loaded(const std::string& name) const {
+  auto it = idx_map_.find(name);
+  if (it == idx_map_.end()) {
+    return false;
+  }
+
+  return loaded_metadata_.tile_min_[it->second] &&
+         loaded_metadata_.tile_max_[it->second];
+}
+
 const void* FragmentMetadata::get_tile_sum(
     const std::string& name, uint64_t tile_idx) const {
   auto it = idx_map_.find(name);
@@ -1888,6 +2186,39 @@ uint64_t FragmentMetadata::get_tile_null_count(
   return tile_null_counts_[idx][tile_idx];
 }
 
+bool FragmentMetadata::has_tile_null_count(const std::string& name) const {
+  auto it = idx_map_.find(name);
+  if (it == idx_map_.end() || !array_schema_->is_nullable(name)) {
+    return false;
+  }
+
+  return loaded_metadata_.tile_null_count_[it->second];
+}
+
+bool FragmentMetadata::tile_bloom_filter_maybe_contains(
+    const std::string& name,
+    uint64_t tile_idx,
+    const void* value,
+    uint64_t size) const {
+  auto it = idx_map_.find(name);
+  assert(it != idx_map_.end());
+  auto idx = it->second;
+  if (!loaded_metadata_.tile_bloom_filter_[idx]) {
+    throw FragmentMetadataStatusException(
+        "Trying to access tile bloom filter metadata that's not loaded");
+  }
+
+  // Fragments written before bloom filters cannot disprove a match.
+  if (tile_bloom_filters_[idx].empty()) {
+    return true;
+  }
+
+  const auto filter =
+      &tile_bloom_filters_[idx][tile_idx * constants::tile_bloom_filter_size];
+  return TileMetadataGenerator::bloom_filter_maybe_contains(
+      filter, value, size);
+}
+
 std::vector<uint8_t>& FragmentMetadata::get_min(const std::string& name) {
   auto it = idx_map_.find(name);
   assert(it != idx_map_.end());
@@ -1979,6 +2310,15 @@ TileMetadata FragmentMetadata::get_tile_metadata(
     return {count, 0, nullptr, 0, nullptr, 0, nullptr};
   }
 
+  // The min/max and sum metadata are loaded per attribute and per kind,
+  // driven by what the query's aggregates consume, so only report the
+  // kinds that are loaded for this attribute.
+  auto it = idx_map_.find(name);
+  assert(it != idx_map_.end());
+  auto idx = it->second;
+  const bool min_max_loaded =
+      loaded_metadata_.tile_min_[idx] && loaded_metadata_.tile_max_[idx];
+
   uint64_t null_count = 0;
   if (array_schema_->is_nullable(name)) {
     null_count = get_tile_null_count(name, tile_idx);
@@ -1993,6 +2333,10 @@ TileMetadata FragmentMetadata::get_tile_metadata(
   }
 
   if (var_size) {
+    if (!is_dim && !min_max_loaded) {
+      return {count, null_count, nullptr, 0, nullptr, 0, nullptr};
+    }
+
     std::string_view min =
         is_dim ? mbr->at(dim_idx).start_str() :
                  get_tile_min_as<std::string_view>(name, tile_idx);
@@ -2009,15 +2353,21 @@ TileMetadata FragmentMetadata::get_tile_metadata(
         nullptr};
   } else {
     auto cell_size = array_schema_->cell_size(name);
-    const void* min = is_dim ? mbr->at(dim_idx).start_fixed() :
-                               get_tile_min_as<const void*>(name, tile_idx);
-    const void* max = is_dim ? mbr->at(dim_idx).end_fixed() :
-                               get_tile_max_as<const void*>(name, tile_idx);
+    const void* min = nullptr;
+    const void* max = nullptr;
+    if (is_dim) {
+      min = mbr->at(dim_idx).start_fixed();
+      max = mbr->at(dim_idx).end_fixed();
+    } else if (min_max_loaded) {
+      min = get_tile_min_as<const void*>(name, tile_idx);
+      max = get_tile_max_as<const void*>(name, tile_idx);
+    }
 
     const auto type = array_schema_->type(name);
     const auto cell_val_num = array_schema_->cell_val_num(name);
     const void* sum = nullptr;
-    if (TileMetadataGenerator::has_sum_metadata(type, false, cell_val_num)) {
+    if (loaded_metadata_.tile_sum_[idx] &&
+        TileMetadataGenerator::has_sum_metadata(type, false, cell_val_num)) {
       sum = get_tile_sum(name, tile_idx);
     }
 
@@ -2051,6 +2401,36 @@ FragmentMetadata::get_processed_conditions_set() {
   return processed_conditions_set_;
 }
 
+void FragmentMetadata::set_zstd_dictionary(
+    const std::string& name, std::vector<uint8_t> dictionary) {
+  auto it = idx_map_.find(name);
+  assert(it != idx_map_.end());
+  zstd_dictionaries_[it->second] = std::move(dictionary);
+}
+
+bool FragmentMetadata::has_zstd_dictionary(const std::string& name) const {
+  if (version_ < constants::zstd_dictionary_min_version ||
+      !loaded_metadata_.zstd_dictionaries_) {
+    return false;
+  }
+
+  auto it = idx_map_.find(name);
+  assert(it != idx_map_.end());
+  return !zstd_dictionaries_[it->second].empty();
+}
+
+const std::vector<uint8_t>& FragmentMetadata::zstd_dictionary(
+    const std::string& name) const {
+  if (!loaded_metadata_.zstd_dictionaries_) {
+    throw std::logic_error(
+        "Trying to access zstd dictionary metadata that's not present");
+  }
+
+  auto it = idx_map_.find(name);
+  assert(it != idx_map_.end());
+  return zstd_dictionaries_[it->second];
+}
+
 uint64_t FragmentMetadata::first_timestamp() const {
   return timestamp_range_.first;
 }
@@ -2062,6 +2442,7 @@ bool FragmentMetadata::operator<(const FragmentMetadata& metadata) const {
 }
 
 void FragmentMetadata::write_footer(Serializer& serializer) const {
+  ensure_footer_loaded();
   write_version(serializer);
   if (version_ >= 10) {
     write_array_schema_name(serializer);
@@ -2086,6 +2467,7 @@ void FragmentMetadata::write_footer(Serializer& serializer) const {
 }
 
 void FragmentMetadata::load_rtree(const EncryptionKey& encryption_key) {
+  ensure_footer_loaded();
   if (version_ <= 2) {
     return;
   }
@@ -2183,6 +2565,7 @@ void FragmentMetadata::free_tile_offsets() {
 
 void FragmentMetadata::load_tile_var_sizes(
     const EncryptionKey& encryption_key, const std::string& name) {
+  ensure_footer_loaded();
   if (version_ <= 2) {
     return;
   }
@@ -2662,6 +3045,28 @@ void FragmentMetadata::load_tile_null_count_values(
   loaded_metadata_.tile_null_count_[idx] = true;
 }
 
+void FragmentMetadata::load_tile_bloom_filter_values(
+    const EncryptionKey& encryption_key, unsigned idx) {
+  if (version_ < constants::tile_bloom_filter_min_version) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(mtx_);
+
+  if (loaded_metadata_.tile_bloom_filter_[idx]) {
+    return;
+  }
+
+  auto tile = read_generic_tile_from_file(
+      encryption_key, gt_offsets_.tile_bloom_filter_offsets_[idx]);
+  resources_->stats().add_counter("read_tile_bloom_filter_size", tile.size());
+
+  Deserializer deserializer(tile.data(), tile.size());
+  load_tile_bloom_filter_values(idx, deserializer);
+
+  loaded_metadata_.tile_bloom_filter_[idx] = true;
+}
+
 // ===== FORMAT =====
 //  bounding_coords_num (uint64_t)
 //  bounding_coords_#1 (void*) bounding_coords_#2 (void*) ...
@@ -2981,7 +3386,12 @@ void FragmentMetadata::load_tile_offsets(
     }
 
     tile_offsets_[idx].resize(tile_offsets_num);
-    deserializer.read(&tile_offsets_[idx][0], size);
+    if (version_ >= constants::bitpacked_tile_offsets_min_version) {
+      storage_format::read_bitpacked_offsets(
+          deserializer, &tile_offsets_[idx][0], tile_offsets_num);
+    } else {
+      deserializer.read(&tile_offsets_[idx][0], size);
+    }
   }
 }
 
@@ -3055,7 +3465,12 @@ void FragmentMetadata::load_tile_var_offsets(
     }
 
     tile_var_offsets_[idx].resize(tile_var_offsets_num);
-    deserializer.read(&tile_var_offsets_[idx][0], size);
+    if (version_ >= constants::bitpacked_tile_offsets_min_version) {
+      storage_format::read_bitpacked_offsets(
+          deserializer, &tile_var_offsets_[idx][0], tile_var_offsets_num);
+    } else {
+      deserializer.read(&tile_var_offsets_[idx][0], size);
+    }
   }
 }
 
@@ -3322,6 +3737,39 @@ void FragmentMetadata::load_tile_null_count_values(
   }
 }
 
+// ===== FORMAT =====
+// tile_bloom_filters_attr#0_size (uint64_t)
+// tile_bloom_filter_attr#0_#1 (uint8_t[]) ...
+// ...
+// tile_bloom_filters_attr#<attribute_num-1>_size (uint64_t)
+// tile_bloom_filter_attr#<attribute_num-1>_#1 (uint8_t[]) ...
+void FragmentMetadata::load_tile_bloom_filter_values(
+    unsigned idx, Deserializer& deserializer) {
+  uint64_t tile_bloom_filters_size = 0;
+
+  // Get size of tile bloom filters
+  tile_bloom_filters_size = deserializer.read<uint64_t>();
+
+  // Get tile bloom filters
+  if (tile_bloom_filters_size != 0) {
+    if (memory_tracker_ != nullptr &&
+        !memory_tracker_->take_memory(
+            tile_bloom_filters_size,
+            MemoryTracker::MemoryType::MIN_MAX_SUM_NULL_COUNT)) {
+      throw FragmentMetadataStatusException(
+          "Cannot load bloom filter values; Insufficient memory budget; "
+          "Needed " +
+          std::to_string(tile_bloom_filters_size) + " but only had " +
+          std::to_string(memory_tracker_->get_memory_available()) +
+          " from budget " +
+          std::to_string(memory_tracker_->get_memory_budget()));
+    }
+
+    tile_bloom_filters_[idx].resize(tile_bloom_filters_size);
+    deserializer.read(&tile_bloom_filters_[idx][0], tile_bloom_filters_size);
+  }
+}
+
 // ===== FORMAT =====
 // fragment_min_size_attr#0 (uint64_t)
 // fragment_min_attr#0 (min_size)
@@ -3391,6 +3839,24 @@ void FragmentMetadata::load_processed_conditions(Deserializer& deserializer) {
       processed_conditions_.begin(), processed_conditions_.end());
 }
 
+// ===== FORMAT =====
+// dictionary_size#0 (uint64_t)
+// dictionary#0 (uint8_t[])
+// ...
+// dictionary_size#<field_num-1> (uint64_t)
+// dictionary#<field_num-1> (uint8_t[])
+void FragmentMetadata::load_zstd_dictionaries(Deserializer& deserializer) {
+  auto num = num_dims_and_attrs();
+  zstd_dictionaries_.resize(num);
+  for (uint64_t i = 0; i < num; ++i) {
+    auto size = deserializer.read<uint64_t>();
+    zstd_dictionaries_[i].resize(size);
+    if (size > 0) {
+      deserializer.read(zstd_dictionaries_[i].data(), size);
+    }
+  }
+}
+
 void FragmentMetadata::load_version(Deserializer& deserializer) {
   version_ = deserializer.read<uint32_t>();
 }
@@ -3613,6 +4079,18 @@ void FragmentMetadata::load_generic_tile_offsets_v16_or_higher(
       deserializer.read<uint64_t>();
 
   gt_offsets_.processed_conditions_offsets_ = deserializer.read<uint64_t>();
+
+  // Load offsets for tile bloom filter offsets
+  if (version_ >= constants::tile_bloom_filter_min_version) {
+    gt_offsets_.tile_bloom_filter_offsets_.resize(num);
+    deserializer.read(
+        &gt_offsets_.tile_bloom_filter_offsets_[0], num * sizeof(uint64_t));
+  }
+
+  // Load offset for zstd dictionaries
+  if (version_ >= constants::zstd_dictionary_min_version) {
+    gt_offsets_.zstd_dictionaries_offset_ = deserializer.read<uint64_t>();
+  }
 }
 
 void FragmentMetadata::load_array_schema_name(Deserializer& deserializer) {
@@ -3669,10 +4147,28 @@ void FragmentMetadata::load_v1_v2(
 
 void FragmentMetadata::load_v3_or_higher(
     const EncryptionKey& encryption_key,
-    Tile* fragment_metadata_tile,
+    shared_ptr<Tile> fragment_metadata_tile,
     uint64_t offset,
     std::unordered_map<std::string, shared_ptr<ArraySchema>> array_schemas) {
-  load_footer(encryption_key, fragment_metadata_tile, offset, array_schemas);
+  if (fragment_metadata_tile != nullptr) {
+    // The footer lives in a consolidated metadata tile that is already in
+    // memory. Retain the tile and decode the footer lazily upon first
+    // access, so that opening an array with many consolidated fragments
+    // does not deserialize the metadata of fragments no query touches.
+    lazy_footer_tile_ = std::move(fragment_metadata_tile);
+    lazy_footer_offset_ = offset;
+    lazy_footer_schemas_ = std::move(array_schemas);
+    return;
+  }
+  load_footer(encryption_key, nullptr, offset, array_schemas);
+}
+
+void FragmentMetadata::load_lazy_footer() {
+  load_footer(
+      EncryptionKey(),
+      lazy_footer_tile_.get(),
+      lazy_footer_offset_,
+      lazy_footer_schemas_);
 }
 
 void FragmentMetadata::load_footer(
@@ -3689,7 +4185,11 @@ void FragmentMetadata::load_footer(
   std::shared_ptr<Tile> tile;
   if (fragment_metadata_tile == nullptr) {
     has_consolidated_footer_ = false;
-    read_file_footer(tile, &footer_offset_, &footer_size_);
+    if (!footer_from_prefetch(tile, &footer_offset_, &footer_size_) &&
+        !footer_from_cache(tile, &footer_offset_, &footer_size_)) {
+      read_file_footer(tile, &footer_offset_, &footer_size_);
+      footer_to_cache(*tile, footer_offset_, footer_size_);
+    }
 
     fragment_metadata_tile = tile.get();
     offset = 0;
@@ -3763,6 +4263,7 @@ void FragmentMetadata::load_footer(
   tile_max_var_buffer_.resize(num);
   tile_sums_.resize(num);
   tile_null_counts_.resize(num);
+  tile_bloom_filters_.resize(num);
 
   fragment_mins_.resize(num);
   fragment_maxs_.resize(num);
@@ -3777,6 +4278,7 @@ void FragmentMetadata::load_footer(
   loaded_metadata_.tile_max_.resize(num, false);
   loaded_metadata_.tile_sum_.resize(num, false);
   loaded_metadata_.tile_null_count_.resize(num, false);
+  loaded_metadata_.tile_bloom_filter_.resize(num, false);
 
   load_generic_tile_offsets(deserializer);
 
@@ -3881,6 +4383,17 @@ void FragmentMetadata::write_generic_tile_offsets(
   if (version_ >= 16) {
     serializer.write<uint64_t>(gt_offsets_.processed_conditions_offsets_);
   }
+
+  // Write tile bloom filter offsets
+  if (version_ >= constants::tile_bloom_filter_min_version) {
+    serializer.write(
+        &gt_offsets_.tile_bloom_filter_offsets_[0], num * sizeof(uint64_t));
+  }
+
+  // Write zstd dictionaries offset
+  if (version_ >= constants::zstd_dictionary_min_version) {
+    serializer.write<uint64_t>(gt_offsets_.zstd_dictionaries_offset_);
+  }
 }
 
 void FragmentMetadata::write_array_schema_name(Serializer& serializer) const {
@@ -3970,6 +4483,17 @@ void FragmentMetadata::write_non_empty_domain(Serializer& serializer) const {
 
 Tile FragmentMetadata::read_generic_tile_from_file(
     const EncryptionKey& encryption_key, uint64_t offset) const {
+  // Serve the tile from the stash if a batched read already fetched it.
+  {
+    std::lock_guard<std::mutex> lock(prefetched_generic_tiles_mtx_);
+    auto it = prefetched_generic_tiles_.find(offset);
+    if (it != prefetched_generic_tiles_.end()) {
+      Tile tile = std::move(it->second);
+      prefetched_generic_tiles_.erase(it);
+      return tile;
+    }
+  }
+
   URI fragment_metadata_uri = fragment_uri_.join_path(
       std::string(constants::fragment_metadata_filename));
 
@@ -3978,6 +4502,39 @@ Tile FragmentMetadata::read_generic_tile_from_file(
   return tile_io.read_generic(offset, encryption_key, resources_->config());
 }
 
+void FragmentMetadata::prefetch_generic_tiles(
+    const EncryptionKey& encryption_key,
+    std::vector<uint64_t>& offsets) const {
+  // Drop the offsets that are already stashed.
+  {
+    std::lock_guard<std::mutex> lock(prefetched_generic_tiles_mtx_);
+    offsets.erase(
+        std::remove_if(
+            offsets.begin(),
+            offsets.end(),
+            [&](uint64_t offset) {
+              return prefetched_generic_tiles_.count(offset) != 0;
+            }),
+        offsets.end());
+  }
+
+  // A single tile does not benefit from batching.
+  if (offsets.size() < 2) {
+    return;
+  }
+
+  URI fragment_metadata_uri = fragment_uri_.join_path(
+      std::string(constants::fragment_metadata_filename));
+  GenericTileIO tile_io(*resources_, fragment_metadata_uri);
+  auto tiles = tile_io.read_generic_many(
+      offsets, encryption_key, resources_->config());
+
+  std::lock_guard<std::mutex> lock(prefetched_generic_tiles_mtx_);
+  for (uint64_t i = 0; i < offsets.size(); i++) {
+    prefetched_generic_tiles_.emplace(offsets[i], std::move(tiles[i]));
+  }
+}
+
 void FragmentMetadata::read_file_footer(
     std::shared_ptr<Tile>& tile,
     uint64_t* footer_offset,
@@ -4010,6 +4567,140 @@ void FragmentMetadata::read_file_footer(
       *footer_size));
 }
 
+bool FragmentMetadata::footer_from_cache(
+    std::shared_ptr<Tile>& tile,
+    uint64_t* footer_offset,
+    uint64_t* footer_size) {
+  auto& cache = resources_->fragment_footer_cache();
+  if (!cache.enabled()) {
+    return false;
+  }
+
+  shared_ptr<FragmentFooterEntry> entry;
+  if (!cache.lookup(fragment_uri_.to_string(), &entry)) {
+    return false;
+  }
+
+  *footer_offset = entry->footer_offset_;
+  *footer_size = entry->footer_size_;
+  meta_file_size_ = entry->meta_file_size_;
+
+  // Account for the footer memory exactly like 'read_file_footer'.
+  if (memory_tracker_ != nullptr &&
+      !memory_tracker_->take_memory(
+          *footer_size, MemoryTracker::MemoryType::FOOTER)) {
+    throw FragmentMetadataStatusException(
+        "Cannot load file footer; Insufficient memory budget; Needed " +
+        std::to_string(*footer_size) + " but only had " +
+        std::to_string(memory_tracker_->get_memory_available()) +
+        " from budget " + std::to_string(memory_tracker_->get_memory_budget()));
+  }
+
+  tile = make_shared<Tile>(HERE(), Tile::from_generic(*footer_size));
+  std::memcpy(tile->data(), entry->footer_.data(), entry->footer_.size());
+
+  resources_->stats().add_counter("frag_footer_cache_hit_num", 1);
+
+  return true;
+}
+
+void FragmentMetadata::footer_to_cache(
+    const Tile& tile, uint64_t footer_offset, uint64_t footer_size) const {
+  auto& cache = resources_->fragment_footer_cache();
+  if (!cache.enabled()) {
+    return;
+  }
+
+  auto entry = make_shared<FragmentFooterEntry>(HERE());
+  entry->footer_.resize(footer_size);
+  std::memcpy(entry->footer_.data(), tile.data(), footer_size);
+  entry->footer_offset_ = footer_offset;
+  entry->footer_size_ = footer_size;
+  entry->meta_file_size_ = meta_file_size_;
+  cache.insert_entry(fragment_uri_.to_string(), std::move(entry));
+}
+
+void FragmentMetadata::prefetch_footer() {
+  auto& cache = resources_->fragment_footer_cache();
+
+  // v1/v2 fragments have no footer.
+  auto name = fragment_uri_.remove_trailing_slash().last_path_part();
+  if (utils::parse::get_fragment_version(name) <= 2) {
+    return;
+  }
+
+  // Skip footers that are already cached or stashed.
+  if (meta_file_size_from_cache() || prefetched_footer_tile_ != nullptr) {
+    return;
+  }
+
+  auto meta_uri = fragment_uri_.join_path(
+      std::string(constants::fragment_metadata_filename));
+  throw_if_not_ok(resources_->vfs().file_size(meta_uri, &meta_file_size_));
+
+  uint64_t footer_offset = 0, footer_size = 0;
+  get_footer_offset_and_size(&footer_offset, &footer_size);
+
+  // Read the footer bytes without deserializing them; memory for the
+  // footer is accounted against the memory tracker when the footer is
+  // consumed from the cache or the stash.
+  Tile tile(Tile::from_generic(footer_size));
+  resources_->stats().add_counter("read_frag_meta_size", footer_size);
+  throw_if_not_ok(resources_->vfs().read(
+      meta_uri, footer_offset, tile.data_as<uint8_t>(), footer_size));
+
+  if (cache.enabled()) {
+    footer_to_cache(tile, footer_offset, footer_size);
+  } else {
+    prefetched_footer_tile_ = make_shared<Tile>(HERE(), std::move(tile));
+    prefetched_footer_offset_ = footer_offset;
+    prefetched_footer_size_ = footer_size;
+  }
+}
+
+bool FragmentMetadata::footer_from_prefetch(
+    std::shared_ptr<Tile>& tile,
+    uint64_t* footer_offset,
+    uint64_t* footer_size) {
+  if (prefetched_footer_tile_ == nullptr) {
+    return false;
+  }
+
+  *footer_offset = prefetched_footer_offset_;
+  *footer_size = prefetched_footer_size_;
+
+  // Account for the footer memory exactly like 'read_file_footer'.
+  if (memory_tracker_ != nullptr &&
+      !memory_tracker_->take_memory(
+          *footer_size, MemoryTracker::MemoryType::FOOTER)) {
+    throw FragmentMetadataStatusException(
+        "Cannot load file footer; Insufficient memory budget; Needed " +
+        std::to_string(*footer_size) + " but only had " +
+        std::to_string(memory_tracker_->get_memory_available()) +
+        " from budget " + std::to_string(memory_tracker_->get_memory_budget()));
+  }
+
+  tile = std::move(prefetched_footer_tile_);
+  prefetched_footer_tile_ = nullptr;
+
+  return true;
+}
+
+bool FragmentMetadata::meta_file_size_from_cache() {
+  auto& cache = resources_->fragment_footer_cache();
+  if (!cache.enabled()) {
+    return false;
+  }
+
+  shared_ptr<FragmentFooterEntry> entry;
+  if (!cache.lookup(fragment_uri_.to_string(), &entry)) {
+    return false;
+  }
+
+  meta_file_size_ = entry->meta_file_size_;
+  return true;
+}
+
 void FragmentMetadata::write_generic_tile_to_file(
     const EncryptionKey& encryption_key,
     WriterTile& tile,
@@ -4058,8 +4749,13 @@ void FragmentMetadata::write_tile_offsets(
 
   // Write tile offsets
   if (tile_offsets_num != 0) {
-    serializer.write(
-        &tile_offsets_[idx][0], tile_offsets_num * sizeof(uint64_t));
+    if (version_ >= constants::bitpacked_tile_offsets_min_version) {
+      storage_format::write_bitpacked_offsets(
+          serializer, &tile_offsets_[idx][0], tile_offsets_num);
+    } else {
+      serializer.write(
+          &tile_offsets_[idx][0], tile_offsets_num * sizeof(uint64_t));
+    }
   }
 }
 
@@ -4086,8 +4782,13 @@ void FragmentMetadata::write_tile_var_offsets(
 
   // Write tile offsets
   if (tile_var_offsets_num != 0) {
-    serializer.write(
-        &tile_var_offsets_[idx][0], tile_var_offsets_num * sizeof(uint64_t));
+    if (version_ >= constants::bitpacked_tile_offsets_min_version) {
+      storage_format::write_bitpacked_offsets(
+          serializer, &tile_var_offsets_[idx][0], tile_var_offsets_num);
+    } else {
+      serializer.write(
+          &tile_var_offsets_[idx][0], tile_var_offsets_num * sizeof(uint64_t));
+    }
   }
 }
 
@@ -4266,6 +4967,33 @@ void FragmentMetadata::write_tile_null_counts(
   }
 }
 
+void FragmentMetadata::store_tile_bloom_filters(
+    unsigned idx, const EncryptionKey& encryption_key, uint64_t* nbytes) {
+  SizeComputationSerializer size_computation_serializer;
+  write_tile_bloom_filters(idx, size_computation_serializer);
+
+  WriterTile tile{WriterTile::from_generic(size_computation_serializer.size())};
+
+  Serializer serializer(tile.data(), tile.size());
+  write_tile_bloom_filters(idx, serializer);
+  write_generic_tile_to_file(encryption_key, tile, nbytes);
+
+  resources_->stats().add_counter("write_bloom_filters_size", *nbytes);
+}
+
+void FragmentMetadata::write_tile_bloom_filters(
+    unsigned idx, Serializer& serializer) {
+  // Write size of tile bloom filters
+  uint64_t tile_bloom_filters_size = tile_bloom_filters_[idx].size();
+  serializer.write<uint64_t>(tile_bloom_filters_size);
+
+  // Write tile bloom filters
+  if (tile_bloom_filters_size != 0) {
+    serializer.write(
+        tile_bloom_filters_[idx].data(), tile_bloom_filters_size);
+  }
+}
+
 void FragmentMetadata::store_fragment_min_max_sum_null_count(
     uint64_t num, const EncryptionKey& encryption_key, uint64_t* nbytes) {
   Buffer buff;
@@ -4331,6 +5059,28 @@ void FragmentMetadata::store_processed_conditions(
   resources_->stats().add_counter("write_processed_conditions_size", *nbytes);
 }
 
+void FragmentMetadata::store_zstd_dictionaries(
+    const EncryptionKey& encryption_key, uint64_t* nbytes) {
+  auto serialize_zstd_dictionaries = [this](Serializer& serializer) {
+    for (auto& dictionary : zstd_dictionaries_) {
+      serializer.write<uint64_t>(dictionary.size());
+      if (!dictionary.empty()) {
+        serializer.write(dictionary.data(), dictionary.size());
+      }
+    }
+  };
+  SizeComputationSerializer size_computation_serializer;
+  serialize_zstd_dictionaries(size_computation_serializer);
+
+  WriterTile tile{WriterTile::from_generic(size_computation_serializer.size())};
+
+  Serializer serializer(tile.data(), tile.size());
+  serialize_zstd_dictionaries(serializer);
+  write_generic_tile_to_file(encryption_key, tile, nbytes);
+
+  resources_->stats().add_counter("write_zstd_dictionaries_size", *nbytes);
+}
+
 template <class T>
 void FragmentMetadata::compute_fragment_min_max_sum(const std::string& name) {
   // For easy reference.
@@ -4686,6 +5436,7 @@ void FragmentMetadata::clean_up() {
 }
 
 const shared_ptr<const ArraySchema>& FragmentMetadata::array_schema() const {
+  ensure_footer_loaded();
   return array_schema_;
 }
 
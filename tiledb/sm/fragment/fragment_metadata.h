@@ -121,8 +121,10 @@ class FragmentMetadata {
     std::vector<bool> tile_max_;
     std::vector<bool> tile_sum_;
     std::vector<bool> tile_null_count_;
+    std::vector<bool> tile_bloom_filter_;
     bool fragment_min_max_sum_null_count_ = false;
     bool processed_conditions_ = false;
+    bool zstd_dictionaries_ = false;
   };
 
   /**
@@ -140,8 +142,56 @@ class FragmentMetadata {
     std::vector<uint64_t> tile_max_offsets_;
     std::vector<uint64_t> tile_sum_offsets_;
     std::vector<uint64_t> tile_null_count_offsets_;
+    std::vector<uint64_t> tile_bloom_filter_offsets_;
     uint64_t fragment_min_max_sum_null_count_offset_;
     uint64_t processed_conditions_offsets_;
+    uint64_t zstd_dictionaries_offset_ = 0;
+  };
+
+  /**
+   * A read-only view over one loaded tile offsets table of a single
+   * field. The view resolves the field name and validates the load state
+   * once, so that per-tile lookups are plain reads from the contiguous
+   * offsets array. Readers use this to gather the file offsets and
+   * persisted sizes of many tiles in one cache-friendly pass instead of
+   * repeating the name-to-index hash lookup for every tile.
+   */
+  class OffsetsView {
+   public:
+    /**
+     * Constructor.
+     *
+     * @param offsets The loaded offsets, one per tile.
+     * @param tile_num The number of tiles in the table.
+     * @param file_size The size of the corresponding attribute file.
+     */
+    OffsetsView(const uint64_t* offsets, uint64_t tile_num, uint64_t file_size)
+        : offsets_(offsets)
+        , tile_num_(tile_num)
+        , file_size_(file_size) {
+    }
+
+    /** Returns the file offset of the tile at the input position. */
+    inline uint64_t file_offset(uint64_t tile_idx) const {
+      return offsets_[tile_idx];
+    }
+
+    /** Returns the persisted size of the tile at the input position. */
+    inline uint64_t persisted_tile_size(uint64_t tile_idx) const {
+      return (tile_idx != tile_num_ - 1) ?
+                 offsets_[tile_idx + 1] - offsets_[tile_idx] :
+                 file_size_ - offsets_[tile_idx];
+    }
+
+   private:
+    /** The loaded offsets, one per tile. */
+    const uint64_t* offsets_;
+
+    /** The number of tiles in the table. */
+    uint64_t tile_num_;
+
+    /** The size of the corresponding attribute file. */
+    uint64_t file_size_;
   };
 
   /* ********************************* */
@@ -152,6 +202,7 @@ class FragmentMetadata {
    * Returns the number of dimensions and attributes.
    */
   inline uint64_t num_dims_and_attrs() const {
+    ensure_footer_loaded();
     return array_schema_->attribute_num() + array_schema_->dim_num() + 1 +
            has_timestamps_ + (has_delete_meta_ * 2);
   }
@@ -257,11 +308,13 @@ class FragmentMetadata {
    * is sparse.
    */
   inline bool dense() const {
+    ensure_footer_loaded();
     return dense_;
   }
 
   /** Returns the (expanded) domain in which the fragment is constrained. */
   inline const NDRange& domain() const {
+    ensure_footer_loaded();
     return domain_;
   }
 
@@ -277,40 +330,48 @@ class FragmentMetadata {
 
   /** Returns true if the metadata footer is consolidated. */
   inline bool has_consolidated_footer() const {
+    ensure_footer_loaded();
     return has_consolidated_footer_;
   }
 
   /** Returns true if the fragment has timestamps. */
   inline bool has_timestamps() const {
+    ensure_footer_loaded();
     return has_timestamps_;
   }
 
   /** Returns true if the fragment has delete metadata. */
   inline bool has_delete_meta() const {
+    ensure_footer_loaded();
     return has_delete_meta_;
   }
 
-  inline bool has_tile_metadata() {
+  inline bool has_tile_metadata() const {
+    ensure_footer_loaded();
     return version_ >= constants::tile_metadata_min_version;
   }
 
   /** Returns the sizes of each attribute file. */
   inline const std::vector<uint64_t>& file_sizes() const {
+    ensure_footer_loaded();
     return file_sizes_;
   }
 
   /** Returns the sizes of each variable attribute file. */
   inline const std::vector<uint64_t>& file_var_sizes() const {
+    ensure_footer_loaded();
     return file_var_sizes_;
   }
 
   /** Returns the sizes of each validity attribute file. */
   inline const std::vector<uint64_t>& file_validity_sizes() const {
+    ensure_footer_loaded();
     return file_validity_sizes_;
   }
 
   /** Returns the number of sparse tiles. */
   inline const uint64_t& sparse_tile_num() const {
+    ensure_footer_loaded();
     return sparse_tile_num_;
   }
 
@@ -370,6 +431,11 @@ class FragmentMetadata {
     return tile_null_counts_;
   }
 
+  /** Returns the tile bloom filters for attributes/dimensions. */
+  inline const std::vector<std::vector<uint8_t>>& tile_bloom_filters() const {
+    return tile_bloom_filters_;
+  }
+
   /** Returns the fragment mins. */
   inline const std::vector<std::vector<uint8_t>>& fragment_mins() const {
     return fragment_mins_;
@@ -397,11 +463,13 @@ class FragmentMetadata {
 
   /** Returns the number of cells in the last tile. */
   inline const uint64_t& last_tile_cell_num() const {
+    ensure_footer_loaded();
     return last_tile_cell_num_;
   }
 
   /** Returns the non-empty domain of the fragment. */
   inline const NDRange& non_empty_domain() const {
+    ensure_footer_loaded();
     return non_empty_domain_;
   }
 
@@ -412,6 +480,7 @@ class FragmentMetadata {
 
   /** Returns the generic tile offsets. */
   inline const GenericTileOffsets& generic_tile_offsets() const {
+    ensure_footer_loaded();
     return gt_offsets_;
   }
 
@@ -443,12 +512,14 @@ class FragmentMetadata {
   void init_domain(const NDRange& non_empty_domain);
 
   /**
-   * Loads the basic metadata from storage or `f_buff` for later
-   * versions if it is not `nullptr`.
+   * Loads the basic metadata from storage or `fragment_metadata_tile` for
+   * later versions if it is not `nullptr`. When a consolidated metadata
+   * tile is given, the footer is not decoded here; the tile and offset are
+   * retained and the footer is decoded lazily upon first access.
    */
   void load(
       const EncryptionKey& encryption_key,
-      Tile* fragment_metadata_tile,
+      shared_ptr<Tile> fragment_metadata_tile,
       uint64_t offset,
       std::unordered_map<std::string, shared_ptr<ArraySchema>> array_schemas);
 
@@ -477,6 +548,11 @@ class FragmentMetadata {
    *     where the basic fragment metadata can be found. If the offset
    *     cannot be found, then the metadata of that fragment will be loaded from
    *     storage instead.
+   * @param preloaded A map from a fragment URI to already loaded metadata
+   *     for that fragment, e.g. retained from a previous open of the same
+   *     array. Fragments found in the map are reused as-is instead of
+   *     being loaded again. The metadata must have been loaded with the
+   *     same memory tracker as the one passed to this function.
    * @return Vector of FragmentMetadata is the fragment metadata to be
    * retrieved.
    */
@@ -488,8 +564,11 @@ class FragmentMetadata {
           array_schemas_all,
       const EncryptionKey& encryption_key,
       const std::vector<TimestampedURI>& fragments_to_load,
-      const std::unordered_map<std::string, std::pair<Tile*, uint64_t>>&
-          offsets);
+      const std::unordered_map<
+          std::string,
+          std::pair<shared_ptr<Tile>, uint64_t>>& offsets,
+      const std::unordered_map<std::string, shared_ptr<FragmentMetadata>>&
+          preloaded = {});
 
   /** Stores all the metadata to storage. */
   void store(const EncryptionKey& encryption_key);
@@ -697,6 +776,17 @@ class FragmentMetadata {
   void set_tile_null_count(
       const std::string& name, uint64_t tid, uint64_t null_count);
 
+  /**
+   * Sets a tile bloom filter for the input attribute.
+   *
+   * @param name The attribute for which the bloom filter is set.
+   * @param tid The index of the tile for which the bloom filter is set.
+   * @param bloom_filter The bloom filter.
+   * @return void
+   */
+  void set_tile_bloom_filter(
+      const std::string& name, uint64_t tid, const ByteVec& bloom_filter);
+
   /**
    * Compute fragment min, max, sum, null count for all dimensions/attributes.
    */
@@ -763,6 +853,33 @@ class FragmentMetadata {
   uint64_t file_validity_offset(
       const std::string& name, uint64_t tile_idx) const;
 
+  /**
+   * Returns a resolved view over the loaded tile offsets of the input
+   * attribute or dimension. Throws if the tile offsets are not loaded.
+   *
+   * @param name The input attribute/dimension.
+   * @return The view to be retrieved.
+   */
+  OffsetsView tile_offsets_view(const std::string& name) const;
+
+  /**
+   * Returns a resolved view over the loaded var tile offsets of the input
+   * attribute or dimension. Throws if the var tile offsets are not loaded.
+   *
+   * @param name The input attribute/dimension.
+   * @return The view to be retrieved.
+   */
+  OffsetsView tile_var_offsets_view(const std::string& name) const;
+
+  /**
+   * Returns a resolved view over the loaded validity tile offsets of the
+   * input attribute. Throws if the validity tile offsets are not loaded.
+   *
+   * @param name The input attribute.
+   * @return The view to be retrieved.
+   */
+  OffsetsView tile_validity_offsets_view(const std::string& name) const;
+
   uint64_t footer_size() const;
 
   /** Returns the MBR of the input tile. */
@@ -851,6 +968,16 @@ class FragmentMetadata {
   template <typename T>
   T get_tile_max_as(const std::string& name, uint64_t tile_idx) const;
 
+  /**
+   * Returns true if the tile min and max metadata of the input attribute
+   * or dimension are loaded, so `get_tile_min_as`/`get_tile_max_as` may be
+   * called.
+   *
+   * @param name The input attribute/dimension.
+   * @return True if the tile min/max values are loaded.
+   */
+  bool tile_min_max_loaded(const std::string& name) const;
+
   /**
    * Retrieves the tile sum value for a given attribute or dimension and tile
    * index.
@@ -872,6 +999,32 @@ class FragmentMetadata {
   uint64_t get_tile_null_count(
       const std::string& name, uint64_t tile_idx) const;
 
+  /**
+   * Returns whether the tile null count metadata is present and loaded for
+   * the given field, i.e. whether `get_tile_null_count` can be called.
+   *
+   * @param name The input attribute/dimension.
+   * @return True if the tile null counts for the field are loaded.
+   */
+  bool has_tile_null_count(const std::string& name) const;
+
+  /**
+   * Checks the tile bloom filter for a given attribute and tile index. A
+   * `false` return guarantees no cell in the tile stores the input value, a
+   * `true` return means a cell might.
+   *
+   * @param name Attribute name.
+   * @param tile_idx Tile index.
+   * @param value Value to check.
+   * @param size Value size.
+   * @return Can the tile contain the value.
+   */
+  bool tile_bloom_filter_maybe_contains(
+      const std::string& name,
+      uint64_t tile_idx,
+      const void* value,
+      uint64_t size) const;
+
   /**
    * Retrieves the min value for a given attribute or dimension.
    *
@@ -905,7 +1058,9 @@ class FragmentMetadata {
   uint64_t get_null_count(const std::string& name);
 
   /**
-   * Returns the tile metadata for a tile.
+   * Returns the tile metadata for a tile. The min/max and sum values are
+   * only filled in if the corresponding metadata kind is loaded for the
+   * attribute; unloaded kinds are reported as null.
    *
    * @param name Name of the attribute to get the data for.
    * @param tile_idx Tile index.
@@ -940,6 +1095,35 @@ class FragmentMetadata {
    */
   std::unordered_set<std::string>& get_processed_conditions_set();
 
+  /**
+   * Set the trained zstd dictionary for a field. The dictionary was used to
+   * compress the data tile chunks of the field in this fragment and is
+   * required to decompress them.
+   *
+   * @param name The field name.
+   * @param dictionary The trained dictionary.
+   */
+  void set_zstd_dictionary(
+      const std::string& name, std::vector<uint8_t> dictionary);
+
+  /**
+   * Returns whether a field has a trained zstd dictionary. The dictionaries
+   * must have been loaded before this is called.
+   *
+   * @param name The field name.
+   * @return True if the field data was compressed with a dictionary.
+   */
+  bool has_zstd_dictionary(const std::string& name) const;
+
+  /**
+   * Returns the trained zstd dictionary of a field. The dictionaries must
+   * have been loaded before this is called.
+   *
+   * @param name The field name.
+   * @return The dictionary, empty if the field has none.
+   */
+  const std::vector<uint8_t>& zstd_dictionary(const std::string& name) const;
+
   /** Returns the first timestamp of the fragment timestamp range. */
   uint64_t first_timestamp() const;
 
@@ -1013,6 +1197,35 @@ class FragmentMetadata {
   void load_tile_null_count_values(
       const EncryptionKey& encryption_key, std::vector<std::string>& names);
 
+  /**
+   * Loads bloom filter values for the attribute names.
+   *
+   * @param encryption_key The key the array got opened with.
+   * @param names The attribute names.
+   */
+  void load_tile_bloom_filter_values(
+      const EncryptionKey& encryption_key, std::vector<std::string>& names);
+
+  /**
+   * Prefetches the tile metadata (min/max/sum/null count/bloom filter)
+   * generic tiles for the input attribute names with a single vectored
+   * read, so that the subsequent per-name loads are served from memory.
+   * Names that are not part of this fragment's schema or whose metadata is
+   * already loaded are skipped.
+   *
+   * @param encryption_key The key the array got opened with.
+   * @param min_max_names The names to prefetch min/max values for.
+   * @param sum_names The names to prefetch sum values for.
+   * @param null_count_names The names to prefetch null counts for.
+   * @param bloom_filter_names The names to prefetch bloom filters for.
+   */
+  void prefetch_tile_metadata(
+      const EncryptionKey& encryption_key,
+      const std::vector<std::string>& min_max_names,
+      const std::vector<std::string>& sum_names,
+      const std::vector<std::string>& null_count_names,
+      const std::vector<std::string>& bloom_filter_names);
+
   /**
    * Loads the min max sum null count values for the fragment.
    *
@@ -1030,6 +1243,14 @@ class FragmentMetadata {
    */
   void load_processed_conditions(const EncryptionKey& encryption_key);
 
+  /**
+   * Loads the trained zstd dictionaries for the fragment. No-op for
+   * fragments written before dictionaries were introduced.
+   *
+   * @param encryption_key The key the array got opened with.
+   */
+  void load_zstd_dictionaries(const EncryptionKey& encryption_key);
+
   /**
    * Checks if the fragment overlaps partially (not fully) with a given
    * array open - end time. Assumes overlapping fragment and array open - close
@@ -1165,6 +1386,11 @@ class FragmentMetadata {
     return tile_null_counts_;
   }
 
+  /** tile_bloom_filters accessor */
+  std::vector<std::vector<uint8_t>>& tile_bloom_filters() {
+    return tile_bloom_filters_;
+  }
+
   /** fragment_mins accessor */
   std::vector<std::vector<uint8_t>>& fragment_mins() {
     return fragment_mins_;
@@ -1310,12 +1536,50 @@ class FragmentMetadata {
   /** Offset of the fragment metadata footer. */
   uint64_t footer_offset_;
 
+  /**
+   * Footer bytes stashed by `prefetch_footer` when the fragment footer
+   * cache is disabled, consumed by `footer_from_prefetch`.
+   */
+  std::shared_ptr<Tile> prefetched_footer_tile_;
+
+  /** Size of the footer in `prefetched_footer_tile_`. */
+  uint64_t prefetched_footer_size_ = 0;
+
+  /** Offset in the metadata file of `prefetched_footer_tile_`. */
+  uint64_t prefetched_footer_offset_ = 0;
+
+  /**
+   * Generic tiles stashed by `prefetch_generic_tiles`, keyed by their
+   * offset in the metadata file and consumed by
+   * `read_generic_tile_from_file`. Mutable because the stash is an I/O
+   * optimization consulted from const readers.
+   */
+  mutable std::unordered_map<uint64_t, Tile> prefetched_generic_tiles_;
+
+  /** Protects `prefetched_generic_tiles_`. */
+  mutable std::mutex prefetched_generic_tiles_mtx_;
+
   /** The uri of the fragment the metadata belongs to. */
   URI fragment_uri_;
 
   /** True if the fragment metadata footer appears in a consolidated file. */
   bool has_consolidated_footer_;
 
+  /**
+   * The consolidated metadata tile that contains this fragment's footer,
+   * retained so that the footer can be decoded lazily upon first access
+   * instead of eagerly when the array is opened. `nullptr` when the footer
+   * is not consolidated or has been loaded eagerly.
+   */
+  shared_ptr<Tile> lazy_footer_tile_;
+
+  /** The offset of this fragment's footer in `lazy_footer_tile_`. */
+  uint64_t lazy_footer_offset_ = 0;
+
+  /** The array schemas needed to decode the footer lazily. */
+  std::unordered_map<std::string, shared_ptr<ArraySchema>>
+      lazy_footer_schemas_;
+
   /** Number of cells in the last tile (meaningful only in the sparse case). */
   uint64_t last_tile_cell_num_;
 
@@ -1411,6 +1675,12 @@ class FragmentMetadata {
    */
   std::vector<std::vector<uint64_t>> tile_null_counts_;
 
+  /**
+   * The tile bloom filters for attributes/dimensions, one fixed size filter
+   * per tile.
+   */
+  std::vector<std::vector<uint8_t>> tile_bloom_filters_;
+
   /**
    * Fragment min values.
    */
@@ -1452,6 +1722,12 @@ class FragmentMetadata {
    */
   std::vector<std::string> processed_conditions_;
 
+  /**
+   * The trained zstd dictionaries for attributes/dimensions. An empty
+   * dictionary means the data of the field was compressed without one.
+   */
+  std::vector<std::vector<uint8_t>> zstd_dictionaries_;
+
   /* ********************************* */
   /*           PRIVATE METHODS         */
   /* ********************************* */
@@ -1555,6 +1831,12 @@ class FragmentMetadata {
   void load_tile_null_count_values(
       const EncryptionKey& encryption_key, unsigned idx);
 
+  /**
+   * Loads the bloom filter values for the input attribute idx from storage.
+   */
+  void load_tile_bloom_filter_values(
+      const EncryptionKey& encryption_key, unsigned idx);
+
   /** Loads the generic tile offsets from the buffer. */
   void load_generic_tile_offsets(Deserializer& deserializer);
 
@@ -1751,6 +2033,12 @@ class FragmentMetadata {
    */
   void load_tile_null_count_values(unsigned idx, Deserializer& deserializer);
 
+  /**
+   * Loads the bloom filter values for the input attribute from the input
+   * buffer.
+   */
+  void load_tile_bloom_filter_values(unsigned idx, Deserializer& deserializer);
+
   /**
    * Loads the min max sum null count values for the fragment.
    */
@@ -1761,6 +2049,11 @@ class FragmentMetadata {
    */
   void load_processed_conditions(Deserializer& deserializer);
 
+  /**
+   * Loads the trained zstd dictionaries for the fragment.
+   */
+  void load_zstd_dictionaries(Deserializer& deserializer);
+
   /** Loads the format version from the buffer. */
   void load_version(Deserializer& deserializer);
 
@@ -1782,7 +2075,7 @@ class FragmentMetadata {
    */
   void load_v3_or_higher(
       const EncryptionKey& encryption_key,
-      Tile* fragment_metadata_tile,
+      shared_ptr<Tile> fragment_metadata_tile,
       uint64_t offset,
       std::unordered_map<std::string, shared_ptr<ArraySchema>> array_schemas);
 
@@ -1798,6 +2091,24 @@ class FragmentMetadata {
       uint64_t offset,
       std::unordered_map<std::string, shared_ptr<ArraySchema>> array_schemas);
 
+  /**
+   * Decodes the footer from the retained consolidated metadata tile. Called
+   * lazily by `ensure_footer_loaded` upon the first access to footer data.
+   */
+  void load_lazy_footer();
+
+  /**
+   * Decodes the footer from the retained consolidated metadata tile if it
+   * has not been decoded yet. A no-op for metadata whose footer is already
+   * loaded, in particular for fragments that are being written and for
+   * metadata loaded from the per-fragment footer file.
+   */
+  inline void ensure_footer_loaded() const {
+    if (!loaded_metadata_.footer_ && lazy_footer_tile_ != nullptr) {
+      const_cast<FragmentMetadata*>(this)->load_lazy_footer();
+    }
+  }
+
   /** Writes the sizes of each attribute file to the buffer. */
   void write_file_sizes(Serializer& serializer) const;
 
@@ -1972,6 +2283,21 @@ class FragmentMetadata {
    */
   void write_tile_null_counts(unsigned idx, Serializer& serializer);
 
+  /**
+   * Writes the bloom filters of the input attribute to storage.
+   *
+   * @param idx The index of the attribute.
+   * @param encryption_key The encryption key.
+   * @param nbytes The total number of bytes written for the bloom filters.
+   */
+  void store_tile_bloom_filters(
+      unsigned idx, const EncryptionKey& encryption_key, uint64_t* nbytes);
+
+  /**
+   * Writes the bloom filters of the input attribute idx to the input buffer.
+   */
+  void write_tile_bloom_filters(unsigned idx, Serializer& serializer);
+
   /**
    * Writes the fragment min, max, sum and null count to storage.
    *
@@ -1991,6 +2317,15 @@ class FragmentMetadata {
   void store_processed_conditions(
       const EncryptionKey& encryption_key, uint64_t* nbytes);
 
+  /**
+   * Writes the trained zstd dictionaries to storage.
+   *
+   * @param encryption_key The encryption key.
+   * @param nbytes The total number of bytes written.
+   */
+  void store_zstd_dictionaries(
+      const EncryptionKey& encryption_key, uint64_t* nbytes);
+
   /**
    * Compute the fragment min, max and sum values.
    *
@@ -2031,6 +2366,16 @@ class FragmentMetadata {
   Tile read_generic_tile_from_file(
       const EncryptionKey& encryption_key, uint64_t offset) const;
 
+  /**
+   * Reads the generic tiles at the input offsets with a single vectored
+   * read and stashes them, to be consumed by subsequent calls to
+   * `read_generic_tile_from_file`. Offsets that are already stashed are
+   * dropped from `offsets`.
+   */
+  void prefetch_generic_tiles(
+      const EncryptionKey& encryption_key,
+      std::vector<uint64_t>& offsets) const;
+
   /**
    * Reads the fragment metadata file footer (which contains the generic tile
    * offsets) into the input buffer.
@@ -2040,6 +2385,68 @@ class FragmentMetadata {
       uint64_t* footer_offset,
       uint64_t* footer_size) const;
 
+  /**
+   * Attempts to serve the fragment metadata file footer from the context
+   * fragment footer cache, so that repeated array opens skip the footer
+   * read entirely.
+   *
+   * @param tile Set to a tile holding the footer bytes on a hit.
+   * @param footer_offset Set to the offset of the footer in the metadata
+   *     file on a hit.
+   * @param footer_size Set to the footer size on a hit.
+   * @return Whether the footer was found in the cache.
+   */
+  bool footer_from_cache(
+      std::shared_ptr<Tile>& tile,
+      uint64_t* footer_offset,
+      uint64_t* footer_size);
+
+  /**
+   * Inserts the fragment metadata file footer into the context fragment
+   * footer cache.
+   *
+   * @param tile Tile holding the footer bytes.
+   * @param footer_offset Offset of the footer in the metadata file.
+   * @param footer_size Footer size, in bytes.
+   */
+  void footer_to_cache(
+      const Tile& tile, uint64_t footer_offset, uint64_t footer_size) const;
+
+  /**
+   * Attempts to retrieve the fragment metadata file size from the context
+   * fragment footer cache, avoiding one `file_size` call per fragment on
+   * array open.
+   *
+   * @return Whether the file size was found in the cache.
+   */
+  bool meta_file_size_from_cache();
+
+  /**
+   * Fetches the fragment metadata file footer, without deserializing
+   * it. Used by the bulk loader to batch all footer reads into one pass
+   * on the IO thread pool. The footer bytes go into the context
+   * fragment footer cache when it is enabled, and are stashed on this
+   * object otherwise; either way the subsequent `load` skips the footer
+   * read. A no-op for v1/v2 fragments (which have no footer) and
+   * already cached footers.
+   */
+  void prefetch_footer();
+
+  /**
+   * Attempts to serve the fragment metadata file footer from the bytes
+   * stashed by `prefetch_footer`, consuming them.
+   *
+   * @param tile Set to a tile holding the footer bytes on a hit.
+   * @param footer_offset Set to the offset of the footer in the metadata
+   *     file on a hit.
+   * @param footer_size Set to the footer size on a hit.
+   * @return Whether a prefetched footer was stashed on this object.
+   */
+  bool footer_from_prefetch(
+      std::shared_ptr<Tile>& tile,
+      uint64_t* footer_offset,
+      uint64_t* footer_size);
+
   /**
    * Writes the contents of the input tile as a separate
    * generic tile to the metadata file.
@@ -557,6 +557,26 @@ Status Group::mark_member_for_addition(
   return Status::Ok();
 }
 
+Status Group::mark_members_for_addition(
+    const std::vector<GroupDetails::MemberToAdd>& members) {
+  std::lock_guard<std::mutex> lck(mtx_);
+  // Check if group is open
+  if (!is_open_) {
+    return Status_GroupError("Cannot add members; Group is not open");
+  }
+
+  // Check mode
+  if (query_type_ != QueryType::WRITE &&
+      query_type_ != QueryType::MODIFY_EXCLUSIVE) {
+    return Status_GroupError(
+        "Cannot get member; Group was not opened in write or modify_exclusive "
+        "mode");
+  }
+
+  group_details_->mark_members_for_addition(members, storage_manager_);
+  return Status::Ok();
+}
+
 Status Group::mark_member_for_removal(const std::string& name) {
   std::lock_guard<std::mutex> lck(mtx_);
   // Check if group is open
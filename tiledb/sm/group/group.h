@@ -254,6 +254,18 @@ class Group {
       const bool& relative,
       std::optional<std::string>& name);
 
+  /**
+   * Add a batch of members to a group, this will be flushed to disk on close
+   *
+   * The member URIs are validated in parallel on the compute thread pool,
+   * then the whole batch is accumulated as one mutation.
+   *
+   * @param members Members to add.
+   * @return Status
+   */
+  Status mark_members_for_addition(
+      const std::vector<GroupDetails::MemberToAdd>& members);
+
   /**
    * Remove a member from a group, this will be flushed to disk on close
    *
@@ -42,6 +42,7 @@
 #include "tiledb/sm/group/group_member_v1.h"
 #include "tiledb/sm/group/group_member_v2.h"
 #include "tiledb/sm/metadata/metadata.h"
+#include "tiledb/sm/misc/parallel_functions.h"
 #include "tiledb/sm/misc/tdb_time.h"
 #include "tiledb/sm/misc/uuid.h"
 #include "tiledb/sm/rest/rest_client.h"
@@ -112,6 +113,49 @@ void GroupDetails::mark_member_for_addition(
   members_to_modify_.emplace_back(group_member);
 }
 
+void GroupDetails::mark_members_for_addition(
+    const std::vector<MemberToAdd>& members, StorageManager* storage_manager) {
+  std::lock_guard<std::mutex> lck(mtx_);
+
+  // Resolve the member object types in parallel; this is the only part of
+  // the mutation that touches storage.
+  std::vector<URI> absolute_uris(members.size());
+  std::vector<ObjectType> types(members.size(), ObjectType::INVALID);
+  throw_if_not_ok(parallel_for(
+      storage_manager->compute_tp(), 0, members.size(), [&](size_t i) {
+        absolute_uris[i] = members[i].uri_;
+        if (members[i].relative_) {
+          absolute_uris[i] = group_uri_.join_path(members[i].uri_.to_string());
+        }
+        return storage_manager->object_type(absolute_uris[i], &types[i]);
+      }));
+
+  // Append the members in order with the same checks as a single addition.
+  for (size_t i = 0; i < members.size(); i++) {
+    if (types[i] == ObjectType::INVALID) {
+      throw GroupDetailsException(
+          "Cannot add group member " + absolute_uris[i].to_string() +
+          ", type is INVALID. The member likely does not exist.");
+    }
+
+    auto group_member = tdb::make_shared<GroupMemberV2>(
+        HERE(),
+        members[i].uri_,
+        types[i],
+        members[i].relative_,
+        members[i].name_,
+        false);
+
+    if (!member_keys_to_add_.insert(group_member->key()).second) {
+      throw GroupDetailsException(
+          "Cannot add group member " + group_member->key() +
+          ", a member with the same name or URI has already been added.");
+    }
+
+    members_to_modify_.emplace_back(group_member);
+  }
+}
+
 void GroupDetails::mark_member_for_removal(const std::string& name_or_uri) {
   std::lock_guard<std::mutex> lck(mtx_);
 
@@ -73,6 +73,33 @@ class GroupDetails {
       std::optional<std::string>& name,
       StorageManager* storage_manager);
 
+  /** A member addition request for `mark_members_for_addition`. */
+  struct MemberToAdd {
+    /** Group member URI. */
+    URI uri_;
+
+    /** Is the URI relative to the group? */
+    bool relative_;
+
+    /** Optional name for the member. */
+    std::optional<std::string> name_;
+  };
+
+  /**
+   * Add a batch of members to a group, this will be flushed to disk on close
+   *
+   * The member URIs are validated in parallel on the compute thread pool
+   * before the members are appended in order, so adding many members costs
+   * one round of concurrent storage checks instead of one serial check per
+   * member.
+   *
+   * @param members Members to add.
+   * @param storage_manager Storage manager.
+   */
+  void mark_members_for_addition(
+      const std::vector<MemberToAdd>& members,
+      StorageManager* storage_manager);
+
   /**
    * Remove a member from a group, this will be flushed to disk on close
    *
@@ -39,6 +39,7 @@
 #include "tiledb/sm/misc/uuid.h"
 #include "tiledb/storage_format/serialization/serializers.h"
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 
@@ -73,6 +74,8 @@ Metadata::Metadata(const std::map<std::string, MetadataValue>& metadata_map)
 
 Metadata::Metadata(const Metadata& rhs)
     : metadata_map_(rhs.metadata_map_)
+    , blocks_(rhs.blocks_)
+    , merged_block_tiles_(rhs.merged_block_tiles_)
     , timestamp_range_(rhs.timestamp_range_)
     , loaded_metadata_uris_(rhs.loaded_metadata_uris_)
     , uri_(rhs.uri_) {
@@ -82,6 +85,8 @@ Metadata::Metadata(const Metadata& rhs)
 
 Metadata& Metadata::operator=(const Metadata& other) {
   metadata_map_ = other.metadata_map_;
+  blocks_ = other.blocks_;
+  merged_block_tiles_ = other.merged_block_tiles_;
   timestamp_range_ = other.timestamp_range_;
   loaded_metadata_uris_ = other.loaded_metadata_uris_;
   uri_ = other.uri_;
@@ -98,6 +103,8 @@ Metadata::~Metadata() = default;
 void Metadata::clear() {
   metadata_map_.clear();
   metadata_index_.clear();
+  blocks_.clear();
+  merged_block_tiles_.clear();
   loaded_metadata_uris_.clear();
   timestamp_range_ = std::make_pair(0, 0);
   uri_ = URI();
@@ -129,47 +136,23 @@ Metadata Metadata::deserialize(
   if (metadata_tiles.empty()) {
     return Metadata();
   }
-  std::map<std::string, MetadataValue> metadata_map;
 
-  Status st;
-  uint32_t key_len;
-  char del;
-  size_t value_len;
+  // Index each tile as a key-sorted block instead of merging all items
+  // into the metadata map eagerly. Point lookups binary-search the
+  // blocks; the map is materialized only if a full view of the metadata
+  // is needed (e.g. for iteration or consolidation).
+  Metadata metadata;
+  metadata.blocks_.reserve(metadata_tiles.size());
   for (const auto& tile : metadata_tiles) {
-    // Iterate over all items
-    Deserializer deserializer(tile->data(), tile->size());
-    while (deserializer.remaining_bytes()) {
-      key_len = deserializer.read<uint32_t>();
-      std::string key(deserializer.get_ptr<char>(key_len), key_len);
-      deserializer.read(&del, sizeof(char));
-
-      metadata_map.erase(key);
-
-      // Handle deletion
-      if (del)
-        continue;
-
-      MetadataValue value_struct;
-      value_struct.del_ = del;
-      value_struct.type_ = deserializer.read<char>();
-      value_struct.num_ = deserializer.read<uint32_t>();
-
-      if (value_struct.num_) {
-        value_len = value_struct.num_ *
-                    datatype_size(static_cast<Datatype>(value_struct.type_));
-        value_struct.value_.resize(value_len);
-        deserializer.read((void*)value_struct.value_.data(), value_len);
-      }
-
-      // Insert to metadata
-      metadata_map.emplace(std::make_pair(key, std::move(value_struct)));
-    }
+    metadata.blocks_.emplace_back(build_block(tile));
   }
 
-  return Metadata(metadata_map);
+  return metadata;
 }
 
 void Metadata::serialize(Serializer& serializer) const {
+  materialize_blocks();
+
   // Do nothing if there are no metadata to serialize
   if (metadata_map_.empty()) {
     return;
@@ -202,7 +185,7 @@ void Metadata::del(const char* key) {
   MetadataValue value;
   value.del_ = 1;
   metadata_map_.insert_or_assign(key, std::move(value));
-  build_metadata_index();
+  metadata_index_.clear();
 }
 
 void Metadata::put(
@@ -228,7 +211,7 @@ void Metadata::put(
     std::memcpy(value_struct.value_.data(), value, value_size);
   }
   metadata_map_.insert_or_assign(key, std::move(value_struct));
-  build_metadata_index();
+  metadata_index_.clear();
 }
 
 void Metadata::get(
@@ -238,10 +221,28 @@ void Metadata::get(
     const void** value) const {
   assert(key != nullptr);
 
+  std::unique_lock<std::mutex> lck(mtx_);
+
   auto it = metadata_map_.find(key);
   if (it == metadata_map_.end()) {
-    // Key not found
-    *value = nullptr;
+    // Key not in the map; binary-search any blocks not merged yet.
+    auto entry = search_blocks(key);
+    if (entry == nullptr || entry->del_) {
+      // Key not found
+      *value = nullptr;
+      return;
+    }
+
+    // Key found
+    *value_type = static_cast<Datatype>(entry->type_);
+    if (entry->num_ == 0) {
+      // zero-valued keys
+      *value_num = 1;
+      *value = nullptr;
+    } else {
+      *value_num = entry->num_;
+      *value = entry->value_;
+    }
     return;
   }
 
@@ -265,6 +266,8 @@ void Metadata::get(
     Datatype* value_type,
     uint32_t* value_num,
     const void** value) {
+  materialize_blocks();
+
   if (metadata_index_.empty())
     build_metadata_index();
 
@@ -292,10 +295,19 @@ void Metadata::get(
 std::optional<Datatype> Metadata::metadata_type(const char* key) {
   assert(key != nullptr);
 
+  std::unique_lock<std::mutex> lck(mtx_);
+
   auto it = metadata_map_.find(key);
   if (it == metadata_map_.end()) {
-    // Key not found
-    return nullopt;
+    // Key not in the map; binary-search any blocks not merged yet.
+    auto entry = search_blocks(key);
+    if (entry == nullptr || entry->del_) {
+      // Key not found
+      return nullopt;
+    }
+
+    // Key found
+    return static_cast<Datatype>(entry->type_);
   }
 
   // Key found
@@ -304,6 +316,7 @@ std::optional<Datatype> Metadata::metadata_type(const char* key) {
 }
 
 uint64_t Metadata::num() const {
+  materialize_blocks();
   return metadata_map_.size();
 }
 
@@ -329,6 +342,8 @@ const std::vector<URI>& Metadata::loaded_metadata_uris() const {
 void Metadata::swap(Metadata* metadata) {
   std::swap(metadata_map_, metadata->metadata_map_);
   std::swap(metadata_index_, metadata->metadata_index_);
+  std::swap(blocks_, metadata->blocks_);
+  std::swap(merged_block_tiles_, metadata->merged_block_tiles_);
   std::swap(timestamp_range_, metadata->timestamp_range_);
   std::swap(loaded_metadata_uris_, metadata->loaded_metadata_uris_);
 }
@@ -346,10 +361,12 @@ void Metadata::reset(
 }
 
 Metadata::iterator Metadata::begin() const {
+  materialize_blocks();
   return metadata_map_.cbegin();
 }
 
 Metadata::iterator Metadata::end() const {
+  materialize_blocks();
   return metadata_map_.cend();
 }
 
@@ -357,7 +374,7 @@ Metadata::iterator Metadata::end() const {
 /*          PRIVATE METHODS          */
 /* ********************************* */
 
-void Metadata::build_metadata_index() {
+void Metadata::build_metadata_index() const {
   // Create metadata index for fast lookups from index
   metadata_index_.resize(metadata_map_.size());
   size_t i = 0;
@@ -365,5 +382,114 @@ void Metadata::build_metadata_index() {
     metadata_index_[i++] = std::make_pair(&(m.first), &(m.second));
 }
 
+Metadata::Block Metadata::build_block(const shared_ptr<Tile>& tile) {
+  Block block;
+  block.tile_ = tile;
+
+  // Iterate over all items
+  Deserializer deserializer(tile->data(), tile->size());
+  bool sorted = true;
+  while (deserializer.remaining_bytes()) {
+    BlockEntry entry;
+    auto key_len = deserializer.read<uint32_t>();
+    entry.key_ =
+        std::string_view(deserializer.get_ptr<char>(key_len), key_len);
+    deserializer.read(&entry.del_, sizeof(char));
+    if (!entry.del_) {
+      entry.type_ = deserializer.read<char>();
+      entry.num_ = deserializer.read<uint32_t>();
+      if (entry.num_) {
+        auto value_len =
+            entry.num_ * datatype_size(static_cast<Datatype>(entry.type_));
+        entry.value_ = deserializer.get_ptr<char>(value_len);
+      }
+    }
+
+    if (!block.entries_.empty() && entry.key_ < block.entries_.back().key_)
+      sorted = false;
+    block.entries_.emplace_back(entry);
+  }
+
+  // Items are serialized in key order, but sort defensively so that the
+  // binary search in `search_blocks` is always valid. The sort is stable
+  // so that duplicate keys remain in time order.
+  if (!sorted) {
+    std::stable_sort(
+        block.entries_.begin(),
+        block.entries_.end(),
+        [](const BlockEntry& a, const BlockEntry& b) {
+          return a.key_ < b.key_;
+        });
+  }
+
+  return block;
+}
+
+const Metadata::BlockEntry* Metadata::search_blocks(
+    std::string_view key) const {
+  for (auto block = blocks_.rbegin(); block != blocks_.rend(); ++block) {
+    // Find the last entry with a matching key; for duplicate keys within
+    // a block, the last one in key order is the most recent.
+    auto it = std::upper_bound(
+        block->entries_.begin(),
+        block->entries_.end(),
+        key,
+        [](std::string_view k, const BlockEntry& entry) {
+          return k < entry.key_;
+        });
+    if (it != block->entries_.begin() && std::prev(it)->key_ == key)
+      return &(*std::prev(it));
+  }
+
+  return nullptr;
+}
+
+void Metadata::materialize_blocks() const {
+  std::unique_lock<std::mutex> lck(mtx_);
+
+  if (blocks_.empty())
+    return;
+
+  // Merge the blocks, oldest first, handling any deleted or overwritten
+  // items considering the order.
+  std::map<std::string, MetadataValue> merged;
+  for (const auto& block : blocks_) {
+    for (const auto& entry : block.entries_) {
+      std::string key(entry.key_);
+      merged.erase(key);
+
+      // Handle deletion
+      if (entry.del_)
+        continue;
+
+      MetadataValue value_struct;
+      value_struct.del_ = entry.del_;
+      value_struct.type_ = entry.type_;
+      value_struct.num_ = entry.num_;
+      if (entry.num_) {
+        auto value_len =
+            entry.num_ * datatype_size(static_cast<Datatype>(entry.type_));
+        value_struct.value_.resize(value_len);
+        std::memcpy(value_struct.value_.data(), entry.value_, value_len);
+      }
+
+      // Insert to metadata
+      merged.emplace(std::make_pair(std::move(key), std::move(value_struct)));
+    }
+  }
+
+  // Items written to this object directly are more recent than any block.
+  for (auto& m : metadata_map_)
+    merged.insert_or_assign(m.first, std::move(m.second));
+  metadata_map_.swap(merged);
+  metadata_index_.clear();
+
+  // Retain the tiles so that value pointers returned before the merge
+  // remain valid.
+  for (auto& block : blocks_)
+    merged_block_tiles_.emplace_back(std::move(block.tile_));
+  blocks_.clear();
+}
+
 }  // namespace sm
 }  // namespace tiledb
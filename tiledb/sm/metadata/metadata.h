@@ -36,6 +36,7 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <string_view>
 #include <vector>
 
 #include "tiledb/common/common.h"
@@ -230,19 +231,68 @@ class Metadata {
   iterator end() const;
 
  private:
+  /* ********************************* */
+  /*      PRIVATE TYPE DEFINITIONS     */
+  /* ********************************* */
+
+  /** A metadata item parsed in place from a loaded metadata tile. */
+  struct BlockEntry {
+    /** The key, pointing into the tile data. */
+    std::string_view key_;
+    /** 1 if it is a deletion and 0 if it is an insertion. */
+    char del_ = 0;
+    /** The value datatype. */
+    char type_ = 0;
+    /** The number of values. */
+    uint32_t num_ = 0;
+    /** The value in binary format, pointing into the tile data. */
+    const void* value_ = nullptr;
+  };
+
+  /**
+   * A key-sorted index over the items of a single loaded metadata tile.
+   * Blocks allow `get` to binary-search the loaded tiles directly,
+   * without first merging all items into `metadata_map_`.
+   */
+  struct Block {
+    /** The tile the entries point into, kept alive by the block. */
+    shared_ptr<Tile> tile_;
+    /** The tile items, sorted on key. */
+    std::vector<BlockEntry> entries_;
+  };
+
   /* ********************************* */
   /*         PRIVATE ATTRIBUTES        */
   /* ********************************* */
 
-  /** A map from metadata key to metadata value. */
-  std::map<std::string, MetadataValue> metadata_map_;
+  /**
+   * A map from metadata key to metadata value. For deserialized metadata
+   * this is populated lazily by `materialize_blocks`, hence mutable.
+   */
+  mutable std::map<std::string, MetadataValue> metadata_map_;
 
   /**
    * A vector pointing to all the values in `metadata_map_`. It facilitates
    * searching metadata from index. Used only for reading metadata (inapplicable
-   * when writing metadata).
+   * when writing metadata). Built lazily, hence mutable.
+   */
+  mutable std::vector<std::pair<const std::string*, MetadataValue*>>
+      metadata_index_;
+
+  /**
+   * Key-sorted blocks, one per loaded metadata tile, sorted on time
+   * (oldest first). Point lookups binary-search the blocks from newest
+   * to oldest; `materialize_blocks` merges them into `metadata_map_` the
+   * first time a full view of the metadata is needed, hence mutable.
+   */
+  mutable std::vector<Block> blocks_;
+
+  /**
+   * The tiles of blocks that have been merged into `metadata_map_`. They
+   * are kept alive so that value pointers returned by `get` before the
+   * merge remain valid.
    */
-  std::vector<std::pair<const std::string*, MetadataValue*>> metadata_index_;
+  mutable std::vector<shared_ptr<Tile>> merged_block_tiles_;
 
   /** Mutex for thread-safety. */
   mutable std::mutex mtx_;
@@ -269,7 +319,23 @@ class Metadata {
   /**
    * Build the metadata index vector from the metadata map
    */
-  void build_metadata_index();
+  void build_metadata_index() const;
+
+  /** Builds a key-sorted block from the items of a single metadata tile. */
+  static Block build_block(const shared_ptr<Tile>& tile);
+
+  /**
+   * Binary-searches the blocks, newest first, for `key`. Returns the
+   * matching entry, or `nullptr` if the key is in no block. The caller
+   * must be holding `mtx_`.
+   */
+  const BlockEntry* search_blocks(std::string_view key) const;
+
+  /**
+   * Merges all blocks into `metadata_map_`, oldest first, so that a full
+   * view of the metadata is available. No-op if there are no blocks.
+   */
+  void materialize_blocks() const;
 };
 
 }  // namespace sm
@@ -47,8 +47,12 @@ ThreadPool::Task CancelableTasks::execute(
     ThreadPool* const thread_pool,
     std::function<Status()>&& fn,
     std::function<void()>&& on_cancel) {
-  std::function<Status()> wrapped_fn =
-      std::bind(&CancelableTasks::fn_wrapper, this, fn, on_cancel);
+  std::function<Status()> wrapped_fn = std::bind(
+      &CancelableTasks::fn_wrapper,
+      this,
+      fn,
+      on_cancel,
+      ThreadPool::current_cancellation_token());
 
   ThreadPool::Task task = thread_pool->execute(std::move(wrapped_fn));
   if (task.valid()) {
@@ -75,9 +79,11 @@ void CancelableTasks::cancel_all_tasks() {
 }
 
 Status CancelableTasks::fn_wrapper(
-    const std::function<Status()>& fn, const std::function<void()>& on_cancel) {
+    const std::function<Status()>& fn,
+    const std::function<void()>& on_cancel,
+    const shared_ptr<ThreadPool::CancellationToken>& token) {
   std::unique_lock<std::mutex> lck(outstanding_tasks_mutex_);
-  if (should_cancel_) {
+  if (should_cancel_ || (token != nullptr && token->cancelled())) {
     if (on_cancel) {
       lck.unlock();
       on_cancel();
@@ -89,7 +95,13 @@ Status CancelableTasks::fn_wrapper(
     return Status_Error("Task cancelled before execution.");
   } else {
     lck.unlock();
-    Status st = fn();
+    Status st;
+    {
+      // Make the submitting thread's token pollable from within `fn`, e.g.
+      // by `parallel_for` loops it runs.
+      ThreadPool::CancellationScope scope(token);
+      st = fn();
+    }
     lck.lock();
     --outstanding_tasks_;
     // If 'should_cancel_' became true when the lock was released to execute
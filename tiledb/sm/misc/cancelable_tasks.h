@@ -77,17 +77,21 @@ class CancelableTasks {
 
  private:
   /**
-   * The wrapped task decorator. If all tasks have been cancelled, they will
-   * short-circuit here with an appropriate return value.
+   * The wrapped task decorator. If all tasks have been cancelled, or the
+   * cancellation token the submitting thread ran under was cancelled, they
+   * will short-circuit here with an appropriate return value.
    *
    * @param function Task to be executed.
    * @param function Optional routine to execute on cancelation.
+   * @param token The submitting thread's cancellation token, if any. It is
+   * installed as the executing thread's current token while `fn` runs.
    * @return Status The returned status from 'fn', or a non-OK status if tasks
    * were cancelled.
    */
   Status fn_wrapper(
       const std::function<Status()>& fn,
-      const std::function<void()>& on_cancel);
+      const std::function<void()>& on_cancel,
+      const shared_ptr<ThreadPool::CancellationToken>& token);
 
   /** The number of outstanding tasks */
   uint32_t outstanding_tasks_;
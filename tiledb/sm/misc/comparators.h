@@ -35,6 +35,7 @@
 #ifndef TILEDB_COMPARATORS_H
 #define TILEDB_COMPARATORS_H
 
+#include <array>
 #include <cinttypes>
 #include <vector>
 
@@ -82,6 +83,16 @@ class CellCmpBase {
   [[nodiscard]] int cell_order_cmp_RC(
       unsigned int d, const RCType& a, const RCType& b) const {
     const auto& dim{*(domain_.dimension_ptr(d))};
+    if (dim.var_size()) {
+      // Most string comparisons resolve on the 8-byte big-endian prefix
+      // keys, which avoids the full lexicographic comparison. Equal keys
+      // mean equal (possibly padded) prefixes, so fall through below.
+      const auto key_a = a.coord_string_prefix(d);
+      const auto key_b = b.coord_string_prefix(d);
+      if (key_a != key_b) {
+        return key_a < key_b ? -1 : 1;
+      }
+    }
     auto v1{a.dimension_datum(dim, d)};
     auto v2{b.dimension_datum(dim, d)};
     return domain_.cell_order_cmp(d, v1, v2);
@@ -470,6 +481,182 @@ class GlobalCmpReverse {
   GlobalCmp cmp_;
 };
 
+/**
+ * Comparison function for sorting coords on the global order of a domain
+ * with a known, fixed number of dimensions sharing one integer datatype.
+ *
+ * This is a drop-in replacement for `GlobalCmp` that avoids the
+ * per-dimension indirection through the `Domain` comparison functions. The
+ * coordinates are loaded and compared inline, with dimension loops of a
+ * compile-time bound the compiler can fully unroll. It may only be used
+ * when every dimension is fixed-sized, has datatype `T` and has a tile
+ * extent set.
+ */
+template <class T, unsigned DimNum>
+class GlobalCmpTyped : public CellCmpBase {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param domain The array domain.
+   * @param use_timestamps Use timestamps or not for this comparator.
+   * @param strict_ordering Enforce strict ordering for the comparator if used
+   * in a queue.
+   * @param frag_md Pointer to the fragment metadata.
+   */
+  explicit GlobalCmpTyped(
+      const Domain& domain,
+      const bool use_timestamps = false,
+      const bool strict_ordering = false,
+      const std::vector<shared_ptr<FragmentMetadata>>* frag_md = nullptr)
+      : CellCmpBase(domain, use_timestamps, strict_ordering, frag_md) {
+    tile_order_ = domain.tile_order();
+    cell_order_ = domain.cell_order();
+    for (unsigned d = 0; d < DimNum; ++d) {
+      auto dim{domain.dimension_ptr(d)};
+      domain_low_[d] = static_cast<const T*>(dim->domain().data())[0];
+      tile_extents_[d] = *reinterpret_cast<const T*>(dim->tile_extent().data());
+    }
+  }
+
+  /**
+   * Comparison operator for a vector of `ResultCoords`.
+   *
+   * @param a The first coordinate.
+   * @param b The second coordinate.
+   * @return `true` if `a` precedes `b` and `false` otherwise.
+   */
+  template <class RCType>
+  bool operator()(const RCType& a, const RCType& b) const {
+    T coords_a[DimNum];
+    T coords_b[DimNum];
+    for (unsigned d = 0; d < DimNum; ++d) {
+      coords_a[d] = *static_cast<const T*>(a.coord(d));
+      coords_b[d] = *static_cast<const T*>(b.coord(d));
+    }
+
+    // Compare tile order
+    if (tile_order_ == Layout::ROW_MAJOR) {
+      for (unsigned d = 0; d < DimNum; ++d) {
+        auto res = tile_order_cmp(d, coords_a[d], coords_b[d]);
+
+        if (res == -1)
+          return true;
+        if (res == 1)
+          return false;
+        // else same tile on dimension d --> continue
+      }
+    } else {  // COL_MAJOR
+      for (int32_t d = static_cast<int32_t>(DimNum) - 1; d >= 0; d--) {
+        auto res = tile_order_cmp(d, coords_a[d], coords_b[d]);
+
+        if (res == -1)
+          return true;
+        if (res == 1)
+          return false;
+        // else same tile on dimension d --> continue
+      }
+    }
+
+    // Compare cell order
+    if (cell_order_ == Layout::ROW_MAJOR) {
+      for (unsigned d = 0; d < DimNum; ++d) {
+        if (coords_a[d] < coords_b[d])
+          return true;
+        if (coords_a[d] > coords_b[d])
+          return false;
+        // else same coordinate on dimension d --> continue
+      }
+    } else {  // COL_MAJOR
+      for (int32_t d = static_cast<int32_t>(DimNum) - 1; d >= 0; d--) {
+        if (coords_a[d] < coords_b[d])
+          return true;
+        if (coords_a[d] > coords_b[d])
+          return false;
+        // else same coordinate on dimension d --> continue
+      }
+    }
+
+    // Compare timestamps
+    if (use_timestamps_) {
+      return get_timestamp(a) > get_timestamp(b);
+    } else if (strict_ordering_) {
+      if (a.tile_->frag_idx() == b.tile_->frag_idx()) {
+        if (a.tile_->tile_idx() == b.tile_->tile_idx()) {
+          return a.pos_ > b.pos_;
+        }
+
+        return a.tile_->tile_idx() > b.tile_->tile_idx();
+      }
+
+      return a.tile_->frag_idx() > b.tile_->frag_idx();
+    }
+
+    return false;
+  }
+
+ private:
+  /** Compares the tile indexes of two coordinates on one dimension. */
+  inline int tile_order_cmp(unsigned d, T coord_a, T coord_b) const {
+    auto ta = Dimension::tile_idx(coord_a, domain_low_[d], tile_extents_[d]);
+    auto tb = Dimension::tile_idx(coord_b, domain_low_[d], tile_extents_[d]);
+    if (ta < tb)
+      return -1;
+    if (ta > tb)
+      return 1;
+    return 0;
+  }
+
+  /** The tile order. */
+  Layout tile_order_;
+  /** The cell order. */
+  Layout cell_order_;
+  /** Per-dimension domain start. */
+  std::array<T, DimNum> domain_low_;
+  /** Per-dimension tile extent. */
+  std::array<T, DimNum> tile_extents_;
+};
+
+/**
+ * Wrapper of `GlobalCmpTyped` comparing in reverse order.
+ */
+template <class T, unsigned DimNum>
+class GlobalCmpReverseTyped {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param domain The array domain.
+   * @param use_timestamps Use timestamps or not for this comparator.
+   * @param strict_ordering Enforce strict ordering for the comparator if used
+   * in a queue.
+   * @param frag_md Pointer to the fragment metadata.
+   */
+  explicit GlobalCmpReverseTyped(
+      const Domain& domain,
+      const bool use_timestamps = false,
+      const bool strict_ordering = false,
+      const std::vector<shared_ptr<FragmentMetadata>>* frag_md = nullptr)
+      : cmp_(domain, use_timestamps, strict_ordering, frag_md) {
+  }
+
+  /**
+   * Comparison operator for a vector of `ResultCoords`.
+   *
+   * @param a The first coordinate.
+   * @param b The second coordinate.
+   * @return `true` if `a` precedes `b` and `false` otherwise.
+   */
+  template <class RCType>
+  bool operator()(const RCType& a, const RCType& b) const {
+    return !cmp_.operator()(a, b);
+  }
+
+ private:
+  /** GlobalCmpTyped. */
+  GlobalCmpTyped<T, DimNum> cmp_;
+};
+
 /**
  * Base class for comparison function classes whose operands are domain values
  * residing in QueryBuffer objects.
@@ -546,6 +733,43 @@ class GlobalCmpQB : protected DomainValueCmpBaseQB {
   }
 };
 
+/**
+ * (Cell order) Comparsion (Cmp) function class that operates on values that
+ * reside in QueryBuffers (QB) for a domain. Applicable when the compared
+ * cells are known to reside in the same space tile, so the tile order does
+ * not need to be consulted.
+ */
+class CellCmpQB : protected DomainValueCmpBaseQB {
+ public:
+  /// Default constructor is prohibited.
+  CellCmpQB() = delete;
+
+  /**
+   * Constructor.
+   *
+   * @param domain The array domain.
+   * @param buffs The coordinate query buffers, one per dimension.
+   */
+  CellCmpQB(const Domain& domain, const DomainBuffersView& db)
+      : DomainValueCmpBaseQB(domain, db) {
+  }
+
+  /**
+   * Positional comparison operator.
+   *
+   * @param a The first cell position.
+   * @param b The second cell position.
+   * @return `true` if cell at `a` across all coordinate buffers precedes
+   *     cell at `b` in the cell order, and `false` otherwise.
+   */
+  bool operator()(uint64_t a, uint64_t b) const {
+    auto left{domain_ref_at(a)};
+    auto right{domain_ref_at(b)};
+    auto cell_cmp = domain_.cell_order_cmp(left, right);
+    return cell_cmp == -1;
+  }
+};
+
 /**
  * (Hilbert) Comparsion (Cmp) function class that operates on values that
  * reside in QueryBuffers (QB) for a domain.
@@ -424,6 +424,9 @@ const std::string filter_checksum_md5_str = "CHECKSUM_MD5";
 /** String describing FILTER_CHECKSUM_SHA256. */
 const std::string filter_checksum_sha256_str = "CHECKSUM_SHA256";
 
+/** String describing FILTER_CHECKSUM_CRC32C. */
+const std::string filter_checksum_crc32c_str = "CHECKSUM_CRC32C";
+
 /** String describing FILTER_DICTIONARY. */
 const std::string filter_dictionary_str = "DICTIONARY_ENCODING";
 
@@ -676,7 +679,7 @@ const int32_t library_version[3] = {
     TILEDB_VERSION_MAJOR, TILEDB_VERSION_MINOR, TILEDB_VERSION_PATCH};
 
 /** The TileDB serialization base format version number. */
-const format_version_t base_format_version = 21;
+const format_version_t base_format_version = 24;
 
 /**
  * The TileDB serialization format version number.
@@ -704,11 +707,26 @@ const format_version_t updates_min_version = 16;
 /** The lowest version supported for tile min/max/sum/null count data. */
 const format_version_t tile_metadata_min_version = 11;
 
+/** The lowest version supported for tile bloom filter data. */
+const format_version_t tile_bloom_filter_min_version = 22;
+
+/** The lowest version writing bit-packed tile offsets. */
+const format_version_t bitpacked_tile_offsets_min_version = 24;
+
+/** The size, in bytes, of the bloom filter stored per tile. */
+const uint64_t tile_bloom_filter_size = 64;
+
+/** The number of hash functions used by the per-tile bloom filters. */
+const uint64_t tile_bloom_filter_hash_num = 4;
+
+/** The lowest version supported for fragment zstd dictionaries. */
+const format_version_t zstd_dictionary_min_version = 23;
+
 /** The lowest version supported format version for enumerations. */
 const format_version_t enumerations_min_format_version = 20;
 
 /** The current enumerations version. */
-const format_version_t enumerations_version = 0;
+const format_version_t enumerations_version = 2;
 
 /** The maximum size of a tile chunk (unit of compression) in bytes. */
 const uint64_t max_tile_chunk_size = 64 * 1024;
@@ -731,6 +749,18 @@ const unsigned int gcs_max_attempts = 100;
 /** Milliseconds of wait time between GCS attempts. */
 const unsigned int gcs_attempt_sleep_ms = 1000;
 
+/** Maximum number of attempts to upload a single GCS object part. */
+const unsigned int gcs_max_part_upload_attempts = 3;
+
+/** Maximum number of source objects in a single GCS compose request. */
+const uint64_t gcs_max_parts_per_compose = 32;
+
+/** Number of Azure blocks staged between block size doublings. */
+const uint64_t azure_block_autoscale_num_blocks = 10000;
+
+/** Maximum size in bytes of a staged Azure block (4000 MiB). */
+const uint64_t azure_max_block_size = 4194304000;
+
 /** An allocation tag used for logging. */
 const std::string s3_allocation_tag = "TileDB";
 
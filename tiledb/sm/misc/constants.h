@@ -425,6 +425,9 @@ extern const std::string filter_checksum_md5_str;
 /** String describing FILTER_CHECKSUM_SHA256. */
 extern const std::string filter_checksum_sha256_str;
 
+/** String describing FILTER_CHECKSUM_CRC32C. */
+extern const std::string filter_checksum_crc32c_str;
+
 /** String describing FILTER_DICTIONARY. */
 extern const std::string filter_dictionary_str;
 
@@ -693,6 +696,21 @@ extern const format_version_t updates_min_version;
 /** The lowest version supported for tile min/max/sum/null count data. */
 extern const format_version_t tile_metadata_min_version;
 
+/** The lowest version supported for tile bloom filter data. */
+extern const format_version_t tile_bloom_filter_min_version;
+
+/** The lowest version writing bit-packed tile offsets. */
+extern const format_version_t bitpacked_tile_offsets_min_version;
+
+/** The size, in bytes, of the bloom filter stored per tile. */
+extern const uint64_t tile_bloom_filter_size;
+
+/** The number of hash functions used by the per-tile bloom filters. */
+extern const uint64_t tile_bloom_filter_hash_num;
+
+/** The lowest version supported for fragment zstd dictionaries. */
+extern const format_version_t zstd_dictionary_min_version;
+
 /** The lowest version supported for enumerations. */
 extern const format_version_t enumerations_min_format_version;
 
@@ -720,6 +738,18 @@ extern const unsigned int gcs_max_attempts;
 /** Milliseconds of wait time between GCS attempts. */
 extern const unsigned int gcs_attempt_sleep_ms;
 
+/** Maximum number of attempts to upload a single GCS object part. */
+extern const unsigned int gcs_max_part_upload_attempts;
+
+/** Maximum number of source objects in a single GCS compose request. */
+extern const uint64_t gcs_max_parts_per_compose;
+
+/** Number of Azure blocks staged between block size doublings. */
+extern const uint64_t azure_block_autoscale_num_blocks;
+
+/** Maximum size in bytes of a staged Azure block (4000 MiB). */
+extern const uint64_t azure_max_block_size;
+
 /** An allocation tag used for logging. */
 extern const std::string s3_allocation_tag;
 
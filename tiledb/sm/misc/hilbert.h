@@ -186,6 +186,44 @@ class Hilbert {
     return ret;
   }
 
+  /**
+   * Converts a batch of coordinate tuples to Hilbert values. This is
+   * considerably faster than converting the tuples one by one with
+   * `coords_to_hilbert`, as the conversion is branchless and the compiler
+   * can unroll and vectorize the inner loops across the batch.
+   *
+   * @param coords The coordinate tuples to be converted, laid out
+   *     tuple-after-tuple (`num * dim_num_` values in total). The
+   *     conversion is done in place, i.e., the buffer is used as
+   *     scratch space and its contents are destroyed.
+   * @param hilbert_values The output Hilbert values (`num` values).
+   * @param num The number of coordinate tuples.
+   * @return void
+   */
+  void coords_to_hilbert(
+      uint64_t* coords, uint64_t* hilbert_values, uint64_t num) {
+    assert(coords != nullptr);
+    assert(hilbert_values != nullptr);
+
+    for (uint64_t c = 0; c < num; ++c) {
+      auto X = &coords[c * dim_num_];
+
+      // Convert coords to the transpose form of the hilbert value
+      axes_to_transpose_branchless(X, bits_, dim_num_);
+
+      // Convert the hilbert transpose form into an int64_t hilbert value
+      uint64_t ret = 0;
+      uint64_t h = 1;  // This is a bit shifted from right to left over hilbert
+      for (int j = 0; j < bits_; ++j) {
+        for (int i = dim_num_ - 1; i >= 0; --i, h <<= 1) {
+          ret |= ((X[i] >> j) & 1) * h;
+        }
+      }
+
+      hilbert_values[c] = ret;
+    }
+  }
+
   /**
    * Converts a Hilbert value into a set of coordinates.
    *
@@ -288,6 +326,48 @@ class Hilbert {
       X[i] ^= t;
   }
 
+  /**
+   * Branchless variant of `axes_to_transpose`, used by the batch conversion.
+   * The data-dependent branches of the original are replaced with mask
+   * arithmetic, so that the loop body is a straight line of bitwise
+   * operations that the compiler can unroll and vectorize.
+   *
+   * @param X Input coordinates, and output transpose (the conversion is
+   *     done in place).
+   * @param b Number of bits for representing a coordinate per dimension
+   *     (it should be equal to bits_).
+   * @param n Number of dimensions (it should be equal to dim_num_).
+   * @return void
+   */
+  void axes_to_transpose_branchless(uint64_t* X, int b, int n) {
+    uint64_t P, Q, t, m;
+    int i;
+
+    // Inverse undo
+    for (Q = (uint64_t)1 << (b - 1); Q > 1; Q >>= 1) {
+      P = Q - 1;
+      // Invert X[0] iff its Q bit is set
+      X[0] ^= P & (-(uint64_t)((X[0] & Q) != 0));
+      for (i = 1; i < n; i++) {
+        // Invert X[0] iff the Q bit of X[i] is set, exchange otherwise
+        m = -(uint64_t)((X[i] & Q) != 0);
+        t = (X[0] ^ X[i]) & P & ~m;
+        X[0] ^= (P & m) ^ t;
+        X[i] ^= t;
+      }
+    }
+
+    // Gray encode (inverse of decode)
+    for (i = 1; i < n; i++)
+      X[i] ^= X[i - 1];
+    t = X[n - 1];
+    for (i = 1; i < b; i <<= 1)
+      X[n - 1] ^= X[n - 1] >> i;
+    t ^= X[n - 1];
+    for (i = n - 2; i >= 0; i--)
+      X[i] ^= t;
+  }
+
   /**
    * From John Skilling's work. It converts the transpose of a
    * Hilbert value into the corresponding coordinates. This is done in place.
@@ -37,7 +37,9 @@
 #include "tiledb/sm/global_state/global_state.h"
 
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <vector>
 
 using namespace tiledb::common;
 
@@ -194,6 +196,14 @@ Status parallel_for(
   optional<std::exception_ptr> failed_exception{nullopt};
   optional<Status> failed_status{nullopt};
 
+  /*
+   * The cancellation token of the operation this `parallel_for` runs on
+   * behalf of, if any. The subrange loops poll it between items so that
+   * cancelling the operation stops the loops at item granularity instead
+   * of running every queued item to completion.
+   */
+  const auto cancellation_token = ThreadPool::current_cancellation_token();
+
   /*
    * Executes subrange [subrange_start, subrange_end) that exists within the
    * range [begin, end).
@@ -205,10 +215,27 @@ Status parallel_for(
    * to fail throws, then this function throws that value.
    */
   std::function<Status(uint64_t, uint64_t)> execute_subrange =
-      [&failed, &failed_exception, &failed_status, &failed_mutex, &F](
+      [&failed,
+       &failed_exception,
+       &failed_status,
+       &failed_mutex,
+       &F,
+       cancellation_token](
           const uint64_t subrange_start,
           const uint64_t subrange_end) -> Status {
+    // Propagate the caller's token to nested `parallel_for` invocations
+    // and VFS reads issued by `F`.
+    ThreadPool::CancellationScope scope(cancellation_token);
     for (uint64_t i = subrange_start; i < subrange_end; ++i) {
+      if (cancellation_token != nullptr && cancellation_token->cancelled()) {
+        Status st = Status_TaskError("Task cancelled");
+        std::lock_guard<std::mutex> lock(failed_mutex);
+        if (!failed) {
+          failed_status = st;
+          failed = true;
+        }
+        return st;
+      }
       Status st;
       try {
         st = F(i);
@@ -319,6 +346,10 @@ Status parallel_for_2d(
   Status return_st = Status::Ok();
   std::mutex return_st_mutex;
 
+  // The cancellation token of the operation this `parallel_for_2d` runs
+  // on behalf of, if any; polled between items as in `parallel_for`.
+  const auto cancellation_token = ThreadPool::current_cancellation_token();
+
   // Calculate the length of the subrange-i and subrange-j that
   // each thread will be responsible for.
   const uint64_t concurrency_level = tp->concurrency_level();
@@ -330,13 +361,18 @@ Status parallel_for_2d(
   // Executes subarray [begin_i, end_i) x [start_j, end_j) within the
   // array [i0, i1) x [j0, j1).
   std::function<Status(uint64_t, uint64_t, uint64_t, uint64_t)>
-      execute_subrange_ij = [&failed, &return_st, &return_st_mutex, &F](
-                                const uint64_t begin_i,
-                                const uint64_t end_i,
-                                const uint64_t start_j,
-                                const uint64_t end_j) -> Status {
+      execute_subrange_ij =
+          [&failed, &return_st, &return_st_mutex, &F, cancellation_token](
+              const uint64_t begin_i,
+              const uint64_t end_i,
+              const uint64_t start_j,
+              const uint64_t end_j) -> Status {
+    ThreadPool::CancellationScope scope(cancellation_token);
     for (uint64_t i = begin_i; i < end_i; ++i) {
       for (uint64_t j = start_j; j < end_j; ++j) {
+        if (cancellation_token != nullptr && cancellation_token->cancelled()) {
+          return Status_TaskError("Task cancelled");
+        }
         const Status st = F(i, j);
         if (!st.ok() && !failed) {
           failed = true;
@@ -401,6 +437,120 @@ Status parallel_for_2d(
   return return_st;
 }
 
+/**
+ * Sort the given vector with a stable LSD radix sort, possibly in parallel.
+ *
+ * This is an alternative to `parallel_sort` for the common case where a
+ * fixed-width, unsigned sort key can be extracted from each element up
+ * front. The keys are materialized once and the sort performs one counting
+ * pass per key byte instead of per-element comparator calls, which is
+ * considerably faster than comparison sorting for large inputs. The sort
+ * is stable, i.e., elements with equal keys keep their relative order.
+ *
+ * @tparam T Element type.
+ * @tparam KeyFnT Key extraction function type, invoked as
+ *     `uint64_t(const T&)`.
+ * @param tp The threadpool to use.
+ * @param values The values to sort.
+ * @param key_fn Returns the 64-bit sort key of an element.
+ */
+template <typename T, typename KeyFnT>
+void parallel_radix_sort(
+    ThreadPool* const tp, std::vector<T>& values, const KeyFnT& key_fn) {
+  assert(tp);
+
+  const uint64_t n = values.size();
+  if (n <= 1) {
+    return;
+  }
+
+  // Materialize the keys once, up front.
+  std::vector<uint64_t> keys(n);
+  throw_if_not_ok(parallel_for(tp, 0, n, [&](uint64_t i) {
+    keys[i] = key_fn(values[i]);
+    return Status::Ok();
+  }));
+
+  // Split the input into one chunk per concurrency level.
+  const uint64_t chunk_num = std::min<uint64_t>(tp->concurrency_level(), n);
+  const uint64_t chunk_size = (n + chunk_num - 1) / chunk_num;
+
+  // Scratch space for the values and keys scattered by each pass.
+  std::vector<T> values_scratch(n);
+  std::vector<uint64_t> keys_scratch(n);
+  auto src = &values;
+  auto dst = &values_scratch;
+  auto keys_src = &keys;
+  auto keys_dst = &keys_scratch;
+
+  // One pass per key byte, least significant byte first. Each pass computes
+  // per-chunk bucket histograms in parallel, turns them into per-chunk
+  // scatter offsets with a sequential prefix sum over the (at most)
+  // 256 * chunk_num counters, and then scatters the elements in parallel.
+  // The chunks write to disjoint ranges in bucket-major, chunk-minor order,
+  // which keeps each pass stable.
+  for (int pass = 0; pass < 8; pass++) {
+    const int shift = 8 * pass;
+
+    // Compute the per-chunk histograms.
+    std::vector<std::array<uint64_t, 256>> histograms(chunk_num);
+    throw_if_not_ok(parallel_for(tp, 0, chunk_num, [&](uint64_t c) {
+      auto& histogram = histograms[c];
+      histogram.fill(0);
+      const uint64_t chunk_start = c * chunk_size;
+      const uint64_t chunk_end = std::min(n, chunk_start + chunk_size);
+      for (uint64_t i = chunk_start; i < chunk_end; i++) {
+        ++histogram[((*keys_src)[i] >> shift) & 0xff];
+      }
+      return Status::Ok();
+    }));
+
+    // Skip the pass if all keys fall into the same bucket.
+    uint64_t non_empty_buckets = 0;
+    for (uint64_t v = 0; v < 256 && non_empty_buckets <= 1; v++) {
+      uint64_t bucket_count = 0;
+      for (uint64_t c = 0; c < chunk_num; c++) {
+        bucket_count += histograms[c][v];
+      }
+      non_empty_buckets += bucket_count != 0;
+    }
+    if (non_empty_buckets <= 1) {
+      continue;
+    }
+
+    // Turn the histograms into per-chunk scatter offsets.
+    uint64_t offset = 0;
+    for (uint64_t v = 0; v < 256; v++) {
+      for (uint64_t c = 0; c < chunk_num; c++) {
+        const auto count = histograms[c][v];
+        histograms[c][v] = offset;
+        offset += count;
+      }
+    }
+
+    // Scatter the elements and their keys.
+    throw_if_not_ok(parallel_for(tp, 0, chunk_num, [&](uint64_t c) {
+      auto& histogram = histograms[c];
+      const uint64_t chunk_start = c * chunk_size;
+      const uint64_t chunk_end = std::min(n, chunk_start + chunk_size);
+      for (uint64_t i = chunk_start; i < chunk_end; i++) {
+        const auto pos = histogram[((*keys_src)[i] >> shift) & 0xff]++;
+        (*dst)[pos] = (*src)[i];
+        (*keys_dst)[pos] = (*keys_src)[i];
+      }
+      return Status::Ok();
+    }));
+
+    std::swap(src, dst);
+    std::swap(keys_src, keys_dst);
+  }
+
+  // If an odd number of passes ran, move the result back into `values`.
+  if (src != &values) {
+    std::copy(src->begin(), src->end(), values.begin());
+  }
+}
+
 }  // namespace sm
 }  // namespace tiledb
 
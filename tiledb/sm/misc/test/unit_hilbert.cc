@@ -31,6 +31,7 @@
  */
 
 #include <test/support/tdb_catch.h>
+#include <random>
 #include "tiledb/sm/misc/hilbert.h"
 
 using namespace tiledb::sm;
@@ -90,3 +91,29 @@ TEST_CASE("Hilbert: Test default bits, getter", "[hilbert][bits][getter]") {
   CHECK(h.bits() == 21);
   CHECK(h.dim_num() == 3);
 }
+
+TEST_CASE("Hilbert: Test batch conversion", "[hilbert][batch]") {
+  std::mt19937_64 rng(1234);
+
+  for (int dim_num = 1; dim_num <= 5; ++dim_num) {
+    Hilbert h(dim_num);
+    uint64_t max_coord = ((uint64_t)1 << h.bits()) - 1;
+    const uint64_t num = 100;
+
+    std::vector<uint64_t> coords(num * dim_num);
+    for (auto& c : coords)
+      c = rng() & max_coord;
+
+    // Compute the expected values with the per-tuple conversion.
+    std::vector<uint64_t> expected(num);
+    for (uint64_t i = 0; i < num; ++i) {
+      std::vector<uint64_t> tuple(
+          coords.begin() + i * dim_num, coords.begin() + (i + 1) * dim_num);
+      expected[i] = h.coords_to_hilbert(tuple.data());
+    }
+
+    std::vector<uint64_t> batch_values(num);
+    h.coords_to_hilbert(coords.data(), batch_values.data(), num);
+    CHECK(batch_values == expected);
+  }
+}
@@ -45,6 +45,72 @@ static inline bool supported_string_type(Datatype type) {
       type == Datatype::STRING_UTF8);
 }
 
+/**
+ * Normalizes a member so that a null data pointer, which marks an empty
+ * probe table slot, never occurs for a stored member.
+ */
+static inline std::string_view non_null_member(std::string_view member) {
+  return member.data() == nullptr ? std::string_view("", 0) : member;
+}
+
+void ASTMemberSet::clear() {
+  members_.clear();
+  table_.clear();
+  mask_ = 0;
+}
+
+void ASTMemberSet::insert(std::string_view member) {
+  // Keep the table at most half full so probe chains stay short.
+  if (table_.empty() || (members_.size() + 1) * 2 > table_.size()) {
+    grow_table();
+  }
+
+  member = non_null_member(member);
+  const uint64_t hash = std::hash<std::string_view>{}(member);
+  uint64_t s = hash & mask_;
+  while (table_[s].member_.data() != nullptr) {
+    if (table_[s].hash_ == hash && table_[s].member_ == member) {
+      return;
+    }
+    s = (s + 1) & mask_;
+  }
+
+  table_[s] = {hash, member};
+  members_.emplace_back(member);
+}
+
+bool ASTMemberSet::contains(std::string_view member) const {
+  if (members_.empty()) {
+    return false;
+  }
+
+  member = non_null_member(member);
+  const uint64_t hash = std::hash<std::string_view>{}(member);
+  uint64_t s = hash & mask_;
+  while (table_[s].member_.data() != nullptr) {
+    if (table_[s].hash_ == hash && table_[s].member_ == member) {
+      return true;
+    }
+    s = (s + 1) & mask_;
+  }
+
+  return false;
+}
+
+void ASTMemberSet::grow_table() {
+  const uint64_t capacity = std::max<uint64_t>(16, table_.size() * 2);
+  table_.assign(capacity, Slot{0, std::string_view()});
+  mask_ = capacity - 1;
+  for (const auto& member : members_) {
+    const uint64_t hash = std::hash<std::string_view>{}(member);
+    uint64_t s = hash & mask_;
+    while (table_[s].member_.data() != nullptr) {
+      s = (s + 1) & mask_;
+    }
+    table_[s] = {hash, member};
+  }
+}
+
 ASTNodeVal::ASTNodeVal(
     const std::string& field_name,
     const void* const data,
@@ -187,6 +253,12 @@ void ASTNodeVal::rewrite_enumeration_conditions(
       case QueryConditionOp::LE:
       case QueryConditionOp::GT:
       case QueryConditionOp::GE:
+        if (enumeration->var_size() &&
+            (enumeration->type() == Datatype::STRING_ASCII ||
+             enumeration->type() == Datatype::STRING_UTF8)) {
+          rewrite_unordered_inequality(*attr, *enumeration);
+          return;
+        }
         throw std::logic_error(
             "Cannot apply an inequality operator against an unordered "
             "Enumeration");
@@ -242,6 +314,92 @@ void ASTNodeVal::rewrite_enumeration_conditions(
   use_enumeration_ = false;
 }
 
+void ASTNodeVal::rewrite_unordered_inequality(
+    const Attribute& attr, const Enumeration& enumeration) {
+  // The indices of an unordered enumeration don't reflect the order of its
+  // values, so an inequality can't be translated into a single comparison
+  // against the index data. Instead, the predicate is evaluated once per
+  // enumeration value and the condition is rewritten as a set membership
+  // test over the indices of the matching values. The membership test then
+  // only scans the fixed-width index data stored for the attribute.
+  auto val_size = datatype_size(attr.type());
+  std::string_view value(
+      static_cast<const char*>(get_value_ptr()), get_value_size());
+
+  auto data = enumeration.data();
+  auto offsets = enumeration.offsets();
+  auto void_offsets = static_cast<const void*>(offsets.data());
+  auto offset_elems = static_cast<const uint64_t*>(void_offsets);
+  uint64_t num_elems = enumeration.elem_count();
+
+  std::vector<uint64_t> matches;
+  for (uint64_t i = 0; i < num_elems; i++) {
+    uint64_t start = offset_elems[i];
+    uint64_t length;
+
+    if (i + 1 < num_elems) {
+      length = offset_elems[i + 1] - start;
+    } else {
+      length = data.size() - start;
+    }
+
+    auto void_data = static_cast<const void*>(data.data() + start);
+    std::string_view elem(static_cast<const char*>(void_data), length);
+
+    bool matched = false;
+    switch (op_) {
+      case QueryConditionOp::LT:
+        matched = elem < value;
+        break;
+      case QueryConditionOp::LE:
+        matched = elem <= value;
+        break;
+      case QueryConditionOp::GT:
+        matched = elem > value;
+        break;
+      case QueryConditionOp::GE:
+        matched = elem >= value;
+        break;
+      default:
+        throw std::logic_error(
+            "Invalid operator for rewrite against an unordered Enumeration");
+    }
+
+    if (matched) {
+      matches.push_back(i);
+    }
+  }
+
+  // Buffers and writers for the new data/offsets memory. Note that the list
+  // of matches can be empty, in which case the rewritten condition matches
+  // no cells.
+  std::vector<uint8_t> data_buffer(val_size * matches.size());
+  std::vector<uint8_t> offsets_buffer(
+      constants::cell_var_offset_size * matches.size());
+  Serializer data_writer(data_buffer.data(), data_buffer.size());
+  Serializer offsets_writer(offsets_buffer.data(), offsets_buffer.size());
+
+  ByteVecValue curr_data(val_size);
+  uint64_t curr_offset = 0;
+
+  for (auto idx : matches) {
+    utils::safe_integral_cast_to_datatype(idx, attr.type(), curr_data);
+    data_writer.write(curr_data.data(), curr_data.size());
+    offsets_writer.write(curr_offset);
+    curr_offset += val_size;
+  }
+
+  data_ = ByteVecValue(data_buffer.size());
+  std::memcpy(data_.data(), data_buffer.data(), data_buffer.size());
+
+  offsets_ = ByteVecValue(offsets_buffer.size());
+  std::memcpy(offsets_.data(), offsets_buffer.data(), offsets_buffer.size());
+
+  op_ = QueryConditionOp::IN;
+  generate_members();
+  use_enumeration_ = false;
+}
+
 Status ASTNodeVal::check_node_validity(const ArraySchema& array_schema) const {
   // Ensure that the field exists.
   if (!array_schema.is_field(field_name_)) {
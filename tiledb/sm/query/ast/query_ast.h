@@ -56,6 +56,64 @@ namespace sm {
 class ASTNegationT {};
 static constexpr ASTNegationT ASTNegation{};
 
+/**
+ * @brief A set of distinct set membership condition values, indexed by a
+ * flat, open addressing hash table.
+ *
+ * Membership probes touch contiguous table slots instead of chasing the
+ * bucket nodes of a node based hash set, which keeps `IN` conditions with
+ * millions of members cache friendly. The stored string views point into
+ * the value buffer of the owning AST node.
+ */
+class ASTMemberSet {
+ public:
+  /** Removes all members and releases the probe table. */
+  void clear();
+
+  /** Inserts a member if an equal member is not already present. */
+  void insert(std::string_view member);
+
+  /** Returns `true` if an equal member is present. */
+  bool contains(std::string_view member) const;
+
+  /** Returns the number of distinct members. */
+  inline uint64_t size() const {
+    return members_.size();
+  }
+
+  /** Iterator to the first member, in insertion order. */
+  inline std::vector<std::string_view>::const_iterator begin() const {
+    return members_.begin();
+  }
+
+  /** Iterator past the last member. */
+  inline std::vector<std::string_view>::const_iterator end() const {
+    return members_.end();
+  }
+
+ private:
+  /** A slot of the probe table; empty slots have a null member pointer. */
+  struct Slot {
+    /** Hash of the member, cached to skip most full comparisons. */
+    uint64_t hash_;
+
+    /** The member occupying the slot. */
+    std::string_view member_;
+  };
+
+  /** Doubles the probe table and re-indexes the members. */
+  void grow_table();
+
+  /** The distinct members, in insertion order. */
+  std::vector<std::string_view> members_;
+
+  /** The probe table; its size is always a power of two. */
+  std::vector<Slot> table_;
+
+  /** Size of the probe table minus one, used to mask hashes to a slot. */
+  uint64_t mask_ = 0;
+};
+
 /**
  * @brief The ASTNode class is an abstract class that contains virtual
  * methods used by both the value and expression node implementation
@@ -531,7 +589,7 @@ class ASTNodeVal : public ASTNode {
   bool is_null_;
 
   /** The set members if this is a set membership node. */
-  std::unordered_set<std::string_view> members_;
+  ASTMemberSet members_;
 
   /** The comparison operator. */
   QueryConditionOp op_;
@@ -541,6 +599,16 @@ class ASTNodeVal : public ASTNode {
 
   /** Generate the members set. */
   void generate_members();
+
+  /**
+   * Rewrite an inequality condition against an unordered string Enumeration
+   * as a set membership test over the indices of the matching values.
+   *
+   * @param attr The attribute this condition applies to.
+   * @param enumeration The enumeration referenced by the attribute.
+   */
+  void rewrite_unordered_inequality(
+      const Attribute& attr, const Enumeration& enumeration);
 };
 
 /**
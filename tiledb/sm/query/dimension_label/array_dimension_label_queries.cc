@@ -44,6 +44,7 @@
 #include "tiledb/storage_format/uri/generate_uri.h"
 
 #include <algorithm>
+#include <unordered_set>
 
 using namespace tiledb::common;
 
@@ -216,6 +217,69 @@ void ArrayDimensionLabelQueries::add_read_queries(
     const Subarray& subarray,
     const std::unordered_map<std::string, QueryBuffer>& label_buffers,
     const std::unordered_map<std::string, QueryBuffer>&) {
+  // Collect the names of all dimension labels the query touches: labels
+  // with ranges added to the subarray and labels with data buffers.
+  std::vector<std::string> label_names;
+  std::unordered_set<std::string> label_names_set;
+  for (ArraySchema::dimension_size_type dim_idx{0};
+       dim_idx < subarray.dim_num();
+       ++dim_idx) {
+    if (subarray.has_label_ranges(dim_idx)) {
+      const auto& label_name = subarray.get_label_name(dim_idx);
+      if (label_names_set.insert(label_name).second) {
+        label_names.emplace_back(label_name);
+      }
+    }
+  }
+  for (const auto& buffer_entry : label_buffers) {
+    if (label_names_set.insert(buffer_entry.first).second) {
+      label_names.emplace_back(buffer_entry.first);
+    }
+  }
+
+  // Open all dimension label arrays concurrently. Each open reads the
+  // label array's directory, schema and fragment metadata; opening the
+  // labels one at a time serializes those round trips. The map entries
+  // are created sequentially first as the map is not thread-safe.
+  for (const auto& label_name : label_names) {
+    try {
+      const auto& dim_label_ref =
+          array->array_schema_latest().dimension_label(label_name);
+      dimension_labels_.try_emplace(
+          label_name,
+          make_shared<Array>(
+              HERE(), dim_label_ref.uri(array->array_uri()), storage_manager_));
+    } catch (const StatusException& err) {
+      throw DimensionLabelQueryStatusException(
+          "Failed to initialize the query for label '" + label_name + "'. " +
+          err.what());
+    }
+  }
+  throw_if_not_ok(parallel_for(
+      storage_manager_->compute_tp(),
+      0,
+      label_names.size(),
+      [&](const size_t label_idx) {
+        const auto& label_name = label_names[label_idx];
+        try {
+          const auto dim_label = dimension_labels_[label_name];
+          throw_if_not_ok(dim_label->open(
+              QueryType::READ,
+              array->timestamp_start(),
+              array->timestamp_end(),
+              array->encryption_key()->encryption_type(),
+              array->encryption_key()->key().data(),
+              array->encryption_key()->key().size()));
+          array->array_schema_latest().check_dimension_label_schema(
+              label_name, dim_label->array_schema_latest());
+          return Status::Ok();
+        } catch (const StatusException& err) {
+          throw DimensionLabelQueryStatusException(
+              "Failed to open dimension label '" + label_name + "'. " +
+              err.what());
+        }
+      }));
+
   // Add queries for the dimension labels that have ranges added to the
   // subarray.
   for (ArraySchema::dimension_size_type dim_idx{0};
@@ -235,12 +299,8 @@ void ArrayDimensionLabelQueries::add_read_queries(
       const auto& dim_label_ref =
           array->array_schema_latest().dimension_label(label_name);
 
-      // Open the indexed array.
-      const auto dim_label = open_dimension_label(
-          array,
-          dim_label_ref.uri(array->array_uri()),
-          label_name,
-          QueryType::READ);
+      // The indexed array was opened above.
+      const auto dim_label = dimension_labels_.at(label_name);
 
       // Get subarray ranges.
       auto& label_ranges = subarray.ranges_for_label(label_name);
@@ -267,15 +327,8 @@ void ArrayDimensionLabelQueries::add_read_queries(
       const auto& dim_label_ref =
           array->array_schema_latest().dimension_label(label_name);
 
-      // Open the indexed array.
-      auto dim_label_iter = dimension_labels_.find(label_name);
-      const auto dim_label = dim_label_iter == dimension_labels_.end() ?
-                                 open_dimension_label(
-                                     array,
-                                     dim_label_ref.uri(array->array_uri()),
-                                     label_name,
-                                     QueryType::READ) :
-                                 dim_label_iter->second;
+      // The indexed array was opened above.
+      const auto dim_label = dimension_labels_.at(label_name);
 
       // Create the data query.
       data_queries_.emplace_back(tdb_new(
@@ -311,9 +311,28 @@ Status Reader::load_initial_data() {
   use_timestamps_ = partial_consol_fragment_overlap ||
                     !array_schema_.allows_dups() || user_requested_timestamps_;
 
-  // Add partial overlap condition for timestamps, if required.
+  // Add partial overlap condition for timestamps, if required. Load the
+  // timestamps tile min/max of the partially overlapping fragments so
+  // tiles fully inside the open timestamp range can skip the per-cell
+  // condition.
   if (partial_consol_fragment_overlap) {
     RETURN_NOT_OK(add_partial_overlap_condition());
+
+    const auto encryption_key = array_->encryption_key();
+    RETURN_NOT_OK(parallel_for(
+        storage_manager_->compute_tp(),
+        0,
+        fragment_metadata_.size(),
+        [&](const uint64_t f) {
+          auto& fragment = fragment_metadata_[f];
+          if (process_partial_timestamps(*fragment) &&
+              fragment->has_tile_metadata()) {
+            std::vector<std::string> names = {constants::timestamps};
+            fragment->load_tile_max_values(*encryption_key, names);
+            fragment->load_tile_min_values(*encryption_key, names);
+          }
+          return Status::Ok();
+        }));
   }
 
   // Legacy reader always uses timestamped conditions. As we process all cell
@@ -491,9 +510,12 @@ Status Reader::compute_range_result_coords(
       }
     }
 
-    // Apply partial overlap condition, if required.
+    // Apply partial overlap condition, if required. Tiles whose timestamp
+    // range lies fully inside the open range are skipped: every cell of
+    // them passes the condition.
     const auto frag_meta = fragment_metadata_[tile->frag_idx()];
-    if (process_partial_timestamps(*frag_meta)) {
+    if (process_partial_timestamps(*frag_meta) &&
+        !timestamps_within_open_range(*frag_meta, tile->tile_idx())) {
       RETURN_NOT_OK(partial_overlap_condition_.apply_sparse<uint8_t>(
           *(frag_meta->array_schema().get()), *tile, result_bitmap));
     }
@@ -1799,7 +1821,8 @@ Status Reader::get_all_result_coords(
   const bool partial_overlap = frag_meta->partial_time_overlap(
       array_->timestamp_start(), array_->timestamp_end_opened_at());
   if (fragment_metadata_[tile->frag_idx()]->has_timestamps() &&
-      partial_overlap) {
+      partial_overlap &&
+      !timestamps_within_open_range(*frag_meta, tile->tile_idx())) {
     std::vector<uint8_t> result_bitmap(coords_num, 1);
     RETURN_NOT_OK(partial_overlap_condition_.apply_sparse<uint8_t>(
         *(frag_meta->array_schema().get()), *tile, result_bitmap));
@@ -35,6 +35,8 @@
 #include "tiledb/common/heap_memory.h"
 #include "tiledb/common/logger.h"
 #include "tiledb/common/memory.h"
+#include "tiledb/common/stdx_string.h"
+#include "tiledb/common/trace_ring.h"
 #include "tiledb/sm/array/array.h"
 #include "tiledb/sm/array_schema/dimension_label.h"
 #include "tiledb/sm/enums/query_status.h"
@@ -44,6 +46,7 @@
 #include "tiledb/sm/query/deletes_and_updates/deletes_and_updates.h"
 #include "tiledb/sm/query/dimension_label/array_dimension_label_queries.h"
 #include "tiledb/sm/query/legacy/reader.h"
+#include "tiledb/sm/misc/tdb_time.h"
 #include "tiledb/sm/query/query_condition.h"
 #include "tiledb/sm/query/readers/dense_reader.h"
 #include "tiledb/sm/query/readers/ordered_dim_label_reader.h"
@@ -52,11 +55,15 @@
 #include "tiledb/sm/query/writers/global_order_writer.h"
 #include "tiledb/sm/query/writers/ordered_writer.h"
 #include "tiledb/sm/query/writers/unordered_writer.h"
+#include "tiledb/sm/query_plan/query_plan.h"
 #include "tiledb/sm/rest/rest_client.h"
 #include "tiledb/sm/storage_manager/storage_manager.h"
 #include "tiledb/sm/tile/writer_tile_tuple.h"
 
+#include "external/include/nlohmann/json.hpp"
+
 #include <cassert>
+#include <fstream>
 #include <iostream>
 #include <sstream>
 
@@ -109,6 +116,7 @@ Query::Query(
     , is_dimension_label_ordered_read_(false)
     , dimension_label_increasing_(true)
     , fragment_size_(std::numeric_limits<uint64_t>::max())
+    , profile_loop_num_(0)
     , query_remote_buffer_storage_(std::nullopt) {
   assert(array->is_open());
 
@@ -711,6 +719,16 @@ void Query::init() {
 
     throw_if_not_ok(check_buffer_names());
 
+    // Enable tracing of this query's timer stats if requested, before the
+    // strategy is created so its stats inherit the setting.
+    bool found = false, trace_enabled = false;
+    throw_if_not_ok(config_.get<bool>(
+        "sm.stats.trace_enabled", &trace_enabled, &found));
+    assert(found);
+    if (trace_enabled) {
+      stats_->set_trace_enabled(true);
+    }
+
     // Create dimension label queries and remove labels from subarray.
     if (uses_dimension_labels()) {
       if (condition_.has_value()) {
@@ -750,9 +768,15 @@ void Query::init() {
     }
 
     // Create the query strategy if querying main array and the Subarray does
-    // not need to be updated.
+    // not need to be updated. A query that was reset for resubmission may
+    // still have its strategy; reset it for the new subarray instead of
+    // recreating it.
     if (!only_dim_label_query() && !subarray_.has_label_ranges()) {
-      throw_if_not_ok(create_strategy());
+      if (strategy_ == nullptr) {
+        throw_if_not_ok(create_strategy());
+      } else {
+        strategy_->reset();
+      }
     }
   }
 
@@ -873,6 +897,7 @@ Status Query::process() {
   Status st{Status::Ok()};
   if (!only_dim_label_query()) {
     st = strategy_->dowork();
+    profile_loop_num_++;
   }
 
   // Process dimension label queries
@@ -880,6 +905,16 @@ Status Query::process() {
     dim_label_queries_->process_data_queries();
   }
 
+  // Wait for any checksum validations deferred while processing, so that
+  // integrity errors surface before results are returned to the user.
+  auto reader = dynamic_cast<ReaderBase*>(strategy_.get());
+  if (reader != nullptr) {
+    auto checksum_st = reader->wait_deferred_checksums();
+    if (st.ok()) {
+      st = checksum_st;
+    }
+  }
+
   // Handle error
   if (!st.ok()) {
     status_ = QueryStatus::FAILED;
@@ -897,6 +932,7 @@ Status Query::process() {
 
     copy_aggregates_data_to_user_buffer();
     status_ = QueryStatus::COMPLETED;
+    record_query_profile();
   } else {
     // Either the main query or the dimension lable query are incomplete.
     status_ = QueryStatus::INCOMPLETE;
@@ -1360,6 +1396,11 @@ Status Query::set_validity_buffer(
   return Status::Ok();
 }
 
+void Query::set_imported_buffer_handle(
+    const std::string& name, shared_ptr<void> handle) {
+  imported_buffer_handles_[name] = std::move(handle);
+}
+
 Status Query::set_est_result_size(
     std::unordered_map<std::string, Subarray::ResultSize>& est_result_size,
     std::unordered_map<std::string, Subarray::MemorySize>& max_mem_size) {
@@ -1501,17 +1542,45 @@ void Query::set_subarray(const void* subarray) {
           query_type_str(type_) + "'.");
   }
 
-  // Check this isn't an already initialized query using dimension labels.
+  // Check the query has not been initialized, with one exception: a
+  // completed read query may be given a new subarray and resubmitted,
+  // reusing the state it has already allocated.
   if (status_ != QueryStatus::UNINITIALIZED) {
-    throw QueryStatusException(
-        "[set_subarray] Setting a subarray on an already initialized  "
-        "query is not supported.");
+    if (!can_reset_for_resubmission()) {
+      throw QueryStatusException(
+          "[set_subarray] Setting a subarray on an already initialized  "
+          "query is not supported.");
+    }
+    reset_for_resubmission();
   }
 
   // Set the subarray.
   throw_if_not_ok(subarray_.set_subarray(subarray));
 }
 
+bool Query::can_reset_for_resubmission() const {
+  return type_ == QueryType::READ && status_ == QueryStatus::COMPLETED &&
+         !array_->is_remote() && !uses_dimension_labels() &&
+         default_channel_aggregates_.empty();
+}
+
+void Query::reset_for_resubmission() {
+  // Only the dense reader can refresh its read state in place; other
+  // strategies are torn down and recreated on the next submission.
+  if (strategy_ != nullptr &&
+      dynamic_cast<DenseReader*>(strategy_.get()) == nullptr) {
+    dynamic_cast<StrategyBase*>(strategy_.get())->stats()->reset();
+    strategy_ = nullptr;
+  }
+
+  // Start from a fresh subarray so that no state computed for the
+  // previous one (tile overlap, relevant fragments) is carried over. The
+  // assignment keeps the object the strategy references valid.
+  subarray_ = Subarray(array_, layout_, stats_, logger_);
+
+  status_ = QueryStatus::UNINITIALIZED;
+}
+
 const Subarray* Query::subarray() const {
   return &subarray_;
 }
@@ -1543,11 +1612,16 @@ void Query::set_subarray(const tiledb::sm::Subarray& subarray) {
           query_type_str(type_) + "'.");
   }
 
-  // Check the query has not been initialized.
+  // Check the query has not been initialized, with one exception: a
+  // completed read query may be given a new subarray and resubmitted,
+  // reusing the state it has already allocated.
   if (status_ != tiledb::sm::QueryStatus::UNINITIALIZED) {
-    throw QueryStatusException(
-        "[set_subarray] Setting a subarray on an already initialized "
-        "query is not supported.");
+    if (!can_reset_for_resubmission()) {
+      throw QueryStatusException(
+          "[set_subarray] Setting a subarray on an already initialized "
+          "query is not supported.");
+    }
+    reset_for_resubmission();
   }
 
   // Set the subarray.
@@ -1575,6 +1649,219 @@ void Query::set_subarray_unsafe(const void* subarray) {
   subarray_.set_subarray_unsafe(subarray);
 }
 
+/**
+ * Appends a byte fingerprint of a query condition AST node to `key`,
+ * for use in the query result cache key.
+ */
+static void condition_ast_cache_key(const ASTNode* node, std::string* key) {
+  if (node->is_expr()) {
+    key->push_back('E');
+    key->push_back(
+        static_cast<char>(static_cast<uint8_t>(node->get_combination_op())));
+    for (const auto& child : node->get_children()) {
+      condition_ast_cache_key(child.get(), key);
+    }
+    key->push_back(')');
+  } else {
+    key->push_back('V');
+    key->append(node->get_field_name());
+    key->push_back('\0');
+    key->push_back(static_cast<char>(static_cast<uint8_t>(node->get_op())));
+    key->push_back(node->use_enumeration() ? 1 : 0);
+    const auto& data = node->get_data();
+    uint64_t size = data.size();
+    key->append(reinterpret_cast<const char*>(&size), sizeof(size));
+    key->append(reinterpret_cast<const char*>(data.data()), data.size());
+    const auto& offsets = node->get_offsets();
+    size = offsets.size();
+    key->append(reinterpret_cast<const char*>(&size), sizeof(size));
+    key->append(reinterpret_cast<const char*>(offsets.data()), offsets.size());
+  }
+}
+
+std::optional<std::string> Query::result_cache_key() const {
+  if (type_ != QueryType::READ || status_ != QueryStatus::UNINITIALIZED ||
+      array_->is_remote()) {
+    return nullopt;
+  }
+
+  // Dimension label queries and aggregates are not cached.
+  if (only_dim_label_query() || !label_buffers_.empty() ||
+      subarray_.has_label_ranges() || !aggregate_buffer_names().empty()) {
+    return nullopt;
+  }
+
+  std::string key;
+  auto append_bytes = [&key](const void* data, uint64_t size) {
+    if (size != 0) {
+      key.append(reinterpret_cast<const char*>(data), size);
+    }
+  };
+  auto append_uint64 = [&](uint64_t v) { append_bytes(&v, sizeof(v)); };
+
+  // The array snapshot: URI, open timestamps and the fragment listing of
+  // the directory snapshot. Any write, consolidation or vacuum changes
+  // the listing of subsequent opens, invalidating cached results.
+  key += array_->array_uri().to_string();
+  key += '\0';
+  append_uint64(array_->timestamp_start());
+  append_uint64(array_->timestamp_end_opened_at());
+  for (const auto& uri : array_->array_directory().unfiltered_fragment_uris()) {
+    key += uri.to_string();
+    key += '\0';
+  }
+
+  // The layout and subarray ranges.
+  key.push_back(static_cast<char>(static_cast<uint8_t>(layout_)));
+  const auto dim_num = array_schema_->dim_num();
+  for (unsigned d = 0; d < dim_num; d++) {
+    const auto& ranges = subarray_.ranges_for_dim(d);
+    append_uint64(ranges.size());
+    for (const auto& r : ranges) {
+      append_uint64(r.size());
+      append_uint64(r.start_size());
+      append_bytes(r.data(), r.size());
+    }
+  }
+
+  // The query condition.
+  if (condition_.has_value()) {
+    condition_ast_cache_key(condition_->ast().get(), &key);
+  }
+
+  // The var offsets configuration changes the emitted offsets buffers.
+  bool found = false;
+  key += config_.get("sm.var_offsets.mode", &found);
+  key += config_.get("sm.var_offsets.bitsize", &found);
+  key += config_.get("sm.var_offsets.extra_element", &found);
+  key += '\0';
+
+  // The queried field list, sorted so that the key does not depend on
+  // the buffer map iteration order.
+  std::vector<std::string> names;
+  names.reserve(buffers_.size());
+  for (const auto& b : buffers_) {
+    names.emplace_back(b.first);
+  }
+  std::sort(names.begin(), names.end());
+  for (const auto& name : names) {
+    key += name;
+    key += '\0';
+  }
+
+  return key;
+}
+
+bool Query::result_cache_lookup() {
+  auto& cache = storage_manager_->resources().query_result_cache();
+  if (!cache.enabled()) {
+    return false;
+  }
+
+  auto key = result_cache_key();
+  if (!key.has_value()) {
+    return false;
+  }
+
+  // Remember the fingerprint so that `result_cache_insert` can cache the
+  // result after the query executes.
+  result_cache_key_ = key;
+
+  shared_ptr<QueryResultEntry> entry;
+  if (!cache.lookup(*key, &entry)) {
+    stats_->add_counter("result_cache_miss_num", 1);
+    return false;
+  }
+
+  // Validate that the buffer shapes match and the user buffers can hold
+  // the cached result, otherwise fall through to normal execution.
+  for (const auto& field : entry->fields_) {
+    auto it = buffers_.find(field.name_);
+    if (it == buffers_.end()) {
+      return false;
+    }
+    const auto& qb = it->second;
+    if (qb.buffer_ == nullptr || qb.buffer_size_ == nullptr ||
+        field.has_var_ != (qb.buffer_var_ != nullptr) ||
+        field.has_validity_ != (qb.validity_vector_.buffer() != nullptr)) {
+      return false;
+    }
+    if (field.fixed_.size() > qb.original_buffer_size_ ||
+        field.var_.size() > qb.original_buffer_var_size_ ||
+        field.validity_.size() > qb.original_validity_vector_size_) {
+      stats_->add_counter("result_cache_miss_num", 1);
+      return false;
+    }
+  }
+
+  // Copy the cached buffers into the user buffers.
+  for (const auto& field : entry->fields_) {
+    auto& qb = buffers_[field.name_];
+    std::memcpy(qb.buffer_, field.fixed_.data(), field.fixed_.size());
+    *qb.buffer_size_ = field.fixed_.size();
+    if (field.has_var_) {
+      std::memcpy(qb.buffer_var_, field.var_.data(), field.var_.size());
+      *qb.buffer_var_size_ = field.var_.size();
+    }
+    if (field.has_validity_) {
+      std::memcpy(
+          qb.validity_vector_.buffer(),
+          field.validity_.data(),
+          field.validity_.size());
+      *qb.validity_vector_.buffer_size() = field.validity_.size();
+    }
+  }
+
+  status_ = QueryStatus::COMPLETED;
+  result_cache_key_.reset();
+  stats_->add_counter("result_cache_hit_num", 1);
+  return true;
+}
+
+void Query::result_cache_insert() {
+  if (!result_cache_key_.has_value()) {
+    return;
+  }
+
+  // Only results that completed in a single submission are cached; an
+  // incomplete first submission hands back partial buffers.
+  if (status_ != QueryStatus::COMPLETED) {
+    result_cache_key_.reset();
+    return;
+  }
+
+  auto entry = make_shared<QueryResultEntry>(HERE());
+  entry->fields_.reserve(buffers_.size());
+  for (const auto& b : buffers_) {
+    const auto& qb = b.second;
+    if (qb.buffer_ == nullptr || qb.buffer_size_ == nullptr) {
+      result_cache_key_.reset();
+      return;
+    }
+
+    QueryResultCacheField field;
+    field.name_ = b.first;
+    auto fixed = static_cast<const uint8_t*>(qb.buffer_);
+    field.fixed_.assign(fixed, fixed + *qb.buffer_size_);
+    if (qb.buffer_var_ != nullptr) {
+      field.has_var_ = true;
+      auto var = static_cast<const uint8_t*>(qb.buffer_var_);
+      field.var_.assign(var, var + *qb.buffer_var_size_);
+    }
+    if (qb.validity_vector_.buffer() != nullptr) {
+      field.has_validity_ = true;
+      auto validity = qb.validity_vector_.buffer();
+      field.validity_.assign(
+          validity, validity + *qb.validity_vector_.buffer_size());
+    }
+    entry->fields_.emplace_back(std::move(field));
+  }
+
+  storage_manager_->resources().query_result_cache().insert_entry(
+      *result_cache_key_, std::move(entry));
+  result_cache_key_.reset();
+}
+
 Status Query::submit() {
   // Do not resubmit completed reads.
   if (type_ == QueryType::READ && status_ == QueryStatus::COMPLETED) {
@@ -1591,6 +1878,8 @@ Status Query::submit() {
   // Check attribute/dimensions buffers completeness before query submits
   RETURN_NOT_OK(check_buffers_correctness());
 
+  const uint64_t start_ms = utils::time::timestamp_now_ms();
+
   if (array_->is_remote()) {
     auto rest_client = storage_manager_->rest_client();
     if (rest_client == nullptr)
@@ -1614,10 +1903,21 @@ Status Query::submit() {
     reset_coords_markers();
     return Status::Ok();
   }
+  // Serve byte-identical repeat read queries from the query result cache.
+  if (result_cache_lookup()) {
+    return Status::Ok();
+  }
+
   init();
   RETURN_NOT_OK(storage_manager_->query_submit(this));
 
+  if (type_ == QueryType::READ) {
+    RETURN_NOT_OK(pack_validity_buffers());
+    result_cache_insert();
+  }
+
   reset_coords_markers();
+  log_if_slow(start_ms);
   return Status::Ok();
 }
 
@@ -1658,6 +1958,10 @@ const Config& Query::config() const {
   return config_;
 }
 
+StorageManager* Query::storage_manager() const {
+  return storage_manager_;
+}
+
 stats::Stats* Query::stats() const {
   return stats_;
 }
@@ -1862,6 +2166,10 @@ Status Query::create_strategy(bool skip_checks_serialization) {
       all_dense &= frag_md->dense();
     }
 
+    // Scale the memory budget up front if recorded history for this
+    // array and subarray shape shows the reader looping to fit it.
+    presize_memory_budget();
+
     if (is_dimension_label_ordered_read_) {
       strategy_ = tdb_unique_ptr<IQueryStrategy>(tdb_new(
           OrderedDimLabelReader,
@@ -2213,5 +2521,191 @@ void Query::copy_aggregates_data_to_user_buffer() {
   }
 }
 
+Status Query::pack_validity_buffers() {
+  bool found = false;
+  const std::string& mode = config_.get("sm.validity.mode", &found);
+  assert(found);
+  if (mode != "bitmap") {
+    return Status::Ok();
+  }
+
+  for (auto& it : buffers_) {
+    auto& vv = it.second.validity_vector_;
+    if (vv.buffer() == nullptr || vv.buffer_size() == nullptr) {
+      continue;
+    }
+
+    // Pack in place, LSB first. The destination byte for cell `c` is
+    // `c >> 3`, which never exceeds `c`, so reading each bytemap value
+    // before overwriting the corresponding bitmap byte is safe.
+    auto bytemap = vv.buffer();
+    const uint64_t cell_num = *vv.buffer_size();
+    for (uint64_t c = 0; c < cell_num; c++) {
+      const uint8_t valid = (bytemap[c] != 0) ? 1 : 0;
+      if ((c & 0x7) == 0) {
+        bytemap[c >> 3] = valid;
+      } else {
+        bytemap[c >> 3] |= static_cast<uint8_t>(valid << (c & 0x7));
+      }
+    }
+    *vv.buffer_size() = (cell_num + 7) / 8;
+  }
+
+  return Status::Ok();
+}
+
+void Query::log_if_slow(uint64_t start_ms) {
+  bool found = false;
+  uint64_t threshold_ms = 0;
+  throw_if_not_ok(config_.get<uint64_t>(
+      "sm.query.slow_log.threshold_ms", &threshold_ms, &found));
+  assert(found);
+  if (threshold_ms == 0) {
+    return;
+  }
+
+  const uint64_t duration_ms = utils::time::timestamp_now_ms() - start_ms;
+  if (duration_ms < threshold_ms) {
+    return;
+  }
+
+  // Capture the plan, a subarray summary, the fragment count and the
+  // per-phase stats in one report, so that a production slow query can be
+  // analyzed without reproducing it.
+  nlohmann::json report;
+  report["Query.Type"] = query_type_str(type_);
+  report["Query.Status"] = query_status_str(status_);
+  report["Duration.Milliseconds"] = duration_ms;
+  report["Threshold.Milliseconds"] = threshold_ms;
+  report["Array.URI"] = array_->array_uri().to_string();
+  report["Array.FragmentNum"] = array_->fragment_metadata().size();
+  report["Subarray.IsSet"] = subarray_.is_set();
+  report["Subarray.RangeNum"] = subarray_.range_num();
+
+  try {
+    report["QueryPlan"] =
+        nlohmann::json::parse(QueryPlan(*this).dump_json());
+  } catch (...) {
+    // The plan is not supported for all queries (e.g. remote arrays);
+    // the rest of the report is still worth emitting.
+    report["QueryPlan"] = nullptr;
+  }
+
+  const std::string stats_dump = stats_->dump(0, 0);
+  report["Stats"] = stats_dump.empty() ?
+                        nlohmann::json() :
+                        nlohmann::json::parse(stats_dump);
+
+  // Include the most recent trace ring entries when hot-path tracing is
+  // enabled; they cover the I/O and unfiltering activity leading up to the
+  // slow submit.
+  auto& trace_ring = common::TraceRing::instance();
+  if (trace_ring.enabled()) {
+    report["TraceRing"] = trace_ring.dump(1024);
+  }
+
+  const std::string& log_file = config_.get("sm.query.slow_log.file", &found);
+  assert(found);
+  if (log_file.empty()) {
+    logger_->warn("Slow query detected: " + report.dump());
+  } else {
+    std::ofstream sink(log_file, std::ios::app);
+    if (!sink) {
+      logger_->warn(
+          "Cannot append slow query report to file '" + log_file +
+          "'; " + report.dump());
+    } else {
+      sink << report.dump() << "\n";
+    }
+  }
+}
+
+std::string Query::query_profile_key() const {
+  // Bucket the range count logarithmically so that reads of similar
+  // selectivity share a profile without creating one profile per query.
+  std::string shape_class;
+  if (!subarray_.is_set()) {
+    shape_class = "full";
+  } else {
+    uint64_t range_num = subarray_.range_num();
+    unsigned bucket = 0;
+    while (range_num > 1) {
+      range_num >>= 1;
+      bucket++;
+    }
+    shape_class = "r" + std::to_string(bucket);
+  }
+
+  return array_->array_uri().to_string() + "/" + layout_str(layout_) + "/" +
+         shape_class;
+}
+
+void Query::presize_memory_budget() {
+  auto& registry = storage_manager_->resources().query_profile_registry();
+  if (!registry.enabled() || remote_query_) {
+    return;
+  }
+
+  // Respect a budget the user set explicitly.
+  if (config_.set_params().count("sm.mem.total_budget") != 0) {
+    return;
+  }
+
+  auto profile = registry.lookup(query_profile_key());
+  if (!profile.has_value() || profile->num_queries_ == 0) {
+    return;
+  }
+
+  // One internal loop per query means the budget already fits the
+  // workload in a single pass.
+  const uint64_t avg_loops =
+      profile->total_internal_loop_num_ / profile->num_queries_;
+  if (avg_loops <= 1) {
+    return;
+  }
+
+  // Scale the budget by the observed loop count, capped so a
+  // pathological history cannot grow the budget without bound. The
+  // scaled value is set on this query's own config copy only.
+  const uint64_t scale = std::min<uint64_t>(avg_loops, 4);
+  const uint64_t budget =
+      config_.get<uint64_t>("sm.mem.total_budget", Config::must_find);
+  throw_if_not_ok(
+      config_.set("sm.mem.total_budget", std::to_string(budget * scale)));
+}
+
+void Query::record_query_profile() {
+  auto& registry = storage_manager_->resources().query_profile_registry();
+  if (!registry.enabled() || type_ != QueryType::READ || remote_query_ ||
+      strategy_ == nullptr || only_dim_label_query()) {
+    return;
+  }
+
+  // The loop counts and phase timings are read back from the stats the
+  // readers already maintain; names are matched by suffix as the stats
+  // carry the full parent prefix.
+  auto stats = dynamic_cast<StrategyBase*>(strategy_.get())->stats();
+  uint64_t internal_loop_num = 0;
+  for (const auto& counter : *stats->counters()) {
+    if (stdx::string::ends_with(counter.first, ".internal_loop_num")) {
+      internal_loop_num += counter.second;
+    }
+  }
+
+  double dowork_secs = 0.0;
+  for (const auto& timer : *stats->timers()) {
+    if (stdx::string::ends_with(timer.first, ".dowork.sum")) {
+      dowork_secs += timer.second;
+    }
+  }
+
+  registry.record(
+      query_profile_key(),
+      strategy_->name(),
+      profile_loop_num_,
+      internal_loop_num,
+      dowork_secs);
+}
+
 }  // namespace sm
 }  // namespace tiledb
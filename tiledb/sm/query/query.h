@@ -540,6 +540,23 @@ class Query {
    */
   const Config& config() const;
 
+  /** Returns the storage manager. */
+  StorageManager* storage_manager() const;
+
+  /**
+   * Stores an opaque handle that must remain alive for as long as the
+   * query uses the buffers set for `name`. Used by the Arrow C Data
+   * Interface import in the C API to transfer ownership of externally
+   * produced buffers to the query; the handle's deleter invokes the
+   * producer's release callback. A handle previously stored for the same
+   * field is released.
+   *
+   * @param name The field the handle's buffers are set for.
+   * @param handle The opaque handle.
+   */
+  void set_imported_buffer_handle(
+      const std::string& name, shared_ptr<void> handle);
+
   /**
    * Used by serialization to set the estimated result size
    *
@@ -837,6 +854,13 @@ class Query {
   /** Maps label names to their buffers. */
   std::unordered_map<std::string, QueryBuffer> label_buffers_;
 
+  /**
+   * Opaque handles keeping externally owned buffers (e.g. imported
+   * through the Arrow C Data Interface) alive for the lifetime of the
+   * query. See `set_imported_buffer_handle`.
+   */
+  std::unordered_map<std::string, shared_ptr<void>> imported_buffer_handles_;
+
   /**
    * Maps aggregate names to their buffers.
    */
@@ -866,6 +890,13 @@ class Query {
   /** The current serialization state. */
   SerializationState serialization_state_;
 
+  /**
+   * The fingerprint of this query in the context's query result cache,
+   * computed on the first submission and consumed when the result is
+   * inserted into the cache. `nullopt` when the query is not cacheable.
+   */
+  std::optional<std::string> result_cache_key_;
+
   /** If the query has coords buffer set or not. */
   bool has_coords_buffer_;
 
@@ -942,6 +973,13 @@ class Query {
    */
   uint64_t fragment_size_;
 
+  /**
+   * Number of submits this query has processed. Folded into the query
+   * profile registry on completion when `sm.query.profile_guided.enable`
+   * is set.
+   */
+  uint64_t profile_loop_num_;
+
   /** Already written buffers. */
   std::unordered_set<std::string> written_buffers_;
 
@@ -963,6 +1001,22 @@ class Query {
    */
   Status create_strategy(bool skip_checks_serialization = false);
 
+  /**
+   * Returns `true` if the query can be reset and resubmitted with a new
+   * subarray, keeping the state it has already allocated. Only local,
+   * completed read queries that use neither dimension labels nor
+   * aggregates qualify.
+   */
+  bool can_reset_for_resubmission() const;
+
+  /**
+   * Resets a completed read query so that a new subarray can be set and
+   * the query resubmitted. The dense reader strategy is kept and only
+   * reinitializes its read state on the next submission; other
+   * strategies are recreated.
+   */
+  void reset_for_resubmission();
+
   Status check_set_fixed_buffer(const std::string& name);
 
   /** Checks if the buffers names have been appropriately set for the query. */
@@ -993,6 +1047,35 @@ class Query {
    */
   Status check_tile_alignment() const;
 
+  /**
+   * Computes the fingerprint of this query for the context's query result
+   * cache: the array URI and open timestamps, the fragment listing of the
+   * `ArrayDirectory` snapshot the array was opened with, the layout, the
+   * subarray ranges, the query condition AST, the var offsets
+   * configuration and the queried field list.
+   *
+   * @return The fingerprint, or `nullopt` when the query is not cacheable:
+   *     not the first submission of a local read query, or it queries
+   *     dimension labels or aggregates.
+   */
+  std::optional<std::string> result_cache_key() const;
+
+  /**
+   * Serves the query from the context's query result cache if an entry
+   * with this query's fingerprint exists and the user buffers can hold
+   * it, copying the cached buffers out and completing the query.
+   *
+   * @return `true` if the query was served from the cache.
+   */
+  bool result_cache_lookup();
+
+  /**
+   * Inserts the emitted buffers of this query into the context's query
+   * result cache, if the query was fingerprinted by `result_cache_lookup`
+   * and completed in a single submission.
+   */
+  void result_cache_insert();
+
   /**
    * Reset coord buffer markers at end of a global write submit.
    * This will allow for the user to properly set the next write batch.
@@ -1001,6 +1084,49 @@ class Query {
 
   /** Copies the data from the aggregates to the user buffers. */
   void copy_aggregates_data_to_user_buffer();
+
+  /**
+   * Packs the validity bytemaps of a completed read in place into Arrow-style
+   * bitmaps (LSB first) and adjusts the validity buffer sizes accordingly.
+   * Applies only when `sm.validity.mode` is set to `bitmap`.
+   */
+  Status pack_validity_buffers();
+
+  /**
+   * Logs a slow query report if this submit took longer than the
+   * `sm.query.slow_log.threshold_ms` config option. The report captures
+   * the query plan, a subarray summary, the fragment count and the
+   * per-phase stats of the query, and is appended to the
+   * `sm.query.slow_log.file` file, or written to the log when no file is
+   * configured.
+   *
+   * @param start_ms The `timestamp_now_ms` taken when the submit started.
+   */
+  void log_if_slow(uint64_t start_ms);
+
+  /**
+   * Returns the key this query records and looks up execution profiles
+   * under: the array URI plus a coarse subarray shape class (whole-domain
+   * reads versus a logarithmic bucket of the range count).
+   */
+  std::string query_profile_key() const;
+
+  /**
+   * Consults the query profile registry before a read strategy is
+   * constructed and, when the recorded history for this query's profile
+   * key shows the strategy repeatedly looping internally to fit its
+   * memory budget, scales `sm.mem.total_budget` up in this query's
+   * config. A budget the user set explicitly is never overridden. No-op
+   * unless `sm.query.profile_guided.enable` is set.
+   */
+  void presize_memory_budget();
+
+  /**
+   * Folds a completed read query's loop counts and `dowork` time into
+   * the query profile registry. No-op unless
+   * `sm.query.profile_guided.enable` is set.
+   */
+  void record_query_profile();
 };
 
 }  // namespace sm
@@ -38,6 +38,7 @@
 #include "tiledb/sm/fragment/fragment_metadata.h"
 #include "tiledb/sm/misc/utils.h"
 #include "tiledb/sm/query/readers/result_cell_slab.h"
+#include "tiledb/sm/tile/tile_metadata_generator.h"
 #include "tiledb/storage_format/uri/parse_uri.h"
 
 #include <algorithm>
@@ -565,10 +566,9 @@ struct QueryCondition::BinaryCmpNullChecks<T, QueryConditionOp::IN> {
     }
 
     std::string_view sv(static_cast<const char*>(lhs), lhs_size);
-    auto members =
-        static_cast<const std::unordered_set<std::string_view>*>(rhs);
+    auto members = static_cast<const ASTMemberSet*>(rhs);
 
-    return members->find(sv) != members->end();
+    return members->contains(sv);
   }
 };
 
@@ -582,10 +582,9 @@ struct QueryCondition::BinaryCmpNullChecks<T, QueryConditionOp::NOT_IN> {
     }
 
     std::string_view sv(static_cast<const char*>(lhs), lhs_size);
-    auto members =
-        static_cast<const std::unordered_set<std::string_view>*>(rhs);
+    auto members = static_cast<const ASTMemberSet*>(rhs);
 
-    return members->find(sv) == members->end();
+    return !members->contains(sv);
   }
 };
 
@@ -1106,6 +1105,100 @@ void QueryCondition::apply_ast_node(
   return;
 }
 
+/**
+ * Heuristic evaluation cost for an AST subtree, in bytes of attribute data
+ * touched per cell. Var-sized fields dominate fixed ones and set membership
+ * adds a lookup per cell.
+ */
+static uint64_t ast_node_cost(
+    const ASTNode* node, const ArraySchema& array_schema) {
+  if (node->is_expr()) {
+    uint64_t cost = 0;
+    for (const auto& child : node->get_children()) {
+      cost += ast_node_cost(child.get(), array_schema);
+    }
+    return cost;
+  }
+
+  const auto& field_name = node->get_field_name();
+  uint64_t cost = array_schema.var_size(field_name) ?
+                      64 :
+                      datatype_size(array_schema.type(field_name));
+  const auto op = node->get_op();
+  if (op == QueryConditionOp::IN || op == QueryConditionOp::NOT_IN) {
+    cost *= 4;
+  }
+
+  return cost;
+}
+
+/** Heuristic selectivity rank for an AST node; lower ranks filter more. */
+static unsigned ast_node_selectivity_rank(const ASTNode* node) {
+  if (node->is_expr()) {
+    return 2;
+  }
+
+  switch (node->get_op()) {
+    case QueryConditionOp::EQ:
+      return 0;
+    case QueryConditionOp::IN:
+      return 1;
+    case QueryConditionOp::NE:
+    case QueryConditionOp::NOT_IN:
+      return 3;
+    default:
+      return 2;
+  }
+}
+
+/**
+ * Returns the children of an AND node ordered so the cheapest, most
+ * selective clauses run first. The later, costlier clauses then combine
+ * into an already thinned bitmap, or are skipped entirely when it empties.
+ */
+static std::vector<const tdb_unique_ptr<ASTNode>*> ordered_and_children(
+    const ASTNode* node, const ArraySchema& array_schema) {
+  struct RankedChild {
+    const tdb_unique_ptr<ASTNode>* child_;
+    uint64_t cost_;
+    unsigned selectivity_rank_;
+  };
+
+  const auto& children = node->get_children();
+  std::vector<RankedChild> ranked;
+  ranked.reserve(children.size());
+  for (const auto& child : children) {
+    ranked.emplace_back(RankedChild{
+        &child,
+        ast_node_cost(child.get(), array_schema),
+        ast_node_selectivity_rank(child.get())});
+  }
+
+  std::stable_sort(
+      ranked.begin(), ranked.end(), [](const auto& a, const auto& b) {
+        if (a.cost_ != b.cost_) {
+          return a.cost_ < b.cost_;
+        }
+        return a.selectivity_rank_ < b.selectivity_rank_;
+      });
+
+  std::vector<const tdb_unique_ptr<ASTNode>*> ordered;
+  ordered.reserve(ranked.size());
+  for (const auto& elem : ranked) {
+    ordered.emplace_back(elem.child_);
+  }
+
+  return ordered;
+}
+
+/** Returns `true` if no cell is left set in the combined bitmap. */
+template <class BitmapContainer>
+static bool bitmap_empty(const BitmapContainer& bitmap) {
+  return std::all_of(bitmap.begin(), bitmap.end(), [](auto v) {
+    return v == 0;
+  });
+}
+
 template <typename CombinationOp>
 void QueryCondition::apply_tree(
     const tdb_unique_ptr<ASTNode>& node,
@@ -1144,17 +1237,23 @@ void QueryCondition::apply_tree(
          * cl1(q; a) /\ cl2(q; a) = cl1(q; cl2(q; a))
          */
       case QueryConditionCombinationOp::AND: {
+        // Run the cheapest, most selective clauses first and skip the
+        // remaining clauses once the combined bitmap empties.
+        const auto children = ordered_and_children(node.get(), array_schema);
         if constexpr (std::
                           is_same_v<CombinationOp, std::logical_and<uint8_t>>) {
-          for (const auto& child : node->get_children()) {
+          for (const auto* child : children) {
             apply_tree(
-                child,
+                *child,
                 array_schema,
                 fragment_metadata,
                 stride,
                 result_cell_slabs,
                 std::logical_and<uint8_t>(),
                 result_cell_bitmap);
+            if (bitmap_empty(result_cell_bitmap)) {
+              break;
+            }
           }
 
           // Handle the cl'(q, a) case
@@ -1163,15 +1262,18 @@ void QueryCondition::apply_tree(
                                  std::logical_or<uint8_t>>) {
           std::vector<uint8_t> combination_op_bitmap(result_bitmap_size, 1);
 
-          for (const auto& child : node->get_children()) {
+          for (const auto* child : children) {
             apply_tree(
-                child,
+                *child,
                 array_schema,
                 fragment_metadata,
                 stride,
                 result_cell_slabs,
                 std::logical_and<uint8_t>(),
                 combination_op_bitmap);
+            if (bitmap_empty(combination_op_bitmap)) {
+              break;
+            }
           }
           for (size_t c = 0; c < result_bitmap_size; ++c) {
             result_cell_bitmap[c] |= combination_op_bitmap[c];
@@ -1264,6 +1366,31 @@ Status QueryCondition::apply(
   return Status::Ok();
 }
 
+/**
+ * Typed cell comparison used by the fixed-size fast paths below. Comparing
+ * typed values instead of void pointers with runtime sizes keeps the cell
+ * loops free of loads the compiler cannot reason about, so they unroll and
+ * vectorize (AVX2/NEON) at the default optimization level.
+ */
+template <typename T, QueryConditionOp Op>
+inline bool cell_cmp(const T lhs, const T rhs) {
+  if constexpr (Op == QueryConditionOp::LT) {
+    return lhs < rhs;
+  } else if constexpr (Op == QueryConditionOp::LE) {
+    return lhs <= rhs;
+  } else if constexpr (Op == QueryConditionOp::GT) {
+    return lhs > rhs;
+  } else if constexpr (Op == QueryConditionOp::GE) {
+    return lhs >= rhs;
+  } else if constexpr (Op == QueryConditionOp::EQ) {
+    return lhs == rhs;
+  } else {
+    static_assert(
+        Op == QueryConditionOp::NE, "Unsupported op for typed comparison");
+    return lhs != rhs;
+  }
+}
+
 /** Default dense dimension condition processing. */
 template <
     typename T,
@@ -1405,6 +1532,29 @@ void QueryCondition::apply_ast_node_dense(
       uint64_t buffer_offset = ((start * stride) + src_cell) * cell_size;
       const uint64_t buffer_offset_inc = stride * cell_size;
 
+      // Fast path for contiguous fixed-size arithmetic cells: compare typed
+      // values in a tight loop that vectorizes and emits the result buffer
+      // directly.
+      if constexpr (
+          std::is_arithmetic_v<T> && Op != QueryConditionOp::IN &&
+          Op != QueryConditionOp::NOT_IN) {
+        if (stride == 1 && cell_size == sizeof(T)) {
+          const T* cells =
+              static_cast<const T*>(static_cast<const void*>(buffer)) + start +
+              src_cell;
+          const T condition_value =
+              *static_cast<const T*>(condition_value_content);
+          for (uint64_t c = 0; c < result_buffer.size(); ++c) {
+            const bool cmp = cell_cmp<T, Op>(cells[c], condition_value);
+            const bool buffer_validity_val =
+                buffer_validity == nullptr || buffer_validity[start + c] != 0;
+            result_buffer[c] = combination_op(
+                result_buffer[c], (uint8_t)(cmp && buffer_validity_val));
+          }
+          return;
+        }
+      }
+
       // Iterate through each cell in this slab.
       for (uint64_t c = 0; c < result_buffer.size(); ++c) {
         // Get the cell value.
@@ -1902,11 +2052,14 @@ void QueryCondition::apply_tree_dense(
          * cl1(q; a) /\ cl2(q; a) = cl1(q; cl2(q; a))
          */
       case QueryConditionCombinationOp::AND: {
+        // Run the cheapest, most selective clauses first and skip the
+        // remaining clauses once the combined bitmap empties.
+        const auto children = ordered_and_children(node.get(), array_schema);
         if constexpr (std::
                           is_same_v<CombinationOp, std::logical_and<uint8_t>>) {
-          for (const auto& child : node->get_children()) {
+          for (const auto* child : children) {
             apply_tree_dense(
-                child,
+                *child,
                 array_schema,
                 result_tile,
                 start,
@@ -1915,6 +2068,9 @@ void QueryCondition::apply_tree_dense(
                 std::logical_and<uint8_t>(),
                 cell_slab_coords,
                 result_buffer);
+            if (bitmap_empty(result_buffer)) {
+              break;
+            }
           }
 
           // Handle the cl'(q, a) case
@@ -1925,9 +2081,9 @@ void QueryCondition::apply_tree_dense(
           span<uint8_t> combination_op_span(
               combination_op_bitmap.data(), result_buffer_size);
 
-          for (const auto& child : node->get_children()) {
+          for (const auto* child : children) {
             apply_tree_dense(
-                child,
+                *child,
                 array_schema,
                 result_tile,
                 start,
@@ -1936,6 +2092,9 @@ void QueryCondition::apply_tree_dense(
                 std::logical_and<uint8_t>(),
                 cell_slab_coords,
                 combination_op_span);
+            if (bitmap_empty(combination_op_bitmap)) {
+              break;
+            }
           }
           for (size_t c = 0; c < result_buffer_size; ++c) {
             result_buffer[c] |= combination_op_bitmap[c];
@@ -2262,9 +2421,8 @@ struct QueryCondition::BinaryCmp<T, QueryConditionOp::IN> {
   static inline bool cmp(
       const void* lhs, uint64_t lhs_size, const void* rhs, uint64_t) {
     std::string_view sv(static_cast<const char*>(lhs), lhs_size);
-    auto members =
-        static_cast<const std::unordered_set<std::string_view>*>(rhs);
-    return members->find(sv) != members->end();
+    auto members = static_cast<const ASTMemberSet*>(rhs);
+    return members->contains(sv);
   }
 };
 
@@ -2274,9 +2432,8 @@ struct QueryCondition::BinaryCmp<T, QueryConditionOp::NOT_IN> {
   static inline bool cmp(
       const void* lhs, uint64_t lhs_size, const void* rhs, uint64_t) {
     std::string_view sv(static_cast<const char*>(lhs), lhs_size);
-    auto members =
-        static_cast<const std::unordered_set<std::string_view>*>(rhs);
-    return members->find(sv) == members->end();
+    auto members = static_cast<const ASTMemberSet*>(rhs);
+    return !members->contains(sv);
   }
 };
 
@@ -2353,6 +2510,31 @@ void QueryCondition::apply_ast_node_sparse(
     const uint64_t cell_size = tile.cell_size();
     const uint64_t buffer_el = tile.size() / cell_size;
 
+    // Fast path for fixed-size arithmetic cells: compare typed values in a
+    // tight loop that vectorizes and emits the bitmap directly.
+    if constexpr (
+        std::is_arithmetic_v<T> && Op != QueryConditionOp::IN &&
+        Op != QueryConditionOp::NOT_IN) {
+      if (cell_size == sizeof(T)) {
+        const T* cells =
+            static_cast<const T*>(static_cast<const void*>(buffer));
+        const T condition_value =
+            *static_cast<const T*>(condition_value_content);
+        for (uint64_t c = 0; c < buffer_el; ++c) {
+          const bool cmp = cell_cmp<T, Op>(cells[c], condition_value);
+          if constexpr (
+              std::is_same_v<CombinationOp, QCMax<BitmapType>> &&
+              nullable::value) {
+            result_bitmap[c] = combination_op(
+                result_bitmap[c], cmp && (buffer_validity[c] != 0));
+          } else {
+            result_bitmap[c] = combination_op(result_bitmap[c], cmp);
+          }
+        }
+        return;
+      }
+    }
+
     // Iterate through each cell without checking the bitmap to enable
     // vectorization.
     for (uint64_t c = 0; c < buffer_el; ++c) {
@@ -2663,16 +2845,22 @@ void QueryCondition::apply_tree_sparse(
          * cl1(q; a) /\ cl2(q; a) = cl1(q; cl2(q; a))
          */
       case QueryConditionCombinationOp::AND: {
+        // Run the cheapest, most selective clauses first and skip the
+        // remaining clauses once the combined bitmap empties.
+        const auto children = ordered_and_children(node.get(), array_schema);
         if constexpr (std::is_same_v<
                           CombinationOp,
                           std::multiplies<BitmapType>>) {
-          for (const auto& child : node->get_children()) {
+          for (const auto* child : children) {
             apply_tree_sparse<BitmapType>(
-                child,
+                *child,
                 array_schema,
                 result_tile,
                 std::multiplies<BitmapType>(),
                 result_bitmap);
+            if (bitmap_empty(result_bitmap)) {
+              break;
+            }
           }
 
           // Handle the cl'(q, a) case.
@@ -2680,13 +2868,16 @@ void QueryCondition::apply_tree_sparse(
         } else if constexpr (std::is_same_v<CombinationOp, QCMax<BitmapType>>) {
           std::vector<BitmapType> combination_op_bitmap(result_bitmap_size, 1);
 
-          for (const auto& child : node->get_children()) {
+          for (const auto* child : children) {
             apply_tree_sparse<BitmapType>(
-                child,
+                *child,
                 array_schema,
                 result_tile,
                 std::multiplies<BitmapType>(),
                 combination_op_bitmap);
+            if (bitmap_empty(combination_op_bitmap)) {
+              break;
+            }
           }
           for (size_t c = 0; c < result_bitmap_size; ++c) {
             result_bitmap[c] |= combination_op_bitmap[c];
@@ -2742,6 +2933,211 @@ Status QueryCondition::apply_sparse(
   return Status::Ok();
 }
 
+/** Returns `true` if a value in `[min, max]` can satisfy `op value`. */
+template <typename T>
+static bool tile_range_can_satisfy(
+    const QueryConditionOp op, const T& min, const T& max, const T& value) {
+  switch (op) {
+    case QueryConditionOp::LT:
+      return min < value;
+    case QueryConditionOp::LE:
+      return min <= value;
+    case QueryConditionOp::GT:
+      return max > value;
+    case QueryConditionOp::GE:
+      return max >= value;
+    case QueryConditionOp::EQ:
+      return min <= value && value <= max;
+    case QueryConditionOp::NE:
+      return !(min == value && max == value);
+    default:
+      return true;
+  }
+}
+
+/**
+ * Returns `true` if the tile min/max metadata cannot disprove that a cell
+ * in the tile satisfies the input value node.
+ */
+template <typename T>
+static bool tile_min_max_can_satisfy(
+    const ASTNode* node, const FragmentMetadata& frag_md, uint64_t tile_idx) {
+  const auto& field_name = node->get_field_name();
+  const auto min = frag_md.get_tile_min_as<T>(field_name, tile_idx);
+  const auto max = frag_md.get_tile_max_as<T>(field_name, tile_idx);
+  T value;
+  if constexpr (std::is_same_v<T, std::string_view>) {
+    value = std::string_view(
+        static_cast<const char*>(node->get_value_ptr()),
+        node->get_value_size());
+  } else {
+    value = *static_cast<const T*>(node->get_value_ptr());
+  }
+  return tile_range_can_satisfy(node->get_op(), min, max, value);
+}
+
+/**
+ * Returns `true` if the per-tile metadata of the fragment cannot disprove
+ * that a cell in the tile satisfies the input AST.
+ */
+static bool ast_node_can_match_tile(
+    const ASTNode* node, const FragmentMetadata& frag_md, uint64_t tile_idx) {
+  if (node->is_expr()) {
+    switch (node->get_combination_op()) {
+      case QueryConditionCombinationOp::AND:
+        for (const auto& child : node->get_children()) {
+          if (!ast_node_can_match_tile(child.get(), frag_md, tile_idx)) {
+            return false;
+          }
+        }
+        return true;
+      case QueryConditionCombinationOp::OR:
+        for (const auto& child : node->get_children()) {
+          if (ast_node_can_match_tile(child.get(), frag_md, tile_idx)) {
+            return true;
+          }
+        }
+        return false;
+      default:
+        // NOT is not supported when applying conditions; be conservative.
+        return true;
+    }
+  }
+
+  const auto& field_name = node->get_field_name();
+  const auto& array_schema = *frag_md.array_schema();
+
+  // Fields the fragment's schema doesn't know about are read as fill
+  // values; the tile metadata cannot disprove a match.
+  if (!array_schema.is_field(field_name)) {
+    return true;
+  }
+
+  // Dimension tiles are pruned spatially by the subarray and their min/max
+  // metadata might not have been loaded.
+  if (array_schema.is_dim(field_name)) {
+    return true;
+  }
+
+  const auto nullable = array_schema.is_nullable(field_name);
+
+  // Null tests only depend on the tile null count.
+  if (node->get_value_ptr() == nullptr) {
+    if (!nullable) {
+      return true;
+    }
+
+    const auto null_count = frag_md.get_tile_null_count(field_name, tile_idx);
+    if (node->get_op() == QueryConditionOp::EQ) {
+      return null_count > 0;
+    } else if (node->get_op() == QueryConditionOp::NE) {
+      return null_count < frag_md.cell_num(tile_idx);
+    }
+
+    return true;
+  }
+
+  // Null cells fail every value comparison, so a tile with only null cells
+  // cannot match.
+  if (nullable && frag_md.get_tile_null_count(field_name, tile_idx) ==
+                      frag_md.cell_num(tile_idx)) {
+    return false;
+  }
+
+  // Set membership cannot be checked against a single range.
+  const auto op = node->get_op();
+  if (op == QueryConditionOp::IN || op == QueryConditionOp::NOT_IN) {
+    return true;
+  }
+
+  const auto type = array_schema.type(field_name);
+  const auto var_size = array_schema.var_size(field_name);
+  const auto cell_val_num = array_schema.cell_val_num(field_name);
+  if (!TileMetadataGenerator::has_min_max_metadata(
+          type, false, var_size, cell_val_num)) {
+    return true;
+  }
+
+  switch (type) {
+    case Datatype::INT8:
+      return tile_min_max_can_satisfy<int8_t>(node, frag_md, tile_idx);
+    case Datatype::BOOL:
+    case Datatype::UINT8:
+      return tile_min_max_can_satisfy<uint8_t>(node, frag_md, tile_idx);
+    case Datatype::INT16:
+      return tile_min_max_can_satisfy<int16_t>(node, frag_md, tile_idx);
+    case Datatype::UINT16:
+      return tile_min_max_can_satisfy<uint16_t>(node, frag_md, tile_idx);
+    case Datatype::INT32:
+      return tile_min_max_can_satisfy<int32_t>(node, frag_md, tile_idx);
+    case Datatype::UINT32:
+      return tile_min_max_can_satisfy<uint32_t>(node, frag_md, tile_idx);
+    case Datatype::INT64:
+      return tile_min_max_can_satisfy<int64_t>(node, frag_md, tile_idx);
+    case Datatype::UINT64:
+      return tile_min_max_can_satisfy<uint64_t>(node, frag_md, tile_idx);
+    case Datatype::STRING_ASCII:
+    case Datatype::CHAR: {
+      if (!tile_min_max_can_satisfy<std::string_view>(
+              node, frag_md, tile_idx)) {
+        return false;
+      }
+
+      // For string equality, the tile bloom filter can rule out values that
+      // fall inside the min/max range. Fixed size cells are inserted whole,
+      // so the condition value must span a full cell to hash identically.
+      if (node->get_op() == QueryConditionOp::EQ &&
+          frag_md.format_version() >=
+              constants::tile_bloom_filter_min_version &&
+          (var_size ||
+           node->get_value_size() == array_schema.cell_size(field_name))) {
+        return frag_md.tile_bloom_filter_maybe_contains(
+            field_name,
+            tile_idx,
+            node->get_value_ptr(),
+            node->get_value_size());
+      }
+
+      return true;
+    }
+    case Datatype::DATETIME_YEAR:
+    case Datatype::DATETIME_MONTH:
+    case Datatype::DATETIME_WEEK:
+    case Datatype::DATETIME_DAY:
+    case Datatype::DATETIME_HR:
+    case Datatype::DATETIME_MIN:
+    case Datatype::DATETIME_SEC:
+    case Datatype::DATETIME_MS:
+    case Datatype::DATETIME_US:
+    case Datatype::DATETIME_NS:
+    case Datatype::DATETIME_PS:
+    case Datatype::DATETIME_FS:
+    case Datatype::DATETIME_AS:
+    case Datatype::TIME_HR:
+    case Datatype::TIME_MIN:
+    case Datatype::TIME_SEC:
+    case Datatype::TIME_MS:
+    case Datatype::TIME_US:
+    case Datatype::TIME_NS:
+    case Datatype::TIME_PS:
+    case Datatype::TIME_FS:
+    case Datatype::TIME_AS:
+      return tile_min_max_can_satisfy<int64_t>(node, frag_md, tile_idx);
+    default:
+      // Floating point min/max can be NaN, which breaks range reasoning.
+      return true;
+  }
+}
+
+bool QueryCondition::can_skip_tile(
+    const FragmentMetadata& frag_md, uint64_t tile_idx) const {
+  if (tree_ == nullptr || !frag_md.has_tile_metadata()) {
+    return false;
+  }
+
+  return !ast_node_can_match_tile(tree_.get(), frag_md, tile_idx);
+}
+
 QueryCondition QueryCondition::negated_condition() {
   return QueryCondition(tree_->get_negated_tree());
 }
@@ -242,6 +242,26 @@ class QueryCondition {
       ResultTile& result_tile,
       std::vector<BitmapType>& result_bitmap);
 
+  /**
+   * Returns whether a tile can be skipped without being read, because the
+   * per-tile metadata of the fragment (min/max values and null counts)
+   * proves that no cell in the tile can satisfy this condition.
+   *
+   * The check is conservative: it returns `false` whenever the metadata
+   * cannot disprove a match, e.g. for fragments written before tile
+   * metadata existed, fields missing from the fragment's schema, types
+   * without min/max metadata or set membership operators.
+   *
+   * The min/max and null count metadata of the fields this condition
+   * references must have been loaded for the fragment, for the formats
+   * that have them.
+   *
+   * @param frag_md The fragment metadata.
+   * @param tile_idx The index of the tile in the fragment.
+   * @return `true` if no cell in the tile can satisfy this condition.
+   */
+  bool can_skip_tile(const FragmentMetadata& frag_md, uint64_t tile_idx) const;
+
   /**
    * Reverse the query condition using De Morgan's law.
    */
@@ -0,0 +1,186 @@
+/**
+ * @file   query_profile_registry.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class QueryProfileRegistry.
+ */
+
+#ifndef TILEDB_QUERY_PROFILE_REGISTRY_H
+#define TILEDB_QUERY_PROFILE_REGISTRY_H
+
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "tiledb/common/common.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * Aggregate execution statistics for completed read queries that share a
+ * profile key (array URI plus a coarse subarray shape class).
+ */
+struct QueryProfile {
+  /** Number of completed queries folded into this profile. */
+  uint64_t num_queries_ = 0;
+
+  /** Total number of user-level submits across those queries. */
+  uint64_t total_loop_num_ = 0;
+
+  /** Total number of reader-internal partitioning loops. */
+  uint64_t total_internal_loop_num_ = 0;
+
+  /** Total seconds spent in the strategies' `dowork` calls. */
+  double total_dowork_secs_ = 0.0;
+
+  /** Name of the strategy that most recently produced this profile. */
+  std::string strategy_name_;
+};
+
+/**
+ * A context-level registry of read query execution profiles, consulted by
+ * strategy creation to pre-size memory budgets for workloads this context
+ * has seen before.
+ *
+ * Readers start from the configured `sm.mem.total_budget` and, when the
+ * budget is too small for the subarray shape at hand, fall back to internal
+ * loops that re-read and re-unfilter tiles; on some workloads that costs
+ * several times the one-pass wall time. After a read query completes, the
+ * query records its loop counts and `dowork` time here keyed by array URI
+ * and a coarse subarray shape class. A later query with the same key whose
+ * history shows repeated looping gets its memory budget scaled up before
+ * the strategy is constructed, so it completes in fewer passes.
+ *
+ * The registry is purely a performance hint: entries are in-memory only,
+ * never persisted, and a missing or stale profile simply yields the
+ * configured defaults. The number of tracked profiles is capped; once the
+ * cap is reached, profiles for unseen keys are no longer added.
+ */
+class QueryProfileRegistry {
+ public:
+  /* ********************************* */
+  /*          TYPE DEFINITIONS         */
+  /* ********************************* */
+
+  /** Maximum number of tracked profiles. */
+  static constexpr size_t max_profiles = 4096;
+
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param enabled Whether profile recording and consultation is enabled.
+   */
+  explicit QueryProfileRegistry(const bool enabled)
+      : enabled_(enabled) {
+  }
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** @return Whether the registry is enabled. */
+  inline bool enabled() const {
+    return enabled_;
+  }
+
+  /**
+   * Folds a completed query's execution statistics into the profile for
+   * `key`, creating the profile if the cap allows.
+   *
+   * @param key Profile key (array URI plus subarray shape class).
+   * @param strategy_name Name of the strategy that ran the query.
+   * @param loop_num Number of user-level submits the query needed.
+   * @param internal_loop_num Number of reader-internal loops.
+   * @param dowork_secs Seconds spent in the strategy's `dowork` calls.
+   */
+  void record(
+      const std::string& key,
+      const std::string& strategy_name,
+      const uint64_t loop_num,
+      const uint64_t internal_loop_num,
+      const double dowork_secs) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    auto it = profiles_.find(key);
+    if (it == profiles_.end()) {
+      if (profiles_.size() >= max_profiles) {
+        return;
+      }
+      it = profiles_.emplace(key, QueryProfile()).first;
+    }
+
+    auto& profile = it->second;
+    profile.num_queries_++;
+    profile.total_loop_num_ += loop_num;
+    profile.total_internal_loop_num_ += internal_loop_num;
+    profile.total_dowork_secs_ += dowork_secs;
+    profile.strategy_name_ = strategy_name;
+  }
+
+  /**
+   * Looks up the profile for `key`.
+   *
+   * @param key Profile key (array URI plus subarray shape class).
+   * @return The profile, or `nullopt` if none has been recorded.
+   */
+  std::optional<QueryProfile> lookup(const std::string& key) const {
+    std::lock_guard<std::mutex> lock(mtx_);
+    auto it = profiles_.find(key);
+    if (it == profiles_.end()) {
+      return std::nullopt;
+    }
+
+    return it->second;
+  }
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** Whether the registry is enabled. */
+  bool enabled_;
+
+  /** Mutex protecting `profiles_`. */
+  mutable std::mutex mtx_;
+
+  /** The tracked profiles. */
+  std::unordered_map<std::string, QueryProfile> profiles_;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_QUERY_PROFILE_REGISTRY_H
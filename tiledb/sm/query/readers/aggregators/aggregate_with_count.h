@@ -35,7 +35,11 @@
 
 #include "tiledb/sm/query/readers/aggregators/aggregate_buffer.h"
 #include "tiledb/sm/query/readers/aggregators/field_info.h"
+#include "tiledb/sm/query/readers/aggregators/min_max.h"
 #include "tiledb/sm/query/readers/aggregators/no_op.h"
+#include "tiledb/sm/query/readers/aggregators/safe_sum.h"
+
+#include <algorithm>
 
 namespace tiledb::sm {
 
@@ -81,6 +85,38 @@ class AggregateWithCount {
   tuple<AGG_T, uint64_t> aggregate(AggregateBuffer& input_data) {
     AggPolicy agg_policy;
     ValidityPolicy val_policy;
+
+    // Fixed size arithmetic cells with a 0/1 bitmap can be aggregated with
+    // branchless kernels that compilers vectorize. Count bitmaps repeat
+    // cells an arbitrary number of times and keep the scalar loops below.
+    if constexpr (vectorizable_) {
+      if (!input_data.has_bitmap() || !input_data.is_count_bitmap()) {
+        if (input_data.has_bitmap()) {
+          if (field_info_.is_nullable_) {
+            return aggregate_branchless(input_data, [&](uint64_t c) {
+              return static_cast<uint64_t>(
+                         val_policy.op(input_data.validity_at(c))) *
+                     static_cast<uint64_t>(
+                         input_data.bitmap_at<BITMAP_T>(c));
+            });
+          } else {
+            return aggregate_branchless(input_data, [&](uint64_t c) {
+              return static_cast<uint64_t>(input_data.bitmap_at<BITMAP_T>(c));
+            });
+          }
+        } else {
+          if (field_info_.is_nullable_) {
+            return aggregate_branchless(input_data, [&](uint64_t c) {
+              return static_cast<uint64_t>(
+                  val_policy.op(input_data.validity_at(c)));
+            });
+          } else {
+            return aggregate_branchless(
+                input_data, [](uint64_t) { return uint64_t{1}; });
+          }
+        }
+      }
+    }
     AGG_T res;
     if constexpr (std::is_same<AGG_T, std::string_view>::value) {
       res = "";
@@ -140,6 +176,25 @@ class AggregateWithCount {
   }
 
  private:
+  /* ********************************* */
+  /*         PRIVATE CONSTANTS         */
+  /* ********************************* */
+
+  /**
+   * Whether the branchless kernels apply to this instantiation: arithmetic
+   * cell values aggregated by a policy with a branchless equivalent.
+   */
+  static constexpr bool vectorizable_ =
+      std::is_arithmetic_v<typename type_data<T>::value_type> &&
+      (std::is_same_v<AggPolicy, NoOp> ||
+       std::is_same_v<AggPolicy, SafeSum> || is_min_max_v<AggPolicy>);
+
+  /**
+   * Block size for the vectorized sum kernel. Small enough that a block of
+   * values narrower than the accumulator cannot overflow it.
+   */
+  static constexpr uint64_t sum_block_size_ = 512;
+
   /* ********************************* */
   /*         PRIVATE ATTRIBUTES        */
   /* ********************************* */
@@ -166,6 +221,87 @@ class AggregateWithCount {
 
     return AGG_T();
   }
+
+  /**
+   * Aggregate the input data with branch free loops.
+   *
+   * The weight function returns 1 for cells that pass the validity and
+   * bitmap filters and 0 otherwise, so the loop bodies contain no per-cell
+   * branches and compilers turn them into masked SIMD reductions. Counts
+   * reduce to a sum of weights; min/max selects against a running value
+   * once a scalar prologue has found the first kept cell; sums accumulate
+   * masked values in unchecked blocks that cannot overflow the wider
+   * accumulator and fold each block through the overflow-checked policy.
+   *
+   * @tparam WeightFn Weight function type.
+   * @param input_data Input data for the aggregation.
+   * @param weight Weight function, returns 0 or 1 for a cell index.
+   * @return {Aggregate value, count of cells}.
+   */
+  template <typename WeightFn>
+  tuple<AGG_T, uint64_t> aggregate_branchless(
+      AggregateBuffer& input_data, WeightFn weight) {
+    typedef typename type_data<T>::value_type VALUE_T;
+    AggPolicy agg_policy;
+    const uint64_t num_cells = input_data.size();
+    AGG_T res{0};
+    uint64_t count{0};
+
+    if constexpr (std::is_same_v<AggPolicy, NoOp>) {
+      for (uint64_t c = 0; c < num_cells; c++) {
+        count += weight(c);
+      }
+    } else if constexpr (is_min_max_v<AggPolicy>) {
+      // Scalar prologue up to the first kept cell so the main loop can
+      // select against an already valid running value.
+      uint64_t c = 0;
+      for (; c < num_cells; c++) {
+        if (weight(c) != 0) {
+          res = input_data.value_at<VALUE_T>(c);
+          count++;
+          c++;
+          break;
+        }
+      }
+
+      for (; c < num_cells; c++) {
+        const uint64_t w = weight(c);
+        const VALUE_T value = input_data.value_at<VALUE_T>(c);
+        res = w != 0 ? agg_policy.select(static_cast<AGG_T>(value), res) : res;
+        count += w;
+      }
+    } else if constexpr (sizeof(VALUE_T) < sizeof(AGG_T)) {
+      // Values narrower than the accumulator cannot overflow it within a
+      // block, so only the per-block fold needs the overflow check.
+      for (uint64_t b = 0; b < num_cells; b += sum_block_size_) {
+        const uint64_t end = std::min(b + sum_block_size_, num_cells);
+        AGG_T partial{0};
+        uint64_t partial_count{0};
+        for (uint64_t c = b; c < end; c++) {
+          const uint64_t w = weight(c);
+          partial += static_cast<AGG_T>(input_data.value_at<VALUE_T>(c)) *
+                     static_cast<AGG_T>(w);
+          partial_count += w;
+        }
+
+        agg_policy.op(partial, res, count);
+        count += partial_count;
+      }
+    } else {
+      // Values as wide as the accumulator keep the overflow check on every
+      // add; masking to 0 still removes the per-cell branch.
+      for (uint64_t c = 0; c < num_cells; c++) {
+        const uint64_t w = weight(c);
+        const AGG_T value =
+            w != 0 ? static_cast<AGG_T>(input_data.value_at<VALUE_T>(c)) :
+                     AGG_T{0};
+        agg_policy.op(value, res, count);
+        count += w;
+      }
+    }
+
+    return {res, count};
+  }
 };
 
 }  // namespace tiledb::sm
@@ -74,6 +74,16 @@ class CountAggregatorBase : public OutputBufferValidator, public IAggregator {
     return true;
   }
 
+  /** Returns if the aggregate consumes tile min/max metadata. */
+  bool need_min_max_metadata() override {
+    return false;
+  }
+
+  /** Returns if the aggregate consumes tile sum metadata. */
+  bool need_sum_metadata() override {
+    return false;
+  }
+
   /**
    * Validate the result buffer.
    *
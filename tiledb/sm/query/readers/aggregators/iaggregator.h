@@ -66,6 +66,20 @@ class IAggregator {
   /** Returns if the aggregate needs to be recomputed on overflow. */
   virtual bool need_recompute_on_overflow() = 0;
 
+  /**
+   * Returns if the aggregate consumes tile min/max metadata when
+   * aggregating a full tile with fragment metadata. Used to only load the
+   * metadata kinds an aggregate actually needs.
+   */
+  virtual bool need_min_max_metadata() = 0;
+
+  /**
+   * Returns if the aggregate consumes tile sum metadata when aggregating
+   * a full tile with fragment metadata. Used to only load the metadata
+   * kinds an aggregate actually needs.
+   */
+  virtual bool need_sum_metadata() = 0;
+
   /** Returns if the aggregation is var sized or not. */
   virtual bool aggregation_var_sized() = 0;
 
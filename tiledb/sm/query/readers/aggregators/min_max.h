@@ -33,6 +33,8 @@
 #ifndef TILEDB_MIN_MAX_H
 #define TILEDB_MIN_MAX_H
 
+#include <type_traits>
+
 namespace tiledb::sm {
 
 template <class Op>
@@ -54,10 +56,33 @@ struct MinMax {
     }
   }
 
+  /**
+   * Branchless min max, used by the vectorized aggregation kernels once a
+   * first value has been selected.
+   *
+   * @param value Candidate value.
+   * @param min_max Current min/max.
+   * @return New min/max.
+   */
+  template <typename MIN_MAX_T>
+  inline MIN_MAX_T select(MIN_MAX_T value, MIN_MAX_T min_max) {
+    return op_(value, min_max) ? value : min_max;
+  }
+
  private:
   Op op_;
 };
 
+/** Whether an aggregation policy is a MinMax instantiation. */
+template <class T>
+struct is_min_max : std::false_type {};
+
+template <class Op>
+struct is_min_max<MinMax<Op>> : std::true_type {};
+
+template <class T>
+inline constexpr bool is_min_max_v = is_min_max<T>::value;
+
 }  // namespace tiledb::sm
 
 #endif  // TILEDB_MIN_MAX_H
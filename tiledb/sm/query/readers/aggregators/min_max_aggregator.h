@@ -160,6 +160,16 @@ class ComparatorAggregator : public ComparatorAggregatorBase<T>,
     return false;
   }
 
+  /** Returns if the aggregate consumes tile min/max metadata. */
+  bool need_min_max_metadata() override {
+    return true;
+  }
+
+  /** Returns if the aggregate consumes tile sum metadata. */
+  bool need_sum_metadata() override {
+    return false;
+  }
+
   /**
    * Validate the result buffer.
    *
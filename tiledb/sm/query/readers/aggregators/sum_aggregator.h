@@ -96,6 +96,16 @@ class SumWithCountAggregator : public InputFieldValidator,
     return true;
   }
 
+  /** Returns if the aggregate consumes tile min/max metadata. */
+  bool need_min_max_metadata() override {
+    return false;
+  }
+
+  /** Returns if the aggregate consumes tile sum metadata. */
+  bool need_sum_metadata() override {
+    return true;
+  }
+
   /**
    * Validate the result buffer.
    *
@@ -64,6 +64,81 @@ class DenseReaderStatusException : public StatusException {
   }
 };
 
+/* ****************************** */
+/*          COPY KERNELS          */
+/* ****************************** */
+
+namespace {
+
+/**
+ * Function type for a kernel that copies `cell_num` cells from `src` to
+ * `dest`, reading one source cell every `stride` cells. A `stride` of 0
+ * replicates the first source cell, which implements fill value expansion.
+ */
+using CopyCellsFn = void (*)(
+    void* dest,
+    const void* src,
+    uint64_t cell_size,
+    uint64_t stride,
+    uint64_t cell_num);
+
+/**
+ * Copies cells of a size known at compile time. The constant size lets the
+ * compiler lower each `memcpy` to a handful of register moves instead of a
+ * libc call parameterized at runtime.
+ */
+template <uint64_t cell_size>
+void copy_cells_fixed(
+    void* const dest,
+    const void* const src,
+    uint64_t,
+    const uint64_t stride,
+    const uint64_t cell_num) {
+  auto dest_ptr = static_cast<char*>(dest);
+  auto src_ptr = static_cast<const char*>(src);
+  for (uint64_t i = 0; i < cell_num; ++i) {
+    std::memcpy(dest_ptr, src_ptr, cell_size);
+    src_ptr += cell_size * stride;
+    dest_ptr += cell_size;
+  }
+}
+
+/** Copies cells of a size only known at runtime. */
+void copy_cells_generic(
+    void* const dest,
+    const void* const src,
+    const uint64_t cell_size,
+    const uint64_t stride,
+    const uint64_t cell_num) {
+  auto dest_ptr = static_cast<char*>(dest);
+  auto src_ptr = static_cast<const char*>(src);
+  for (uint64_t i = 0; i < cell_num; ++i) {
+    std::memcpy(dest_ptr, src_ptr, cell_size);
+    src_ptr += cell_size * stride;
+    dest_ptr += cell_size;
+  }
+}
+
+/** Returns the copy kernel specialized for `cell_size`. */
+CopyCellsFn select_copy_cells_fn(const uint64_t cell_size) {
+  switch (cell_size) {
+    case 1:
+      return copy_cells_fixed<1>;
+    case 2:
+      return copy_cells_fixed<2>;
+    case 4:
+      return copy_cells_fixed<4>;
+    case 8:
+      return copy_cells_fixed<8>;
+    case 16:
+      return copy_cells_fixed<16>;
+    default:
+      return copy_cells_generic;
+  }
+}
+
+}  // namespace
+
 /* ****************************** */
 /*          CONSTRUCTORS          */
 /* ****************************** */
@@ -221,6 +296,10 @@ Status DenseReader::dowork() {
 }
 
 void DenseReader::reset() {
+  // Rebuild the read state for the (possibly updated) subarray so that a
+  // completed query can be resubmitted. The memory budget and array
+  // memory tracker are kept as is.
+  init_read_state();
 }
 
 std::string DenseReader::name() {
@@ -349,10 +428,12 @@ Status DenseReader::dense_read() {
       read_state_.partitioner_.subarray().relevant_fragments(), var_names);
   load_tile_offsets(
       read_state_.partitioner_.subarray().relevant_fragments(), names);
-  if (!aggregates_.empty()) {
-    load_tile_metadata(
-        read_state_.partitioner_.subarray().relevant_fragments(), names);
-  }
+
+  // Load the tile metadata unconditionally: null counts let the tile read
+  // path skip validity and data I/O for no-null and all-null tiles even
+  // when there are no aggregates.
+  load_tile_metadata(
+      read_state_.partitioner_.subarray().relevant_fragments(), names);
 
   uint64_t t_start = 0;
   uint64_t t_end = 0;
@@ -445,12 +526,13 @@ Status DenseReader::dense_read() {
       }
 
       // Get the tiles to load for this attribute.
-      auto result_tiles = result_tiles_to_load(
+      auto&& [result_tiles, tile_cell_ranges] = result_tiles_to_load(
           name,
           qc_loaded_attr_names_set_,
           subarray,
           t_start,
           t_end,
+          tile_extents,
           result_space_tiles,
           tile_subarrays);
 
@@ -479,9 +561,12 @@ Status DenseReader::dense_read() {
            subarray_start_cell,
            subarray_end_cell,
            num_range_threads,
-           result_tiles]() {
-            // Unfilter tiles.
-            RETURN_NOT_OK(unfilter_tiles(name, validity_only, result_tiles));
+           result_tiles,
+           tile_cell_ranges]() {
+            // Unfilter tiles. Only the chunks covering the cells of the tile
+            // subarrays get unfiltered.
+            RETURN_NOT_OK(unfilter_tiles(
+                name, validity_only, result_tiles, &tile_cell_ranges));
 
             // Only copy names that are present in the user buffers.
             if (buffers_.count(name) != 0) {
@@ -852,12 +937,51 @@ uint64_t DenseReader::compute_space_tiles_end(
 }
 
 template <class DimType>
-std::vector<ResultTile*> DenseReader::result_tiles_to_load(
+std::pair<uint64_t, uint64_t> DenseReader::tile_cell_range(
+    const std::vector<DimType>& tile_extents,
+    const ResultSpaceTile<DimType>& result_space_tile,
+    const Subarray& tile_subarray) const {
+  // For easy reference.
+  const auto dim_num = array_schema_.dim_num();
+  const auto& start_coords = result_space_tile.start_coords();
+
+  // Compute the tile local corners of the bounding box of the tile subarray
+  // ranges on every dimension and accumulate the cell positions of the
+  // corners using the strides of the on-disk cell order.
+  uint64_t pos_min = 0;
+  uint64_t pos_max = 0;
+  uint64_t mult = 1;
+  for (uint32_t i = 0; i < dim_num; i++) {
+    const auto d = array_schema_.cell_order() == Layout::COL_MAJOR ?
+                       i :
+                       dim_num - i - 1;
+    const auto& ranges = tile_subarray.ranges_for_dim(d);
+    auto bounds = static_cast<const DimType*>(ranges[0].data());
+    DimType min_coord = bounds[0];
+    DimType max_coord = bounds[1];
+    for (uint64_t r = 1; r < ranges.size(); r++) {
+      bounds = static_cast<const DimType*>(ranges[r].data());
+      min_coord = std::min(min_coord, bounds[0]);
+      max_coord = std::max(max_coord, bounds[1]);
+    }
+
+    pos_min += (min_coord - start_coords[d]) * mult;
+    pos_max += (max_coord - start_coords[d]) * mult;
+    mult *= tile_extents[d];
+  }
+
+  return {pos_min, pos_max};
+}
+
+template <class DimType>
+tuple<std::vector<ResultTile*>, std::vector<std::pair<uint64_t, uint64_t>>>
+DenseReader::result_tiles_to_load(
     const optional<std::string> name,
     const std::unordered_set<std::string>& condition_names,
     const Subarray& subarray,
     const uint64_t t_start,
     const uint64_t t_end,
+    const std::vector<DimType>& tile_extents,
     std::map<const DimType*, ResultSpaceTile<DimType>>& result_space_tiles,
     const DynamicArray<Subarray>& tile_subarrays) const {
   // For easy reference.
@@ -865,9 +989,9 @@ std::vector<ResultTile*> DenseReader::result_tiles_to_load(
   const bool agg_only = name.has_value() && aggregate_only(name.value());
 
   // If the result is already loaded in query condition, return the empty list;
-  std::vector<ResultTile*> ret;
+  std::vector<std::pair<ResultTile*, std::pair<uint64_t, uint64_t>>> tiles;
   if (name.has_value() && condition_names.count(name.value()) != 0) {
-    return ret;
+    return {{}, {}};
   }
 
   for (uint64_t t = t_start; t < t_end; t++) {
@@ -881,13 +1005,29 @@ std::vector<ResultTile*> DenseReader::result_tiles_to_load(
       continue;
     }
 
+    // All result tiles of a space tile share the cell range covered by the
+    // tile subarray as dense fragment tiles are aligned with space tiles.
+    const auto cell_range =
+        tile_cell_range(tile_extents, result_space_tile, tile_subarrays[t]);
     for (const auto& result_tile : result_space_tile.result_tiles()) {
-      ret.push_back(const_cast<ResultTile*>(&result_tile.second));
+      tiles.emplace_back(
+          const_cast<ResultTile*>(&result_tile.second), cell_range);
     }
   }
-  std::sort(ret.begin(), ret.end(), result_tile_cmp);
+  std::sort(tiles.begin(), tiles.end(), [](const auto& a, const auto& b) {
+    return result_tile_cmp(a.first, b.first);
+  });
+
+  std::vector<ResultTile*> ret;
+  std::vector<std::pair<uint64_t, uint64_t>> cell_ranges;
+  ret.reserve(tiles.size());
+  cell_ranges.reserve(tiles.size());
+  for (const auto& tile : tiles) {
+    ret.push_back(tile.first);
+    cell_ranges.push_back(tile.second);
+  }
 
-  return ret;
+  return {ret, cell_ranges};
 }
 
 /**
@@ -922,12 +1062,13 @@ Status DenseReader::apply_query_condition(
     }
 
     // Get the result tiles to process.
-    auto result_tiles = result_tiles_to_load(
+    auto&& [result_tiles, tile_cell_ranges] = result_tiles_to_load(
         nullopt,
         condition_names,
         subarray,
         t_start,
         t_end,
+        tile_extents,
         result_space_tiles,
         tile_subarrays);
 
@@ -946,7 +1087,8 @@ Status DenseReader::apply_query_condition(
          t_start,
          t_end,
          num_range_threads,
-         result_tiles]() {
+         result_tiles,
+         tile_cell_ranges]() {
           // For easy reference.
           const auto& tile_coords = subarray.tile_coords();
           const auto dim_num = array_schema_.dim_num();
@@ -954,9 +1096,11 @@ Status DenseReader::apply_query_condition(
           const auto cell_order = array_schema_.cell_order();
           const auto global_order = layout_ == Layout::GLOBAL_ORDER;
 
-          // Unfilter tiles.
+          // Unfilter tiles. Only the chunks covering the cells of the tile
+          // subarrays get unfiltered.
           for (auto& name : qc_names) {
-            RETURN_NOT_OK(unfilter_tiles(name, false, result_tiles));
+            RETURN_NOT_OK(
+                unfilter_tiles(name, false, result_tiles, &tile_cell_ranges));
           }
 
           if (stride == UINT64_MAX) {
@@ -1368,6 +1512,7 @@ Status DenseReader::process_aggregates(
             for (auto& aggregate : aggregates) {
               aggregate->aggregate_tile_with_frag_md(md);
             }
+            stats_->add_counter("tiles_aggregated_with_frag_md", 1);
           }
         } else {
           RETURN_NOT_OK(aggregate_tiles(
@@ -1444,6 +1589,10 @@ Status DenseReader::copy_fixed_tiles(
   const auto& fill_value = attribute->fill_value();
   const auto& fill_value_nullable = attribute->fill_value_validity();
 
+  // Select the copy kernel for this attribute's cell size once, outside of
+  // the cell slab loop.
+  const auto copy_cells = select_copy_cells_fn(cell_size);
+
   // Cache tile tuples.
   std::vector<ResultTile::TileTuple*> tile_tuples(frag_domains.size());
   for (uint32_t fd = 0; fd < frag_domains.size(); ++fd) {
@@ -1516,23 +1665,21 @@ Status DenseReader::copy_fixed_tiles(
           }
         } else {
           // Go cell by cell.
-          auto src = tile.data_as<char>() + cell_size * src_offset;
-          auto dest = dest_ptr + cell_size * start;
-          for (uint64_t i = 0; i < end - start + 1; ++i) {
-            std::memcpy(dest, src, cell_size);
-            src += cell_size * stride;
-            dest += cell_size;
-          }
+          copy_cells(
+              dest_ptr + cell_size * start,
+              tile.data_as<char>() + cell_size * src_offset,
+              cell_size,
+              stride,
+              end - start + 1);
 
           if (nullable) {
             const auto& tile_nullable = tile_tuples[fd]->validity_tile();
-            auto src_validity = tile_nullable.data_as<char>() + src_offset;
-            auto dest_validity = dest_validity_ptr + start;
-            for (uint64_t i = 0; i < end - start + 1; ++i) {
-              memcpy(dest_validity, src_validity, 1);
-              src_validity += stride;
-              dest_validity++;
-            }
+            copy_cells_fixed<1>(
+                dest_validity_ptr + start,
+                tile_nullable.data_as<char>() + src_offset,
+                1,
+                stride,
+                end - start + 1);
           }
         }
 
@@ -1548,17 +1695,13 @@ Status DenseReader::copy_fixed_tiles(
 
       // Do the filling.
       if (fd == (int32_t)frag_domains.size() - 1) {
-        auto buff = dest_ptr;
-        for (uint64_t i = 0; i < start; ++i) {
-          std::memcpy(buff, fill_value.data(), fill_value.size());
-          buff += fill_value.size();
-        }
+        pattern_fill(dest_ptr, fill_value.data(), fill_value.size(), start);
 
-        buff = dest_ptr + end * fill_value.size();
-        for (uint64_t i = 0; i < iter.cell_slab_length() - end; ++i) {
-          std::memcpy(buff, fill_value.data(), fill_value.size());
-          buff += fill_value.size();
-        }
+        pattern_fill(
+            dest_ptr + end * fill_value.size(),
+            fill_value.data(),
+            fill_value.size(),
+            iter.cell_slab_length() - end);
 
         if (nullable) {
           std::memset(dest_validity_ptr, fill_value_nullable, start);
@@ -1578,11 +1721,11 @@ Status DenseReader::copy_fixed_tiles(
 
     // Need to fill the whole slab.
     if (frag_domains.size() == 0) {
-      auto buff = dest_ptr;
-      for (uint64_t i = 0; i < iter.cell_slab_length(); ++i) {
-        std::memcpy(buff, fill_value.data(), fill_value.size());
-        buff += fill_value.size();
-      }
+      pattern_fill(
+          dest_ptr,
+          fill_value.data(),
+          fill_value.size(),
+          iter.cell_slab_length());
 
       if (nullable) {
         std::memset(
@@ -213,17 +213,37 @@ class DenseReader : public ReaderBase, public IQueryStrategy {
       const DynamicArray<Subarray>& tile_subarrays,
       ThreadPool::Task& compute_task);
 
-  /** Compute the result tiles to load for a name. */
+  /**
+   * Compute the result tiles to load for a name, with the inclusive range of
+   * tile cell positions covered by the tile subarray of each result tile. The
+   * cell ranges are passed to `unfilter_tiles` so that only the chunks
+   * covering the cells of the subarray get unfiltered.
+   */
   template <class DimType>
-  std::vector<ResultTile*> result_tiles_to_load(
+  tuple<std::vector<ResultTile*>, std::vector<std::pair<uint64_t, uint64_t>>>
+  result_tiles_to_load(
       const optional<std::string> name,
       const std::unordered_set<std::string>& condition_names,
       const Subarray& subarray,
       const uint64_t t_start,
       const uint64_t t_end,
+      const std::vector<DimType>& tile_extents,
       std::map<const DimType*, ResultSpaceTile<DimType>>& result_space_tiles,
       const DynamicArray<Subarray>& tile_subarrays) const;
 
+  /**
+   * Compute the inclusive range of tile cell positions that a tile subarray
+   * can touch, in the on-disk cell order of the tile. The bound is computed
+   * from the corners of the bounding box of the tile subarray ranges, which
+   * is valid as cell positions are monotonic in every coordinate for row and
+   * column major cell orders.
+   */
+  template <class DimType>
+  std::pair<uint64_t, uint64_t> tile_cell_range(
+      const std::vector<DimType>& tile_extents,
+      const ResultSpaceTile<DimType>& result_space_tile,
+      const Subarray& tile_subarray) const;
+
   /** Apply the query condition. */
   template <class DimType, class OffType>
   Status apply_query_condition(
@@ -185,12 +185,16 @@ class FilteredData {
 
     uint64_t tiles_allocated = 0;
 
-    // Store data on the datablock in progress for fixed, var and nullable data.
-    std::optional<unsigned> current_frag_idx{nullopt};
+    // Store data on the datablock in progress for fixed, var and nullable
+    // data. Each stream tracks its own fragment index as tiles can be left
+    // out of some of the streams when their contents are known.
+    std::optional<unsigned> current_fixed_frag_idx{nullopt};
     storage_size_t current_fixed_offset{0};
     storage_size_t current_fixed_size{0};
+    std::optional<unsigned> current_var_frag_idx{nullopt};
     storage_size_t current_var_offset{0};
     storage_size_t current_var_size{0};
+    std::optional<unsigned> current_nullable_frag_idx{nullopt};
     storage_size_t current_nullable_offset{0};
     storage_size_t current_nullable_size{0};
 
@@ -201,16 +205,26 @@ class FilteredData {
         continue;
       }
 
+      // Tiles proven all valid or all null by the tile null count metadata
+      // are synthesized by the reader instead of being read, see
+      // 'ReaderBase::read_tiles_no_wait'. Leave them out of the data blocks.
+      const bool skip_data{
+          !validity_only &&
+          reader.skip_data_tile_read(rt->frag_idx(), name, rt->tile_idx())};
+      const bool skip_validity{
+          nullable &&
+          reader.skip_validity_tile_read(rt->frag_idx(), name, rt->tile_idx())};
+
       // Make new blocks, if required as we go for fixed, var and nullable data.
       auto fragment{fragment_metadata[rt->frag_idx()].get()};
-      if (!validity_only) {
+      if (!validity_only && !skip_data) {
         tiles_allocated++;
         make_new_block_if_required(
             fragment,
             min_batch_size,
             max_batch_size,
             min_batch_gap,
-            current_frag_idx,
+            current_fixed_frag_idx,
             current_fixed_offset,
             current_fixed_size,
             rt,
@@ -224,46 +238,46 @@ class FilteredData {
             min_batch_size,
             max_batch_size,
             min_batch_gap,
-            current_frag_idx,
+            current_var_frag_idx,
             current_var_offset,
             current_var_size,
             rt,
             TileType::VAR);
       }
 
-      if (nullable) {
+      if (nullable && !skip_validity) {
         tiles_allocated++;
         make_new_block_if_required(
             fragment,
             min_batch_size,
             max_batch_size,
             min_batch_gap,
-            current_frag_idx,
+            current_nullable_frag_idx,
             current_nullable_offset,
             current_nullable_size,
             rt,
             TileType::NULLABLE);
       }
-
-      current_frag_idx = rt->frag_idx();
     }
 
     // Finish by pushing the last in progress blocks.
     if (current_fixed_size != 0) {
       fixed_data_blocks_.emplace_back(
-          *current_frag_idx, current_fixed_offset, current_fixed_size);
+          *current_fixed_frag_idx, current_fixed_offset, current_fixed_size);
       queue_last_block_for_read(TileType::FIXED);
     }
 
     if (current_var_size != 0) {
       var_data_blocks_.emplace_back(
-          *current_frag_idx, current_var_offset, current_var_size);
+          *current_var_frag_idx, current_var_offset, current_var_size);
       queue_last_block_for_read(TileType::VAR);
     }
 
     if (current_nullable_size != 0) {
       nullable_data_blocks_.emplace_back(
-          *current_frag_idx, current_nullable_offset, current_nullable_size);
+          *current_nullable_frag_idx,
+          current_nullable_offset,
+          current_nullable_size);
       queue_last_block_for_read(TileType::NULLABLE);
     }
 
@@ -290,7 +304,8 @@ class FilteredData {
    */
   inline void* fixed_filtered_data(
       const FragmentMetadata* fragment, const ResultTile* rt) {
-    auto offset{fragment->file_offset(name_, rt->tile_idx())};
+    auto offset{
+        offsets_view(fragment, TileType::FIXED).file_offset(rt->tile_idx())};
     ensure_data_block_current(TileType::FIXED, fragment, rt, offset);
     return current_data_block(TileType::FIXED)->data_at(offset);
   }
@@ -308,7 +323,8 @@ class FilteredData {
       return nullptr;
     }
 
-    auto offset{fragment->file_var_offset(name_, rt->tile_idx())};
+    auto offset{
+        offsets_view(fragment, TileType::VAR).file_offset(rt->tile_idx())};
     ensure_data_block_current(TileType::VAR, fragment, rt, offset);
     return current_data_block(TileType::VAR)->data_at(offset);
   }
@@ -326,7 +342,8 @@ class FilteredData {
       return nullptr;
     }
 
-    auto offset{fragment->file_validity_offset(name_, rt->tile_idx())};
+    auto offset{offsets_view(fragment, TileType::NULLABLE)
+                    .file_offset(rt->tile_idx())};
     ensure_data_block_current(TileType::NULLABLE, fragment, rt, offset);
     return current_data_block(TileType::NULLABLE)->data_at(offset);
   }
@@ -393,48 +410,40 @@ class FilteredData {
   }
 
   /**
-   * Get the file offset for the tile type.
+   * Get the resolved offsets view for the tile type, refreshing the cached
+   * views when the fragment changes. Result tiles are processed in fragment
+   * order, so each fragment's offset tables are resolved only once and all
+   * per-tile lookups are gathered from the contiguous offsets arrays.
    *
    * @param fragment Fragment metadata for the tile.
    * @param type Tile type.
-   * @param tile_idx Tile index.
-   * @return File offset.
+   * @return Offsets view.
    */
-  inline storage_size_t file_offset(
-      const FragmentMetadata* fragment,
-      const TileType type,
-      const uint64_t tile_idx) {
-    switch (type) {
-      case TileType::FIXED:
-        return fragment->file_offset(name_, tile_idx);
-      case TileType::VAR:
-        return fragment->file_var_offset(name_, tile_idx);
-      case TileType::NULLABLE:
-        return fragment->file_validity_offset(name_, tile_idx);
-      default:
-        throw std::logic_error("Unexpected");
+  inline const FragmentMetadata::OffsetsView& offsets_view(
+      const FragmentMetadata* fragment, const TileType type) {
+    if (fragment != views_fragment_) {
+      fixed_offsets_view_.reset();
+      var_offsets_view_.reset();
+      nullable_offsets_view_.reset();
+      views_fragment_ = fragment;
     }
-  }
 
-  /**
-   * Get the tile persisted size for the tile type.
-   *
-   * @param fragment Fragment metadata for the tile.
-   * @param idx Tile type.
-   * @param tile_idx Tile index.
-   * @return Tile persisted size.
-   */
-  inline storage_size_t persisted_tile_size(
-      const FragmentMetadata* fragment,
-      const TileType type,
-      const uint64_t tile_idx) {
     switch (type) {
       case TileType::FIXED:
-        return fragment->persisted_tile_size(name_, tile_idx);
+        if (!fixed_offsets_view_.has_value()) {
+          fixed_offsets_view_ = fragment->tile_offsets_view(name_);
+        }
+        return *fixed_offsets_view_;
       case TileType::VAR:
-        return fragment->persisted_tile_var_size(name_, tile_idx);
+        if (!var_offsets_view_.has_value()) {
+          var_offsets_view_ = fragment->tile_var_offsets_view(name_);
+        }
+        return *var_offsets_view_;
       case TileType::NULLABLE:
-        return fragment->persisted_tile_validity_size(name_, tile_idx);
+        if (!nullable_offsets_view_.has_value()) {
+          nullable_offsets_view_ = fragment->tile_validity_offsets_view(name_);
+        }
+        return *nullable_offsets_view_;
       default:
         throw std::logic_error("Unexpected");
     }
@@ -478,7 +487,8 @@ class FilteredData {
    * @param max_batch_size Maximum batch size to create.
    * @param min_batch_gap Min gap between tiles we can tolerate in the data
    * block.
-   * @param current_frag_idx Current fragment index for the data blocks.
+   * @param current_block_frag_idx Current fragment index for the in progress
+   * block, updated to the fragment index of the new tile.
    * @param current_block_offset Current block offset.
    * @param current_block_size Current block size.
    * @param frag_idx Fragment index for the new tile.
@@ -491,16 +501,18 @@ class FilteredData {
       const uint64_t min_batch_size,
       const uint64_t max_batch_size,
       const uint64_t min_batch_gap,
-      optional<unsigned> current_block_frag_idx,
+      optional<unsigned>& current_block_frag_idx,
       storage_size_t& current_block_offset,
       storage_size_t& current_block_size,
       const ResultTile* rt,
       const TileType type) {
     const auto tile_idx{rt->tile_idx()};
-    storage_size_t offset{file_offset(fragment, type, tile_idx)};
-    storage_size_t size{persisted_tile_size(fragment, type, tile_idx)};
+    const auto& view{offsets_view(fragment, type)};
+    storage_size_t offset{view.file_offset(tile_idx)};
+    storage_size_t size{view.persisted_tile_size(tile_idx)};
 
     if (current_block_frag_idx == nullopt) {
+      current_block_frag_idx = rt->frag_idx();
       current_block_offset = offset;
       current_block_size = size;
       return;
@@ -518,6 +530,7 @@ class FilteredData {
       data_blocks(type).emplace_back(
           *current_block_frag_idx, current_block_offset, current_block_size);
       queue_last_block_for_read(type);
+      current_block_frag_idx = rt->frag_idx();
       current_block_offset = offset;
       current_block_size = size;
     }
@@ -537,7 +550,8 @@ class FilteredData {
       const FragmentMetadata* fragment,
       const ResultTile* rt,
       const storage_size_t offset) {
-    storage_size_t size{persisted_tile_size(fragment, type, rt->tile_idx())};
+    storage_size_t size{
+        offsets_view(fragment, type).persisted_tile_size(rt->tile_idx())};
 
     auto& current_block{current_data_block(type)};
     if (!current_block->contains(rt->frag_idx(), offset, size)) {
@@ -572,6 +586,18 @@ class FilteredData {
   /** Current nullable data block used when creating nullable tiles. */
   std::vector<FilteredDataBlock>::iterator current_nullable_data_block_;
 
+  /** Fragment for which the cached offset views below were resolved. */
+  const FragmentMetadata* views_fragment_ = nullptr;
+
+  /** Resolved fixed offsets view for the current fragment. */
+  optional<FragmentMetadata::OffsetsView> fixed_offsets_view_;
+
+  /** Resolved var offsets view for the current fragment. */
+  optional<FragmentMetadata::OffsetsView> var_offsets_view_;
+
+  /** Resolved validity offsets view for the current fragment. */
+  optional<FragmentMetadata::OffsetsView> nullable_offsets_view_;
+
   /** Name of the attribute. */
   const std::string& name_;
 
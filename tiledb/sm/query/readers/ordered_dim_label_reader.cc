@@ -404,46 +404,71 @@ OrderedDimLabelReader::get_array_tile_indexes_for_range(
     }
   }
 
+  // The labels are ordered inside of the fragment, so the per-tile min/max
+  // values loaded in the fragment metadata are monotonic with the tile index
+  // and the tile containing a range value can be located with a binary search
+  // over them, without any tile IO.
+
   // If the start range is included, find in which tile.
   if (start_val_type == IndexValueType::CONTAINED) {
+    uint64_t left = 0, right = tile_num - 1;
     if (increasing_labels_) {
-      for (; start_index < tile_num; start_index++) {
-        const auto max = fragment_metadata_[f]->get_tile_max_as<LabelType>(
-            label_name_, start_index);
+      // Find the first tile with a max greater than or equal to the start.
+      while (left < right) {
+        const uint64_t mid = left + (right - left) / 2;
+        const auto max =
+            fragment_metadata_[f]->get_tile_max_as<LabelType>(label_name_, mid);
         if (max >= start_range) {
-          break;
+          right = mid;
+        } else {
+          left = mid + 1;
         }
       }
     } else {
-      for (;; start_index--) {
-        const auto max = fragment_metadata_[f]->get_tile_max_as<LabelType>(
-            label_name_, start_index);
-        if (start_index == 0 || max >= start_range) {
-          break;
+      // Find the last tile with a max greater than or equal to the start.
+      while (left < right) {
+        const uint64_t mid = left + (right - left + 1) / 2;
+        const auto max =
+            fragment_metadata_[f]->get_tile_max_as<LabelType>(label_name_, mid);
+        if (max >= start_range) {
+          left = mid;
+        } else {
+          right = mid - 1;
         }
       }
     }
+    start_index = left;
   }
 
   // If the end range is included, find in which tile.
   if (end_val_type == IndexValueType::CONTAINED) {
+    uint64_t left = 0, right = tile_num - 1;
     if (increasing_labels_) {
-      for (;; end_index--) {
-        const auto min = fragment_metadata_[f]->get_tile_min_as<LabelType>(
-            label_name_, end_index);
-        if (end_index == 0 || min <= end_range) {
-          break;
+      // Find the last tile with a min less than or equal to the end.
+      while (left < right) {
+        const uint64_t mid = left + (right - left + 1) / 2;
+        const auto min =
+            fragment_metadata_[f]->get_tile_min_as<LabelType>(label_name_, mid);
+        if (min <= end_range) {
+          left = mid;
+        } else {
+          right = mid - 1;
         }
       }
     } else {
-      for (; end_index < tile_num; end_index++) {
-        const auto min = fragment_metadata_[f]->get_tile_min_as<LabelType>(
-            label_name_, end_index);
+      // Find the first tile with a min less than or equal to the end.
+      while (left < right) {
+        const uint64_t mid = left + (right - left) / 2;
+        const auto min =
+            fragment_metadata_[f]->get_tile_min_as<LabelType>(label_name_, mid);
         if (min <= end_range) {
-          break;
+          right = mid;
+        } else {
+          left = mid + 1;
         }
       }
     }
+    end_index = left;
   }
 
   return FragmentRangeTileIndexes(
@@ -32,13 +32,16 @@
 
 #include "tiledb/sm/query/readers/reader_base.h"
 #include "tiledb/common/logger.h"
+#include "tiledb/common/trace_ring.h"
 #include "tiledb/sm/array/array.h"
 #include "tiledb/sm/array_schema/array_schema.h"
+#include "tiledb/sm/cache/unfiltered_tile_cache.h"
 #include "tiledb/sm/enums/encryption_type.h"
 #include "tiledb/sm/enums/filter_type.h"
 #include "tiledb/sm/enums/query_condition_combination_op.h"
 #include "tiledb/sm/enums/query_condition_op.h"
 #include "tiledb/sm/filesystem/vfs.h"
+#include "tiledb/sm/filter/checksum_sha256_filter.h"
 #include "tiledb/sm/filter/compression_filter.h"
 #include "tiledb/sm/fragment/fragment_metadata.h"
 #include "tiledb/sm/misc/comparators.h"
@@ -53,6 +56,7 @@
 #include "tiledb/sm/query/strategy_base.h"
 #include "tiledb/sm/query/writers/domain_buffer.h"
 #include "tiledb/sm/subarray/subarray.h"
+#include "tiledb/sm/tile/tile_metadata_generator.h"
 #include "tiledb/type/apply_with_type.h"
 
 namespace tiledb {
@@ -97,9 +101,15 @@ ReaderBase::ReaderBase(
     , use_timestamps_(false)
     , initial_data_loaded_(false)
     , max_batch_size_(config.get<uint64_t>("vfs.max_batch_size").value())
+    , io_priority_(ThreadPool::Priority::NORMAL)
     , min_batch_gap_(config.get<uint64_t>("vfs.min_batch_gap").value())
     , min_batch_size_(config.get<uint64_t>("vfs.min_batch_size").value())
     , aggregate_buffers_(aggregate_buffers) {
+  if (storage_manager != nullptr) {
+    // Charge this query's memory to the context budget as well.
+    query_memory_tracker_.set_parent(storage_manager->memory_tracker());
+  }
+
   if (array != nullptr)
     fragment_metadata_ = array->fragment_metadata();
   timestamps_needed_for_deletes_and_updates_.resize(fragment_metadata_.size());
@@ -110,14 +120,100 @@ ReaderBase::ReaderBase(
         "global order query.");
   }
 
+  const auto priority =
+      config.get<std::string>("sm.query.priority", Config::must_find);
+  if (priority == "background") {
+    io_priority_ = ThreadPool::Priority::BACKGROUND;
+  } else if (priority != "normal") {
+    throw ReaderBaseStatusException(
+        "Cannot initialize reader; Unknown 'sm.query.priority' value: " +
+        priority);
+  }
+
   // Validate the aggregates and store the requested aggregates by field name.
   for (auto& aggregate : default_channel_aggregates) {
     aggregate.second->validate_output_buffer(
         aggregate.first, aggregate_buffers_);
     aggregates_[aggregate.second->field_name()].emplace_back(aggregate.second);
   }
+
+  if (storage_manager != nullptr &&
+      config.get<bool>("sm.deferred_checksum_validation", Config::must_find)) {
+    deferred_checksum_group_.emplace(*storage_manager->compute_tp());
+  }
+}
+
+namespace {
+
+/**
+ * Returns `true` if the rectangles in `covering` jointly cover `region`,
+ * both given as flat `[low, high]` pairs per dimension. The check
+ * iteratively subtracts each covering rectangle from a list of
+ * not-yet-covered boxes; the work is capped, so for pathological
+ * rectangle arrangements the function conservatively returns `false`.
+ */
+template <class T>
+bool jointly_covered(
+    std::vector<T> region,
+    const std::vector<std::vector<T>>& covering,
+    unsigned dim_num) {
+  // Boxes of the region not yet covered by a rectangle.
+  std::vector<std::vector<T>> uncovered;
+  uncovered.emplace_back(std::move(region));
+
+  // Cap on the number of boxes tracked while splitting.
+  constexpr size_t max_boxes = 64;
+
+  for (const auto& c : covering) {
+    std::vector<std::vector<T>> next;
+    for (auto& box : uncovered) {
+      // Keep the box as is if it does not intersect the rectangle.
+      bool intersects = true;
+      for (unsigned d = 0; d < dim_num; d++) {
+        if (c[2 * d] > box[2 * d + 1] || c[2 * d + 1] < box[2 * d]) {
+          intersects = false;
+          break;
+        }
+      }
+      if (!intersects) {
+        next.emplace_back(std::move(box));
+        continue;
+      }
+
+      // Split the box around the rectangle, keeping the parts outside
+      // of it. What remains of `rest` after all splits lies inside the
+      // rectangle and is covered.
+      auto rest = std::move(box);
+      for (unsigned d = 0; d < dim_num; d++) {
+        if (c[2 * d] > rest[2 * d]) {
+          auto part = rest;
+          part[2 * d + 1] = c[2 * d] - 1;
+          next.emplace_back(std::move(part));
+          rest[2 * d] = c[2 * d];
+        }
+        if (c[2 * d + 1] < rest[2 * d + 1]) {
+          auto part = rest;
+          part[2 * d] = c[2 * d + 1] + 1;
+          next.emplace_back(std::move(part));
+          rest[2 * d + 1] = c[2 * d + 1];
+        }
+      }
+    }
+
+    uncovered.swap(next);
+    if (uncovered.empty()) {
+      return true;
+    }
+    if (uncovered.size() > max_boxes) {
+      return false;
+    }
+  }
+
+  return uncovered.empty();
 }
 
+}  // namespace
+
 /* ********************************* */
 /*          STATIC FUNCTIONS         */
 /* ********************************* */
@@ -151,14 +247,29 @@ void ReaderBase::compute_result_space_tiles(
       if (!frag_tile_domains[f].in_tile_domain(coords))
         continue;
 
-      // Check if any previous fragment covers this fragment
+      // Check if any previous (newer) fragment covers this fragment
       // for the tile identified by `coords`
       bool covered = false;
+      std::vector<std::vector<T>> newer_overlaps;
       for (unsigned j = 0; j < f; ++j) {
         if (frag_tile_domains[j].covers(coords, frag_tile_domains[f])) {
           covered = true;
           break;
         }
+
+        if (frag_tile_domains[j].in_tile_domain(coords))
+          newer_overlaps.emplace_back(
+              frag_tile_domains[j].tile_overlap(coords));
+      }
+
+      // No single newer fragment covers this one within the tile; check
+      // whether the newer fragments jointly overwrite it, e.g. when
+      // striped updates split the tile between them.
+      if (!covered && newer_overlaps.size() > 1) {
+        covered = jointly_covered<T>(
+            frag_tile_domains[f].tile_overlap(coords),
+            newer_overlaps,
+            dim_num);
       }
 
       // Exclude this fragment from the space tile
@@ -217,6 +328,36 @@ bool ReaderBase::skip_field(
   return false;
 }
 
+bool ReaderBase::skip_validity_tile_read(
+    const unsigned frag_idx,
+    const std::string& name,
+    const uint64_t tile_idx) const {
+  auto& fragment{fragment_metadata_[frag_idx]};
+  if (!fragment->has_tile_null_count(name)) {
+    return false;
+  }
+
+  const auto null_count{fragment->get_tile_null_count(name, tile_idx)};
+  return null_count == 0 || null_count == fragment->cell_num(tile_idx);
+}
+
+bool ReaderBase::skip_data_tile_read(
+    const unsigned frag_idx,
+    const std::string& name,
+    const uint64_t tile_idx) const {
+  if (array_schema_.var_size(name)) {
+    return false;
+  }
+
+  auto& fragment{fragment_metadata_[frag_idx]};
+  if (!fragment->has_tile_null_count(name)) {
+    return false;
+  }
+
+  return fragment->get_tile_null_count(name, tile_idx) ==
+         fragment->cell_num(tile_idx);
+}
+
 /* ****************************** */
 /*        PROTECTED METHODS       */
 /* ****************************** */
@@ -227,6 +368,56 @@ bool ReaderBase::process_partial_timestamps(FragmentMetadata& frag_meta) const {
              array_->timestamp_start(), array_->timestamp_end_opened_at());
 }
 
+bool ReaderBase::timestamps_within_open_range(
+    const FragmentMetadata& frag_meta, uint64_t tile_idx) const {
+  if (!frag_meta.has_tile_metadata() ||
+      !frag_meta.tile_min_max_loaded(constants::timestamps)) {
+    return false;
+  }
+
+  const auto min =
+      frag_meta.get_tile_min_as<uint64_t>(constants::timestamps, tile_idx);
+  const auto max =
+      frag_meta.get_tile_max_as<uint64_t>(constants::timestamps, tile_idx);
+  return min >= array_->timestamp_start() &&
+         max <= array_->timestamp_end_opened_at();
+}
+
+void ReaderBase::pattern_fill(
+    void* dest, const void* pattern, uint64_t cell_size, uint64_t num) {
+  if (num == 0) {
+    return;
+  }
+
+  const uint64_t total = num * cell_size;
+  const auto pattern_bytes = static_cast<const uint8_t*>(pattern);
+
+  // Most fill values repeat a single byte (zeros, 0xFF integral fills);
+  // expand those with a plain memset.
+  bool single_byte = true;
+  for (uint64_t i = 1; i < cell_size; i++) {
+    if (pattern_bytes[i] != pattern_bytes[0]) {
+      single_byte = false;
+      break;
+    }
+  }
+  if (single_byte) {
+    memset(dest, pattern_bytes[0], total);
+    return;
+  }
+
+  // Otherwise write the pattern once and double the filled region with
+  // bulk copies until the output is covered.
+  auto dest_bytes = static_cast<uint8_t*>(dest);
+  memcpy(dest_bytes, pattern_bytes, cell_size);
+  uint64_t filled = cell_size;
+  while (filled < total) {
+    const uint64_t to_copy = std::min(filled, total - filled);
+    memcpy(dest_bytes + filled, dest_bytes, to_copy);
+    filled += to_copy;
+  }
+}
+
 void ReaderBase::clear_tiles(
     const std::string& name,
     const std::vector<ResultTile*>& result_tiles,
@@ -511,6 +702,12 @@ void ReaderBase::load_tile_metadata(
   auto timer_se = stats_->start_timer("load_tile_metadata");
   const auto encryption_key = array_->encryption_key();
 
+  // Condition fields are loaded so that tiles that cannot possibly satisfy
+  // the condition can be skipped from their min/max values and null counts.
+  static const std::unordered_set<std::string> no_condition_fields;
+  const auto& condition_fields =
+      condition_.has_value() ? condition_->field_names() : no_condition_fields;
+
   throw_if_not_ok(parallel_for(
       storage_manager_->compute_tp(),
       0,
@@ -519,9 +716,18 @@ void ReaderBase::load_tile_metadata(
         auto frag_idx = relevant_fragments[i];
         auto& fragment = fragment_metadata_[frag_idx];
 
-        // Generate the list of name with aggregates.
+        // Generate the list of names to load, per metadata kind. Min/max
+        // values are loaded for condition fields and for fields with
+        // aggregates that consume them, sums only for the aggregates that
+        // consume them, plus the null counts for every nullable field:
+        // condition pruning and aggregates need them to discount null cells
+        // and the tile read path uses them to skip validity and data I/O
+        // for no-null and all-null tiles.
         const auto& schema = fragment->array_schema();
-        std::vector<std::string> to_load;
+        std::vector<std::string> min_max_to_load;
+        std::vector<std::string> sum_to_load;
+        std::vector<std::string> null_count_to_load;
+        std::vector<std::string> bloom_filter_to_load;
         for (auto& n : names) {
           // Not a member of array schema, this field was added in array
           // schema evolution, ignore for this fragment's tile metadata.
@@ -529,15 +735,65 @@ void ReaderBase::load_tile_metadata(
             continue;
           }
 
-          if (aggregates_.count(n) != 0) {
-            to_load.emplace_back(n);
+          const bool condition_field = condition_fields.count(n) != 0;
+          bool min_max = condition_field;
+          bool sum = false;
+          auto aggregates = aggregates_.find(n);
+          if (aggregates != aggregates_.end()) {
+            for (auto& aggregate : aggregates->second) {
+              min_max |= aggregate->need_min_max_metadata();
+              sum |= aggregate->need_sum_metadata();
+            }
+          } else if (!min_max && !schema->is_nullable(n)) {
+            continue;
+          }
+
+          if (min_max) {
+            min_max_to_load.emplace_back(n);
+          }
+
+          if (sum) {
+            sum_to_load.emplace_back(n);
+          }
+
+          if (schema->is_nullable(n)) {
+            null_count_to_load.emplace_back(n);
           }
+
+          if (condition_field &&
+              TileMetadataGenerator::has_bloom_filter_metadata(
+                  schema->type(n),
+                  schema->is_dim(n),
+                  schema->var_size(n),
+                  schema->cell_val_num(n))) {
+            bloom_filter_to_load.emplace_back(n);
+          }
+        }
+
+        // For fragments that only partially overlap the open timestamp
+        // range, the timestamps min/max lets tiles that lie fully inside
+        // the range skip the per-cell partial overlap condition.
+        if (process_partial_timestamps(*fragment) &&
+            fragment->has_tile_metadata()) {
+          min_max_to_load.emplace_back(constants::timestamps);
         }
 
-        fragment->load_tile_max_values(*encryption_key, to_load);
-        fragment->load_tile_min_values(*encryption_key, to_load);
-        fragment->load_tile_sum_values(*encryption_key, to_load);
-        fragment->load_tile_null_count_values(*encryption_key, to_load);
+        // Fetch all the needed metadata tiles of this fragment with one
+        // vectored read before deserializing them below.
+        fragment->prefetch_tile_metadata(
+            *encryption_key,
+            min_max_to_load,
+            sum_to_load,
+            null_count_to_load,
+            bloom_filter_to_load);
+
+        fragment->load_tile_max_values(*encryption_key, min_max_to_load);
+        fragment->load_tile_min_values(*encryption_key, min_max_to_load);
+        fragment->load_tile_sum_values(*encryption_key, sum_to_load);
+        fragment->load_tile_null_count_values(
+            *encryption_key, null_count_to_load);
+        fragment->load_tile_bloom_filter_values(
+            *encryption_key, bloom_filter_to_load);
 
         return Status::Ok();
       }));
@@ -563,6 +819,69 @@ void ReaderBase::load_processed_conditions() {
       }));
 }
 
+uint64_t ReaderBase::tiles_filtered_size(
+    const std::vector<NameToLoad>& names,
+    const std::vector<ResultTile*>& result_tiles) const {
+  uint64_t size = 0;
+  for (const auto& name : names) {
+    const auto var_size = array_schema_.var_size(name.name());
+    const auto nullable = array_schema_.is_nullable(name.name());
+    for (const auto rt : result_tiles) {
+      if (skip_field(rt->frag_idx(), name.name())) {
+        continue;
+      }
+
+      const auto fragment = fragment_metadata_[rt->frag_idx()].get();
+      const auto tile_idx = rt->tile_idx();
+      if (!name.validity_only() &&
+          !skip_data_tile_read(rt->frag_idx(), name.name(), tile_idx)) {
+        size += fragment->persisted_tile_size(name.name(), tile_idx);
+        if (var_size) {
+          size += fragment->persisted_tile_var_size(name.name(), tile_idx);
+        }
+      }
+
+      if (nullable &&
+          !skip_validity_tile_read(rt->frag_idx(), name.name(), tile_idx)) {
+        size += fragment->persisted_tile_validity_size(name.name(), tile_idx);
+      }
+    }
+  }
+
+  return size;
+}
+
+bool ReaderBase::throttle_tile_reads(const uint64_t size) const {
+  constexpr auto mem_type = MemoryTracker::MemoryType::TILE_DATA;
+  if (size == 0) {
+    return false;
+  }
+
+  if (query_memory_tracker_.take_memory(size, mem_type)) {
+    return true;
+  }
+
+  // A batch larger than a budget can never fit; proceed unthrottled rather
+  // than failing the query.
+  if (!query_memory_tracker_.can_fit(size, mem_type)) {
+    return false;
+  }
+
+  // The budgets are exhausted but the batch fits, wait for other queries
+  // to release memory before issuing the reads.
+  auto timer_se = stats_->start_timer("backpressure_wait");
+  stats_->add_counter("backpressure_wait_num", 1);
+  common::TraceRing::instance().record("backpressure_wait: size={}", size);
+  while (!query_memory_tracker_.take_memory_wait(size, mem_type, 100)) {
+    // Budgets can shrink while waiting, re-check that waiting can succeed.
+    if (!query_memory_tracker_.can_fit(size, mem_type)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 Status ReaderBase::read_and_unfilter_attribute_tiles(
     const std::vector<NameToLoad>& names,
     const std::vector<ResultTile*>& result_tiles) const {
@@ -581,13 +900,63 @@ Status ReaderBase::read_and_unfilter_attribute_tiles(
   // eventually get rid of it altogether so that we can clarify the data flow.
   // At the end of this function call, all memory inside of 'filtered_data' has
   // been used and the tiles are unfiltered so the data can be deleted.
-  auto filtered_data{read_attribute_tiles(names, result_tiles)};
-  for (auto& name : names) {
-    RETURN_NOT_OK(
-        unfilter_tiles(name.name(), name.validity_only(), result_tiles));
+  if (storage_manager_->tile_cache()->enabled()) {
+    // Probe the unfiltered tile cache per field and only read and unfilter
+    // the misses, inserting their payloads back into the cache. The misses
+    // are timed so the cache eviction policy can weigh how expensive each
+    // payload would be to refetch.
+    for (auto& name : names) {
+      std::vector<ResultTile*> misses;
+      cached_tiles_lookup(
+          name.name(), name.validity_only(), result_tiles, misses);
+      auto t_start = std::chrono::steady_clock::now();
+      auto filtered_data{read_attribute_tiles({name}, misses)};
+      RETURN_NOT_OK(unfilter_tiles(name.name(), name.validity_only(), misses));
+      const uint64_t cost_ns =
+          std::chrono::duration_cast<std::chrono::nanoseconds>(
+              std::chrono::steady_clock::now() - t_start)
+              .count();
+      cached_tiles_insert(name.name(), name.validity_only(), misses, cost_ns);
+    }
+
+    return Status::Ok();
   }
 
-  return Status::Ok();
+  // Backpressure: charge the filtered data about to be allocated to the
+  // query memory tracker, waiting for other queries when the context
+  // budget is exhausted instead of overshooting it.
+  const uint64_t filtered_size = tiles_filtered_size(names, result_tiles);
+  const bool charged = throttle_tile_reads(filtered_size);
+
+  // Schedule the reads for all fields up front, then unfilter each field
+  // as soon as its own reads complete. This overlaps the I/O latency of
+  // the remaining fields with the unfiltering CPU work instead of waiting
+  // on the slowest field before unfiltering can start. On error, we still
+  // wait on the remaining reads since they write into 'filtered_data'.
+  auto timer_se = stats_->start_timer("read_attribute_tiles");
+  std::vector<std::vector<ThreadPool::Task>> read_tasks;
+  auto filtered_data{read_tiles_no_wait(names, result_tiles, read_tasks)};
+  Status st = Status::Ok();
+  for (uint64_t n = 0; n < read_tasks.size(); n++) {
+    auto statuses{storage_manager_->io_tp()->wait_all_status(read_tasks[n])};
+    for (const auto& read_st : statuses) {
+      if (!read_st.ok() && st.ok()) {
+        st = read_st;
+      }
+    }
+
+    if (st.ok()) {
+      st = unfilter_tiles(
+          names[n].name(), names[n].validity_only(), result_tiles);
+    }
+  }
+
+  if (charged) {
+    query_memory_tracker_.release_memory(
+        filtered_size, MemoryTracker::MemoryType::TILE_DATA);
+  }
+
+  return st;
 }
 
 Status ReaderBase::read_and_unfilter_coordinate_tiles(
@@ -595,12 +964,202 @@ Status ReaderBase::read_and_unfilter_coordinate_tiles(
     const std::vector<ResultTile*>& result_tiles) const {
   // See the comment in 'read_and_unfilter_attribute_tiles' to get more
   // information about the lifetime of this object.
-  auto filtered_data{read_coordinate_tiles(names, result_tiles)};
-  for (auto& name : names) {
-    RETURN_NOT_OK(unfilter_tiles(name, false, result_tiles));
+  if (storage_manager_->tile_cache()->enabled()) {
+    // See the comment in 'read_and_unfilter_attribute_tiles' for details on
+    // the cached path.
+    for (auto& name : names) {
+      std::vector<ResultTile*> misses;
+      cached_tiles_lookup(name, false, result_tiles, misses);
+      auto t_start = std::chrono::steady_clock::now();
+      auto filtered_data{read_coordinate_tiles({name}, misses)};
+      RETURN_NOT_OK(unfilter_tiles(name, false, misses));
+      const uint64_t cost_ns =
+          std::chrono::duration_cast<std::chrono::nanoseconds>(
+              std::chrono::steady_clock::now() - t_start)
+              .count();
+      cached_tiles_insert(name, false, misses, cost_ns);
+    }
+
+    return Status::Ok();
   }
 
-  return Status::Ok();
+  // Backpressure, see 'read_and_unfilter_attribute_tiles'.
+  const auto names_to_load = NameToLoad::from_string_vec(names);
+  const uint64_t filtered_size =
+      tiles_filtered_size(names_to_load, result_tiles);
+  const bool charged = throttle_tile_reads(filtered_size);
+
+  // See the comment in 'read_and_unfilter_attribute_tiles' for details on
+  // the read/unfilter pipelining.
+  auto timer_se = stats_->start_timer("read_coordinate_tiles");
+  std::vector<std::vector<ThreadPool::Task>> read_tasks;
+  auto filtered_data{
+      read_tiles_no_wait(names_to_load, result_tiles, read_tasks)};
+  Status st = Status::Ok();
+  for (uint64_t n = 0; n < read_tasks.size(); n++) {
+    auto statuses{storage_manager_->io_tp()->wait_all_status(read_tasks[n])};
+    for (const auto& read_st : statuses) {
+      if (!read_st.ok() && st.ok()) {
+        st = read_st;
+      }
+    }
+
+    if (st.ok()) {
+      st = unfilter_tiles(names[n], false, result_tiles);
+    }
+  }
+
+  if (charged) {
+    query_memory_tracker_.release_memory(
+        filtered_size, MemoryTracker::MemoryType::TILE_DATA);
+  }
+
+  return st;
+}
+
+void ReaderBase::cached_tiles_lookup(
+    const std::string& name,
+    const bool validity_only,
+    const std::vector<ResultTile*>& result_tiles,
+    std::vector<ResultTile*>& misses) const {
+  auto tile_cache = storage_manager_->tile_cache();
+  const bool var_sized{array_schema_.var_size(name)};
+  const bool nullable{array_schema_.is_nullable(name)};
+
+  uint64_t num_hits{0};
+  for (auto tile : result_tiles) {
+    // Fields skipped for a fragment never get tiles created for them, see
+    // 'read_tiles'. Forward them to the miss list so that the read path can
+    // apply the same logic.
+    if (skip_field(tile->frag_idx(), name)) {
+      misses.emplace_back(tile);
+      continue;
+    }
+
+    auto const fragment{fragment_metadata_[tile->frag_idx()]};
+    const auto tile_idx{tile->tile_idx()};
+    shared_ptr<UnfilteredTilePayload> payload;
+    if (!tile_cache->lookup(
+            UnfilteredTileCache::key(
+                fragment->fragment_uri(), name, tile_idx, validity_only),
+            &payload)) {
+      misses.emplace_back(tile);
+      continue;
+    }
+    num_hits++;
+
+    // Initialize the tile(s) with no filtered data, exactly as 'read_tiles'
+    // does for tiles read from storage.
+    ResultTile::TileSizes tile_sizes{
+        fragment, name, var_sized, nullable, validity_only, tile_idx};
+    ResultTile::TileData tile_data{nullptr, nullptr, nullptr};
+    const format_version_t format_version{fragment->format_version()};
+    const auto& array_schema{fragment->array_schema()};
+    if (array_schema->is_dim(name)) {
+      const uint64_t dim_num{array_schema->dim_num()};
+      for (uint64_t d = 0; d < dim_num; ++d) {
+        if (array_schema->dimension_ptr(d)->name() == name) {
+          tile->init_coord_tile(
+              format_version, array_schema_, name, tile_sizes, tile_data, d);
+          break;
+        }
+      }
+    } else {
+      tile->init_attr_tile(
+          format_version, array_schema_, name, tile_sizes, tile_data);
+    }
+
+    // Restore the unfiltered payload and clear the filtered state so that
+    // the tiles are skipped by the unfiltering path, exactly like tiles
+    // that were already unfiltered.
+    auto tile_tuple = tile->tile_tuple(name);
+    auto& t = tile_tuple->fixed_tile();
+    if (!payload->fixed_.empty()) {
+      t.write(payload->fixed_.data(), 0, payload->fixed_.size());
+    }
+    t.clear_filtered_buffer();
+
+    if (var_sized && !validity_only) {
+      auto& t_var = tile_tuple->var_tile();
+      if (!payload->var_.empty()) {
+        t_var.write(payload->var_.data(), 0, payload->var_.size());
+      }
+      t_var.clear_filtered_buffer();
+    }
+
+    if (nullable) {
+      auto& t_validity = tile_tuple->validity_tile();
+      if (!payload->validity_.empty()) {
+        t_validity.write(
+            payload->validity_.data(), 0, payload->validity_.size());
+      }
+      t_validity.clear_filtered_buffer();
+    }
+  }
+
+  stats_->add_counter("tile_cache_hit_num", num_hits);
+  stats_->add_counter("tile_cache_miss_num", misses.size());
+}
+
+void ReaderBase::cached_tiles_insert(
+    const std::string& name,
+    const bool validity_only,
+    const std::vector<ResultTile*>& result_tiles,
+    const uint64_t cost_ns) const {
+  auto tile_cache = storage_manager_->tile_cache();
+  const bool var_sized{array_schema_.var_size(name)};
+  const bool nullable{array_schema_.is_nullable(name)};
+
+  // Build the payloads first so the measured read and unfilter time can be
+  // apportioned to them by size before insertion.
+  std::vector<std::pair<std::string, shared_ptr<UnfilteredTilePayload>>>
+      payloads;
+  payloads.reserve(result_tiles.size());
+  uint64_t total_bytes{0};
+  for (auto tile : result_tiles) {
+    if (skip_field(tile->frag_idx(), name)) {
+      continue;
+    }
+
+    // Skip non-existent attributes/dimensions (e.g. coords in the
+    // dense case).
+    auto tile_tuple = tile->tile_tuple(name);
+    if (tile_tuple == nullptr) {
+      continue;
+    }
+
+    auto payload = make_shared<UnfilteredTilePayload>(HERE());
+    if (!validity_only) {
+      auto& t = tile_tuple->fixed_tile();
+      payload->fixed_.resize(t.size());
+      t.read(payload->fixed_.data(), 0, t.size());
+
+      if (var_sized) {
+        auto& t_var = tile_tuple->var_tile();
+        payload->var_.resize(t_var.size());
+        t_var.read(payload->var_.data(), 0, t_var.size());
+      }
+    }
+
+    if (nullable) {
+      auto& t_validity = tile_tuple->validity_tile();
+      payload->validity_.resize(t_validity.size());
+      t_validity.read(payload->validity_.data(), 0, t_validity.size());
+    }
+
+    total_bytes += payload->size();
+    auto const fragment{fragment_metadata_[tile->frag_idx()]};
+    payloads.emplace_back(
+        UnfilteredTileCache::key(
+            fragment->fragment_uri(), name, tile->tile_idx(), validity_only),
+        std::move(payload));
+  }
+
+  for (auto& [key, payload] : payloads) {
+    payload->cost_ns_ =
+        total_bytes == 0 ? cost_ns : cost_ns * payload->size() / total_bytes;
+    tile_cache->insert_payload(key, std::move(payload));
+  }
 }
 
 std::vector<FilteredData> ReaderBase::read_attribute_tiles(
@@ -621,6 +1180,24 @@ std::vector<FilteredData> ReaderBase::read_tiles(
     const std::vector<NameToLoad>& names,
     const std::vector<ResultTile*>& result_tiles) const {
   auto timer_se = stats_->start_timer("read_tiles");
+
+  // Schedule the reads and wait for all of them to finish.
+  std::vector<std::vector<ThreadPool::Task>> read_tasks;
+  auto filtered_data{read_tiles_no_wait(names, result_tiles, read_tasks)};
+  for (auto& tasks : read_tasks) {
+    auto statuses{storage_manager_->io_tp()->wait_all_status(tasks)};
+    for (const auto& st : statuses) {
+      throw_if_not_ok(st);
+    }
+  }
+
+  return filtered_data;
+}
+
+std::vector<FilteredData> ReaderBase::read_tiles_no_wait(
+    const std::vector<NameToLoad>& names,
+    const std::vector<ResultTile*>& result_tiles,
+    std::vector<std::vector<ThreadPool::Task>>& read_tasks) const {
   std::vector<FilteredData> filtered_data;
 
   // Shortcut for empty tile vec.
@@ -629,11 +1206,16 @@ std::vector<FilteredData> ReaderBase::read_tiles(
   }
 
   uint64_t num_tiles_read{0};
-  std::vector<ThreadPool::Task> read_tasks;
+  uint64_t num_tiles_synthesized{0};
+  read_tasks.reserve(names.size());
   filtered_data.reserve(names.size());
 
+  // Submit the reads with the query's configured I/O priority class.
+  ThreadPool::PriorityScope priority_scope(io_priority_);
+
   // Run all attributes independently.
   for (auto n : names) {
+    read_tasks.emplace_back();
     auto& name = n.name();
     auto val_only = n.validity_only();
 
@@ -654,7 +1236,7 @@ std::vector<FilteredData> ReaderBase::read_tiles(
         nullable,
         val_only,
         storage_manager_,
-        read_tasks);
+        read_tasks.back());
 
     // Go through each tiles and create the attribute tiles.
     for (auto tile : result_tiles) {
@@ -668,6 +1250,14 @@ std::vector<FilteredData> ReaderBase::read_tiles(
       num_tiles_read++;
       const auto tile_idx{tile->tile_idx()};
 
+      // Tiles proven all valid or all null by the tile null count metadata
+      // get their known contents synthesized below instead of being read.
+      const bool skip_data{
+          !val_only && skip_data_tile_read(tile->frag_idx(), name, tile_idx)};
+      const bool skip_validity{
+          nullable &&
+          skip_validity_tile_read(tile->frag_idx(), name, tile_idx)};
+
       // Construct a TileSizes class.
       ResultTile::TileSizes tile_sizes{
           fragment, name, var_sized, nullable, val_only, tile_idx};
@@ -682,13 +1272,16 @@ std::vector<FilteredData> ReaderBase::read_tiles(
       // 'unfilter_tiles' so that the filter pipeline can stop using the
       // 'ResultTile' object to get access to the filtered data.
       ResultTile::TileData tile_data{
-          val_only ?
+          val_only || skip_data ?
               nullptr :
               filtered_data.back().fixed_filtered_data(fragment.get(), tile),
-          val_only ?
+          val_only || skip_data ?
               nullptr :
               filtered_data.back().var_filtered_data(fragment.get(), tile),
-          filtered_data.back().nullable_filtered_data(fragment.get(), tile)};
+          skip_validity ?
+              nullptr :
+              filtered_data.back().nullable_filtered_data(
+                  fragment.get(), tile)};
 
       // Initialize the tile(s)
       const format_version_t format_version{fragment->format_version()};
@@ -706,16 +1299,41 @@ std::vector<FilteredData> ReaderBase::read_tiles(
         tile->init_attr_tile(
             format_version, array_schema_, name, tile_sizes, tile_data);
       }
+
+      // Write the known contents of the skipped tiles and clear their
+      // filtered state so that the unfiltering path leaves them alone.
+      if (skip_data || skip_validity) {
+        num_tiles_synthesized++;
+        auto tile_tuple = tile->tile_tuple(name);
+        const uint64_t cell_num{fragment->cell_num(tile_idx)};
+        if (skip_data) {
+          // All cells are null so any value returned for them is discounted
+          // by the validity vector; materialize the fill value.
+          auto& t = tile_tuple->fixed_tile();
+          const auto& fill_value{array_schema->attribute(name)->fill_value()};
+          pattern_fill(
+              t.data(), fill_value.data(), fill_value.size(), cell_num);
+          t.clear_filtered_buffer();
+        }
+
+        if (skip_validity) {
+          auto& t_validity = tile_tuple->validity_tile();
+          const uint8_t value =
+              fragment->get_tile_null_count(name, tile_idx) == 0 ? 1 : 0;
+          memset(t_validity.data(), value, cell_num);
+          t_validity.clear_filtered_buffer();
+        }
+      }
     }
   }
 
   stats_->add_counter("num_tiles_read", num_tiles_read);
-
-  // Wait for the read tasks to finish.
-  auto statuses{storage_manager_->io_tp()->wait_all_status(read_tasks)};
-  for (const auto& st : statuses) {
-    throw_if_not_ok(st);
-  }
+  stats_->add_counter("num_tiles_synthesized", num_tiles_synthesized);
+  common::TraceRing::instance().record(
+      "read_tiles_no_wait: fields={} tiles_read={} tiles_synthesized={}",
+      names.size(),
+      num_tiles_read,
+      num_tiles_synthesized);
 
   return filtered_data;
 }
@@ -747,7 +1365,12 @@ ReaderBase::load_tile_chunk_data(
   const auto t = &tile_tuple->fixed_tile();
   const auto t_var =
       var_size && !validity_only ? &tile_tuple->var_tile() : nullptr;
-  const auto t_validity = nullable ? &tile_tuple->validity_tile() : nullptr;
+
+  // The validity tile might have been synthesized from the tile null count
+  // metadata rather than read, in which case it is already unfiltered.
+  const auto t_validity = nullable && tile_tuple->validity_tile().filtered() ?
+                              &tile_tuple->validity_tile() :
+                              nullptr;
 
   uint64_t unfiltered_tile_size = 0, unfiltered_tile_var_size = 0,
            unfiltered_tile_validity_size = 0;
@@ -768,7 +1391,7 @@ ReaderBase::load_tile_chunk_data(
     }
   }
 
-  if (nullable) {
+  if (t_validity != nullptr) {
     unfiltered_tile_validity_size =
         t_validity->load_chunk_data(tile_chunk_validity_data);
   }
@@ -833,10 +1456,36 @@ Status ReaderBase::post_process_unfiltered_tile(
   return Status::Ok();
 }
 
+tuple<uint64_t, uint64_t> ReaderBase::compute_chunk_subset(
+    const std::vector<uint64_t>& chunk_offsets,
+    const uint64_t cell_size,
+    const std::pair<uint64_t, uint64_t>& cell_range) {
+  if (chunk_offsets.empty()) {
+    return {0, 0};
+  }
+
+  // Find the chunks containing the first and last byte of the cell range.
+  // The chunk offsets are the unfiltered data offset of each chunk in the
+  // tile, in increasing order.
+  const uint64_t byte_min = cell_range.first * cell_size;
+  const uint64_t byte_max = (cell_range.second + 1) * cell_size - 1;
+  auto min_it =
+      std::upper_bound(chunk_offsets.begin(), chunk_offsets.end(), byte_min);
+  auto max_it =
+      std::upper_bound(chunk_offsets.begin(), chunk_offsets.end(), byte_max);
+  const uint64_t min_chunk = std::distance(chunk_offsets.begin(), min_it) - 1;
+  const uint64_t max_chunk = std::distance(chunk_offsets.begin(), max_it);
+  return {min_chunk, max_chunk};
+}
+
 Status ReaderBase::unfilter_tiles(
     const std::string& name,
     const bool validity_only,
-    const std::vector<ResultTile*>& result_tiles) const {
+    const std::vector<ResultTile*>& result_tiles,
+    const std::vector<std::pair<uint64_t, uint64_t>>* tile_cell_ranges) const {
+  assert(
+      tile_cell_ranges == nullptr ||
+      tile_cell_ranges->size() == result_tiles.size());
   const auto stat_type = (array_schema_.is_attr(name)) ? "unfilter_attr_tiles" :
                                                          "unfilter_coord_tiles";
 
@@ -856,6 +1505,31 @@ Status ReaderBase::unfilter_tiles(
     return Status::Ok();
   }
 
+  common::TraceRing::instance().record(
+      "unfilter_tiles: tiles={} var={} nullable={}",
+      num_tiles,
+      var_size,
+      nullable);
+
+  // Load the zstd dictionaries of the fragments being unfiltered when the
+  // field is compressed with zstd. A no-op for fragments written without
+  // dictionaries.
+  if (!validity_only) {
+    auto compressor =
+        array_schema_.filters(name).get_filter<CompressionFilter>();
+    if (compressor != nullptr &&
+        compressor->compressor() == Compressor::ZSTD) {
+      std::unordered_set<unsigned> frag_idxs;
+      for (auto tile : result_tiles) {
+        frag_idxs.emplace(tile->frag_idx());
+      }
+      for (auto f : frag_idxs) {
+        fragment_metadata_[f]->load_zstd_dictionaries(
+            array_->get_encryption_key());
+      }
+    }
+  }
+
   // Compute parallelization parameters.
   uint64_t num_range_threads = 1;
   const auto num_threads = storage_manager_->compute_tp()->concurrency_level();
@@ -864,6 +1538,12 @@ Status ReaderBase::unfilter_tiles(
     num_range_threads = 1 + ((num_threads - 1) / num_tiles);
   }
 
+  // Minimum number of chunks a range thread should process; prevents
+  // splitting a tile into tasks with too little work per task.
+  const uint64_t min_chunks_per_task =
+      storage_manager_->config().get<uint64_t>(
+          "sm.unfilter_min_chunks_per_task", Config::must_find);
+
   // Vectors with all the necessary chunk data for unfiltering
   std::vector<ChunkData> tiles_chunk_data(num_tiles);
   std::vector<ChunkData> tiles_chunk_var_data(num_tiles);
@@ -913,9 +1593,11 @@ Status ReaderBase::unfilter_tiles(
             nullable,
             range_thread_idx,
             num_range_threads,
+            min_chunks_per_task,
             tiles_chunk_data[i],
             tiles_chunk_var_data[i],
-            tiles_chunk_validity_data[i]);
+            tiles_chunk_validity_data[i],
+            tile_cell_ranges == nullptr ? nullptr : &(*tile_cell_ranges)[i]);
       });
   RETURN_CANCEL_OR_ERROR(status);
 
@@ -936,11 +1618,19 @@ Status ReaderBase::unfilter_tile(
     const bool nullable,
     const uint64_t thread_idx,
     const uint64_t num_threads,
+    const uint64_t min_chunks_per_task,
     const ChunkData& tile_chunk_fixed_data,
     const ChunkData& tile_chunk_var_data,
-    const ChunkData& tile_chunk_validity_data) const {
+    const ChunkData& tile_chunk_validity_data,
+    const std::pair<uint64_t, uint64_t>* cell_range) const {
   assert(tile);
 
+  // Make the deferred validation group, when enabled, reachable from the
+  // checksum filters run below.
+  ChecksumSHA256Filter::DeferredValidationScope checksum_scope(
+      deferred_checksum_group_.has_value() ? &*deferred_checksum_group_ :
+                                             nullptr);
+
   if (skip_field(tile->frag_idx(), name)) {
     return Status::Ok();
   }
@@ -955,7 +1645,12 @@ Status ReaderBase::unfilter_tile(
 
   auto t = &tile_tuple->fixed_tile();
   auto t_var = var_size && !validity_only ? &tile_tuple->var_tile() : nullptr;
-  auto t_validity = nullable ? &tile_tuple->validity_tile() : nullptr;
+
+  // A synthesized validity tile is already unfiltered, see
+  // 'load_tile_chunk_data'.
+  auto t_validity = nullable && tile_tuple->validity_tile().filtered() ?
+                        &tile_tuple->validity_tile() :
+                        nullptr;
 
   FilterPipeline fixed_filters;
   FilterPipeline var_filters;
@@ -984,6 +1679,17 @@ Status ReaderBase::unfilter_tile(
         &validity_filters, array_->get_encryption_key()));
   }
 
+  // Decompress the data tile with the zstd dictionary the fragment was
+  // written with, if there is one. The dictionary is owned by the fragment
+  // metadata, which outlives the pipeline copies.
+  if (!validity_only) {
+    const auto& frag_meta = fragment_metadata_[tile->frag_idx()];
+    if (frag_meta->has_zstd_dictionary(name)) {
+      auto& data_filters = var_size ? var_filters : fixed_filters;
+      data_filters.set_zstd_dictionary(&frag_meta->zstd_dictionary(name));
+    }
+  }
+
   bool skip_offsets_filtering = false;
   if (var_size && !validity_only) {
     skip_offsets_filtering = var_filters.skip_offsets_filtering(
@@ -993,12 +1699,29 @@ Status ReaderBase::unfilter_tile(
   auto concurrency_level = storage_manager_->compute_tp()->concurrency_level();
 
   if (!validity_only) {
+    // Restrict unfiltering to the chunks covering the cells consumed
+    // downstream, when known. Only the fixed data tile of a fixed size field
+    // can be restricted as var data chunk boundaries cannot be derived from a
+    // cell range and the full offsets are required to unfilter var data.
+    uint64_t fixed_chunk_min = 0;
+    uint64_t fixed_chunk_num = tile_chunk_fixed_data.chunk_offsets_.size();
+    if (cell_range != nullptr && !var_size) {
+      std::tie(fixed_chunk_min, fixed_chunk_num) = compute_chunk_subset(
+          tile_chunk_fixed_data.chunk_offsets_, t->cell_size(), *cell_range);
+      fixed_chunk_num -= fixed_chunk_min;
+      if (thread_idx == 0) {
+        stats_->add_counter(
+            "chunks_skipped_unfiltering",
+            tile_chunk_fixed_data.chunk_offsets_.size() - fixed_chunk_num);
+      }
+    }
+
     // Unfiltered fixed data
-    if (!skip_offsets_filtering &&
+    if (!skip_offsets_filtering && fixed_chunk_num > 0 &&
         thread_idx <= tile_chunk_fixed_data.filtered_chunks_.size() - 1) {
       // Compute chunk boundaries
       auto&& [t_min, t_max] = compute_chunk_min_max(
-          tile_chunk_fixed_data.chunk_offsets_.size(), num_threads, thread_idx);
+          fixed_chunk_num, num_threads, thread_idx, min_chunks_per_task);
 
       // Reverse the tile filters.
       stats_->add_counter("tiles_unfiltered", 1);
@@ -1007,8 +1730,8 @@ Status ReaderBase::unfilter_tile(
           t,
           nullptr,
           tile_chunk_fixed_data,
-          t_min,
-          t_max,
+          fixed_chunk_min + t_min,
+          fixed_chunk_min + t_max,
           concurrency_level,
           storage_manager_->config()));
     }
@@ -1018,7 +1741,10 @@ Status ReaderBase::unfilter_tile(
     if (var_size &&
         thread_idx <= tile_chunk_var_data.filtered_chunks_.size() - 1) {
       auto&& [tvar_min, tvar_max] = compute_chunk_min_max(
-          tile_chunk_var_data.chunk_offsets_.size(), num_threads, thread_idx);
+          tile_chunk_var_data.chunk_offsets_.size(),
+          num_threads,
+          thread_idx,
+          min_chunks_per_task);
       // Reverse the filters of tile var data
       stats_->add_counter("tiles_unfiltered", 1);
       RETURN_NOT_OK(var_filters.run_reverse(
@@ -1035,30 +1761,51 @@ Status ReaderBase::unfilter_tile(
 
   // Prevent processing past the end of chunks in case there are more
   // threads than chunks.
-  if (nullable &&
+  if (t_validity != nullptr &&
       thread_idx <= tile_chunk_validity_data.filtered_chunks_.size() - 1) {
-    // Compute chunk boundaries
-    auto&& [tval_min, tval_max] = compute_chunk_min_max(
-        tile_chunk_validity_data.chunk_offsets_.size(),
-        num_threads,
-        thread_idx);
-
-    // Reverse the tile validity filters.
-    stats_->add_counter("tiles_unfiltered", 1);
-    RETURN_NOT_OK(validity_filters.run_reverse(
-        stats_,
-        t_validity,
-        nullptr,
-        tile_chunk_validity_data,
-        tval_min,
-        tval_max,
-        concurrency_level,
-        storage_manager_->config()));
+    // The validity tile stores one value per cell so it can be restricted to
+    // the consumed cell range as well.
+    uint64_t validity_chunk_min = 0;
+    uint64_t validity_chunk_num =
+        tile_chunk_validity_data.chunk_offsets_.size();
+    if (cell_range != nullptr) {
+      std::tie(validity_chunk_min, validity_chunk_num) = compute_chunk_subset(
+          tile_chunk_validity_data.chunk_offsets_,
+          t_validity->cell_size(),
+          *cell_range);
+      validity_chunk_num -= validity_chunk_min;
+    }
+
+    if (validity_chunk_num > 0) {
+      // Compute chunk boundaries
+      auto&& [tval_min, tval_max] = compute_chunk_min_max(
+          validity_chunk_num, num_threads, thread_idx, min_chunks_per_task);
+
+      // Reverse the tile validity filters.
+      stats_->add_counter("tiles_unfiltered", 1);
+      RETURN_NOT_OK(validity_filters.run_reverse(
+          stats_,
+          t_validity,
+          nullptr,
+          tile_chunk_validity_data,
+          validity_chunk_min + tval_min,
+          validity_chunk_min + tval_max,
+          concurrency_level,
+          storage_manager_->config()));
+    }
   }
 
   return Status::Ok();
 }
 
+Status ReaderBase::wait_deferred_checksums() {
+  if (!deferred_checksum_group_.has_value()) {
+    return Status::Ok();
+  }
+
+  return deferred_checksum_group_->wait_all();
+}
+
 uint64_t ReaderBase::offsets_bytesize() const {
   return offsets_bitsize_ == 32 ? sizeof(uint32_t) :
                                   constants::cell_var_offset_size;
@@ -35,6 +35,7 @@
 
 #include "../strategy_base.h"
 #include "tiledb/common/common.h"
+#include "tiledb/common/memory_tracker.h"
 #include "tiledb/common/status.h"
 #include "tiledb/sm/array_schema/dimension.h"
 #include "tiledb/sm/array_schema/tile_domain.h"
@@ -219,12 +220,15 @@ class ReaderBase : public StrategyBase {
    * @param num_chunks Total number of chunks in a tile
    * @param num_range_threads Total number of range threads.
    * @param range_thread_idx Current range thread index.
+   * @param min_chunks_per_thread Minimum number of chunks assigned to a
+   *     thread; threads left without chunks receive an empty range.
    * @return {min, max}
    */
   static tuple<uint64_t, uint64_t> compute_chunk_min_max(
       const uint64_t num_chunks,
       const uint64_t num_range_threads,
-      const uint64_t thread_idx) {
+      const uint64_t thread_idx,
+      const uint64_t min_chunks_per_thread = 1) {
     if (num_range_threads == 0) {
       throw std::runtime_error("Number of range thread value is 0");
     }
@@ -239,6 +243,10 @@ class ReaderBase : public StrategyBase {
     }
 
     auto t_part_num = std::min(num_chunks, num_range_threads);
+    if (min_chunks_per_thread > 1) {
+      t_part_num = std::min(
+          t_part_num, std::max<uint64_t>(1, num_chunks / min_chunks_per_thread));
+    }
     auto t_min = (thread_idx * num_chunks + t_part_num - 1) / t_part_num;
     auto t_max = std::min(
         ((thread_idx + 1) * num_chunks + t_part_num - 1) / t_part_num,
@@ -247,6 +255,20 @@ class ReaderBase : public StrategyBase {
     return {t_min, t_max};
   }
 
+  /**
+   * Computes the range of chunks of a tile that covers a cell range, using
+   * the unfiltered data offset of each chunk.
+   *
+   * @param chunk_offsets Unfiltered data offset of each chunk in the tile.
+   * @param cell_size Cell size for the tile data.
+   * @param cell_range Inclusive range of cells to cover.
+   * @return {min_chunk, max_chunk} Chunk range, max exclusive.
+   */
+  static tuple<uint64_t, uint64_t> compute_chunk_subset(
+      const std::vector<uint64_t>& chunk_offsets,
+      const uint64_t cell_size,
+      const std::pair<uint64_t, uint64_t>& cell_range);
+
   /* ********************************* */
   /*          PUBLIC METHODS           */
   /* ********************************* */
@@ -260,6 +282,49 @@ class ReaderBase : public StrategyBase {
    */
   bool skip_field(const unsigned frag_idx, const std::string& name) const;
 
+  /**
+   * Check if the validity tile of a field can be skipped from I/O for a
+   * certain fragment tile. This is the case when the loaded tile null count
+   * metadata proves the tile contains no null cells or only null cells: the
+   * validity values are then a known constant and the tile is synthesized by
+   * 'read_tiles_no_wait' instead of being read and unfiltered.
+   *
+   * @param frag_idx Fragment index.
+   * @param name Name of the attribute.
+   * @param tile_idx Tile index.
+   * @return True if the validity tile read should be skipped.
+   */
+  bool skip_validity_tile_read(
+      const unsigned frag_idx,
+      const std::string& name,
+      const uint64_t tile_idx) const;
+
+  /**
+   * Check if the data tile of a field can be skipped from I/O for a certain
+   * fragment tile. This is the case for fixed sized attributes when the
+   * loaded tile null count metadata proves the tile contains only null
+   * cells: the data is then synthesized as fill values by
+   * 'read_tiles_no_wait' instead of being read and unfiltered. Var sized
+   * fields are excluded because synthesizing offsets would change the var
+   * cell sizes seen by the copy path.
+   *
+   * @param frag_idx Fragment index.
+   * @param name Name of the attribute.
+   * @param tile_idx Tile index.
+   * @return True if the data tile read should be skipped.
+   */
+  bool skip_data_tile_read(
+      const unsigned frag_idx,
+      const std::string& name,
+      const uint64_t tile_idx) const;
+
+  /**
+   * Waits for the checksum validations deferred while unfiltering, if any,
+   * returning the first mismatch found. Called before a submission returns
+   * results so deferred validation keeps end-to-end integrity.
+   */
+  Status wait_deferred_checksums();
+
  protected:
   /* ********************************* */
   /*       PROTECTED ATTRIBUTES        */
@@ -326,6 +391,15 @@ class ReaderBase : public StrategyBase {
   /** The maximum number of bytes in a batched read operation. */
   uint64_t max_batch_size_;
 
+  /** The priority class this query's I/O is submitted with. */
+  ThreadPool::Priority io_priority_;
+
+  /**
+   * Task group the checksum validations of this query are scheduled on when
+   * `sm.deferred_checksum_validation` is enabled, `nullopt` otherwise.
+   */
+  mutable std::optional<ThreadPool::TaskGroup> deferred_checksum_group_;
+
   /** The minimum number of bytes between two read batches. */
   uint64_t min_batch_gap_;
 
@@ -341,6 +415,14 @@ class ReaderBase : public StrategyBase {
    * */
   std::unordered_map<std::string, QueryBuffer>& aggregate_buffers_;
 
+  /**
+   * Per-query memory tracker, linked to the context level tracker so that
+   * `sm.mem.context_budget` caps the combined usage of all concurrent
+   * queries. Tile read allocations are charged to it for backpressure,
+   * see `throttle_tile_reads`.
+   */
+  mutable MemoryTracker query_memory_tracker_;
+
   /* ********************************* */
   /*         PROTECTED METHODS         */
   /* ********************************* */
@@ -383,6 +465,35 @@ class ReaderBase : public StrategyBase {
    */
   bool process_partial_timestamps(FragmentMetadata& frag_meta) const;
 
+  /**
+   * Returns if every cell of a tile lies within the open timestamp range,
+   * in which case the per-cell partial overlap condition is a no-op for
+   * the tile and can be skipped. Decided from the tile min/max metadata of
+   * the timestamps field; returns `false` if that metadata is not present
+   * or not loaded for the fragment.
+   *
+   * @param frag_meta Fragment metadata.
+   * @param tile_idx The index of the tile in the fragment.
+   * @return true if the tile timestamps are all within the open range.
+   */
+  bool timestamps_within_open_range(
+      const FragmentMetadata& frag_meta, uint64_t tile_idx) const;
+
+  /**
+   * Fills `num` contiguous cells at `dest` with the `cell_size` byte fill
+   * value `pattern`, used when synthesizing cells of attributes added by
+   * schema evolution. Expands the pattern with a memset when all its
+   * bytes are equal and with doubling bulk copies otherwise, instead of a
+   * per-cell copy loop.
+   *
+   * @param dest Destination buffer.
+   * @param pattern Fill value bytes.
+   * @param cell_size Size of the fill value, in bytes.
+   * @param num Number of cells to fill.
+   */
+  static void pattern_fill(
+      void* dest, const void* pattern, uint64_t cell_size, uint64_t num);
+
   /**
    * Deletes the tiles on the input field from the result tiles.
    *
@@ -534,6 +645,32 @@ class ReaderBase : public StrategyBase {
    */
   void load_processed_conditions();
 
+  /**
+   * Computes the total persisted (filtered) size of the tiles that a read
+   * of the input fields on the input result tiles will allocate. Requires
+   * the tile offsets of the fragments to be loaded.
+   *
+   * @param names The field names.
+   * @param result_tiles The result tiles that will be read.
+   * @return Total persisted size, in bytes.
+   */
+  uint64_t tiles_filtered_size(
+      const std::vector<NameToLoad>& names,
+      const std::vector<ResultTile*>& result_tiles) const;
+
+  /**
+   * Charges an upcoming tile read to the query memory tracker, waiting for
+   * other queries on the context to release memory when the context budget
+   * is exhausted instead of overshooting it. Requests that can never fit
+   * the budget proceed unthrottled rather than failing the query. The
+   * caller must release the memory once the tiles are unfiltered and the
+   * filtered data is freed.
+   *
+   * @param size The size of the filtered data that will be allocated.
+   * @return true if the size was charged to the tracker, false otherwise.
+   */
+  bool throttle_tile_reads(uint64_t size) const;
+
   /**
    * Read and unfilter attribute tiles.
    *
@@ -558,6 +695,41 @@ class ReaderBase : public StrategyBase {
       const std::vector<std::string>& names,
       const std::vector<ResultTile*>& result_tiles) const;
 
+  /**
+   * Looks up the tiles on a field in the unfiltered tile cache, restoring
+   * the payloads of cache hits directly into the `ResultTile` instances.
+   * Restored tiles look exactly like tiles that went through `read_tiles`
+   * and `unfilter_tiles`.
+   *
+   * @param name The field name.
+   * @param validity_only Is the field read for validity only?
+   * @param result_tiles Tiles to look up.
+   * @param misses Set to the tiles that were not found in the cache.
+   */
+  void cached_tiles_lookup(
+      const std::string& name,
+      const bool validity_only,
+      const std::vector<ResultTile*>& result_tiles,
+      std::vector<ResultTile*>& misses) const;
+
+  /**
+   * Inserts the tiles on a field into the unfiltered tile cache. Must be
+   * called after the tiles have been unfiltered and post-processed.
+   *
+   * @param name The field name.
+   * @param validity_only Was the field read for validity only?
+   * @param result_tiles Tiles to insert.
+   * @param cost_ns Measured time it took to read and unfilter
+   *     `result_tiles`, in nanoseconds. Apportioned to the payloads by
+   *     size and used by the cache eviction policy to keep tiles that are
+   *     expensive to refetch resident longer.
+   */
+  void cached_tiles_insert(
+      const std::string& name,
+      const bool validity_only,
+      const std::vector<ResultTile*>& result_tiles,
+      const uint64_t cost_ns) const;
+
   /**
    * Concurrently executes across each name in `names` and each result tile
    * in 'result_tiles'.
@@ -607,6 +779,28 @@ class ReaderBase : public StrategyBase {
       const std::vector<NameToLoad>& names,
       const std::vector<ResultTile*>& result_tiles) const;
 
+  /**
+   * Same as `read_tiles`, but returns as soon as the reads have been
+   * scheduled on the I/O thread pool instead of waiting for them. The
+   * read tasks of each field are returned separately in `read_tasks`, in
+   * the order of `names`, so a caller can continue with a field (e.g.
+   * start unfiltering it) the moment its own reads complete, overlapping
+   * the I/O latency of the remaining fields with CPU work.
+   *
+   * The returned filtered data blocks are the read destinations and must
+   * outlive all of the read tasks, even if one of them fails.
+   *
+   * @param names The field names.
+   * @param result_tiles The retrieved tiles will be stored inside the
+   *     `ResultTile` instances in this vector.
+   * @param read_tasks Set to the scheduled read tasks, per field.
+   * @return Filtered data blocks.
+   */
+  std::vector<FilteredData> read_tiles_no_wait(
+      const std::vector<NameToLoad>& names,
+      const std::vector<ResultTile*>& result_tiles,
+      std::vector<std::vector<ThreadPool::Task>>& read_tasks) const;
+
   /**
    * Filters the tiles on a particular field from all input
    * fragments based on the tile info in `result_tiles`.
@@ -614,12 +808,19 @@ class ReaderBase : public StrategyBase {
    * @param name Field whose tiles will be unfiltered.
    * @param validity_only Unfilter for the validity tile only?
    * @param result_tiles Vector containing the tiles to be unfiltered.
+   * @param tile_cell_ranges Optional inclusive range of cells consumed
+   * downstream for each result tile. When set, only the chunks covering the
+   * range are unfiltered for fixed size data and validity tiles, leaving the
+   * rest of the tile buffers unwritten. Var data chunk boundaries cannot be
+   * derived from a cell range so var sized data is always fully unfiltered.
    * @return Status
    */
   Status unfilter_tiles(
       const std::string& name,
       const bool validity_only,
-      const std::vector<ResultTile*>& result_tiles) const;
+      const std::vector<ResultTile*>& result_tiles,
+      const std::vector<std::pair<uint64_t, uint64_t>>* tile_cell_ranges =
+          nullptr) const;
 
   /**
    * Unfilter a specific range of chunks in tile
@@ -633,10 +834,15 @@ class ReaderBase : public StrategyBase {
    * otherwise
    * @param range_thread_idx Current range thread index.
    * @param num_range_threads Total number of range threads.
+   * @param min_chunks_per_task Minimum number of chunks processed by one
+   * range thread.
    * @param tile_chunk_data Tile chunk info, buffers and offsets
    * @param tile_var_chunk_data Value tile chunk info, buffers and offsets
    * @param tile_validity_chunk_data Validity tile chunk info, buffers and
    * offsets
+   * @param cell_range Optional inclusive range of cells consumed downstream,
+   * restricting which chunks get unfiltered for fixed size data and validity
+   * tiles.
    * @return Status
    */
   Status unfilter_tile(
@@ -647,9 +853,11 @@ class ReaderBase : public StrategyBase {
       const bool nullable,
       uint64_t range_thread_idx,
       uint64_t num_range_threads,
+      uint64_t min_chunks_per_task,
       const ChunkData& tile_chunk_data,
       const ChunkData& tile_chunk_var_data,
-      const ChunkData& tile_chunk_validity_data) const;
+      const ChunkData& tile_chunk_validity_data,
+      const std::pair<uint64_t, uint64_t>* cell_range) const;
 
   /**
    * Returns the configured bytesize for var-sized attribute offsets
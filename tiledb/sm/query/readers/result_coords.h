@@ -33,6 +33,7 @@
 #ifndef TILEDB_RESULT_COORDS_H
 #define TILEDB_RESULT_COORDS_H
 
+#include <algorithm>
 #include <iostream>
 #include <vector>
 
@@ -85,6 +86,25 @@ struct ResultCoordsBase {
     return tile_->coord_string(pos_, dim_idx);
   }
 
+  /**
+   * Returns an 8-byte prefix key for a string coordinate, packed big-endian
+   * so that integer comparison of two keys matches the lexicographic
+   * comparison of the corresponding coordinate prefixes. Coordinates shorter
+   * than 8 bytes are padded with zeroes, so differing keys order the
+   * coordinates correctly and equal keys require a full comparison.
+   * Applicable only to string dimensions.
+   */
+  inline uint64_t coord_string_prefix(unsigned dim_idx) const {
+    const auto coord = tile_->coord_string(pos_, dim_idx);
+    const size_t len = std::min(coord.size(), sizeof(uint64_t));
+    uint64_t key = 0;
+    for (size_t i = 0; i < len; i++) {
+      key |= static_cast<uint64_t>(static_cast<uint8_t>(coord[i]))
+             << (56 - i * 8);
+    }
+    return key;
+  }
+
   /**
    * Returns the coordinate at the object's position `pos_` from the object's
    * tile `tile_` on the given dimension.
@@ -111,6 +111,9 @@ void ResultTile::swap(ResultTile& tile) {
   std::swap(delete_timestamps_tile_, tile.delete_timestamps_tile_);
   std::swap(coords_tile_, tile.coords_tile_);
   std::swap(coord_tiles_, tile.coord_tiles_);
+  std::swap(packed_coords_, tile.packed_coords_);
+  std::swap(packed_coords_cell_size_, tile.packed_coords_cell_size_);
+  std::swap(packed_coords_offsets_, tile.packed_coords_offsets_);
   std::swap(compute_results_dense_func_, tile.compute_results_dense_func_);
   std::swap(coord_func_, tile.coord_func_);
   std::swap(compute_results_sparse_func_, tile.compute_results_sparse_func_);
@@ -276,6 +279,49 @@ const void* ResultTile::zipped_coord(uint64_t pos, unsigned dim_idx) const {
   return ret;
 }
 
+const void* ResultTile::packed_coord(uint64_t pos, unsigned dim_idx) const {
+  const uint64_t offset =
+      pos * packed_coords_cell_size_ + packed_coords_offsets_[dim_idx];
+  return packed_coords_.data() + offset;
+}
+
+void ResultTile::build_packed_coords() {
+  if (!packed_coords_.empty() || coords_tile_.has_value()) {
+    return;
+  }
+
+  // Applicable only when all dimension coordinates are fixed-sized and
+  // initialized.
+  auto dim_num = (unsigned)coord_tiles_.size();
+  for (unsigned d = 0; d < dim_num; ++d) {
+    if (!coord_tiles_[d].second.has_value() ||
+        domain_->dimension_ptr(d)->var_size()) {
+      return;
+    }
+  }
+
+  // Compute the offset of every dimension within a packed cell.
+  packed_coords_offsets_.resize(dim_num);
+  packed_coords_cell_size_ = 0;
+  for (unsigned d = 0; d < dim_num; ++d) {
+    packed_coords_offsets_[d] = packed_coords_cell_size_;
+    packed_coords_cell_size_ += coord_size(d);
+  }
+
+  // Interleave the coordinates, one dimension at a time.
+  packed_coords_.resize(cell_num_ * packed_coords_cell_size_);
+  for (unsigned d = 0; d < dim_num; ++d) {
+    const auto size = coord_size(d);
+    const auto* src = coord_tiles_[d].second->fixed_tile().data_as<char>();
+    auto* dest = packed_coords_.data() + packed_coords_offsets_[d];
+    for (uint64_t pos = 0; pos < cell_num_; ++pos) {
+      memcpy(dest + pos * packed_coords_cell_size_, src + pos * size, size);
+    }
+  }
+
+  coord_func_ = &ResultTile::packed_coord;
+}
+
 std::string_view ResultTile::coord_string(
     uint64_t pos, unsigned dim_idx) const {
   const auto& coord_tile_off = coord_tiles_[dim_idx].second->fixed_tile();
@@ -33,6 +33,9 @@
 #ifndef TILEDB_RESULT_TILE_H
 #define TILEDB_RESULT_TILE_H
 
+#include <algorithm>
+#include <bit>
+#include <cstring>
 #include <functional>
 #include <iostream>
 #include <numeric>
@@ -456,6 +459,16 @@ class ResultTile {
   /** Returns the coordinate size on the input dimension. */
   uint64_t coord_size(unsigned dim_idx) const;
 
+  /**
+   * Packs the fixed-sized dimension coordinates into a single row-major
+   * buffer and serves `coord()` from it, so that the cell comparisons
+   * of merge-heavy code paths touch one cache line per cell instead of
+   * one per dimension. No-op if the coordinates are already zipped, if
+   * any dimension is var-sized or if the coordinates have been packed
+   * already.
+   */
+  void build_packed_coords();
+
   /**
    * Returns true if the coordinates at position `pos_a` and `pos_b` are
    * the same.
@@ -708,6 +721,18 @@ class ResultTile {
    */
   std::vector<std::pair<std::string, optional<TileTuple>>> coord_tiles_;
 
+  /**
+   * The fixed-sized dimension coordinates packed in a single row-major
+   * buffer by `build_packed_coords()`. Empty until then.
+   */
+  std::vector<uint8_t> packed_coords_;
+
+  /** The size of a cell in `packed_coords_`. */
+  uint64_t packed_coords_cell_size_ = 0;
+
+  /** The offset of each dimension within a `packed_coords_` cell. */
+  std::vector<uint64_t> packed_coords_offsets_;
+
   /**
    * Stores the appropriate templated compute_results_dense() function based for
    * each dimension, based on the dimension datatype.
@@ -785,6 +810,9 @@ class ResultTile {
   /** Implements coord() for unzipped coordinates. */
   const void* unzipped_coord(uint64_t pos, unsigned dim_idx) const;
 
+  /** Implements coord() for packed coordinates. */
+  const void* packed_coord(uint64_t pos, unsigned dim_idx) const;
+
   /**
    * A helper routine used in `compute_results_sparse<char>` to
    * determine if a given string-valued coordinate intersects
@@ -864,9 +892,27 @@ class ResultTileWithBitmap : public ResultTile {
 
   /**
    * Accumulates the number of cells in the bitmap.
+   *
+   * This also builds block-level prefix sums over the bitmap, so that
+   * `result_num_between_pos` and `pos_with_given_result_sum` can answer
+   * without scanning the bitmap. The copy destination offsets of the
+   * parallel range threads are computed with these functions, for every
+   * copied field, which serializes result emission on large bitmaps.
    */
   void count_cells() {
-    result_num_ = std::accumulate(bitmap_.begin(), bitmap_.end(), 0);
+    const uint64_t block_num =
+        (bitmap_.size() + bitmap_prefix_block_size_ - 1) /
+        bitmap_prefix_block_size_;
+    bitmap_prefix_sums_.resize(block_num + 1);
+    bitmap_prefix_sums_[0] = 0;
+    uint64_t sum = 0;
+    for (uint64_t b = 0; b < block_num; b++) {
+      const uint64_t end =
+          std::min((b + 1) * bitmap_prefix_block_size_, bitmap_.size());
+      sum += sum_range(b * bitmap_prefix_block_size_, end);
+      bitmap_prefix_sums_[b + 1] = sum;
+    }
+    result_num_ = sum;
   }
 
   /**
@@ -875,6 +921,40 @@ class ResultTileWithBitmap : public ResultTile {
   void alloc_bitmap() {
     assert(bitmap_.size() == 0);
     bitmap_.resize(cell_num_, 1);
+    bitmap_released_ = false;
+  }
+
+  /**
+   * Releases the bitmap storage if it carries no information. For non
+   * overlapping ranges, a bitmap where every cell survived is equivalent
+   * to having no bitmap at all and all bitmap queries treat the two
+   * states identically, yet it holds a byte per cell. Tiles fully
+   * covered by the subarray with no filtering condition all end up with
+   * such bitmaps, so dropping them releases the bulk of the bitmap
+   * memory of dense-surviving workloads. Must only be called once the
+   * bitmap is final, as the cleared bitmap cannot be modified per cell
+   * anymore.
+   *
+   * @return true if the bitmap was released.
+   */
+  bool release_full_bitmap() {
+    const bool non_overlapping = std::is_same<BitmapType, uint8_t>::value;
+    if (!non_overlapping || bitmap_.size() == 0 || result_num_ != cell_num_) {
+      return false;
+    }
+
+    bitmap_.clear();
+    bitmap_.shrink_to_fit();
+    bitmap_prefix_sums_.clear();
+    bitmap_prefix_sums_.shrink_to_fit();
+    bitmap_released_ = true;
+
+    return true;
+  }
+
+  /** Returns if the bitmap was released by `release_full_bitmap`. */
+  inline bool bitmap_released() const {
+    return bitmap_released_;
   }
 
   /**
@@ -891,12 +971,11 @@ class ResultTileWithBitmap : public ResultTile {
       return end_pos - start_pos;
     }
 
-    uint64_t result_num = 0;
-    for (uint64_t c = start_pos; c < end_pos; c++) {
-      result_num += bitmap_[c];
+    if (!bitmap_prefix_sums_.empty()) {
+      return result_num_up_to_pos(end_pos) - result_num_up_to_pos(start_pos);
     }
 
-    return result_num;
+    return sum_range(start_pos, end_pos);
   }
 
   /**
@@ -913,6 +992,34 @@ class ResultTileWithBitmap : public ResultTile {
       return start_pos + result_num - 1;
     }
 
+    if (!bitmap_prefix_sums_.empty()) {
+      if (result_num == 0) {
+        return start_pos;
+      }
+
+      // Find the first block whose end-of-block prefix sum reaches the
+      // target, then scan only the cells of that block.
+      const uint64_t target = result_num_up_to_pos(start_pos) + result_num;
+      auto it = std::lower_bound(
+          bitmap_prefix_sums_.begin() + 1, bitmap_prefix_sums_.end(), target);
+      if (it == bitmap_prefix_sums_.end()) {
+        return bitmap_.size() - 1;
+      }
+
+      const uint64_t b = std::distance(bitmap_prefix_sums_.begin(), it) - 1;
+      uint64_t sum = bitmap_prefix_sums_[b];
+      const uint64_t end =
+          std::min((b + 1) * bitmap_prefix_block_size_, bitmap_.size());
+      for (uint64_t c = b * bitmap_prefix_block_size_; c < end; c++) {
+        sum += bitmap_[c];
+        if (sum >= target) {
+          return c;
+        }
+      }
+
+      return bitmap_.size() - 1;
+    }
+
     uint64_t sum = 0;
     for (uint64_t c = start_pos; c < bitmap_.size(); c++) {
       sum += bitmap_[c];
@@ -949,6 +1056,8 @@ class ResultTileWithBitmap : public ResultTile {
   void swap(ResultTileWithBitmap<BitmapType>& tile) {
     ResultTile::swap(tile);
     std::swap(bitmap_, tile.bitmap_);
+    std::swap(bitmap_prefix_sums_, tile.bitmap_prefix_sums_);
+    std::swap(bitmap_released_, tile.bitmap_released_);
     std::swap(result_num_, tile.result_num_);
   }
 
@@ -956,11 +1065,63 @@ class ResultTileWithBitmap : public ResultTile {
   /* ********************************* */
   /*       PROTECTED ATTRIBUTES        */
   /* ********************************* */
+
+  /** Number of bitmap cells covered by one prefix sum block. */
+  static constexpr uint64_t bitmap_prefix_block_size_ = 64;
+
   /** Bitmap for this tile. */
   std::vector<BitmapType> bitmap_;
 
+  /**
+   * Block-level prefix sums over the bitmap, maintained by `count_cells`.
+   * Entry `b` contains the number of results in cells `[0, b * block_size)`.
+   * Empty when the bitmap was modified without recounting, in which case
+   * the bitmap is scanned directly.
+   */
+  std::vector<uint64_t> bitmap_prefix_sums_;
+
+  /** Was the bitmap released by `release_full_bitmap`. */
+  bool bitmap_released_ = false;
+
   /** Number of cells in this bitmap. */
   uint64_t result_num_;
+
+  /* ********************************* */
+  /*         PROTECTED METHODS         */
+  /* ********************************* */
+
+  /**
+   * Returns the number of results in cells `[0, pos)`, using the prefix
+   * sums. The prefix sums must be valid.
+   */
+  uint64_t result_num_up_to_pos(uint64_t pos) const {
+    const uint64_t b = pos / bitmap_prefix_block_size_;
+    return bitmap_prefix_sums_[b] +
+           sum_range(b * bitmap_prefix_block_size_, pos);
+  }
+
+  /**
+   * Returns the sum of the cell counts in `[start_pos, end_pos)`. For non
+   * overlapping ranges the bitmap holds only zeros and ones, so eight
+   * cells are added at a time with a popcount over their low bits instead
+   * of a byte-per-cell loop.
+   */
+  uint64_t sum_range(uint64_t start_pos, uint64_t end_pos) const {
+    uint64_t sum = 0;
+    uint64_t c = start_pos;
+    if constexpr (std::is_same_v<BitmapType, uint8_t>) {
+      for (; c + 8 <= end_pos; c += 8) {
+        uint64_t chunk;
+        memcpy(&chunk, &bitmap_[c], sizeof(chunk));
+        sum += std::popcount(chunk & 0x0101010101010101ULL);
+      }
+    }
+    for (; c < end_pos; c++) {
+      sum += bitmap_[c];
+    }
+
+    return sum;
+  }
 };
 
 /** Global order result tile. */
@@ -1076,6 +1237,9 @@ class GlobalOrderResultTile : public ResultTileWithBitmap<BitmapType> {
         ResultTileWithBitmap<BitmapType>::bitmap_[cell_idx];
     ResultTileWithBitmap<BitmapType>::bitmap_[cell_idx] = 0;
 
+    // The prefix sums no longer match the bitmap; fall back to scanning.
+    ResultTileWithBitmap<BitmapType>::bitmap_prefix_sums_.clear();
+
     if (post_dedup_bitmap_.has_value() && post_dedup_bitmap_->size() > 0) {
       post_dedup_bitmap_->at(cell_idx) = 0;
     }
@@ -102,6 +102,14 @@ SparseGlobalOrderReader<BitmapType>::SparseGlobalOrderReader(
     , consolidation_with_timestamps_(consolidation_with_timestamps)
     , last_cells_(array->fragment_metadata().size())
     , tile_offsets_loaded_(false) {
+  // Bind the per-fragment result tile lists to the per-query arena. The
+  // lists adopt the allocator through move-assignment, as the result tiles
+  // themselves are move-only.
+  ArenaAllocator<GlobalOrderResultTile<BitmapType>> alloc(&result_tile_arena_);
+  for (auto& result_tiles : result_tiles_leftover_) {
+    result_tiles = ResultTilesList(alloc);
+  }
+
   // Initialize memory budget variables.
   refresh_config();
 }
@@ -179,6 +187,20 @@ Status SparseGlobalOrderReader<BitmapType>::dowork() {
       // Read and unfilter coords.
       throw_if_not_ok(read_and_unfilter_coords(created_tiles));
 
+      // Pack the coordinates of the new tiles so that the cell
+      // comparisons of the merge below touch one cache line per cell
+      // instead of one per dimension.
+      if (array_schema_.dim_num() > 1) {
+        throw_if_not_ok(parallel_for(
+            storage_manager_->compute_tp(),
+            0,
+            created_tiles.size(),
+            [&](uint64_t i) {
+              created_tiles[i]->build_packed_coords();
+              return Status::Ok();
+            }));
+      }
+
       // Compute the tile bitmaps.
       compute_tile_bitmaps<BitmapType>(created_tiles);
 
@@ -212,8 +234,8 @@ Status SparseGlobalOrderReader<BitmapType>::dowork() {
       user_buffers_full = user_buffs_full;
       result_cell_slabs = std::move(rcs);
     } else {
-      auto&& [user_buffs_full, rcs] = merge_result_cell_slabs<GlobalCmpReverse>(
-          max_num_cells_to_copy(), result_tiles);
+      auto&& [user_buffs_full, rcs] =
+          merge_result_cell_slabs_global(max_num_cells_to_copy(), result_tiles);
       user_buffers_full = user_buffs_full;
       result_cell_slabs = std::move(rcs);
     }
@@ -297,6 +319,17 @@ uint64_t SparseGlobalOrderReader<BitmapType>::get_coord_tiles_size(
     tiles_size += fragment_metadata_[f]->cell_num(t) * sizeof(uint64_t);
   }
 
+  // Account for the packed coordinates used by the merge.
+  if (dim_num > 1 &&
+      std::none_of(
+          is_dim_var_size_.begin(), is_dim_var_size_.end(), [](bool b) {
+            return b;
+          })) {
+    for (unsigned d = 0; d < dim_num; d++) {
+      tiles_size += frag_meta->tile_size(dim_names_[d], t);
+    }
+  }
+
   // Add the tile bitmap size if there is a subarray or pre query condition to
   // be processed.
   const bool dups = array_schema_.allows_dups();
@@ -328,12 +361,33 @@ bool SparseGlobalOrderReader<BitmapType>::add_result_tile(
     return false;
   }
 
+  // Skip tiles the condition proves cannot contain results.
+  if (condition_.has_value() && condition_->can_skip_tile(frag_md, t)) {
+    stats_->add_counter("tiles_skipped_by_condition", 1);
+    return false;
+  }
+
+  // Stop scheduling tiles once the tiles already in flight cover the result
+  // budget hint. A fragment with no loaded tiles still gets one so the
+  // global order merge can make progress.
+  if (result_budget_reached() && !result_tiles[f].empty()) {
+    return true;
+  }
+
   // Calculate memory consumption for this tile.
   auto tiles_size = get_coord_tiles_size(dim_num, f, t);
 
-  // Don't load more tiles than the memory budget.
+  // Don't load more tiles than the memory budget. A fragment with no loaded
+  // tiles needs at least one to make progress, so let its first tile borrow
+  // from the unused portion of the global coordinate budget instead of
+  // failing when a single tile exceeds the per fragment share.
   if (memory_used_for_coords_[f] + tiles_size > memory_budget_coords_tiles) {
-    return true;
+    const uint64_t memory_budget_coords =
+        memory_budget_.total_budget() * memory_budget_.ratio_coords();
+    if (!result_tiles[f].empty() ||
+        memory_used_for_coords_total_ + tiles_size > memory_budget_coords) {
+      return true;
+    }
   }
 
   // Adjust total memory used.
@@ -342,6 +396,9 @@ bool SparseGlobalOrderReader<BitmapType>::add_result_tile(
   // Adjust per fragment memory used.
   memory_used_for_coords_[f] += tiles_size;
 
+  // Adjust the scheduled cell count for the result budget hint.
+  result_budget_cells_scheduled_ += frag_md.cell_num(t);
+
   // Add the tile.
   result_tiles[f].emplace_back(
       f,
@@ -364,11 +421,17 @@ SparseGlobalOrderReader<BitmapType>::create_result_tiles(
   auto dim_num = array_schema_.dim_num();
 
   // Get the number of fragments to process and compute per fragment memory.
+  // Only the portion of the coordinate budget not already held by loaded
+  // tiles is split, so budget freed as fragments finish loading gets
+  // redistributed to the fragments still making progress.
   uint64_t num_fragments_to_process =
       tmp_read_state_.num_fragments_to_process();
-  per_fragment_memory_ = memory_budget_.total_budget() *
-                         memory_budget_.ratio_coords() /
-                         num_fragments_to_process;
+  const uint64_t memory_budget_coords =
+      memory_budget_.total_budget() * memory_budget_.ratio_coords();
+  const uint64_t memory_used_for_coords = std::min<uint64_t>(
+      memory_used_for_coords_total_, memory_budget_coords);
+  per_fragment_memory_ = (memory_budget_coords - memory_used_for_coords) /
+                         static_cast<double>(num_fragments_to_process);
 
   // Save which result tile list is empty.
   std::vector<uint64_t> rt_list_num_tiles(result_tiles.size());
@@ -382,13 +445,16 @@ SparseGlobalOrderReader<BitmapType>::create_result_tiles(
     throw_if_not_ok(parallel_for(
         storage_manager_->compute_tp(), 0, fragment_num, [&](uint64_t f) {
           uint64_t t = 0;
+          const uint64_t fragment_memory_budget =
+              memory_used_for_coords_[f] +
+              static_cast<uint64_t>(per_fragment_memory_);
           auto& tile_ranges = tmp_read_state_.tile_ranges(f);
           while (!tile_ranges.empty()) {
             auto& range = tile_ranges.back();
             for (t = range.first; t <= range.second; t++) {
               auto budget_exceeded = add_result_tile(
                   dim_num,
-                  per_fragment_memory_,
+                  fragment_memory_budget,
                   f,
                   t,
                   *fragment_metadata_[f],
@@ -432,6 +498,9 @@ SparseGlobalOrderReader<BitmapType>::create_result_tiles(
         storage_manager_->compute_tp(), 0, fragment_num, [&](uint64_t f) {
           uint64_t t = 0;
           auto tile_num = fragment_metadata_[f]->tile_num();
+          const uint64_t fragment_memory_budget =
+              memory_used_for_coords_[f] +
+              static_cast<uint64_t>(per_fragment_memory_);
 
           // Figure out the start index.
           auto start = read_state_.frag_idx_[f].tile_idx_;
@@ -442,7 +511,7 @@ SparseGlobalOrderReader<BitmapType>::create_result_tiles(
           for (t = start; t < tile_num; t++) {
             auto budget_exceeded = add_result_tile(
                 dim_num,
-                per_fragment_memory_,
+                fragment_memory_budget,
                 f,
                 t,
                 *fragment_metadata_[f],
@@ -902,6 +971,370 @@ void SparseGlobalOrderReader<BitmapType>::update_frag_idx(
   }
 }
 
+template <class BitmapType>
+bool SparseGlobalOrderReader<BitmapType>::can_partition_merge() const {
+  // The partitioned merge emits all duplicates and carries no
+  // deduplication, timestamp or delete state from one cell to the next.
+  if (!array_schema_.allows_dups() || consolidation_with_timestamps_ ||
+      purge_deletes_no_dups_mode_ || deletes_consolidation_no_purge_) {
+    return false;
+  }
+
+  // For overlapping ranges, a cell can expand to multiple slabs.
+  if (!std::is_same<BitmapType, uint8_t>::value) {
+    return false;
+  }
+
+  // Timestamps or delete metadata require the cells of a fragment to be
+  // seen in sequence.
+  for (auto& frag_md : fragment_metadata_) {
+    if (frag_md->has_timestamps() || frag_md->has_delete_meta()) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+template <class BitmapType>
+template <class CompType>
+tuple<bool, std::vector<ResultCellSlab>>
+SparseGlobalOrderReader<BitmapType>::merge_result_cell_slabs_parallel(
+    uint64_t num_cells, std::vector<ResultTilesList>& result_tiles) {
+  using ResultCoords = GlobalOrderResultCoords<BitmapType>;
+  const auto fragment_num = (unsigned)result_tiles.size();
+
+  // Comparator that tells us if the first coords are bigger or equal than
+  // the second one in the order of the comparator.
+  const CompType cmp_ge(
+      array_schema_.domain(), false, false, &fragment_metadata_);
+
+  // Tells us if the first coords strictly precede the second one.
+  auto cmp_lt = [&cmp_ge](const ResultCoords& a, const ResultCoords& b) {
+    return !cmp_ge(a, b);
+  };
+
+  // A position in the stream of cells of one fragment, spanning the list
+  // of loaded result tiles.
+  struct Cursor {
+    TileListIt it_;
+    uint64_t pos_;
+  };
+
+  // Initialize the start of each fragment stream from the read state and
+  // collect the first cell of every tile as a pivot candidate.
+  std::vector<Cursor> stream_start(fragment_num);
+  std::vector<ResultCoords> pivot_candidates;
+  for (unsigned f = 0; f < fragment_num; f++) {
+    stream_start[f].it_ = result_tiles[f].begin();
+    stream_start[f].pos_ = 0;
+    if (result_tiles[f].empty()) {
+      continue;
+    }
+
+    if (read_state_.frag_idx_[f].tile_idx_ ==
+        stream_start[f].it_->tile_idx()) {
+      stream_start[f].pos_ = read_state_.frag_idx_[f].cell_idx_;
+    }
+
+    for (auto it = result_tiles[f].begin(); it != result_tiles[f].end();
+         ++it) {
+      pivot_candidates.emplace_back(&*it, 0);
+    }
+  }
+
+  // If a fragment has more tiles to load, the cells after the last cell
+  // loaded for it cannot be merged yet. Compute the smallest such bound.
+  optional<ResultCoords> bound = nullopt;
+  for (unsigned f = 0; f < fragment_num; f++) {
+    if (!tmp_read_state_.all_tiles_loaded(f) && !result_tiles[f].empty()) {
+      ResultCoords last(
+          &result_tiles[f].back(), result_tiles[f].back().cell_num() - 1);
+      if (!bound.has_value() || cmp_lt(last, *bound)) {
+        bound = last;
+      }
+    }
+  }
+
+  // Select the partition pivots, each an inclusive upper bound for the
+  // coords of its partition: sort the candidates and take evenly spaced
+  // ones, dropping the ones at or past the bound, which caps the last
+  // partition when present.
+  std::sort(pivot_candidates.begin(), pivot_candidates.end(), cmp_lt);
+  const uint64_t num_threads =
+      storage_manager_->compute_tp()->concurrency_level();
+  const uint64_t max_partitions =
+      std::min<uint64_t>(num_threads, pivot_candidates.size());
+  std::vector<ResultCoords> pivots;
+  for (uint64_t p = 1; p < max_partitions; p++) {
+    const auto& candidate =
+        pivot_candidates[p * pivot_candidates.size() / max_partitions];
+    if (!bound.has_value() || cmp_lt(candidate, *bound)) {
+      pivots.emplace_back(candidate);
+    }
+  }
+  if (bound.has_value()) {
+    pivots.emplace_back(*bound);
+  }
+
+  // The last partition is unbounded if the merge isn't capped.
+  const uint64_t num_partitions =
+      pivots.size() + (bound.has_value() ? 0 : 1);
+
+  // Compute, per fragment, the first cell past the upper bound of each
+  // partition. As both the pivots and the cells of a fragment are sorted,
+  // the searches are done with a single pass over the tile list.
+  std::vector<std::vector<Cursor>> splits(fragment_num);
+  throw_if_not_ok(parallel_for(
+      storage_manager_->compute_tp(), 0, fragment_num, [&](unsigned f) {
+        splits[f].resize(pivots.size());
+        Cursor cur = stream_start[f];
+        for (uint64_t p = 0; p < pivots.size(); p++) {
+          const auto& pivot = pivots[p];
+          while (cur.it_ != result_tiles[f].end()) {
+            auto* tile = &*cur.it_;
+            const uint64_t cell_num = tile->cell_num();
+            if (cur.pos_ >= cell_num ||
+                cmp_ge(pivot, ResultCoords(tile, cell_num - 1))) {
+              // The rest of the tile is at or before the pivot, move on.
+              ++cur.it_;
+              cur.pos_ = 0;
+              continue;
+            }
+
+            // Binary search for the first cell past the pivot.
+            uint64_t left = cur.pos_, right = cell_num - 1;
+            while (left < right) {
+              const uint64_t mid = left + (right - left) / 2;
+              if (cmp_ge(pivot, ResultCoords(tile, mid))) {
+                left = mid + 1;
+              } else {
+                right = mid;
+              }
+            }
+            cur.pos_ = left;
+            break;
+          }
+          splits[f][p] = cur;
+        }
+
+        return Status::Ok();
+      }));
+
+  // Set when a fragment stream was consumed to the end of its tile list.
+  std::vector<uint8_t> stream_reached_end(fragment_num, 0);
+
+  // Merge each partition on its own thread. Every partition emits at most
+  // `num_cells` cells as any cell past that can never fit in the user
+  // buffers, no matter what the other partitions produce.
+  std::vector<std::vector<ResultCellSlab>> partition_slabs(num_partitions);
+  throw_if_not_ok(parallel_for(
+      storage_manager_->compute_tp(), 0, num_partitions, [&](uint64_t p) {
+        // Per fragment range of cells for this partition.
+        struct Stream {
+          Cursor cur_;
+          Cursor end_;
+        };
+        std::vector<Stream> streams(fragment_num);
+
+        // Advance the stream for fragment `f` to its next cell set in the
+        // bitmap, if any.
+        auto advance_to_valid_cell = [&](const unsigned f) -> bool {
+          auto& stream = streams[f];
+          while (stream.cur_.it_ != result_tiles[f].end()) {
+            auto* tile = &*stream.cur_.it_;
+            const bool last_tile = stream.cur_.it_ == stream.end_.it_;
+            const uint64_t seg_end =
+                last_tile ? stream.end_.pos_ : tile->cell_num();
+            uint64_t pos = stream.cur_.pos_;
+            if (tile->has_bmp()) {
+              auto& bitmap = tile->bitmap();
+              while (pos < seg_end && !bitmap[pos]) {
+                pos++;
+              }
+            }
+
+            if (pos < seg_end) {
+              stream.cur_.pos_ = pos;
+              return true;
+            }
+
+            if (last_tile) {
+              return false;
+            }
+
+            ++stream.cur_.it_;
+            stream.cur_.pos_ = 0;
+          }
+
+          stream_reached_end[f] = 1;
+          return false;
+        };
+
+        // A min heap with the current coords of each stream.
+        std::vector<ResultCoords> container;
+        container.reserve(fragment_num);
+        CompType cmp(
+            array_schema_.domain(), false, true, &fragment_metadata_);
+        TileMinHeap<CompType> tile_queue(cmp, std::move(container));
+        for (unsigned f = 0; f < fragment_num; f++) {
+          streams[f].cur_ = p == 0 ? stream_start[f] : splits[f][p - 1];
+          streams[f].end_ = p < pivots.size() ?
+                                splits[f][p] :
+                                Cursor{result_tiles[f].end(), 0};
+          if (advance_to_valid_cell(f)) {
+            tile_queue.emplace(&*streams[f].cur_.it_, streams[f].cur_.pos_);
+          }
+        }
+
+        auto& slabs = partition_slabs[p];
+        uint64_t cells_left = num_cells;
+        while (!tile_queue.empty() && cells_left > 0) {
+          auto to_process = tile_queue.top();
+          tile_queue.pop();
+          const unsigned f = to_process.tile_->frag_idx();
+          auto& stream = streams[f];
+
+          // Compute the length of the cell slab, bounded by the smallest
+          // coords of the other fragments.
+          uint64_t length;
+          if (tile_queue.empty()) {
+            length = to_process.max_slab_length();
+          } else if (!cmp_ge(
+                         ResultCoords(
+                             to_process.tile_,
+                             to_process.tile_->cell_num() - 1),
+                         tile_queue.top())) {
+            // The tile's last cell sorts before every other fragment's
+            // current cell, so the rest of the tile is disjoint from the
+            // other fragments and is emitted in stored order without
+            // searching for the merge bound.
+            length = to_process.max_slab_length();
+          } else {
+            length = to_process.max_slab_length(tile_queue.top(), cmp_ge);
+          }
+
+          // Clamp the slab to the end of the partition and the cell
+          // budget.
+          if (stream.cur_.it_ == stream.end_.it_) {
+            length = std::min(length, stream.end_.pos_ - to_process.pos_);
+          }
+          length = std::min(length, cells_left);
+
+          // Emit the slab.
+          to_process.tile_->set_used();
+          slabs.emplace_back(to_process.tile_, to_process.pos_, length);
+          cells_left -= length;
+
+          // Advance the stream past the emitted cells and re-insert it.
+          stream.cur_.pos_ = to_process.pos_ + length;
+          if (advance_to_valid_cell(f)) {
+            tile_queue.emplace(&*stream.cur_.it_, stream.cur_.pos_);
+          }
+        }
+
+        return Status::Ok();
+      }));
+
+  // Concatenate the partitions in order, stopping when the user buffers
+  // are full, and update the read state for the cells emitted.
+  std::vector<ResultCellSlab> result_cell_slabs;
+  for (auto& slabs : partition_slabs) {
+    for (auto& slab : slabs) {
+      if (num_cells == 0) {
+        break;
+      }
+
+      const uint64_t length = std::min(slab.length_, num_cells);
+      result_cell_slabs.emplace_back(slab.tile_, slab.start_, length);
+      update_frag_idx(
+          static_cast<GlobalOrderResultTile<BitmapType>*>(slab.tile_),
+          slab.start_ + length);
+      num_cells -= length;
+    }
+  }
+  const bool user_buffers_full = num_cells == 0;
+
+  // If everything was emitted, move the read state past the tile lists of
+  // the fully consumed fragments so the tiles are cleared on iteration
+  // end.
+  if (!user_buffers_full) {
+    for (unsigned f = 0; f < fragment_num; f++) {
+      if (stream_reached_end[f] && !result_tiles[f].empty()) {
+        read_state_.frag_idx_[f] =
+            FragIdx(result_tiles[f].back().tile_idx() + 1, 0);
+      }
+    }
+  }
+
+  logger_->debug(
+      "Done merging result cell slabs (parallel), num slabs {0}, buffers "
+      "full {1}",
+      result_cell_slabs.size(),
+      user_buffers_full);
+
+  return {user_buffers_full, std::move(result_cell_slabs)};
+}
+
+template <class BitmapType>
+tuple<bool, std::vector<ResultCellSlab>>
+SparseGlobalOrderReader<BitmapType>::merge_result_cell_slabs_global(
+    uint64_t num_cells, std::vector<ResultTilesList>& result_tiles) {
+  // For the common case of a small domain with integer dimensions of one
+  // datatype, use a comparator specialized at compile time so that the
+  // per-cell comparison in the merge is an inline integer compare instead
+  // of going through the `Domain` comparison functions for every dimension.
+  auto& domain = array_schema_.domain();
+  const auto dim_num = domain.dim_num();
+  if (dim_num <= 3) {
+    const auto type = domain.dimension_ptr(0)->type();
+    bool specializable = true;
+    for (unsigned d = 0; d < dim_num; d++) {
+      auto dim{domain.dimension_ptr(d)};
+      if (dim->type() != type || dim->var_size() || !dim->tile_extent()) {
+        specializable = false;
+        break;
+      }
+    }
+
+    if (specializable) {
+      switch (type) {
+        case Datatype::INT32:
+          return merge_result_cell_slabs_typed<int32_t>(
+              num_cells, result_tiles);
+        case Datatype::INT64:
+          return merge_result_cell_slabs_typed<int64_t>(
+              num_cells, result_tiles);
+        case Datatype::UINT64:
+          return merge_result_cell_slabs_typed<uint64_t>(
+              num_cells, result_tiles);
+        default:
+          break;
+      }
+    }
+  }
+
+  return merge_result_cell_slabs<GlobalCmpReverse>(num_cells, result_tiles);
+}
+
+template <class BitmapType>
+template <class DimType>
+tuple<bool, std::vector<ResultCellSlab>>
+SparseGlobalOrderReader<BitmapType>::merge_result_cell_slabs_typed(
+    uint64_t num_cells, std::vector<ResultTilesList>& result_tiles) {
+  switch (array_schema_.dim_num()) {
+    case 1:
+      return merge_result_cell_slabs<GlobalCmpReverseTyped<DimType, 1>>(
+          num_cells, result_tiles);
+    case 2:
+      return merge_result_cell_slabs<GlobalCmpReverseTyped<DimType, 2>>(
+          num_cells, result_tiles);
+    default:
+      return merge_result_cell_slabs<GlobalCmpReverseTyped<DimType, 3>>(
+          num_cells, result_tiles);
+  }
+}
+
 template <class BitmapType>
 template <class CompType>
 tuple<bool, std::vector<ResultCellSlab>>
@@ -914,12 +1347,29 @@ SparseGlobalOrderReader<BitmapType>::merge_result_cell_slabs(
     return {true, std::vector<ResultCellSlab>()};
   }
 
+  // Use the partitioned merge when cells can be merged independently and
+  // there are enough tiles for splitting to be worthwhile. Hilbert order
+  // is excluded as Hilbert values are only computed for cells set in the
+  // bitmaps, so the pivot searches cannot probe arbitrary positions.
+  if constexpr (!std::is_same<CompType, HilbertCmpReverse>::value) {
+    if (can_partition_merge()) {
+      uint64_t num_tiles = 0;
+      for (auto& rt_list : result_tiles) {
+        num_tiles += rt_list.size();
+      }
+      const uint64_t num_threads =
+          storage_manager_->compute_tp()->concurrency_level();
+      if (num_threads > 1 && num_tiles >= 2 * num_threads) {
+        return merge_result_cell_slabs_parallel<CompType>(
+            num_cells, result_tiles);
+      }
+    }
+  }
+
   std::vector<ResultCellSlab> result_cell_slabs;
   CompType cmp_max_slab_length(
       array_schema_.domain(), false, false, &fragment_metadata_);
 
-  // TODO Parallelize.
-
   // For easy reference.
   const bool return_all_dups =
       array_schema_.allows_dups() || consolidation_with_timestamps_;
@@ -927,12 +1377,16 @@ SparseGlobalOrderReader<BitmapType>::merge_result_cell_slabs(
   // A tile min heap, contains one GlobalOrderResultCoords per fragment.
   std::vector<GlobalOrderResultCoords<BitmapType>> container;
   container.reserve(result_tiles.size());
-  CompType cmp(
-      array_schema_.domain(),
-      !array_schema_.allows_dups(),
-      true,
-      &fragment_metadata_);
-  TileMinHeap<CompType> tile_queue(cmp, std::move(container));
+  MemoizedTilePairCmp<CompType> cmp(
+      CompType(
+          array_schema_.domain(),
+          !array_schema_.allows_dups(),
+          true,
+          &fragment_metadata_),
+      CompType(array_schema_.domain(), false, false, &fragment_metadata_),
+      !std::is_same<CompType, HilbertCmpReverse>::value);
+  TileMinHeap<MemoizedTilePairCmp<CompType>> tile_queue(
+      cmp, std::move(container));
 
   // If any fragments needs to load more tiles.
   bool need_more_tiles = false;
@@ -1068,6 +1522,15 @@ SparseGlobalOrderReader<BitmapType>::merge_result_cell_slabs(
       if (to_process.has_next_ || single_cell_only) {
         if (tile_queue.empty()) {
           length = to_process.max_slab_length();
+        } else if (!cmp_max_slab_length(
+                       GlobalOrderResultCoords<BitmapType>(
+                           to_process.tile_, to_process.tile_->cell_num() - 1),
+                       tile_queue.top())) {
+          // The tile's last cell sorts before every other fragment's current
+          // cell, so the rest of the tile is disjoint from the other
+          // fragments and is emitted in stored order without searching for
+          // the merge bound.
+          length = to_process.max_slab_length();
         } else {
           length =
               to_process.max_slab_length(tile_queue.top(), cmp_max_slab_length);
@@ -1240,21 +1703,31 @@ void SparseGlobalOrderReader<BitmapType>::copy_offsets_tiles(
             query_buffer.validity_vector_.buffer() + dest_cell_offset;
         auto var_data_buffer = &var_data[dest_cell_offset - cell_offsets[0]];
 
-        // Copy full tile.
+        // Copy full tile. The cell sizes, the elements mode division and
+        // the var data pointers are separate bulk passes over the output
+        // instead of interleaved per-cell work so that the compiler can
+        // vectorize each loop.
         if (!use_fill_value) {
           for (uint64_t c = min_pos; c < max_pos; c++) {
-            *buffer = (OffType)(src_buff[c + 1] - src_buff[c]) / offset_div;
-            buffer++;
-            *var_data_buffer = src_var_buff + src_buff[c];
-            var_data_buffer++;
+            buffer[c - min_pos] = (OffType)(src_buff[c + 1] - src_buff[c]);
           }
-        } else {
+
+          if (offset_div > 1) {
+            for (uint64_t c = min_pos; c < max_pos; c++) {
+              buffer[c - min_pos] /= offset_div;
+            }
+          }
+
           for (uint64_t c = min_pos; c < max_pos; c++) {
-            *buffer = fill_value_size / offset_div;
-            buffer++;
-            *var_data_buffer = src_var_buff;
-            var_data_buffer++;
+            var_data_buffer[c - min_pos] = src_var_buff + src_buff[c];
           }
+        } else {
+          const OffType fill_size = fill_value_size / offset_div;
+          std::fill_n(buffer, max_pos - min_pos, fill_size);
+          std::fill_n(
+              var_data_buffer,
+              max_pos - min_pos,
+              static_cast<const void*>(src_var_buff));
         }
 
         // Copy nullable values.
@@ -1262,16 +1735,10 @@ void SparseGlobalOrderReader<BitmapType>::copy_offsets_tiles(
           if (!use_fill_value) {
             const auto& t_val = tile_tuple->validity_tile();
             const auto src_val_buff = t_val.template data_as<uint8_t>();
-            for (uint64_t c = min_pos; c < max_pos; c++) {
-              *val_buffer = src_val_buff[c];
-              val_buffer++;
-            }
+            memcpy(val_buffer, src_val_buff + min_pos, max_pos - min_pos);
           } else {
             uint8_t v = array_schema_.attribute(name)->fill_value_validity();
-            for (uint64_t c = min_pos; c < max_pos; c++) {
-              *val_buffer = v;
-              val_buffer++;
-            }
+            memset(val_buffer, v, max_pos - min_pos);
           }
         }
 
@@ -1423,10 +1890,7 @@ void SparseGlobalOrderReader<BitmapType>::copy_fixed_data_tiles(
                 (max_pos - min_pos) * cell_size);
           } else {
             // Copy tile using the fill value.
-            for (uint64_t i = 0; i < max_pos - min_pos; i++) {
-              memcpy(buffer, src_buff, cell_size);
-              buffer += cell_size;
-            }
+            pattern_fill(buffer, src_buff, cell_size, max_pos - min_pos);
           }
         } else {  // Copy for zipped coords.
           const auto dim_num = rt->domain()->dim_num();
@@ -1446,10 +1910,7 @@ void SparseGlobalOrderReader<BitmapType>::copy_fixed_data_tiles(
           } else {
             // Copy the fill value for validity.
             uint8_t v = array_schema_.attribute(name)->fill_value_validity();
-            for (uint64_t i = 0; i < max_pos - min_pos; i++) {
-              *val_buffer = v;
-              val_buffer++;
-            }
+            memset(val_buffer, v, max_pos - min_pos);
           }
         }
 
@@ -1880,6 +2341,7 @@ void SparseGlobalOrderReader<BitmapType>::process_slabs(
   // Read a few attributes a a time.
   std::vector<ResultTile*> result_tiles =
       result_tiles_to_load(result_cell_slabs, false);
+  stats_->add_counter("result_tiles_loaded_for_copy", result_tiles.size());
   std::optional<std::string> last_field_to_overflow{std::nullopt};
   uint64_t buffer_idx{0};
   optional<std::vector<ResultTile*>> result_tiles_agg_only;
@@ -2147,6 +2609,7 @@ void SparseGlobalOrderReader<BitmapType>::process_aggregates(
             for (auto& aggregate : aggregates) {
               aggregate->aggregate_tile_with_frag_md(md);
             }
+            stats_->add_counter("tiles_aggregated_with_frag_md", 1);
           }
         } else {
           // Compute parallelization parameters.
@@ -2195,6 +2658,10 @@ void SparseGlobalOrderReader<BitmapType>::remove_result_tile(
   // Adjust total memory usage.
   memory_used_for_coords_total_ -= tiles_size;
 
+  // Adjust the scheduled cell count for the result budget hint.
+  result_budget_cells_scheduled_ -=
+      fragment_metadata_[frag_idx]->cell_num(tile_idx);
+
   // Delete the tile.
   result_tiles[frag_idx].erase(rt);
 }
@@ -34,6 +34,7 @@
 #define TILEDB_SPARSE_GLOBAL_ORDER_READER
 
 #include <atomic>
+#include <map>
 
 #include "tiledb/common/common.h"
 #include "tiledb/common/logger_public.h"
@@ -61,7 +62,10 @@ template <class BitmapType>
 class SparseGlobalOrderReader : public SparseIndexReaderBase,
                                 public IQueryStrategy {
  public:
-  typedef std::list<GlobalOrderResultTile<BitmapType>> ResultTilesList;
+  typedef std::list<
+      GlobalOrderResultTile<BitmapType>,
+      ArenaAllocator<GlobalOrderResultTile<BitmapType>>>
+      ResultTilesList;
 
   /* ********************************* */
   /*     CONSTRUCTORS & DESTRUCTORS    */
@@ -151,7 +155,10 @@ class SparseGlobalOrderReader : public SparseIndexReaderBase,
   /** Memory used for coordinates tiles per fragment. */
   std::vector<uint64_t> memory_used_for_coords_;
 
-  /** Memory budget per fragment. */
+  /**
+   * Share of the unallocated coordinate memory budget each fragment still
+   * loading tiles can consume on top of what it already holds.
+   */
   double per_fragment_memory_;
 
   /** Enables consolidation with timestamps or not. */
@@ -193,6 +200,138 @@ class SparseGlobalOrderReader : public SparseIndexReaderBase,
       std::vector<GlobalOrderResultCoords<BitmapType>>,
       CompType>;
 
+  /**
+   * Adapter around the tile min heap comparator that memoizes orderings
+   * decided at tile granularity. Cells in a result tile are stored in
+   * global order, so when one tile's last cell strictly precedes another
+   * tile's first cell, every cross-tile comparison between the two tiles
+   * has the same outcome. The adapter verifies this once per tile pair
+   * and answers subsequent comparisons for the pair without looking at
+   * coordinates, which removes most of the per-cell comparisons done by
+   * the heap reinsertions in `add_next_cell_to_queue` as tiles drain.
+   *
+   * Strict coordinate disjointness is required for the certificate:
+   * comparisons between equal coordinates are decided by timestamps or
+   * fragment indexes and cannot be answered at tile granularity. Copies
+   * of the adapter share the memo (`std::priority_queue` copies its
+   * comparator). The memo is not synchronized internally as heap
+   * operations happen either under `tile_queue_mutex_` or on a single
+   * thread.
+   */
+  template <typename CompType>
+  class MemoizedTilePairCmp {
+   public:
+    /**
+     * Constructor.
+     *
+     * @param cmp Comparator to adapt.
+     * @param coords_cmp Comparator on coordinates only (no timestamps, no
+     * strict ordering) used to certify strict tile disjointness.
+     * @param enabled Memoize tile pair orderings or not. Should be
+     * disabled for Hilbert order, where per-cell values are only computed
+     * for cells set in the bitmaps and the first and last cells of a tile
+     * cannot be compared.
+     */
+    MemoizedTilePairCmp(CompType cmp, CompType coords_cmp, bool enabled)
+        : cmp_(std::move(cmp))
+        , coords_cmp_(std::move(coords_cmp))
+        , enabled_(enabled)
+        , memo_(std::make_shared<Memo>()) {
+    }
+
+    /**
+     * Comparison operator, with the same semantics as the adapted
+     * comparator.
+     *
+     * @param a The first coordinate.
+     * @param b The second coordinate.
+     * @return Result of the adapted comparator for `a` and `b`.
+     */
+    bool operator()(
+        const GlobalOrderResultCoords<BitmapType>& a,
+        const GlobalOrderResultCoords<BitmapType>& b) const {
+      if (enabled_ && a.tile_ != b.tile_) {
+        switch (tile_pair_order(a, b)) {
+          case TilePairOrder::FIRST_BEFORE_SECOND:
+            // `a` precedes `b`, so it has higher priority in the reverse
+            // order used by the heap.
+            return false;
+          case TilePairOrder::SECOND_BEFORE_FIRST:
+            return true;
+          case TilePairOrder::UNKNOWN:
+            break;
+        }
+      }
+
+      return cmp_(a, b);
+    }
+
+   private:
+    /** Relative order of the cells of two tiles. */
+    enum class TilePairOrder {
+      FIRST_BEFORE_SECOND,
+      SECOND_BEFORE_FIRST,
+      UNKNOWN
+    };
+
+    /** Memoized order per pair of tiles, keyed on the tile addresses. */
+    using Memo = std::map<std::pair<const void*, const void*>, TilePairOrder>;
+
+    /**
+     * Returns the memoized order for the tiles of `a` and `b`, computing
+     * and caching it on the first call for the pair.
+     *
+     * @param a A coordinate of the first tile.
+     * @param b A coordinate of the second tile.
+     * @return Relative order of the two tiles.
+     */
+    TilePairOrder tile_pair_order(
+        const GlobalOrderResultCoords<BitmapType>& a,
+        const GlobalOrderResultCoords<BitmapType>& b) const {
+      auto* t1 = a.tile_;
+      auto* t2 = b.tile_;
+      auto key = std::make_pair(
+          static_cast<const void*>(t1), static_cast<const void*>(t2));
+      auto it = memo_->find(key);
+      if (it != memo_->end()) {
+        return it->second;
+      }
+
+      // `coords_cmp_` reverses the coordinate order, so a `false` result
+      // on (last cell of t1, first cell of t2) certifies that t1's
+      // maximum strictly precedes t2's minimum.
+      auto order = TilePairOrder::UNKNOWN;
+      auto reverse = TilePairOrder::UNKNOWN;
+      GlobalOrderResultCoords<BitmapType> first_1(t1, 0);
+      GlobalOrderResultCoords<BitmapType> last_1(t1, t1->cell_num() - 1);
+      GlobalOrderResultCoords<BitmapType> first_2(t2, 0);
+      GlobalOrderResultCoords<BitmapType> last_2(t2, t2->cell_num() - 1);
+      if (!coords_cmp_(last_1, first_2)) {
+        order = TilePairOrder::FIRST_BEFORE_SECOND;
+        reverse = TilePairOrder::SECOND_BEFORE_FIRST;
+      } else if (!coords_cmp_(last_2, first_1)) {
+        order = TilePairOrder::SECOND_BEFORE_FIRST;
+        reverse = TilePairOrder::FIRST_BEFORE_SECOND;
+      }
+
+      memo_->emplace(key, order);
+      memo_->emplace(std::make_pair(key.second, key.first), reverse);
+      return order;
+    }
+
+    /** Adapted comparator. */
+    CompType cmp_;
+
+    /** Coordinates only comparator used for the disjointness checks. */
+    CompType coords_cmp_;
+
+    /** Memoize tile pair orderings or not. */
+    bool enabled_;
+
+    /** Memo shared between copies of the adapter. */
+    std::shared_ptr<Memo> memo_;
+  };
+
   /** Tile list iterator. */
   using TileListIt = typename ResultTilesList::iterator;
 
@@ -216,6 +355,9 @@ class SparseGlobalOrderReader : public SparseIndexReaderBase,
 
   /**
    * Add a result tile to process, making sure maximum budget is respected.
+   * The first tile of a fragment with no loaded tiles is allowed to exceed
+   * the per fragment budget and borrow from the unused portion of the global
+   * coordinate budget so that every fragment can make progress.
    *
    * @param dim_num Number of dimensions.
    * @param memory_budget_coords_tiles Memory budget for coordinate tiles.
@@ -362,6 +504,61 @@ class SparseGlobalOrderReader : public SparseIndexReaderBase,
   tuple<bool, std::vector<ResultCellSlab>> merge_result_cell_slabs(
       uint64_t num_cells, std::vector<ResultTilesList>& result_tiles);
 
+  /**
+   * Compute the result cell slabs for the global cell order, using a
+   * comparator specialized at compile time for the array domain when it has
+   * at most three fixed-sized integer dimensions of the same datatype, and
+   * the generic `GlobalCmpReverse` otherwise.
+   *
+   * @param num_cells Number of cells that can be copied in the user buffer.
+   * @param result_tiles Result tiles per fragment.
+   *
+   * @return user_buffers_full, result_cell_slabs.
+   */
+  tuple<bool, std::vector<ResultCellSlab>> merge_result_cell_slabs_global(
+      uint64_t num_cells, std::vector<ResultTilesList>& result_tiles);
+
+  /**
+   * Dispatch `merge_result_cell_slabs` on the number of dimensions for a
+   * domain with dimensions of datatype `DimType`.
+   *
+   * @param num_cells Number of cells that can be copied in the user buffer.
+   * @param result_tiles Result tiles per fragment.
+   *
+   * @return user_buffers_full, result_cell_slabs.
+   */
+  template <class DimType>
+  tuple<bool, std::vector<ResultCellSlab>> merge_result_cell_slabs_typed(
+      uint64_t num_cells, std::vector<ResultTilesList>& result_tiles);
+
+  /**
+   * Can the result cell slabs merge be partitioned across threads.
+   *
+   * When duplicates are returned as-is and no timestamp or delete
+   * processing is involved, emitting a cell carries no state to the cells
+   * after it, so the merge can be cut into disjoint key ranges that are
+   * processed independently.
+   *
+   * @return true if the partitioned merge can be used.
+   */
+  bool can_partition_merge() const;
+
+  /**
+   * Compute the result cell slabs by partitioning the global order domain
+   * into disjoint key ranges, merging each range on its own thread and
+   * concatenating the outputs, which preserves the global order by
+   * construction. Pivots are taken from the first cells of the loaded
+   * result tiles. Only valid when `can_partition_merge()` returns true.
+   *
+   * @param num_cells Number of cells that can be copied in the user buffer.
+   * @param result_tiles Result tiles per fragment.
+   *
+   * @return user_buffers_full, result_cell_slabs.
+   */
+  template <class CompType>
+  tuple<bool, std::vector<ResultCellSlab>> merge_result_cell_slabs_parallel(
+      uint64_t num_cells, std::vector<ResultTilesList>& result_tiles);
+
   /**
    * Compute parallelization parameters for a tile copy operation.
    *
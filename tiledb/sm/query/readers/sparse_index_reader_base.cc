@@ -39,6 +39,7 @@
 #include "tiledb/sm/fragment/fragment_metadata.h"
 #include "tiledb/sm/misc/parallel_functions.h"
 #include "tiledb/sm/misc/resource_pool.h"
+#include "tiledb/sm/query/deletes_and_updates/serialization.h"
 #include "tiledb/sm/query/iquery_strategy.h"
 #include "tiledb/sm/query/query_buffer.h"
 #include "tiledb/sm/query/query_macros.h"
@@ -95,9 +96,14 @@ SparseIndexReaderBase::SparseIndexReaderBase(
     , include_coords_(include_coords)
     , array_memory_tracker_(array->memory_tracker())
     , memory_used_for_coords_total_(0)
+    , result_budget_cells_scheduled_(0)
     , deletes_consolidation_no_purge_(
           buffers_.count(constants::delete_timestamps) != 0)
-    , partial_tile_offsets_loading_(false) {
+    , partial_tile_offsets_loading_(false)
+    , attribute_prefetch_depth_(config_.get<uint64_t>(
+          "sm.query.attribute_prefetch_depth", Config::must_find))
+    , result_budget_cells_(config_.get<uint64_t>(
+          "sm.query.sparse.result_budget_cells", Config::must_find)) {
   // Sanity checks
   if (storage_manager_ == nullptr) {
     throw SparseIndexReaderBaseStatusException(
@@ -147,6 +153,11 @@ SparseIndexReaderBase::SparseIndexReaderBase(
   check_validity_buffer_sizes();
 }
 
+SparseIndexReaderBase::~SparseIndexReaderBase() {
+  // In flight prefetched reads write into buffers owned by this object.
+  drain_attribute_prefetches();
+}
+
 /* ****************************** */
 /*        PROTECTED METHODS       */
 /* ****************************** */
@@ -166,6 +177,11 @@ uint64_t SparseIndexReaderBase::available_memory() {
          array_memory_tracker_->get_memory_usage();
 }
 
+bool SparseIndexReaderBase::result_budget_reached() const {
+  return result_budget_cells_ != 0 &&
+         result_budget_cells_scheduled_ >= result_budget_cells_;
+}
+
 std::vector<uint64_t> SparseIndexReaderBase::tile_offset_sizes() {
   auto timer_se = stats_->start_timer("tile_offset_sizes");
 
@@ -361,6 +377,9 @@ Status SparseIndexReaderBase::load_initial_data() {
     load_processed_conditions();
   }
 
+  // Pre-compile the per fragment list of delete conditions to apply.
+  compute_delete_conditions_to_apply();
+
   // Make a list of dim/attr that will be loaded for query condition.
   if (condition_.has_value()) {
     for (auto& name : condition_->field_names()) {
@@ -515,18 +534,24 @@ void SparseIndexReaderBase::load_tile_offsets_for_fragments(
 
 Status SparseIndexReaderBase::read_and_unfilter_coords(
     const std::vector<ResultTile*>& result_tiles) {
+  return read_and_unfilter_coords(result_tiles, result_tiles);
+}
+
+Status SparseIndexReaderBase::read_and_unfilter_coords(
+    const std::vector<ResultTile*>& coords_result_tiles,
+    const std::vector<ResultTile*>& result_tiles) {
   auto timer_se = stats_->start_timer("read_and_unfilter_coords");
 
   if (include_coords_) {
     // Read and unfilter zipped coordinate tiles. Note that
     // this will ignore fragments with a version >= 5.
-    RETURN_CANCEL_OR_ERROR(
-        read_and_unfilter_coordinate_tiles({constants::coords}, result_tiles));
+    RETURN_CANCEL_OR_ERROR(read_and_unfilter_coordinate_tiles(
+        {constants::coords}, coords_result_tiles));
 
     // Read and unfilter unzipped coordinate tiles. Note that
     // this will ignore fragments with a version < 5.
     RETURN_CANCEL_OR_ERROR(
-        read_and_unfilter_coordinate_tiles(dim_names_, result_tiles));
+        read_and_unfilter_coordinate_tiles(dim_names_, coords_result_tiles));
   }
 
   // Compute attributes to load.
@@ -560,6 +585,40 @@ Status SparseIndexReaderBase::read_and_unfilter_coords(
   return Status::Ok();
 }
 
+bool SparseIndexReaderBase::tile_fully_covered(const ResultTile& rt) const {
+  // For easy reference.
+  const auto& domain{array_schema_.domain()};
+  const auto dim_num = array_schema_.dim_num();
+  const auto& mbr = fragment_metadata_[rt.frag_idx()]->mbr(rt.tile_idx());
+
+  // The tile is fully covered if, for every non-default dimension, the MBR
+  // is covered by one of the subarray ranges for that dimension.
+  for (unsigned d = 0; d < dim_num; d++) {
+    if (subarray_.is_default(d)) {
+      continue;
+    }
+
+    auto& ranges_for_dim = subarray_.ranges_for_dim(d);
+
+    // Compute the list of range index to process.
+    std::vector<uint64_t> relevant_ranges;
+    relevant_ranges.reserve(ranges_for_dim.size());
+    domain.dimension_ptr(d)->relevant_ranges(
+        ranges_for_dim, mbr[d], relevant_ranges);
+
+    // See if any range covers the MBR for this dimension.
+    std::vector<bool> covered_bitmap = domain.dimension_ptr(d)->covered_vec(
+        ranges_for_dim, mbr[d], relevant_ranges);
+    uint64_t count =
+        std::accumulate(covered_bitmap.begin(), covered_bitmap.end(), 0);
+    if (count == 0) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 template <class BitmapType>
 void SparseIndexReaderBase::compute_tile_bitmaps(
     std::vector<ResultTile*>& result_tiles) {
@@ -712,6 +771,83 @@ void SparseIndexReaderBase::compute_tile_bitmaps(
   logger_->debug("Done computing tile bitmaps");
 }
 
+void SparseIndexReaderBase::compute_delete_conditions_to_apply() {
+  delete_conditions_to_apply_.clear();
+  delete_conditions_to_apply_.resize(fragment_metadata_.size());
+  if (delete_and_update_conditions_.empty()) {
+    return;
+  }
+
+  auto timer_se = stats_->start_timer("compute_delete_conditions_to_apply");
+
+  // Process the conditions in timestamp order so that, per fragment, a later
+  // condition with an identical predicate can subsume an earlier one.
+  std::vector<uint64_t> order(delete_and_update_conditions_.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](uint64_t a, uint64_t b) {
+    return delete_and_update_conditions_[a].condition_timestamp() <
+           delete_and_update_conditions_[b].condition_timestamp();
+  });
+
+  // Serialize the predicates once to identify conditions that only differ by
+  // condition marker or timestamp. Not needed for deletes consolidation,
+  // where every condition has to be applied separately to attribute deleted
+  // cells to the condition that deleted them.
+  std::vector<std::string> predicates;
+  if (!deletes_consolidation_no_purge_) {
+    predicates.reserve(delete_and_update_conditions_.size());
+    for (auto& condition : delete_and_update_conditions_) {
+      auto tile =
+          deletes_and_updates::serialization::serialize_condition(condition);
+      predicates.emplace_back(
+          static_cast<const char*>(tile.data()), tile.size());
+    }
+  }
+
+  for (uint64_t f = 0; f < fragment_metadata_.size(); f++) {
+    auto& frag_meta = fragment_metadata_[f];
+    auto& to_apply = delete_conditions_to_apply_[f];
+    std::unordered_map<std::string_view, uint64_t> predicate_to_pos;
+
+    for (auto i : order) {
+      // Skip conditions the fragment already processed.
+      if (frag_meta->has_delete_meta() &&
+          frag_meta->get_processed_conditions_set().count(
+              delete_and_update_conditions_[i].condition_marker()) != 0) {
+        continue;
+      }
+
+      // Skip conditions with a timestamp before the fragment start.
+      auto delete_timestamp =
+          delete_and_update_conditions_[i].condition_timestamp();
+      if (delete_timestamp < frag_meta->timestamp_range().first) {
+        continue;
+      }
+
+      // Use the timestamped condition if the condition falls within the
+      // fragment timestamps.
+      const bool timestamped =
+          frag_meta->has_timestamps() &&
+          delete_timestamp <= frag_meta->timestamp_range().second;
+
+      if (!deletes_consolidation_no_purge_) {
+        // A later condition with an identical predicate deletes a superset
+        // of the cells deleted by an earlier one, so only the latest one
+        // needs to be applied.
+        auto it = predicate_to_pos.find(predicates[i]);
+        if (it != predicate_to_pos.end()) {
+          to_apply[it->second] = {i, timestamped};
+          continue;
+        }
+
+        predicate_to_pos.emplace(predicates[i], to_apply.size());
+      }
+
+      to_apply.push_back({i, timestamped});
+    }
+  }
+}
+
 template <class ResultTileType, class BitmapType>
 void SparseIndexReaderBase::apply_query_condition(
     std::vector<ResultTile*>& result_tiles) {
@@ -730,8 +866,11 @@ void SparseIndexReaderBase::apply_query_condition(
           const auto frag_meta = fragment_metadata_[rt->frag_idx()];
 
           // If timestamps are present and fragment is partially included,
-          // filter out tiles based on time by applying the query condition
-          if (process_partial_timestamps(*frag_meta)) {
+          // filter out tiles based on time by applying the query condition.
+          // Tiles whose timestamp range lies fully inside the open range
+          // are skipped: every cell of them passes the condition.
+          if (process_partial_timestamps(*frag_meta) &&
+              !timestamps_within_open_range(*frag_meta, rt->tile_idx())) {
             // Make a bitmap, if required.
             if (!rt->has_bmp()) {
               rt->alloc_bitmap();
@@ -762,12 +901,41 @@ void SparseIndexReaderBase::apply_query_condition(
             }
           }
 
-          // Compute the result of the query condition for this tile.
+          // Compute the result of the query condition for this tile. The
+          // per-cell verdicts are cached for the lifetime of the query so
+          // that tiles evicted and reloaded by successive submits of an
+          // incomplete query are not re-evaluated.
           if (condition_.has_value()) {
-            RETURN_NOT_OK(condition_->apply_sparse<BitmapType>(
-                *(frag_meta->array_schema().get()),
-                *rt,
-                rt->post_dedup_bitmap()));
+            const std::vector<uint8_t>* qc_results = nullptr;
+            {
+              std::unique_lock<std::mutex> lck(qc_results_cache_mutex_);
+              auto it = qc_results_cache_.find(
+                  IgnoredTile(rt->frag_idx(), rt->tile_idx()));
+              if (it != qc_results_cache_.end()) {
+                qc_results = &it->second;
+              }
+            }
+
+            if (qc_results == nullptr) {
+              std::vector<uint8_t> results(rt->cell_num(), 1);
+              RETURN_NOT_OK(condition_->apply_sparse<uint8_t>(
+                  *(frag_meta->array_schema().get()), *rt, results));
+
+              std::unique_lock<std::mutex> lck(qc_results_cache_mutex_);
+              qc_results =
+                  &qc_results_cache_
+                       .emplace(
+                           IgnoredTile(rt->frag_idx(), rt->tile_idx()),
+                           std::move(results))
+                       .first->second;
+            }
+
+            // Combine the verdicts into the bitmap.
+            auto& bitmap = rt->post_dedup_bitmap();
+            for (uint64_t c = 0; c < qc_results->size(); c++) {
+              bitmap[c] *= (*qc_results)[c];
+            }
+
             if (array_schema_.allows_dups()) {
               rt->count_cells();
             }
@@ -782,51 +950,88 @@ void SparseIndexReaderBase::apply_query_condition(
               rt->allocate_per_cell_delete_condition_vector();
             }
 
-            for (uint64_t i = 0; i < delete_and_update_conditions_.size();
-                 i++) {
-              if (!frag_meta->has_delete_meta() ||
-                  frag_meta->get_processed_conditions_set().count(
-                      delete_and_update_conditions_[i].condition_marker()) ==
-                      0) {
-                auto delete_timestamp =
-                    delete_and_update_conditions_[i].condition_timestamp();
-
-                // Check the delete condition timestamp is after the fragment
-                // start.
-                if (delete_timestamp >= frag_meta->timestamp_range().first) {
-                  // Apply timestamped condition or regular condition.
-                  if (!frag_meta->has_timestamps() ||
-                      delete_timestamp > frag_meta->timestamp_range().second) {
-                    RETURN_NOT_OK(delete_and_update_conditions_[i]
-                                      .apply_sparse<BitmapType>(
-                                          *(frag_meta->array_schema().get()),
-                                          *rt,
-                                          rt->post_dedup_bitmap()));
-                  } else {
-                    RETURN_NOT_OK(timestamped_delete_and_update_conditions_[i]
-                                      .apply_sparse<BitmapType>(
-                                          *(frag_meta->array_schema().get()),
-                                          *rt,
-                                          rt->post_dedup_bitmap()));
-                  }
-
-                  if (deletes_consolidation_no_purge_) {
-                    // This is a post processing step during deletes
-                    // consolidation to set the delete condition pointer to
-                    // the current delete condition if the cells was cleared
-                    // by this condition and not any previous conditions.
-                    rt->compute_per_cell_delete_condition(
-                        &delete_and_update_conditions_[i]);
-                  } else {
-                    // Count cells is dups are allowed as the regular bitmap was
-                    // modified.
-                    if (array_schema_.allows_dups()) {
-                      rt->count_cells();
-                    }
-                  }
+            // Apply the conditions pre-compiled for this fragment, resolved
+            // to their regular or timestamped form.
+            auto& to_apply = delete_conditions_to_apply_[rt->frag_idx()];
+
+            // The per-tile verdicts of the delete conditions are fully
+            // determined by the fragment, the tile index and the ordered
+            // set of applied conditions, all immutable with unique
+            // timestamped names, so they are materialized in a context
+            // level cache and applied with a multiply on a hit instead of
+            // re-evaluating old delete predicates on every query. Not
+            // applicable to deletes consolidation, which has to attribute
+            // every deleted cell to the condition that deleted it.
+            auto cache = storage_manager_->deletion_vector_cache();
+            const bool use_cache = cache->enabled() &&
+                                   !deletes_consolidation_no_purge_ &&
+                                   !to_apply.empty();
+            std::string key;
+            if (use_cache) {
+              key = frag_meta->fragment_uri().to_string();
+              key += "/" + std::to_string(rt->tile_idx());
+              for (auto& condition_to_apply : to_apply) {
+                const auto i = condition_to_apply.condition_index_;
+                key += delete_and_update_conditions_[i].condition_marker();
+                key += condition_to_apply.timestamped_ ? "/t" : "/r";
+              }
+            }
+
+            shared_ptr<const std::vector<uint8_t>> verdicts;
+            if (use_cache && cache->lookup(key, &verdicts)) {
+              auto& bitmap = rt->post_dedup_bitmap();
+              for (uint64_t c = 0; c < verdicts->size(); c++) {
+                bitmap[c] *= (*verdicts)[c];
+              }
+            } else if (use_cache) {
+              // Evaluate into a fresh verdict vector so the cached entry
+              // is independent of this query's bitmap, then combine.
+              auto results =
+                  make_shared<std::vector<uint8_t>>(HERE(), rt->cell_num(), 1);
+              for (auto& condition_to_apply : to_apply) {
+                const auto i = condition_to_apply.condition_index_;
+                QueryCondition& condition =
+                    condition_to_apply.timestamped_ ?
+                        timestamped_delete_and_update_conditions_[i] :
+                        delete_and_update_conditions_[i];
+                RETURN_NOT_OK(condition.apply_sparse<uint8_t>(
+                    *(frag_meta->array_schema().get()), *rt, *results));
+              }
+
+              auto& bitmap = rt->post_dedup_bitmap();
+              for (uint64_t c = 0; c < results->size(); c++) {
+                bitmap[c] *= (*results)[c];
+              }
+              cache->insert_entry(key, std::move(results));
+            } else {
+              for (auto& condition_to_apply : to_apply) {
+                const auto i = condition_to_apply.condition_index_;
+                QueryCondition& condition =
+                    condition_to_apply.timestamped_ ?
+                        timestamped_delete_and_update_conditions_[i] :
+                        delete_and_update_conditions_[i];
+                RETURN_NOT_OK(condition.apply_sparse<BitmapType>(
+                    *(frag_meta->array_schema().get()),
+                    *rt,
+                    rt->post_dedup_bitmap()));
+
+                if (deletes_consolidation_no_purge_) {
+                  // This is a post processing step during deletes
+                  // consolidation to set the delete condition pointer to
+                  // the current delete condition if the cells was cleared
+                  // by this condition and not any previous conditions.
+                  rt->compute_per_cell_delete_condition(
+                      &delete_and_update_conditions_[i]);
                 }
               }
             }
+
+            // Count cells if dups are allowed as the regular bitmap was
+            // modified.
+            if (!to_apply.empty() && !deletes_consolidation_no_purge_ &&
+                array_schema_.allows_dups()) {
+              rt->count_cells();
+            }
           }
 
           return Status::Ok();
@@ -845,11 +1050,80 @@ std::vector<std::string> SparseIndexReaderBase::read_and_unfilter_attributes(
   auto timer_se = stats_->start_timer("read_and_unfilter_attributes");
   const uint64_t memory_budget = available_memory();
 
-  std::vector<ReaderBase::NameToLoad> names_to_read;
-  std::vector<std::string> names_to_copy;
-  uint64_t memory_used = 0;
-  while (*buffer_idx < names.size()) {
-    auto& name = names[*buffer_idx];
+  // Take the batch whose reads were issued while an earlier batch was
+  // copied, if it is the one we are asked for; otherwise plan it now.
+  optional<PrefetchedAttributeBatch> prefetched = nullopt;
+  if (!prefetched_attr_batches_.empty()) {
+    if (!agg_only &&
+        prefetched_attr_batches_.front().batch_.start_idx_ == *buffer_idx) {
+      prefetched = std::move(prefetched_attr_batches_.front());
+      prefetched_attr_batches_.pop_front();
+    } else {
+      // The copy loop took a different path than the prefetch assumed.
+      drain_attribute_prefetches();
+    }
+  }
+
+  auto batch = prefetched.has_value() ?
+                   prefetched->batch_ :
+                   plan_attribute_batch(
+                       names,
+                       mem_usage_per_attr,
+                       *buffer_idx,
+                       agg_only,
+                       memory_budget);
+  *buffer_idx = batch.end_idx_;
+
+  // Read and unfilter tiles. For a prefetched batch, the reads are already
+  // in flight; wait them out and unfilter each field as soon as its own
+  // reads complete, same as `read_and_unfilter_attribute_tiles`.
+  if (prefetched.has_value()) {
+    Status st = Status::Ok();
+    for (uint64_t n = 0; n < prefetched->read_tasks_.size(); n++) {
+      auto statuses{
+          storage_manager_->io_tp()->wait_all_status(prefetched->read_tasks_[n])};
+      for (const auto& read_st : statuses) {
+        if (!read_st.ok() && st.ok()) {
+          st = read_st;
+        }
+      }
+
+      if (st.ok()) {
+        st = unfilter_tiles(
+            batch.names_to_read_[n].name(),
+            batch.names_to_read_[n].validity_only(),
+            result_tiles);
+      }
+    }
+    throw_if_not_ok(st);
+  } else {
+    throw_if_not_ok(
+        read_and_unfilter_attribute_tiles(batch.names_to_read_, result_tiles));
+  }
+
+  // Issue the reads of the following batches so that the copy of this one
+  // overlaps their I/O round trips.
+  if (attribute_prefetch_depth_ > 0 && !agg_only &&
+      !storage_manager_->tile_cache()->enabled()) {
+    prefetch_attribute_batches(
+        names, mem_usage_per_attr, batch, result_tiles, memory_budget);
+  }
+
+  return batch.names_to_copy_;
+}
+
+SparseIndexReaderBase::AttributeBatch
+SparseIndexReaderBase::plan_attribute_batch(
+    const std::vector<std::string>& names,
+    const std::vector<uint64_t>& mem_usage_per_attr,
+    uint64_t buffer_idx,
+    bool agg_only,
+    uint64_t memory_budget) {
+  AttributeBatch batch;
+  batch.start_idx_ = buffer_idx;
+  batch.memory_used_ = 0;
+  while (buffer_idx < names.size()) {
+    auto& name = names[buffer_idx];
 
     // Stop processing if we are doing non aggregates only fields and we hit an
     // aggregates only field. Aggregates only field will pass in a filteted list
@@ -858,27 +1132,69 @@ std::vector<std::string> SparseIndexReaderBase::read_and_unfilter_attributes(
       break;
     }
 
-    auto attr_mem_usage = mem_usage_per_attr[*buffer_idx];
-    if (memory_used + attr_mem_usage < memory_budget) {
-      memory_used += attr_mem_usage;
+    auto attr_mem_usage = mem_usage_per_attr[buffer_idx];
+    if (batch.memory_used_ + attr_mem_usage < memory_budget) {
+      batch.memory_used_ += attr_mem_usage;
 
       // We only read attributes, so dimensions have 0 cost.
       if (attr_mem_usage != 0) {
-        names_to_read.emplace_back(name, null_count_aggregate_only(name));
+        batch.names_to_read_.emplace_back(
+            name, null_count_aggregate_only(name));
       }
 
-      names_to_copy.emplace_back(name);
-      (*buffer_idx)++;
+      batch.names_to_copy_.emplace_back(name);
+      buffer_idx++;
     } else {
       break;
     }
   }
+  batch.end_idx_ = buffer_idx;
+
+  return batch;
+}
+
+void SparseIndexReaderBase::prefetch_attribute_batches(
+    const std::vector<std::string>& names,
+    const std::vector<uint64_t>& mem_usage_per_attr,
+    const AttributeBatch& current_batch,
+    std::vector<ResultTile*>& result_tiles,
+    uint64_t memory_budget) {
+  // The current batch and the batches already in flight stay resident while
+  // the new reads run, so the new batches only get what they leave over.
+  uint64_t planned_idx = current_batch.end_idx_;
+  uint64_t memory_left =
+      memory_budget - std::min(memory_budget, current_batch.memory_used_);
+  for (auto& prefetched : prefetched_attr_batches_) {
+    planned_idx = prefetched.batch_.end_idx_;
+    memory_left -= std::min(memory_left, prefetched.batch_.memory_used_);
+  }
 
-  // Read and unfilter tiles.
-  throw_if_not_ok(
-      read_and_unfilter_attribute_tiles(names_to_read, result_tiles));
+  while (prefetched_attr_batches_.size() < attribute_prefetch_depth_ &&
+         planned_idx < names.size() && !aggregate_only(names[planned_idx])) {
+    auto batch = plan_attribute_batch(
+        names, mem_usage_per_attr, planned_idx, false, memory_left);
+    if (batch.names_to_copy_.empty()) {
+      break;
+    }
 
-  return names_to_copy;
+    PrefetchedAttributeBatch prefetched;
+    prefetched.batch_ = std::move(batch);
+    prefetched.filtered_data_ = read_tiles_no_wait(
+        prefetched.batch_.names_to_read_, result_tiles, prefetched.read_tasks_);
+    planned_idx = prefetched.batch_.end_idx_;
+    memory_left -= std::min(memory_left, prefetched.batch_.memory_used_);
+    prefetched_attr_batches_.emplace_back(std::move(prefetched));
+    stats_->add_counter("attribute_batches_prefetched", 1);
+  }
+}
+
+void SparseIndexReaderBase::drain_attribute_prefetches() {
+  for (auto& prefetched : prefetched_attr_batches_) {
+    for (auto& tasks : prefetched.read_tasks_) {
+      storage_manager_->io_tp()->wait_all_status(tasks);
+    }
+  }
+  prefetched_attr_batches_.clear();
 }
 
 std::vector<std::string> SparseIndexReaderBase::field_names_to_process() {
@@ -33,12 +33,15 @@
 #ifndef TILEDB_SPARSE_INDEX_READER_BASE_H
 #define TILEDB_SPARSE_INDEX_READER_BASE_H
 
+#include <deque>
 #include <queue>
 #include "reader_base.h"
 #include "tiledb/common/common.h"
+#include "tiledb/common/dynamic_memory/arena_allocator.h"
 #include "tiledb/common/status.h"
 #include "tiledb/sm/array_schema/dimension.h"
 #include "tiledb/sm/query/query_condition.h"
+#include "tiledb/sm/query/readers/filtered_data.h"
 #include "tiledb/sm/query/readers/result_cell_slab.h"
 #include "tiledb/sm/storage_manager/storage_manager_declaration.h"
 
@@ -484,6 +487,19 @@ class SparseIndexReaderBase : public ReaderBase {
     std::mutex ignored_tiles_mutex_;
   };
 
+  /**
+   * A delete or update condition to apply to the tiles of a fragment,
+   * pre-resolved to either the regular or the timestamped form of the
+   * condition.
+   */
+  struct DeleteConditionToApply {
+    /** Index of the condition in `delete_and_update_conditions_`. */
+    uint64_t condition_index_;
+
+    /** Should the timestamped form of the condition be applied. */
+    bool timestamped_;
+  };
+
   /* ********************************* */
   /*     CONSTRUCTORS & DESTRUCTORS    */
   /* ********************************* */
@@ -505,8 +521,8 @@ class SparseIndexReaderBase : public ReaderBase {
       bool skip_checks_serialization,
       bool include_coords);
 
-  /** Destructor. */
-  ~SparseIndexReaderBase() = default;
+  /** Destructor. Waits out any attribute reads issued ahead of time. */
+  ~SparseIndexReaderBase();
 
   /* ********************************* */
   /*          PUBLIC METHODS           */
@@ -552,18 +568,52 @@ class SparseIndexReaderBase : public ReaderBase {
   /** Memory tracker object for the array. */
   MemoryTracker* array_memory_tracker_;
 
+  /**
+   * Pool for the result tile list nodes. Result tiles are created and
+   * destroyed in bulk on every iteration, so their list nodes are carved
+   * out of a per-query arena that recycles nodes without going through
+   * the global heap and is freed wholesale when the reader is destroyed.
+   */
+  tiledb::common::MemoryArena result_tile_arena_;
+
   /** Memory used for coordinates tiles. */
   std::atomic<uint64_t> memory_used_for_coords_total_;
 
+  /**
+   * Number of cells in the result tiles currently scheduled for processing.
+   * Maintained so that tile scheduling can honor `result_budget_cells_`.
+   */
+  std::atomic<uint64_t> result_budget_cells_scheduled_;
+
   /** Are we in elements mode. */
   bool elements_mode_;
 
   /** Names of dim/attr loaded for query condition. */
   std::vector<std::string> qc_loaded_attr_names_;
 
+  /**
+   * Per-tile query condition results, cached for the lifetime of the query.
+   * Incomplete queries can evict and reload the same tiles on successive
+   * submits; the cached per-cell verdicts let resubmissions skip
+   * re-evaluating the condition on the reloaded tile data.
+   */
+  std::unordered_map<IgnoredTile, std::vector<uint8_t>, ignored_tile_hash>
+      qc_results_cache_;
+
+  /** Mutex protecting `qc_results_cache_`. */
+  std::mutex qc_results_cache_mutex_;
+
   /** Are we doing deletes consolidation (without purge option). */
   bool deletes_consolidation_no_purge_;
 
+  /**
+   * Per fragment, pre-compiled list of delete and update conditions to apply
+   * to its tiles. Compiled once per query so that tile processing does not
+   * redo the processed conditions lookups, timestamp range checks and
+   * duplicate predicate elimination for every tile.
+   */
+  std::vector<std::vector<DeleteConditionToApply>> delete_conditions_to_apply_;
+
   /** Do we allow partial tile offset loading for this query? */
   bool partial_tile_offsets_loading_;
 
@@ -576,6 +626,54 @@ class SparseIndexReaderBase : public ReaderBase {
   /** Per fragment tile offsets memory usage. */
   std::vector<uint64_t> per_frag_tile_offsets_usage_;
 
+  /** A batch of attribute names that fits in the memory budget. */
+  struct AttributeBatch {
+    /** Index of the first name covered by the batch. */
+    uint64_t start_idx_;
+
+    /** Index of the first name after the batch. */
+    uint64_t end_idx_;
+
+    /** Estimated memory usage of the batch. */
+    uint64_t memory_used_;
+
+    /** Names with tiles to read, with their validity only flag. */
+    std::vector<ReaderBase::NameToLoad> names_to_read_;
+
+    /** Names to copy to the user buffers. */
+    std::vector<std::string> names_to_copy_;
+  };
+
+  /** An attribute batch whose reads have been issued ahead of time. */
+  struct PrefetchedAttributeBatch {
+    /** The planned batch. */
+    AttributeBatch batch_;
+
+    /** Read destinations; must outlive the read tasks. */
+    std::vector<FilteredData> filtered_data_;
+
+    /** In flight read tasks, per name in `names_to_read_`. */
+    std::vector<std::vector<ThreadPool::Task>> read_tasks_;
+  };
+
+  /**
+   * Attribute batches whose reads were issued while an earlier batch was
+   * copied, oldest first. Bounded by `attribute_prefetch_depth_`.
+   */
+  std::deque<PrefetchedAttributeBatch> prefetched_attr_batches_;
+
+  /**
+   * Number of attribute batches to read ahead of the one being copied. Zero
+   * disables prefetching.
+   */
+  uint64_t attribute_prefetch_depth_;
+
+  /**
+   * An upper limit, in cells, on how many result tile cells to schedule for
+   * I/O ahead of what the user buffers consume. Zero means no limit.
+   */
+  uint64_t result_budget_cells_;
+
   /* ********************************* */
   /*         PROTECTED METHODS         */
   /* ********************************* */
@@ -583,6 +681,13 @@ class SparseIndexReaderBase : public ReaderBase {
   /** @return Available memory. */
   uint64_t available_memory();
 
+  /**
+   * Returns `true` when the result budget hint is set and the result tiles
+   * already scheduled cover it, in which case tile creation should stop
+   * issuing I/O and let the scheduled tiles be processed first.
+   */
+  bool result_budget_reached() const;
+
   /**
    * Computes the required size for loading tile offsets, per fragments.
    *
@@ -630,6 +735,17 @@ class SparseIndexReaderBase : public ReaderBase {
    */
   Status load_initial_data();
 
+  /**
+   * Pre-compile, per fragment, the list of delete and update conditions to
+   * apply to its tiles. Conditions already processed by a fragment or with a
+   * timestamp before the fragment start are dropped, and the choice between
+   * the regular and the timestamped form of each condition is made once. For
+   * regular reads, conditions with identical predicates are deduplicated,
+   * keeping only the one with the latest timestamp as it deletes a superset
+   * of the cells deleted by the earlier ones.
+   */
+  void compute_delete_conditions_to_apply();
+
   /**
    * Returns the tile offset size for the list of relevant fragments.
    *
@@ -655,6 +771,34 @@ class SparseIndexReaderBase : public ReaderBase {
    */
   Status read_and_unfilter_coords(const std::vector<ResultTile*>& result_tiles);
 
+  /**
+   * Read and unfilter coord tiles, reading the coordinate data for only a
+   * subset of the result tiles. Used by count-only/aggregate-only reads
+   * where the coordinates of tiles fully covered by the subarray are never
+   * accessed; the timestamps, delete timestamps and query condition
+   * attributes are still read for all result tiles.
+   *
+   * @param coords_result_tiles The result tiles to read coordinate data for.
+   * @param result_tiles The result tiles to process.
+   *
+   * @return Status.
+   */
+  Status read_and_unfilter_coords(
+      const std::vector<ResultTile*>& coords_result_tiles,
+      const std::vector<ResultTile*>& result_tiles);
+
+  /**
+   * Returns whether the MBR of the input result tile is fully covered by
+   * the subarray ranges in every dimension. The cells of such tiles are all
+   * included in the query results (before query condition and delete
+   * processing), which gives them a full tile bitmap without any per-cell
+   * computation.
+   *
+   * @param rt Result tile.
+   * @return If the tile is fully covered by the subarray or not.
+   */
+  bool tile_fully_covered(const ResultTile& rt) const;
+
   /**
    * Compute tile bitmaps.
    *
@@ -691,6 +835,52 @@ class SparseIndexReaderBase : public ReaderBase {
       std::vector<ResultTile*>& result_tiles,
       bool agg_only);
 
+  /**
+   * Plans the batch of attributes starting at `buffer_idx` that fits in the
+   * given memory budget, without reading anything.
+   *
+   * @param names Attribute/dimensions to compute for.
+   * @param mem_usage_per_attr Computed per attribute memory usage.
+   * @param buffer_idx Index of the first name of the batch.
+   * @param agg_only Are we loading for aggregates only field.
+   * @param memory_budget Memory budget for the batch.
+   *
+   * @return The planned batch.
+   */
+  AttributeBatch plan_attribute_batch(
+      const std::vector<std::string>& names,
+      const std::vector<uint64_t>& mem_usage_per_attr,
+      uint64_t buffer_idx,
+      bool agg_only,
+      uint64_t memory_budget);
+
+  /**
+   * Issues the reads for the attribute batches following the current one,
+   * up to the prefetch depth, so that copying the current batch overlaps
+   * the I/O round trips of the next ones. The batches are bounded by the
+   * memory the current batch and the already scheduled batches leave in
+   * the budget.
+   *
+   * @param names Attribute/dimensions to compute for.
+   * @param mem_usage_per_attr Computed per attribute memory usage.
+   * @param current_batch The batch being processed.
+   * @param result_tiles Result tiles to process.
+   * @param memory_budget Memory budget attribute data must fit in.
+   */
+  void prefetch_attribute_batches(
+      const std::vector<std::string>& names,
+      const std::vector<uint64_t>& mem_usage_per_attr,
+      const AttributeBatch& current_batch,
+      std::vector<ResultTile*>& result_tiles,
+      uint64_t memory_budget);
+
+  /**
+   * Waits out and discards all prefetched attribute batches. The scheduled
+   * reads write into the prefetched buffers, so they must complete before
+   * the buffers can be released.
+   */
+  void drain_attribute_prefetches();
+
   /**
    * Get the field names to process.
    *
@@ -94,6 +94,9 @@ SparseUnorderedWithDupsReader<BitmapType>::SparseUnorderedWithDupsReader(
           default_channel_aggregates,
           skip_checks_serialization,
           false)
+    , result_tiles_leftover_(
+          ArenaAllocator<UnorderedWithDupsResultTile<BitmapType>>(
+              &result_tile_arena_))
     , tile_offsets_min_frag_idx_(std::numeric_limits<unsigned>::max())
     , tile_offsets_max_frag_idx_(0) {
   // Initialize memory budget variables.
@@ -111,6 +114,34 @@ SparseUnorderedWithDupsReader<BitmapType>::SparseUnorderedWithDupsReader(
     throw SparseUnorderedWithDupsReaderStatusException("Cannot get setting");
   }
   assert(found);
+
+  // Get the setting that enables the tile completion order copy path.
+  found = false;
+  if (!config_
+           .get<bool>(
+               "sm.query.sparse_unordered_with_dups.tile_completion_order",
+               &tile_completion_order_,
+               &found)
+           .ok()) {
+    throw SparseUnorderedWithDupsReaderStatusException("Cannot get setting");
+  }
+  assert(found);
+
+  // Get the setting that enables streaming emission. Waves of two tiles
+  // per thread keep the read, bitmap and copy parallelizations saturated
+  // while bounding how many tiles are resident at once.
+  found = false;
+  if (!config_
+           .get<bool>(
+               "sm.query.sparse_unordered_with_dups.streaming_emission",
+               &streaming_emission_,
+               &found)
+           .ok()) {
+    throw SparseUnorderedWithDupsReaderStatusException("Cannot get setting");
+  }
+  assert(found);
+  streaming_wave_tiles_ =
+      2 * storage_manager->compute_tp()->concurrency_level();
 }
 
 /* ****************************** */
@@ -208,8 +239,26 @@ Status SparseUnorderedWithDupsReader<BitmapType>::dowork() {
         result_tiles_ptr.emplace_back(&result_tile);
       }
 
-      // Read and unfilter coords.
-      throw_if_not_ok(read_and_unfilter_coords(result_tiles_ptr));
+      // Read and unfilter coords. When the coordinates are used for nothing
+      // but the tile bitmaps, e.g. for a COUNT with a subarray, only read
+      // them for the boundary tiles; tiles fully covered by the subarray get
+      // a full bitmap from the fragment metadata alone.
+      if (include_coords_ && coords_only_for_bitmaps()) {
+        std::vector<ResultTile*> boundary_tiles;
+        boundary_tiles.reserve(result_tiles_ptr.size());
+        for (auto rt : result_tiles_ptr) {
+          if (!tile_fully_covered(*rt)) {
+            boundary_tiles.emplace_back(rt);
+          }
+        }
+        stats_->add_counter(
+            "coord_tiles_not_read",
+            result_tiles_ptr.size() - boundary_tiles.size());
+        throw_if_not_ok(
+            read_and_unfilter_coords(boundary_tiles, result_tiles_ptr));
+      } else {
+        throw_if_not_ok(read_and_unfilter_coords(result_tiles_ptr));
+      }
 
       // Compute the tile bitmaps.
       compute_tile_bitmaps<BitmapType>(result_tiles_ptr);
@@ -259,6 +308,50 @@ Status SparseUnorderedWithDupsReader<BitmapType>::dowork() {
   return Status::Ok();
 }
 
+template <class BitmapType>
+bool SparseUnorderedWithDupsReader<BitmapType>::coords_only_for_bitmaps()
+    const {
+  // Overlapping ranges need the coordinates of every tile to compute the
+  // cell multiplicities, even for fully covered tiles.
+  if (!std::is_same<BitmapType, uint8_t>::value) {
+    return false;
+  }
+
+  // Dimension output buffers are copied from the coordinate tiles.
+  for (const auto& b : buffers_) {
+    if (array_schema_.is_dim(b.first)) {
+      return false;
+    }
+  }
+
+  // Aggregates on dimensions are computed from the coordinate tiles.
+  for (const auto& aggregate : aggregates_) {
+    if (array_schema_.is_dim(aggregate.first)) {
+      return false;
+    }
+  }
+
+  // Query and delete conditions on dimensions are evaluated on the
+  // coordinate tiles.
+  if (condition_.has_value()) {
+    for (const auto& name : condition_->field_names()) {
+      if (array_schema_.is_dim(name)) {
+        return false;
+      }
+    }
+  }
+  for (const auto& delete_and_update_condition :
+       delete_and_update_conditions_) {
+    for (const auto& name : delete_and_update_condition.field_names()) {
+      if (array_schema_.is_dim(name)) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
 template <class BitmapType>
 void SparseUnorderedWithDupsReader<BitmapType>::reset() {
 }
@@ -392,6 +485,32 @@ bool SparseUnorderedWithDupsReader<BitmapType>::add_result_tile(
     return false;
   }
 
+  // Skip tiles the condition proves cannot contain results.
+  if (condition_.has_value() && condition_->can_skip_tile(frag_md, t)) {
+    stats_->add_counter("tiles_skipped_by_condition", 1);
+    if (t == last_t) {
+      tmp_read_state_.set_all_tiles_loaded(f);
+    }
+
+    return false;
+  }
+
+  // Stop scheduling tiles once the tiles already in flight cover the result
+  // budget hint; they get processed before more I/O is issued.
+  if (result_budget_reached() && !result_tiles.empty()) {
+    return true;
+  }
+
+  // With streaming emission, stop the batch once it holds a wave of tiles.
+  // The main loop finalizes the bitmaps of each wave and copies it to the
+  // user buffers before creating the next one, so cells stream out and tile
+  // memory is released while the remaining tiles are still to be read,
+  // instead of every created tile staying resident until the whole batch
+  // has its bitmaps.
+  if (streaming_emission_ && result_tiles.size() >= streaming_wave_tiles_) {
+    return true;
+  }
+
   // Use either the coordinate portion of the total budget or the tile upper
   // memory limit as the upper memory limit, whichever is smaller.
   const uint64_t upper_memory_limit = std::min<uint64_t>(
@@ -424,6 +543,7 @@ bool SparseUnorderedWithDupsReader<BitmapType>::add_result_tile(
 
   // Adjust memory usage.
   memory_used_for_coords_total_ += tiles_size;
+  result_budget_cells_scheduled_ += frag_md.cell_num(t);
 
   // Add the result tile.
   result_tiles.emplace_back(f, t, frag_md);
@@ -437,11 +557,13 @@ bool SparseUnorderedWithDupsReader<BitmapType>::add_result_tile(
 }
 
 template <class BitmapType>
-std::list<UnorderedWithDupsResultTile<BitmapType>>
+typename SparseUnorderedWithDupsReader<BitmapType>::ResultTilesList
 SparseUnorderedWithDupsReader<BitmapType>::create_result_tiles() {
   auto timer_se = stats_->start_timer("create_result_tiles");
 
-  ResultTilesList result_tiles;
+  ArenaAllocator<UnorderedWithDupsResultTile<BitmapType>> alloc(
+      &result_tile_arena_);
+  ResultTilesList result_tiles(alloc);
 
   // For easy reference.
   const auto dim_num = array_schema_.dim_num();
@@ -555,6 +677,19 @@ void SparseUnorderedWithDupsReader<BitmapType>::clean_tile_list(
       it++;
     }
   }
+
+  // The bitmaps are final at this point. Drop the ones where every cell
+  // survived and return their memory to the budget so that more result
+  // tiles can be loaded concurrently; the copy path treats a tile with no
+  // bitmap as a full tile copy already.
+  uint64_t released = 0;
+  for (auto& rt : result_tiles) {
+    if (rt.release_full_bitmap()) {
+      memory_used_for_coords_total_ -= rt.cell_num() * sizeof(BitmapType);
+      released++;
+    }
+  }
+  stats_->add_counter("bitmaps_released", released);
 }
 
 template <class BitmapType>
@@ -637,14 +772,12 @@ void SparseUnorderedWithDupsReader<uint64_t>::copy_offsets_tile(
       }
     }
   } else {
+    uint64_t num_cells = 0;
     for (uint64_t c = src_min_pos; c < src_max_pos; c++) {
-      for (uint64_t i = 0; i < rt->bitmap()[c]; i++) {
-        *buffer = fill_value_size / offset_div;
-        buffer++;
-        *var_data = src_var_buff;
-        var_data++;
-      }
+      num_cells += rt->bitmap()[c];
     }
+    std::fill_n(buffer, num_cells, fill_value_size / offset_div);
+    std::fill_n(var_data, num_cells, static_cast<const void*>(src_var_buff));
   }
 
   // Copy nullable values.
@@ -660,12 +793,11 @@ void SparseUnorderedWithDupsReader<uint64_t>::copy_offsets_tile(
       }
     } else {
       uint8_t v = array_schema_.attribute(name)->fill_value_validity();
+      uint64_t num_cells = 0;
       for (uint64_t c = src_min_pos; c < src_max_pos; c++) {
-        for (uint64_t i = 0; i < rt->bitmap()[c]; i++) {
-          *val_buffer = v;
-          val_buffer++;
-        }
+        num_cells += rt->bitmap()[c];
       }
+      memset(val_buffer, v, num_cells);
     }
   }
 }
@@ -717,54 +849,79 @@ void SparseUnorderedWithDupsReader<uint8_t>::copy_offsets_tile(
         }
       }
     } else {
-      for (uint64_t c = src_min_pos; c < src_max_pos; c++) {
-        if (!rt->has_bmp() || rt->bitmap()[c]) {
-          *buffer = fill_value_size / offset_div;
-          buffer++;
-          *var_data = src_var_buff;
-          var_data++;
+      uint64_t num_cells = 0;
+      if (!rt->has_bmp()) {
+        num_cells = src_max_pos - src_min_pos;
+      } else {
+        for (uint64_t c = src_min_pos; c < src_max_pos; c++) {
+          num_cells += rt->bitmap()[c] != 0;
         }
       }
+      std::fill_n(buffer, num_cells, fill_value_size / offset_div);
+      std::fill_n(var_data, num_cells, static_cast<const void*>(src_var_buff));
     }
 
     // Copy nullable values.
     if (nullable) {
       if (!use_fill_value) {
+        // Go through bitmap, when there is a hole in cell contiguity, do a
+        // memcpy.
         const auto& t_val = tile_tuple->validity_tile();
         const auto src_val_buff = t_val.data_as<uint8_t>();
+        uint64_t length = 0;
+        uint64_t start = src_min_pos;
         for (uint64_t c = src_min_pos; c < src_max_pos; c++) {
           if (rt->bitmap()[c]) {
-            *val_buffer = src_val_buff[c];
-            val_buffer++;
+            length++;
+          } else {
+            if (length != 0) {
+              memcpy(val_buffer, src_val_buff + start, length);
+              val_buffer += length;
+              length = 0;
+            }
+
+            start = c + 1;
           }
         }
+
+        // Do last memcpy.
+        if (length != 0) {
+          memcpy(val_buffer, src_val_buff + start, length);
+          val_buffer += length;
+        }
       } else {
         uint8_t v = array_schema_.attribute(name)->fill_value_validity();
+        uint64_t num_cells = 0;
         for (uint64_t c = src_min_pos; c < src_max_pos; c++) {
-          if (rt->bitmap()[c]) {
-            *val_buffer = v;
-            val_buffer++;
-          }
+          num_cells += rt->bitmap()[c];
         }
+        memset(val_buffer, v, num_cells);
       }
     }
   } else {
-    // Copy full tile.
+    // Copy full tile. The cell sizes, the elements mode division and the
+    // var data pointers are separate bulk passes over the output instead of
+    // interleaved per-cell work so that the compiler can vectorize each
+    // loop.
     for (uint64_t c = src_min_pos; c < src_max_pos; c++) {
-      *buffer = (OffType)(src_buff[c + 1] - src_buff[c]) / offset_div;
-      buffer++;
-      *var_data = src_var_buff + src_buff[c];
-      var_data++;
+      buffer[c - src_min_pos] = (OffType)(src_buff[c + 1] - src_buff[c]);
+    }
+
+    if (offset_div > 1) {
+      for (uint64_t c = src_min_pos; c < src_max_pos; c++) {
+        buffer[c - src_min_pos] /= offset_div;
+      }
+    }
+
+    for (uint64_t c = src_min_pos; c < src_max_pos; c++) {
+      var_data[c - src_min_pos] = src_var_buff + src_buff[c];
     }
 
     // Copy nullable values.
     if (nullable) {
       const auto& t_val = tile_tuple->validity_tile();
       const auto src_val_buff = t_val.data_as<uint8_t>();
-      for (uint64_t c = src_min_pos; c < src_max_pos; c++) {
-        *val_buffer = src_val_buff[c];
-        val_buffer++;
-      }
+      memcpy(val_buffer, src_val_buff + src_min_pos, src_max_pos - src_min_pos);
     }
   }
 }
@@ -972,12 +1129,11 @@ void SparseUnorderedWithDupsReader<uint64_t>::copy_fixed_data_tile(
         }
       }
     } else {
+      uint64_t num_cells = 0;
       for (uint64_t c = src_min_pos; c < src_max_pos; c++) {
-        for (uint64_t i = 0; i < rt->bitmap()[c]; i++) {
-          memcpy(buffer, src_buff, cell_size);
-          buffer += cell_size;
-        }
+        num_cells += rt->bitmap()[c];
       }
+      pattern_fill(buffer, src_buff, cell_size, num_cells);
     }
   } else {  // Copy for zipped coords.
     const auto dim_num = rt->domain()->dim_num();
@@ -1003,12 +1159,11 @@ void SparseUnorderedWithDupsReader<uint64_t>::copy_fixed_data_tile(
       }
     } else {
       uint8_t v = array_schema_.attribute(name)->fill_value_validity();
+      uint64_t num_cells = 0;
       for (uint64_t c = src_min_pos; c < src_max_pos; c++) {
-        for (uint64_t i = 0; i < rt->bitmap()[c]; i++) {
-          *val_buffer = v;
-          val_buffer++;
-        }
+        num_cells += rt->bitmap()[c];
       }
+      memset(val_buffer, v, num_cells);
     }
   }
 }
@@ -1072,12 +1227,15 @@ void SparseUnorderedWithDupsReader<uint8_t>::copy_fixed_data_tile(
           buffer += length * cell_size;
         }
       } else {
-        for (uint64_t c = src_min_pos; c < src_max_pos; c++) {
-          if (!rt->has_bmp() || rt->bitmap()[c]) {
-            memcpy(buffer, src_buff, cell_size);
-            buffer += cell_size;
+        uint64_t num_cells = 0;
+        if (!rt->has_bmp()) {
+          num_cells = src_max_pos - src_min_pos;
+        } else {
+          for (uint64_t c = src_min_pos; c < src_max_pos; c++) {
+            num_cells += rt->bitmap()[c] != 0;
           }
         }
+        pattern_fill(buffer, src_buff, cell_size, num_cells);
       }
     } else {  // Copy for zipped coords.
       const auto dim_num = rt->domain()->dim_num();
@@ -1120,12 +1278,11 @@ void SparseUnorderedWithDupsReader<uint8_t>::copy_fixed_data_tile(
         }
       } else {
         uint8_t v = array_schema_.attribute(name)->fill_value_validity();
+        uint64_t num_cells = 0;
         for (uint64_t c = src_min_pos; c < src_max_pos; c++) {
-          for (uint64_t i = 0; i < rt->bitmap()[c]; i++) {
-            *val_buffer = v;
-            val_buffer++;
-          }
+          num_cells += rt->bitmap()[c];
         }
+        memset(val_buffer, v, num_cells);
       }
     }
   } else {  // Copy full tile.
@@ -1630,6 +1787,11 @@ template <class BitmapType>
 template <class OffType>
 bool SparseUnorderedWithDupsReader<BitmapType>::process_tiles(
     std::vector<std::string>& names, std::vector<ResultTile*>& result_tiles) {
+  // Use the fused per-tile copy path when possible.
+  if (can_copy_in_tile_completion_order(names)) {
+    return process_tiles_in_tile_completion_order(names, result_tiles);
+  }
+
   auto timer_se = stats_->start_timer("process_tiles");
 
   // Vector for storing the cell offsets of each tiles into the user buffers.
@@ -1646,6 +1808,8 @@ bool SparseUnorderedWithDupsReader<BitmapType>::process_tiles(
     return user_buffers_full;
   }
 
+  stats_->add_counter("result_tiles_loaded_for_copy", result_tiles.size());
+
   // Compute parallelization parameters.
   uint64_t num_range_threads = 1;
   const auto num_threads = storage_manager_->compute_tp()->concurrency_level();
@@ -1731,6 +1895,182 @@ bool SparseUnorderedWithDupsReader<BitmapType>::process_tiles(
     }
   }
 
+  update_read_state_after_copy(cell_offsets, result_tiles);
+
+  logger_->debug("Done processing tiles");
+  return user_buffers_full;
+}
+
+template <class BitmapType>
+bool SparseUnorderedWithDupsReader<BitmapType>::
+    can_copy_in_tile_completion_order(
+        const std::vector<std::string>& names) const {
+  if (!tile_completion_order_ || !aggregates_.empty()) {
+    return false;
+  }
+
+  for (const auto& name : names) {
+    if (buffers_.count(name) != 0 && array_schema_.var_size(name)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+template <class BitmapType>
+bool SparseUnorderedWithDupsReader<BitmapType>::
+    process_tiles_in_tile_completion_order(
+        std::vector<std::string>& names,
+        std::vector<ResultTile*>& result_tiles) {
+  auto timer_se = stats_->start_timer("process_tiles_tile_completion_order");
+
+  // Vector for storing the cell offsets of each tiles into the user buffers.
+  // This also stores the last offset to facilitate calculations later on.
+  auto&& [user_buffers_full, cell_offsets] =
+      resize_fixed_results_to_copy(names, result_tiles);
+
+  // Making sure we respect the memory budget for the copy operation.
+  auto mem_usage_per_attr =
+      respect_copy_memory_budget(names, result_tiles, user_buffers_full);
+
+  // There is no space for any tiles in the user buffer, exit.
+  if (result_tiles.empty()) {
+    return user_buffers_full;
+  }
+
+  stats_->add_counter("result_tiles_loaded_for_copy", result_tiles.size());
+
+  // Copy parameters for one field of the fused per-tile pass.
+  struct FieldToCopy {
+    std::string name;
+    bool is_dim;
+    bool nullable;
+    unsigned dim_idx;
+    uint64_t cell_size;
+    uint8_t* buffer;
+    uint8_t* val_buffer;
+  };
+
+  // Read a few attributes at a time.
+  uint64_t buffer_idx{0};
+  while (buffer_idx < names.size()) {
+    // Read and unfilter as many attributes as can fit in the budget.
+    auto names_to_copy = read_and_unfilter_attributes(
+        names, mem_usage_per_attr, &buffer_idx, result_tiles, false);
+
+    // Gather the copy parameters for the fields of this batch that are in
+    // the buffer list.
+    std::vector<FieldToCopy> fields_to_copy;
+    fields_to_copy.reserve(names_to_copy.size());
+    for (const auto& name : names_to_copy) {
+      if (buffers_.count(name) == 0) {
+        continue;
+      }
+
+      FieldToCopy field;
+      field.name = name;
+      field.is_dim = array_schema_.is_dim(name);
+      field.nullable = array_schema_.is_nullable(name);
+      field.cell_size = array_schema_.cell_size(name);
+
+      // Get dim idx for zipped coords copy.
+      field.dim_idx = 0;
+      if (field.is_dim) {
+        const auto& dim_names = array_schema_.dim_names();
+        while (name != dim_names[field.dim_idx])
+          field.dim_idx++;
+      }
+
+      auto& query_buffer = buffers_[name];
+      field.buffer = (uint8_t*)query_buffer.buffer_;
+      field.val_buffer = query_buffer.validity_vector_.buffer();
+      fields_to_copy.emplace_back(std::move(field));
+    }
+
+    // Process all tiles in parallel. Each task copies every field of its
+    // tile, so a tile streams to the user buffers as one unit instead of
+    // synchronizing with the other tiles between fields.
+    throw_if_not_ok(parallel_for(
+        storage_manager_->compute_tp(),
+        0,
+        result_tiles.size(),
+        [&](uint64_t i) {
+          // For easy reference.
+          auto rt = (UnorderedWithDupsResultTile<BitmapType>*)result_tiles[i];
+
+          // We might have a partially processed result tile from last run.
+          uint64_t min_pos_tile = 0;
+          if (i == 0) {
+            min_pos_tile = read_state_.frag_idx_[rt->frag_idx()].cell_idx_;
+          }
+
+          auto max_pos_tile =
+              fragment_metadata_[rt->frag_idx()]->cell_num(rt->tile_idx());
+
+          // Adjust max cell if this is the last tile.
+          if (i == result_tiles.size() - 1) {
+            auto to_copy = cell_offsets[i + 1] - cell_offsets[i];
+            max_pos_tile =
+                rt->pos_with_given_result_sum(min_pos_tile, to_copy) + 1;
+          }
+
+          for (auto& field : fields_to_copy) {
+            if (field.name == constants::timestamps) {
+              copy_timestamp_data_tile(
+                  &*rt,
+                  min_pos_tile,
+                  max_pos_tile,
+                  field.buffer + cell_offsets[i] * field.cell_size);
+            } else {
+              copy_fixed_data_tile(
+                  field.name,
+                  field.is_dim,
+                  field.nullable,
+                  field.dim_idx,
+                  field.cell_size,
+                  &*rt,
+                  min_pos_tile,
+                  max_pos_tile,
+                  field.buffer + cell_offsets[i] * field.cell_size,
+                  field.val_buffer + cell_offsets[i]);
+            }
+          }
+
+          return Status::Ok();
+        }));
+
+    // Adjust buffer sizes.
+    auto total_cells = cell_offsets[result_tiles.size()];
+    for (auto& field : fields_to_copy) {
+      auto& query_buffer = buffers_[field.name];
+      *query_buffer.buffer_size_ = total_cells * field.cell_size;
+      if (field.nullable) {
+        *query_buffer.validity_vector_.buffer_size() = total_cells;
+      }
+    }
+
+    // Clear tiles from memory.
+    for (const auto& name : names_to_copy) {
+      if (qc_loaded_attr_names_set_.count(name) == 0 &&
+          (!include_coords_ || !array_schema_.is_dim(name)) &&
+          name != constants::timestamps &&
+          name != constants::delete_timestamps) {
+        clear_tiles(name, result_tiles);
+      }
+    }
+  }
+
+  update_read_state_after_copy(cell_offsets, result_tiles);
+
+  logger_->debug("Done processing tiles in tile completion order");
+  return user_buffers_full;
+}
+
+template <class BitmapType>
+void SparseUnorderedWithDupsReader<BitmapType>::update_read_state_after_copy(
+    const std::vector<uint64_t>& cell_offsets,
+    const std::vector<ResultTile*>& result_tiles) {
   // Compute the number of cells copied for the last tile before updating tile
   // index.
   uint64_t last_tile_cells_copied = 0;
@@ -1762,9 +2102,6 @@ bool SparseUnorderedWithDupsReader<BitmapType>::process_tiles(
           last_tile->pos_with_given_result_sum(0, last_tile_cells_copied) + 1;
     }
   }
-
-  logger_->debug("Done processing tiles");
-  return user_buffers_full;
 }
 
 template <class BitmapType>
@@ -1970,6 +2307,7 @@ void SparseUnorderedWithDupsReader<BitmapType>::process_aggregates(
             for (auto& aggregate : aggregates) {
               aggregate->aggregate_tile_with_frag_md(md);
             }
+            stats_->add_counter("tiles_aggregated_with_frag_md", 1);
           }
         } else {
           uint64_t cell_num =
@@ -2015,7 +2353,15 @@ void SparseUnorderedWithDupsReader<BitmapType>::remove_result_tile(
   auto tiles_size =
       get_coord_tiles_size(array_schema_.dim_num(), frag_idx, tile_idx);
 
+  // The bitmap portion was already returned when the bitmap was released.
+  if (rt->bitmap_released()) {
+    tiles_size -=
+        fragment_metadata_[frag_idx]->cell_num(tile_idx) * sizeof(BitmapType);
+  }
+
   memory_used_for_coords_total_ -= tiles_size;
+  result_budget_cells_scheduled_ -=
+      fragment_metadata_[frag_idx]->cell_num(tile_idx);
 
   // Delete the tile.
   result_tiles.erase(rt);
@@ -60,7 +60,10 @@ template <class BitmapType>
 class SparseUnorderedWithDupsReader : public SparseIndexReaderBase,
                                       public IQueryStrategy {
  public:
-  typedef std::list<UnorderedWithDupsResultTile<BitmapType>> ResultTilesList;
+  typedef std::list<
+      UnorderedWithDupsResultTile<BitmapType>,
+      ArenaAllocator<UnorderedWithDupsResultTile<BitmapType>>>
+      ResultTilesList;
 
   /* ********************************* */
   /*     CONSTRUCTORS & DESTRUCTORS    */
@@ -188,13 +191,29 @@ class SparseUnorderedWithDupsReader : public SparseIndexReaderBase,
    * Result tiles currently for which we loaded coordinates but couldn't
    * process in the previous iteration.
    */
-  std::list<UnorderedWithDupsResultTile<BitmapType>> result_tiles_leftover_;
+  ResultTilesList result_tiles_leftover_;
   /** Minimum fragment index for loaded tile offsets data. */
   unsigned tile_offsets_min_frag_idx_;
 
   /** Maximum fragment index for loaded tile offsets data. */
   unsigned tile_offsets_max_frag_idx_;
 
+  /**
+   * If `true`, copy result tiles to the user buffers with a single fused
+   * pass over all fixed-size fields per tile instead of field by field.
+   */
+  bool tile_completion_order_;
+
+  /**
+   * If `true`, create result tiles in waves of `streaming_wave_tiles_`
+   * and copy each wave to the user buffers, releasing its memory, before
+   * reading the next one.
+   */
+  bool streaming_emission_;
+
+  /** Maximum number of result tiles per wave for streaming emission. */
+  uint64_t streaming_wave_tiles_;
+
   /* ********************************* */
   /*           PRIVATE METHODS         */
   /* ********************************* */
@@ -467,6 +486,43 @@ class SparseUnorderedWithDupsReader : public SparseIndexReaderBase,
   bool process_tiles(
       std::vector<std::string>& names, std::vector<ResultTile*>& result_tiles);
 
+  /**
+   * Returns whether the tile completion order copy path can process this
+   * query. The fused path only handles fixed-size output fields and no
+   * aggregates, as var-sized fields need a sequential pass over the offsets
+   * and aggregates are computed per field batch.
+   *
+   * @param names Fields to process.
+   *
+   * @return If the tile completion order path can be used.
+   */
+  bool can_copy_in_tile_completion_order(
+      const std::vector<std::string>& names) const;
+
+  /**
+   * Process tiles in tile completion order. Each result tile is copied to
+   * the user buffers by a single task covering all the fields of the copy
+   * batch, so a tile streams out the moment a worker picks it up instead of
+   * synchronizing on per-field barriers.
+   *
+   * @param names Fields to process.
+   * @param result_tiles The result tiles to process.
+   *
+   * @return user_buffers_full.
+   */
+  bool process_tiles_in_tile_completion_order(
+      std::vector<std::string>& names, std::vector<ResultTile*>& result_tiles);
+
+  /**
+   * Update the read state to reflect the tiles that were just copied.
+   *
+   * @param cell_offsets Cell offset per result tile.
+   * @param result_tiles The result tiles that were copied.
+   */
+  void update_read_state_after_copy(
+      const std::vector<uint64_t>& cell_offsets,
+      const std::vector<ResultTile*>& result_tiles);
+
   /**
    * Copy tiles.
    *
@@ -519,6 +575,19 @@ class SparseUnorderedWithDupsReader : public SparseIndexReaderBase,
    * @param rt Result tile.
    * @return If we can do the aggregation with the frag md or not.
    */
+  /**
+   * Returns whether the coordinate tiles are used for nothing but computing
+   * the tile bitmaps in this query. This is the case when ranges are
+   * non-overlapping and no dimension is needed for the output buffers, the
+   * aggregates, or the query/delete conditions, e.g. for a COUNT with a
+   * subarray. Tiles fully covered by the subarray then get a full bitmap
+   * from the fragment metadata alone and their coordinates don't need to be
+   * read at all.
+   *
+   * @return If the coordinates are only used for bitmap computation or not.
+   */
+  bool coords_only_for_bitmaps() const;
+
   inline bool can_aggregate_tile_with_frag_md(
       UnorderedWithDupsResultTile<BitmapType>* rt) {
     auto& frag_md = fragment_metadata_[rt->frag_idx()];
@@ -279,10 +279,26 @@ Status DenseTiler<T>::get_tile(
     auto buff = (uint8_t*)buffers_->find(name)->second.buffer_;
     assert(buff != nullptr);
 
-    memset(tile.fixed_tile().data(), 0, tile_size);
-
-    // Copy tile from buffer
-    RETURN_NOT_OK(copy_tile(id, cell_size, buff, tile.fixed_tile()));
+    const CopyPlan copy_plan = this->copy_plan(id);
+    if (covers_whole_tile(copy_plan, cell_num_in_tile)) {
+      // The write covers the whole tile with a single contiguous slab of
+      // the user buffer, so the tile can consume a view of the buffer
+      // directly, skipping the copy. This is safe because the filter
+      // pipeline treats its input as read-only and the user buffer
+      // outlives the filtering of the tiles.
+      auto& fixed_tile = tile.fixed_tile();
+      fixed_tile = WriterTile(
+          fixed_tile.format_version(),
+          fixed_tile.type(),
+          cell_size,
+          tile_size,
+          buff + copy_plan.sub_start_el_ * cell_size);
+    } else {
+      memset(tile.fixed_tile().data(), 0, tile_size);
+
+      // Copy tile from buffer
+      RETURN_NOT_OK(copy_tile(id, cell_size, buff, tile.fixed_tile()));
+    }
   }
 
   if (tile.nullable()) {
@@ -292,10 +308,22 @@ Status DenseTiler<T>::get_tile(
         (uint8_t*)buffers_->find(name)->second.validity_vector_.buffer();
     assert(buff != nullptr);
 
-    memset(tile.validity_tile().data(), 0, tile_size);
-
-    // Copy tile from buffer
-    RETURN_NOT_OK(copy_tile(id, cell_size, buff, tile.validity_tile()));
+    const CopyPlan copy_plan = this->copy_plan(id);
+    if (covers_whole_tile(copy_plan, cell_num_in_tile)) {
+      // Same zero-copy mode as for the fixed data tile above.
+      auto& validity_tile = tile.validity_tile();
+      validity_tile = WriterTile(
+          validity_tile.format_version(),
+          validity_tile.type(),
+          cell_size,
+          tile_size,
+          buff + copy_plan.sub_start_el_ * cell_size);
+    } else {
+      memset(tile.validity_tile().data(), 0, tile_size);
+
+      // Copy tile from buffer
+      RETURN_NOT_OK(copy_tile(id, cell_size, buff, tile.validity_tile()));
+    }
   }
 
   compute_tile_metadata(name, id, tile);
@@ -498,6 +526,17 @@ std::vector<std::array<T, 2>> DenseTiler<T>::tile_subarray(uint64_t id) const {
   return ret;
 }
 
+template <class T>
+bool DenseTiler<T>::covers_whole_tile(
+    const CopyPlan& copy_plan, uint64_t cell_num_in_tile) {
+  // A single copy iteration that starts at the tile origin and spans a
+  // whole tile's worth of elements is a full-tile contiguous slab.
+  return copy_plan.dim_ranges_.size() == 1 &&
+         copy_plan.dim_ranges_[0][0] == 0 &&
+         copy_plan.dim_ranges_[0][1] == 0 && copy_plan.tile_start_el_ == 0 &&
+         copy_plan.copy_el_ == cell_num_in_tile;
+}
+
 template <class T>
 Status DenseTiler<T>::copy_tile(
     uint64_t id, uint64_t cell_size, uint8_t* buff, WriterTile& tile) const {
@@ -305,6 +305,14 @@ class DenseTiler {
    */
   std::vector<std::array<T, 2>> tile_subarray(uint64_t id) const;
 
+  /**
+   * Returns `true` if the copy plan writes the whole tile with a single
+   * contiguous slab of the input buffer. In that case the tile can
+   * consume a view of the buffer directly, without copying it.
+   */
+  static bool covers_whole_tile(
+      const CopyPlan& copy_plan, uint64_t cell_num_in_tile);
+
   /**
    * Copies the fixed-sized tile with the input id from the input
    * subarray buffer.
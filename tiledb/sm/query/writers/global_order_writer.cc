@@ -34,6 +34,7 @@
 #include "tiledb/common/common.h"
 #include "tiledb/common/heap_memory.h"
 #include "tiledb/common/logger.h"
+#include "tiledb/common/thread_pool/producer_consumer_queue.h"
 #include "tiledb/sm/array/array.h"
 #include "tiledb/sm/array_schema/array_schema.h"
 #include "tiledb/sm/array_schema/dimension.h"
@@ -105,7 +106,20 @@ GlobalOrderWriter::GlobalOrderWriter(
           skip_checks_serialization)
     , processed_conditions_(processed_conditions)
     , fragment_size_(fragment_size)
-    , current_fragment_size_(0) {
+    , current_fragment_size_(0)
+    , pipelined_io_(false) {
+  // Get configuration parameters.
+  bool found = false;
+  if (!config_
+           .get<bool>(
+               "sm.query.global_order_writer.pipelined_io",
+               &pipelined_io_,
+               &found)
+           .ok()) {
+    throw GlobalOrderWriterStatusException("Cannot get setting");
+  }
+  assert(found);
+
   // Check the layout is global order.
   if (layout != Layout::GLOBAL_ORDER) {
     throw GlobalOrderWriterStatusException(
@@ -167,6 +181,8 @@ Status GlobalOrderWriter::finalize() {
     }
   }
 
+  record_filter_pipeline_recommendations();
+
   return Status::Ok();
 }
 
@@ -702,6 +718,7 @@ Status GlobalOrderWriter::finalize_global_write_state() {
   // Compute fragment min/max/sum/null count and flush fragment metadata to
   // storage
   meta->compute_fragment_min_max_sum_null_count();
+  transfer_zstd_dictionaries(meta);
   meta->store(array_->get_encryption_key());
 
   // Add written fragment infos
@@ -716,7 +733,10 @@ Status GlobalOrderWriter::finalize_global_write_state() {
   // Write either one commit file or a consolidated commit file if multiple
   // fragments were written.
   if (frag_uris_to_commit_.size() == 0) {
-    RETURN_NOT_OK(storage_manager_->vfs()->touch(commit_uri));
+    storage_manager_->commit_fragment(
+        array_->array_schema_latest().write_version(),
+        array_->array_directory(),
+        commit_uri);
   } else {
     std::vector<URI> commit_uris;
     commit_uris.reserve(frag_uris_to_commit_.size() + 1);
@@ -788,22 +808,96 @@ Status GlobalOrderWriter::global_write() {
   // Compute tile metadata.
   RETURN_CANCEL_OR_ERROR(compute_tiles_metadata(tile_num, tiles));
 
+  // Filter and write the tiles through the two-stage pipeline, overlapping
+  // compression with I/O.
+  if (pipelined_io_) {
+    RETURN_CANCEL_OR_ERROR(
+        filter_and_write_tiles_pipelined(tile_num, mbrs, tiles));
+    return Status::Ok();
+  }
+
   // Filter all tiles
   RETURN_CANCEL_OR_ERROR(filter_tiles(&tiles));
 
-  uint64_t idx = 0;
-  while (idx < tile_num) {
+  // Write all tiles
+  RETURN_CANCEL_OR_ERROR(write_tile_range(0, tile_num, mbrs, tiles));
+
+  return Status::Ok();
+}
+
+Status GlobalOrderWriter::filter_and_write_tiles_pipelined(
+    uint64_t tile_num,
+    const std::vector<NDRange>& mbrs,
+    std::unordered_map<std::string, WriterTileTupleVector>& tiles) {
+  auto timer_se = stats_->start_timer("filter_and_write_tiles_pipelined");
+
+  // Size the batches so that a single batch carries enough tiles to keep
+  // the compute threads busy while the previously filtered batches are
+  // being written out.
+  const auto concurrency = storage_manager_->compute_tp()->concurrency_level();
+  const auto batch_size =
+      std::max<uint64_t>(1, utils::math::ceil(concurrency, tiles.size()));
+
+  // Filtered tile ranges, in tile order, flowing from the filter stage to
+  // the write stage.
+  ProducerConsumerQueue<std::pair<uint64_t, uint64_t>> ranges;
+
+  // The write stage pops the filtered ranges in order and appends them to
+  // the fragment(s) on an I/O thread.
+  auto write_task = storage_manager_->io_tp()->execute([&]() {
+    while (true) {
+      auto range = ranges.pop_back();
+      if (!range.has_value()) {
+        return Status::Ok();
+      }
+
+      RETURN_NOT_OK(write_tile_range(range->first, range->second, mbrs, tiles));
+    }
+  });
+
+  // The filter stage runs the batches through the filter pipelines on the
+  // calling thread; each batch is internally parallelized on the compute
+  // thread pool.
+  Status st = Status::Ok();
+  for (uint64_t idx = 0; idx < tile_num; idx += batch_size) {
+    const auto end_idx = std::min(tile_num, idx + batch_size);
+    st = filter_tiles(&tiles, idx, end_idx);
+    if (!st.ok()) {
+      break;
+    }
+
+    ranges.push({idx, end_idx});
+  }
+
+  // Signal the write stage that no more batches are coming and wait for it
+  // to finish writing the pending ones.
+  ranges.drain();
+  auto write_st = storage_manager_->io_tp()->wait(write_task);
+
+  RETURN_NOT_OK(st);
+  RETURN_NOT_OK(write_st);
+
+  return Status::Ok();
+}
+
+Status GlobalOrderWriter::write_tile_range(
+    uint64_t start_tile_idx,
+    uint64_t end_tile_idx,
+    const std::vector<NDRange>& mbrs,
+    std::unordered_map<std::string, WriterTileTupleVector>& tiles) {
+  uint64_t idx = start_tile_idx;
+  while (idx < end_tile_idx) {
     auto frag_meta = global_write_state_->frag_meta_;
 
     // Compute the number of tiles that will fit in this fragment.
-    auto num = num_tiles_to_write(idx, tile_num, tiles);
+    auto num = num_tiles_to_write(idx, end_tile_idx, tiles);
 
     // If we're resuming a fragment write and the first tile doesn't fit into
     // the previous fragment, we need to start a new fragment and recalculate
     // the number of tiles to write.
     if (current_fragment_size_ > 0 && num == 0) {
       RETURN_CANCEL_OR_ERROR(start_new_fragment());
-      num = num_tiles_to_write(idx, tile_num, tiles);
+      num = num_tiles_to_write(idx, end_tile_idx, tiles);
     }
 
     // Set new number of tiles in the fragment metadata
@@ -821,8 +915,8 @@ Status GlobalOrderWriter::global_write() {
     RETURN_CANCEL_OR_ERROR(write_tiles(idx, idx + num, frag_meta, &tiles));
     idx += num;
 
-    // If we didn't write all tiles, close this fragment and start another.
-    if (idx != tile_num) {
+    // If the fragment is full, close it and start another.
+    if (idx != end_tile_idx) {
       RETURN_CANCEL_OR_ERROR(start_new_fragment());
     }
 
@@ -975,6 +1069,8 @@ Status GlobalOrderWriter::prepare_full_tiles_fixed(
       cell_num_per_tile;
 
   if (full_tile_num > 0) {
+    // These tiles cannot come from the batch slab as their buffers are
+    // swapped into the long lived last tile below.
     tiles->reserve(full_tile_num);
     for (uint64_t i = 0; i < full_tile_num; i++) {
       tiles->emplace_back(WriterTileTuple(
@@ -1182,6 +1278,8 @@ Status GlobalOrderWriter::prepare_full_tiles_var(
       cell_num_per_tile;
 
   if (full_tile_num > 0) {
+    // These tiles cannot come from the batch slab as their buffers are
+    // swapped into the long lived last tile below.
     tiles->reserve(full_tile_num);
     for (uint64_t i = 0; i < full_tile_num; i++) {
       tiles->emplace_back(WriterTileTuple(
@@ -1204,46 +1302,59 @@ Status GlobalOrderWriter::prepare_full_tiles_var(
     }
 
     // Write all remaining cells one by one
-    uint64_t current_tile_cell_idx = 0;
     if (cell_num_to_write != 0) {
       if (coord_dups.empty()) {
-        for (uint64_t i = 0; i < cell_num_to_write;
-             ++cell_idx, ++i, ++current_tile_cell_idx) {
-          if (current_tile_cell_idx == cell_num_per_tile) {
-            tile_it->var_tile().set_size(last_var_offset);
-            current_tile_cell_idx = 0;
-            last_var_offset = 0;
-            tile_it++;
-          }
-
-          // Write offset.
-          tile_it->offset_tile().write(
-              &last_var_offset,
-              current_tile_cell_idx * sizeof(last_var_offset),
-              sizeof(last_var_offset));
-
-          // Write var-sized value(s).
-          auto buff_offset =
-              prepare_buffer_offset(buffer, cell_idx, attr_datatype_size);
-          uint64_t var_size =
-              (cell_idx == cell_num - 1) ?
-                  *buffer_var_size - buff_offset :
-                  prepare_buffer_offset(
-                      buffer, cell_idx + 1, attr_datatype_size) -
-                      buff_offset;
-          tile_it->var_tile().write_var(
-              buffer_var + buff_offset, last_var_offset, var_size);
-          last_var_offset += var_size;
-
-          // Write validity value(s).
-          if (nullable) {
-            tile_it->validity_tile().write(
-                buffer_validity + cell_idx,
-                current_tile_cell_idx * constants::cell_validity_size,
-                constants::cell_validity_size);
-          }
-        }
+        // Cells map contiguously onto the full tiles and the var offsets
+        // restart at zero in every tile, so the per-tile offset prefix
+        // sums can run in parallel across the whole batch.
+        const uint64_t first_cell = cell_idx;
+        const uint64_t first_tile = std::distance(tiles->begin(), tile_it);
+        const uint64_t full_tiles_to_write =
+            cell_num_to_write / cell_num_per_tile;
+        auto st = parallel_for(
+            storage_manager_->compute_tp(),
+            0,
+            full_tiles_to_write,
+            [&](uint64_t t) {
+              auto& tile = (*tiles)[first_tile + t];
+              const uint64_t start = first_cell + t * cell_num_per_tile;
+              uint64_t offset = 0;
+              for (uint64_t c = 0; c < cell_num_per_tile; ++c) {
+                const uint64_t cell = start + c;
+
+                // Write offset.
+                tile.offset_tile().write(
+                    &offset, c * sizeof(offset), sizeof(offset));
+
+                // Write var-sized value(s).
+                auto buff_offset =
+                    prepare_buffer_offset(buffer, cell, attr_datatype_size);
+                uint64_t var_size =
+                    (cell == cell_num - 1) ?
+                        *buffer_var_size - buff_offset :
+                        prepare_buffer_offset(
+                            buffer, cell + 1, attr_datatype_size) -
+                            buff_offset;
+                tile.var_tile().write_var(
+                    buffer_var + buff_offset, offset, var_size);
+                offset += var_size;
+
+                // Write validity value(s).
+                if (nullable) {
+                  tile.validity_tile().write(
+                      buffer_validity + cell,
+                      c * constants::cell_validity_size,
+                      constants::cell_validity_size);
+                }
+              }
+
+              tile.var_tile().set_size(offset);
+              return Status::Ok();
+            });
+        RETURN_NOT_OK(st);
+        cell_idx += cell_num_to_write;
       } else {
+        uint64_t current_tile_cell_idx = 0;
         for (uint64_t i = 0; i < cell_num_to_write; ++cell_idx, ++i) {
           if (coord_dups.find(cell_idx) == coord_dups.end()) {
             if (current_tile_cell_idx == cell_num_per_tile) {
@@ -1283,10 +1394,10 @@ Status GlobalOrderWriter::prepare_full_tiles_var(
             ++current_tile_cell_idx;
           }
         }
-      }
 
-      tile_it->var_tile().set_size(last_var_offset);
-      last_var_offset = 0;
+        tile_it->var_tile().set_size(last_var_offset);
+        last_var_offset = 0;
+      }
     }
   }
 
@@ -1427,6 +1538,7 @@ Status GlobalOrderWriter::start_new_fragment() {
 
   // Compute fragment min/max/sum/null count
   frag_meta->compute_fragment_min_max_sum_null_count();
+  transfer_zstd_dictionaries(frag_meta);
 
   // Flush fragment metadata to storage
   frag_meta->store(array_->get_encryption_key());
@@ -211,6 +211,13 @@ class GlobalOrderWriter : public WriterBase {
    */
   uint64_t current_fragment_size_;
 
+  /**
+   * If `true`, tile batches flow through a two-stage pipeline where the
+   * filtering of a batch overlaps the I/O of the previously filtered
+   * batches.
+   */
+  bool pipelined_io_;
+
   /* ********************************* */
   /*           PRIVATE METHODS         */
   /* ********************************* */
@@ -277,6 +284,24 @@ class GlobalOrderWriter : public WriterBase {
    */
   Status global_write();
 
+  /**
+   * Applicable only to global writes. Filters and writes the input tiles
+   * through a two-stage pipeline: a filter stage runs tile batches through
+   * the filter pipelines on the compute thread pool, while a write stage
+   * appends the filtered batches to the fragment(s) on an I/O thread. The
+   * batches are written in tile order, so the produced fragments are
+   * identical to the ones of the non-pipelined path.
+   *
+   * @param tile_num The total number of tiles to filter and write.
+   * @param mbrs The MBRs of the tiles, if the coordinates are present.
+   * @param tiles The tiles to filter and write.
+   * @return Status
+   */
+  Status filter_and_write_tiles_pipelined(
+      uint64_t tile_num,
+      const std::vector<NDRange>& mbrs,
+      std::unordered_map<std::string, WriterTileTupleVector>& tiles);
+
   /**
    * Applicable only to global writes. Writes the last tiles for each
    * attribute remaining in the state, and records the metadata for
@@ -286,6 +311,23 @@ class GlobalOrderWriter : public WriterBase {
    */
   Status global_write_handle_last_tile();
 
+  /**
+   * Writes the filtered tiles within the input tile range to the current
+   * fragment, starting new fragments whenever the desired fragment size is
+   * reached. The tiles in the range must have been filtered already.
+   *
+   * @param start_tile_idx The first tile to write.
+   * @param end_tile_idx The last tile to write (exclusive).
+   * @param mbrs The MBRs of the tiles, if the coordinates are present.
+   * @param tiles The tiles to write.
+   * @return Status
+   */
+  Status write_tile_range(
+      uint64_t start_tile_idx,
+      uint64_t end_tile_idx,
+      const std::vector<NDRange>& mbrs,
+      std::unordered_map<std::string, WriterTileTupleVector>& tiles);
+
   /**
    * This deletes the global write state and deletes the potentially
    * partially written fragment.
@@ -148,6 +148,8 @@ Status OrderedWriter::dowork() {
 Status OrderedWriter::finalize() {
   auto timer_se = stats_->start_timer("finalize");
 
+  record_filter_pipeline_recommendations();
+
   return Status::Ok();
 }
 
@@ -226,12 +228,31 @@ Status OrderedWriter::ordered_write() {
           attr, attr_tile_batches, frag_meta, &dense_tiler, 1);
     }));
   } else {  // Parallelize over tiles
+    // Carry the pending IO task across attributes so that the last write
+    // of each attribute overlaps the tile preparation and filtering of the
+    // next one. At most one batch of filtered tiles is in flight at any
+    // time, so this does not grow the memory footprint of the write.
+    std::optional<ThreadPool::Task> write_task = nullopt;
+    Status st = Status::Ok();
     for (const auto& buff : buffers_) {
       const auto& attr = buff.first;
       auto& attr_tile_batches = tiles[attr];
-      RETURN_NOT_OK(prepare_filter_and_write_tiles<T>(
-          attr, attr_tile_batches, frag_meta, &dense_tiler, thread_num));
+      st = prepare_filter_and_write_tiles<T>(
+          attr,
+          attr_tile_batches,
+          frag_meta,
+          &dense_tiler,
+          thread_num,
+          &write_task);
+      if (!st.ok()) {
+        break;
+      }
+    }
+    if (write_task.has_value()) {
+      write_task->wait();
+      RETURN_NOT_OK(write_task->get());
     }
+    RETURN_NOT_OK(st);
   }
 
   // Fix the tile metadata for var size attributes.
@@ -282,6 +303,7 @@ Status OrderedWriter::ordered_write() {
 
   // Compute fragment min/max/sum/null count and write the fragment metadata
   frag_meta->compute_fragment_min_max_sum_null_count();
+  transfer_zstd_dictionaries(frag_meta);
   frag_meta->store(array_->get_encryption_key());
 
   // Add written fragment info
@@ -289,7 +311,10 @@ Status OrderedWriter::ordered_write() {
 
   // The following will make the fragment visible
   URI commit_uri = array_->array_directory().get_commit_uri(frag_uri_.value());
-  RETURN_NOT_OK(storage_manager_->vfs()->touch(commit_uri));
+  storage_manager_->commit_fragment(
+      array_->array_schema_latest().write_version(),
+      array_->array_directory(),
+      commit_uri);
 
   return Status::Ok();
 }
@@ -300,7 +325,8 @@ Status OrderedWriter::prepare_filter_and_write_tiles(
     std::vector<WriterTileTupleVector>& tile_batches,
     shared_ptr<FragmentMetadata> frag_meta,
     DenseTiler<T>* dense_tiler,
-    uint64_t thread_num) {
+    uint64_t thread_num,
+    std::optional<ThreadPool::Task>* write_task) {
   auto timer_se = stats_->start_timer("prepare_filter_and_write_tiles");
 
   // For easy reference
@@ -321,19 +347,27 @@ Status OrderedWriter::prepare_filter_and_write_tiles(
   batch_num += (last_batch_size > 0);
   last_batch_size = (last_batch_size == 0) ? thread_num : last_batch_size;
 
-  // Process batches
+  // Process batches. Unless the caller provided a slot to carry the
+  // pending IO task across invocations, use a local one and wait for it
+  // before returning.
   uint64_t frag_tile_id = 0;
-  bool close_files = false;
   tile_batches.resize(batch_num);
-  std::optional<ThreadPool::Task> write_task = nullopt;
+  std::optional<ThreadPool::Task> local_write_task = nullopt;
+  const bool carry_write_task = (write_task != nullptr);
+  if (!carry_write_task) {
+    write_task = &local_write_task;
+  }
   for (uint64_t b = 0; b < batch_num; ++b) {
     auto batch_size = (b == batch_num - 1) ? last_batch_size : thread_num;
     assert(batch_size > 0);
-    tile_batches[b].reserve(batch_size);
-    for (uint64_t i = 0; i < batch_size; i++) {
-      tile_batches[b].emplace_back(WriterTileTuple(
-          array_schema_, cell_num_per_tile, var, nullable, cell_size, type));
-    }
+    tile_batches[b].init_tiles(
+        array_schema_,
+        batch_size,
+        cell_num_per_tile,
+        var,
+        nullable,
+        cell_size,
+        type);
 
     {
       auto timer_se = stats_->start_timer("prepare_and_filter_tiles");
@@ -363,31 +397,34 @@ Status OrderedWriter::prepare_filter_and_write_tiles(
       RETURN_NOT_OK(st);
     }
 
-    if (write_task.has_value()) {
-      write_task->wait();
-      RETURN_NOT_OK(write_task->get());
+    if (write_task->has_value()) {
+      (*write_task)->wait();
+      RETURN_NOT_OK((*write_task)->get());
     }
 
-    write_task = storage_manager_->io_tp()->execute([&, b, frag_tile_id]() {
-      close_files = (b == batch_num - 1);
-      RETURN_NOT_OK(write_tiles(
-          0,
-          tile_batches[b].size(),
-          name,
-          frag_meta,
-          frag_tile_id,
-          &tile_batches[b],
-          close_files));
-
-      return Status::Ok();
-    });
+    // The task may outlive this invocation when carried by the caller, so
+    // capture by value everything that is local to it.
+    bool close_files = (b == batch_num - 1);
+    *write_task = storage_manager_->io_tp()->execute(
+        [this, &tile_batches, name, frag_meta, b, frag_tile_id, close_files]() {
+          RETURN_NOT_OK(write_tiles(
+              0,
+              tile_batches[b].size(),
+              name,
+              frag_meta,
+              frag_tile_id,
+              &tile_batches[b],
+              close_files));
+
+          return Status::Ok();
+        });
 
     frag_tile_id += batch_size;
   }
 
-  if (write_task.has_value()) {
-    write_task->wait();
-    RETURN_NOT_OK(write_task->get());
+  if (!carry_write_task && write_task->has_value()) {
+    (*write_task)->wait();
+    RETURN_NOT_OK((*write_task)->get());
   }
 
   return Status::Ok();
@@ -128,6 +128,12 @@ class OrderedWriter : public WriterBase {
    * @param frag_meta The metadata of the new fragment.
    * @param dense_tiler The dense tiler that will prepare the tiles.
    * @param thread_num The number of threads to be used for the function.
+   * @param write_task If non-null, the pending IO task is carried in this
+   *     slot across invocations instead of being awaited before returning,
+   *     so the last write of one attribute overlaps the tile preparation
+   *     and filtering of the next. The caller must wait on the task after
+   *     the last invocation. If null, the function waits for all writes
+   *     before returning.
    * @param stats Statistics to gather in the function.
    */
   template <class T>
@@ -136,7 +142,8 @@ class OrderedWriter : public WriterBase {
       std::vector<WriterTileTupleVector>& tile_batches,
       shared_ptr<FragmentMetadata> frag_meta,
       DenseTiler<T>* dense_tiler,
-      uint64_t thread_num);
+      uint64_t thread_num,
+      std::optional<ThreadPool::Task>* write_task = nullptr);
 };
 
 }  // namespace sm
@@ -53,6 +53,7 @@
 #include "tiledb/sm/tile/generic_tile_io.h"
 #include "tiledb/sm/tile/tile_metadata_generator.h"
 #include "tiledb/sm/tile/writer_tile_tuple.h"
+#include "tiledb/type/apply_with_type.h"
 
 using namespace tiledb;
 using namespace tiledb::common;
@@ -103,6 +104,7 @@ UnorderedWriter::UnorderedWriter(
           fragment_name,
           skip_checks_serialization)
     , frag_uri_(std::nullopt)
+    , coord_dups_fused_(false)
     , written_buffers_(written_buffers)
     , is_coords_pass_(true) {
   // Check the layout is unordered.
@@ -169,6 +171,8 @@ Status UnorderedWriter::finalize() {
     throw UnorderWriterStatusException("Not all buffers already written");
   }
 
+  record_filter_pipeline_recommendations();
+
   return Status::Ok();
 }
 
@@ -198,6 +202,70 @@ void UnorderedWriter::clean_up() {
   }
 }
 
+UnorderedWriter::DimensionBuffers UnorderedWriter::dimension_buffers() const {
+  // Prepare auxiliary vectors for better performance
+  auto dim_num = array_schema_.dim_num();
+  DimensionBuffers ret;
+  ret.buffs.resize(dim_num);
+  ret.coord_sizes.resize(dim_num);
+  ret.buffs_var.resize(dim_num);
+  ret.buffs_var_sizes.resize(dim_num);
+  for (unsigned d = 0; d < dim_num; ++d) {
+    const auto& dim_name{array_schema_.dimension_ptr(d)->name()};
+    ret.buffs[d] =
+        (const unsigned char*)buffers_.find(dim_name)->second.buffer_;
+    ret.coord_sizes[d] = array_schema_.cell_size(dim_name);
+    ret.buffs_var[d] =
+        (const unsigned char*)buffers_.find(dim_name)->second.buffer_var_;
+    ret.buffs_var_sizes[d] = buffers_.find(dim_name)->second.buffer_var_size_;
+  }
+
+  return ret;
+}
+
+bool UnorderedWriter::identical_coords(
+    const DimensionBuffers& dim_buffs, uint64_t a, uint64_t b) const {
+  auto dim_num = array_schema_.dim_num();
+  for (unsigned d = 0; d < dim_num; ++d) {
+    auto dim{array_schema_.dimension_ptr(d)};
+    if (!dim->var_size()) {  // Fixed-sized dimensions
+      if (memcmp(
+              dim_buffs.buffs[d] + a * dim_buffs.coord_sizes[d],
+              dim_buffs.buffs[d] + b * dim_buffs.coord_sizes[d],
+              dim_buffs.coord_sizes[d]) != 0) {  // Not the same
+        return false;
+      }
+    } else {
+      auto offs = (uint64_t*)dim_buffs.buffs[d];
+      auto off_a = offs[a];
+      auto off_b = offs[b];
+      auto off_a_plus_1 = (a == coords_info_.coords_num_ - 1) ?
+                              *(dim_buffs.buffs_var_sizes[d]) :
+                              offs[a + 1];
+      auto off_b_plus_1 = (b == coords_info_.coords_num_ - 1) ?
+                              *(dim_buffs.buffs_var_sizes[d]) :
+                              offs[b + 1];
+      auto size_a = off_a_plus_1 - off_a;
+      auto size_b = off_b_plus_1 - off_b;
+
+      // Compare sizes
+      if (size_a != size_b) {  // Not same
+        return false;
+      }
+
+      // Compare var values
+      if (memcmp(
+              dim_buffs.buffs_var[d] + off_a,
+              dim_buffs.buffs_var[d] + off_b,
+              size_a) != 0) {  // Not the same
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
 Status UnorderedWriter::check_coord_dups() const {
   auto timer_se = stats_->start_timer("check_coord_dups");
 
@@ -214,72 +282,25 @@ Status UnorderedWriter::check_coord_dups() const {
   if (coords_info_.coords_num_ < 2)
     return Status::Ok();
 
-  // Prepare auxiliary vectors for better performance
-  auto dim_num = array_schema_.dim_num();
-  std::vector<const unsigned char*> buffs(dim_num);
-  std::vector<uint64_t> coord_sizes(dim_num);
-  std::vector<const unsigned char*> buffs_var(dim_num);
-  std::vector<uint64_t*> buffs_var_sizes(dim_num);
-  for (unsigned d = 0; d < dim_num; ++d) {
-    const auto& dim_name{array_schema_.dimension_ptr(d)->name()};
-    buffs[d] = (const unsigned char*)buffers_.find(dim_name)->second.buffer_;
-    coord_sizes[d] = array_schema_.cell_size(dim_name);
-    buffs_var[d] =
-        (const unsigned char*)buffers_.find(dim_name)->second.buffer_var_;
-    buffs_var_sizes[d] = buffers_.find(dim_name)->second.buffer_var_size_;
+  // The duplicates were already detected while sorting the tile buckets.
+  if (coord_dups_fused_) {
+    if (!coord_dups_.empty()) {
+      std::stringstream ss;
+      ss << "Duplicate coordinates " << coords_to_str(*coord_dups_.begin());
+      ss << " are not allowed";
+      return logger_->status(Status_WriterError(ss.str()));
+    }
+    return Status::Ok();
   }
 
+  auto dim_buffs = dimension_buffers();
   auto status = parallel_for(
       storage_manager_->compute_tp(),
       1,
       coords_info_.coords_num_,
       [&](uint64_t i) {
         // Check for duplicate in adjacent cells
-        bool found_dup = true;
-        for (unsigned d = 0; d < dim_num; ++d) {
-          auto dim{array_schema_.dimension_ptr(d)};
-          if (!dim->var_size()) {  // Fixed-sized dimensions
-            if (memcmp(
-                    buffs[d] + cell_pos_[i] * coord_sizes[d],
-                    buffs[d] + cell_pos_[i - 1] * coord_sizes[d],
-                    coord_sizes[d]) != 0) {  // Not the same
-              found_dup = false;
-              break;
-            }
-          } else {
-            auto offs = (uint64_t*)buffs[d];
-            auto a = cell_pos_[i];
-            auto b = cell_pos_[i - 1];
-            auto off_a = offs[a];
-            auto off_b = offs[b];
-            auto off_a_plus_1 = (a == coords_info_.coords_num_ - 1) ?
-                                    *(buffs_var_sizes[d]) :
-                                    offs[a + 1];
-            auto off_b_plus_1 = (b == coords_info_.coords_num_ - 1) ?
-                                    *(buffs_var_sizes[d]) :
-                                    offs[b + 1];
-            auto size_a = off_a_plus_1 - off_a;
-            auto size_b = off_b_plus_1 - off_b;
-
-            // Compare sizes
-            if (size_a != size_b) {  // Not same
-              found_dup = false;
-              break;
-            }
-
-            // Compare var values
-            if (memcmp(
-                    buffs_var[d] + off_a,
-                    buffs_var[d] + off_b,
-                    size_a) != 0) {  // Not the same
-              found_dup = false;
-              break;
-            }
-          }
-        }
-
-        // Found duplicate
-        if (found_dup) {
+        if (identical_coords(dim_buffs, cell_pos_[i], cell_pos_[i - 1])) {
           std::stringstream ss;
           ss << "Duplicate coordinates " << coords_to_str(cell_pos_[i]);
           ss << " are not allowed";
@@ -306,21 +327,12 @@ Status UnorderedWriter::compute_coord_dups() {
   if (coords_info_.coords_num_ < 2)
     return Status::Ok();
 
-  // Prepare auxiliary vectors for better performance
-  auto dim_num = array_schema_.dim_num();
-  std::vector<const unsigned char*> buffs(dim_num);
-  std::vector<uint64_t> coord_sizes(dim_num);
-  std::vector<const unsigned char*> buffs_var(dim_num);
-  std::vector<uint64_t*> buffs_var_sizes(dim_num);
-  for (unsigned d = 0; d < dim_num; ++d) {
-    const auto& dim_name{array_schema_.dimension_ptr(d)->name()};
-    buffs[d] = (const unsigned char*)buffers_.find(dim_name)->second.buffer_;
-    coord_sizes[d] = array_schema_.cell_size(dim_name);
-    buffs_var[d] =
-        (const unsigned char*)buffers_.find(dim_name)->second.buffer_var_;
-    buffs_var_sizes[d] = buffers_.find(dim_name)->second.buffer_var_size_;
+  // The duplicates were already computed while sorting the tile buckets.
+  if (coord_dups_fused_) {
+    return Status::Ok();
   }
 
+  auto dim_buffs = dimension_buffers();
   std::mutex mtx;
   auto status = parallel_for(
       storage_manager_->compute_tp(),
@@ -328,51 +340,7 @@ Status UnorderedWriter::compute_coord_dups() {
       coords_info_.coords_num_,
       [&](uint64_t i) {
         // Check for duplicate in adjacent cells
-        bool found_dup = true;
-        for (unsigned d = 0; d < dim_num; ++d) {
-          auto dim{array_schema_.dimension_ptr(d)};
-          if (!dim->var_size()) {  // Fixed-sized dimensions
-            if (memcmp(
-                    buffs[d] + cell_pos_[i] * coord_sizes[d],
-                    buffs[d] + cell_pos_[i - 1] * coord_sizes[d],
-                    coord_sizes[d]) != 0) {  // Not the same
-              found_dup = false;
-              break;
-            }
-          } else {
-            auto offs = (uint64_t*)buffs[d];
-            auto a = cell_pos_[i];
-            auto b = cell_pos_[i - 1];
-            auto off_a = offs[a];
-            auto off_b = offs[b];
-            auto off_a_plus_1 = (a == coords_info_.coords_num_ - 1) ?
-                                    *(buffs_var_sizes[d]) :
-                                    offs[a + 1];
-            auto off_b_plus_1 = (b == coords_info_.coords_num_ - 1) ?
-                                    *(buffs_var_sizes[d]) :
-                                    offs[b + 1];
-            auto size_a = off_a_plus_1 - off_a;
-            auto size_b = off_b_plus_1 - off_b;
-
-            // Compare sizes
-            if (size_a != size_b) {  // Not same
-              found_dup = false;
-              break;
-            }
-
-            // Compare var values
-            if (memcmp(
-                    buffs_var[d] + off_a,
-                    buffs_var[d] + off_b,
-                    size_a) != 0) {  // Not the same
-              found_dup = false;
-              break;
-            }
-          }
-        }
-
-        // Found duplicate
-        if (found_dup) {
+        if (identical_coords(dim_buffs, cell_pos_[i], cell_pos_[i - 1])) {
           std::lock_guard<std::mutex> lock(mtx);
           coord_dups_.insert(cell_pos_[i]);
         }
@@ -439,11 +407,14 @@ Status UnorderedWriter::prepare_tiles_fixed(
   auto tile_num = utils::math::ceil(cell_num - dups_num, cell_num_per_tile);
 
   // Initialize tiles
-  tiles->reserve(tile_num);
-  for (uint64_t i = 0; i < tile_num; i++) {
-    tiles->emplace_back(WriterTileTuple(
-        array_schema_, cell_num_per_tile, false, nullable, cell_size, type));
-  }
+  tiles->init_tiles(
+      array_schema_,
+      tile_num,
+      cell_num_per_tile,
+      false,
+      nullable,
+      cell_size,
+      type);
 
   // Write all cells one by one
   uint64_t cell_idx = 0;
@@ -510,99 +481,302 @@ Status UnorderedWriter::prepare_tiles_var(
   auto attr_datatype_size = datatype_size(array_schema_.type(name));
 
   // Initialize tiles
-  tiles->reserve(tile_num);
-  for (uint64_t i = 0; i < tile_num; i++) {
-    tiles->emplace_back(WriterTileTuple(
-        array_schema_, cell_num_per_tile, true, nullable, cell_size, type));
+  tiles->init_tiles(
+      array_schema_,
+      tile_num,
+      cell_num_per_tile,
+      true,
+      nullable,
+      cell_size,
+      type);
+
+  // Filter out duplicate cells so every tile covers a contiguous range of
+  // written cells.
+  const std::vector<uint64_t>* cell_pos = &cell_pos_;
+  std::vector<uint64_t> filtered_pos;
+  if (dups_num != 0) {
+    filtered_pos.reserve(cell_num - dups_num);
+    for (uint64_t i = 0; i < cell_num; ++i) {
+      if (coord_dups_.find(cell_pos_[i]) == coord_dups_.end()) {
+        filtered_pos.emplace_back(cell_pos_[i]);
+      }
+    }
+    cell_pos = &filtered_pos;
   }
 
-  // Write all cells one by one
-  uint64_t cell_idx = 0;
-  auto tile_it = tiles->begin();
-  uint64_t offset = 0;
-  if (dups_num == 0) {
-    for (uint64_t i = 0; i < cell_num; ++i, ++cell_idx) {
-      if (cell_idx == cell_num_per_tile) {
-        tile_it->var_tile().set_size(offset);
-        cell_idx = 0;
-        offset = 0;
-        tile_it++;
-      }
+  // The var offsets restart at zero in every tile, so the tiles have no
+  // cross-tile dependency and the per-tile offset prefix sums can run in
+  // parallel across the whole batch.
+  const uint64_t wrote_cell_num = cell_num - dups_num;
+  auto status = parallel_for(
+      storage_manager_->compute_tp(), 0, tile_num, [&](uint64_t t) {
+        auto& tile = (*tiles)[t];
+        const uint64_t start = t * cell_num_per_tile;
+        const uint64_t end =
+            std::min(start + cell_num_per_tile, wrote_cell_num);
+        uint64_t offset = 0;
+        for (uint64_t i = start; i < end; ++i) {
+          const uint64_t pos = (*cell_pos)[i];
+          const uint64_t cell_idx = i - start;
+
+          // Write offset.
+          tile.offset_tile().write(
+              &offset, cell_idx * sizeof(offset), sizeof(offset));
+
+          // Write var-sized value(s).
+          auto buff_offset =
+              prepare_buffer_offset(buffer, pos, attr_datatype_size);
+          uint64_t var_size =
+              (pos == cell_num - 1) ?
+                  *buffer_var_size - buff_offset :
+                  prepare_buffer_offset(buffer, pos + 1, attr_datatype_size) -
+                      buff_offset;
+          tile.var_tile().write_var(buffer_var + buff_offset, offset, var_size);
+          offset += var_size;
+
+          // Write validity value(s).
+          if (nullable) {
+            tile.validity_tile().write(
+                buffer_validity + pos,
+                cell_idx * constants::cell_validity_size,
+                constants::cell_validity_size);
+          }
+        }
 
-      // Write offset.
-      tile_it->offset_tile().write(
-          &offset, cell_idx * sizeof(offset), sizeof(offset));
-
-      // Write var-sized value(s).
-      auto buff_offset =
-          prepare_buffer_offset(buffer, cell_pos_[i], attr_datatype_size);
-      uint64_t var_size =
-          (cell_pos_[i] == cell_num - 1) ?
-              *buffer_var_size - buff_offset :
-              prepare_buffer_offset(
-                  buffer, cell_pos_[i] + 1, attr_datatype_size) -
-                  buff_offset;
-      tile_it->var_tile().write_var(buffer_var + buff_offset, offset, var_size);
-      offset += var_size;
-
-      // Write validity value(s).
-      if (nullable) {
-        tile_it->validity_tile().write(
-            buffer_validity + cell_pos_[i],
-            cell_idx * constants::cell_validity_size,
-            constants::cell_validity_size);
-      }
+        tile.var_tile().set_size(offset);
+        return Status::Ok();
+      });
+  RETURN_NOT_OK(status);
+
+  uint64_t last_tile_cell_num = wrote_cell_num % cell_num_per_tile;
+  if (last_tile_cell_num != 0) {
+    tiles->back().set_final_size(last_tile_cell_num);
+  }
+
+  return Status::Ok();
+}
+
+std::optional<std::vector<uint64_t>> UnorderedWriter::compute_tile_keys()
+    const {
+  auto dim_num = array_schema_.dim_num();
+  auto cell_num = coords_info_.coords_num_;
+
+  // Find the dimensions that participate in the tile order; the others do
+  // not affect the key, mirroring `Domain::tile_order_cmp`.
+  std::vector<unsigned> tile_dims;
+  for (unsigned d = 0; d < dim_num; ++d) {
+    auto dim{array_schema_.dimension_ptr(d)};
+    if (!dim->var_size() && dim->tile_extent()) {
+      tile_dims.emplace_back(d);
     }
-  } else {
-    for (uint64_t i = 0; i < cell_num; ++i) {
-      if (coord_dups_.find(cell_pos_[i]) != coord_dups_.end())
-        continue;
+  }
 
-      if (cell_idx == cell_num_per_tile) {
-        tile_it->var_tile().set_size(offset);
-        cell_idx = 0;
-        offset = 0;
-        tile_it++;
-      }
+  if (tile_dims.empty() || cell_num == 0) {
+    return nullopt;
+  }
 
-      // Write offset.
-      tile_it->offset_tile().write(
-          &offset, cell_idx * sizeof(offset), sizeof(offset));
-
-      // Write var-sized value(s).
-      auto buff_offset =
-          prepare_buffer_offset(buffer, cell_pos_[i], attr_datatype_size);
-      uint64_t var_size =
-          (cell_pos_[i] == cell_num - 1) ?
-              *buffer_var_size - buff_offset :
-              prepare_buffer_offset(
-                  buffer, cell_pos_[i] + 1, attr_datatype_size) -
-                  buff_offset;
-      tile_it->var_tile().write_var(buffer_var + buff_offset, offset, var_size);
-      offset += var_size;
-
-      // Write validity value(s).
-      if (nullable) {
-        tile_it->validity_tile().write(
-            buffer_validity + cell_pos_[i],
-            cell_idx * constants::cell_validity_size,
-            constants::cell_validity_size);
-      }
+  // Compute, per participating dimension, the range of tile indices
+  // spanned by the written cells, so that the keys linearize only the
+  // part of the tile grid the data actually covers.
+  constexpr uint64_t batch_size = 256;
+  auto batch_num = utils::math::ceil(cell_num, batch_size);
+  std::vector<uint64_t> min_idx(dim_num, 0);
+  std::vector<uint64_t> span(dim_num, 1);
+  for (auto d : tile_dims) {
+    auto dim{array_schema_.dimension_ptr(d)};
+    auto buff = buffers_.find(dim->name())->second.buffer_;
+    apply_with_type(
+        [&](auto type) {
+          using T = decltype(type);
+          auto coords = static_cast<const T*>(buff);
+          auto tile_extent = *(const T*)dim->tile_extent().data();
+          auto dim_dom = (const T*)dim->domain().data();
+          std::vector<uint64_t> batch_min(
+              batch_num, std::numeric_limits<uint64_t>::max());
+          std::vector<uint64_t> batch_max(batch_num, 0);
+          throw_if_not_ok(parallel_for(
+              storage_manager_->compute_tp(), 0, batch_num, [&](uint64_t b) {
+                auto start = b * batch_size;
+                auto end = std::min(start + batch_size, cell_num);
+                for (uint64_t c = start; c < end; ++c) {
+                  auto t =
+                      Dimension::tile_idx(coords[c], dim_dom[0], tile_extent);
+                  batch_min[b] = std::min(batch_min[b], t);
+                  batch_max[b] = std::max(batch_max[b], t);
+                }
+                return Status::Ok();
+              }));
+          min_idx[d] = *std::min_element(batch_min.begin(), batch_min.end());
+          span[d] = *std::max_element(batch_max.begin(), batch_max.end()) -
+                    min_idx[d];
+        },
+        dim->type());
+  }
 
-      ++cell_idx;
+  // The per-dimension spans become the radices of a mixed radix key, with
+  // the most significant dimension first for row-major tile order and last
+  // for col-major. Bail out if the covered tile grid does not fit in 64
+  // bits.
+  std::vector<uint64_t> mult(dim_num, 0);
+  uint64_t total = 1;
+  auto add_radix = [&](unsigned d) {
+    if (span[d] == std::numeric_limits<uint64_t>::max()) {
+      return false;
+    }
+    span[d]++;
+    if (total > std::numeric_limits<uint64_t>::max() / span[d]) {
+      return false;
+    }
+    mult[d] = total;
+    total *= span[d];
+    return true;
+  };
+  if (array_schema_.tile_order() == Layout::ROW_MAJOR) {
+    for (auto it = tile_dims.rbegin(); it != tile_dims.rend(); ++it) {
+      if (!add_radix(*it)) {
+        return nullopt;
+      }
+    }
+  } else {  // COL_MAJOR
+    for (auto d : tile_dims) {
+      if (!add_radix(d)) {
+        return nullopt;
+      }
     }
   }
 
-  if (cell_num > 0) {
-    tile_it->var_tile().set_size(offset);
+  // Accumulate the keys, one participating dimension at a time.
+  std::vector<uint64_t> keys(cell_num, 0);
+  for (auto d : tile_dims) {
+    auto dim{array_schema_.dimension_ptr(d)};
+    auto buff = buffers_.find(dim->name())->second.buffer_;
+    apply_with_type(
+        [&](auto type) {
+          using T = decltype(type);
+          auto coords = static_cast<const T*>(buff);
+          auto tile_extent = *(const T*)dim->tile_extent().data();
+          auto dim_dom = (const T*)dim->domain().data();
+          auto m = mult[d];
+          auto min_t = min_idx[d];
+          throw_if_not_ok(parallel_for(
+              storage_manager_->compute_tp(), 0, batch_num, [&](uint64_t b) {
+                auto start = b * batch_size;
+                auto end = std::min(start + batch_size, cell_num);
+                for (uint64_t c = start; c < end; ++c) {
+                  keys[c] +=
+                      m * (Dimension::tile_idx(
+                               coords[c], dim_dom[0], tile_extent) -
+                           min_t);
+                }
+                return Status::Ok();
+              }));
+        },
+        dim->type());
   }
 
-  uint64_t last_tile_cell_num = (cell_num - dups_num) % cell_num_per_tile;
-  if (last_tile_cell_num != 0) {
-    tile_it->set_final_size(last_tile_cell_num);
+  return keys;
+}
+
+bool UnorderedWriter::sort_coords_bucketed(
+    const DomainBuffersView& domain_buffs) {
+  auto timer_se = stats_->start_timer("sort_coords_bucketed");
+
+  auto keys = compute_tile_keys();
+  if (!keys.has_value()) {
+    return false;
   }
 
-  return Status::Ok();
+  // Stable radix partition on the tile keys; cells of the same space tile
+  // become contiguous, with the tiles in tile order.
+  parallel_radix_sort(
+      storage_manager_->compute_tp(), cell_pos_, [&](uint64_t pos) {
+        return (*keys)[pos];
+      });
+
+  // Collect the tile bucket boundaries.
+  auto cell_num = cell_pos_.size();
+  std::vector<uint64_t> bucket_offsets;
+  bucket_offsets.emplace_back(0);
+  for (uint64_t i = 1; i < cell_num; ++i) {
+    if ((*keys)[cell_pos_[i]] != (*keys)[cell_pos_[i - 1]]) {
+      bucket_offsets.emplace_back(i);
+    }
+  }
+  bucket_offsets.emplace_back(cell_num);
+
+  // Sort each tile bucket independently; cells in a bucket share a space
+  // tile, so only the cell order decides their relative order. Buckets
+  // large enough to starve the parallel bucket pass are sorted with the
+  // parallel sort instead, so a handful of heavily hit tiles cannot
+  // serialize the write.
+  CellCmpQB cmp(array_schema_.domain(), domain_buffs);
+  auto bucket_num = bucket_offsets.size() - 1;
+  const uint64_t large_bucket = std::max<uint64_t>(
+      1024, cell_num / storage_manager_->compute_tp()->concurrency_level());
+
+  // Identical coordinates always share a tile key, so the radix buckets
+  // partition duplicate detection as well: a duplicate can only be adjacent
+  // to its twin within a sorted bucket. Detect the duplicates while each
+  // bucket is still cache-hot from sorting, which replaces the separate
+  // full-table passes in `check_coord_dups`/`compute_coord_dups`.
+  const bool find_dups =
+      dedup_coords_ || (check_coord_dups_ && !array_schema_.allows_dups());
+  DimensionBuffers dim_buffs;
+  if (find_dups) {
+    dim_buffs = dimension_buffers();
+  }
+  std::mutex dups_mtx;
+
+  std::vector<uint64_t> small_buckets;
+  for (uint64_t b = 0; b < bucket_num; ++b) {
+    if (bucket_offsets[b + 1] - bucket_offsets[b] > large_bucket) {
+      parallel_sort(
+          storage_manager_->compute_tp(),
+          cell_pos_.begin() + bucket_offsets[b],
+          cell_pos_.begin() + bucket_offsets[b + 1],
+          cmp);
+      if (find_dups) {
+        throw_if_not_ok(parallel_for(
+            storage_manager_->compute_tp(),
+            bucket_offsets[b] + 1,
+            bucket_offsets[b + 1],
+            [&](uint64_t i) {
+              if (identical_coords(dim_buffs, cell_pos_[i], cell_pos_[i - 1])) {
+                std::lock_guard<std::mutex> lock(dups_mtx);
+                coord_dups_.insert(cell_pos_[i]);
+              }
+              return Status::Ok();
+            }));
+      }
+    } else {
+      small_buckets.emplace_back(b);
+    }
+  }
+  throw_if_not_ok(parallel_for(
+      storage_manager_->compute_tp(),
+      0,
+      small_buckets.size(),
+      [&](uint64_t i) {
+        auto b = small_buckets[i];
+        std::sort(
+            cell_pos_.begin() + bucket_offsets[b],
+            cell_pos_.begin() + bucket_offsets[b + 1],
+            cmp);
+        if (find_dups) {
+          for (uint64_t c = bucket_offsets[b] + 1; c < bucket_offsets[b + 1];
+               ++c) {
+            if (identical_coords(dim_buffs, cell_pos_[c], cell_pos_[c - 1])) {
+              std::lock_guard<std::mutex> lock(dups_mtx);
+              coord_dups_.insert(cell_pos_[c]);
+            }
+          }
+        }
+        return Status::Ok();
+      }));
+
+  coord_dups_fused_ = find_dups;
+
+  return true;
 }
 
 Status UnorderedWriter::sort_coords() {
@@ -618,19 +792,43 @@ Status UnorderedWriter::sort_coords() {
   const Domain& domain = array_schema_.domain();
   DomainBuffersView domain_buffs{array_schema_, buffers_};
   if (cell_order != Layout::HILBERT) {  // Row- or col-major
-    parallel_sort(
-        storage_manager_->compute_tp(),
-        cell_pos_.begin(),
-        cell_pos_.end(),
-        GlobalCmpQB(domain, domain_buffs));
+    // Bucket the cells into their space tiles and sort only within each
+    // tile; fall back to the full global comparison sort when the tile
+    // keys cannot be computed.
+    if (!sort_coords_bucketed(domain_buffs)) {
+      parallel_sort(
+          storage_manager_->compute_tp(),
+          cell_pos_.begin(),
+          cell_pos_.end(),
+          GlobalCmpQB(domain, domain_buffs));
+    }
   } else {  // Hilbert order
     std::vector<uint64_t> hilbert_values(coords_info_.coords_num_);
     RETURN_NOT_OK(calculate_hilbert_values(domain_buffs, hilbert_values));
-    parallel_sort(
-        storage_manager_->compute_tp(),
-        cell_pos_.begin(),
-        cell_pos_.end(),
-        HilbertCmpQB(domain, domain_buffs, hilbert_values));
+
+    // Radix sort on the materialized Hilbert keys instead of comparison
+    // sorting, which avoids the indirect per-comparison coordinate accesses.
+    parallel_radix_sort(
+        storage_manager_->compute_tp(), cell_pos_, [&](uint64_t pos) {
+          return hilbert_values[pos];
+        });
+
+    // The radix sort is stable, so runs of cells with equal Hilbert values
+    // are still in their original order. Sort them with the full comparator,
+    // which tie-breaks on the coordinates. Such runs are rare and small.
+    HilbertCmpQB cmp(domain, domain_buffs, hilbert_values);
+    uint64_t run_start = 0;
+    for (uint64_t i = 1; i <= cell_pos_.size(); i++) {
+      if (i == cell_pos_.size() ||
+          hilbert_values[cell_pos_[i]] !=
+              hilbert_values[cell_pos_[run_start]]) {
+        if (i - run_start > 1) {
+          std::sort(
+              cell_pos_.begin() + run_start, cell_pos_.begin() + i, cmp);
+        }
+        run_start = i;
+      }
+    }
   }
 
   return Status::Ok();
@@ -722,6 +920,7 @@ Status UnorderedWriter::unordered_write() {
       array_schema_.dim_num() + array_schema_.attribute_num()) {
     // Compute fragment min/max/sum/null count and write the fragment metadata
     frag_meta_->compute_fragment_min_max_sum_null_count();
+    transfer_zstd_dictionaries(frag_meta_);
     frag_meta_->store(array_->get_encryption_key());
 
     // Add written fragment info
@@ -731,7 +930,10 @@ Status UnorderedWriter::unordered_write() {
     URI commit_uri =
         array_->array_directory().get_commit_uri(frag_uri_.value());
 
-    RETURN_NOT_OK(storage_manager_->vfs()->touch(commit_uri));
+    storage_manager_->commit_fragment(
+        array_->array_schema_latest().write_version(),
+        array_->array_directory(),
+        commit_uri);
 
     // Clear some data to prevent it from being serialized.
     cell_pos_.clear();
@@ -130,6 +130,13 @@ class UnorderedWriter : public WriterBase {
   /** The set with the positions of duplicate coordinates/cells. */
   std::set<uint64_t> coord_dups_;
 
+  /**
+   * `true` if duplicate detection was fused into the bucketed sort, in
+   * which case `coord_dups_` is already populated and the separate
+   * detection passes are skipped.
+   */
+  bool coord_dups_fused_;
+
   /** Pointer to the fragment metadata. */
   shared_ptr<FragmentMetadata> frag_meta_;
 
@@ -149,6 +156,31 @@ class UnorderedWriter : public WriterBase {
   /** Invoked on error. It removes the directory of the input URI. */
   void clean_up();
 
+  /**
+   * Pointers into the coordinate query buffers, one entry per dimension,
+   * used for comparing the coordinates of two cells.
+   */
+  struct DimensionBuffers {
+    /** Fixed data or offsets buffer per dimension. */
+    std::vector<const unsigned char*> buffs;
+    /** Coordinate size per dimension. */
+    std::vector<uint64_t> coord_sizes;
+    /** Var data buffer per dimension. */
+    std::vector<const unsigned char*> buffs_var;
+    /** Var data buffer size per dimension. */
+    std::vector<uint64_t*> buffs_var_sizes;
+  };
+
+  /** Returns the dimension buffer pointers of the query. */
+  DimensionBuffers dimension_buffers() const;
+
+  /**
+   * Returns `true` if the cells at positions `a` and `b` have identical
+   * coordinates on all dimensions.
+   */
+  bool identical_coords(
+      const DimensionBuffers& dim_buffs, uint64_t a, uint64_t b) const;
+
   /**
    * Throws an error if there are coordinate duplicates.
    *
@@ -216,6 +248,37 @@ class UnorderedWriter : public WriterBase {
   Status prepare_tiles_var(
       const std::string& name, WriterTileTupleVector* tiles) const;
 
+  /**
+   * Computes, for every cell, a 64-bit key identifying the space tile the
+   * cell falls in, with keys ordered by the tile order of the array.
+   * Dimensions that do not participate in the tile order (var-sized or
+   * without a tile extent) do not contribute to the key, mirroring
+   * `Domain::tile_order_cmp`.
+   *
+   * @return The tile keys, one per cell, or `nullopt` when no dimension
+   *     participates in the tile order or the tile grid spanned by the
+   *     written cells does not fit in 64 bits.
+   */
+  std::optional<std::vector<uint64_t>> compute_tile_keys() const;
+
+  /**
+   * Sorts the cells in global order by partitioning them into their space
+   * tiles with a stable radix sort on the tile keys and sorting each tile
+   * bucket independently, in parallel, with the cell order comparator.
+   * This replaces the full O(n log n) comparison sort with a near-linear
+   * partition for data that is already clustered by space tile.
+   *
+   * When duplicates must be checked or deduplicated, the detection is fused
+   * into the per-bucket pass and `coord_dups_fused_` is set, so the
+   * separate detection passes are skipped.
+   *
+   * @param domain_buffs The coordinate query buffers, one per dimension.
+   * @return `true` if the cells were sorted, `false` when the tile keys
+   *     cannot be computed and the caller must fall back to a full global
+   *     comparison sort.
+   */
+  bool sort_coords_bucketed(const DomainBuffersView& domain_buffs);
+
   /**
    * Sorts the coordinates of the user buffers, creating a vector with
    * the sorted positions.
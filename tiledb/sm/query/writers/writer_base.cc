@@ -36,12 +36,16 @@
 #include "tiledb/sm/array/array.h"
 #include "tiledb/sm/array_schema/array_schema.h"
 #include "tiledb/sm/array_schema/dimension.h"
+#include "tiledb/sm/buffer/buffer_list.h"
+#include "tiledb/sm/compressors/zstd_compressor.h"
 #include "tiledb/sm/enums/compressor.h"
 #include "tiledb/sm/filesystem/vfs.h"
 #include "tiledb/sm/filter/compression_filter.h"
+#include "tiledb/sm/filter/filter_pipeline_advisor.h"
 #include "tiledb/sm/filter/webp_filter.h"
 #include "tiledb/sm/fragment/fragment_metadata.h"
 #include "tiledb/sm/misc/comparators.h"
+#include "tiledb/sm/misc/hash.h"
 #include "tiledb/sm/misc/hilbert.h"
 #include "tiledb/sm/misc/parallel_functions.h"
 #include "tiledb/sm/misc/tdb_math.h"
@@ -104,7 +108,8 @@ WriterBase::WriterBase(
     , check_global_order_(false)
     , dedup_coords_(false)
     , written_fragment_info_(written_fragment_info)
-    , remote_query_(remote_query) {
+    , remote_query_(remote_query)
+    , zstd_train_dictionaries_(false) {
   // Sanity checks
   if (storage_manager_ == nullptr) {
     throw WriterBaseStatusException(
@@ -183,6 +188,27 @@ WriterBase::WriterBase(
         "configuration");
   }
 
+  bool advisor_enabled = false;
+  if (!config_
+           .get<bool>(
+               "sm.filter_pipeline_advisor.enable", &advisor_enabled, &found)
+           .ok()) {
+    throw WriterBaseStatusException("Cannot get setting");
+  }
+  assert(found);
+  if (advisor_enabled) {
+    filter_pipeline_advisor_ = tdb_unique_ptr<FilterPipelineAdvisor>(
+        tdb_new(FilterPipelineAdvisor, array_schema_));
+  }
+
+  if (!config_
+           .get<bool>(
+               "sm.zstd_train_dictionaries", &zstd_train_dictionaries_, &found)
+           .ok()) {
+    throw WriterBaseStatusException("Cannot get setting");
+  }
+  assert(found);
+
   // Check subarray is valid for strategy is set or set it to default if unset.
   if (subarray_.is_set()) {
     if (!array_schema_.dense()) {
@@ -336,20 +362,24 @@ Status WriterBase::calculate_hilbert_values(
   auto bits = h.bits();
   auto max_bucket_val = ((uint64_t)1 << bits) - 1;
 
-  // Calculate Hilbert values in parallel
+  // Calculate Hilbert values in parallel, one batch of cells per task so
+  // that the conversion runs over contiguous scratch buffers.
   assert(hilbert_values.size() >= coords_info_.coords_num_);
+  constexpr uint64_t batch_size = 256;
+  auto batch_num = utils::math::ceil(coords_info_.coords_num_, batch_size);
   auto status = parallel_for(
-      storage_manager_->compute_tp(),
-      0,
-      coords_info_.coords_num_,
-      [&](uint64_t c) {
-        std::vector<uint64_t> coords(dim_num);
+      storage_manager_->compute_tp(), 0, batch_num, [&](uint64_t b) {
+        auto start = b * batch_size;
+        auto num = std::min(batch_size, coords_info_.coords_num_ - start);
+        std::vector<uint64_t> coords(num * dim_num);
         for (uint32_t d = 0; d < dim_num; ++d) {
           auto dim{array_schema_.dimension_ptr(d)};
-          coords[d] = hilbert_order::map_to_uint64(
-              *dim, domain_buffers[d], c, bits, max_bucket_val);
+          for (uint64_t c = 0; c < num; ++c) {
+            coords[c * dim_num + d] = hilbert_order::map_to_uint64(
+                *dim, domain_buffers[d], start + c, bits, max_bucket_val);
+          }
         }
-        hilbert_values[c] = h.coords_to_hilbert(&coords[0]);
+        h.coords_to_hilbert(&coords[0], &hilbert_values[start], num);
 
         return Status::Ok();
       });
@@ -815,13 +845,21 @@ Status WriterBase::create_fragment(
 
 Status WriterBase::filter_tiles(
     std::unordered_map<std::string, WriterTileTupleVector>* tiles) {
+  const uint64_t tile_num = tiles->empty() ? 0 : tiles->begin()->second.size();
+  return filter_tiles(tiles, 0, tile_num);
+}
+
+Status WriterBase::filter_tiles(
+    std::unordered_map<std::string, WriterTileTupleVector>* tiles,
+    uint64_t start_tile_idx,
+    uint64_t end_tile_idx) {
   auto timer_se = stats_->start_timer("filter_tiles");
   auto status = parallel_for(
       storage_manager_->compute_tp(), 0, tiles->size(), [&](uint64_t i) {
         auto tiles_it = tiles->begin();
         std::advance(tiles_it, i);
-        RETURN_CANCEL_OR_ERROR(
-            filter_tiles(tiles_it->first, &tiles_it->second));
+        RETURN_CANCEL_OR_ERROR(filter_tiles(
+            tiles_it->first, &tiles_it->second, start_tile_idx, end_tile_idx));
         return Status::Ok();
       });
 
@@ -831,16 +869,33 @@ Status WriterBase::filter_tiles(
 
 Status WriterBase::filter_tiles(
     const std::string& name, WriterTileTupleVector* tiles) {
+  return filter_tiles(name, tiles, 0, tiles->size());
+}
+
+Status WriterBase::filter_tiles(
+    const std::string& name,
+    WriterTileTupleVector* tiles,
+    uint64_t start_tile_idx,
+    uint64_t end_tile_idx) {
   const bool var_size = array_schema_.var_size(name);
   const bool nullable = array_schema_.is_nullable(name);
 
-  // Filter all tiles
-  auto tile_num = tiles->size();
+  // Train a shared zstd compression dictionary from the tiles, if enabled.
+  maybe_train_zstd_dictionary(name, tiles, start_tile_idx, end_tile_idx);
+
+  // Sample a tile for the filter pipeline advisor, if enabled.
+  if (filter_pipeline_advisor_ != nullptr && !var_size &&
+      start_tile_idx < end_tile_idx) {
+    filter_pipeline_advisor_->sample_tile(
+        name, (*tiles)[start_tile_idx].fixed_tile());
+  }
 
-  // Process all tiles, minus offsets, they get processed separately.
+  // Process all tiles in the range, minus offsets, they get processed
+  // separately.
   std::vector<std::tuple<WriterTile*, WriterTile*, bool, bool>> args;
-  args.reserve(tile_num * (1 + nullable));
-  for (auto& tile : *tiles) {
+  args.reserve((end_tile_idx - start_tile_idx) * (1 + nullable));
+  for (uint64_t t = start_tile_idx; t < end_tile_idx; t++) {
+    auto& tile = (*tiles)[t];
     if (var_size) {
       args.emplace_back(&tile.var_tile(), &tile.offset_tile(), false, false);
     } else {
@@ -852,9 +907,51 @@ Status WriterBase::filter_tiles(
     }
   }
 
-  // For fixed size, process everything, for var size, everything minus offsets.
+  // Detect tiles with identical content so the filter pipeline only runs
+  // once per distinct tile. This is common for sparse data with long runs of
+  // identical tiles (e.g. all-zero coverage) and for validity tiles. Var
+  // size data tiles are excluded as filtering them can also consume and
+  // rewrite their offsets tile. Hashes are only used to find candidates, the
+  // tile contents are compared to confirm a duplicate.
+  std::vector<uint64_t> duplicate_of(args.size());
+  std::unordered_map<
+      std::pair<size_t, bool>,
+      std::vector<uint64_t>,
+      utils::hash::pair_hash>
+      representatives;
+  for (uint64_t i = 0; i < args.size(); i++) {
+    duplicate_of[i] = i;
+    const auto& [tile, offset_tile, contains_offsets, is_nullable] = args[i];
+    (void)contains_offsets;
+    if (offset_tile != nullptr) {
+      continue;
+    }
+
+    const std::string_view data(tile->data_as<char>(), tile->size());
+    auto& reps = representatives[std::pair<size_t, bool>(
+        std::hash<std::string_view>()(data), is_nullable)];
+    for (auto r : reps) {
+      auto rep_tile = std::get<0>(args[r]);
+      if (rep_tile->size() == tile->size() &&
+          std::memcmp(rep_tile->data(), tile->data(), tile->size()) == 0) {
+        duplicate_of[i] = r;
+        break;
+      }
+    }
+
+    if (duplicate_of[i] == i) {
+      reps.emplace_back(i);
+    }
+  }
+
+  // For fixed size, process everything, for var size, everything minus
+  // offsets. Duplicates are skipped and reuse the filtered buffer of their
+  // representative tile below.
   auto status = parallel_for(
       storage_manager_->compute_tp(), 0, args.size(), [&](uint64_t i) {
+        if (duplicate_of[i] != i) {
+          return Status::Ok();
+        }
         const auto& [tile, offset_tile, contains_offsets, is_nullable] =
             args[i];
         RETURN_NOT_OK(filter_tile(
@@ -863,10 +960,33 @@ Status WriterBase::filter_tiles(
       });
   RETURN_NOT_OK(status);
 
+  // Copy the filtered buffer of the representative tile to its duplicates.
+  uint64_t dedup_tile_num = 0;
+  for (uint64_t i = 0; i < args.size(); i++) {
+    if (duplicate_of[i] == i) {
+      continue;
+    }
+
+    auto tile = std::get<0>(args[i]);
+    auto& filtered = std::get<0>(args[duplicate_of[i]])->filtered_buffer();
+    tile->filtered_buffer().expand(filtered.size());
+    std::memcpy(
+        tile->filtered_buffer().data(), filtered.data(), filtered.size());
+    tile->clear_data();
+    dedup_tile_num++;
+  }
+
+  if (dedup_tile_num != 0) {
+    stats_->add_counter("dedup_tile_num", dedup_tile_num);
+  }
+
   // Process offsets for var size.
   if (var_size) {
     auto status = parallel_for(
-        storage_manager_->compute_tp(), 0, tiles->size(), [&](uint64_t i) {
+        storage_manager_->compute_tp(),
+        start_tile_idx,
+        end_tile_idx,
+        [&](uint64_t i) {
           auto& tile = (*tiles)[i];
           RETURN_NOT_OK(
               filter_tile(name, &tile.offset_tile(), nullptr, true, false));
@@ -895,6 +1015,15 @@ Status WriterBase::filter_tile(
     filters = array_schema_.cell_validity_filters();
   } else {
     filters = array_schema_.filters(name);
+
+    // Compress the data tile with the fragment's trained zstd dictionary,
+    // if there is one.
+    if (zstd_train_dictionaries_) {
+      auto dictionary = zstd_dictionary(name);
+      if (dictionary != nullptr) {
+        filters.set_zstd_dictionary(dictionary);
+      }
+    }
   }
 
   // If those offsets belong to a var-sized string dimension/attribute then
@@ -929,6 +1058,122 @@ Status WriterBase::filter_tile(
   return Status::Ok();
 }
 
+void WriterBase::maybe_train_zstd_dictionary(
+    const std::string& name,
+    WriterTileTupleVector* tiles,
+    uint64_t start_tile_idx,
+    uint64_t end_tile_idx) {
+  if (!zstd_train_dictionaries_ || start_tile_idx >= end_tile_idx) {
+    return;
+  }
+
+  // Only fields compressed with zstd can use a dictionary.
+  const auto& filters = array_schema_.filters(name);
+  auto compressor = filters.get_filter<CompressionFilter>();
+  if (compressor == nullptr || compressor->compressor() != Compressor::ZSTD) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(zstd_dictionaries_mtx_);
+    if (zstd_dictionaries_.count(name) != 0) {
+      return;
+    }
+  }
+
+  auto timer_se = stats_->start_timer("train_zstd_dictionary");
+
+  // Gather samples from the data tiles at filter chunk granularity, which
+  // is the unit the dictionary is applied to. The sample volume is capped,
+  // training sees diminishing returns past roughly 100x the dictionary
+  // size.
+  const bool var_size = array_schema_.var_size(name);
+  const uint64_t chunk_size = constants::max_tile_chunk_size;
+  const uint64_t max_sample_bytes = 100 * ZStd::dictionary_max_size;
+  std::vector<uint8_t> samples;
+  std::vector<size_t> sample_sizes;
+  for (uint64_t t = start_tile_idx;
+       t < end_tile_idx && samples.size() < max_sample_bytes;
+       t++) {
+    auto& tile =
+        var_size ? (*tiles)[t].var_tile() : (*tiles)[t].fixed_tile();
+    auto data = tile.data_as<uint8_t>();
+    for (uint64_t offset = 0;
+         offset < tile.size() && samples.size() < max_sample_bytes;
+         offset += chunk_size) {
+      auto size = std::min(chunk_size, tile.size() - offset);
+      samples.insert(samples.end(), data + offset, data + offset + size);
+      sample_sizes.emplace_back(size);
+    }
+  }
+
+  // Training needs multiple samples to find shared content.
+  std::vector<uint8_t> dictionary;
+  if (sample_sizes.size() > 1) {
+    dictionary = ZStd::train_dictionary(samples, sample_sizes);
+  }
+
+  if (!dictionary.empty()) {
+    stats_->add_counter("zstd_dictionaries_trained", 1);
+  }
+
+  // An empty dictionary records that training failed so it is not retried.
+  std::lock_guard<std::mutex> lock(zstd_dictionaries_mtx_);
+  zstd_dictionaries_.emplace(name, std::move(dictionary));
+}
+
+const std::vector<uint8_t>* WriterBase::zstd_dictionary(
+    const std::string& name) {
+  std::lock_guard<std::mutex> lock(zstd_dictionaries_mtx_);
+  auto it = zstd_dictionaries_.find(name);
+  if (it == zstd_dictionaries_.end() || it->second.empty()) {
+    return nullptr;
+  }
+
+  return &it->second;
+}
+
+void WriterBase::transfer_zstd_dictionaries(shared_ptr<FragmentMetadata> meta) {
+  std::lock_guard<std::mutex> lock(zstd_dictionaries_mtx_);
+  for (auto& [name, dictionary] : zstd_dictionaries_) {
+    if (!dictionary.empty()) {
+      // Copy the dictionary, it stays usable in case the writer creates
+      // more fragments.
+      meta->set_zstd_dictionary(name, dictionary);
+    }
+  }
+}
+
+void WriterBase::record_filter_pipeline_recommendations() {
+  if (filter_pipeline_advisor_ == nullptr ||
+      !filter_pipeline_advisor_->has_samples()) {
+    return;
+  }
+
+  auto timer_se = stats_->start_timer("filter_pipeline_advisor");
+
+  // The recommendations are advisory only, never fail the write over them.
+  try {
+    auto recommendations = filter_pipeline_advisor_->compute_recommendations(
+        stats_, storage_manager_->compute_tp());
+    for (const auto& [name, description] : recommendations) {
+      const std::string key =
+          FilterPipelineAdvisor::metadata_key_prefix + name;
+      // Writers are always constructed with a mutable array opened for
+      // writes, which is what putting metadata requires.
+      const_cast<Array*>(array_)->put_metadata(
+          key.c_str(),
+          Datatype::STRING_ASCII,
+          static_cast<uint32_t>(description.size()),
+          description.data());
+    }
+  } catch (const std::exception& e) {
+    logger_->warn(
+        "Failed to record filter pipeline recommendations: " +
+        std::string(e.what()));
+  }
+}
+
 bool WriterBase::has_min_max_metadata(
     const std::string& name, const bool var_size) {
   const auto type = array_schema_.type(name);
@@ -945,6 +1190,15 @@ bool WriterBase::has_sum_metadata(
   return TileMetadataGenerator::has_sum_metadata(type, var_size, cell_val_num);
 }
 
+bool WriterBase::has_bloom_filter_metadata(
+    const std::string& name, const bool var_size) {
+  const auto type = array_schema_.type(name);
+  const auto is_dim = array_schema_.is_dim(name);
+  const auto cell_val_num = array_schema_.cell_val_num(name);
+  return TileMetadataGenerator::has_bloom_filter_metadata(
+      type, is_dim, var_size, cell_val_num);
+}
+
 Status WriterBase::init_tiles(
     const std::string& name,
     uint64_t tile_num,
@@ -958,11 +1212,14 @@ Status WriterBase::init_tiles(
   const auto capacity = array_schema_.capacity();
   const auto cell_num_per_tile =
       coords_info_.has_coords_ ? capacity : domain.cell_num_per_tile();
-  tiles->reserve(tile_num);
-  for (uint64_t i = 0; i < tile_num; i++) {
-    tiles->emplace_back(WriterTileTuple(
-        array_schema_, cell_num_per_tile, var_size, nullable, cell_size, type));
-  }
+  tiles->init_tiles(
+      array_schema_,
+      tile_num,
+      cell_num_per_tile,
+      var_size,
+      nullable,
+      cell_size,
+      type);
 
   return Status::Ok();
 }
@@ -1115,30 +1372,33 @@ Status WriterBase::write_tiles(
   // Compute and set var buffer sizes for the min/max metadata
   const auto has_min_max_md = has_min_max_metadata(name, var_size);
   const auto has_sum_md = has_sum_metadata(name, var_size);
+  const auto has_bloom_filter_md =
+      frag_meta->format_version() >= constants::tile_bloom_filter_min_version &&
+      has_bloom_filter_metadata(name, var_size);
 
   bool remote_global_order_write =
       (layout_ == Layout::GLOBAL_ORDER && remote_query());
 
-  // Write tiles
+  // Gather the filtered tiles of each file into buffer lists of non-owning
+  // buffers, so that all tiles of the range are written to a file with a
+  // single scatter-gather VFS write below.
+  BufferList tile_data;
+  BufferList tile_var_data;
+  BufferList tile_validity_data;
+
   for (size_t i = start_tile_idx, tile_id = start_tile_id; i < end_tile_idx;
        ++i, ++tile_id) {
     auto& tile = (*tiles)[i];
     auto& t = var_size ? tile.offset_tile() : tile.fixed_tile();
-    RETURN_NOT_OK(storage_manager_->vfs()->write(
-        uri,
-        t.filtered_buffer().data(),
-        t.filtered_buffer().size(),
-        remote_global_order_write));
+    RETURN_NOT_OK(tile_data.add_buffer(
+        Buffer(t.filtered_buffer().data(), t.filtered_buffer().size())));
     frag_meta->set_tile_offset(name, tile_id, t.filtered_buffer().size());
     auto null_count = tile.null_count();
 
     if (var_size) {
       auto& t_var = tile.var_tile();
-      RETURN_NOT_OK(storage_manager_->vfs()->write(
-          var_uri,
-          t_var.filtered_buffer().data(),
-          t_var.filtered_buffer().size(),
-          remote_global_order_write));
+      RETURN_NOT_OK(tile_var_data.add_buffer(Buffer(
+          t_var.filtered_buffer().data(), t_var.filtered_buffer().size())));
       frag_meta->set_tile_var_offset(
           name, tile_id, t_var.filtered_buffer().size());
       frag_meta->set_tile_var_size(name, tile_id, tile.var_pre_filtered_size());
@@ -1157,19 +1417,32 @@ Status WriterBase::write_tiles(
       }
     }
 
+    if (has_bloom_filter_md) {
+      frag_meta->set_tile_bloom_filter(name, tile_id, tile.bloom_filter());
+    }
+
     if (nullable) {
       auto& t_val = tile.validity_tile();
-      RETURN_NOT_OK(storage_manager_->vfs()->write(
-          validity_uri,
-          t_val.filtered_buffer().data(),
-          t_val.filtered_buffer().size(),
-          remote_global_order_write));
+      RETURN_NOT_OK(tile_validity_data.add_buffer(Buffer(
+          t_val.filtered_buffer().data(), t_val.filtered_buffer().size())));
       frag_meta->set_tile_validity_offset(
           name, tile_id, t_val.filtered_buffer().size());
       frag_meta->set_tile_null_count(name, tile_id, null_count);
     }
   }
 
+  // Write tiles
+  RETURN_NOT_OK(storage_manager_->vfs()->write(
+      uri, tile_data, remote_global_order_write));
+  if (var_size) {
+    RETURN_NOT_OK(storage_manager_->vfs()->write(
+        var_uri, tile_var_data, remote_global_order_write));
+  }
+  if (nullable) {
+    RETURN_NOT_OK(storage_manager_->vfs()->write(
+        validity_uri, tile_validity_data, remote_global_order_write));
+  }
+
   // Close files or flush multipart upload buffers in case of global order
   // writes
   if (close_files) {
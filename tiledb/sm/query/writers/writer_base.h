@@ -34,6 +34,7 @@
 #define TILEDB_WRITER_BASE_H
 
 #include <atomic>
+#include <mutex>
 
 #include "tiledb/common/common.h"
 #include "tiledb/common/status.h"
@@ -54,11 +55,10 @@ namespace sm {
 
 class Array;
 class DomainBuffersView;
+class FilterPipelineAdvisor;
 class FragmentMetadata;
 class TileMetadataGenerator;
 
-using WriterTileTupleVector = std::vector<WriterTileTuple>;
-
 /** Processes write queries. */
 class WriterBase : public StrategyBase, public IQueryStrategy {
  public:
@@ -195,6 +195,26 @@ class WriterBase : public StrategyBase, public IQueryStrategy {
   /** Used in serialization to track if the writer belongs to a remote query */
   bool remote_query_;
 
+  /**
+   * Samples written tiles and recommends better filter pipelines. Only
+   * allocated when `sm.filter_pipeline_advisor.enable` is set.
+   */
+  tdb_unique_ptr<FilterPipelineAdvisor> filter_pipeline_advisor_;
+
+  /** If `true`, train zstd dictionaries for the written fragments. */
+  bool zstd_train_dictionaries_;
+
+  /**
+   * The zstd dictionary trained for each zstd-compressed field, keyed by
+   * field name. An empty dictionary marks a field whose training failed so
+   * that it is not retried. The map is node based, so the dictionaries stay
+   * pointer stable for the filter pipeline copies referencing them.
+   */
+  std::unordered_map<std::string, std::vector<uint8_t>> zstd_dictionaries_;
+
+  /** Mutex protecting `zstd_dictionaries_`. */
+  std::mutex zstd_dictionaries_mtx_;
+
   /* ********************************* */
   /*         PROTECTED METHODS         */
   /* ********************************* */
@@ -309,6 +329,21 @@ class WriterBase : public StrategyBase, public IQueryStrategy {
   Status filter_tiles(
       std::unordered_map<std::string, WriterTileTupleVector>* tiles);
 
+  /**
+   * Runs the coordinate and attribute tiles within the input tile range
+   * through their filter pipelines. The tile buffers are modified to contain
+   * the output of the pipeline.
+   *
+   * @param tiles The tiles to be filtered.
+   * @param start_tile_idx The first tile to filter.
+   * @param end_tile_idx The last tile to filter (exclusive).
+   * @return Status
+   */
+  Status filter_tiles(
+      std::unordered_map<std::string, WriterTileTupleVector>* tiles,
+      uint64_t start_tile_idx,
+      uint64_t end_tile_idx);
+
   /**
    * Runs the input tiles for the input attribute through the filter pipeline.
    * The tile buffers are modified to contain the output of the pipeline.
@@ -319,6 +354,65 @@ class WriterBase : public StrategyBase, public IQueryStrategy {
    */
   Status filter_tiles(const std::string& name, WriterTileTupleVector* tiles);
 
+  /**
+   * Runs the input tiles within the input tile range for the input attribute
+   * through the filter pipeline. The tile buffers are modified to contain the
+   * output of the pipeline.
+   *
+   * @param name The attribute/dimension the tiles belong to.
+   * @param tile The tiles to be filtered.
+   * @param start_tile_idx The first tile to filter.
+   * @param end_tile_idx The last tile to filter (exclusive).
+   * @return Status
+   */
+  Status filter_tiles(
+      const std::string& name,
+      WriterTileTupleVector* tiles,
+      uint64_t start_tile_idx,
+      uint64_t end_tile_idx);
+
+  /**
+   * Trains a zstd dictionary for the input field from the data tiles in the
+   * input tile range. A no-op unless `sm.zstd_train_dictionaries` is set,
+   * the field is compressed with zstd and no training was attempted for it
+   * yet. The tiles are sampled at filter chunk granularity, which is the
+   * unit the dictionary is later applied to. If training fails (e.g. the
+   * samples share too little content), the field is marked so training is
+   * not retried and its tiles are compressed without a dictionary.
+   *
+   * @param name The attribute/dimension to train a dictionary for.
+   * @param tiles The tiles to sample.
+   * @param start_tile_idx The first tile to sample.
+   * @param end_tile_idx The last tile to sample (exclusive).
+   */
+  void maybe_train_zstd_dictionary(
+      const std::string& name,
+      WriterTileTupleVector* tiles,
+      uint64_t start_tile_idx,
+      uint64_t end_tile_idx);
+
+  /**
+   * Returns the zstd dictionary trained for the input field, or `nullptr`
+   * if there is none. The returned dictionary outlives the filter pipeline
+   * copies that reference it.
+   */
+  const std::vector<uint8_t>* zstd_dictionary(const std::string& name);
+
+  /**
+   * Copies the trained zstd dictionaries into the input fragment metadata
+   * so they are stored with the fragment. Must be called before the
+   * metadata is stored.
+   */
+  void transfer_zstd_dictionaries(shared_ptr<FragmentMetadata> meta);
+
+  /**
+   * Trials the candidate filter pipelines of the filter pipeline advisor on
+   * the tiles sampled during the write and records the recommendations in
+   * the array metadata. A no-op when the advisor is disabled or nothing was
+   * sampled, and failures are logged rather than failing the write.
+   */
+  void record_filter_pipeline_recommendations();
+
   /**
    * Runs the input tile for the input attribute/dimension through the filter
    * pipeline. The tile buffer is modified to contain the output of the
@@ -357,6 +451,15 @@ class WriterBase : public StrategyBase, public IQueryStrategy {
    */
   bool has_sum_metadata(const std::string& name, const bool var_size);
 
+  /**
+   * Determines if an attribute has bloom filter metadata.
+   *
+   * @param name Attribute/dimension name.
+   * @param var_size Is the attribute/dimension var size.
+   * @return true if the atribute has bloom filter metadata.
+   */
+  bool has_bloom_filter_metadata(const std::string& name, const bool var_size);
+
   /**
    * Initializes the tiles for writing for the input attribute/dimension.
    *
@@ -32,11 +32,18 @@
 
 #include "tiledb/sm/query_plan/query_plan.h"
 
+#include <set>
+
 #include "tiledb/sm/array/array.h"
 #include "tiledb/sm/enums/array_type.h"
 #include "tiledb/sm/enums/layout.h"
+#include "tiledb/sm/enums/query_type.h"
 #include "tiledb/sm/filesystem/uri.h"
+#include "tiledb/sm/fragment/fragment_metadata.h"
 #include "tiledb/sm/query/query.h"
+#include "tiledb/sm/storage_manager/storage_manager.h"
+#include "tiledb/sm/subarray/subarray.h"
+#include "tiledb/sm/tile/tile_metadata_generator.h"
 
 #include "external/include/nlohmann/json.hpp"
 
@@ -78,6 +85,10 @@ QueryPlan::QueryPlan(Query& query) {
 
   std::sort(attributes_.begin(), attributes_.end());
   std::sort(dimensions_.begin(), dimensions_.end());
+
+  if (query.type() == QueryType::READ) {
+    compute_explain_info(query);
+  }
 }
 
 /* ********************************* */
@@ -94,8 +105,129 @@ std::string QueryPlan::dump_json(uint32_t indent) {
         {"Query.Attributes", attributes_},
         {"Query.Dimensions", dimensions_}}}};
 
+  if (has_explain_) {
+    auto& plan = rv["TileDB Query Plan"];
+    plan["Query.Fragments.Selected"] = fragment_num_;
+    plan["Query.Fragments.OverlappingTiles"] = fragment_tile_counts_;
+    plan["Query.EstimatedBytesToRead"] = est_bytes_to_read_;
+    plan["Query.EstimatedUnfilteredMemory"] = est_unfiltered_memory_;
+    if (!condition_pushdown_.empty()) {
+      plan["Query.Condition.Pushdown"] = condition_pushdown_;
+    }
+  }
+
   return rv.dump(indent);
 }
 
+/* ********************************* */
+/*          PRIVATE METHODS          */
+/* ********************************* */
+
+void QueryPlan::compute_explain_info(Query& query) {
+  auto array = query.array();
+  const auto& array_schema = array->array_schema_latest();
+  const auto& fragment_metadata = array->fragment_metadata();
+
+  // Work on a copy so the query's subarray keeps its lazily computed state.
+  Subarray subarray = *query.subarray();
+  throw_if_not_ok(subarray.precompute_tile_overlap(
+      0,
+      subarray.range_num() - 1,
+      &query.config(),
+      query.storage_manager()->compute_tp(),
+      true));
+
+  const auto* overlap = subarray.subarray_tile_overlap();
+  const auto& relevant = subarray.relevant_fragments();
+  for (size_t i = 0; i < relevant.size(); i++) {
+    auto f = relevant[i];
+    auto& fragment = fragment_metadata[f];
+
+    // Collect the overlapping tile indexes of this fragment.
+    std::set<uint64_t> tile_idxs;
+    for (uint64_t r = 0; r < overlap->range_num(); r++) {
+      const auto* tile_overlap = subarray.tile_overlap(f, r);
+      if (tile_overlap == nullptr) {
+        continue;
+      }
+
+      for (const auto& t : tile_overlap->tiles_) {
+        tile_idxs.insert(t.first);
+      }
+      for (const auto& tr : tile_overlap->tile_ranges_) {
+        for (uint64_t t = tr.first; t <= tr.second; t++) {
+          tile_idxs.insert(t);
+        }
+      }
+    }
+    if (tile_idxs.empty()) {
+      continue;
+    }
+
+    fragment_num_++;
+    fragment_tile_counts_[fragment->fragment_uri().last_path_part()] =
+        tile_idxs.size();
+
+    // Queried fields present in this fragment. Dense fragments store no
+    // dimension tiles.
+    const auto& schema = fragment->array_schema();
+    std::vector<std::string> names;
+    names.reserve(attributes_.size() + dimensions_.size());
+    for (const auto& name : attributes_) {
+      if (schema->is_field(name)) {
+        names.emplace_back(name);
+      }
+    }
+    if (!fragment->dense()) {
+      for (const auto& name : dimensions_) {
+        if (schema->is_field(name)) {
+          names.emplace_back(name);
+        }
+      }
+    }
+
+    // Tile offsets and var sizes are fragment metadata, not tile data.
+    fragment->load_tile_offsets(*array->encryption_key(), names);
+    for (const auto& name : names) {
+      const bool var_size = schema->var_size(name);
+      const bool nullable = schema->is_nullable(name);
+      if (var_size) {
+        fragment->load_tile_var_sizes(*array->encryption_key(), name);
+      }
+
+      for (auto t : tile_idxs) {
+        est_bytes_to_read_ += fragment->persisted_tile_size(name, t);
+        est_unfiltered_memory_ += fragment->tile_size(name, t);
+        if (var_size) {
+          est_bytes_to_read_ += fragment->persisted_tile_var_size(name, t);
+          est_unfiltered_memory_ += fragment->tile_var_size(name, t);
+        }
+        if (nullable) {
+          est_bytes_to_read_ += fragment->persisted_tile_validity_size(name, t);
+          est_unfiltered_memory_ += fragment->cell_num(t);
+        }
+      }
+    }
+  }
+
+  // A condition can only be pruned with before any tile I/O when the
+  // fragments keep min/max metadata for the field.
+  if (query.condition().has_value()) {
+    for (const auto& name : query.condition()->field_names()) {
+      bool pushdown = false;
+      if (array_schema.is_field(name)) {
+        pushdown = TileMetadataGenerator::has_min_max_metadata(
+            array_schema.type(name),
+            array_schema.is_dim(name),
+            array_schema.var_size(name),
+            array_schema.cell_val_num(name));
+      }
+      condition_pushdown_[name] = pushdown;
+    }
+  }
+
+  has_explain_ = true;
+}
+
 }  // namespace sm
 }  // namespace tiledb
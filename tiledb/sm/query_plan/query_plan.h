@@ -33,6 +33,7 @@
 #ifndef TILEDB_QUERY_PLAN_H
 #define TILEDB_QUERY_PLAN_H
 
+#include <map>
 #include <string>
 #include <vector>
 #include "tiledb/common/common.h"
@@ -106,6 +107,41 @@ class QueryPlan {
 
   /** A list of queried dimensions */
   std::vector<std::string> dimensions_;
+
+  /** Whether the quantitative explain info below was computed */
+  bool has_explain_ = false;
+
+  /** The number of fragments selected by the subarray */
+  uint64_t fragment_num_ = 0;
+
+  /** The number of overlapping tiles per selected fragment */
+  std::map<std::string, uint64_t> fragment_tile_counts_;
+
+  /** Estimated persisted bytes the query will read */
+  uint64_t est_bytes_to_read_ = 0;
+
+  /** Estimated memory the unfiltered tiles will occupy */
+  uint64_t est_unfiltered_memory_ = 0;
+
+  /**
+   * Per condition field, whether tile metadata is available to prune
+   * tiles with before any tile I/O
+   */
+  std::map<std::string, bool> condition_pushdown_;
+
+  /* ****************************** */
+  /*        PRIVATE METHODS         */
+  /* ****************************** */
+
+  /**
+   * Computes the quantitative explain info for a read query: fragments
+   * selected, tiles overlapped per fragment, estimated bytes to read,
+   * estimated unfiltered memory and condition pushdown decisions. Only
+   * fragment metadata is consulted, no tile data is read.
+   *
+   * @param query The query the plan is computed for
+   */
+  void compute_explain_info(Query& query);
 };
 
 }  // namespace sm
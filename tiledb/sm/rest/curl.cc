@@ -264,7 +264,8 @@ Status Curl::init(
     const Config* config,
     const std::unordered_map<std::string, std::string>& extra_headers,
     std::unordered_map<std::string, std::string>* const res_headers,
-    std::mutex* const res_mtx) {
+    std::mutex* const res_mtx,
+    CURLSH* const share) {
   if (config == nullptr)
     return LOG_STATUS(
         Status_RestError("Error initializing libcurl; config is null."));
@@ -281,6 +282,25 @@ Status Curl::init(
     return LOG_STATUS(Status_RestError(
         "Error initializing libcurl; failed to set CURLOPT_NOSIGNAL"));
 
+  if (share != nullptr) {
+    // Attach the client-wide share so this handle reuses the pooled
+    // connections, TLS sessions and DNS entries instead of paying a
+    // fresh connect and handshake per request.
+    rc = curl_easy_setopt(curl_.get(), CURLOPT_SHARE, share);
+    if (rc != CURLE_OK)
+      return LOG_STATUS(Status_RestError(
+          "Error initializing libcurl; failed to set CURLOPT_SHARE"));
+
+    // Negotiate HTTP/2 over TLS and prefer waiting for a multiplexed
+    // stream on a pooled connection over opening a new connection.
+    curl_easy_setopt(
+        curl_.get(), CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+    curl_easy_setopt(curl_.get(), CURLOPT_PIPEWAIT, 1L);
+  }
+
+  // Keep pooled connections alive across the idle gaps between requests.
+  curl_easy_setopt(curl_.get(), CURLOPT_TCP_KEEPALIVE, 1L);
+
   // For human-readable error messages
   RETURN_NOT_OK(curl_error_buffer_.realloc(CURL_ERROR_SIZE));
   std::memset(curl_error_buffer_.data(), 0, CURL_ERROR_SIZE);
@@ -118,13 +118,19 @@ class Curl {
    * @param res_ns_uri Pointer to Array namespace : Array URI cache key
    * @param res_headers Pointer to cache map
    * @param res_mtx Pointer to mtx that handles the lock of the cache map
+   * @param share Optional client-wide share handle. When non-null, the
+   *     easy handle attaches to it so connections, TLS sessions and DNS
+   *     entries are pooled across requests, and concurrent requests are
+   *     multiplexed over the pooled connections when the server speaks
+   *     HTTP/2.
    * @return Status
    */
   Status init(
       const Config* config,
       const std::unordered_map<std::string, std::string>& extra_headers,
       std::unordered_map<std::string, std::string>* res_headers,
-      std::mutex* res_mtx);
+      std::mutex* res_mtx,
+      CURLSH* share = nullptr);
 
   /**
    * Escapes the given URL.
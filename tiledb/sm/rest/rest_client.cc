@@ -143,7 +143,12 @@ tuple<Status, std::optional<bool>> RestClient::check_array_exists_from_rest(
   RETURN_NOT_OK_TUPLE(uri.get_rest_components(&array_ns, &array_uri), nullopt);
   const std::string cache_key = array_ns + ":" + array_uri;
   RETURN_NOT_OK_TUPLE(
-      curlc.init(config_, extra_headers_, &redirect_meta_, &redirect_mtx_),
+      curlc.init(
+          config_,
+          extra_headers_,
+          &redirect_meta_,
+          &redirect_mtx_,
+          curl_share_.share()),
       nullopt);
   const std::string url = redirect_uri(cache_key) + "/v1/arrays/" + array_ns +
                           "/" + curlc.url_escape(array_uri);
@@ -180,7 +185,12 @@ tuple<Status, std::optional<bool>> RestClient::check_group_exists_from_rest(
   RETURN_NOT_OK_TUPLE(uri.get_rest_components(&group_ns, &group_uri), nullopt);
   const std::string cache_key = group_ns + ":" + group_uri;
   RETURN_NOT_OK_TUPLE(
-      curlc.init(config_, extra_headers_, &redirect_meta_, &redirect_mtx_),
+      curlc.init(
+          config_,
+          extra_headers_,
+          &redirect_meta_,
+          &redirect_mtx_,
+          curl_share_.share()),
       nullopt);
   const std::string url = redirect_uri(cache_key) + "/v2/groups/" + group_ns +
                           "/" + curlc.url_escape(group_uri);
@@ -217,7 +227,12 @@ RestClient::get_array_schema_from_rest(const URI& uri) {
   RETURN_NOT_OK_TUPLE(uri.get_rest_components(&array_ns, &array_uri), nullopt);
   const std::string cache_key = array_ns + ":" + array_uri;
   RETURN_NOT_OK_TUPLE(
-      curlc.init(config_, extra_headers_, &redirect_meta_, &redirect_mtx_),
+      curlc.init(
+          config_,
+          extra_headers_,
+          &redirect_meta_,
+          &redirect_mtx_,
+          curl_share_.share()),
       nullopt);
   const std::string url = redirect_uri(cache_key) + "/v1/arrays/" + array_ns +
                           "/" + curlc.url_escape(array_uri);
@@ -267,7 +282,12 @@ shared_ptr<ArraySchema> RestClient::post_array_schema_from_rest(
   throw_if_not_ok(uri.get_rest_components(&array_ns, &array_uri));
   const std::string cache_key = array_ns + ":" + array_uri;
   throw_if_not_ok(
-      curlc.init(config_, extra_headers_, &redirect_meta_, &redirect_mtx_));
+      curlc.init(
+          config_,
+          extra_headers_,
+          &redirect_meta_,
+          &redirect_mtx_,
+          curl_share_.share()));
   const std::string url = redirect_uri(cache_key) + "/v1/arrays/" + array_ns +
                           "/" + curlc.url_escape(array_uri) + "/schema?" +
                           "start_timestamp=" + std::to_string(timestamp_start) +
@@ -318,7 +338,12 @@ Status RestClient::post_array_schema_to_rest(
   RETURN_NOT_OK(uri.get_rest_components(&array_ns, &array_uri));
   const std::string cache_key = array_ns + ":" + array_uri;
   RETURN_NOT_OK(
-      curlc.init(config_, extra_headers_, &redirect_meta_, &redirect_mtx_));
+      curlc.init(
+          config_,
+          extra_headers_,
+          &redirect_meta_,
+          &redirect_mtx_,
+          curl_share_.share()));
   auto deduced_url = redirect_uri(cache_key) + "/v1/arrays/" + array_ns + "/" +
                      curlc.url_escape(array_uri);
   Buffer returned_data;
@@ -352,7 +377,12 @@ Status RestClient::post_array_from_rest(
   RETURN_NOT_OK(uri.get_rest_components(&array_ns, &array_uri));
   const std::string cache_key = array_ns + ":" + array_uri;
   RETURN_NOT_OK(
-      curlc.init(config_, extra_headers_, &redirect_meta_, &redirect_mtx_));
+      curlc.init(
+          config_,
+          extra_headers_,
+          &redirect_meta_,
+          &redirect_mtx_,
+          curl_share_.share()));
   std::string url = redirect_uri(cache_key) + "/v2/arrays/" + array_ns + "/" +
                     curlc.url_escape(array_uri) + "/?";
 
@@ -386,7 +416,12 @@ void RestClient::delete_array_from_rest(const URI& uri) {
   throw_if_not_ok(uri.get_rest_components(&array_ns, &array_uri));
   const std::string cache_key = array_ns + ":" + array_uri;
   throw_if_not_ok(
-      curlc.init(config_, extra_headers_, &redirect_meta_, &redirect_mtx_));
+      curlc.init(
+          config_,
+          extra_headers_,
+          &redirect_meta_,
+          &redirect_mtx_,
+          curl_share_.share()));
   const std::string url = redirect_uri(cache_key) + "/v1/arrays/" + array_ns +
                           "/" + curlc.url_escape(array_uri);
 
@@ -417,7 +452,12 @@ void RestClient::post_delete_fragments_to_rest(
   throw_if_not_ok(uri.get_rest_components(&array_ns, &array_uri));
   const std::string cache_key = array_ns + ":" + array_uri;
   throw_if_not_ok(
-      curlc.init(config_, extra_headers_, &redirect_meta_, &redirect_mtx_));
+      curlc.init(
+          config_,
+          extra_headers_,
+          &redirect_meta_,
+          &redirect_mtx_,
+          curl_share_.share()));
   const std::string url = redirect_uri(cache_key) + "/v1/arrays/" + array_ns +
                           "/" + curlc.url_escape(array_uri) +
                           "/delete_fragments";
@@ -447,7 +487,12 @@ void RestClient::post_delete_fragments_list_to_rest(
   throw_if_not_ok(uri.get_rest_components(&array_ns, &array_uri));
   const std::string cache_key = array_ns + ":" + array_uri;
   throw_if_not_ok(
-      curlc.init(config_, extra_headers_, &redirect_meta_, &redirect_mtx_));
+      curlc.init(
+          config_,
+          extra_headers_,
+          &redirect_meta_,
+          &redirect_mtx_,
+          curl_share_.share()));
   const std::string url = redirect_uri(cache_key) + "/v1/arrays/" + array_ns +
                           "/" + curlc.url_escape(array_uri) +
                           "/delete_fragments_list";
@@ -470,7 +515,12 @@ Status RestClient::deregister_array_from_rest(const URI& uri) {
   RETURN_NOT_OK(uri.get_rest_components(&array_ns, &array_uri));
   const std::string cache_key = array_ns + ":" + array_uri;
   RETURN_NOT_OK(
-      curlc.init(config_, extra_headers_, &redirect_meta_, &redirect_mtx_));
+      curlc.init(
+          config_,
+          extra_headers_,
+          &redirect_meta_,
+          &redirect_mtx_,
+          curl_share_.share()));
   const std::string url = redirect_uri(cache_key) + "/v1/arrays/" + array_ns +
                           "/" + curlc.url_escape(array_uri) + "/deregister";
 
@@ -494,7 +544,12 @@ Status RestClient::get_array_non_empty_domain(
   RETURN_NOT_OK(array->array_uri().get_rest_components(&array_ns, &array_uri));
   const std::string cache_key = array_ns + ":" + array_uri;
   RETURN_NOT_OK(
-      curlc.init(config_, extra_headers_, &redirect_meta_, &redirect_mtx_));
+      curlc.init(
+          config_,
+          extra_headers_,
+          &redirect_meta_,
+          &redirect_mtx_,
+          curl_share_.share()));
   const std::string url = redirect_uri(cache_key) + "/v2/arrays/" + array_ns +
                           "/" + curlc.url_escape(array_uri) +
                           "/non_empty_domain?" +
@@ -537,7 +592,12 @@ Status RestClient::get_array_max_buffer_sizes(
   RETURN_NOT_OK(uri.get_rest_components(&array_ns, &array_uri));
   const std::string cache_key = array_ns + ":" + array_uri;
   RETURN_NOT_OK(
-      curlc.init(config_, extra_headers_, &redirect_meta_, &redirect_mtx_));
+      curlc.init(
+          config_,
+          extra_headers_,
+          &redirect_meta_,
+          &redirect_mtx_,
+          curl_share_.share()));
   const std::string url = redirect_uri(cache_key) + "/v1/arrays/" + array_ns +
                           "/" + curlc.url_escape(array_uri) +
                           "/max_buffer_sizes" + subarray_query_param;
@@ -575,7 +635,12 @@ Status RestClient::get_array_metadata_from_rest(
   RETURN_NOT_OK(uri.get_rest_components(&array_ns, &array_uri));
   const std::string cache_key = array_ns + ":" + array_uri;
   RETURN_NOT_OK(
-      curlc.init(config_, extra_headers_, &redirect_meta_, &redirect_mtx_));
+      curlc.init(
+          config_,
+          extra_headers_,
+          &redirect_meta_,
+          &redirect_mtx_,
+          curl_share_.share()));
   const std::string url = redirect_uri(cache_key) + "/v1/arrays/" + array_ns +
                           "/" + curlc.url_escape(array_uri) +
                           "/array_metadata?" +
@@ -618,7 +683,12 @@ Status RestClient::post_array_metadata_to_rest(
   RETURN_NOT_OK(uri.get_rest_components(&array_ns, &array_uri));
   const std::string cache_key = array_ns + ":" + array_uri;
   RETURN_NOT_OK(
-      curlc.init(config_, extra_headers_, &redirect_meta_, &redirect_mtx_));
+      curlc.init(
+          config_,
+          extra_headers_,
+          &redirect_meta_,
+          &redirect_mtx_,
+          curl_share_.share()));
   const std::string url = redirect_uri(cache_key) + "/v1/arrays/" + array_ns +
                           "/" + curlc.url_escape(array_uri) +
                           "/array_metadata?" +
@@ -664,7 +734,12 @@ RestClient::post_enumerations_from_rest(
   throw_if_not_ok(uri.get_rest_components(&array_ns, &array_uri));
   const std::string cache_key = array_ns + ":" + array_uri;
   throw_if_not_ok(
-      curlc.init(config_, extra_headers_, &redirect_meta_, &redirect_mtx_));
+      curlc.init(
+          config_,
+          extra_headers_,
+          &redirect_meta_,
+          &redirect_mtx_,
+          curl_share_.share()));
   const std::string url = redirect_uri(cache_key) + "/v1/arrays/" + array_ns +
                           "/" + curlc.url_escape(array_uri) + "/enumerations?" +
                           "start_timestamp=" + std::to_string(timestamp_start) +
@@ -729,13 +804,14 @@ Status RestClient::post_query_submit(
   }
 
   auto rest_scratch = query->rest_scratch();
+  PendingDeserialization pending;
 
   // When a read query overflows the user buffer we may already have the next
   // part loaded in the scratch buffer.
   if (rest_scratch->size() > 0) {
     bool skip;
     query_post_call_back(
-        false, nullptr, 0, &skip, rest_scratch, query, copy_state);
+        false, nullptr, 0, &skip, rest_scratch, query, copy_state, &pending);
   }
 
   // Serialize query to send
@@ -749,7 +825,12 @@ Status RestClient::post_query_submit(
   RETURN_NOT_OK(uri.get_rest_components(&array_ns, &array_uri));
   const std::string cache_key = array_ns + ":" + array_uri;
   RETURN_NOT_OK(
-      curlc.init(config_, extra_headers_, &redirect_meta_, &redirect_mtx_));
+      curlc.init(
+          config_,
+          extra_headers_,
+          &redirect_meta_,
+          &redirect_mtx_,
+          curl_share_.share()));
   std::string url;
   if (use_refactored_array_and_query_) {
     url = redirect_uri(cache_key) + "/v3/arrays/" + array_ns + "/" +
@@ -778,9 +859,10 @@ Status RestClient::post_query_submit(
       std::placeholders::_4,
       rest_scratch,
       query,
-      copy_state);
+      copy_state,
+      &pending);
 
-  const Status st = curlc.post_data(
+  Status st = curlc.post_data(
       stats_,
       url,
       serialization_type_,
@@ -789,6 +871,13 @@ Status RestClient::post_query_submit(
       std::move(write_cb),
       cache_key);
 
+  // The deserialization of the last received message may still be in
+  // flight; wait for it before inspecting the copy state.
+  const Status deserialize_st = pending.wait(compute_tp_);
+  if (st.ok()) {
+    st = deserialize_st;
+  }
+
   if (!st.ok() && copy_state->empty()) {
     return LOG_STATUS(Status_RestError(
         "Error submitting query to REST; "
@@ -812,7 +901,8 @@ size_t RestClient::query_post_call_back(
     bool* const skip_retries,
     shared_ptr<Buffer> scratch,
     Query* query,
-    serialization::CopyState* copy_state) {
+    serialization::CopyState* copy_state,
+    PendingDeserialization* pending) {
   // All return statements in this function must pass through this wrapper.
   // This is responsible for two things:
   // 1. The 'bytes_processed' may be negative in error scenarios. The negative
@@ -844,6 +934,9 @@ size_t RestClient::query_post_call_back(
   // The most likely scenario is that the request failed and was retried
   // from within the Curl object.
   if (reset) {
+    // The retried request re-sends all messages, so the status of an
+    // in-flight deserialization is irrelevant.
+    (void)pending->wait(compute_tp_);
     scratch->set_size(0);
     scratch->reset_offset();
     copy_state->clear();
@@ -854,9 +947,72 @@ size_t RestClient::query_post_call_back(
   // a previous callback.
   bytes_processed -= scratch->size();
 
-  // Copy 'contents' to the end of 'scratch'. As a future optimization, if
-  // 'scratch' is empty, we could attempt to process 'contents' in-place and
-  // only copy the remaining, unprocessed bytes into 'scratch'.
+  // When no partial message is carried over from a previous callback,
+  // process 'contents' in place and only stage the trailing partial
+  // message in 'scratch'. This skips copying the bulk of the response
+  // through the scratch buffer.
+  if (scratch->size() == 0) {
+    const auto* data = static_cast<const uint8_t*>(contents);
+    size_t offset = 0;
+    while (offset + 8 <= content_nbytes) {
+      // Decode the query size.
+      const uint64_t query_size =
+          utils::endianness::decode_le<uint64_t>(data + offset);
+
+      // We must have the full serialized query before attempting to
+      // deserialize it.
+      if (offset + 8 + query_size > content_nbytes) {
+        break;
+      }
+
+      // Messages must be applied to 'copy_state' in response order, so
+      // wait for the deserialization of the previous message before
+      // dispatching this one.
+      Status status = pending->wait(compute_tp_);
+      if (!status.ok()) {
+        return return_wrapper(bytes_processed + offset);
+      }
+
+      // Copy the serialized query to a newly allocated, 8-byte aligned
+      // buffer owned by the deserialization task; 'contents' is only
+      // valid for the duration of this callback.
+      auto aux = make_shared<Buffer>(HERE());
+      status = aux->write(data + offset + 8, query_size);
+      if (!status.ok()) {
+        return return_wrapper(bytes_processed + offset);
+      }
+
+      // Deserialize the buffer on a background task and store it in
+      // 'copy_state', so receiving the next response chunks overlaps
+      // with deserialization.
+      pending->task_ = compute_tp_->execute([this, aux, query, copy_state]() {
+        aux->reset_offset();
+        return serialization::query_deserialize(
+            *aux, serialization_type_, true, copy_state, query, compute_tp_);
+      });
+
+      offset += 8 + query_size;
+    }
+    bytes_processed += offset;
+
+    // Stage the trailing partial message for the next callback.
+    const size_t remaining = content_nbytes - offset;
+    if (remaining > 0) {
+      Status status = scratch->write(data + offset, remaining);
+      if (!status.ok()) {
+        LOG_ERROR(
+            "Cannot copy libcurl response data; buffer write failed: " +
+            status.to_string());
+        return return_wrapper(bytes_processed);
+      }
+      bytes_processed += remaining;
+    }
+
+    assert(static_cast<size_t>(bytes_processed) == content_nbytes);
+    return return_wrapper(bytes_processed);
+  }
+
+  // Copy 'contents' to the end of 'scratch'.
   scratch->set_offset(scratch->size());
   Status st = scratch->write(contents, content_nbytes);
   if (!st.ok()) {
@@ -891,43 +1047,37 @@ size_t RestClient::query_post_call_back(
     // the offset to point to the start of the serialized query.
     scratch->advance_offset(8);
 
-    // We can only deserialize the query if it is 8-byte aligned. If the
-    // offset is 8-byte aligned, we can deserialize the query in-place.
-    // Otherwise, we must make a copy to an auxiliary buffer.
-    if (scratch->offset() % 8 != 0) {
-      // Copy the entire serialized buffer to a newly allocated, 8-byte
-      // aligned auxiliary buffer.
-      Buffer aux;
-      st = aux.write(scratch->cur_data(), query_size);
-      if (!st.ok()) {
-        scratch->set_offset(scratch->offset() - 8);
-        return return_wrapper(bytes_processed);
-      }
+    // Messages must be applied to 'copy_state' in response order, so wait
+    // for the deserialization of the previous message before dispatching
+    // this one. If it failed, the response data itself is at fault and we
+    // stop processing, as for an inline deserialization failure.
+    st = pending->wait(compute_tp_);
+    if (!st.ok()) {
+      scratch->set_offset(scratch->offset() - 8);
+      return return_wrapper(bytes_processed);
+    }
 
-      // Deserialize the buffer and store it in 'copy_state'. If
-      // the user buffers are too small to accommodate the attribute
-      // data when deserializing read queries, this will return an
-      // error status.
-      aux.reset_offset();
-      st = serialization::query_deserialize(
-          aux, serialization_type_, true, copy_state, query, compute_tp_);
-      if (!st.ok()) {
-        scratch->set_offset(scratch->offset() - 8);
-        return return_wrapper(bytes_processed);
-      }
-    } else {
-      // Deserialize the buffer and store it in 'copy_state'. If
-      // the user buffers are too small to accommodate the attribute
-      // data when deserializing read queries, this will return an
-      // error status.
-      st = serialization::query_deserialize(
-          *scratch, serialization_type_, true, copy_state, query, compute_tp_);
-      if (!st.ok()) {
-        scratch->set_offset(scratch->offset() - 8);
-        return return_wrapper(bytes_processed);
-      }
+    // Copy the serialized query to a newly allocated, 8-byte aligned
+    // buffer owned by the deserialization task; 'scratch' is truncated
+    // and refilled while the task runs.
+    auto aux = make_shared<Buffer>(HERE());
+    st = aux->write(scratch->cur_data(), query_size);
+    if (!st.ok()) {
+      scratch->set_offset(scratch->offset() - 8);
+      return return_wrapper(bytes_processed);
     }
 
+    // Deserialize the buffer on a background task and store it in
+    // 'copy_state', so receiving the next response chunks overlaps with
+    // deserialization. If the user buffers are too small to accommodate
+    // the attribute data when deserializing read queries, the task will
+    // return an error status.
+    pending->task_ = compute_tp_->execute([this, aux, query, copy_state]() {
+      aux->reset_offset();
+      return serialization::query_deserialize(
+          *aux, serialization_type_, true, copy_state, query, compute_tp_);
+    });
+
     scratch->advance_offset(query_size);
     bytes_processed += (query_size + 8);
   }
@@ -975,7 +1125,12 @@ Status RestClient::finalize_query_to_rest(const URI& uri, Query* query) {
   RETURN_NOT_OK(uri.get_rest_components(&array_ns, &array_uri));
   const std::string cache_key = array_ns + ":" + array_uri;
   RETURN_NOT_OK(
-      curlc.init(config_, extra_headers_, &redirect_meta_, &redirect_mtx_));
+      curlc.init(
+          config_,
+          extra_headers_,
+          &redirect_meta_,
+          &redirect_mtx_,
+          curl_share_.share()));
   std::string url;
   if (use_refactored_array_and_query_) {
     url = redirect_uri(cache_key) + "/v3/arrays/" + array_ns + "/" +
@@ -1030,7 +1185,12 @@ Status RestClient::submit_and_finalize_query_to_rest(
   RETURN_NOT_OK(uri.get_rest_components(&array_ns, &array_uri));
   const std::string cache_key = array_ns + ":" + array_uri;
   RETURN_NOT_OK(
-      curlc.init(config_, extra_headers_, &redirect_meta_, &redirect_mtx_));
+      curlc.init(
+          config_,
+          extra_headers_,
+          &redirect_meta_,
+          &redirect_mtx_,
+          curl_share_.share()));
   std::string url;
   if (use_refactored_array_and_query_) {
     url = redirect_uri(cache_key) + "/v3/arrays/" + array_ns + "/" +
@@ -1042,6 +1202,7 @@ Status RestClient::submit_and_finalize_query_to_rest(
           "/query/submit_and_finalize?type=" + query_type_str(query->type());
   }
 
+  PendingDeserialization pending;
   auto write_cb = std::bind(
       &RestClient::query_post_call_back,
       this,
@@ -1051,9 +1212,10 @@ Status RestClient::submit_and_finalize_query_to_rest(
       std::placeholders::_4,
       rest_scratch,
       query,
-      &copy_state);
+      &copy_state,
+      &pending);
 
-  const Status st = curlc.post_data(
+  Status st = curlc.post_data(
       stats_,
       url,
       serialization_type_,
@@ -1062,6 +1224,13 @@ Status RestClient::submit_and_finalize_query_to_rest(
       std::move(write_cb),
       cache_key);
 
+  // The deserialization of the last received message may still be in
+  // flight; wait for it before inspecting the copy state.
+  const Status deserialize_st = pending.wait(compute_tp_);
+  if (st.ok()) {
+    st = deserialize_st;
+  }
+
   if (!st.ok() && copy_state.empty()) {
     return LOG_STATUS(Status_RestError(
         "Error while submit_and_finalize query to REST; "
@@ -1157,7 +1326,12 @@ Status RestClient::get_query_est_result_sizes(const URI& uri, Query* query) {
   RETURN_NOT_OK(uri.get_rest_components(&array_ns, &array_uri));
   const std::string cache_key = array_ns + ":" + array_uri;
   RETURN_NOT_OK(
-      curlc.init(config_, extra_headers_, &redirect_meta_, &redirect_mtx_));
+      curlc.init(
+          config_,
+          extra_headers_,
+          &redirect_meta_,
+          &redirect_mtx_,
+          curl_share_.share()));
   std::string url =
       redirect_uri(cache_key) + "/v1/arrays/" + array_ns + "/" +
       curlc.url_escape(array_uri) +
@@ -1212,7 +1386,12 @@ Status RestClient::post_array_schema_evolution_to_rest(
   RETURN_NOT_OK(uri.get_rest_components(&array_ns, &array_uri));
   const std::string cache_key = array_ns + ":" + array_uri;
   RETURN_NOT_OK(
-      curlc.init(config_, extra_headers_, &redirect_meta_, &redirect_mtx_));
+      curlc.init(
+          config_,
+          extra_headers_,
+          &redirect_meta_,
+          &redirect_mtx_,
+          curl_share_.share()));
   auto deduced_url = redirect_uri(cache_key) + "/v1/arrays/" + array_ns + "/" +
                      curlc.url_escape(array_uri) + "/evolve";
   Buffer returned_data;
@@ -1245,7 +1424,12 @@ Status RestClient::post_fragment_info_from_rest(
   RETURN_NOT_OK(uri.get_rest_components(&array_ns, &array_uri));
   const std::string cache_key = array_ns + ":" + array_uri;
   RETURN_NOT_OK(
-      curlc.init(config_, extra_headers_, &redirect_meta_, &redirect_mtx_));
+      curlc.init(
+          config_,
+          extra_headers_,
+          &redirect_meta_,
+          &redirect_mtx_,
+          curl_share_.share()));
   const std::string url = redirect_uri(cache_key) + "/v1/arrays/" + array_ns +
                           "/" + curlc.url_escape(array_uri) + "/fragment_info";
 
@@ -1287,7 +1471,12 @@ Status RestClient::post_group_metadata_from_rest(const URI& uri, Group* group) {
   RETURN_NOT_OK(uri.get_rest_components(&group_ns, &group_uri));
   const std::string cache_key = group_ns + ":" + group_uri;
   RETURN_NOT_OK(
-      curlc.init(config_, extra_headers_, &redirect_meta_, &redirect_mtx_));
+      curlc.init(
+          config_,
+          extra_headers_,
+          &redirect_meta_,
+          &redirect_mtx_,
+          curl_share_.share()));
   const std::string url = redirect_uri(cache_key) + "/v2/groups/" + group_ns +
                           "/" + curlc.url_escape(group_uri) + "/metadata";
 
@@ -1330,7 +1519,12 @@ Status RestClient::put_group_metadata_to_rest(const URI& uri, Group* group) {
   RETURN_NOT_OK(uri.get_rest_components(&group_ns, &group_uri));
   const std::string cache_key = group_ns + ":" + group_uri;
   RETURN_NOT_OK(
-      curlc.init(config_, extra_headers_, &redirect_meta_, &redirect_mtx_));
+      curlc.init(
+          config_,
+          extra_headers_,
+          &redirect_meta_,
+          &redirect_mtx_,
+          curl_share_.share()));
   const std::string url = redirect_uri(cache_key) + "/v2/groups/" + group_ns +
                           "/" + curlc.url_escape(group_uri) + "/metadata";
 
@@ -1359,7 +1553,12 @@ Status RestClient::post_group_create_to_rest(const URI& uri, Group* group) {
   RETURN_NOT_OK(uri.get_rest_components(&group_ns, &group_uri));
   const std::string cache_key = group_ns + ":" + group_uri;
   RETURN_NOT_OK(
-      curlc.init(config_, extra_headers_, &redirect_meta_, &redirect_mtx_));
+      curlc.init(
+          config_,
+          extra_headers_,
+          &redirect_meta_,
+          &redirect_mtx_,
+          curl_share_.share()));
   const std::string url = redirect_uri(cache_key) + "/v2/groups/" + group_ns;
 
   // Create the group and check for error
@@ -1387,7 +1586,12 @@ Status RestClient::post_group_from_rest(const URI& uri, Group* group) {
   RETURN_NOT_OK(uri.get_rest_components(&group_ns, &group_uri));
   const std::string cache_key = group_ns + ":" + group_uri;
   RETURN_NOT_OK(
-      curlc.init(config_, extra_headers_, &redirect_meta_, &redirect_mtx_));
+      curlc.init(
+          config_,
+          extra_headers_,
+          &redirect_meta_,
+          &redirect_mtx_,
+          curl_share_.share()));
   const std::string url = redirect_uri(cache_key) + "/v2/groups/" + group_ns +
                           "/" + curlc.url_escape(group_uri);
 
@@ -1431,7 +1635,12 @@ Status RestClient::patch_group_to_rest(const URI& uri, Group* group) {
   RETURN_NOT_OK(uri.get_rest_components(&group_ns, &group_uri));
   const std::string cache_key = group_ns + ":" + group_uri;
   RETURN_NOT_OK(
-      curlc.init(config_, extra_headers_, &redirect_meta_, &redirect_mtx_));
+      curlc.init(
+          config_,
+          extra_headers_,
+          &redirect_meta_,
+          &redirect_mtx_,
+          curl_share_.share()));
   const std::string url = redirect_uri(cache_key) + "/v2/groups/" + group_ns +
                           "/" + curlc.url_escape(group_uri);
 
@@ -1448,7 +1657,12 @@ void RestClient::delete_group_from_rest(const URI& uri, bool recursive) {
   throw_if_not_ok(uri.get_rest_components(&group_ns, &group_uri));
   const std::string cache_key = group_ns + ":" + group_uri;
   throw_if_not_ok(
-      curlc.init(config_, extra_headers_, &redirect_meta_, &redirect_mtx_));
+      curlc.init(
+          config_,
+          extra_headers_,
+          &redirect_meta_,
+          &redirect_mtx_,
+          curl_share_.share()));
   const std::string recursive_str = recursive ? "true" : "false";
   const std::string url = redirect_uri(cache_key) + "/v2/groups/" + group_ns +
                           "/" + curlc.url_escape(group_uri) +
@@ -1482,7 +1696,12 @@ Status RestClient::post_consolidation_to_rest(
   RETURN_NOT_OK(uri.get_rest_components(&array_ns, &array_uri));
   const std::string cache_key = array_ns + ":" + array_uri;
   RETURN_NOT_OK(
-      curlc.init(config_, extra_headers_, &redirect_meta_, &redirect_mtx_));
+      curlc.init(
+          config_,
+          extra_headers_,
+          &redirect_meta_,
+          &redirect_mtx_,
+          curl_share_.share()));
   const std::string url = redirect_uri(cache_key) + "/v1/arrays/" + array_ns +
                           "/" + curlc.url_escape(array_uri) + "/consolidate";
 
@@ -1506,7 +1725,12 @@ Status RestClient::post_vacuum_to_rest(const URI& uri, const Config& config) {
   RETURN_NOT_OK(uri.get_rest_components(&array_ns, &array_uri));
   const std::string cache_key = array_ns + ":" + array_uri;
   RETURN_NOT_OK(
-      curlc.init(config_, extra_headers_, &redirect_meta_, &redirect_mtx_));
+      curlc.init(
+          config_,
+          extra_headers_,
+          &redirect_meta_,
+          &redirect_mtx_,
+          curl_share_.share()));
   const std::string url = redirect_uri(cache_key) + "/v1/arrays/" + array_ns +
                           "/" + curlc.url_escape(array_uri) + "/vacuum";
 
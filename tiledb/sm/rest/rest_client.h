@@ -33,12 +33,14 @@
 #ifndef TILEDB_REST_CLIENT_H
 #define TILEDB_REST_CLIENT_H
 
+#include <optional>
 #include <string>
 #include <unordered_map>
 
 #include "tiledb/common/logger_public.h"
 #include "tiledb/common/status.h"
 #include "tiledb/common/thread_pool.h"
+#include "tiledb/sm/curl/curl_share.h"
 #include "tiledb/sm/group/group.h"
 #include "tiledb/sm/serialization/query.h"
 #include "tiledb/sm/stats/stats.h"
@@ -428,6 +430,12 @@ class RestClient {
   /** Mutex for thread-safety. */
   mutable std::mutex redirect_mtx_;
 
+  /**
+   * Share handle pooling connections, TLS sessions and DNS entries
+   * across the per-request curl handles of this client.
+   */
+  curl::CurlShare curl_share_;
+
   /** The class logger. */
   shared_ptr<Logger> logger_;
 
@@ -457,6 +465,36 @@ class RestClient {
   Status post_query_submit(
       const URI& uri, Query* query, serialization::CopyState* copy_state);
 
+  /**
+   * Tracks the background deserialization of the last completed serialized
+   * query message of a query response, so that the next response chunks
+   * can be received from the network while the message is processed.
+   *
+   * Messages must be applied to the copy state in response order, so at
+   * most one deserialization is in flight at a time: the callback waits
+   * for the previous message before dispatching the next one.
+   */
+  struct PendingDeserialization {
+    /** Task deserializing the last completed message, if any. */
+    std::optional<ThreadPool::Task> task_;
+
+    /**
+     * Waits for the in-flight deserialization, if any, and returns its
+     * status.
+     *
+     * @param compute_tp Thread pool the task was dispatched on.
+     * @return Status of the completed deserialization.
+     */
+    Status wait(ThreadPool* compute_tp) {
+      if (!task_.has_value()) {
+        return Status::Ok();
+      }
+      auto task = std::move(task_.value());
+      task_.reset();
+      return compute_tp->wait(task);
+    }
+  };
+
   /**
    * Callback to invoke as partial, buffered response data is received from
    * posting a query.
@@ -478,6 +516,9 @@ class RestClient {
    * @param copy_state Map of copy state per attribute. As attribute data is
    *    copied into user buffers on reads, the state of each attribute in this
    *    map is updated accordingly.
+   * @param pending In-flight deserialization state shared between
+   *    invocations of this callback. The caller must wait on it after the
+   *    last invocation has completed.
    * @return Number of acknowledged bytes
    */
   size_t query_post_call_back(
@@ -487,7 +528,8 @@ class RestClient {
       bool* constskip_retries,
       shared_ptr<Buffer> scratch,
       Query* query,
-      serialization::CopyState* copy_state);
+      serialization::CopyState* copy_state,
+      PendingDeserialization* pending);
 
   /**
    * Returns a string representation of the given subarray. The format is:
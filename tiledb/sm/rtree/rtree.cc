@@ -41,7 +41,9 @@
 
 #include <cassert>
 #include <cmath>
+#include <cstring>
 #include <iostream>
+#include <limits>
 #include <list>
 
 using namespace tiledb::common;
@@ -104,6 +106,7 @@ void RTree::build_tree() {
   auto leaf_num = levels_[0].size();
   assert(leaf_num >= 1);
   if (leaf_num == 1) {
+    build_flat_leaves();
     return;
   }
 
@@ -116,11 +119,14 @@ void RTree::build_tree() {
 
   // Make the root as the first level
   std::reverse(std::begin(levels_), std::end(levels_));
+
+  build_flat_leaves();
 }
 
 uint64_t RTree::free_memory() {
   auto ret = deserialized_buffer_size_;
   levels_.clear();
+  flat_leaves_.clear();
   deserialized_buffer_size_ = 0;
   return ret;
 }
@@ -147,6 +153,15 @@ TileOverlap RTree::get_tile_overlap(
   auto leaf_num = levels_.back().size();
   auto height = this->height();
 
+  // Whether the leaf level can be intersected through the flattened
+  // layout, without per-MBR virtual dispatch.
+  const bool scan_leaves = can_scan_flat_leaves(is_default);
+  if (scan_leaves && height == 1) {
+    // The root is the leaf level.
+    scan_flat_leaves(range, is_default, 0, leaf_num - 1, overlap);
+    return overlap;
+  }
+
   while (!traversal.empty()) {
     // Get next entry
     auto entry = traversal.front();
@@ -176,8 +191,13 @@ TileOverlap RTree::get_tile_overlap(
           auto next_mbr_num = (uint64_t)levels_[entry.level_ + 1].size();
           auto start = entry.mbr_idx_ * fanout_;
           auto end = std::min(start + fanout_ - 1, next_mbr_num - 1);
-          for (uint64_t i = start; i <= end; ++i)
-            traversal.push_front({entry.level_ + 1, end - (i - start)});
+          if (scan_leaves && entry.level_ + 2 == height) {
+            // The children are leaves, intersect them with a linear scan.
+            scan_flat_leaves(range, is_default, start, end, overlap);
+          } else {
+            for (uint64_t i = start; i <= end; ++i)
+              traversal.push_front({entry.level_ + 1, end - (i - start)});
+          }
         }
       }
     }
@@ -264,13 +284,20 @@ void RTree::serialize(Serializer& serializer) const {
   serializer.write<uint32_t>(level_num);
   auto dim_num = domain_->dim_num();
 
+  // Hoist the per-dimension layout out of the MBR loops; large fragments
+  // serialize millions of ranges.
+  std::vector<bool> var_size(dim_num);
+  for (unsigned d = 0; d < dim_num; ++d) {
+    var_size[d] = domain_->dimension_ptr(d)->var_size();
+  }
+
   for (unsigned l = 0; l < level_num; ++l) {
     auto mbr_num = (uint64_t)levels_[l].size();
     serializer.write<uint64_t>(mbr_num);
     for (uint64_t m = 0; m < mbr_num; ++m) {
       for (unsigned d = 0; d < dim_num; ++d) {
         const auto& r = levels_[l][m][d];
-        if (!domain_->dimension_ptr(d)->var_size()) {  // Fixed-sized
+        if (!var_size[d]) {  // Fixed-sized
           // Just write the plain range
           serializer.write(r.data(), r.size());
         } else {  // Var-sized
@@ -293,6 +320,7 @@ Status RTree::set_leaf(uint64_t leaf_id, const NDRange& mbr) {
     return LOG_STATUS(Status_RTreeError("Cannot set leaf; Invalid lead index"));
 
   levels_[0][leaf_id] = mbr;
+  flat_leaves_.clear();
 
   return Status::Ok();
 }
@@ -301,6 +329,7 @@ Status RTree::set_leaves(const std::vector<NDRange>& mbrs) {
   levels_.clear();
   levels_.resize(1);
   levels_[0] = mbrs;
+  flat_leaves_.clear();
   return Status::Ok();
 }
 
@@ -315,6 +344,7 @@ Status RTree::set_leaf_num(uint64_t num) {
                           "cannot be smaller than the current leaf number"));
 
   levels_[0].resize(num);
+  flat_leaves_.clear();
   return Status::Ok();
 }
 
@@ -347,11 +377,116 @@ RTree::Level RTree::build_level(const Level& level) {
   return new_level;
 }
 
+void RTree::build_flat_leaves() {
+  flat_leaves_.clear();
+  if (domain_ == nullptr || levels_.empty()) {
+    return;
+  }
+
+  auto dim_num = domain_->dim_num();
+  const auto& leaves = levels_.back();
+  auto leaf_num = leaves.size();
+  flat_leaves_.resize(dim_num);
+  for (unsigned d = 0; d < dim_num; ++d) {
+    auto dim{domain_->dimension_ptr(d)};
+
+    // Var-sized MBR ranges cannot be flattened to a fixed stride.
+    if (dim->var_size()) {
+      continue;
+    }
+
+    auto r_size = 2 * dim->coord_size();
+    auto& flat = flat_leaves_[d];
+    flat.resize(leaf_num * r_size);
+    for (uint64_t m = 0; m < leaf_num; ++m) {
+      std::memcpy(&flat[m * r_size], leaves[m][d].data(), r_size);
+    }
+  }
+}
+
+bool RTree::can_scan_flat_leaves(const std::vector<bool>& is_default) const {
+  if (flat_leaves_.empty()) {
+    return false;
+  }
+
+  auto dim_num = domain_->dim_num();
+  for (unsigned d = 0; d < dim_num; ++d) {
+    if (!is_default[d] && flat_leaves_[d].empty()) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void RTree::scan_flat_leaves(
+    const NDRange& range,
+    const std::vector<bool>& is_default,
+    uint64_t start,
+    uint64_t end,
+    TileOverlap& overlap) const {
+  auto leaf_num = end - start + 1;
+  auto dim_num = domain_->dim_num();
+
+  // Multiply the per-dimension ratios into a single ratio per leaf. This
+  // mirrors `Domain::overlap_ratio`, but dispatches on the dimension type
+  // once per leaf range instead of once per MBR.
+  std::vector<double> ratios(leaf_num, 1.0);
+  std::vector<double> dim_ratios(leaf_num);
+  auto max = std::numeric_limits<double>::max();
+  for (unsigned d = 0; d < dim_num; ++d) {
+    if (is_default[d]) {
+      continue;
+    }
+
+    auto dim{domain_->dimension_ptr(d)};
+    auto r_size = 2 * dim->coord_size();
+    const auto* mbrs = flat_leaves_[d].data() + start * r_size;
+    dim->overlap_ratio_vec(range[d], mbrs, leaf_num, dim_ratios.data());
+
+    for (uint64_t i = 0; i < leaf_num; ++i) {
+      if (ratios[i] == 0.0 || dim_ratios[i] == 0.0) {
+        ratios[i] = 0.0;
+        continue;
+      }
+
+      ratios[i] *= dim_ratios[i];
+
+      // If ratio goes to 0, then the subarray overlap is much smaller than
+      // the volume of the MBR. Since there is an overlap on every dimension
+      // processed so far, we should set the ratio to epsilon.
+      if (ratios[i] == 0.0) {
+        ratios[i] = std::nextafter(0, max);
+      }
+    }
+  }
+
+  // Emit the results, coalescing contiguous fully overlapping leaves.
+  for (uint64_t i = 0; i < leaf_num; ++i) {
+    if (ratios[i] == 0.0) {
+      continue;
+    }
+
+    auto tile_idx = start + i;
+    if (ratios[i] == 1.0) {
+      auto& tile_ranges = overlap.tile_ranges_;
+      if (!tile_ranges.empty() && tile_ranges.back().second + 1 == tile_idx) {
+        tile_ranges.back().second = tile_idx;
+      } else {
+        tile_ranges.emplace_back(tile_idx, tile_idx);
+      }
+    } else {
+      overlap.tiles_.emplace_back(tile_idx, ratios[i]);
+    }
+  }
+}
+
 RTree RTree::clone() const {
   RTree clone;
   clone.domain_ = domain_;
   clone.fanout_ = fanout_;
   clone.levels_ = levels_;
+  clone.flat_leaves_ = flat_leaves_;
 
   return clone;
 }
@@ -372,20 +507,24 @@ void RTree::deserialize_v1_v4(
   levels_.clear();
   levels_.resize(level_num);
   auto dim_num = domain->dim_num();
+  std::vector<uint64_t> r_size(dim_num);
+  for (unsigned d = 0; d < dim_num; ++d) {
+    r_size[d] = 2 * domain->dimension_ptr(d)->coord_size();
+  }
   for (unsigned l = 0; l < level_num; ++l) {
     auto mbr_num = deserializer.read<uint64_t>();
     levels_[l].resize(mbr_num);
     for (uint64_t m = 0; m < mbr_num; ++m) {
       levels_[l][m].resize(dim_num);
       for (unsigned d = 0; d < dim_num; ++d) {
-        auto r_size{2 * domain->dimension_ptr(d)->coord_size()};
-        auto data = deserializer.get_ptr<void>(r_size);
-        levels_[l][m][d] = Range(data, r_size);
+        auto data = deserializer.get_ptr<void>(r_size[d]);
+        levels_[l][m][d] = Range(data, r_size[d]);
       }
     }
   }
 
   domain_ = domain;
+  build_flat_leaves();
 }
 
 void RTree::deserialize_v5(Deserializer& deserializer, const Domain* domain) {
@@ -398,6 +537,15 @@ void RTree::deserialize_v5(Deserializer& deserializer, const Domain* domain) {
   levels_.resize(level_num);
   auto dim_num = domain->dim_num();
 
+  // Per-dimension fixed range size, or 0 for var-sized dimensions. Looked
+  // up once instead of per MBR; the levels of a large fragment contain
+  // millions of ranges.
+  std::vector<uint64_t> fixed_r_size(dim_num);
+  for (unsigned d = 0; d < dim_num; ++d) {
+    auto dim{domain->dimension_ptr(d)};
+    fixed_r_size[d] = dim->var_size() ? 0 : 2 * dim->coord_size();
+  }
+
   for (unsigned l = 0; l < level_num; ++l) {
     auto mbr_num = deserializer.read<uint64_t>();
     levels_[l].resize(mbr_num);
@@ -405,11 +553,9 @@ void RTree::deserialize_v5(Deserializer& deserializer, const Domain* domain) {
     for (uint64_t m = 0; m < mbr_num; ++m) {
       levels_[l][m].resize(dim_num);
       for (unsigned d = 0; d < dim_num; ++d) {
-        auto dim{domain->dimension_ptr(d)};
-        if (!dim->var_size()) {  // Fixed-sized
-          auto r_size = 2 * dim->coord_size();
-          auto data = deserializer.get_ptr<void>(r_size);
-          levels_[l][m][d] = Range(data, r_size);
+        if (fixed_r_size[d] != 0) {  // Fixed-sized
+          auto data = deserializer.get_ptr<void>(fixed_r_size[d]);
+          levels_[l][m][d] = Range(data, fixed_r_size[d]);
         } else {  // Var-sized
           // range_size | start_size | range
           auto r_size = deserializer.read<uint64_t>();
@@ -422,12 +568,14 @@ void RTree::deserialize_v5(Deserializer& deserializer, const Domain* domain) {
   }
 
   domain_ = domain;
+  build_flat_leaves();
 }
 
 void RTree::swap(RTree& rtree) {
   std::swap(domain_, rtree.domain_);
   std::swap(fanout_, rtree.fanout_);
   std::swap(levels_, rtree.levels_);
+  std::swap(flat_leaves_, rtree.flat_leaves_);
 }
 
 }  // namespace sm
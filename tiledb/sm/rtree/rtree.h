@@ -239,6 +239,18 @@ class RTree {
    */
   std::vector<Level> levels_;
 
+  /**
+   * A flattened copy of the leaf level, one buffer per dimension. The
+   * buffer of dimension `d` stores the `[low, high]` pair of every leaf
+   * MBR on `d` contiguously, so that ranges of leaves can be intersected
+   * with a query range without per-MBR virtual dispatch. Buffers are
+   * built only for fixed-sized dimensions; the buffer of a var-sized
+   * dimension remains empty. The vector is empty altogether when the
+   * flattened layout has not been built (e.g., while the leaf level is
+   * still being mutated).
+   */
+  std::vector<std::vector<uint8_t>> flat_leaves_;
+
   /**
    * Stores the size of the buffer used to deserialize the data, used for
    * memory tracking pusposes on reads.
@@ -252,6 +264,30 @@ class RTree {
   /** Builds a single tree level on top of the input level. */
   Level build_level(const Level& level);
 
+  /**
+   * Builds the flattened leaf layout from the current leaf level. Must be
+   * called only once the leaf level is final.
+   */
+  void build_flat_leaves();
+
+  /**
+   * Returns `true` if leaf MBRs can be intersected with a query range
+   * through the flattened leaf layout, i.e., if the layout is built and
+   * all non-default dimensions are fixed-sized.
+   */
+  bool can_scan_flat_leaves(const std::vector<bool>& is_default) const;
+
+  /**
+   * Intersects `range` with the leaf MBRs in `[start, end]` through the
+   * flattened leaf layout, appending the overlap result to `overlap`.
+   */
+  void scan_flat_leaves(
+      const NDRange& range,
+      const std::vector<bool>& is_default,
+      uint64_t start,
+      uint64_t end,
+      TileOverlap& overlap) const;
+
   /** Returns a deep copy of this RTree. */
   RTree clone() const;
 
@@ -313,6 +313,39 @@ TEST_CASE("RTree: Test 1D R-tree, height 2", "[rtree][1d][2h]") {
   CHECK(overlap.tiles_[1].second == 2.0 / 3);
 }
 
+TEST_CASE(
+    "RTree: Test 1D R-tree, leaf scan coalescing", "[rtree][1d][leaf-scan]") {
+  // Build tree
+  std::vector<bool> is_default(1, false);
+  int32_t dim_dom[] = {1, 1000};
+  int32_t dim_extent = 10;
+  Domain dom1 =
+      create_domain({"d"}, {Datatype::INT32}, {dim_dom}, {&dim_extent});
+  std::vector<NDRange> mbrs =
+      create_mbrs<int32_t, 1>({1, 3, 5, 10, 20, 22, 30, 34});
+  const Domain d1{dom1};
+  RTree rtree(&d1, 4);
+  CHECK(rtree.set_leaves(mbrs).ok());
+  rtree.build_tree();
+  CHECK(rtree.height() == 2);
+
+  // A range that partially overlaps the first and last leaves and fully
+  // covers the two middle leaves. The fully covered leaves are adjacent, so
+  // the leaf scan should coalesce them into a single tile range.
+  NDRange range(1);
+  int32_t r[] = {2, 31};
+  range[0] = Range(r, 2 * sizeof(int32_t));
+  auto overlap = rtree.get_tile_overlap(range, is_default);
+  CHECK(overlap.tile_ranges_.size() == 1);
+  CHECK(overlap.tile_ranges_[0].first == 1);
+  CHECK(overlap.tile_ranges_[0].second == 2);
+  CHECK(overlap.tiles_.size() == 2);
+  CHECK(overlap.tiles_[0].first == 0);
+  CHECK(overlap.tiles_[0].second == 2.0 / 3);
+  CHECK(overlap.tiles_[1].first == 3);
+  CHECK(overlap.tiles_[1].second == 2.0 / 5);
+}
+
 TEST_CASE("RTree: Test 1D R-tree, height 3", "[rtree][1d][3h]") {
   // Build tree
   std::vector<bool> is_default(1, false);
@@ -54,6 +54,7 @@
 #include "tiledb/sm/filter/bit_width_reduction_filter.h"
 #include "tiledb/sm/filter/bitshuffle_filter.h"
 #include "tiledb/sm/filter/byteshuffle_filter.h"
+#include "tiledb/sm/filter/checksum_crc32c_filter.h"
 #include "tiledb/sm/filter/checksum_md5_filter.h"
 #include "tiledb/sm/filter/checksum_sha256_filter.h"
 #include "tiledb/sm/filter/compression_filter.h"
@@ -158,6 +159,7 @@ Status filter_to_capnp(
     case FilterType::FILTER_BYTESHUFFLE:
     case FilterType::FILTER_CHECKSUM_MD5:
     case FilterType::FILTER_CHECKSUM_SHA256:
+    case FilterType::FILTER_CHECKSUM_CRC32C:
     case FilterType::INTERNAL_FILTER_AES_256_GCM:
     case FilterType::FILTER_XOR:
     case FilterType::FILTER_DEPRECATED:
@@ -275,6 +277,11 @@ tuple<Status, optional<shared_ptr<Filter>>> filter_from_capnp(
           Status::Ok(),
           tiledb::common::make_shared<ChecksumSHA256Filter>(HERE(), datatype)};
     }
+    case FilterType::FILTER_CHECKSUM_CRC32C: {
+      return {
+          Status::Ok(),
+          tiledb::common::make_shared<ChecksumCRC32CFilter>(HERE(), datatype)};
+    }
     case FilterType::INTERNAL_FILTER_AES_256_GCM: {
       return {
           Status::Ok(),
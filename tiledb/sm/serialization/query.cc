@@ -48,6 +48,7 @@
 #include "tiledb/common/common.h"
 #include "tiledb/common/heap_memory.h"
 #include "tiledb/common/logger.h"
+#include "tiledb/common/scoped_executor.h"
 #include "tiledb/sm/array/array.h"
 #include "tiledb/sm/buffer/buffer_list.h"
 #include "tiledb/sm/config/config.h"
@@ -1690,6 +1691,26 @@ Status query_from_capnp(
 
   auto buffer_headers = query_reader.getAttributeBufferHeaders();
   auto attribute_buffer_start = static_cast<char*>(buffer_start);
+
+  // On the client, the response data is copied into the user buffers by
+  // tasks on the compute pool; the serial loop below only walks the
+  // headers and validates sizes. With wide schemas and large payloads
+  // the copies dominate deserialization time, and each attribute copies
+  // from a distinct region of the message into distinct destinations.
+  std::vector<ThreadPool::Task> copy_tasks;
+
+  // The copy tasks read the serialized message, which the caller owns and
+  // may free as soon as this function returns. Every exit path, including
+  // error returns while walking later headers, must therefore wait for
+  // the scheduled copies before unwinding. The explicit waits below clear
+  // the task list, so on those paths the guard has nothing left to do;
+  // task failures here are already logged by the thread pool.
+  ScopedExecutor copy_tasks_guard([&]() {
+    if (!copy_tasks.empty()) {
+      (void)compute_tp->wait_all(copy_tasks);
+    }
+  });
+
   for (auto buffer_header : buffer_headers) {
     const std::string name = buffer_header.getName().cStr();
 
@@ -1855,139 +1876,164 @@ Status query_from_capnp(
             validity_size_left >= validitylen_size;
 
         if (!has_mem_for_data || !has_mem_for_offset || !has_mem_for_validity) {
+          // Let the copies already scheduled for previous attributes finish
+          // before reporting the error.
+          const auto st = compute_tp->wait_all(copy_tasks);
+          copy_tasks.clear();
+          RETURN_NOT_OK(st);
           return LOG_STATUS(Status_SerializationError(
               "Error deserializing query; buffer too small for buffer '" +
               name + "'."));
         }
 
-        // Copy the response data into user buffers.
-        if (var_size) {
-          // Var size attribute; buffers already set.
-          char* offset_dest = (char*)existing_offset_buffer + curr_offset_size;
-          char* data_dest = (char*)existing_buffer + curr_data_size;
-          char* validity_dest =
-              (char*)existing_validity_buffer + curr_validity_size;
-          uint64_t fixedlen_size_to_copy = fixedlen_size;
-
-          // If the last query included an extra offset we will skip the first
-          // offset in this query The first offset is the 0 position which
-          // ends up the same as the extra offset in the last query 0th is
-          // converted below to curr_data_size which is also the n+1 offset in
-          // arrow mode
-          if (attr_copy_state != nullptr &&
-              attr_copy_state->last_query_added_extra_offset) {
-            attribute_buffer_start += sizeof(uint64_t);
-            fixedlen_size_to_copy -= sizeof(uint64_t);
-          }
+        // Copy the response data into user buffers on the compute pool.
+        // The captures are all by value (the mutated cursor is the task's
+        // own copy); `query_buffer` holds pointers into the query and the
+        // user buffers, which remain valid until the tasks are awaited
+        // after the loop.
+        copy_tasks.emplace_back(compute_tp->execute([=]() mutable {
+          if (var_size) {
+            // Var size attribute; buffers already set.
+            char* offset_dest =
+                (char*)existing_offset_buffer + curr_offset_size;
+            char* data_dest = (char*)existing_buffer + curr_data_size;
+            char* validity_dest =
+                (char*)existing_validity_buffer + curr_validity_size;
+            uint64_t fixedlen_size_to_copy = fixedlen_size;
+
+            // If the last query included an extra offset we will skip the first
+            // offset in this query The first offset is the 0 position which
+            // ends up the same as the extra offset in the last query 0th is
+            // converted below to curr_data_size which is also the n+1 offset in
+            // arrow mode
+            if (attr_copy_state != nullptr &&
+                attr_copy_state->last_query_added_extra_offset) {
+              attribute_buffer_start += sizeof(uint64_t);
+              fixedlen_size_to_copy -= sizeof(uint64_t);
+            }
 
-          std::memcpy(
-              offset_dest, attribute_buffer_start, fixedlen_size_to_copy);
-          attribute_buffer_start += fixedlen_size_to_copy;
-          std::memcpy(data_dest, attribute_buffer_start, varlen_size);
-          attribute_buffer_start += varlen_size;
-          if (nullable) {
             std::memcpy(
-                validity_dest, attribute_buffer_start, validitylen_size);
-            attribute_buffer_start += validitylen_size;
-          }
+                offset_dest, attribute_buffer_start, fixedlen_size_to_copy);
+            attribute_buffer_start += fixedlen_size_to_copy;
+            std::memcpy(data_dest, attribute_buffer_start, varlen_size);
+            attribute_buffer_start += varlen_size;
+            if (nullable) {
+              std::memcpy(
+                  validity_dest, attribute_buffer_start, validitylen_size);
+              attribute_buffer_start += validitylen_size;
+            }
 
-          // The offsets in each buffer correspond to the values in its
-          // data buffer. To build a single contiguous buffer, we must
-          // ensure the offset values continue in ascending order from the
-          // previous buffer. For example, consider the following example
-          // storing int32 values.
-          //
-          // Buffer #1:
-          //   offsets: [0, 8, 16]
-          //   values:  [1, 2, 3, 4, 5, 6, 7]
-          //
-          // Buffer #2:
-          //   offsets: [0, 12]
-          //   values:  [100, 200, 300, 400, 500]
-          //
-          // The final, contiguous buffer will be:
-          //   offsets: [0, 8, 16, 28, 40]
-          //   values:  [1, 2, 3, 4, 5, 6, 7, 100, 200, 300, 400, 500]
-          //
-          // The last two offsets, `28, 40` were calculated by adding `28`
-          // to offsets of Buffer #2: [0, 12]. The `28` was calculated as
-          // the byte size of the values in Buffer #1.
-          if (curr_data_size > 0) {
-            for (uint64_t i = 0; i < (fixedlen_size_to_copy / sizeof(uint64_t));
-                 ++i) {
-              reinterpret_cast<uint64_t*>(offset_dest)[i] += curr_data_size;
+            // The offsets in each buffer correspond to the values in its
+            // data buffer. To build a single contiguous buffer, we must
+            // ensure the offset values continue in ascending order from the
+            // previous buffer. For example, consider the following example
+            // storing int32 values.
+            //
+            // Buffer #1:
+            //   offsets: [0, 8, 16]
+            //   values:  [1, 2, 3, 4, 5, 6, 7]
+            //
+            // Buffer #2:
+            //   offsets: [0, 12]
+            //   values:  [100, 200, 300, 400, 500]
+            //
+            // The final, contiguous buffer will be:
+            //   offsets: [0, 8, 16, 28, 40]
+            //   values:  [1, 2, 3, 4, 5, 6, 7, 100, 200, 300, 400, 500]
+            //
+            // The last two offsets, `28, 40` were calculated by adding `28`
+            // to offsets of Buffer #2: [0, 12]. The `28` was calculated as
+            // the byte size of the values in Buffer #1.
+            if (curr_data_size > 0) {
+              for (uint64_t i = 0;
+                   i < (fixedlen_size_to_copy / sizeof(uint64_t));
+                   ++i) {
+                reinterpret_cast<uint64_t*>(offset_dest)[i] += curr_data_size;
+              }
             }
-          }
 
-          // attr_copy_state==nulptr models the case of deserialization code
-          // being called via the C API tiledb_query_deserialize (e.g. unit
-          // test serialization wrappers).
-          // When a rest_client exists, there is always a non null copy_state
-          // incoming argument from which attr_copy_state is initialized
-          if (attr_copy_state == nullptr) {
-            // Set the size directly on the query (so user can introspect on
-            // result size).
-            // Subsequent incomplete submits will use the original buffer
-            // sizes members from the query in the beginning of the loop
-            // to calculate if user buffers have enough space to hold the
-            // data, here we only care that after data received from the wire
-            // is copied within the user buffers, the buffer sizes are
-            // accurate so user can introspect.
-            *query_buffer.buffer_size_ =
-                curr_offset_size + fixedlen_size_to_copy;
-            *query_buffer.buffer_var_size_ = curr_data_size + varlen_size;
-            if (nullable) {
-              *query_buffer.validity_vector_.buffer_size() =
-                  curr_validity_size + validitylen_size;
+            // attr_copy_state==nulptr models the case of deserialization code
+            // being called via the C API tiledb_query_deserialize (e.g. unit
+            // test serialization wrappers).
+            // When a rest_client exists, there is always a non null copy_state
+            // incoming argument from which attr_copy_state is initialized
+            if (attr_copy_state == nullptr) {
+              // Set the size directly on the query (so user can introspect on
+              // result size).
+              // Subsequent incomplete submits will use the original buffer
+              // sizes members from the query in the beginning of the loop
+              // to calculate if user buffers have enough space to hold the
+              // data, here we only care that after data received from the wire
+              // is copied within the user buffers, the buffer sizes are
+              // accurate so user can introspect.
+              *query_buffer.buffer_size_ =
+                  curr_offset_size + fixedlen_size_to_copy;
+              *query_buffer.buffer_var_size_ = curr_data_size + varlen_size;
+              if (nullable) {
+                *query_buffer.validity_vector_.buffer_size() =
+                    curr_validity_size + validitylen_size;
+              }
+            } else {
+              // Accumulate total bytes copied (caller's responsibility to
+              // eventually update the query).
+              attr_copy_state->offset_size += fixedlen_size_to_copy;
+              attr_copy_state->data_size += varlen_size;
+              attr_copy_state->validity_size += validitylen_size;
+              // Set whether the extra offset was included or not
+              attr_copy_state->last_query_added_extra_offset =
+                  query_reader.getVarOffsetsAddExtraElement();
             }
           } else {
-            // Accumulate total bytes copied (caller's responsibility to
-            // eventually update the query).
-            attr_copy_state->offset_size += fixedlen_size_to_copy;
-            attr_copy_state->data_size += varlen_size;
-            attr_copy_state->validity_size += validitylen_size;
-            // Set whether the extra offset was included or not
-            attr_copy_state->last_query_added_extra_offset =
-                query_reader.getVarOffsetsAddExtraElement();
-          }
-        } else {
-          // Fixed size attribute; buffers already set.
-          char* data_dest = (char*)existing_buffer + curr_data_size;
-
-          std::memcpy(data_dest, attribute_buffer_start, fixedlen_size);
-          attribute_buffer_start += fixedlen_size;
-          if (nullable) {
-            char* validity_dest =
-                (char*)existing_validity_buffer + curr_validity_size;
-            std::memcpy(
-                validity_dest, attribute_buffer_start, validitylen_size);
-            attribute_buffer_start += validitylen_size;
-          }
+            // Fixed size attribute; buffers already set.
+            char* data_dest = (char*)existing_buffer + curr_data_size;
 
-          // attr_copy_state==nulptr models the case of deserialization code
-          // being called via the C API tiledb_query_deserialize (e.g. unit
-          // test serialization wrappers).
-          // When a rest_client exists, there is always a non null copy_state
-          // incoming argument from which attr_copy_state is initialized
-          if (attr_copy_state == nullptr) {
-            // Set the size directly on the query (so user can introspect on
-            // result size).
-            // Subsequent incomplete submits will use the original buffer
-            // sizes members from the query in the beginning of the loop
-            // to calculate if user buffers have enough space to hold the
-            // data, here we only care that after data received from the wire
-            // is copied within the user buffers, the buffer sizes are
-            // accurate so user can introspect.
-            *query_buffer.buffer_size_ = curr_data_size + fixedlen_size;
+            std::memcpy(data_dest, attribute_buffer_start, fixedlen_size);
+            attribute_buffer_start += fixedlen_size;
             if (nullable) {
-              *query_buffer.validity_vector_.buffer_size() =
-                  curr_validity_size + validitylen_size;
+              char* validity_dest =
+                  (char*)existing_validity_buffer + curr_validity_size;
+              std::memcpy(
+                  validity_dest, attribute_buffer_start, validitylen_size);
+              attribute_buffer_start += validitylen_size;
+            }
+
+            // attr_copy_state==nulptr models the case of deserialization code
+            // being called via the C API tiledb_query_deserialize (e.g. unit
+            // test serialization wrappers).
+            // When a rest_client exists, there is always a non null copy_state
+            // incoming argument from which attr_copy_state is initialized
+            if (attr_copy_state == nullptr) {
+              // Set the size directly on the query (so user can introspect on
+              // result size).
+              // Subsequent incomplete submits will use the original buffer
+              // sizes members from the query in the beginning of the loop
+              // to calculate if user buffers have enough space to hold the
+              // data, here we only care that after data received from the wire
+              // is copied within the user buffers, the buffer sizes are
+              // accurate so user can introspect.
+              *query_buffer.buffer_size_ = curr_data_size + fixedlen_size;
+              if (nullable) {
+                *query_buffer.validity_vector_.buffer_size() =
+                    curr_validity_size + validitylen_size;
+              }
+            } else {
+              attr_copy_state->data_size += fixedlen_size;
+              if (nullable)
+                attr_copy_state->validity_size += validitylen_size;
             }
-          } else {
-            attr_copy_state->data_size += fixedlen_size;
-            if (nullable)
-              attr_copy_state->validity_size += validitylen_size;
           }
+
+          return Status::Ok();
+        }));
+
+        // Advance the cursor past this attribute's region; the task above
+        // advances only its own copy of it.
+        attribute_buffer_start += fixedlen_size;
+        if (var_size) {
+          attribute_buffer_start += varlen_size;
+        }
+        if (nullable) {
+          attribute_buffer_start += validitylen_size;
         }
       }
       // Nothing to do for writes on client side.
@@ -2154,6 +2200,13 @@ Status query_from_capnp(
     }
   }
 
+  // Wait for the outstanding client-side buffer copies.
+  if (!copy_tasks.empty()) {
+    const auto st = compute_tp->wait_all(copy_tasks);
+    copy_tasks.clear();
+    RETURN_NOT_OK(st);
+  }
+
   // Deserialize reader/writer.
   // Also set subarray on query if it exists. Prior to 1.8 the subarray was set
   // on the reader or writer directly Now we set it on the query class after the
@@ -2844,6 +2897,129 @@ Status query_est_result_size_deserialize(
   return Status::Ok();
 }
 
+Status global_write_state_serialize(
+    Query* query,
+    SerializationType serialize_type,
+    Buffer* serialized_buffer) {
+  auto global_writer = dynamic_cast<GlobalOrderWriter*>(query->strategy());
+  if (global_writer == nullptr ||
+      global_writer->get_global_state() == nullptr) {
+    return LOG_STATUS(Status_SerializationError(
+        "Cannot serialize global write state; Query is not an initialized "
+        "global order write."));
+  }
+
+  try {
+    ::capnp::MallocMessageBuilder message;
+    capnp::GlobalWriteState::Builder state_builder =
+        message.initRoot<capnp::GlobalWriteState>();
+    RETURN_NOT_OK(global_write_state_to_capnp(
+        *query, *global_writer, &state_builder, false));
+
+    switch (serialize_type) {
+      case SerializationType::JSON: {
+        ::capnp::JsonCodec json;
+        kj::String capnp_json = json.encode(state_builder);
+        const auto json_len = capnp_json.size();
+        const char nul = '\0';
+        // size does not include needed null terminator, so add +1
+        RETURN_NOT_OK(serialized_buffer->realloc(json_len + 1));
+        RETURN_NOT_OK(serialized_buffer->write(capnp_json.cStr(), json_len));
+        RETURN_NOT_OK(serialized_buffer->write(&nul, 1));
+        break;
+      }
+      case SerializationType::CAPNP: {
+        kj::Array<::capnp::word> protomessage = messageToFlatArray(message);
+        kj::ArrayPtr<const char> message_chars = protomessage.asChars();
+
+        // Write the serialized global write state
+        const auto nbytes = message_chars.size();
+        RETURN_NOT_OK(serialized_buffer->realloc(nbytes));
+        RETURN_NOT_OK(serialized_buffer->write(message_chars.begin(), nbytes));
+        break;
+      }
+      default:
+        return LOG_STATUS(Status_SerializationError(
+            "Cannot serialize; unknown serialization type"));
+    }
+  } catch (kj::Exception& e) {
+    return LOG_STATUS(Status_SerializationError(
+        "Error serializing global write state; kj::Exception: " +
+        std::string(e.getDescription().cStr())));
+  } catch (std::exception& e) {
+    return LOG_STATUS(Status_SerializationError(
+        "Error serializing global write state; exception: " +
+        std::string(e.what())));
+  }
+
+  return Status::Ok();
+}
+
+Status global_write_state_deserialize(
+    Query* query,
+    SerializationType serialize_type,
+    const Buffer& serialized_buffer) {
+  auto global_writer = dynamic_cast<GlobalOrderWriter*>(query->strategy());
+  if (global_writer == nullptr) {
+    return LOG_STATUS(Status_SerializationError(
+        "Cannot deserialize global write state; Query is not a global order "
+        "write."));
+  }
+
+  // The write state is allocated on the first submission; a checkpoint may
+  // only be restored into a query that has not written any data yet.
+  if (global_writer->get_global_state() == nullptr) {
+    RETURN_NOT_OK(global_writer->alloc_global_write_state());
+    RETURN_NOT_OK(global_writer->init_global_write_state());
+  }
+
+  try {
+    switch (serialize_type) {
+      case SerializationType::JSON: {
+        ::capnp::JsonCodec json;
+        ::capnp::MallocMessageBuilder message_builder;
+        capnp::GlobalWriteState::Builder state_builder =
+            message_builder.initRoot<capnp::GlobalWriteState>();
+        json.decode(
+            kj::StringPtr(static_cast<const char*>(serialized_buffer.data())),
+            state_builder);
+        capnp::GlobalWriteState::Reader state_reader =
+            state_builder.asReader();
+        RETURN_NOT_OK(global_write_state_from_capnp(
+            *query, state_reader, global_writer, SerializationContext::BACKUP));
+        break;
+      }
+      case SerializationType::CAPNP: {
+        const auto mBytes =
+            reinterpret_cast<const kj::byte*>(serialized_buffer.data());
+        ::capnp::FlatArrayMessageReader reader(kj::arrayPtr(
+            reinterpret_cast<const ::capnp::word*>(mBytes),
+            serialized_buffer.size() / sizeof(::capnp::word)));
+        capnp::GlobalWriteState::Reader state_reader =
+            reader.getRoot<capnp::GlobalWriteState>();
+        RETURN_NOT_OK(global_write_state_from_capnp(
+            *query, state_reader, global_writer, SerializationContext::BACKUP));
+        break;
+      }
+      default: {
+        return LOG_STATUS(Status_SerializationError(
+            "Error deserializing global write state; Unknown serialization "
+            "type passed"));
+      }
+    }
+  } catch (kj::Exception& e) {
+    return LOG_STATUS(Status_SerializationError(
+        "Error deserializing global write state; kj::Exception: " +
+        std::string(e.getDescription().cStr())));
+  } catch (std::exception& e) {
+    return LOG_STATUS(Status_SerializationError(
+        "Error deserializing global write state; exception " +
+        std::string(e.what())));
+  }
+
+  return Status::Ok();
+}
+
 Status global_write_state_to_capnp(
     const Query& query,
     GlobalOrderWriter& global_writer,
@@ -3226,6 +3402,17 @@ Status query_est_result_size_deserialize(
       "Cannot deserialize; serialization not enabled."));
 }
 
+Status global_write_state_serialize(Query*, SerializationType, Buffer*) {
+  return LOG_STATUS(Status_SerializationError(
+      "Cannot serialize; serialization not enabled."));
+}
+
+Status global_write_state_deserialize(
+    Query*, SerializationType, const Buffer&) {
+  return LOG_STATUS(Status_SerializationError(
+      "Cannot deserialize; serialization not enabled."));
+}
+
 #endif  // TILEDB_SERIALIZATION
 
 }  // namespace serialization
@@ -164,6 +164,12 @@ Status query_serialize(
  * information (read state, attribute data, query status, etc) and updates the
  * given query to be equivalent to the serialized query.
  *
+ * On the server side for write queries, the attribute data concatenated
+ * after the capnp message is not copied: the query's buffers are set to
+ * point directly into `serialized_buffer`, which must therefore outlive
+ * the query. On the client side for read queries, attribute data is
+ * copied into the user-set buffers.
+ *
  * @param serialized_buffer Buffer containing serialized query
  * @param serialize_type Serialization type of serialized query
  * @param clientside Whether deserialization should be performed from a client
@@ -212,6 +218,34 @@ Status query_est_result_size_deserialize(
     bool clientside,
     const Buffer& serialized_buffer);
 
+/**
+ * Serialize the global write state of an in-progress global order write,
+ * including the fragment metadata progress and any cloud multipart upload
+ * state. The buffer can be persisted as a checkpoint and later restored
+ * into a fresh query by a new process to resume appending to the same
+ * fragment.
+ *
+ * @param query Query whose strategy is an initialized global order writer.
+ * @param serialize_type Format to serialize to.
+ * @param serialized_buffer Buffer to store the serialized state.
+ */
+Status global_write_state_serialize(
+    Query* query, SerializationType serialize_type, Buffer* serialized_buffer);
+
+/**
+ * Deserialize a global write state checkpoint into a query, resuming the
+ * fragment the state was captured from. The query must be a global order
+ * write on the same array with no data submitted through it yet.
+ *
+ * @param query Query to restore the state into.
+ * @param serialize_type Serialization type of the serialized state.
+ * @param serialized_buffer Buffer containing the serialized state.
+ */
+Status global_write_state_deserialize(
+    Query* query,
+    SerializationType serialize_type,
+    const Buffer& serialized_buffer);
+
 #ifdef TILEDB_SERIALIZATION
 
 enum class SerializationContext { CLIENT, SERVER, BACKUP };
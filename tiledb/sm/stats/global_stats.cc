@@ -32,6 +32,7 @@
 
 #include "tiledb/sm/stats/global_stats.h"
 
+#include <algorithm>
 #include <cassert>
 #include <sstream>
 
@@ -83,6 +84,52 @@ void GlobalStats::raw_dump(std::string* out) const {
   *out = dump_registered_stats();
 }
 
+void GlobalStats::dump_trace(FILE* out) const {
+  if (out == nullptr)
+    out = stdout;
+
+  std::string output;
+  GlobalStats::dump_trace(&output);
+  fprintf(out, "%s", output.c_str());
+}
+
+void GlobalStats::dump_trace(std::string* out) const {
+  // Gather the trace events of all registered stats and sort them by
+  // start timestamp so the output is stable across dumps.
+  std::vector<TraceEvent> events;
+  iterate([&](Stats& stat) { stat.populate_trace_events(&events); });
+  std::sort(
+      events.begin(),
+      events.end(),
+      [](const TraceEvent& a, const TraceEvent& b) -> bool {
+        return a.timestamp_us != b.timestamp_us ?
+                   a.timestamp_us < b.timestamp_us :
+                   a.name < b.name;
+      });
+
+  // Emit complete ("X") events in the Chrome trace event format, which
+  // both chrome://tracing and Perfetto can load directly.
+  std::stringstream ss;
+  ss << "{\"traceEvents\": [\n";
+  bool printed_first_event = false;
+  for (const auto& event : events) {
+    if (printed_first_event) {
+      ss << ",\n";
+    }
+    ss << "  {\"name\": \"" << event.name << "\", \"cat\": \"tiledb\", "
+       << "\"ph\": \"X\", \"pid\": 0, \"tid\": " << event.thread_id
+       << ", \"ts\": " << event.timestamp_us
+       << ", \"dur\": " << event.duration_us << "}";
+    printed_first_event = true;
+  }
+  if (printed_first_event) {
+    ss << "\n";
+  }
+  ss << "]}\n";
+
+  *out = ss.str();
+}
+
 void GlobalStats::set_enabled(bool enabled) {
   enabled_ = enabled;
 }
@@ -111,6 +111,18 @@ class GlobalStats {
   /** Dump the current raw stats to the given string as a JSON. */
   void raw_dump(std::string* out) const;
 
+  /**
+   * Dump the trace events of all registered stats to the given file as
+   * Chrome trace JSON.
+   */
+  void dump_trace(FILE* out) const;
+
+  /**
+   * Dump the trace events of all registered stats to the given string as
+   * Chrome trace JSON.
+   */
+  void dump_trace(std::string* out) const;
+
  private:
   /* ****************************** */
   /*       PRIVATE DATATYPES        */
@@ -49,6 +49,7 @@ namespace stats {
 
 Stats::Stats(const std::string& prefix)
     : enabled_(true)
+    , trace_enabled_(false)
     , prefix_(prefix + ".")
     , parent_(nullptr) {
 }
@@ -65,6 +66,32 @@ void Stats::set_enabled(bool enabled) {
   enabled_ = enabled;
 }
 
+bool Stats::trace_enabled() const {
+  return trace_enabled_;
+}
+
+void Stats::set_trace_enabled(bool trace_enabled) {
+  std::unique_lock<std::mutex> lck(mtx_);
+  trace_enabled_ = trace_enabled;
+  for (auto& child : children_) {
+    child.set_trace_enabled(trace_enabled);
+  }
+}
+
+void Stats::populate_trace_events(std::vector<TraceEvent>* events) const {
+  std::unique_lock<std::mutex> lck(mtx_);
+
+  for (auto& shard : shards_) {
+    std::unique_lock<std::mutex> shard_lck(shard.mtx_);
+    events->insert(
+        events->end(), shard.trace_events_.begin(), shard.trace_events_.end());
+  }
+
+  for (const auto& child : children_) {
+    child.populate_trace_events(events);
+  }
+}
+
 void Stats::reset() {
   // We will acquire the locks top-down in the tree and hold
   // until the recursion terminates.
@@ -73,6 +100,13 @@ void Stats::reset() {
   timers_.clear();
   counters_.clear();
 
+  for (auto& shard : shards_) {
+    std::unique_lock<std::mutex> shard_lck(shard.mtx_);
+    shard.timers_.clear();
+    shard.counters_.clear();
+    shard.trace_events_.clear();
+  }
+
   for (auto& child : children_) {
     child.reset();
   }
@@ -178,13 +212,12 @@ void Stats::add_counter(const std::string& stat, uint64_t count) {
   }
 
   std::string new_stat = prefix_ + stat;
-  std::unique_lock<std::mutex> lck(mtx_);
-  auto it = counters_.find(new_stat);
-  if (it == counters_.end()) {  // Counter not found
-    counters_[new_stat] = count;
-  } else {  // Counter found
-    it->second += count;
-  }
+
+  // Update only the calling thread's shard so that concurrent updates
+  // from different threads do not contend on a single mutex.
+  auto& shard = this->shard();
+  std::unique_lock<std::mutex> lck(shard.mtx_);
+  shard.counters_[new_stat] += count;
 }
 
 DurationInstrument<Stats> Stats::start_timer(const std::string& stat) {
@@ -198,31 +231,35 @@ void Stats::report_duration(
   }
 
   std::string new_stat = prefix_ + stat;
-  std::unique_lock<std::mutex> lck(mtx_);
+  auto& shard = this->shard();
+  std::unique_lock<std::mutex> lck(shard.mtx_);
 
   // Add duration to timer total
-  auto it2 = timers_.find(new_stat + ".sum");
-  if (it2 == timers_.end()) {  // Timer not found
-    timers_[new_stat + ".sum"] = duration.count();
-  } else {  // Timer found
-    it2->second += duration.count();
-  }
+  shard.timers_[new_stat + ".sum"] += duration.count();
 
   // Add duration to timer max
-  auto it3 = timers_.find(new_stat + ".max");
-  if (it3 == timers_.end()) {  // Timer not found
-    timers_[new_stat + ".max"] = duration.count();
-  } else {  // Timer found
-    if (duration.count() > it3->second)
-      it3->second = duration.count();
+  auto& max = shard.timers_[new_stat + ".max"];
+  if (duration.count() > max) {
+    max = duration.count();
   }
 
   // Increment the timer counter
-  auto it4 = counters_.find(new_stat + ".timer_count");
-  if (it4 == counters_.end()) {  // Timer not found
-    counters_[new_stat + ".timer_count"] = 1;
-  } else {  // Timer found
-    it4->second += 1;
+  shard.counters_[new_stat + ".timer_count"] += 1;
+
+  // Record a timestamped span when tracing is enabled. The start time is
+  // recovered from the current time and the duration; the skew from the
+  // map updates above is negligible at microsecond granularity.
+  if (trace_enabled_) {
+    const uint64_t end_us =
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::high_resolution_clock::now().time_since_epoch())
+            .count();
+    const uint64_t dur_us = static_cast<uint64_t>(duration.count() * 1e6);
+    shard.trace_events_.emplace_back(TraceEvent{
+        new_stat,
+        end_us - std::min(dur_us, end_us),
+        dur_us,
+        std::hash<std::thread::id>()(std::this_thread::get_id())});
   }
 }
 
@@ -250,6 +287,7 @@ Stats* Stats::create_child(const std::string& prefix) {
   children_.emplace_back(prefix_ + prefix);
   Stats* const child = &children_.back();
   child->parent_ = this;
+  child->trace_enabled_ = trace_enabled_;
   return child;
 }
 
@@ -266,18 +304,60 @@ void Stats::populate_flattened_stats(
   for (const auto& counter : counters_)
     (*flattened_counters)[counter.first] += counter.second;
 
+  // Append the pending stats from the update shards, without clearing
+  // them, so that this routine can remain const.
+  for (auto& shard : shards_) {
+    std::unique_lock<std::mutex> shard_lck(shard.mtx_);
+    for (const auto& timer : shard.timers_) {
+      if (utils::parse::ends_with(timer.first, ".max")) {
+        auto& max = (*flattened_timers)[timer.first];
+        max = std::max(max, timer.second);
+      } else {
+        (*flattened_timers)[timer.first] += timer.second;
+      }
+    }
+    for (const auto& counter : shard.counters_)
+      (*flattened_counters)[counter.first] += counter.second;
+  }
+
   // Populate the stats from all of the children.
   for (const auto& child : children_) {
     child.populate_flattened_stats(flattened_timers, flattened_counters);
   }
 }
 
+Stats::StatsShard& Stats::shard() const {
+  return shards_[std::hash<std::thread::id>()(std::this_thread::get_id()) %
+                 num_shards_];
+}
+
+void Stats::merge_shards() {
+  std::unique_lock<std::mutex> lck(mtx_);
+  for (auto& shard : shards_) {
+    std::unique_lock<std::mutex> shard_lck(shard.mtx_);
+    for (const auto& timer : shard.timers_) {
+      if (utils::parse::ends_with(timer.first, ".max")) {
+        auto& max = timers_[timer.first];
+        max = std::max(max, timer.second);
+      } else {
+        timers_[timer.first] += timer.second;
+      }
+    }
+    for (const auto& counter : shard.counters_)
+      counters_[counter.first] += counter.second;
+    shard.timers_.clear();
+    shard.counters_.clear();
+  }
+}
+
 std::unordered_map<std::string, double>* Stats::timers() {
+  merge_shards();
   return &timers_;
 }
 
 /** Return pointer to conters map, used for serialization only. */
 std::unordered_map<std::string, uint64_t>* Stats::counters() {
+  merge_shards();
   return &counters_;
 }
 
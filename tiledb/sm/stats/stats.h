@@ -36,6 +36,7 @@
 #include "duration_instrument.h"
 
 #include <inttypes.h>
+#include <array>
 #include <chrono>
 #include <iomanip>
 #include <iostream>
@@ -51,6 +52,25 @@ namespace tiledb {
 namespace sm {
 namespace stats {
 
+/**
+ * A single completed timer span, recorded when tracing is enabled.
+ * Timestamps and durations are expressed in microseconds, matching the
+ * Chrome trace event format.
+ */
+struct TraceEvent {
+  /** The full (prefixed) name of the timer stat. */
+  std::string name;
+
+  /** The start timestamp of the span, in microseconds. */
+  uint64_t timestamp_us;
+
+  /** The duration of the span, in microseconds. */
+  uint64_t duration_us;
+
+  /** A hash of the id of the thread that recorded the span. */
+  uint64_t thread_id;
+};
+
 /**
  * Class that defines stats counters and methods to manipulate them.
  */
@@ -98,6 +118,22 @@ class Stats {
   /** Enable or disable statistics gathering. */
   void set_enabled(bool enabled);
 
+  /** Returns true if timer spans are currently being traced. */
+  bool trace_enabled() const;
+
+  /**
+   * Enable or disable tracing of timer spans on this instance and all of
+   * its existing children. Children created afterwards inherit the
+   * setting from their parent.
+   */
+  void set_trace_enabled(bool trace_enabled);
+
+  /**
+   * Appends the trace events recorded by this instance and all of its
+   * children to the input vector, without clearing them.
+   */
+  void populate_trace_events(std::vector<TraceEvent>* events) const;
+
   /** Reset all stats. */
   void reset();
 
@@ -127,12 +163,41 @@ class Stats {
   /*       PRIVATE ATTRIBUTES       */
   /* ****************************** */
 
+  /**
+   * Counter and timer updates are striped over a fixed number of shards,
+   * selected by the id of the updating thread, so that hot-loop updates
+   * from different threads do not contend on a single mutex. The shards
+   * are merged lazily when the stats are read.
+   */
+  struct StatsShard {
+    /** Protects the shard maps. */
+    std::mutex mtx_;
+
+    /** Timer stats accumulated by the threads mapped to this shard. */
+    std::unordered_map<std::string, double> timers_;
+
+    /** Counter stats accumulated by the threads mapped to this shard. */
+    std::unordered_map<std::string, uint64_t> counters_;
+
+    /** Timer spans recorded by the threads mapped to this shard. */
+    std::vector<TraceEvent> trace_events_;
+  };
+
+  /** The number of shards counter and timer updates are striped over. */
+  static constexpr size_t num_shards_ = 16;
+
   /** Mutex. */
   mutable std::mutex mtx_;
 
+  /** The update shards, indexed by a hash of the updating thread's id. */
+  mutable std::array<StatsShard, num_shards_> shards_;
+
   /** True if stats are being gathered. */
   bool enabled_;
 
+  /** True if timer spans are being recorded as trace events. */
+  bool trace_enabled_;
+
   /** A map of timer stats measuring time in seconds. */
   std::unordered_map<std::string, double> timers_;
 
@@ -159,6 +224,16 @@ class Stats {
   void report_duration(
       const std::string& stat, const std::chrono::duration<double> duration);
 
+  /** Returns the update shard of the calling thread. */
+  StatsShard& shard() const;
+
+  /**
+   * Merges all update shards into `timers_` and `counters_` and clears
+   * them. Called before handing out direct references to the maps. The
+   * `mtx_` must be unlocked when entering this routine.
+   */
+  void merge_shards();
+
   /**
    * Populates the input stats with the instance stats. This is a
    * recursive work routine that `dump()` uses to aggregate all stats
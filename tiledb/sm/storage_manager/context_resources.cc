@@ -31,6 +31,7 @@
  */
 
 #include "tiledb/sm/storage_manager/context_resources.h"
+#include "tiledb/common/dynamic_memory/huge_page_memory.h"
 #include "tiledb/sm/rest/rest_client.h"
 
 using namespace tiledb::common;
@@ -55,15 +56,48 @@ ContextResources::ContextResources(
     std::string stats_name)
     : config_(config)
     , logger_(logger)
-    , compute_tp_(compute_thread_count)
-    , io_tp_(io_thread_count)
+    , compute_tp_(
+          compute_thread_count,
+          config.get<bool>("sm.numa.pin_threads", Config::must_find))
+    , io_tp_(
+          io_thread_count,
+          config.get<bool>("sm.numa.pin_threads", Config::must_find))
     , stats_(make_shared<stats::Stats>(HERE(), stats_name))
-    , vfs_(stats_.get(), &compute_tp_, &io_tp_, config) {
+    , vfs_(stats_.get(), &compute_tp_, &io_tp_, config)
+    , tile_cache_(
+          config.get<uint64_t>("sm.tile_cache_size", Config::must_find))
+    , fragment_footer_cache_(config.get<uint64_t>(
+          "sm.fragment_footer_cache_size", Config::must_find))
+    , group_details_cache_(config.get<uint64_t>(
+          "sm.group_details_cache_size", Config::must_find))
+    , enumeration_cache_(config.get<uint64_t>(
+          "sm.enumeration_cache_size", Config::must_find))
+    , deletion_vector_cache_(config.get<uint64_t>(
+          "sm.deletion_vector_cache_size", Config::must_find))
+    , array_schema_cache_(config.get<uint64_t>(
+          "sm.array_schema_cache_size", Config::must_find))
+    , array_schema_registry_(config.get<bool>(
+          "sm.array_schema_registry.enable", Config::must_find))
+    , query_result_cache_(config.get<uint64_t>(
+          "sm.query_result_cache_size", Config::must_find))
+    , query_profile_registry_(config.get<bool>(
+          "sm.query.profile_guided.enable", Config::must_find)) {
   /*
    * Explicitly register our `stats` object with the global.
    */
   stats::all_stats.register_stats(stats_);
 
+  // Huge page hints for large tile buffers are a process wide kernel
+  // setting, so the last created context wins.
+  tdb_hugepage_enable(config_.get<bool>("sm.mem.hugepages", Config::must_find));
+
+  // Cap the combined memory usage of this context, if a budget was set.
+  auto context_budget =
+      config_.get<uint64_t>("sm.mem.context_budget", Config::must_find);
+  if (context_budget != 0) {
+    memory_tracker_.set_budget(context_budget);
+  }
+
   if (!logger_) {
     throw std::logic_error("Logger must not be nullptr");
   }
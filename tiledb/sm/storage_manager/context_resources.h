@@ -35,9 +35,19 @@
 
 #include "tiledb/common/exception/exception.h"
 #include "tiledb/common/logger_public.h"
+#include "tiledb/common/memory_tracker.h"
 #include "tiledb/common/thread_pool/thread_pool.h"
+#include "tiledb/sm/array_schema/array_schema_registry.h"
+#include "tiledb/sm/cache/array_schema_cache.h"
+#include "tiledb/sm/cache/deletion_vector_cache.h"
+#include "tiledb/sm/cache/enumeration_cache.h"
+#include "tiledb/sm/cache/fragment_footer_cache.h"
+#include "tiledb/sm/cache/group_details_cache.h"
+#include "tiledb/sm/cache/query_result_cache.h"
+#include "tiledb/sm/cache/unfiltered_tile_cache.h"
 #include "tiledb/sm/config/config.h"
 #include "tiledb/sm/filesystem/vfs.h"
+#include "tiledb/sm/query/query_profile_registry.h"
 #include "tiledb/sm/stats/global_stats.h"
 
 using namespace tiledb::common;
@@ -105,10 +115,65 @@ class ContextResources {
     return vfs_;
   }
 
+  /** Returns the unfiltered tile cache shared by all queries. */
+  [[nodiscard]] inline UnfilteredTileCache& tile_cache() const {
+    return tile_cache_;
+  }
+
+  /** Returns the fragment footer cache shared by all array opens. */
+  [[nodiscard]] inline FragmentFooterCache& fragment_footer_cache() const {
+    return fragment_footer_cache_;
+  }
+
+  /** Returns the group details cache shared by all group opens. */
+  [[nodiscard]] inline GroupDetailsCache& group_details_cache() const {
+    return group_details_cache_;
+  }
+
+  /** Returns the deletion vector cache shared by all queries. */
+  [[nodiscard]] inline DeletionVectorCache& deletion_vector_cache() const {
+    return deletion_vector_cache_;
+  }
+
+  /** Returns the enumeration cache shared by all array opens. */
+  [[nodiscard]] inline EnumerationCache& enumeration_cache() const {
+    return enumeration_cache_;
+  }
+
+  /** Returns the array schema cache shared by all array opens. */
+  [[nodiscard]] inline ArraySchemaCache& array_schema_cache() const {
+    return array_schema_cache_;
+  }
+
+  /** Returns the array schema registry shared by all array opens. */
+  [[nodiscard]] inline ArraySchemaRegistry& array_schema_registry() const {
+    return array_schema_registry_;
+  }
+
+  /** Returns the query result cache shared by all queries. */
+  [[nodiscard]] inline QueryResultCache& query_result_cache() const {
+    return query_result_cache_;
+  }
+
+  /** Returns the query profile registry shared by all queries. */
+  [[nodiscard]] inline QueryProfileRegistry& query_profile_registry() const {
+    return query_profile_registry_;
+  }
+
   [[nodiscard]] inline shared_ptr<RestClient> rest_client() const {
     return rest_client_;
   }
 
+  /**
+   * Returns the context level memory tracker. It is the root of the
+   * tracker hierarchy: array and query trackers link it as their parent so
+   * that `sm.mem.context_budget` caps the combined usage of everything
+   * running on the context.
+   */
+  [[nodiscard]] inline MemoryTracker& memory_tracker() const {
+    return memory_tracker_;
+  }
+
  private:
   /* ********************************* */
   /*         PRIVATE ATTRIBUTES        */
@@ -135,8 +200,69 @@ class ContextResources {
    */
   mutable VFS vfs_;
 
+  /**
+   * Cache of unfiltered tile payloads shared by all queries on this
+   * context, sized by `sm.tile_cache_size`.
+   */
+  mutable UnfilteredTileCache tile_cache_;
+
+  /**
+   * Cache of fragment metadata footers shared by all array opens on this
+   * context, sized by `sm.fragment_footer_cache_size`.
+   */
+  mutable FragmentFooterCache fragment_footer_cache_;
+
+  /**
+   * Cache of group details file contents shared by all group opens on
+   * this context, sized by `sm.group_details_cache_size`.
+   */
+  mutable GroupDetailsCache group_details_cache_;
+
+  /**
+   * Cache of loaded enumerations shared by all array opens on this
+   * context, sized by `sm.enumeration_cache_size`.
+   */
+  mutable EnumerationCache enumeration_cache_;
+
+  /**
+   * Cache of materialized per-tile delete condition verdicts shared by
+   * all queries on this context, sized by
+   * `sm.deletion_vector_cache_size`.
+   */
+  mutable DeletionVectorCache deletion_vector_cache_;
+
+  /**
+   * Cache of array schema file contents shared by all array opens on
+   * this context, sized by `sm.array_schema_cache_size`.
+   */
+  mutable ArraySchemaCache array_schema_cache_;
+
+  /**
+   * Registry of deserialized array schemas shared by all array opens on
+   * this context, enabled by `sm.array_schema_registry.enable`.
+   */
+  mutable ArraySchemaRegistry array_schema_registry_;
+
+  /**
+   * Cache of read query results shared by all queries on this context,
+   * sized by `sm.query_result_cache_size`.
+   */
+  mutable QueryResultCache query_result_cache_;
+
+  /**
+   * Registry of read query execution profiles shared by all queries on
+   * this context, enabled by `sm.query.profile_guided.enable`.
+   */
+  mutable QueryProfileRegistry query_profile_registry_;
+
   /** The rest client (may be null if none was configured). */
   shared_ptr<RestClient> rest_client_;
+
+  /**
+   * Context level memory tracker, budgeted by `sm.mem.context_budget`
+   * when set.
+   */
+  mutable MemoryTracker memory_tracker_;
 };
 
 }  // namespace tiledb::sm
@@ -42,11 +42,13 @@
 #include "tiledb/common/logger.h"
 #include "tiledb/common/memory.h"
 #include "tiledb/common/stdx_string.h"
+#include "tiledb/common/trace_ring.h"
 #include "tiledb/sm/array/array.h"
 #include "tiledb/sm/array/array_directory.h"
 #include "tiledb/sm/array_schema/array_schema.h"
 #include "tiledb/sm/array_schema/array_schema_evolution.h"
 #include "tiledb/sm/array_schema/enumeration.h"
+#include "tiledb/sm/cache/group_details_cache.h"
 #include "tiledb/sm/consolidator/consolidator.h"
 #include "tiledb/sm/consolidator/fragment_consolidator.h"
 #include "tiledb/sm/enums/array_type.h"
@@ -94,6 +96,7 @@ StorageManagerCanonical::StorageManagerCanonical(
     : resources_(resources)
     , logger_(logger)
     , cancellation_in_progress_(false)
+    , cancellation_token_(make_shared<ThreadPool::CancellationToken>(HERE()))
     , config_(config)
     , queries_in_progress_(0) {
   /*
@@ -109,6 +112,18 @@ Status StorageManagerCanonical::init() {
 
   RETURN_NOT_OK(set_default_tags());
 
+  // Turn on the process-wide trace ring if requested; it stays enabled for
+  // the lifetime of the process so that hot-path trace points keep their
+  // fixed, formatting-free cost.
+  bool found = false;
+  bool trace_ring_enabled = false;
+  RETURN_NOT_OK(config_.get<bool>(
+      "sm.trace_ring.enabled", &trace_ring_enabled, &found));
+  assert(found);
+  if (trace_ring_enabled) {
+    common::TraceRing::instance().set_enabled(true);
+  }
+
   global_state.register_storage_manager(this);
 
   return Status::Ok();
@@ -117,6 +132,16 @@ Status StorageManagerCanonical::init() {
 StorageManagerCanonical::~StorageManagerCanonical() {
   global_state::GlobalState::GetGlobalState().unregister_storage_manager(this);
 
+  // Batched fragment commits are normally flushed on array close; make a
+  // last effort for arrays that were never closed so their fragments are
+  // not lost, but never throw from the destructor.
+  try {
+    flush_all_fragment_commits();
+  } catch (const std::exception& e) {
+    LOG_STATUS_NO_RETURN_VALUE(Status_StorageManagerError(
+        std::string("Failed to flush batched fragment commits: ") + e.what()));
+  }
+
   throw_if_not_ok(cancel_all_tasks());
 
   bool found{false};
@@ -344,6 +369,72 @@ void StorageManagerCanonical::write_consolidated_commits_file(
   throw_if_not_ok(vfs()->close_file(consolidated_commits_uri));
 }
 
+void StorageManagerCanonical::commit_fragment(
+    format_version_t write_version,
+    const ArrayDirectory& array_dir,
+    const URI& commit_uri) {
+  const auto batch_size =
+      config_.get<uint64_t>("sm.commit_batch_size", Config::must_find);
+  if (batch_size <= 1) {
+    throw_if_not_ok(vfs()->touch(commit_uri));
+    return;
+  }
+
+  // Buffer the commit, extracting a full batch under the lock but writing
+  // it outside so the storage request does not serialize other commits.
+  std::vector<URI> batch;
+  {
+    std::lock_guard<std::mutex> lock{pending_commits_mtx_};
+    auto it = pending_commits_.find(array_dir.uri().to_string());
+    if (it == pending_commits_.end()) {
+      it = pending_commits_
+               .emplace(
+                   array_dir.uri().to_string(),
+                   PendingCommits{write_version, array_dir, {}})
+               .first;
+    }
+    it->second.commit_uris_.emplace_back(commit_uri);
+    if (it->second.commit_uris_.size() < batch_size) {
+      return;
+    }
+    batch = std::move(it->second.commit_uris_);
+    pending_commits_.erase(it);
+  }
+
+  write_consolidated_commits_file(write_version, array_dir, batch);
+}
+
+void StorageManagerCanonical::flush_fragment_commits(const URI& array_uri) {
+  optional<PendingCommits> pending;
+  {
+    std::lock_guard<std::mutex> lock{pending_commits_mtx_};
+    auto it = pending_commits_.find(array_uri.to_string());
+    if (it == pending_commits_.end()) {
+      return;
+    }
+    pending = std::move(it->second);
+    pending_commits_.erase(it);
+  }
+
+  write_consolidated_commits_file(
+      pending->write_version_, pending->array_dir_, pending->commit_uris_);
+}
+
+void StorageManagerCanonical::flush_all_fragment_commits() {
+  std::unordered_map<std::string, PendingCommits> pending;
+  {
+    std::lock_guard<std::mutex> lock{pending_commits_mtx_};
+    pending = std::move(pending_commits_);
+    pending_commits_.clear();
+  }
+
+  for (auto& entry : pending) {
+    auto& commits = entry.second;
+    write_consolidated_commits_file(
+        commits.write_version_, commits.array_dir_, commits.commit_uris_);
+  }
+}
+
 void StorageManagerCanonical::delete_array(const char* array_name) {
   if (array_name == nullptr) {
     throw std::invalid_argument("[delete_array] Array name cannot be null");
@@ -676,6 +767,14 @@ Status StorageManager::array_evolve_schema(
         "Cannot evolve schema;  Not able to store evolved array schema."));
   }
 
+  // Intern the evolved schema so that subsequent opens of the array reuse
+  // the in-memory instance instead of reading the new schema file back.
+  auto& registry = resources().array_schema_registry();
+  if (registry.enabled()) {
+    registry.put_if_absent(
+        array_schema_evolved->uri().to_string(), array_schema_evolved);
+  }
+
   return Status::Ok();
 }
 
@@ -1090,6 +1189,10 @@ Status StorageManagerCanonical::cancel_all_tasks() {
 
   // Handle the cancellation.
   if (handle_cancel) {
+    // Stop the parallel loops and VFS reads of in-progress queries at
+    // their next cancellation poll.
+    cancellation_token_->cancel();
+
     // Cancel any queued tasks.
     cancelable_tasks_.cancel_all_tasks();
     throw_if_not_ok(resources().vfs().cancel_all_tasks());
@@ -1097,7 +1200,8 @@ Status StorageManagerCanonical::cancel_all_tasks() {
     // Wait for in-progress queries to finish.
     wait_for_zero_in_progress();
 
-    // Reset the cancellation flag.
+    // Reset the cancellation flags.
+    cancellation_token_->reset();
     std::unique_lock<std::mutex> lck(cancellation_in_progress_mtx_);
     cancellation_in_progress_ = false;
   }
@@ -1492,8 +1596,11 @@ Status StorageManagerCanonical::object_iter_next_preorder(
 }
 
 Status StorageManagerCanonical::query_submit(Query* query) {
-  // Process the query
+  // Process the query, with the cancellation token installed so that the
+  // parallel loops and VFS reads the query issues observe
+  // `cancel_all_tasks` between work items.
   QueryInProgress in_progress(this);
+  ThreadPool::CancellationScope scope(cancellation_token_);
   auto st = query->process();
 
   return st;
@@ -1687,16 +1794,38 @@ StorageManagerCanonical::load_group_from_all_uris(
     const EncryptionKey& encryption_key) {
   auto timer_se = stats()->start_timer("sm_load_group_from_uri");
 
-  std::vector<shared_ptr<Deserializer>> deserializers;
-  for (auto& uri : uris) {
-    auto&& tile = GenericTileIO::load(resources_, uri.uri_, 0, encryption_key);
+  // Fetch the details files in parallel. Details files are immutable and
+  // carry unique timestamped names, so cached contents never go stale.
+  auto& cache = resources_.group_details_cache();
+  std::vector<shared_ptr<std::vector<char>>> buffers(uris.size());
+  throw_if_not_ok(parallel_for(compute_tp(), 0, uris.size(), [&](size_t i) {
+    const auto key = uris[i].uri_.to_string();
+    if (cache.enabled() && cache.lookup(key, &buffers[i])) {
+      return Status::Ok();
+    }
+
+    auto&& tile =
+        GenericTileIO::load(resources_, uris[i].uri_, 0, encryption_key);
 
     stats()->add_counter("read_group_size", tile.size());
 
-    // Deserialize
-    shared_ptr<Deserializer> deserializer =
-        tdb::make_shared<TileDeserializer>(HERE(), std::move(tile));
-    deserializers.emplace_back(deserializer);
+    auto buffer = tdb::make_shared<std::vector<char>>(HERE(), tile.size());
+    std::memcpy(buffer->data(), tile.data(), tile.size());
+    if (cache.enabled()) {
+      cache.insert_entry(key, buffer);
+    }
+    buffers[i] = std::move(buffer);
+
+    return Status::Ok();
+  }));
+
+  // Deserialization must remain in timestamp order so that member
+  // deletes are applied at read-time correctly.
+  std::vector<shared_ptr<Deserializer>> deserializers;
+  deserializers.reserve(uris.size());
+  for (auto& buffer : buffers) {
+    deserializers.emplace_back(
+        tdb::make_shared<Deserializer>(HERE(), buffer->data(), buffer->size()));
   }
 
   auto opt_group = GroupDetails::deserialize(deserializers, group_uri);
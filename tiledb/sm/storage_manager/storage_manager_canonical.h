@@ -44,6 +44,7 @@
 #include <set>
 #include <string>
 #include <thread>
+#include <unordered_map>
 
 #include "tiledb/common/common.h"
 #include "tiledb/common/heap_memory.h"
@@ -300,6 +301,34 @@ class StorageManagerCanonical {
       ArrayDirectory array_dir,
       const std::vector<URI>& commit_uris);
 
+  /**
+   * Makes a written fragment visible by writing its commit file.
+   *
+   * When `sm.commit_batch_size` is greater than one, the commit is
+   * buffered instead and a single consolidated commits file covering the
+   * whole batch is written once the batch fills, cutting the write
+   * request count for ingest that creates many small fragments. Buffered
+   * commits are flushed no later than array close; until then the
+   * fragments are not visible to readers.
+   *
+   * @param write_version Write version.
+   * @param array_dir ArrayDirectory where the data is stored.
+   * @param commit_uri Commit file to write.
+   */
+  void commit_fragment(
+      format_version_t write_version,
+      const ArrayDirectory& array_dir,
+      const URI& commit_uri);
+
+  /**
+   * Writes a consolidated commits file covering any fragment commits
+   * buffered for the given array by `commit_fragment`. A no-op if there
+   * are none.
+   *
+   * @param array_uri The array URI.
+   */
+  void flush_fragment_commits(const URI& array_uri);
+
   /**
    * Cleans up the array data.
    *
@@ -568,6 +597,21 @@ class StorageManagerCanonical {
     return &(resources_.io_tp());
   }
 
+  /** Returns the unfiltered tile cache shared by all queries. */
+  [[nodiscard]] inline UnfilteredTileCache* tile_cache() const {
+    return &(resources_.tile_cache());
+  }
+
+  /** Returns the deletion vector cache shared by all queries. */
+  [[nodiscard]] inline DeletionVectorCache* deletion_vector_cache() const {
+    return &(resources_.deletion_vector_cache());
+  }
+
+  /** Returns the context level memory tracker. */
+  [[nodiscard]] inline MemoryTracker* memory_tracker() const {
+    return &(resources_.memory_tracker());
+  }
+
   /**
    * If the storage manager was configured with a REST server, return the
    * client instance. Else, return nullptr.
@@ -844,6 +888,14 @@ class StorageManagerCanonical {
   /** Mutex protecting cancellation_in_progress_. */
   std::mutex cancellation_in_progress_mtx_;
 
+  /**
+   * Cancellation token installed on query threads for the duration of
+   * query processing. `cancel_all_tasks` cancels it, which stops the
+   * `parallel_for` loops and VFS reads running on behalf of in-progress
+   * queries at work-item granularity.
+   */
+  shared_ptr<ThreadPool::CancellationToken> cancellation_token_;
+
   /**
    * The condition variable for exlcusively locking arrays. This is used
    * to wait for an array to be closed, before being exclusively locked
@@ -863,6 +915,24 @@ class StorageManagerCanonical {
   /** Mutex for managing open groups. */
   std::mutex open_groups_mtx_;
 
+  /** Fragment commits buffered for one array by `commit_fragment`. */
+  struct PendingCommits {
+    /** Write version of the buffered commits. */
+    format_version_t write_version_;
+
+    /** ArrayDirectory where the data is stored. */
+    ArrayDirectory array_dir_;
+
+    /** Buffered commit file URIs. */
+    std::vector<URI> commit_uris_;
+  };
+
+  /** Buffered fragment commits, keyed on array URI. */
+  std::unordered_map<std::string, PendingCommits> pending_commits_;
+
+  /** Mutex for managing buffered fragment commits. */
+  std::mutex pending_commits_mtx_;
+
   /** Count of the number of queries currently in progress. */
   uint64_t queries_in_progress_;
 
@@ -883,6 +953,9 @@ class StorageManagerCanonical {
   /*         PRIVATE METHODS           */
   /* ********************************* */
 
+  /** Flushes the buffered fragment commits of every array. */
+  void flush_all_fragment_commits();
+
   /** Decrement the count of in-progress queries. */
   void decrement_in_progress();
 
@@ -133,15 +133,28 @@ RangeSetAndSuperset::RangeSetAndSuperset(
 
 void RangeSetAndSuperset::sort_and_merge_ranges(
     ThreadPool* const compute_tp, bool merge) {
-  if (ranges_.empty()) {
+  if (ranges_.empty() || (ranges_sorted_ && !merge)) {
     return;
   }
 
-  impl_->sort_ranges(compute_tp, ranges_);
+  if (!ranges_sorted_) {
+    impl_->sort_ranges(compute_tp, ranges_);
+  }
 
   if (merge) {
     impl_->merge_ranges(ranges_);
   }
+
+  // Sorting orders the ranges by start and end, but nested ranges can still
+  // leave the range ends non-monotonic, so verify before allowing binary
+  // searches over the ranges.
+  ranges_sorted_ = true;
+  for (uint64_t r = 1; r < ranges_.size(); r++) {
+    if (!impl_->in_order(ranges_[r - 1], ranges_[r])) {
+      ranges_sorted_ = false;
+      break;
+    }
+  }
 }
 
 tuple<Status, optional<std::string>> RangeSetAndSuperset::add_range(
@@ -165,8 +178,18 @@ Status RangeSetAndSuperset::add_range_unrestricted(const Range& range) {
   if (is_implicitly_initialized_) {
     ranges_.clear();
     is_implicitly_initialized_ = false;
+    ranges_sorted_ = true;
+  }
+
+  // Track incrementally if the ranges remain sorted by only comparing the
+  // new range with the previous last one. Coalescing only ever extends the
+  // end of the last range, which cannot break the ordering.
+  const auto old_size = ranges_.size();
+  auto status = impl_->add_range(ranges_, range);
+  if (ranges_sorted_ && ranges_.size() > old_size && old_size > 0) {
+    ranges_sorted_ = impl_->in_order(ranges_[old_size - 1], ranges_.back());
   }
-  return impl_->add_range(ranges_, range);
+  return status;
 }
 
 void RangeSetAndSuperset::check_oob() {
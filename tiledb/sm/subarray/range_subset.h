@@ -97,6 +97,7 @@ struct AddStrategy<
 template <typename T, typename Enable = T>
 struct SortStrategy {
   static void sort(ThreadPool* const, std::vector<Range>&);
+  static bool in_order(const Range&, const Range&);
 };
 
 /**
@@ -120,6 +121,17 @@ struct SortStrategy<
                  (a_data[0] == b_data[0] && a_data[1] < b_data[1]);
         });
   };
+
+  /**
+   * Returns if the second range may directly follow the first in sorted
+   * order with non-decreasing range ends, which is the ordering assumed by
+   * the binary searches over sorted ranges.
+   */
+  static bool in_order(const Range& a, const Range& b) {
+    const T* a_data = static_cast<const T*>(a.start_fixed());
+    const T* b_data = static_cast<const T*>(b.start_fixed());
+    return a_data[0] <= b_data[0] && a_data[1] <= b_data[1];
+  };
 };
 
 /**
@@ -139,6 +151,15 @@ struct SortStrategy<std::string, std::string> {
                  (a.start_str() == b.start_str() && a.end_str() < b.end_str());
         });
   };
+
+  /**
+   * Returns if the second range may directly follow the first in sorted
+   * order with non-decreasing range ends, which is the ordering assumed by
+   * the binary searches over sorted ranges.
+   */
+  static bool in_order(const Range& a, const Range& b) {
+    return a.start_str() <= b.start_str() && a.end_str() <= b.end_str();
+  };
 };
 
 /** Default merge behavior: merging is not enabled. */
@@ -271,6 +292,15 @@ class RangeSetAndSupersetImpl {
    * @param ranges The sorted ranges to be merged.
    */
   virtual void merge_ranges(std::vector<Range>& ranges) const = 0;
+
+  /**
+   * Returns if the second range may directly follow the first in sorted
+   * order with non-decreasing range ends.
+   *
+   * @param first The first range.
+   * @param second The second range.
+   */
+  virtual bool in_order(const Range& first, const Range& second) const = 0;
 };
 
 template <typename T, bool CoalesceAdds>
@@ -317,6 +347,10 @@ class TypedRangeSetAndSupersetImpl : public RangeSetAndSupersetImpl {
     MergeStrategy<T>::merge_sorted_ranges(ranges);
   }
 
+  bool in_order(const Range& first, const Range& second) const override {
+    return SortStrategy<T>::in_order(first, second);
+  }
+
  private:
   /** Maximum possible range. */
   Range superset_{};
@@ -354,6 +388,10 @@ class TypedRangeSetAndFullsetImpl : public RangeSetAndSupersetImpl {
   void merge_ranges(std::vector<Range>& ranges) const override {
     MergeStrategy<T>::merge_sorted_ranges(ranges);
   }
+
+  bool in_order(const Range& first, const Range& second) const override {
+    return SortStrategy<T>::in_order(first, second);
+  }
 };
 
 /**
@@ -393,6 +431,10 @@ class TypedRangeSetAndFullsetImpl<std::string, CoalesceAdds>
   void merge_ranges(std::vector<Range>& ranges) const override {
     MergeStrategy<std::string>::merge_sorted_ranges(ranges);
   }
+
+  bool in_order(const Range& first, const Range& second) const override {
+    return SortStrategy<std::string>::in_order(first, second);
+  }
 };
 
 }  // namespace detail
@@ -486,6 +528,7 @@ class RangeSetAndSuperset {
   inline void clear() {
     ranges_.clear();
     is_implicitly_initialized_ = false;
+    ranges_sorted_ = true;
   }
 
   /** Returns a const reference to the stored ranges. */
@@ -506,6 +549,15 @@ class RangeSetAndSuperset {
     return ranges_.empty();
   };
 
+  /**
+   * Returns ``true`` if the stored ranges are in sorted order with
+   * non-decreasing range ends, which allows binary searches over the ranges.
+   * Ranges added in sorted order keep this flag set without ever sorting.
+   */
+  inline bool is_sorted() const {
+    return ranges_sorted_;
+  };
+
   /**
    * Checks if Subarray ranges are all valid. Throws is any range is found to be
    * invalid.
@@ -553,6 +605,12 @@ class RangeSetAndSuperset {
    */
   bool is_implicitly_initialized_ = true;
 
+  /**
+   * If ``true``, the stored ranges are in sorted order. Maintained
+   * incrementally as ranges are added and set by `sort_and_merge_ranges`.
+   */
+  bool ranges_sorted_ = true;
+
   /** Stored ranges. */
   std::vector<Range> ranges_{};
 };
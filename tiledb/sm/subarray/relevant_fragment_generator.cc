@@ -33,11 +33,13 @@
 #include "tiledb/sm/subarray/relevant_fragment_generator.h"
 #include "tiledb/common/common.h"
 #include "tiledb/sm/array/array.h"
+#include "tiledb/sm/array/fragment_interval_index.h"
 #include "tiledb/sm/array_schema/dimension.h"
 #include "tiledb/sm/misc/parallel_functions.h"
 #include "tiledb/sm/stats/stats.h"
 #include "tiledb/sm/subarray/subarray.h"
 #include "tiledb/sm/subarray/subarray_tile_overlap.h"
+#include "tiledb/type/apply_with_type.h"
 #include "tiledb/type/range/range.h"
 
 using namespace tiledb::common;
@@ -45,6 +47,60 @@ using namespace tiledb::common;
 namespace tiledb {
 namespace sm {
 
+/**
+ * Returns if the fragment non-empty domain range overlaps any of the sorted
+ * query ranges in `[r_start, r_end]`, using a binary search on the range ends
+ * in the same manner as `Dimension::relevant_ranges`.
+ */
+template <class T>
+static bool overlaps_sorted_ranges(
+    const std::vector<type::Range>& ranges,
+    const type::Range& frag_range,
+    const uint64_t r_start,
+    const uint64_t r_end) {
+  const auto frag_data = (const T*)frag_range.start_fixed();
+  const auto frag_start = frag_data[0];
+  const auto frag_end = frag_data[1];
+
+  // Binary search for the first range that ends at or after the fragment
+  // start.
+  auto it = std::lower_bound(
+      ranges.begin() + r_start,
+      ranges.begin() + r_end + 1,
+      frag_start,
+      [&](const type::Range& a, const T value) {
+        return ((const T*)a.start_fixed())[1] < value;
+      });
+  if (it == ranges.begin() + r_end + 1) {
+    return false;
+  }
+
+  return ((const T*)it->start_fixed())[0] <= frag_end;
+}
+
+/** String specialization of `overlaps_sorted_ranges`. */
+static bool overlaps_sorted_string_ranges(
+    const std::vector<type::Range>& ranges,
+    const type::Range& frag_range,
+    const uint64_t r_start,
+    const uint64_t r_end) {
+  const auto& frag_start = frag_range.start_str();
+  const auto& frag_end = frag_range.end_str();
+
+  auto it = std::lower_bound(
+      ranges.begin() + r_start,
+      ranges.begin() + r_end + 1,
+      frag_start,
+      [&](const type::Range& a, const std::string_view& value) {
+        return a.end_str() < value;
+      });
+  if (it == ranges.begin() + r_end + 1) {
+    return false;
+  }
+
+  return it->start_str() <= frag_end;
+}
+
 RelevantFragmentGenerator::RelevantFragmentGenerator(
     const Array& array, const Subarray& subarray, stats::Stats* stats)
     : stats_(stats)
@@ -124,6 +180,58 @@ Status RelevantFragmentGenerator::compute_relevant_fragments_for_dim(
     std::vector<uint8_t>* const frag_bytemap) const {
   const auto meta = array_.fragment_metadata();
   auto dim{array_.array_schema_latest().dimension_ptr(dim_idx)};
+  const auto& ranges = subarray_.ranges_for_dim(dim_idx);
+  const uint64_t r_start = start_coords[dim_idx];
+  const uint64_t r_end = end_coords[dim_idx];
+
+  // The fragment `f` is relevant to this dimension's fragment bytemap
+  // if it overlaps with any range between the start and end coordinates
+  // on this dimension.
+  auto fragment_overlaps = [&](const uint64_t f) {
+    const type::Range& frag_range = meta[f]->non_empty_domain()[dim_idx];
+
+    // If the ranges are sorted, a binary search finds a possibly
+    // overlapping range without scanning every range.
+    if (subarray_.ranges_sorted_for_dim(dim_idx)) {
+      auto g = [&](auto T) {
+        if constexpr (std::is_same_v<decltype(T), char>) {
+          return overlaps_sorted_string_ranges(
+              ranges, frag_range, r_start, r_end);
+        } else {
+          return overlaps_sorted_ranges<decltype(T)>(
+              ranges, frag_range, r_start, r_end);
+        }
+      };
+      return apply_with_type(g, dim->type());
+    }
+
+    for (uint64_t r = r_start; r <= r_end; ++r) {
+      if (dim->overlap(frag_range, ranges[r])) {
+        return true;
+      }
+    }
+
+    return false;
+  };
+
+  // Use the coarse interval index over the fragment non-empty domains to
+  // reject most fragments without per-fragment work and only run the exact
+  // overlap check on the candidates.
+  const auto index = array_.fragment_interval_index();
+  if (index->has_dim(dim_idx)) {
+    std::vector<unsigned> candidates;
+    index->overlapping_fragments(dim_idx, ranges, r_start, r_end, candidates);
+
+    return parallel_for(
+        compute_tp, 0, candidates.size(), [&](const uint64_t c) {
+          const auto f = candidates[c];
+          if ((*frag_bytemap)[f] == 0 && fragment_overlaps(f)) {
+            (*frag_bytemap)[f] = 1;
+          }
+
+          return Status::Ok();
+        });
+  }
 
   return parallel_for(compute_tp, 0, fragment_num, [&](const uint64_t f) {
     // We're done when we have already determined fragment `f` to
@@ -132,17 +240,8 @@ Status RelevantFragmentGenerator::compute_relevant_fragments_for_dim(
       return Status::Ok();
     }
 
-    // The fragment `f` is relevant to this dimension's fragment bytemap
-    // if it overlaps with any range between the start and end coordinates
-    // on this dimension.
-    const type::Range& frag_range = meta[f]->non_empty_domain()[dim_idx];
-    for (uint64_t r = start_coords[dim_idx]; r <= end_coords[dim_idx]; ++r) {
-      const type::Range& query_range = subarray_.ranges_for_dim(dim_idx)[r];
-
-      if (dim->overlap(frag_range, query_range)) {
-        (*frag_bytemap)[f] = 1;
-        break;
-      }
+    if (fragment_overlaps(f)) {
+      (*frag_bytemap)[f] = 1;
     }
 
     return Status::Ok();
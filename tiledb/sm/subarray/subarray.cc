@@ -1810,6 +1810,14 @@ Status Subarray::split(
     }
   }
 
+  // If the tile overlap of this subarray has been precomputed, derive the
+  // overlap of the two halves from it instead of having each half
+  // re-traverse the fragment R-trees.
+  if (range_num() == 1 && tile_overlap_.contains_range(0, 0)) {
+    derive_split_tile_overlap(r1);
+    derive_split_tile_overlap(r2);
+  }
+
   return Status::Ok();
 }
 
@@ -1860,9 +1868,81 @@ Status Subarray::split(
     }
   }
 
+  // If this subarray consists of a single bisected range with precomputed
+  // tile overlap, derive the overlap of the two halves from it instead of
+  // having each half re-traverse the fragment R-trees.
+  if (this->range_num() == 1 && tile_overlap_.contains_range(0, 0)) {
+    derive_split_tile_overlap(r1);
+    derive_split_tile_overlap(r2);
+  }
+
   return Status::Ok();
 }
 
+void Subarray::derive_split_tile_overlap(Subarray* half) const {
+  auto timer_se = stats_->start_timer("read_derive_split_tile_overlap");
+
+  const auto meta = array_->fragment_metadata();
+  const auto fragment_num = meta.size();
+  auto& domain{array_->array_schema_latest().domain()};
+
+  half->compute_range_offsets();
+  const auto range = half->ndrange(0);
+
+  SubarrayTileOverlap tile_overlap(fragment_num, 0, 0);
+  for (unsigned f = 0; f < fragment_num; ++f) {
+    const auto parent_overlap = tile_overlap_.at(f, 0);
+    if (parent_overlap->tile_ranges_.empty() && parent_overlap->tiles_.empty())
+      continue;
+
+    auto overlap = tile_overlap.at(f, 0);
+    if (meta[f]->dense()) {  // Dense fragment
+      *overlap = half->compute_tile_overlap(0, f);
+      continue;
+    }
+
+    // Sparse fragment. Merge the two parent overlap lists so that the
+    // tiles are visited in increasing index order.
+    const auto& tile_ranges = parent_overlap->tile_ranges_;
+    const auto& tiles = parent_overlap->tiles_;
+    size_t r = 0, t = 0;
+    uint64_t next_in_range = tile_ranges.empty() ? 0 : tile_ranges[0].first;
+    while (r < tile_ranges.size() || t < tiles.size()) {
+      uint64_t tile_idx;
+      if (r < tile_ranges.size() &&
+          (t == tiles.size() || next_in_range < tiles[t].first)) {
+        tile_idx = next_in_range;
+        if (next_in_range == tile_ranges[r].second) {
+          if (++r < tile_ranges.size())
+            next_in_range = tile_ranges[r].first;
+        } else {
+          ++next_in_range;
+        }
+      } else {
+        tile_idx = tiles[t++].first;
+      }
+
+      // Intersect the half's range with the tile MBR, classifying the
+      // tile in the same manner as `RTree::get_tile_overlap`.
+      auto ratio =
+          domain.overlap_ratio(range, half->is_default_, meta[f]->mbr(tile_idx));
+      if (ratio == 1.0) {  // Full overlap, coalescing adjacent tiles
+        if (!overlap->tile_ranges_.empty() &&
+            overlap->tile_ranges_.back().second + 1 == tile_idx) {
+          overlap->tile_ranges_.back().second = tile_idx;
+        } else {
+          overlap->tile_ranges_.emplace_back(tile_idx, tile_idx);
+        }
+      } else if (ratio != 0.0) {  // Partial overlap
+        overlap->tiles_.emplace_back(tile_idx, ratio);
+      }
+    }
+  }
+
+  half->tile_overlap_ = std::move(tile_overlap);
+  half->relevant_fragments_ = relevant_fragments_;
+}
+
 const std::vector<std::vector<uint8_t>>& Subarray::tile_coords() const {
   return tile_coords_;
 }
@@ -1057,6 +1057,15 @@ class Subarray {
     return range_subset_[dim_idx].ranges();
   }
 
+  /**
+   * Returns ``true`` if the ranges for the given dimension index are in
+   * sorted order with non-decreasing range ends, which allows binary
+   * searches over the ranges.
+   */
+  inline bool ranges_sorted_for_dim(uint32_t dim_idx) const {
+    return range_subset_[dim_idx].is_sorted();
+  }
+
   /**
    * Adds ranges for an attribute.
    *
@@ -1592,6 +1601,19 @@ class Subarray {
       SubarrayTileOverlap* tile_overlap,
       ComputeRelevantTileOverlapCtx* fn_ctx);
 
+  /**
+   * Derives the tile overlap of the input split half from this subarray's
+   * precomputed tile overlap. Since the half's range is contained in this
+   * subarray's range, the tiles overlapping the half are a subset of the
+   * tiles in this subarray's overlap lists, so it suffices to intersect
+   * the half's range with the MBRs of those tiles instead of traversing
+   * the fragment R-trees from scratch. Applicable only when this subarray
+   * consists of a single range whose tile overlap has been computed.
+   *
+   * @param half One of the two halves produced by `split`.
+   */
+  void derive_split_tile_overlap(Subarray* half) const;
+
   /**
    * Load the var-sized tile sizes for the input names and from the
    * relevant fragments.
@@ -43,6 +43,7 @@
 #include "tiledb/sm/misc/utils.h"
 #include "tiledb/sm/stats/global_stats.h"
 
+#include <cmath>
 #include <iomanip>
 
 class SubarrayPartitionerStatusException : public StatusException {
@@ -764,9 +765,80 @@ Status SubarrayPartitioner::calibrate_current_start_end(bool* must_split_slab) {
 
   // Get current_.end_. based on end_coords
   current_.end_ = subarray_.range_idx(end_coords);
+
+  // For dense arrays, prefer partition boundaries that coincide with
+  // space tile boundaries, so that ranges striping the same tiles are
+  // not split across partitions.
+  if (!*must_split_slab && current_.end_ > current_.start_ &&
+      current_.end_ + 1 < subarray_.range_num() &&
+      subarray_.array()->array_schema_latest().dense()) {
+    calibrate_current_end_on_tiles(layout);
+  }
+
   return Status::Ok();
 }
 
+void SubarrayPartitioner::calibrate_current_end_on_tiles(Layout layout) {
+  auto end_coords = subarray_.get_range_coords(current_.end_);
+  auto next_coords = subarray_.get_range_coords(current_.end_ + 1);
+  auto dim_num = subarray_.dim_num();
+
+  // Find the dimension along which the next partition advances, i.e., the
+  // major-most dimension whose range coordinate changes across the
+  // boundary. All dimensions minor to it restart from their first range,
+  // so the only ranges adjacent across the boundary lie on this dimension.
+  unsigned adv_dim = UINT32_MAX;
+  for (unsigned d = 0; d < dim_num; ++d) {
+    unsigned major_dim = (layout == Layout::ROW_MAJOR) ? d : dim_num - d - 1;
+    if (end_coords[major_dim] != next_coords[major_dim]) {
+      adv_dim = major_dim;
+      break;
+    }
+  }
+  if (adv_dim == UINT32_MAX ||
+      next_coords[adv_dim] != end_coords[adv_dim] + 1) {
+    return;
+  }
+
+  // Scan backwards for the closest pair of consecutive ranges on the
+  // advancing dimension that do not intersect a common space tile.
+  auto dim{
+      subarray_.array()->array_schema_latest().domain().dimension_ptr(adv_dim)};
+  const Range* r1;
+  const Range* r2;
+  uint64_t r = end_coords[adv_dim];
+  while (true) {
+    throw_if_not_ok(subarray_.get_range(adv_dim, r, &r1));
+    throw_if_not_ok(subarray_.get_range(adv_dim, r + 1, &r2));
+    if (!dim->tiles_overlap(*r1, *r2)) {
+      break;
+    }
+    if (r == 0) {
+      // All range boundaries on this dimension fall within tiles.
+      return;
+    }
+    r--;
+  }
+
+  // Already tile-aligned, nothing to do.
+  if (r == end_coords[adv_dim]) {
+    return;
+  }
+
+  // Since the boundary advances on `adv_dim`, all dimensions minor to it
+  // are at their last range in `end_coords`, so only the advancing
+  // coordinate changes when moving the end backwards.
+  end_coords[adv_dim] = r;
+  auto new_end = subarray_.range_idx(end_coords);
+  if (new_end < current_.start_) {
+    // Moving to the tile-aligned boundary would make the partition empty.
+    return;
+  }
+
+  current_.end_ = new_end;
+  stats_->add_counter("calibrate_current_start_end.tile_aligned", 1);
+}
+
 SubarrayPartitioner SubarrayPartitioner::clone() const {
   SubarrayPartitioner clone;
   clone.stats_ = stats_;
@@ -1130,10 +1202,13 @@ Status SubarrayPartitioner::compute_splitting_value_multi_range(
   return Status::Ok();
 }
 
-bool SubarrayPartitioner::must_split(Subarray* partition) {
+bool SubarrayPartitioner::must_split(Subarray* partition, double* overshoot) {
   const auto& array_schema = subarray_.array()->array_schema_latest();
   bool must_split = false;
 
+  if (overshoot != nullptr)
+    *overshoot = 1.0;
+
   uint64_t size_fixed;
   uint64_t size_var;
   uint64_t size_validity;
@@ -1246,13 +1321,46 @@ bool SubarrayPartitioner::must_split(Subarray* partition) {
         mem_size_fixed > memory_budget_ || mem_size_var > memory_budget_var_ ||
         mem_size_validity > memory_budget_validity_) {
       must_split = true;
-      break;
+      if (overshoot == nullptr)
+        break;
+    }
+
+    // Track the worst size-over-budget ratio across all budgets, which the
+    // caller uses to calibrate the number of splits.
+    if (overshoot != nullptr) {
+      auto update_overshoot = [&overshoot](uint64_t size, uint64_t budget) {
+        if (size > budget)
+          *overshoot = std::max(
+              *overshoot,
+              budget == 0 ? (double)size : (double)size / (double)budget);
+      };
+      if (!skip_split_on_est_size_) {
+        update_overshoot(size_fixed, b.second.size_fixed_);
+        update_overshoot(size_var, b.second.size_var_);
+        update_overshoot(size_validity, b.second.size_validity_);
+      }
+      update_overshoot(mem_size_fixed, memory_budget_);
+      update_overshoot(mem_size_var, memory_budget_var_);
+      update_overshoot(mem_size_validity, memory_budget_validity_);
     }
   }
 
   return must_split;
 }
 
+uint64_t SubarrayPartitioner::calibrate_num_splits(double overshoot) {
+  if (!(overshoot > 1.0))
+    return 1;
+
+  // A split halves a partition, so under a proportional model
+  // `floor(log2(overshoot))` splits are needed before the partition can fit
+  // the budget. Cap the count so that skewed distributions cannot cause
+  // excessive over-splitting before the estimates are recomputed.
+  constexpr uint64_t max_splits = 6;
+  auto num_splits = (uint64_t)std::floor(std::log2(overshoot));
+  return std::min(std::max<uint64_t>(num_splits, 1), max_splits);
+}
+
 Status SubarrayPartitioner::next_from_multi_range(bool* unsplittable) {
   // A new multi-range subarray may need to be put in the list and split
   if (state_.multi_range_.empty()) {
@@ -1266,9 +1374,25 @@ Status SubarrayPartitioner::next_from_multi_range(bool* unsplittable) {
     bool must_split;
     do {
       auto& partition = state_.multi_range_.front();
-      must_split = this->must_split(&partition);
-      if (must_split)
-        RETURN_NOT_OK(split_top_multi_range(unsplittable));
+      double overshoot;
+      must_split = this->must_split(&partition, &overshoot);
+      if (must_split) {
+        // Split as many times as the overshoot ratio warrants before
+        // recomputing the (expensive) result size estimates, so that the
+        // calibration converges in a logarithmic number of splits.
+        auto num_splits = calibrate_num_splits(overshoot);
+        for (uint64_t i = 0; i < num_splits; ++i) {
+          RETURN_NOT_OK(split_top_multi_range(unsplittable));
+          if (*unsplittable) {
+            // Only the first split applies to a partition known to overflow
+            // the budget; an unsplittable smaller piece must be re-checked
+            // against the budget first.
+            if (i > 0)
+              *unsplittable = false;
+            break;
+          }
+        }
+      }
     } while (must_split && !*unsplittable);
   }
 
@@ -1295,9 +1419,25 @@ Status SubarrayPartitioner::next_from_single_range(bool* unsplittable) {
     bool must_split;
     do {
       auto& partition = state_.single_range_.front();
-      must_split = this->must_split(&partition);
-      if (must_split)
-        RETURN_NOT_OK(split_top_single_range(unsplittable));
+      double overshoot;
+      must_split = this->must_split(&partition, &overshoot);
+      if (must_split) {
+        // Split as many times as the overshoot ratio warrants before
+        // recomputing the (expensive) result size estimates, so that the
+        // calibration converges in a logarithmic number of splits.
+        auto num_splits = calibrate_num_splits(overshoot);
+        for (uint64_t i = 0; i < num_splits; ++i) {
+          RETURN_NOT_OK(split_top_single_range(unsplittable));
+          if (*unsplittable) {
+            // Only the first split applies to a partition known to overflow
+            // the budget; an unsplittable smaller piece must be re-checked
+            // against the budget first.
+            if (i > 0)
+              *unsplittable = false;
+            break;
+          }
+        }
+      }
     } while (must_split && !*unsplittable);
   }
 
@@ -416,6 +416,22 @@ class SubarrayPartitioner {
    */
   Status calibrate_current_start_end(bool* must_split_slab);
 
+  /**
+   * Applicable only to dense arrays with multiple ranges. After
+   * ``calibrate_current_start_end`` has settled on a slab-aligned
+   * ``current_.end_``, this function moves ``current_.end_`` backwards to
+   * the closest range boundary that coincides with a space tile boundary
+   * on the dimension along which the next partition advances. This way,
+   * ranges that stripe the same space tiles end up in the same partition
+   * and the dense reader reads and unfilters each tile once, instead of
+   * once per partition that touches it. If no such boundary exists (or
+   * moving would make the partition empty), ``current_.end_`` is left
+   * intact.
+   *
+   * @param layout The effective row-/col-major layout of the subarray.
+   */
+  void calibrate_current_end_on_tiles(Layout layout);
+
   /** Returns a deep copy of this SubarrayPartitioner. */
   SubarrayPartitioner clone() const;
 
@@ -484,8 +500,21 @@ class SubarrayPartitioner {
       bool* normal_order,
       bool* unsplittable);
 
-  /** Returns ``true`` if the input partition must be split. */
-  bool must_split(Subarray* partition);
+  /**
+   * Returns ``true`` if the input partition must be split. If ``overshoot``
+   * is not ``nullptr``, it is set to the maximum ratio of an estimated
+   * result (or maximum memory) size over its corresponding budget, which
+   * the callers use to calibrate how many times the partition gets split
+   * before the estimates are recomputed.
+   */
+  bool must_split(Subarray* partition, double* overshoot = nullptr);
+
+  /**
+   * Returns the number of consecutive splits to perform on a partition
+   * that overshoots its budget by the input ratio, before the result size
+   * estimates must be recomputed.
+   */
+  static uint64_t calibrate_num_splits(double overshoot);
 
   /**
    * It computes the next partition from a multi-range subarray, which may
@@ -676,3 +676,76 @@ TEST_CASE("RangeSetAndSuperset test bad constructor args") {
   Range range{};
   REQUIRE_THROWS(RangeSetAndSuperset(Datatype::ANY, range, false, false));
 }
+
+TEST_CASE(
+    "RangeSetAndSuperset sorted order tracking",
+    "[range_multi_subset][sorted]") {
+  int32_t bounds[2] = {0, 100};
+  Range range{bounds, 2 * sizeof(int32_t)};
+  RangeSetAndSuperset range_subset{Datatype::INT32, range, false, false};
+  CHECK(range_subset.is_sorted());
+
+  SECTION("Ranges added in sorted order keep the sorted flag") {
+    int32_t data1[2] = {1, 2};
+    int32_t data2[2] = {4, 5};
+    int32_t data3[2] = {4, 8};
+    Range r1{data1, 2 * sizeof(int32_t)};
+    Range r2{data2, 2 * sizeof(int32_t)};
+    Range r3{data3, 2 * sizeof(int32_t)};
+    range_subset.add_range(r1);
+    range_subset.add_range(r2);
+    range_subset.add_range(r3);
+    CHECK(range_subset.is_sorted());
+  }
+
+  SECTION("Ranges added out of order clear the sorted flag") {
+    int32_t data1[2] = {4, 5};
+    int32_t data2[2] = {1, 2};
+    Range r1{data1, 2 * sizeof(int32_t)};
+    Range r2{data2, 2 * sizeof(int32_t)};
+    range_subset.add_range(r1);
+    CHECK(range_subset.is_sorted());
+    range_subset.add_range(r2);
+    CHECK(!range_subset.is_sorted());
+
+    // Sorting restores the flag.
+    ThreadPool pool{2};
+    range_subset.sort_and_merge_ranges(&pool, false);
+    CHECK(range_subset.is_sorted());
+    check_subset_range_values(range_subset, 0, data2[0], data2[1]);
+    check_subset_range_values(range_subset, 1, data1[0], data1[1]);
+  }
+
+  SECTION("Nested ranges clear the sorted flag") {
+    int32_t data1[2] = {1, 10};
+    int32_t data2[2] = {2, 3};
+    Range r1{data1, 2 * sizeof(int32_t)};
+    Range r2{data2, 2 * sizeof(int32_t)};
+    range_subset.add_range(r1);
+    range_subset.add_range(r2);
+    CHECK(!range_subset.is_sorted());
+
+    // Sorting cannot make the range ends monotonic for nested ranges.
+    ThreadPool pool{2};
+    range_subset.sort_and_merge_ranges(&pool, false);
+    CHECK(!range_subset.is_sorted());
+
+    // Merging resolves the nesting.
+    range_subset.sort_and_merge_ranges(&pool, true);
+    CHECK(range_subset.is_sorted());
+    CHECK(range_subset.num_ranges() == 1);
+    check_subset_range_values(range_subset, 0, data1[0], data1[1]);
+  }
+
+  SECTION("Clearing the ranges restores the sorted flag") {
+    int32_t data1[2] = {4, 5};
+    int32_t data2[2] = {1, 2};
+    Range r1{data1, 2 * sizeof(int32_t)};
+    Range r2{data2, 2 * sizeof(int32_t)};
+    range_subset.add_range(r1);
+    range_subset.add_range(r2);
+    CHECK(!range_subset.is_sorted());
+    range_subset.clear();
+    CHECK(range_subset.is_sorted());
+  }
+}
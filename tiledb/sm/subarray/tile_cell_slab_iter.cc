@@ -176,7 +176,7 @@ TileCellSlabIter<T>::TileCellSlabIter(
     }
   }
 
-  update_cell_slab();
+  update_cell_slab<0>();
 }
 
 /* ****************************** */
@@ -191,25 +191,52 @@ void TileCellSlabIter<T>::operator++() {
     return;
   }
 
+  // Dispatch to a body compiled for the exact dimension count so that the
+  // per-dimension loops are fully unrolled for the common low-dimensional
+  // arrays.
+  switch (dim_num_) {
+    case 1:
+      advance_and_update<1>();
+      break;
+    case 2:
+      advance_and_update<2>();
+      break;
+    case 3:
+      advance_and_update<3>();
+      break;
+    case 4:
+      advance_and_update<4>();
+      break;
+    default:
+      advance_and_update<0>();
+      break;
+  }
+}
+
+/* ****************************** */
+/*          PRIVATE METHODS       */
+/* ****************************** */
+
+template <class T>
+template <int D>
+void TileCellSlabIter<T>::advance_and_update() {
   // Advance the iterator
   if (layout_ == Layout::ROW_MAJOR) {
-    advance_row();
+    advance_row<D>();
   } else {
-    advance_col();
+    advance_col<D>();
   }
 
   if (!end_) {
-    update_cell_slab();
+    update_cell_slab<D>();
   }
 }
 
-/* ****************************** */
-/*          PRIVATE METHODS       */
-/* ****************************** */
-
 template <class T>
+template <int D>
 void TileCellSlabIter<T>::advance_col() {
-  for (int i = 0; i < dim_num_; ++i) {
+  const int dim_num = D > 0 ? D : dim_num_;
+  for (int i = 0; i < dim_num; ++i) {
     cell_slab_coords_[i] += (i == 0) ? cell_slab_lengths_[range_coords_[i]] : 1;
     if (cell_slab_coords_[i] > ranges_[i][range_coords_[i]].end_) {
       ++range_coords_[i];
@@ -221,7 +248,7 @@ void TileCellSlabIter<T>::advance_col() {
       break;
     } else {
       // The iterator has reached the end
-      if (i == dim_num_ - 1) {
+      if (i == dim_num - 1) {
         end_ = true;
         return;
       }
@@ -233,10 +260,12 @@ void TileCellSlabIter<T>::advance_col() {
 }
 
 template <class T>
+template <int D>
 void TileCellSlabIter<T>::advance_row() {
-  for (int i = dim_num_ - 1; i >= 0; --i) {
+  const int dim_num = D > 0 ? D : dim_num_;
+  for (int i = dim_num - 1; i >= 0; --i) {
     cell_slab_coords_[i] +=
-        (i == dim_num_ - 1) ? cell_slab_lengths_[range_coords_[i]] : 1;
+        (i == dim_num - 1) ? cell_slab_lengths_[range_coords_[i]] : 1;
     if (cell_slab_coords_[i] > ranges_[i][range_coords_[i]].end_) {
       ++range_coords_[i];
       if (range_coords_[i] < (T)ranges_[i].size())
@@ -309,15 +338,18 @@ Status TileCellSlabIter<T>::init_ranges(const Subarray& subarray) {
 }
 
 template <class T>
+template <int D>
 void TileCellSlabIter<T>::update_cell_slab() {
+  const int32_t dim_num = D > 0 ? D : dim_num_;
+
   // Compute the cell slab length.
   cell_slab_length_ = (layout_ == Layout::ROW_MAJOR) ?
-                          cell_slab_lengths_[range_coords_[dim_num_ - 1]] :
+                          cell_slab_lengths_[range_coords_[dim_num - 1]] :
                           cell_slab_lengths_[range_coords_[0]];
 
   // Compute position in tile.
   pos_in_tile_ = 0;
-  for (int32_t d = 0; d < dim_num_; d++) {
+  for (int32_t d = 0; d < dim_num; d++) {
     pos_in_tile_ +=
         mult_extents_[d] * (cell_slab_coords_[d] - start_coords_[d]);
   }
@@ -327,13 +359,13 @@ void TileCellSlabIter<T>::update_cell_slab() {
     dest_offset_row_col_ = 0;
     if (num_ranges_ == 1) {
       if (layout_ == Layout::COL_MAJOR) {
-        for (int32_t d = 0; d < dim_num_; d++) {
+        for (int32_t d = 0; d < dim_num; d++) {
           const auto& ri = range_info_[d];
           dest_offset_row_col_ +=
               ri.multiplier_ * (cell_slab_coords_[d] - ri.mins_[0]);
         }
       } else {
-        for (int32_t d = dim_num_ - 1; d >= 0; d--) {
+        for (int32_t d = dim_num - 1; d >= 0; d--) {
           const auto& ri = range_info_[d];
           dest_offset_row_col_ +=
               ri.multiplier_ * (cell_slab_coords_[d] - ri.mins_[0]);
@@ -341,7 +373,7 @@ void TileCellSlabIter<T>::update_cell_slab() {
       }
     } else {
       if (layout_ == Layout::COL_MAJOR) {
-        for (int32_t d = 0; d < dim_num_; d++) {
+        for (int32_t d = 0; d < dim_num; d++) {
           const auto& ri = range_info_[d];
           auto r = original_range_idx_[d][range_coords_[d]];
           dest_offset_row_col_ +=
@@ -349,7 +381,7 @@ void TileCellSlabIter<T>::update_cell_slab() {
               (cell_slab_coords_[d] - ri.mins_[r] + ri.cell_offsets_[r]);
         }
       } else {
-        for (int32_t d = dim_num_ - 1; d >= 0; d--) {
+        for (int32_t d = dim_num - 1; d >= 0; d--) {
           const auto& ri = range_info_[d];
           auto r = original_range_idx_[d][range_coords_[d]];
           dest_offset_row_col_ +=
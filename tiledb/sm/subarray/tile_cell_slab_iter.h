@@ -229,10 +229,30 @@ class TileCellSlabIter {
   /*           PRIVATE METHODS         */
   /* ********************************* */
 
-  /** Advances to the next cell slab when the layout is col-major. */
+  /**
+   * Advances to the next cell slab and updates the cell slab data.
+   *
+   * @tparam D The number of dimensions as a compile time constant, which
+   * lets the compiler fully unroll the per-dimension loops, or 0 to use
+   * `dim_num_` at runtime.
+   */
+  template <int D>
+  void advance_and_update();
+
+  /**
+   * Advances to the next cell slab when the layout is col-major.
+   *
+   * @tparam D Compile time dimension count, or 0 for the runtime fallback.
+   */
+  template <int D>
   void advance_col();
 
-  /** Advances to the next cell slab when the layout is row-major. */
+  /**
+   * Advances to the next cell slab when the layout is row-major.
+   *
+   * @tparam D Compile time dimension count, or 0 for the runtime fallback.
+   */
+  template <int D>
   void advance_row();
 
   /**
@@ -254,7 +274,10 @@ class TileCellSlabIter {
   /**
    * Updates the current cell slab, based on the current state of
    * the iterator.
+   *
+   * @tparam D Compile time dimension count, or 0 for the runtime fallback.
    */
+  template <int D>
   void update_cell_slab();
 };
 
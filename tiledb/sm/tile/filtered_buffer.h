@@ -35,6 +35,7 @@
 
 #include <vector>
 
+#include "tiledb/common/dynamic_memory/huge_page_memory.h"
 #include "tiledb/common/status.h"
 
 using namespace tiledb::common;
@@ -54,6 +55,7 @@ class FilteredBuffer {
   FilteredBuffer(uint64_t size) {
     if (size != 0) {
       filtered_buffer_.resize(size);
+      tdb_hugepage_hint(filtered_buffer_.data(), filtered_buffer_.size());
     }
   }
 
@@ -120,6 +122,7 @@ class FilteredBuffer {
   inline void expand(size_t size) {
     assert(size >= filtered_buffer_.size());
     filtered_buffer_.resize(size);
+    tdb_hugepage_hint(filtered_buffer_.data(), filtered_buffer_.size());
   }
 
   /** Clears the data. */
@@ -124,12 +124,112 @@ Tile GenericTileIO::read_generic(
 
   // Unfilter
   assert(tile.filtered());
-  header.filters.run_reverse_generic_tile(&resources_.stats(), tile, config);
+  header.filters.run_reverse_generic_tile(
+      &resources_.stats(), tile, &resources_.compute_tp(), config);
   assert(!tile.filtered());
 
   return tile;
 }
 
+std::vector<Tile> GenericTileIO::read_generic_many(
+    const std::vector<uint64_t>& file_offsets,
+    const EncryptionKey& encryption_key,
+    const Config& config) {
+  const auto tile_num = file_offsets.size();
+  std::vector<Tile> tiles;
+  if (tile_num == 0) {
+    return tiles;
+  }
+
+  // Fetch all the fixed-size headers with one multi-region read.
+  std::vector<std::vector<uint8_t>> base_bufs(
+      tile_num, std::vector<uint8_t>(GenericTileHeader::BASE_SIZE));
+  std::vector<std::tuple<uint64_t, void*, uint64_t>> regions;
+  regions.reserve(tile_num);
+  for (uint64_t i = 0; i < tile_num; i++) {
+    regions.emplace_back(
+        file_offsets[i], base_bufs[i].data(), GenericTileHeader::BASE_SIZE);
+  }
+  throw_if_not_ok(resources_.vfs().read_multi_region(uri_, regions));
+
+  // Parse the fixed-size headers.
+  std::vector<GenericTileHeader> headers(tile_num);
+  for (uint64_t i = 0; i < tile_num; i++) {
+    auto& header = headers[i];
+    Deserializer base_deserializer(base_bufs[i].data(), base_bufs[i].size());
+    header.version_number = base_deserializer.read<uint32_t>();
+    header.persisted_size = base_deserializer.read<uint64_t>();
+    header.tile_size = base_deserializer.read<uint64_t>();
+    header.datatype = base_deserializer.read<uint8_t>();
+    header.cell_size = base_deserializer.read<uint64_t>();
+    header.encryption_type = base_deserializer.read<uint8_t>();
+    header.filter_pipeline_size = base_deserializer.read<uint32_t>();
+
+    if (encryption_key.encryption_type() !=
+        (EncryptionType)header.encryption_type) {
+      throw GenericTileIOException(
+          "Error reading generic tile; tile is encrypted with " +
+          encryption_type_str((EncryptionType)header.encryption_type) +
+          " but given key is for " +
+          encryption_type_str(encryption_key.encryption_type()));
+    }
+  }
+
+  // Fetch all the filter pipelines and tile payloads with a second
+  // multi-region read. The filter pipeline immediately precedes the tile
+  // data in the file, so the two form a single region per tile.
+  std::vector<std::vector<char>> payloads(tile_num);
+  regions.clear();
+  for (uint64_t i = 0; i < tile_num; i++) {
+    payloads[i].resize(
+        headers[i].filter_pipeline_size + headers[i].persisted_size);
+    regions.emplace_back(
+        file_offsets[i] + GenericTileHeader::BASE_SIZE,
+        payloads[i].data(),
+        payloads[i].size());
+  }
+  throw_if_not_ok(resources_.vfs().read_multi_region(uri_, regions));
+
+  // Deserialize the filter pipelines and unfilter the tiles in parallel.
+  std::vector<std::optional<Tile>> unfiltered(tile_num);
+  throw_if_not_ok(parallel_for(
+      &resources_.compute_tp(), 0, tile_num, [&](const uint64_t i) {
+        auto& header = headers[i];
+
+        Deserializer filter_pipeline_deserializer(
+            payloads[i].data(), header.filter_pipeline_size);
+        header.filters = FilterPipeline::deserialize(
+            filter_pipeline_deserializer,
+            header.version_number,
+            static_cast<Datatype>(header.datatype));
+        configure_encryption_filter(&header, encryption_key);
+
+        Tile tile(
+            header.version_number,
+            (Datatype)header.datatype,
+            header.cell_size,
+            0,
+            header.tile_size,
+            payloads[i].data() + header.filter_pipeline_size,
+            header.persisted_size);
+
+        assert(tile.filtered());
+        header.filters.run_reverse_generic_tile(
+            &resources_.stats(), tile, &resources_.compute_tp(), config);
+        assert(!tile.filtered());
+
+        unfiltered[i] = std::move(tile);
+        return Status::Ok();
+      }));
+
+  tiles.reserve(tile_num);
+  for (auto& tile : unfiltered) {
+    tiles.emplace_back(std::move(*tile));
+  }
+
+  return tiles;
+}
+
 GenericTileIO::GenericTileHeader GenericTileIO::read_generic_tile_header(
     ContextResources& resources, const URI& uri, uint64_t file_offset) {
   GenericTileHeader header;
@@ -148,6 +148,28 @@ class GenericTileIO {
       const EncryptionKey& encryption_key,
       const Config& config);
 
+  /**
+   * Reads multiple generic tiles from the file.
+   *
+   * Whereas `read_generic` issues separate VFS reads for the header, the
+   * filter pipeline and the tile data of a single tile, this function
+   * fetches all the requested tiles with two multi-region VFS operations:
+   * one for the fixed-size headers and one for the variable-size remainders
+   * (filter pipeline plus tile data, which are adjacent in the file). The
+   * tiles are then unfiltered in parallel on the compute thread pool. This
+   * is the preferred way to load the metadata tiles of a fragment, which
+   * reside in the same file.
+   *
+   * @param file_offsets The offsets in the file to read from.
+   * @param encryption_key The encryption key to use.
+   * @param config The storage manager's config.
+   * @return The tiles, in the order of `file_offsets`.
+   */
+  std::vector<Tile> read_generic_many(
+      const std::vector<uint64_t>& file_offsets,
+      const EncryptionKey& encryption_key,
+      const Config& config);
+
   /**
    * Reads the generic tile header from the file.
    *
@@ -32,6 +32,7 @@
 
 #include "tiledb/sm/tile/tile.h"
 #include "tiledb/common/exception/exception.h"
+#include "tiledb/common/dynamic_memory/huge_page_memory.h"
 #include "tiledb/common/heap_memory.h"
 #include "tiledb/common/logger.h"
 #include "tiledb/sm/enums/datatype.h"
@@ -120,6 +121,21 @@ TileBase::TileBase(
   if (!data_) {
     throw std::bad_alloc();
   }
+  tdb_hugepage_hint(data_.get(), size_);
+}
+
+TileBase::TileBase(
+    const format_version_t format_version,
+    const Datatype type,
+    const uint64_t cell_size,
+    const uint64_t size,
+    void* data)
+    : data_(static_cast<char*>(data), [](void*) {})
+    , size_(size)
+    , cell_size_(cell_size)
+    , format_version_(format_version)
+    , type_(type) {
+  assert(data != nullptr);
 }
 
 TileBase::TileBase(TileBase&& tile)
@@ -174,6 +190,16 @@ WriterTile::WriterTile(
     , filtered_buffer_(0) {
 }
 
+WriterTile::WriterTile(
+    const format_version_t format_version,
+    const Datatype type,
+    const uint64_t cell_size,
+    const uint64_t size,
+    void* data)
+    : TileBase(format_version, type, cell_size, size, data)
+    , filtered_buffer_(0) {
+}
+
 WriterTile::WriterTile(WriterTile&& tile)
     : TileBase(std::move(tile))
     , filtered_buffer_(std::move(tile.filtered_buffer_)) {
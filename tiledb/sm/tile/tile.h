@@ -65,6 +65,23 @@ class TileBase {
       const uint64_t cell_size,
       const uint64_t size);
 
+  /**
+   * Constructor for a tile backed by externally owned memory. The tile will
+   * not free the data.
+   *
+   * @param format_version The format version.
+   * @param type The data type.
+   * @param cell_size The cell size.
+   * @param size The size of the tile.
+   * @param data The externally owned buffer backing the tile.
+   */
+  TileBase(
+      const format_version_t format_version,
+      const Datatype type,
+      const uint64_t cell_size,
+      const uint64_t size,
+      void* data);
+
   /** Move constructor. */
   TileBase(TileBase&& tile);
 
@@ -392,6 +409,25 @@ class WriterTile : public TileBase {
       const uint64_t cell_size,
       const uint64_t size);
 
+  /**
+   * Constructor for a tile backed by externally owned memory, e.g. a slab
+   * shared by the tiles of a write batch. The tile will not free the data.
+   * Must not be used for tiles that grow through `write_var`, as the buffer
+   * cannot be reallocated.
+   *
+   * @param format_version The format version.
+   * @param type The data type.
+   * @param cell_size The cell size.
+   * @param size The size of the tile.
+   * @param data The externally owned buffer backing the tile.
+   */
+  WriterTile(
+      const format_version_t format_version,
+      const Datatype type,
+      const uint64_t cell_size,
+      const uint64_t size,
+      void* data);
+
   /** Move constructor. */
   WriterTile(WriterTile&& tile);
 
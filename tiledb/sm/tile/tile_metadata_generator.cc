@@ -38,6 +38,14 @@ using namespace tiledb::common;
 namespace tiledb {
 namespace sm {
 
+/**
+ * Number of cells accumulated per block by the widened sum kernels. Small
+ * enough that a block of any type narrower than the accumulator cannot
+ * overflow it, so the saturation checks only run once per block and the
+ * inner loop stays branch free for the compiler to vectorize.
+ */
+static constexpr uint64_t sum_block_cells = 65536;
+
 /* ****************************** */
 /*    STRUCTURED BINDINGS APIS    */
 /* ****************************** */
@@ -49,22 +57,49 @@ void Sum<T, int64_t>::sum(
   auto values = tile.data_as<T>();
   auto sum_data = reinterpret_cast<int64_t*>(sum.data());
 
-  // Process cell by cell, swallowing overflow exception.
-  for (uint64_t c = start; c < end; c++) {
-    auto value = static_cast<int64_t>(values[c]);
-    if (*sum_data > 0 && value > 0 &&
-        (*sum_data > std::numeric_limits<int64_t>::max() - value)) {
-      *sum_data = std::numeric_limits<int64_t>::max();
-      break;
-    }
+  if constexpr (sizeof(T) < sizeof(int64_t)) {
+    // Accumulate blocks with a plain widened loop that vectorizes; a block
+    // cannot overflow the accumulator, so saturation only needs to be
+    // checked when folding a block into the running sum.
+    for (uint64_t b = start; b < end; b += sum_block_cells) {
+      const uint64_t block_end = std::min(end, b + sum_block_cells);
+      int64_t block_sum = 0;
+      for (uint64_t c = b; c < block_end; c++) {
+        block_sum += static_cast<int64_t>(values[c]);
+      }
 
-    if (*sum_data < 0 && value < 0 &&
-        (*sum_data < std::numeric_limits<int64_t>::min() - value)) {
-      *sum_data = std::numeric_limits<int64_t>::min();
-      break;
+      if (*sum_data > 0 && block_sum > 0 &&
+          (*sum_data > std::numeric_limits<int64_t>::max() - block_sum)) {
+        *sum_data = std::numeric_limits<int64_t>::max();
+        break;
+      }
+
+      if (*sum_data < 0 && block_sum < 0 &&
+          (*sum_data < std::numeric_limits<int64_t>::min() - block_sum)) {
+        *sum_data = std::numeric_limits<int64_t>::min();
+        break;
+      }
+
+      *sum_data += block_sum;
     }
+  } else {
+    // Process cell by cell, swallowing overflow exception.
+    for (uint64_t c = start; c < end; c++) {
+      auto value = static_cast<int64_t>(values[c]);
+      if (*sum_data > 0 && value > 0 &&
+          (*sum_data > std::numeric_limits<int64_t>::max() - value)) {
+        *sum_data = std::numeric_limits<int64_t>::max();
+        break;
+      }
 
-    *sum_data += value;
+      if (*sum_data < 0 && value < 0 &&
+          (*sum_data < std::numeric_limits<int64_t>::min() - value)) {
+        *sum_data = std::numeric_limits<int64_t>::min();
+        break;
+      }
+
+      *sum_data += value;
+    }
   }
 }
 
@@ -75,15 +110,35 @@ void Sum<T, uint64_t>::sum(
   auto values = tile.data_as<T>();
   auto sum_data = reinterpret_cast<uint64_t*>(sum.data());
 
-  // Process cell by cell, swallowing overflow exception.
-  for (uint64_t c = start; c < end; c++) {
-    auto value = static_cast<uint64_t>(values[c]);
-    if (*sum_data > std::numeric_limits<uint64_t>::max() - value) {
-      *sum_data = std::numeric_limits<uint64_t>::max();
-      break;
+  if constexpr (sizeof(T) < sizeof(uint64_t)) {
+    // Accumulate blocks with a plain widened loop that vectorizes; a block
+    // cannot overflow the accumulator, so saturation only needs to be
+    // checked when folding a block into the running sum.
+    for (uint64_t b = start; b < end; b += sum_block_cells) {
+      const uint64_t block_end = std::min(end, b + sum_block_cells);
+      uint64_t block_sum = 0;
+      for (uint64_t c = b; c < block_end; c++) {
+        block_sum += static_cast<uint64_t>(values[c]);
+      }
+
+      if (*sum_data > std::numeric_limits<uint64_t>::max() - block_sum) {
+        *sum_data = std::numeric_limits<uint64_t>::max();
+        break;
+      }
+
+      *sum_data += block_sum;
     }
+  } else {
+    // Process cell by cell, swallowing overflow exception.
+    for (uint64_t c = start; c < end; c++) {
+      auto value = static_cast<uint64_t>(values[c]);
+      if (*sum_data > std::numeric_limits<uint64_t>::max() - value) {
+        *sum_data = std::numeric_limits<uint64_t>::max();
+        break;
+      }
 
-    *sum_data += value;
+      *sum_data += value;
+    }
   }
 }
 
@@ -94,7 +149,8 @@ void Sum<T, double>::sum(
   auto values = tile.data_as<T>();
   auto sum_data = reinterpret_cast<double*>(sum.data());
 
-  // Process cell by cell, swallowing overflow exception.
+  // Process cell by cell, swallowing overflow exception. Block accumulation
+  // is not used here as it would change the rounding of the result.
   for (uint64_t c = start; c < end; c++) {
     auto value = static_cast<double>(values[c]);
     if ((*sum_data < 0.0) == (value < 0.0) &&
@@ -121,23 +177,51 @@ void Sum<T, int64_t>::sum_nullable(
   auto validity_values = validity_tile.data_as<uint8_t>();
   auto sum_data = reinterpret_cast<int64_t*>(sum.data());
 
-  // Process cell by cell, swallowing overflow exception.
-  for (uint64_t c = start; c < end; c++) {
-    if (validity_values[c] != 0) {
-      auto value = static_cast<int64_t>(values[c]);
-      if (*sum_data > 0 && value > 0 &&
-          (*sum_data > std::numeric_limits<int64_t>::max() - value)) {
+  if constexpr (sizeof(T) < sizeof(int64_t)) {
+    // Accumulate blocks with a plain widened loop where null cells
+    // contribute zero; the loop is branch free so it vectorizes, and
+    // saturation only needs to be checked once per block.
+    for (uint64_t b = start; b < end; b += sum_block_cells) {
+      const uint64_t block_end = std::min(end, b + sum_block_cells);
+      int64_t block_sum = 0;
+      for (uint64_t c = b; c < block_end; c++) {
+        block_sum +=
+            validity_values[c] != 0 ? static_cast<int64_t>(values[c]) : 0;
+      }
+
+      if (*sum_data > 0 && block_sum > 0 &&
+          (*sum_data > std::numeric_limits<int64_t>::max() - block_sum)) {
         *sum_data = std::numeric_limits<int64_t>::max();
         break;
       }
 
-      if (*sum_data < 0 && value < 0 &&
-          (*sum_data < std::numeric_limits<int64_t>::min() - value)) {
+      if (*sum_data < 0 && block_sum < 0 &&
+          (*sum_data < std::numeric_limits<int64_t>::min() - block_sum)) {
         *sum_data = std::numeric_limits<int64_t>::min();
         break;
       }
 
-      *sum_data += value;
+      *sum_data += block_sum;
+    }
+  } else {
+    // Process cell by cell, swallowing overflow exception.
+    for (uint64_t c = start; c < end; c++) {
+      if (validity_values[c] != 0) {
+        auto value = static_cast<int64_t>(values[c]);
+        if (*sum_data > 0 && value > 0 &&
+            (*sum_data > std::numeric_limits<int64_t>::max() - value)) {
+          *sum_data = std::numeric_limits<int64_t>::max();
+          break;
+        }
+
+        if (*sum_data < 0 && value < 0 &&
+            (*sum_data < std::numeric_limits<int64_t>::min() - value)) {
+          *sum_data = std::numeric_limits<int64_t>::min();
+          break;
+        }
+
+        *sum_data += value;
+      }
     }
   }
 }
@@ -154,16 +238,37 @@ void Sum<T, uint64_t>::sum_nullable(
   auto validity_values = validity_tile.data_as<uint8_t>();
   auto sum_data = reinterpret_cast<uint64_t*>(sum.data());
 
-  // Process cell by cell, swallowing overflow exception.
-  for (uint64_t c = start; c < end; c++) {
-    if (validity_values[c] != 0) {
-      auto value = static_cast<uint64_t>(values[c]);
-      if (*sum_data > std::numeric_limits<uint64_t>::max() - value) {
+  if constexpr (sizeof(T) < sizeof(uint64_t)) {
+    // Accumulate blocks with a plain widened loop where null cells
+    // contribute zero; the loop is branch free so it vectorizes, and
+    // saturation only needs to be checked once per block.
+    for (uint64_t b = start; b < end; b += sum_block_cells) {
+      const uint64_t block_end = std::min(end, b + sum_block_cells);
+      uint64_t block_sum = 0;
+      for (uint64_t c = b; c < block_end; c++) {
+        block_sum +=
+            validity_values[c] != 0 ? static_cast<uint64_t>(values[c]) : 0;
+      }
+
+      if (*sum_data > std::numeric_limits<uint64_t>::max() - block_sum) {
         *sum_data = std::numeric_limits<uint64_t>::max();
         break;
       }
 
-      *sum_data += value;
+      *sum_data += block_sum;
+    }
+  } else {
+    // Process cell by cell, swallowing overflow exception.
+    for (uint64_t c = start; c < end; c++) {
+      if (validity_values[c] != 0) {
+        auto value = static_cast<uint64_t>(values[c]);
+        if (*sum_data > std::numeric_limits<uint64_t>::max() - value) {
+          *sum_data = std::numeric_limits<uint64_t>::max();
+          break;
+        }
+
+        *sum_data += value;
+      }
     }
   }
 }
@@ -261,6 +366,65 @@ bool TileMetadataGenerator::has_sum_metadata(
   }
 }
 
+bool TileMetadataGenerator::has_bloom_filter_metadata(
+    const Datatype type,
+    const bool is_dim,
+    const bool var_size,
+    const uint64_t cell_val_num) {
+  // No bloom filters for dims, we have rtrees.
+  if (is_dim) {
+    return false;
+  }
+
+  // Bloom filters only make sense for equality, which the readers only
+  // push down for string data.
+  (void)var_size;
+  (void)cell_val_num;
+  return type == Datatype::CHAR || type == Datatype::STRING_ASCII;
+}
+
+/**
+ * Computes a 64 bit FNV-1a hash of the input value, used to derive the bit
+ * positions of the bloom filters.
+ */
+static inline uint64_t bloom_filter_hash(const void* value, uint64_t size) {
+  auto data = static_cast<const uint8_t*>(value);
+  uint64_t hash = 0xcbf29ce484222325;
+  for (uint64_t i = 0; i < size; i++) {
+    hash ^= data[i];
+    hash *= 0x100000001b3;
+  }
+
+  return hash;
+}
+
+void TileMetadataGenerator::bloom_filter_insert(
+    uint8_t* filter, const void* value, uint64_t size) {
+  // Derive all bit positions from two hashes, h1 + i * h2.
+  const uint64_t num_bits = constants::tile_bloom_filter_size * 8;
+  const uint64_t h1 = bloom_filter_hash(value, size);
+  const uint64_t h2 = h1 * 0x9e3779b97f4a7c15 | 1;
+  for (uint64_t i = 0; i < constants::tile_bloom_filter_hash_num; i++) {
+    const uint64_t bit = (h1 + i * h2) % num_bits;
+    filter[bit / 8] |= 1 << (bit % 8);
+  }
+}
+
+bool TileMetadataGenerator::bloom_filter_maybe_contains(
+    const uint8_t* filter, const void* value, uint64_t size) {
+  const uint64_t num_bits = constants::tile_bloom_filter_size * 8;
+  const uint64_t h1 = bloom_filter_hash(value, size);
+  const uint64_t h2 = h1 * 0x9e3779b97f4a7c15 | 1;
+  for (uint64_t i = 0; i < constants::tile_bloom_filter_hash_num; i++) {
+    const uint64_t bit = (h1 + i * h2) % num_bits;
+    if ((filter[bit / 8] & (1 << (bit % 8))) == 0) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 /* ****************************** */
 /*   CONSTRUCTORS & DESTRUCTORS   */
 /* ****************************** */
@@ -277,11 +441,18 @@ TileMetadataGenerator::TileMetadataGenerator(
     , min_size_(0)
     , max_(nullptr)
     , max_size_(0)
+    , min_buffer_(sizeof(uint64_t))
+    , max_buffer_(sizeof(uint64_t))
     , sum_(sizeof(uint64_t))
     , null_count_(0)
     , cell_size_(cell_size)
     , has_min_max_(has_min_max_metadata(type, is_dim, var_size, cell_val_num))
-    , has_sum_(has_sum_metadata(type, var_size, cell_val_num)) {
+    , has_sum_(has_sum_metadata(type, var_size, cell_val_num))
+    , has_bloom_filter_(
+          has_bloom_filter_metadata(type, is_dim, var_size, cell_val_num)) {
+  if (has_bloom_filter_) {
+    bloom_filter_.resize(constants::tile_bloom_filter_size, 0);
+  }
 }
 
 /* ****************************** */
@@ -356,6 +527,9 @@ void TileMetadataGenerator::process_cell_slab(
       case Datatype::STRING_ASCII:
       case Datatype::CHAR:
         process_cell_range<char>(tile, start, end);
+        if (has_bloom_filter_) {
+          bloom_filter_fixed_strings(tile, start, end);
+        }
         break;
       case Datatype::BLOB:
         process_cell_range<std::byte>(tile, start, end);
@@ -369,7 +543,8 @@ void TileMetadataGenerator::process_cell_slab(
 }
 
 void TileMetadataGenerator::set_tile_metadata(WriterTileTuple& tile) {
-  tile.set_metadata(min_, min_size_, max_, max_size_, sum_, null_count_);
+  tile.set_metadata(
+      min_, min_size_, max_, max_size_, sum_, null_count_, bloom_filter_);
 }
 
 /* ****************************** */
@@ -388,11 +563,20 @@ void TileMetadataGenerator::min_max(
     max_ = static_cast<const void*>(&metadata_generator_type_data<T>::max);
   }
 
-  // Process cell by cell.
+  // Track the running min/max by value; without the loop carried pointer
+  // select, the compiler turns this into vector min/max instructions.
+  T min_value = *static_cast<const T*>(min_);
+  T max_value = *static_cast<const T*>(max_);
   for (uint64_t c = start; c < end; c++) {
-    min_ = *static_cast<const T*>(min_) < values[c] ? min_ : &values[c];
-    max_ = *static_cast<const T*>(max_) > values[c] ? max_ : &values[c];
+    min_value = min_value < values[c] ? min_value : values[c];
+    max_value = max_value > values[c] ? max_value : values[c];
   }
+
+  // Point the metadata at scratch storage holding the values.
+  memcpy(min_buffer_.data(), &min_value, sizeof(T));
+  memcpy(max_buffer_.data(), &max_value, sizeof(T));
+  min_ = min_buffer_.data();
+  max_ = max_buffer_.data();
 }
 
 template <>
@@ -440,15 +624,24 @@ void TileMetadataGenerator::min_max_nullable(
     max_ = (void*)&metadata_generator_type_data<T>::max;
   }
 
-  // Process cell by cell.
+  // Track the running min/max and null count by value; the branch free
+  // loop lets the compiler use vector min/max and compares.
+  T min_value = *static_cast<const T*>(min_);
+  T max_value = *static_cast<const T*>(max_);
+  uint64_t null_count = 0;
   for (uint64_t c = start; c < end; c++) {
     const bool is_null = validity_values[c] == 0;
-    min_ = (is_null || (*static_cast<const T*>(min_) < values[c])) ? min_ :
-                                                                     &values[c];
-    max_ = (is_null || (*static_cast<const T*>(max_) > values[c])) ? max_ :
-                                                                     &values[c];
-    null_count_ += is_null;
+    min_value = (is_null || min_value < values[c]) ? min_value : values[c];
+    max_value = (is_null || max_value > values[c]) ? max_value : values[c];
+    null_count += is_null;
   }
+  null_count_ += null_count;
+
+  // Point the metadata at scratch storage holding the values.
+  memcpy(min_buffer_.data(), &min_value, sizeof(T));
+  memcpy(max_buffer_.data(), &max_value, sizeof(T));
+  min_ = min_buffer_.data();
+  max_ = max_buffer_.data();
 }
 
 template <>
@@ -503,12 +696,14 @@ void TileMetadataGenerator::process_cell_range(
     if (has_min_max_) {
       min_max_nullable<T>(fixed_tile, validity_tile, start, end);
     } else {
+      // Count the null cells with a local accumulator so the byte compare
+      // and sum vectorize.
       auto cell_num = tile.cell_num();
+      uint64_t null_count = 0;
       for (uint64_t c = 0; c < cell_num; c++) {
-        auto is_null = *validity_value == 0;
-        null_count_ += (uint64_t)is_null;
-        validity_value++;
+        null_count += (uint64_t)(validity_value[c] == 0);
       }
+      null_count_ += null_count;
     }
 
     if (has_sum_) {
@@ -543,6 +738,9 @@ void TileMetadataGenerator::process_cell_range_var(
       min_size_ = max_size_ = start == cell_num - 1 ?
                                   var_tile.size() - *offset_value :
                                   offset_value[1] - *offset_value;
+      if (has_bloom_filter_) {
+        bloom_filter_insert(bloom_filter_.data(), min_, min_size_);
+      }
       offset_value++;
       start++;
     }
@@ -552,6 +750,9 @@ void TileMetadataGenerator::process_cell_range_var(
       auto size = c == cell_num - 1 ? var_tile.size() - *offset_value :
                                       offset_value[1] - *offset_value;
       min_max_var(value, size);
+      if (has_bloom_filter_) {
+        bloom_filter_insert(bloom_filter_.data(), value, size);
+      }
       offset_value++;
     }
   } else {  // Var size attribute, nullable.
@@ -572,6 +773,10 @@ void TileMetadataGenerator::process_cell_range_var(
         } else {
           min_max_var(value, size);
         }
+
+        if (has_bloom_filter_) {
+          bloom_filter_insert(bloom_filter_.data(), value, size);
+        }
       }
       offset_value++;
 
@@ -616,5 +821,29 @@ inline void TileMetadataGenerator::min_max_var(
   }
 }
 
+void TileMetadataGenerator::bloom_filter_fixed_strings(
+    const WriterTileTuple& tile, uint64_t start, uint64_t end) {
+  // Handle empty tile.
+  if (tile.fixed_tile().size() == 0) {
+    return;
+  }
+
+  auto value = tile.fixed_tile().data_as<char>() + start * cell_size_;
+  if (!tile.nullable()) {
+    for (uint64_t c = start; c < end; c++) {
+      bloom_filter_insert(bloom_filter_.data(), value, cell_size_);
+      value += cell_size_;
+    }
+  } else {
+    auto validity_values = tile.validity_tile().data_as<uint8_t>();
+    for (uint64_t c = start; c < end; c++) {
+      if (validity_values[c] != 0) {
+        bloom_filter_insert(bloom_filter_.data(), value, cell_size_);
+      }
+      value += cell_size_;
+    }
+  }
+}
+
 }  // namespace sm
 }  // namespace tiledb
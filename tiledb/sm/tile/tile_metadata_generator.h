@@ -188,6 +188,43 @@ class TileMetadataGenerator {
   static bool has_sum_metadata(
       const Datatype type, const bool var_size, const uint64_t cell_val_num);
 
+  /**
+   * Does this datatype have bloom filter metadata.
+   *
+   * @param type Data type.
+   * @param is_dim Is it a dimension.
+   * @param var_size Is the attribute var size.
+   * @param cell_val_num Number of values per cell.
+   * @return bool.
+   */
+  static bool has_bloom_filter_metadata(
+      const Datatype type,
+      const bool is_dim,
+      const bool var_size,
+      const uint64_t cell_val_num);
+
+  /**
+   * Inserts a value into a tile bloom filter.
+   *
+   * @param filter Bloom filter of `constants::tile_bloom_filter_size` bytes.
+   * @param value Value to insert.
+   * @param size Value size.
+   */
+  static void bloom_filter_insert(
+      uint8_t* filter, const void* value, uint64_t size);
+
+  /**
+   * Checks a tile bloom filter for a value. A `false` return guarantees the
+   * value was never inserted, a `true` return means it might have been.
+   *
+   * @param filter Bloom filter of `constants::tile_bloom_filter_size` bytes.
+   * @param value Value to check.
+   * @param size Value size.
+   * @return Can the filter contain the value.
+   */
+  static bool bloom_filter_maybe_contains(
+      const uint8_t* filter, const void* value, uint64_t size);
+
   /* ********************************* */
   /*     CONSTRUCTORS & DESTRUCTORS    */
   /* ********************************* */
@@ -257,6 +294,12 @@ class TileMetadataGenerator {
   /** Maximum value size for this tile. */
   uint64_t max_size_;
 
+  /** Scratch storage backing `min_` for fixed size numeric data. */
+  ByteVec min_buffer_;
+
+  /** Scratch storage backing `max_` for fixed size numeric data. */
+  ByteVec max_buffer_;
+
   /** Sum of values. */
   ByteVec sum_;
 
@@ -272,6 +315,12 @@ class TileMetadataGenerator {
   /** This metadata stores sums. */
   bool has_sum_;
 
+  /** This metadata stores a bloom filter. */
+  bool has_bloom_filter_;
+
+  /** Bloom filter over the values of this tile. */
+  ByteVec bloom_filter_;
+
   /* ********************************* */
   /*          PRIVATE METHODS          */
   /* ********************************* */
@@ -329,6 +378,16 @@ class TileMetadataGenerator {
    * @param size Value size.
    */
   void min_max_var(const char* value, const uint64_t size);
+
+  /**
+   * Inserts the cells of a fixed size string tile into the bloom filter.
+   *
+   * @param tile Writer tile that contains the data.
+   * @param start Start cell index.
+   * @param end End cell index.
+   */
+  void bloom_filter_fixed_strings(
+      const WriterTileTuple& tile, uint64_t start, uint64_t end);
 };
 
 }  // namespace sm
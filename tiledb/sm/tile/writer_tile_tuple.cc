@@ -31,6 +31,8 @@
  */
 
 #include "tiledb/sm/tile/writer_tile_tuple.h"
+#include "tiledb/common/dynamic_memory/huge_page_memory.h"
+#include "tiledb/common/heap_memory.h"
 #include "tiledb/sm/array_schema/domain.h"
 
 using namespace tiledb::common;
@@ -82,6 +84,51 @@ WriterTileTuple::WriterTileTuple(
     , cell_num_(cell_num_per_tile) {
 }
 
+WriterTileTuple::WriterTileTuple(
+    const ArraySchema& array_schema,
+    const uint64_t cell_num_per_tile,
+    const bool var_size,
+    const bool nullable,
+    const uint64_t cell_size,
+    const Datatype type,
+    void* fixed_data,
+    void* validity_data)
+    : fixed_tile_(
+          var_size ? WriterTile(
+                         array_schema.write_version(),
+                         constants::cell_var_offset_type,
+                         constants::cell_var_offset_size,
+                         cell_num_per_tile * constants::cell_var_offset_size,
+                         fixed_data) :
+                     WriterTile(
+                         array_schema.write_version(),
+                         type,
+                         cell_size,
+                         cell_num_per_tile * cell_size,
+                         fixed_data))
+    , var_tile_(
+          var_size ? std::optional<WriterTile>(WriterTile(
+                         array_schema.write_version(),
+                         type,
+                         datatype_size(type),
+                         cell_num_per_tile * constants::cell_var_offset_size)) :
+                     std::nullopt)
+    , validity_tile_(
+          nullable ? std::optional<WriterTile>(WriterTile(
+                         array_schema.write_version(),
+                         constants::cell_validity_type,
+                         constants::cell_validity_size,
+                         cell_num_per_tile * constants::cell_validity_size,
+                         validity_data)) :
+                     std::nullopt)
+    , cell_size_(cell_size)
+    , var_pre_filtered_size_(0)
+    , min_size_(0)
+    , max_size_(0)
+    , null_count_(0)
+    , cell_num_(cell_num_per_tile) {
+}
+
 WriterTileTuple::WriterTileTuple(WriterTileTuple&& tile)
     : fixed_tile_(std::move(tile.fixed_tile_))
     , var_tile_(std::move(tile.var_tile_))
@@ -94,6 +141,7 @@ WriterTileTuple::WriterTileTuple(WriterTileTuple&& tile)
     , max_size_(std::move(tile.max_size_))
     , sum_(std::move(tile.sum_))
     , null_count_(std::move(tile.null_count_))
+    , bloom_filter_(std::move(tile.bloom_filter_))
     , cell_num_(std::move(tile.cell_num_)) {
 }
 
@@ -114,7 +162,8 @@ void WriterTileTuple::set_metadata(
     const void* max,
     const uint64_t max_size,
     const ByteVec& sum,
-    const uint64_t null_count) {
+    const uint64_t null_count,
+    const ByteVec& bloom_filter) {
   min_.resize(min_size);
   min_size_ = min_size;
   if (min != nullptr) {
@@ -129,6 +178,7 @@ void WriterTileTuple::set_metadata(
 
   sum_ = sum;
   null_count_ = null_count;
+  bloom_filter_ = bloom_filter;
 
   if (var_tile_.has_value()) {
     var_pre_filtered_size_ = var_tile_->size();
@@ -147,8 +197,53 @@ void WriterTileTuple::swap(WriterTileTuple& tile) {
   std::swap(max_size_, tile.max_size_);
   std::swap(sum_, tile.sum_);
   std::swap(null_count_, tile.null_count_);
+  std::swap(bloom_filter_, tile.bloom_filter_);
   std::swap(cell_num_, tile.cell_num_);
 }
 
+void WriterTileTupleVector::init_tiles(
+    const ArraySchema& array_schema,
+    uint64_t tile_num,
+    uint64_t cell_num_per_tile,
+    bool var_size,
+    bool nullable,
+    uint64_t cell_size,
+    Datatype type) {
+  if (tile_num == 0) {
+    return;
+  }
+
+  // All fixed and validity buffers for the batch come from a single slab,
+  // released when this vector is destroyed.
+  const uint64_t fixed_tile_size =
+      cell_num_per_tile *
+      (var_size ? constants::cell_var_offset_size : cell_size);
+  const uint64_t validity_tile_size =
+      nullable ? cell_num_per_tile * constants::cell_validity_size : 0;
+  const uint64_t per_tile_size = fixed_tile_size + validity_tile_size;
+
+  auto slab = static_cast<char*>(tdb_malloc(tile_num * per_tile_size));
+  if (slab == nullptr) {
+    throw std::bad_alloc();
+  }
+  slabs_.emplace_back(slab, tiledb_free);
+  tdb_hugepage_hint(slab, tile_num * per_tile_size);
+
+  reserve(size() + tile_num);
+  for (uint64_t i = 0; i < tile_num; i++) {
+    char* fixed_data = slab + i * per_tile_size;
+    char* validity_data = nullable ? fixed_data + fixed_tile_size : nullptr;
+    emplace_back(WriterTileTuple(
+        array_schema,
+        cell_num_per_tile,
+        var_size,
+        nullable,
+        cell_size,
+        type,
+        fixed_data,
+        validity_data));
+  }
+}
+
 }  // namespace sm
 }  // namespace tiledb
@@ -58,6 +58,31 @@ class WriterTileTuple {
       const uint64_t cell_size,
       const Datatype type);
 
+  /**
+   * Constructor for a tuple with fixed and validity buffers carved from
+   * externally owned memory, e.g. the slab of a write batch. The var tile,
+   * if any, keeps its own growable allocation.
+   *
+   * @param array_schema The array schema.
+   * @param cell_num_per_tile Number of cells per tile.
+   * @param var_size Is the tuple var sized.
+   * @param nullable Is the tuple nullable.
+   * @param cell_size Cell size for this attribute.
+   * @param type The data type.
+   * @param fixed_data Externally owned buffer backing the fixed tile.
+   * @param validity_data Externally owned buffer backing the validity tile,
+   *     only used when `nullable` is set.
+   */
+  WriterTileTuple(
+      const ArraySchema& array_schema,
+      const uint64_t cell_num_per_tile,
+      const bool var_size,
+      const bool nullable,
+      const uint64_t cell_size,
+      const Datatype type,
+      void* fixed_data,
+      void* validity_data);
+
   /** Move constructor. */
   WriterTileTuple(WriterTileTuple&& tile);
 
@@ -169,6 +194,15 @@ class WriterTileTuple {
     return sum_;
   }
 
+  /**
+   * Returns the tile bloom filter.
+   *
+   * @return tile bloom filter.
+   */
+  inline const ByteVec& bloom_filter() const {
+    return bloom_filter_;
+  }
+
   /**
    * Sets the tile metadata.
    *
@@ -178,6 +212,7 @@ class WriterTileTuple {
    * @param max_size Maxmum size.
    * @param sum Sum.
    * @param null_count Null count.
+   * @param bloom_filter Bloom filter.
    */
   void set_metadata(
       const void* min,
@@ -185,7 +220,8 @@ class WriterTileTuple {
       const void* max,
       const uint64_t max_size,
       const ByteVec& sum,
-      const uint64_t null_count);
+      const uint64_t null_count,
+      const ByteVec& bloom_filter);
 
   /**
    * Sets the final size of a written tile.
@@ -259,10 +295,72 @@ class WriterTileTuple {
   /** Count of null values. */
   uint64_t null_count_;
 
+  /** Bloom filter over the values of this tile. */
+  ByteVec bloom_filter_;
+
   /** Cell num. */
   uint64_t cell_num_;
 };
 
+/**
+ * Vector of WriterTileTuple objects for a write batch. Tiles created through
+ * `init_tiles` have their fixed and validity buffers carved from a single
+ * slab owned by the vector instead of being allocated per tile, and the
+ * slabs are released in bulk when the vector is destroyed. The var data
+ * buffers grow by reallocation so they stay individually allocated.
+ *
+ * Note that an individual WriterTile must not be moved or swapped out of a
+ * slab backed tuple into an object that outlives the vector.
+ */
+class WriterTileTupleVector : public std::vector<WriterTileTuple> {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  WriterTileTupleVector() = default;
+
+  /** Move constructor. */
+  WriterTileTupleVector(WriterTileTupleVector&&) = default;
+
+  /** Move-assign operator. */
+  WriterTileTupleVector& operator=(WriterTileTupleVector&&) = default;
+
+  DISABLE_COPY_AND_COPY_ASSIGN(WriterTileTupleVector);
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /**
+   * Appends `tile_num` tiles backed by a single slab allocation.
+   *
+   * @param array_schema The array schema.
+   * @param tile_num Number of tiles to initialize.
+   * @param cell_num_per_tile Number of cells per tile.
+   * @param var_size Is the attribute/dimension var sized.
+   * @param nullable Is the attribute/dimension nullable.
+   * @param cell_size Cell size for this attribute/dimension.
+   * @param type The data type.
+   */
+  void init_tiles(
+      const ArraySchema& array_schema,
+      uint64_t tile_num,
+      uint64_t cell_num_per_tile,
+      bool var_size,
+      bool nullable,
+      uint64_t cell_size,
+      Datatype type);
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** Slabs backing the fixed and validity buffers of the tiles. */
+  std::vector<std::unique_ptr<char, void (*)(void*)>> slabs_;
+};
+
 }  // namespace sm
 }  // namespace tiledb
 
@@ -0,0 +1,179 @@
+/**
+ * @file bitpack_offsets.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements the frame-of-reference bit-packed encoding used for
+ * the tile offset lists in the fragment metadata.
+ */
+
+#include "tiledb/storage_format/offsets/bitpack_offsets.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace tiledb::sm::storage_format {
+
+/** Returns the number of words needed to pack `num` values of `width` bits. */
+static inline uint64_t packed_word_num(uint64_t num, uint8_t width) {
+  return (num * width + 63) / 64;
+}
+
+/**
+ * Unpacks deltas stored with a width that is a whole number of bytes. The
+ * widening loads have no cross-word bit arithmetic, so the loop vectorizes.
+ */
+template <class T>
+static void unpack_byte_width_deltas(
+    const uint64_t* words, uint64_t delta_num, uint64_t* out) {
+  auto src = static_cast<const T*>(static_cast<const void*>(words));
+  for (uint64_t i = 0; i < delta_num; i++) {
+    out[i] = src[i];
+  }
+}
+
+void write_bitpacked_offsets(
+    Serializer& serializer, const uint64_t* offsets, uint64_t num) {
+  // Compute the largest delta, falling back to the raw encoding if the
+  // sequence is not non-decreasing.
+  uint64_t max_delta = 0;
+  for (uint64_t i = 1; i < num; i++) {
+    if (offsets[i] < offsets[i - 1]) {
+      serializer.write<uint8_t>(raw_encoding_marker);
+      serializer.write(offsets, num * sizeof(uint64_t));
+      return;
+    }
+
+    max_delta = std::max(max_delta, offsets[i] - offsets[i - 1]);
+  }
+
+  // Smallest width that holds the largest delta.
+  uint8_t width = 0;
+  while (width < 64 && (max_delta >> width) != 0) {
+    width++;
+  }
+
+  serializer.write<uint8_t>(width);
+  serializer.write<uint64_t>(offsets[0]);
+
+  if (num == 1 || width == 0) {
+    return;
+  }
+
+  // Pack the deltas.
+  const uint64_t delta_num = num - 1;
+  const uint64_t word_num = packed_word_num(delta_num, width);
+  std::vector<uint64_t> words(word_num, 0);
+  uint64_t bit_pos = 0;
+  for (uint64_t i = 0; i < delta_num; i++) {
+    const uint64_t delta = offsets[i + 1] - offsets[i];
+    const uint64_t word = bit_pos >> 6;
+    const unsigned shift = bit_pos & 63;
+    words[word] |= delta << shift;
+    if (shift + width > 64) {
+      words[word + 1] |= delta >> (64 - shift);
+    }
+    bit_pos += width;
+  }
+
+  serializer.write(words.data(), word_num * sizeof(uint64_t));
+}
+
+void read_bitpacked_offsets(
+    Deserializer& deserializer, uint64_t* offsets, uint64_t num) {
+  const auto width = deserializer.read<uint8_t>();
+  if (width == raw_encoding_marker) {
+    deserializer.read(offsets, num * sizeof(uint64_t));
+    return;
+  }
+
+  if (width > 64) {
+    throw std::logic_error(
+        "Invalid bit width reading bit-packed tile offsets.");
+  }
+
+  offsets[0] = deserializer.read<uint64_t>();
+  if (num == 1) {
+    return;
+  }
+
+  const uint64_t delta_num = num - 1;
+  if (width == 0) {
+    for (uint64_t i = 1; i < num; i++) {
+      offsets[i] = offsets[0];
+    }
+    return;
+  }
+
+  // Copy the packed words out of the serialized buffer, which has no
+  // alignment guarantee at this position. The copy is `width / 64` of the
+  // output size.
+  const uint64_t word_num = packed_word_num(delta_num, width);
+  std::vector<uint64_t> word_data(word_num);
+  deserializer.read(word_data.data(), word_num * sizeof(uint64_t));
+  const uint64_t* words = word_data.data();
+
+  // Unpack the deltas into the output, then turn them into offsets with a
+  // prefix sum. Byte-aligned widths cover nearly all offset lists and
+  // unpack with a vectorizable widening copy.
+  uint64_t* deltas = &offsets[1];
+  switch (width) {
+    case 8:
+      unpack_byte_width_deltas<uint8_t>(words, delta_num, deltas);
+      break;
+    case 16:
+      unpack_byte_width_deltas<uint16_t>(words, delta_num, deltas);
+      break;
+    case 32:
+      unpack_byte_width_deltas<uint32_t>(words, delta_num, deltas);
+      break;
+    case 64:
+      unpack_byte_width_deltas<uint64_t>(words, delta_num, deltas);
+      break;
+    default: {
+      const uint64_t mask = (UINT64_C(1) << width) - 1;
+      uint64_t bit_pos = 0;
+      for (uint64_t i = 0; i < delta_num; i++) {
+        const uint64_t word = bit_pos >> 6;
+        const unsigned shift = bit_pos & 63;
+        uint64_t value = words[word] >> shift;
+        if (shift + width > 64) {
+          value |= words[word + 1] << (64 - shift);
+        }
+        deltas[i] = value & mask;
+        bit_pos += width;
+      }
+      break;
+    }
+  }
+
+  for (uint64_t i = 1; i < num; i++) {
+    offsets[i] += offsets[i - 1];
+  }
+}
+
+}  // namespace tiledb::sm::storage_format
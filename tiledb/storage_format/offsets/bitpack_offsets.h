@@ -0,0 +1,88 @@
+/**
+ * @file bitpack_offsets.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file declares the frame-of-reference bit-packed encoding used for the
+ * tile offset lists in the fragment metadata.
+ *
+ * Tile offsets are near-arithmetic sequences: consecutive values differ by
+ * roughly the filtered tile size. The encoding stores the first offset as the
+ * frame of reference and the deltas between consecutive offsets bit-packed
+ * with the smallest width that holds the largest delta, which both shrinks
+ * the serialized metadata and decodes much faster than a general purpose
+ * compressor. Sequences that are not non-decreasing fall back to the raw
+ * little-endian `uint64_t` array, flagged by a reserved bit width marker, so
+ * the encoding never loses data.
+ *
+ * Serialized layout, after the offset count written by the caller:
+ * - bit_width (uint8_t): width of the packed deltas, or `raw_encoding_marker`
+ *   for the raw fallback.
+ * - base (uint64_t): the first offset. Absent in the raw fallback.
+ * - packed deltas: `ceil((num - 1) * bit_width / 64)` little-endian
+ *   `uint64_t` words, value `i` occupying bits `[i * bit_width,
+ *   (i + 1) * bit_width)`. In the raw fallback, `num` raw `uint64_t` values
+ *   instead.
+ */
+
+#ifndef TILEDB_BITPACK_OFFSETS_H
+#define TILEDB_BITPACK_OFFSETS_H
+
+#include "tiledb/storage_format/serialization/serializers.h"
+
+namespace tiledb::sm::storage_format {
+
+/** Bit width marker flagging the raw, unpacked fallback encoding. */
+constexpr uint8_t raw_encoding_marker = UINT8_MAX;
+
+/**
+ * Serializes an offsets list with the frame-of-reference bit-packed
+ * encoding.
+ *
+ * The caller is expected to have written the number of offsets already, as
+ * the count field predates this encoding in the on-disk format.
+ *
+ * @param serializer Serializer to write to.
+ * @param offsets Offsets to serialize.
+ * @param num Number of offsets, must not be 0.
+ */
+void write_bitpacked_offsets(
+    Serializer& serializer, const uint64_t* offsets, uint64_t num);
+
+/**
+ * Deserializes an offsets list written by `write_bitpacked_offsets`.
+ *
+ * @param deserializer Deserializer to read from.
+ * @param offsets Output buffer for the offsets, must hold `num` values.
+ * @param num Number of offsets read from the count field by the caller.
+ */
+void read_bitpacked_offsets(
+    Deserializer& deserializer, uint64_t* offsets, uint64_t num);
+
+}  // namespace tiledb::sm::storage_format
+
+#endif  // TILEDB_BITPACK_OFFSETS_H
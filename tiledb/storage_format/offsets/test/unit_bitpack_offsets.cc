@@ -0,0 +1,134 @@
+/**
+ * @file unit_bitpack_offsets.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Tests the frame-of-reference bit-packed offsets encoding.
+ */
+
+#include "tiledb/storage_format/offsets/bitpack_offsets.h"
+
+#include <tdb_catch.h>
+#include <random>
+
+using namespace tiledb::sm;
+using namespace tiledb::sm::storage_format;
+
+/** Serializes and deserializes `offsets`, returning the decoded values. */
+static std::vector<uint64_t> round_trip(const std::vector<uint64_t>& offsets) {
+  SizeComputationSerializer size_computation_serializer;
+  write_bitpacked_offsets(
+      size_computation_serializer, offsets.data(), offsets.size());
+
+  std::vector<uint8_t> data(size_computation_serializer.size());
+  Serializer serializer(data.data(), data.size());
+  write_bitpacked_offsets(serializer, offsets.data(), offsets.size());
+
+  std::vector<uint64_t> decoded(offsets.size());
+  Deserializer deserializer(data.data(), data.size());
+  read_bitpacked_offsets(deserializer, decoded.data(), decoded.size());
+  CHECK(deserializer.remaining_bytes() == 0);
+
+  return decoded;
+}
+
+TEST_CASE(
+    "Bitpack offsets: single offset", "[storage_format][bitpack_offsets]") {
+  std::vector<uint64_t> offsets{1234};
+  CHECK(round_trip(offsets) == offsets);
+}
+
+TEST_CASE(
+    "Bitpack offsets: constant deltas", "[storage_format][bitpack_offsets]") {
+  // An arithmetic sequence with a power of two delta packs with the exact
+  // width of the delta.
+  std::vector<uint64_t> offsets(1000);
+  for (uint64_t i = 0; i < offsets.size(); i++) {
+    offsets[i] = 100 + i * 4096;
+  }
+  CHECK(round_trip(offsets) == offsets);
+
+  // All equal values pack with a zero width.
+  std::fill(offsets.begin(), offsets.end(), 42);
+  CHECK(round_trip(offsets) == offsets);
+}
+
+TEST_CASE(
+    "Bitpack offsets: all bit widths", "[storage_format][bitpack_offsets]") {
+  // Widths where a hundred maximal deltas cannot overflow the offsets.
+  for (unsigned width = 1; width <= 56; width++) {
+    const uint64_t max_delta = (UINT64_C(1) << width) - 1;
+
+    std::mt19937_64 rng(width);
+    std::uniform_int_distribution<uint64_t> dist(0, max_delta);
+
+    std::vector<uint64_t> offsets(100);
+    offsets[0] = dist(rng);
+    for (uint64_t i = 1; i < offsets.size(); i++) {
+      offsets[i] = offsets[i - 1] + dist(rng);
+    }
+
+    // Force at least one maximum delta so the width is exercised exactly.
+    offsets.push_back(offsets.back() + max_delta);
+
+    CHECK(round_trip(offsets) == offsets);
+  }
+
+  // A delta with the top bit set needs the full 64-bit width.
+  std::vector<uint64_t> offsets{123, 123 + (UINT64_C(1) << 63) + 1};
+  CHECK(round_trip(offsets) == offsets);
+}
+
+TEST_CASE(
+    "Bitpack offsets: non-monotone fallback",
+    "[storage_format][bitpack_offsets]") {
+  std::vector<uint64_t> offsets{10, 5, 20, 15, 0, UINT64_MAX};
+  CHECK(round_trip(offsets) == offsets);
+}
+
+TEST_CASE(
+    "Bitpack offsets: size is smaller than raw",
+    "[storage_format][bitpack_offsets]") {
+  // Typical tile offsets: ~1MB tiles with small size variations.
+  std::mt19937_64 rng(1234);
+  std::uniform_int_distribution<uint64_t> dist(1000000, 1100000);
+  std::vector<uint64_t> offsets(10000);
+  offsets[0] = 0;
+  for (uint64_t i = 1; i < offsets.size(); i++) {
+    offsets[i] = offsets[i - 1] + dist(rng);
+  }
+
+  SizeComputationSerializer size_computation_serializer;
+  write_bitpacked_offsets(
+      size_computation_serializer, offsets.data(), offsets.size());
+
+  // 21 bits per delta instead of 64 bits per offset.
+  CHECK(
+      size_computation_serializer.size() <
+      offsets.size() * sizeof(uint64_t) / 3);
+  CHECK(round_trip(offsets) == offsets);
+}